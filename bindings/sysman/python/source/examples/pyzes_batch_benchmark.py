@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+##
+# Copyright (C) 2026 Intel Corporation
+#
+# SPDX-License-Identifier: MIT
+#
+##
+
+"""
+Run:
+  python pyzes_batch_benchmark.py [-n ITERATIONS]
+
+Compares two ways of polling the power, frequency, temperature, engine and
+memory telemetry of every Sysman device:
+  per-call  one ctypes call per component (zesPowerGetEnergyCounter,
+            zesFrequencyGetState, zesTemperatureGetState, zesEngineGetActivity,
+            zesMemoryGetState), with the component handles enumerated once
+  batched   one SysmanSnapshot.read(), i.e. one zelSysmanGetSnapshot call for
+            all devices and domains
+and prints the time per poll of each.
+"""
+
+import argparse
+import os
+import sys
+import time
+from ctypes import *
+
+# Add the source directory to Python path so we can import pyzes
+script_dir = os.path.dirname(os.path.abspath(__file__))
+source_dir = os.path.join(script_dir, "..")
+source_dir = os.path.abspath(source_dir)
+if source_dir not in sys.path:
+    sys.path.insert(0, source_dir)
+
+import pyzes as pz
+
+
+def check_rc(label, rc):
+    if rc != pz.ZE_RESULT_SUCCESS:
+        print(f"ERROR: {label} failed with ze_result_t={rc}")
+        sys.exit(1)
+
+
+def get_devices():
+    check_rc("zesInit", pz.zesInit(0))
+    driver_count = c_uint32(0)
+    check_rc("zesDriverGet(count)", pz.zesDriverGet(byref(driver_count), None))
+    drivers = (pz.zes_driver_handle_t * driver_count.value)()
+    check_rc("zesDriverGet(handles)", pz.zesDriverGet(byref(driver_count), drivers))
+    devices = []
+    for driver in drivers:
+        device_count = c_uint32(0)
+        check_rc(
+            "zesDeviceGet(count)", pz.zesDeviceGet(driver, byref(device_count), None)
+        )
+        driver_devices = (pz.zes_device_handle_t * device_count.value)()
+        check_rc(
+            "zesDeviceGet(handles)",
+            pz.zesDeviceGet(driver, byref(device_count), driver_devices),
+        )
+        devices.extend(driver_devices)
+    return devices
+
+
+def enumerate_components(enum_func, handle_type, device):
+    count = c_uint32(0)
+    if enum_func(device, byref(count), None) != pz.ZE_RESULT_SUCCESS:
+        return []
+    handles = (handle_type * count.value)()
+    if enum_func(device, byref(count), handles) != pz.ZE_RESULT_SUCCESS:
+        return []
+    return list(handles[: count.value])
+
+
+def make_per_call_poll(devices):
+    """Returns a function reading every component with one call each, and
+    the number of calls it makes."""
+    reads = []
+    domains = (
+        (pz.zesDeviceEnumPowerDomains, pz.zes_pwr_handle_t,
+         pz.zesPowerGetEnergyCounter, pz.zes_power_energy_counter_t),
+        (pz.zesDeviceEnumFrequencyDomains, pz.zes_freq_handle_t,
+         pz.zesFrequencyGetState, pz.zes_freq_state_t),
+        (pz.zesDeviceEnumTemperatureSensors, pz.zes_temp_handle_t,
+         pz.zesTemperatureGetState, c_double),
+        (pz.zesDeviceEnumEngineGroups, pz.zes_engine_handle_t,
+         pz.zesEngineGetActivity, pz.zes_engine_stats_t),
+        (pz.zesDeviceEnumMemoryModules, pz.zes_mem_handle_t,
+         pz.zesMemoryGetState, pz.zes_mem_state_t),
+    )
+    for device in devices:
+        for enum_func, handle_type, read_func, value_type in domains:
+            for handle in enumerate_components(enum_func, handle_type, device):
+                reads.append((read_func, handle, value_type()))
+
+    def poll():
+        for read_func, handle, value in reads:
+            read_func(handle, byref(value))
+
+    return poll, len(reads)
+
+
+def time_polls(poll, iterations):
+    poll()  # warm up: resolves function pointers and fills caches
+    start = time.perf_counter()
+    for _ in range(iterations):
+        poll()
+    return (time.perf_counter() - start) / iterations
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Per-call vs. batched Sysman telemetry polling"
+    )
+    parser.add_argument(
+        "-n", "--iterations", type=int, default=1000, help="polls per mode"
+    )
+    args = parser.parse_args()
+
+    devices = get_devices()
+    if not devices:
+        print("No Sysman devices found")
+        return 1
+
+    per_call, calls = make_per_call_poll(devices)
+    snapshot = pz.SysmanSnapshot(devices)
+    check_rc("zelSysmanGetSnapshot", snapshot.read())
+
+    per_call_s = time_polls(per_call, args.iterations)
+    batched_s = time_polls(snapshot.read, args.iterations)
+
+    print(f"devices: {len(devices)}, components: {calls}, polls: {args.iterations}")
+    print(f"per-call: {per_call_s * 1e6:10.1f} us/poll ({calls} native calls)")
+    print(f"batched:  {batched_s * 1e6:10.1f} us/poll (1 native call)")
+    if batched_s > 0:
+        print(f"speedup:  {per_call_s / batched_s:10.1f}x")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -779,6 +779,85 @@ class zes_engine_stats_t(_PrintableStructure):
     _fmt_ = {"activeTime": "%d", "timestamp": "%d"}
 
 
+## Batched telemetry structures (loader extension, ze_loader.h) ##
+zel_sysman_snapshot_domain_flags_t = c_uint32
+ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_POWER = 1 << 0
+ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_FREQUENCY = 1 << 1
+ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_TEMPERATURE = 1 << 2
+ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_ENGINE = 1 << 3
+ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_MEMORY = 1 << 4
+ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_FORCE_UINT32 = 0x7FFFFFFF
+
+
+class zel_sysman_power_sample_t(_PrintableStructure):
+    _fields_ = [
+        ("result", ze_result_t),  # result of reading the counter
+        ("onSubdevice", ze_bool_t),
+        ("subdeviceId", c_uint32),
+        ("energy", zes_power_energy_counter_t),
+    ]
+
+
+class zel_sysman_frequency_sample_t(_PrintableStructure):
+    _fields_ = [
+        ("result", ze_result_t),  # result of reading the state
+        ("type", zes_freq_domain_t),
+        ("onSubdevice", ze_bool_t),
+        ("subdeviceId", c_uint32),
+        ("state", zes_freq_state_t),
+    ]
+
+
+class zel_sysman_temperature_sample_t(_PrintableStructure):
+    _fields_ = [
+        ("result", ze_result_t),  # result of reading the sensor
+        ("type", zes_temp_sensors_t),
+        ("onSubdevice", ze_bool_t),
+        ("subdeviceId", c_uint32),
+        ("temperature", c_double),  # in degrees Celsius
+    ]
+    _fmt_ = {"temperature": "%.1f °C"}
+
+
+class zel_sysman_engine_sample_t(_PrintableStructure):
+    _fields_ = [
+        ("result", ze_result_t),  # result of reading the counters
+        ("type", zes_engine_group_t),
+        ("onSubdevice", ze_bool_t),
+        ("subdeviceId", c_uint32),
+        ("stats", zes_engine_stats_t),
+    ]
+
+
+class zel_sysman_memory_sample_t(_PrintableStructure):
+    _fields_ = [
+        ("result", ze_result_t),  # result of reading the state
+        ("type", zes_mem_type_t),
+        ("location", zes_mem_loc_t),
+        ("onSubdevice", ze_bool_t),
+        ("subdeviceId", c_uint32),
+        ("state", zes_mem_state_t),
+    ]
+
+
+class zel_sysman_device_snapshot_t(_PrintableStructure):
+    _fields_ = [
+        ("hDevice", zes_device_handle_t),
+        ("domains", zel_sysman_snapshot_domain_flags_t),  # ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_*
+        ("result", ze_result_t),  # first error enumerating components
+        ("powerCount", c_uint32),  # in: entries in pPower, out: power domains
+        ("pPower", POINTER(zel_sysman_power_sample_t)),
+        ("frequencyCount", c_uint32),
+        ("pFrequency", POINTER(zel_sysman_frequency_sample_t)),
+        ("temperatureCount", c_uint32),
+        ("pTemperature", POINTER(zel_sysman_temperature_sample_t)),
+        ("engineCount", c_uint32),
+        ("pEngine", POINTER(zel_sysman_engine_sample_t)),
+        ("memoryCount", c_uint32),
+        ("pMemory", POINTER(zel_sysman_memory_sample_t)),
+    ]
+
+
 ## Function access ##
 _getFunctionPointerList: Dict[str, Any] = dict()
 
@@ -1556,3 +1635,108 @@ def zesEngineGetActivity(hEngine, pStats):
 
     retVal = funcPtr(hEngine, pStats)
     return retVal
+
+
+## Batched telemetry (loader extension) ##
+def zelSysmanGetSnapshot(count, pSnapshots):
+    """Wraps API:
+    ze_result_t zelSysmanGetSnapshot(
+        uint32_t count,
+        zel_sysman_device_snapshot_t* pSnapshots)
+
+    Parameters:
+      count: number of entries in pSnapshots
+      pSnapshots: array of zel_sysman_device_snapshot_t - devices to read and
+                  the sample arrays to fill
+    Returns:
+      ze_result_t - return code only, samples are filled into the arrays
+    """
+    funcPtr = getFunctionPointerList("zelSysmanGetSnapshot")
+    funcPtr.argtypes = [c_uint32, POINTER(zel_sysman_device_snapshot_t)]
+    funcPtr.restype = ze_result_t
+
+    retVal = funcPtr(count, pSnapshots)
+    return retVal
+
+
+class SysmanSnapshot:
+    """
+    Telemetry of several devices, refreshed with a single zelSysmanGetSnapshot
+    call instead of one ctypes call per component.
+
+    Every requested domain gets one contiguous ctypes array of samples with
+    `capacity` entries per device; the samples of device i start at index
+    i * capacity. The arrays implement the buffer protocol, so
+    memoryview(snapshot.power) or numpy.ctypeslib.as_array(snapshot.power)
+    view them as structured arrays without copying, and every read() refills
+    them in place.
+
+    Usage:
+      snapshot = SysmanSnapshot(devices)
+      if snapshot.read() == ZE_RESULT_SUCCESS:
+          for sample in snapshot.samples("power", 0):
+              print(sample.energy.energy)
+    """
+
+    _domains = (
+        ("power", ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_POWER, zel_sysman_power_sample_t),
+        ("frequency", ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_FREQUENCY, zel_sysman_frequency_sample_t),
+        ("temperature", ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_TEMPERATURE, zel_sysman_temperature_sample_t),
+        ("engine", ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_ENGINE, zel_sysman_engine_sample_t),
+        ("memory", ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_MEMORY, zel_sysman_memory_sample_t),
+    )
+
+    def __init__(self, devices, domains=None, capacity=16):
+        """
+        Parameters:
+          devices: sequence of zes_device_handle_t
+          domains: ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_* mask, all domains if None
+          capacity: samples kept per device and domain
+        """
+        if domains is None:
+            domains = 0
+            for _, flag, _ in self._domains:
+                domains |= flag
+        self.count = len(devices)
+        self.domains = domains
+        self.capacity = capacity
+        self.snapshots = (zel_sysman_device_snapshot_t * self.count)()
+        for name, flag, sample_type in self._domains:
+            size = self.count * capacity if domains & flag else 0
+            setattr(self, name, (sample_type * size)())
+        for i, device in enumerate(devices):
+            snapshot = self.snapshots[i]
+            snapshot.hDevice = device
+            snapshot.domains = domains
+            for name, flag, sample_type in self._domains:
+                if domains & flag:
+                    samples = getattr(self, name)
+                    setattr(
+                        snapshot,
+                        "p" + name.capitalize(),
+                        cast(
+                            addressof(samples) + i * capacity * sizeof(sample_type),
+                            POINTER(sample_type),
+                        ),
+                    )
+
+    def read(self):
+        """Refreshes every device and domain with one native call.
+
+        Returns:
+          ze_result_t - ZE_RESULT_SUCCESS, or the result of the first device
+          that could not be read; per-component results are in the samples
+        """
+        for snapshot in self.snapshots:
+            snapshot.powerCount = snapshot.frequencyCount = self.capacity
+            snapshot.temperatureCount = snapshot.engineCount = self.capacity
+            snapshot.memoryCount = self.capacity
+        return zelSysmanGetSnapshot(self.count, self.snapshots)
+
+    def samples(self, domain, device):
+        """Samples of one domain ("power", "frequency", "temperature",
+        "engine" or "memory") of the device at the given index, as read by
+        the last read()."""
+        count = getattr(self.snapshots[device], domain + "Count")
+        start = device * self.capacity
+        return getattr(self, domain)[start : start + min(count, self.capacity)]
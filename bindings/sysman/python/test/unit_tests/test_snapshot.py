@@ -0,0 +1,110 @@
+##
+# Copyright (C) 2026 Intel Corporation
+#
+# SPDX-License-Identifier: MIT
+#
+##
+
+import os
+import sys
+import unittest
+from ctypes import *
+from unittest.mock import MagicMock, patch
+
+# Add the source directory to Python path so we can import pyzes
+script_dir = os.path.dirname(os.path.abspath(__file__))
+source_dir = os.path.join(script_dir, "..", "..", "source")
+source_dir = os.path.abspath(source_dir)
+if source_dir not in sys.path:
+    sys.path.insert(0, source_dir)
+
+
+@patch("pyzes.getFunctionPointerList")
+class TestSnapshotFunctions(unittest.TestCase):
+    def setUp(self):
+        import pyzes
+
+        self.pyzes = pyzes
+
+    def test_GivenSnapshotArrayWhenCallingZelSysmanGetSnapshotThenCallIsForwardedOnce(
+        self, mock_get_func
+    ):
+        def mock_get_snapshot(count, snapshots):
+            for i in range(count):
+                snapshots[i].powerCount = 1
+                snapshots[i].pPower[0].energy.energy = 1000 * (i + 1)
+            return self.pyzes.ZE_RESULT_SUCCESS
+
+        mock_func = MagicMock(side_effect=mock_get_snapshot)
+        mock_get_func.return_value = mock_func
+
+        power = (self.pyzes.zel_sysman_power_sample_t * 2)()
+        snapshots = (self.pyzes.zel_sysman_device_snapshot_t * 2)()
+        for i in range(2):
+            snapshots[i].domains = self.pyzes.ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_POWER
+            snapshots[i].powerCount = 1
+            snapshots[i].pPower = pointer(power[i])
+
+        result = self.pyzes.zelSysmanGetSnapshot(2, snapshots)
+
+        self.assertEqual(result, self.pyzes.ZE_RESULT_SUCCESS)
+        self.assertEqual(power[0].energy.energy, 1000)
+        self.assertEqual(power[1].energy.energy, 2000)
+        mock_get_func.assert_called_with("zelSysmanGetSnapshot")
+        mock_func.assert_called_once()
+
+    def test_GivenSeveralDevicesWhenReadingSysmanSnapshotThenAllDevicesAreReadInOneCallIntoContiguousArrays(
+        self, mock_get_func
+    ):
+        def mock_get_snapshot(count, snapshots):
+            for i in range(count):
+                snapshot = snapshots[i]
+                self.assertEqual(snapshot.engineCount, 4)
+                self.assertEqual(snapshot.memoryCount, 4)
+                snapshot.engineCount = 2
+                for j in range(2):
+                    snapshot.pEngine[j].stats.activeTime = 10 * i + j
+                snapshot.memoryCount = 1
+                snapshot.pMemory[0].state.free = 100 + i
+            return self.pyzes.ZE_RESULT_SUCCESS
+
+        mock_func = MagicMock(side_effect=mock_get_snapshot)
+        mock_get_func.return_value = mock_func
+
+        devices = [self.pyzes.zes_device_handle_t(1), self.pyzes.zes_device_handle_t(2)]
+        snapshot = self.pyzes.SysmanSnapshot(
+            devices,
+            self.pyzes.ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_ENGINE
+            | self.pyzes.ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_MEMORY,
+            capacity=4,
+        )
+
+        self.assertEqual(snapshot.read(), self.pyzes.ZE_RESULT_SUCCESS)
+        mock_func.assert_called_once()
+        self.assertEqual(mock_func.call_args[0][0], 2)
+        self.assertEqual(snapshot.snapshots[1].hDevice.value, 2)
+
+        # Samples of device i start at i * capacity of one shared array.
+        self.assertEqual(len(snapshot.engine), 8)
+        self.assertEqual(snapshot.engine[5].stats.activeTime, 11)
+        self.assertEqual(
+            [s.stats.activeTime for s in snapshot.samples("engine", 1)], [10, 11]
+        )
+        self.assertEqual([s.state.free for s in snapshot.samples("memory", 0)], [100])
+
+        # Domains not requested get no storage.
+        self.assertEqual(len(snapshot.power), 0)
+        self.assertEqual(len(snapshot.samples("power", 0)), 0)
+
+        # The arrays are exposed through the buffer protocol.
+        view = memoryview(snapshot.engine)
+        self.assertEqual(view.shape, (8,))
+        self.assertEqual(view.itemsize, sizeof(self.pyzes.zel_sysman_engine_sample_t))
+
+        # Later reads reset the counts to the capacity and reuse the arrays.
+        self.assertEqual(snapshot.read(), self.pyzes.ZE_RESULT_SUCCESS)
+        self.assertEqual(mock_func.call_count, 2)
+
+
+if __name__ == "__main__":
+    unittest.main()
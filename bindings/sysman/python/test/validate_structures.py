@@ -8,7 +8,8 @@
 
 """
 Validates that Python ctypes structures in pyzes.py match the C structures
-defined in the Level-Zero headers (include/zes_api.h, include/ze_api.h).
+defined in the Level-Zero headers (include/zes_api.h, include/ze_api.h,
+include/loader/ze_loader.h).
 """
 
 import re
@@ -64,6 +65,8 @@ def parse_c_structure(
         line = re.sub(r"///.*$", "", line).strip()
         if not line or line.startswith("//"):
             continue
+        # Attach the pointer to the type: "T *name" -> "T* name"
+        line = re.sub(r"\s*\*\s*", "* ", line)
 
         match = re.match(field_pattern, line)
         if match:
@@ -241,10 +244,11 @@ def main():
     # Paths
     zes_header = repo_root / "include" / "zes_api.h"
     ze_header = repo_root / "include" / "ze_api.h"
+    loader_header = repo_root / "include" / "loader" / "ze_loader.h"
     pyzes_file = repo_root / "bindings" / "sysman" / "python" / "source" / "pyzes.py"
 
     # Check files exist
-    for file_path in [zes_header, ze_header, pyzes_file]:
+    for file_path in [zes_header, ze_header, loader_header, pyzes_file]:
         if not file_path.exists():
             print(f"❌ FAIL: Required file not found: {file_path}")
             return 1
@@ -252,6 +256,7 @@ def main():
     # Read files
     zes_content = zes_header.read_text()
     ze_content = ze_header.read_text()
+    loader_content = loader_header.read_text()
     pyzes_content = pyzes_file.read_text()
 
     # Dynamically discover all structures from pyzes.py
@@ -273,6 +278,9 @@ def main():
         if c_fields is None:
             # Try ze_api.h for core structures
             c_fields = parse_c_structure(ze_content, struct_name)
+        if c_fields is None:
+            # Loader extensions such as zelSysmanGetSnapshot
+            c_fields = parse_c_structure(loader_content, struct_name)
 
         if c_fields is None:
             structures_not_in_headers.append(struct_name)
@@ -13,6 +13,7 @@
 #endif
 
 #include "../ze_api.h"
+#include "../zes_api.h"
 
 #if defined(__cplusplus)
 extern "C" {
@@ -561,6 +562,303 @@ zelDisableTracingLayer();
 ZE_DLLEXPORT ze_result_t ZE_APICALL
 zelGetTracingLayerState(bool* enabled); // Pointer to bool to receive tracing layer state
 
+/**
+ * @brief Host-side latency statistics of one Level Zero API.
+ *
+ * Latencies are measured by the tracing layer around the call into the driver,
+ * in nanoseconds. Percentiles are the highest value of the histogram bucket
+ * holding that rank, so they overestimate by at most 1/16 of the value.
+ */
+typedef struct _zel_api_latency_stats_t {
+    const char *name;      ///< [out] API name, e.g. "zeCommandListAppendLaunchKernel"; valid while the loader is loaded
+    uint64_t callCount;    ///< [out] number of calls
+    uint64_t totalNs;      ///< [out] sum of all call latencies
+    uint64_t minNs;        ///< [out] lowest latency
+    uint64_t maxNs;        ///< [out] highest latency
+    uint64_t p50Ns;        ///< [out] median latency
+    uint64_t p90Ns;        ///< [out] 90th percentile latency
+    uint64_t p99Ns;        ///< [out] 99th percentile latency
+    uint64_t p999Ns;       ///< [out] 99.9th percentile latency
+} zel_api_latency_stats_t;
+
+/**
+ * @brief Retrieves per-API latency statistics collected by the tracing layer.
+ *
+ * The tracing layer collects call counts and latency histograms for every API it
+ * intercepts when the environment variable `ZEL_TRACING_LATENCY_STATS=1` is set
+ * and the tracing layer is enabled, either with `ZE_ENABLE_TRACING_LAYER=1` or with
+ * zelEnableTracingLayer(). Statistics are aggregated over all threads.
+ *
+ * Usage:
+ * - If `*pCount` is zero or `pStats` is `NULL`, the function writes the number of
+ *   APIs called since the last reset to `*pCount` and returns.
+ * - Otherwise the function writes the statistics of up to `*pCount` APIs to
+ *   `pStats` and sets `*pCount` to the number written. APIs first called after
+ *   the count was queried may be missing if the array is too small.
+ * - If `reset` is true, the statistics are cleared after they have been read,
+ *   so the next call returns the calls made in between.
+ *
+ * @param[in,out] pCount  Number of entries in `pStats`; receives the number of
+ *                        entries available or written.
+ * @param[out] pStats     Array of statistics, ordered by API, or `NULL`.
+ * @param[in] reset       Clear the statistics after reading them.
+ *
+ * @return
+ *     - ZE_RESULT_SUCCESS on success.
+ *     - ZE_RESULT_ERROR_INVALID_NULL_POINTER if `pCount` is null.
+ *     - ZE_RESULT_ERROR_UNSUPPORTED_FEATURE if the tracing layer is not loaded or
+ *       the statistics mode is not enabled.
+ *
+ * @note Thread-safe. Statistics of calls in flight on other threads may be
+ *       partially included.
+ */
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelGetApiLatencyStats(
+   uint32_t *pCount,                      // [in,out] Number of entries in pStats, or receives the number available
+   zel_api_latency_stats_t *pStats,       // [out][optional] Array of per-API statistics
+   ze_bool_t reset                        // [in] Clear the statistics after reading them
+);
+
+/**
+ * @brief Telemetry domains read by zelSysmanGetSnapshot().
+ */
+typedef uint32_t zel_sysman_snapshot_domain_flags_t;
+typedef enum _zel_sysman_snapshot_domain_flag_t {
+   ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_POWER = ZE_BIT(0),       ///< energy counter of every power domain
+   ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_FREQUENCY = ZE_BIT(1),   ///< state of every frequency domain
+   ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_TEMPERATURE = ZE_BIT(2), ///< reading of every temperature sensor
+   ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_ENGINE = ZE_BIT(3),      ///< activity counters of every engine group
+   ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_MEMORY = ZE_BIT(4),      ///< state of every memory module
+   ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_FORCE_UINT32 = 0x7fffffff
+} zel_sysman_snapshot_domain_flag_t;
+
+/**
+ * @brief Energy counter of one power domain.
+ */
+typedef struct _zel_sysman_power_sample_t {
+    ze_result_t result;                    ///< [out] result of reading the counter
+    ze_bool_t onSubdevice;                 ///< [out] the domain is on a sub-device
+    uint32_t subdeviceId;                  ///< [out] sub-device ID, if onSubdevice is true
+    zes_power_energy_counter_t energy;     ///< [out] energy counter
+} zel_sysman_power_sample_t;
+
+/**
+ * @brief State of one frequency domain.
+ */
+typedef struct _zel_sysman_frequency_sample_t {
+    ze_result_t result;                    ///< [out] result of reading the state
+    zes_freq_domain_t type;                ///< [out] frequency domain type
+    ze_bool_t onSubdevice;                 ///< [out] the domain is on a sub-device
+    uint32_t subdeviceId;                  ///< [out] sub-device ID, if onSubdevice is true
+    zes_freq_state_t state;                ///< [out] frequency state
+} zel_sysman_frequency_sample_t;
+
+/**
+ * @brief Reading of one temperature sensor.
+ */
+typedef struct _zel_sysman_temperature_sample_t {
+    ze_result_t result;                    ///< [out] result of reading the sensor
+    zes_temp_sensors_t type;               ///< [out] sensor type
+    ze_bool_t onSubdevice;                 ///< [out] the sensor is on a sub-device
+    uint32_t subdeviceId;                  ///< [out] sub-device ID, if onSubdevice is true
+    double temperature;                    ///< [out] temperature in degrees Celsius
+} zel_sysman_temperature_sample_t;
+
+/**
+ * @brief Activity counters of one engine group.
+ */
+typedef struct _zel_sysman_engine_sample_t {
+    ze_result_t result;                    ///< [out] result of reading the counters
+    zes_engine_group_t type;               ///< [out] engine group
+    ze_bool_t onSubdevice;                 ///< [out] the engine group is on a sub-device
+    uint32_t subdeviceId;                  ///< [out] sub-device ID, if onSubdevice is true
+    zes_engine_stats_t stats;              ///< [out] activity counters
+} zel_sysman_engine_sample_t;
+
+/**
+ * @brief State of one memory module.
+ */
+typedef struct _zel_sysman_memory_sample_t {
+    ze_result_t result;                    ///< [out] result of reading the state
+    zes_mem_type_t type;                   ///< [out] memory type
+    zes_mem_loc_t location;                ///< [out] memory location
+    ze_bool_t onSubdevice;                 ///< [out] the module is on a sub-device
+    uint32_t subdeviceId;                  ///< [out] sub-device ID, if onSubdevice is true
+    zes_mem_state_t state;                 ///< [out] memory state
+} zel_sysman_memory_sample_t;
+
+/**
+ * @brief Telemetry of one device, filled by zelSysmanGetSnapshot().
+ *
+ * For every domain, the count is the number of entries in the array on input
+ * and receives the number of components of that type on the device; up to the
+ * input count entries are written, in the order zesDeviceEnum* returns the
+ * components. Domains not requested get a count of zero.
+ */
+typedef struct _zel_sysman_device_snapshot_t {
+    zes_device_handle_t hDevice;                   ///< [in] Sysman handle of the device
+    zel_sysman_snapshot_domain_flags_t domains;    ///< [in] domains to read, zel_sysman_snapshot_domain_flag_t
+    ze_result_t result;                            ///< [out] ZE_RESULT_SUCCESS, or the first error enumerating components
+    uint32_t powerCount;                           ///< [in,out] entries in pPower; receives the number of power domains
+    zel_sysman_power_sample_t *pPower;             ///< [out][optional] power domain samples
+    uint32_t frequencyCount;                       ///< [in,out] entries in pFrequency; receives the number of frequency domains
+    zel_sysman_frequency_sample_t *pFrequency;     ///< [out][optional] frequency domain samples
+    uint32_t temperatureCount;                     ///< [in,out] entries in pTemperature; receives the number of sensors
+    zel_sysman_temperature_sample_t *pTemperature; ///< [out][optional] temperature sensor samples
+    uint32_t engineCount;                          ///< [in,out] entries in pEngine; receives the number of engine groups
+    zel_sysman_engine_sample_t *pEngine;           ///< [out][optional] engine group samples
+    uint32_t memoryCount;                          ///< [in,out] entries in pMemory; receives the number of memory modules
+    zel_sysman_memory_sample_t *pMemory;           ///< [out][optional] memory module samples
+} zel_sysman_device_snapshot_t;
+
+/**
+ * @brief Reads the telemetry of several devices in one call.
+ *
+ * Replaces the per-component zesPowerGetEnergyCounter, zesFrequencyGetState,
+ * zesTemperatureGetState, zesEngineGetActivity and zesMemoryGetState calls of a
+ * polling agent. The components of a device are enumerated on its first
+ * snapshot, together with their properties, and the lists are reused by later
+ * snapshots until the device is reset or reported attached, detached or
+ * needing a reset by zesDriverEventListen(), or zeInit(), zeInitDrivers() or
+ * zesInit() succeeds.
+ * Devices are read in parallel by the calling thread and up to 15 worker
+ * threads, which are kept between calls. The counters are read through the
+ * same dispatch as the zes APIs, so enabled layers see every read.
+ *
+ * Sysman must be initialized with zesInit() first.
+ *
+ * @param[in] count          Number of entries in `pSnapshots`.
+ * @param[in,out] pSnapshots Devices to read and the arrays to fill.
+ *
+ * @return
+ *     - ZE_RESULT_SUCCESS if every device was read; a component that could not
+ *       be read is reported in the `result` of its sample.
+ *     - ZE_RESULT_ERROR_INVALID_NULL_POINTER if `pSnapshots` is null and `count`
+ *       is not zero.
+ *     - ZE_RESULT_ERROR_UNINITIALIZED if sysman is not initialized.
+ *     - Otherwise the `result` of the first device that could not be read.
+ *
+ * @note Thread-safe. Concurrent snapshots of the same device are serialized.
+ */
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelSysmanGetSnapshot(
+   uint32_t count,                               // [in] Number of entries in pSnapshots
+   zel_sysman_device_snapshot_t *pSnapshots      // [in,out] Devices to read and the arrays to fill
+);
+
+/**
+ * @brief Handle of a sysman sampler created by zelSysmanSamplerCreate().
+ */
+typedef struct _zel_sysman_sampler_handle_t *zel_sysman_sampler_handle_t;
+
+/**
+ * @brief Components a sysman sampler reads and how often.
+ */
+typedef struct _zel_sysman_sampler_desc_t {
+    uint32_t periodUs;                     ///< [in] sampling period in microseconds; 0 selects 1000 (1 kHz)
+    uint32_t historyLength;                ///< [in] samples kept per component; 0 selects 4096
+    uint32_t powerCount;                   ///< [in] number of entries in phPower
+    const zes_pwr_handle_t *phPower;       ///< [in][optional][range(0, powerCount)] power domains whose energy counters are sampled
+    uint32_t engineCount;                  ///< [in] number of entries in phEngine
+    const zes_engine_handle_t *phEngine;   ///< [in][optional][range(0, engineCount)] engine groups whose activity counters are sampled
+} zel_sysman_sampler_desc_t;
+
+/**
+ * @brief Rate of one sampled component over a window.
+ */
+typedef struct _zel_sysman_sampler_rate_t {
+    ze_result_t result;                    ///< [out] ZE_RESULT_SUCCESS; ZE_RESULT_NOT_READY if the window holds
+                                           ///< fewer than two samples; or the error of the component's last read
+    uint32_t sampleCount;                  ///< [out] number of samples in the window
+    uint64_t startNs;                      ///< [out] monotonic time of the oldest sample used, in nanoseconds
+    uint64_t endNs;                        ///< [out] monotonic time of the newest sample used, in nanoseconds
+    double value;                          ///< [out] average power in watts, or engine utilization in percent
+} zel_sysman_sampler_rate_t;
+
+/**
+ * @brief Starts sampling sysman counters on a dedicated thread.
+ *
+ * Reads the energy counter of every power domain and the activity counters of
+ * every engine group in the descriptor once per period, and keeps the last
+ * historyLength samples of each component, stamped with a monotonic clock.
+ * zelSysmanSamplerGetPowerRates() and zelSysmanSamplerGetEngineRates() derive
+ * rates from the history without waiting for the sampling thread. The
+ * counters are read through the same dispatch as the zes APIs.
+ *
+ * Sysman must be initialized with zesInit() first. Samplers not destroyed
+ * before the process exits or the loader is unloaded are stopped and joined
+ * before the drivers and the loader release their state.
+ *
+ * @note Not available in the Windows DLL build: the unload runs under the
+ *       OS loader lock, where joining the sampling thread would deadlock.
+ *       Destroying samplers before unloading does not lift the restriction.
+ *
+ * @param[in] desc        Components to sample and the sampling period.
+ * @param[out] phSampler  Receives the sampler.
+ *
+ * @return
+ *     - ZE_RESULT_SUCCESS if the sampler is running.
+ *     - ZE_RESULT_ERROR_INVALID_NULL_POINTER if `desc` or `phSampler` is null,
+ *       or an array in `desc` is null while its count is not zero.
+ *     - ZE_RESULT_ERROR_INVALID_SIZE if `desc` names no components.
+ *     - ZE_RESULT_ERROR_UNINITIALIZED if sysman is not initialized.
+ *     - ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY if the sampling thread cannot be
+ *       started.
+ *     - ZE_RESULT_ERROR_UNSUPPORTED_FEATURE in the Windows DLL build.
+ */
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelSysmanSamplerCreate(
+   const zel_sysman_sampler_desc_t *desc,        // [in] Components to sample and the sampling period
+   zel_sysman_sampler_handle_t *phSampler        // [out] Receives the sampler
+);
+
+/**
+ * @brief Stops a sampler and frees its history.
+ *
+ * @note The sampler must not be used by other threads while it is destroyed.
+ */
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelSysmanSamplerDestroy(
+   zel_sysman_sampler_handle_t hSampler          // [in][release] Sampler to stop
+);
+
+/**
+ * @brief Average power of the sampled power domains over the last `windowNs`.
+ *
+ * Entry i describes the i-th power domain of the sampler's descriptor.
+ *
+ * @return
+ *     - ZE_RESULT_SUCCESS; the rate of each domain is in its `result`.
+ *     - ZE_RESULT_ERROR_INVALID_NULL_HANDLE if `hSampler` is null.
+ *     - ZE_RESULT_ERROR_INVALID_NULL_POINTER if `pRates` is null and `count` is
+ *       not zero.
+ *     - ZE_RESULT_ERROR_INVALID_SIZE if `count` exceeds the number of sampled
+ *       power domains.
+ *
+ * @note Thread-safe; does not block the sampling thread.
+ */
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelSysmanSamplerGetPowerRates(
+   zel_sysman_sampler_handle_t hSampler,         // [in] Sampler
+   uint64_t windowNs,                            // [in] Length of the window ending now, in nanoseconds
+   uint32_t count,                               // [in] Number of entries in pRates
+   zel_sysman_sampler_rate_t *pRates             // [out][range(0, count)] Power in watts of each domain
+);
+
+/**
+ * @brief Utilization of the sampled engine groups over the last `windowNs`.
+ *
+ * Entry i describes the i-th engine group of the sampler's descriptor; the
+ * return values are those of zelSysmanSamplerGetPowerRates().
+ */
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelSysmanSamplerGetEngineRates(
+   zel_sysman_sampler_handle_t hSampler,         // [in] Sampler
+   uint64_t windowNs,                            // [in] Length of the window ending now, in nanoseconds
+   uint32_t count,                               // [in] Number of entries in pRates
+   zel_sysman_sampler_rate_t *pRates             // [out][range(0, count)] Utilization in percent of each engine group
+);
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif
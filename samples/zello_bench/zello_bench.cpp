@@ -0,0 +1,250 @@
+/*
+ *
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#include <stdlib.h>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "zello_init.h"
+
+#if defined(_WIN32)
+    #define putenv_safe _putenv
+#else
+    #define putenv_safe putenv
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+/// returns the value following shortName/longName, or defaultValue
+inline uint32_t argvalue( int argc, char *argv[],
+    const char *shortName, const char *longName, uint32_t defaultValue )
+{
+    for( int i = 1; i + 1 < argc; ++i )
+        if( ( 0 == strcmp( argv[ i ], shortName ) ) || ( 0 == strcmp( argv[ i ], longName ) ) )
+            return static_cast<uint32_t>( strtoul( argv[ i + 1 ], nullptr, 10 ) );
+
+    return defaultValue;
+}
+
+//////////////////////////////////////////////////////////////////////////
+struct bench_env_t
+{
+    ze_driver_handle_t driver = nullptr;
+    ze_device_handle_t device = nullptr;
+    ze_context_handle_t context = nullptr;
+};
+
+//////////////////////////////////////////////////////////////////////////
+inline bool bench_init( bench_env_t &env )
+{
+    uint32_t driverCount = 0;
+    ze_init_driver_type_desc_t driverTypeDesc = {};
+    driverTypeDesc.stype = ZE_STRUCTURE_TYPE_INIT_DRIVER_TYPE_DESC;
+    driverTypeDesc.flags = ZE_INIT_DRIVER_TYPE_FLAG_GPU;
+
+    if( !init_ze( false, driverCount, driverTypeDesc ) || 0 == driverCount )
+        return false;
+
+    std::vector<ze_driver_handle_t> drivers( driverCount );
+    if( ZE_RESULT_SUCCESS != zeInitDrivers( &driverCount, drivers.data(), &driverTypeDesc ) )
+        return false;
+    env.driver = drivers[ 0 ];
+
+    uint32_t deviceCount = 1;
+    if( ZE_RESULT_SUCCESS != zeDeviceGet( env.driver, &deviceCount, &env.device ) )
+        return false;
+
+    ze_context_desc_t context_desc = {};
+    context_desc.stype = ZE_STRUCTURE_TYPE_CONTEXT_DESC;
+    return ZE_RESULT_SUCCESS == zeContextCreate( env.driver, &context_desc, &env.context );
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// measures the host cost of zeCommandListAppendBarrier with a wait list
+/// of waitCount events, which exercises the loader's wait-list translation
+int bench_append( bench_env_t &env, uint32_t iterations, uint32_t waitCount )
+{
+    ze_command_queue_desc_t queue_desc = {};
+    queue_desc.stype = ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC;
+    ze_command_list_handle_t command_list = nullptr;
+    if( ZE_RESULT_SUCCESS != zeCommandListCreateImmediate( env.context, env.device, &queue_desc, &command_list ) )
+        return 1;
+
+    ze_event_pool_desc_t ep_desc = {};
+    ep_desc.stype = ZE_STRUCTURE_TYPE_EVENT_POOL_DESC;
+    ep_desc.count = waitCount + 1;
+    ze_event_pool_handle_t event_pool = nullptr;
+    if( ZE_RESULT_SUCCESS != zeEventPoolCreate( env.context, &ep_desc, 1, &env.device, &event_pool ) )
+        return 1;
+
+    std::vector<ze_event_handle_t> events( waitCount + 1 );
+    for( uint32_t i = 0; i < waitCount + 1; ++i )
+    {
+        ze_event_desc_t ev_desc = {};
+        ev_desc.stype = ZE_STRUCTURE_TYPE_EVENT_DESC;
+        ev_desc.index = i;
+        if( ZE_RESULT_SUCCESS != zeEventCreate( event_pool, &ev_desc, &events[ i ] ) )
+            return 1;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for( uint32_t i = 0; i < iterations; ++i )
+        zeCommandListAppendBarrier( command_list, events[ waitCount ], waitCount,
+            waitCount ? events.data() : nullptr );
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start ).count();
+
+    std::cout << "zeCommandListAppendBarrier waits=" << waitCount
+              << " iterations=" << iterations
+              << " ns/call=" << static_cast<double>( elapsed ) / iterations << std::endl;
+
+    for( auto event : events )
+        zeEventDestroy( event );
+    zeEventPoolDestroy( event_pool );
+    zeCommandListDestroy( command_list );
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// measures the per-call cost of the API entry points' dispatch with
+/// zeDriverGetApiVersion, which does no other work in the loader or the
+/// null driver: before dynamic tracing is ever enabled, while it is
+/// enabled (calls go through the tracing layer) and after it is disabled
+int bench_dispatch( bench_env_t &env, uint32_t iterations )
+{
+    auto measure = [&]( const char *phase )
+    {
+        ze_api_version_t version = {};
+        auto start = std::chrono::steady_clock::now();
+        for( uint32_t i = 0; i < iterations; ++i )
+            zeDriverGetApiVersion( env.driver, &version );
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start ).count();
+        std::cout << "zeDriverGetApiVersion dynamic tracing=" << phase
+                  << " iterations=" << iterations
+                  << " ns/call=" << static_cast<double>( elapsed ) / iterations << std::endl;
+    };
+
+    measure( "never_enabled" );
+    if( ZE_RESULT_SUCCESS != zelEnableTracingLayer() )
+    {
+        std::cout << "zelEnableTracingLayer not supported, skipping dynamic tracing phases" << std::endl;
+        return 0;
+    }
+    measure( "enabled" );
+    if( ZE_RESULT_SUCCESS != zelDisableTracingLayer() )
+        return 1;
+    measure( "disabled" );
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// measures loader handle factory contention: every thread repeatedly
+/// creates and destroys an event (factory insert and release) and wraps the
+/// device handle again (factory lookup of an existing key)
+int bench_factory( bench_env_t &env, uint32_t opsPerThread, uint32_t maxThreads )
+{
+    ze_event_pool_desc_t ep_desc = {};
+    ep_desc.stype = ZE_STRUCTURE_TYPE_EVENT_POOL_DESC;
+    ep_desc.count = 1;
+    ze_event_pool_handle_t event_pool = nullptr;
+    if( ZE_RESULT_SUCCESS != zeEventPoolCreate( env.context, &ep_desc, 1, &env.device, &event_pool ) )
+        return 1;
+
+    for( uint32_t threadCount = 1; threadCount <= maxThreads; threadCount *= 2 )
+    {
+        std::atomic<bool> go{ false };
+        std::atomic<uint32_t> failures{ 0 };
+        std::vector<std::thread> threads;
+        for( uint32_t t = 0; t < threadCount; ++t )
+        {
+            threads.emplace_back( [&]()
+            {
+                ze_event_desc_t ev_desc = {};
+                ev_desc.stype = ZE_STRUCTURE_TYPE_EVENT_DESC;
+                while( !go.load( std::memory_order_acquire ) )
+                    std::this_thread::yield();
+                for( uint32_t i = 0; i < opsPerThread; ++i )
+                {
+                    ze_event_handle_t event = nullptr;
+                    uint32_t deviceCount = 1;
+                    ze_device_handle_t device = nullptr;
+                    if( ZE_RESULT_SUCCESS != zeEventCreate( event_pool, &ev_desc, &event ) ||
+                        ZE_RESULT_SUCCESS != zeDeviceGet( env.driver, &deviceCount, &device ) ||
+                        ZE_RESULT_SUCCESS != zeEventDestroy( event ) )
+                        ++failures;
+                }
+            } );
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        go.store( true, std::memory_order_release );
+        for( auto &thread : threads )
+            thread.join();
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start ).count();
+
+        const double ops = static_cast<double>( opsPerThread ) * threadCount;
+        std::cout << "handle factory threads=" << threadCount
+                  << " ops/thread=" << opsPerThread
+                  << " ns/op=" << static_cast<double>( elapsed ) / ops
+                  << " Mops/s=" << ops * 1e3 / static_cast<double>( elapsed ) << std::endl;
+        if( failures )
+        {
+            std::cout << "handle factory failures=" << failures << std::endl;
+            zeEventPoolDestroy( event_pool );
+            return 1;
+        }
+    }
+
+    zeEventPoolDestroy( event_pool );
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char *argv[] )
+{
+    if( argparse( argc, argv, "-h", "--help" ) )
+    {
+        std::cout << "usage: zello_bench [-iters N] [-waits N] [-threads N] [-ops N]\n"
+                  << "  runs against the null driver with loader intercepts on unless ZE_ENABLE_LOADER_INTERCEPT is set\n"
+                  << "  -threads N  also sweep handle factory contention over 1, 2, 4, ... N threads\n"
+                  << "  -ops N      event create/lookup/destroy operations per thread (default 20000)\n";
+        return 0;
+    }
+
+    putenv_safe( const_cast<char *>( "ZE_ENABLE_NULL_DRIVER=1" ) );
+    // Set ZE_ENABLE_LOADER_INTERCEPT=0 to measure the entry point dispatch
+    // straight into the driver.
+    if( nullptr == getenv( "ZE_ENABLE_LOADER_INTERCEPT" ) )
+        putenv_safe( const_cast<char *>( "ZE_ENABLE_LOADER_INTERCEPT=1" ) );
+    putenv_safe( const_cast<char *>( "ZEL_TEST_NULL_DRIVER_DISABLE_DDI_EXT=1" ) );
+    putenv_safe( const_cast<char *>( "ZEL_TEST_NULL_DRIVER_DISABLE_CALL_TRACKING=1" ) );
+
+    uint32_t iterations = argvalue( argc, argv, "-iters", "--iterations", 200000 );
+    uint32_t waitCount = argvalue( argc, argv, "-waits", "--wait_events", 4 );
+    uint32_t maxThreads = argvalue( argc, argv, "-threads", "--threads", 0 );
+    uint32_t opsPerThread = argvalue( argc, argv, "-ops", "--ops_per_thread", 20000 );
+
+    bench_env_t env;
+    if( !bench_init( env ) )
+    {
+        std::cout << "Failed to initialize the null driver" << std::endl;
+        return 1;
+    }
+
+    int status = bench_append( env, iterations, waitCount );
+    if( 0 == status )
+        status = bench_dispatch( env, iterations );
+    if( 0 == status && maxThreads > 0 )
+        status = bench_factory( env, opsPerThread, maxThreads );
+
+    zeContextDestroy( env.context );
+    return status;
+}
@@ -21,7 +21,7 @@ namespace validation_layer
             ${name}_checker.zeValidation = zeChecker;
             ${name}_checker.zetValidation = zetChecker;
             ${name}_checker.zesValidation = zesChecker;
-            validation_layer::context.validationHandlers.push_back(&${name}_checker);
+            validation_layer::context.registerChecker(zeChecker, zesChecker, zetChecker);
         }
     }
 
@@ -67,6 +67,10 @@ namespace loader
     failure_return = None
     if ret_type != 'ze_result_t':
         failure_return = th.get_first_failure_return(obj)
+    func_name = th.make_func_name(n, tags, obj)
+    cache_enum = namespace == "zes" and re.match(r"zesDeviceEnum\w+$", func_name) and not re.match(r"\w+VFExp$", func_name)
+    cache_reset = namespace == "zes" and re.match(r"zesDeviceReset(Ext)?$", func_name)
+    cache_events = namespace == "zes" and re.match(r"zesDriverEventListen(Ex)?$", func_name)
     %>///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for ${th.make_func_name(n, tags, obj)}
     %if 'condition' in obj:
@@ -86,14 +90,15 @@ namespace loader
         %endif
         <%
         add_local = False
-        arrays_to_delete = []
     %>
         %if namespace != "zer":
         %if re.match(r"Init", obj['name']) and not re.match(r"\w+InitDrivers$", th.make_func_name(n, tags, obj)):
         bool atLeastOneDriverValid = false;
         %if namespace != "zes":
+        loader::context->init_drivers( loader::context->zeDrivers, flags, nullptr, false );
         for( auto& drv : loader::context->zeDrivers )
         %else:
+        loader::context->init_drivers( *loader::context->sysmanInstanceDrivers, flags, nullptr, true );
         for( auto& drv : *loader::context->sysmanInstanceDrivers )
         %endif
         {
@@ -104,16 +109,18 @@ namespace loader
             if(drv.initStatus != ZE_RESULT_SUCCESS)
                 continue;
             %endif
-            if (!drv.handle || !drv.ddiInitialized) {
+            if (!drv.handle || !drv.ddiInitialized || drv.initResultPending) {
                 auto res = loader::context->init_driver( drv, flags, nullptr );
                 %if re.match(r"Init", obj['name']) and namespace == "zes":
                 if (res != ZE_RESULT_SUCCESS || drv.zesddiInitResult != ZE_RESULT_SUCCESS) {
                     drv.ddiInitialized = false;
+                    drv.initResultPending = false;
                     continue;
                 }
                 %else:
                 if (res != ZE_RESULT_SUCCESS || drv.zeddiInitResult != ZE_RESULT_SUCCESS) {
                     drv.ddiInitialized = false;
+                    drv.initResultPending = false;
                     continue;
                 }
                 %endif
@@ -143,21 +150,34 @@ namespace loader
             %endif
         }
 
+        loader::context->invalidateDriverHandleSnapshots();
+
         if(!atLeastOneDriverValid)
             result=ZE_RESULT_ERROR_UNINITIALIZED;
 
         %elif re.match(r"\w+DriverGet$", th.make_func_name(n, tags, obj)) or re.match(r"\w+InitDrivers$", th.make_func_name(n, tags, obj)):
+        %if not re.match(r"\w+InitDrivers$", th.make_func_name(n, tags, obj)):
+        // Once a complete, sorted list has been returned it is served from an
+        // immutable snapshot without the sort lock or any driver calls.
+        if( loader::context->${n}DriverHandles.get( ${obj['params'][0]['name']}, ${obj['params'][1]['name']} ) )
+            return ${X}_RESULT_SUCCESS;
+        const uint64_t snapshotGeneration = loader::context->${n}DriverHandles.generation();
+        bool snapshotComplete = ( nullptr != ${obj['params'][1]['name']} );
+        %endif
         uint32_t total_driver_handle_count = 0;
         %if re.match(r"\w+InitDrivers$", th.make_func_name(n, tags, obj)):
+        loader::context->init_drivers( loader::context->zeDrivers, 0, desc, false );
         for( auto& drv : loader::context->zeDrivers ) {
-            if (!drv.handle || !drv.ddiInitialized) {
+            if (!drv.handle || !drv.ddiInitialized || drv.initResultPending) {
                 auto res = loader::context->init_driver( drv, 0, desc);
                 if (res != ZE_RESULT_SUCCESS || drv.zeddiInitResult != ZE_RESULT_SUCCESS) {
                     drv.ddiInitialized = false;
+                    drv.initResultPending = false;
                     continue;
                 }
             }
         }
+        loader::context->invalidateDriverHandleSnapshots();
         %endif
 
         {
@@ -208,8 +228,12 @@ namespace loader
             }
             %endif
 
-            if( ( 0 < *${obj['params'][0]['name']} ) && ( *${obj['params'][0]['name']} == total_driver_handle_count))
+            if( ( 0 < *${obj['params'][0]['name']} ) && ( *${obj['params'][0]['name']} == total_driver_handle_count)) {
+                %if not re.match(r"\w+InitDrivers$", th.make_func_name(n, tags, obj)):
+                snapshotComplete = false;
+                %endif
                 break;
+            }
 
             uint32_t library_driver_handle_count = 0;
 
@@ -227,6 +251,9 @@ namespace loader
                     drv.initStatus = result;
                     %endif
                 }
+                %if not re.match(r"\w+InitDrivers$", th.make_func_name(n, tags, obj)):
+                snapshotComplete = false;
+                %endif
                 continue;
             }
 
@@ -234,6 +261,9 @@ namespace loader
             {
                 if( total_driver_handle_count + library_driver_handle_count > *${obj['params'][0]['name']}) {
                     library_driver_handle_count = *${obj['params'][0]['name']} - total_driver_handle_count;
+                    %if not re.match(r"\w+InitDrivers$", th.make_func_name(n, tags, obj)):
+                    snapshotComplete = false;
+                    %endif
                 }
                 %if re.match(r"\w+InitDrivers$", th.make_func_name(n, tags, obj)):
                 result = drv.dditable.${n}.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)}( &library_driver_handle_count, &${obj['params'][1]['name']}[ total_driver_handle_count ], desc );
@@ -322,12 +352,19 @@ namespace loader
                 catch( std::bad_alloc& )
                 {
                     result = ${X}_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+                    %if not re.match(r"\w+InitDrivers$", th.make_func_name(n, tags, obj)):
+                    snapshotComplete = false;
+                    %endif
                 }
             }
 
             total_driver_handle_count += library_driver_handle_count;
         }
 
+        %if not re.match(r"\w+InitDrivers$", th.make_func_name(n, tags, obj)):
+        snapshotComplete = snapshotComplete && ${X}_RESULT_SUCCESS == result && total_driver_handle_count > 0;
+        %endif
+
         // If the last driver get failed, but at least one driver succeeded, then return success with total count.
         if( ${X}_RESULT_SUCCESS == result || total_driver_handle_count > 0)
             *${obj['params'][0]['name']} = total_driver_handle_count;
@@ -340,8 +377,24 @@ namespace loader
         else
             loader::context->defaultZerDriverHandle = nullptr;
 
+        %endif
+        %if not re.match(r"\w+InitDrivers$", th.make_func_name(n, tags, obj)):
+        if( snapshotComplete )
+            loader::context->${n}DriverHandles.publish( ${obj['params'][1]['name']}, total_driver_handle_count, snapshotGeneration );
+
         %endif
         %else:
+        %if cache_enum:
+        // answer repeated enumerations from the component handle cache
+        auto hDeviceLoader = ${obj['params'][0]['name']};
+        const auto cacheGeneration = context->zesComponentHandles.generation();
+        if( nullptr != ${obj['params'][1]['name']} && context->zesComponentHandles.get( hDeviceLoader, &context->${th.get_loader_epilogue(n, tags, obj, meta)[0]['factory']}, ${obj['params'][1]['name']}, ${obj['params'][2]['name']} ) )
+            return ${X}_RESULT_SUCCESS;
+
+        %elif cache_reset:
+        auto hDeviceLoader = ${obj['params'][0]['name']};
+
+        %endif
         %for i, item in enumerate(th.get_loader_prologue(n, tags, obj, meta)):
         %if 0 == i:
         // extract driver's function pointer table
@@ -362,10 +415,9 @@ namespace loader
         %if 'range' in item:
         <%
         add_local = True%>// convert loader handles to driver handles
-        auto ${item['name']}Local = new ${item['type']} [${item['range'][1]}];
-        <%
-        arrays_to_delete.append(item['name']+ 'Local')
-        %>for( size_t i = ${item['range'][0]}; ( nullptr != ${item['name']} ) && ( i < ${item['range'][1]} ); ++i )
+        loader::local_handle_array_t<${item['type']}> ${item['name']}Storage( ${item['range'][1]} );
+        auto ${item['name']}Local = ${item['name']}Storage.data();
+        for( size_t i = ${item['range'][0]}; ( nullptr != ${item['name']} ) && ( i < ${item['range'][1]} ); ++i )
             ${item['name']}Local[ i ] = reinterpret_cast<${item['obj']}*>( ${item['name']}[ i ] )->handle;
         %else:
         %if item['optional']:
@@ -414,20 +466,17 @@ namespace loader
         ## To be removed once the headers have been updated in a new spec release.
         %if re.match(r"\w+CommandListAppendMetricQueryEnd$", th.make_func_name(n, tags, obj)):
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendMetricQueryEnd( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
         %else:
         // forward to device-driver
         %if add_local:
         result = ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name", "local"]))} );
-        %for array_name in arrays_to_delete:
-        delete []${array_name};
-        %endfor
         %else:
         %if re.match(r"\w+KernelSetArgumentValue$", th.make_func_name(n, tags, obj)):
         result = pfnSetArgumentValue( hKernel, argIndex, argSize, const_cast<const void *>(internalArgValue) );
@@ -437,7 +486,6 @@ namespace loader
         %endif
         %endif
 <%
-        del arrays_to_delete
         del add_local%>
         %for i, item in enumerate(th.get_loader_epilogue(n, tags, obj, meta)):
         %if 0 == i:
@@ -501,6 +549,24 @@ namespace loader
         %endif
         %endif
         %endfor
+        %if cache_enum:
+        if( ${X}_RESULT_SUCCESS == result && nullptr != ${obj['params'][2]['name']} )
+            context->zesComponentHandles.publish( hDeviceLoader, &context->${th.get_loader_epilogue(n, tags, obj, meta)[0]['factory']}, cacheGeneration,
+                ${th.make_pfn_name(n, tags, obj)}, ${obj['params'][0]['name']}, ${obj['params'][2]['name']}, *${obj['params'][1]['name']} );
+
+        %elif cache_reset:
+        // the components of the device may change across a reset, even a
+        // failed one
+        context->zesComponentHandles.invalidate( hDeviceLoader );
+
+        %elif cache_events:
+        // components of devices that were attached, detached or need a reset
+        // are enumerated from the driver again
+        for( size_t i = 0; ( ${X}_RESULT_SUCCESS == result ) && ( nullptr != pEvents ) && ( nullptr != phDevices ) && ( i < count ); ++i )
+            if( pEvents[ i ] & ( ZES_EVENT_TYPE_FLAG_DEVICE_DETACH | ZES_EVENT_TYPE_FLAG_DEVICE_ATTACH | ZES_EVENT_TYPE_FLAG_DEVICE_RESET_REQUIRED ) )
+                context->zesComponentHandles.invalidate( phDevices[ i ] );
+
+        %endif
         %endif
         %else: ## for zer API's
         %if re.match(r"\w+GetLastErrorDescription", th.make_func_name(n, tags, obj)):
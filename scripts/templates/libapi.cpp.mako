@@ -41,6 +41,9 @@ extern "C" {
     failure_return = None
     if ret_type != 'ze_result_t':
         failure_return = th.get_first_failure_return(obj)
+    func_name = th.make_func_name(n, tags, obj)
+    snapshot_reset = n == 'zes' and re.match(r"zesDeviceReset(Ext)?$", func_name)
+    snapshot_events = n == 'zes' and re.match(r"zesDriverEventListen(Ex)?$", func_name)
 %>///////////////////////////////////////////////////////////////////////////////
 %if 'condition' in obj:
 #if ${th.subt(n, tags, obj['condition'])}
@@ -82,7 +85,7 @@ ${th.make_func_name(n, tags, obj)}(
         return ${X}_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto ${th.make_pfn_name(n, tags, obj)} = ${x}_lib::context->${n}DdiTable.load()->${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
+    auto ${th.make_pfn_name(n, tags, obj)} = ${x}_lib::${n}DdiTable.load(std::memory_order_acquire)->${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
     if( nullptr == ${th.make_pfn_name(n, tags, obj)} ) {
         if(!ze_lib::context->isInitialized)
             return ${X}_RESULT_ERROR_UNINITIALIZED;
@@ -90,7 +93,13 @@ ${th.make_func_name(n, tags, obj)}(
             return ${X}_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+    ${x}_result_t initResult = ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+    if (initResult == ${X}_RESULT_SUCCESS) {
+        // Like the loader's component handle caches, sysman snapshots
+        // enumerate every device's components again.
+        ze_lib::context->sysmanSnapshot.clear();
+    }
+    return initResult;
 }
 %else:
 %if re.match("InitDrivers", obj['name']):
@@ -113,11 +122,11 @@ ${th.make_func_name(n, tags, obj)}(
         return ${X}_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (${x}_lib::context->${n}DdiTable.load() == nullptr) {
+    if (${x}_lib::${n}DdiTable.load(std::memory_order_acquire) == nullptr) {
         return ${X}_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto ${th.make_pfn_name(n, tags, obj)} = ${x}_lib::context->${n}DdiTable.load()->${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
+    auto ${th.make_pfn_name(n, tags, obj)} = ${x}_lib::${n}DdiTable.load(std::memory_order_acquire)->${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
     if( nullptr == ${th.make_pfn_name(n, tags, obj)} ) {
         if(!ze_lib::context->isInitialized)
             return ${X}_RESULT_ERROR_UNINITIALIZED;
@@ -131,6 +140,9 @@ ${th.make_func_name(n, tags, obj)}(
         if (phDrivers) {
             ze_lib::context->${n}Inuse = true;
         }
+        // Like the loader's component handle caches, sysman snapshots
+        // enumerate every device's components again.
+        ze_lib::context->sysmanSnapshot.clear();
     }
 
     return result;
@@ -151,7 +163,7 @@ ${th.make_func_name(n, tags, obj)}(
             return ${X}_RESULT_ERROR_UNINITIALIZED;
         }
 
-        auto ${th.make_pfn_name(n, tags, obj)} = ${x}_lib::context->${n}DdiTable.load()->${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
+        auto ${th.make_pfn_name(n, tags, obj)} = ${x}_lib::${n}DdiTable.load(std::memory_order_acquire)->${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
         if( nullptr == ${th.make_pfn_name(n, tags, obj)} ) {
             if(!ze_lib::context->isInitialized)
                 return ${X}_RESULT_ERROR_UNINITIALIZED;
@@ -160,6 +172,13 @@ ${th.make_func_name(n, tags, obj)}(
         }
 
         result = ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+        %if n == 'ze':
+        if (result == ${X}_RESULT_SUCCESS) {
+            // Like the loader's component handle caches, sysman snapshots
+            // enumerate every device's components again.
+            ze_lib::context->sysmanSnapshot.clear();
+        }
+        %endif
         return result;
     });
 
@@ -187,7 +206,7 @@ ${th.make_func_name(n, tags, obj)}(
         %endif
     }
 %if re.match(r"\w+DriverGet$", th.make_func_name(n, tags, obj)):
-    if (!${x}_lib::context || ${x}_lib::context->${n}DdiTable == nullptr) {
+    if (${x}_lib::${n}DdiTable.load(std::memory_order_acquire) == nullptr) {
         return ${X}_RESULT_ERROR_UNINITIALIZED;
     }
 %endif
@@ -200,7 +219,7 @@ ${th.make_func_name(n, tags, obj)}(
     %endif
     %if ret_type == 'ze_result_t':
     static const ${th.make_pfn_type(n, tags, obj)} ${th.make_pfn_name(n, tags, obj)} = [&result] {
-        auto ${th.make_pfn_name(n, tags, obj)} = ${x}_lib::context->${n}DdiTable.load()->${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
+        auto ${th.make_pfn_name(n, tags, obj)} = ${x}_lib::${n}DdiTable.load(std::memory_order_acquire)->${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
         if( nullptr == ${th.make_pfn_name(n, tags, obj)} ) {
             result = ${X}_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -211,7 +230,7 @@ ${th.make_func_name(n, tags, obj)}(
     }
     %else:
     static const ${th.make_pfn_type(n, tags, obj)} ${th.make_pfn_name(n, tags, obj)} = [] {
-        auto ${th.make_pfn_name(n, tags, obj)} = ${x}_lib::context->${n}DdiTable.load()->${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
+        auto ${th.make_pfn_name(n, tags, obj)} = ${x}_lib::${n}DdiTable.load(std::memory_order_acquire)->${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
         return ${th.make_pfn_name(n, tags, obj)};
     }();
     if (nullptr == ${th.make_pfn_name(n, tags, obj)}) {
@@ -221,7 +240,27 @@ ${th.make_func_name(n, tags, obj)}(
         return ${failure_return};
     }    
     %endif
+    %if snapshot_reset or snapshot_events:
+    result = ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+    %if snapshot_reset:
+    // The components of the device may change across a reset, even a failed
+    // one; its next snapshot enumerates them again.
+    ze_lib::context->sysmanSnapshot.invalidate(hDevice);
+    %else:
+    // Devices attached, detached or needing a reset have their components
+    // enumerated again by their next snapshot.
+    if (${X}_RESULT_SUCCESS == result && nullptr != phDevices && nullptr != pEvents) {
+        for (uint32_t i = 0; i < count; ++i) {
+            if (pEvents[i] & (ZES_EVENT_TYPE_FLAG_DEVICE_DETACH | ZES_EVENT_TYPE_FLAG_DEVICE_ATTACH | ZES_EVENT_TYPE_FLAG_DEVICE_RESET_REQUIRED)) {
+                ze_lib::context->sysmanSnapshot.invalidate(phDevices[i]);
+            }
+        }
+    }
+    %endif
+    return result;
+    %else:
     return ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+    %endif
     #else
     if(ze_lib::destruction) {
         %if ret_type == 'ze_result_t':
@@ -235,7 +274,7 @@ ${th.make_func_name(n, tags, obj)}(
     }
 
 %if re.match(r"\w+DriverGet$", th.make_func_name(n, tags, obj)):
-    if (${x}_lib::context->${n}DdiTable == nullptr) {
+    if (${x}_lib::${n}DdiTable.load(std::memory_order_acquire) == nullptr) {
         return ${X}_RESULT_ERROR_UNINITIALIZED;
     }
 
@@ -247,7 +286,7 @@ ${th.make_func_name(n, tags, obj)}(
         return ZE_RESULT_SUCCESS;
     }
     %endif
-    auto ${th.make_pfn_name(n, tags, obj)} = ${x}_lib::context->${n}DdiTable.load()->${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
+    auto ${th.make_pfn_name(n, tags, obj)} = ${x}_lib::${n}DdiTable.load(std::memory_order_acquire)->${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
     if( nullptr == ${th.make_pfn_name(n, tags, obj)} ) {
         %if ret_type == 'ze_result_t':
         if(!ze_lib::context->isInitialized)
@@ -268,7 +307,27 @@ ${th.make_func_name(n, tags, obj)}(
     ze_lib::context->${n}Inuse = true;
 %endif
 
+    %if snapshot_reset or snapshot_events:
+    ${x}_result_t result = ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+    %if snapshot_reset:
+    // The components of the device may change across a reset, even a failed
+    // one; its next snapshot enumerates them again.
+    ze_lib::context->sysmanSnapshot.invalidate(hDevice);
+    %else:
+    // Devices attached, detached or needing a reset have their components
+    // enumerated again by their next snapshot.
+    if (${X}_RESULT_SUCCESS == result && nullptr != phDevices && nullptr != pEvents) {
+        for (uint32_t i = 0; i < count; ++i) {
+            if (pEvents[i] & (ZES_EVENT_TYPE_FLAG_DEVICE_DETACH | ZES_EVENT_TYPE_FLAG_DEVICE_ATTACH | ZES_EVENT_TYPE_FLAG_DEVICE_RESET_REQUIRED)) {
+                ze_lib::context->sysmanSnapshot.invalidate(phDevices[i]);
+            }
+        }
+    }
+    %endif
+    return result;
+    %else:
     return ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+    %endif
     #endif
 }
 %endif
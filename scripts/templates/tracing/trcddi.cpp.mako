@@ -71,9 +71,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<${ret_type}>(context.${n}DdiTable.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)},
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks\
+                                                  apiCallbackData\
 %if not is_void_params:
 ,
                                                   *tracerParams.p${",\n                                                  *tracerParams.p".join(params_list)}\
@@ -20,6 +20,8 @@ from templates import helper as th
  */
 #pragma once
 #include "${n}_api.h"
+#include <type_traits>
+#include <vector>
 
 namespace validation_layer
 {
@@ -52,4 +54,42 @@ ${obj['return_type']} result ) {return ZE_RESULT_SUCCESS;}
 %endif
     virtual ~${N}ValidationEntryPoints() {}
 };
+
+// Checkers to call for each entry point.  A checker is only listed for the
+// entry points its class overrides, so intercepts never make a virtual call
+// into an inherited no-op default.
+class ${N}ValidationDispatch {
+public:
+    %for obj in th.extract_objs(specs, r"function"):
+    std::vector<${N}ValidationEntryPoints *> ${th.make_func_name(n, tags, obj)}Prologue;
+    std::vector<${N}ValidationEntryPoints *> ${th.make_func_name(n, tags, obj)}Epilogue;
+    %endfor
+%if n == 'ze':
+    std::vector<${N}ValidationEntryPoints *> zexCounterBasedEventCreate2Prologue;
+    std::vector<${N}ValidationEntryPoints *> zexCounterBasedEventCreate2Epilogue;
+%endif
+
+    // T is the checker's concrete class.  &T::f has the type of the
+    // ${N}ValidationEntryPoints member unless T redeclares f, so whether an
+    // entry point is overridden is decided at compile time.
+    template <class T> void addChecker(T *checker) {
+        if (nullptr == checker)
+            return;
+        %for obj in th.extract_objs(specs, r"function"):
+        addIfOverridden(${th.make_func_name(n, tags, obj)}Prologue, checker, &T::${th.make_func_name(n, tags, obj)}Prologue, &${N}ValidationEntryPoints::${th.make_func_name(n, tags, obj)}Prologue);
+        addIfOverridden(${th.make_func_name(n, tags, obj)}Epilogue, checker, &T::${th.make_func_name(n, tags, obj)}Epilogue, &${N}ValidationEntryPoints::${th.make_func_name(n, tags, obj)}Epilogue);
+        %endfor
+%if n == 'ze':
+        addIfOverridden(zexCounterBasedEventCreate2Prologue, checker, &T::zexCounterBasedEventCreate2Prologue, &${N}ValidationEntryPoints::zexCounterBasedEventCreate2Prologue);
+        addIfOverridden(zexCounterBasedEventCreate2Epilogue, checker, &T::zexCounterBasedEventCreate2Epilogue, &${N}ValidationEntryPoints::zexCounterBasedEventCreate2Epilogue);
+%endif
+    }
+
+private:
+    template <class Derived, class Base>
+    static void addIfOverridden(std::vector<${N}ValidationEntryPoints *> &checkers, ${N}ValidationEntryPoints *checker, Derived, Base) {
+        if (!std::is_same<Derived, Base>::value)
+            checkers.push_back(checker);
+    }
+};
 }
\ No newline at end of file
@@ -51,6 +51,7 @@ namespace validation_layer
     func_name = th.make_func_name(n, tags, obj)
     param_lines = [line for line in th.make_param_lines(n, tags, obj, format=['name','delim'])]
     param_names = [line for line in th.make_param_lines(n, tags, obj, format=['name'])]
+    param_signature = ",".join(th.make_param_lines(n, tags, obj, format=['type','name']))
     is_void_params = len(param_lines) == 0
     %>\
     %if 'condition' in obj:
@@ -65,10 +66,20 @@ namespace validation_layer
         %endfor
 %endif
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "${func_name}", "${param_signature}");
+            context.binaryTrace->record(binaryTraceApiId, result${"".join(", " + name for name in param_names)});
+        }
         // Only log success results if verbose logging is enabled
         if (result == ${X}_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ${X}_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         %if is_void_params:
         context.logger->log_trace(status + " (" + loader::to_string(result) + ") in ${func_name}()");
@@ -121,10 +132,20 @@ namespace validation_layer
         const void* desc,
         ze_event_handle_t* phEvent
     ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zexCounterBasedEventCreate2", "ze_context_handle_t hContext,ze_device_handle_t hDevice,const void* desc,ze_event_handle_t* phEvent");
+            context.binaryTrace->record(binaryTraceApiId, result, hContext, hDevice, desc, phEvent);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ${X}_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ${X}_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zexCounterBasedEventCreate2("
@@ -164,7 +185,7 @@ namespace validation_layer
         %endfor
         )
     {
-        context.logger->log_trace("${th.make_func_name(n, tags, obj)}(${", ".join(th.make_param_lines(n, tags, obj, format=["name", "local"]))})");
+        ZEL_LOG_TRACE(context.logger, "${th.make_func_name(n, tags, obj)}(${", ".join(th.make_param_lines(n, tags, obj, format=["name", "local"]))})");
 
         auto ${th.make_pfn_name(n, tags, obj)} = context.${n}DdiTable.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
 
@@ -175,9 +196,28 @@ namespace validation_layer
             return ${failure_return};
         %endif
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->${n}Validation->${th.make_func_name(n, tags, obj)}Prologue( \
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        ## The stateful checkers below dereference the arguments, so an entry
+        ## point that has any always validates its parameters first.
+        if (sampled || !context.validationDispatch.${n}.${th.make_func_name(n, tags, obj)}Prologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.${n}.${th.make_func_name(n, tags, obj)}Prologue) {
+                auto result = checker->${th.make_func_name(n, tags, obj)}Prologue( \
+% for line in param_lines:
+${line} \
+%endfor
+);
+                if(result!=${X}_RESULT_SUCCESS) \
+%if ret_type == "ze_result_t":
+return logAndPropagateResult_${th.make_func_name(n, tags, obj)}(result${', ' if not is_void_params else ''}${', '.join(th.make_param_lines(n, tags, obj, format=["name"]))});
+%else:
+return ${failure_return};
+%endif
+            }
+        }
+
+        for (auto checker : context.validationDispatch.${n}.${th.make_func_name(n, tags, obj)}Prologue) {
+            auto result = checker->${th.make_func_name(n, tags, obj)}Prologue( \
 % for line in param_lines:
 ${line} \
 %endfor
@@ -198,8 +238,15 @@ return ${failure_return};
         <% 
         func_name = th.make_func_name(n, tags, obj)
         generate_post_call = re.match(r"\w+Create\w*$|\w+Get$|\w+Get\w*Exp$|\w+GetIpcHandle$|\w+GetSubDevices$|\w+InitDrivers$", func_name)
+        ## Destroy, Close and Reset update the tracked handle state, so their
+        ## handle checks run on every call; the rest are read-only and sampled.
+        updates_handle_state = re.match(r"\w+Destroy$|\w+CommandListClose$|\w+CommandListReset$", func_name)
         %>
+        %if updates_handle_state:
         if(context.enableHandleLifetime ){
+        %else:
+        if(context.enableHandleLifetime && sampled ){
+        %endif
             auto result = context.handleLifetime->${n}HandleLifetime.${th.make_func_name(n, tags, obj)}Prologue( \
 % for line in param_lines:
 ${line} \
@@ -226,8 +273,28 @@ return ${failure_return};
         }
 %endif
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->${n}Validation->${th.make_func_name(n, tags, obj)}Epilogue( \
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.${n}.${th.make_func_name(n, tags, obj)}Epilogue) {
+                auto result = checker->${th.make_func_name(n, tags, obj)}Epilogue( \
+%if not is_void_params:
+% for line in param_lines:
+${line} \
+%endfor
+,driver_result);
+%else:
+driver_result );
+%endif
+                if(result!=${X}_RESULT_SUCCESS) \
+%if ret_type == "ze_result_t":
+return logAndPropagateResult_${th.make_func_name(n, tags, obj)}(result${', ' if not is_void_params else ''}${', '.join(th.make_param_lines(n, tags, obj, format=["name"]))});
+%else:
+return ${failure_return};
+%endif
+            }
+        }
+
+        for (auto checker : context.validationDispatch.${n}.${th.make_func_name(n, tags, obj)}Epilogue) {
+            auto result = checker->${th.make_func_name(n, tags, obj)}Epilogue( \
 %if not is_void_params:
 % for line in param_lines:
 ${line} \
@@ -297,16 +364,24 @@ return ${failure_return};
         ze_event_handle_t* phEvent                      ///< [out] pointer to handle of event object created
         )
     {
-        context.logger->log_trace("zexCounterBasedEventCreate2(hContext, hDevice, desc, phEvent)");
+        ZEL_LOG_TRACE(context.logger, "zexCounterBasedEventCreate2(hContext, hDevice, desc, phEvent)");
 
         // Note: This is an experimental function that may not have a DDI table entry.
         // For now, we'll return unsupported feature as this function should be
         // accessed through zeDriverGetExtensionFunctionAddress mechanism, but we
         // still want to track it in the validation layers for leak checking purposes.
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zexCounterBasedEventCreate2Prologue( hContext, hDevice, desc, phEvent );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.ze.zexCounterBasedEventCreate2Prologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.ze.zexCounterBasedEventCreate2Prologue) {
+                auto result = checker->zexCounterBasedEventCreate2Prologue( hContext, hDevice, desc, phEvent );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zexCounterBasedEventCreate2(result, hContext, hDevice, desc, phEvent);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.ze.zexCounterBasedEventCreate2Prologue) {
+            auto result = checker->zexCounterBasedEventCreate2Prologue( hContext, hDevice, desc, phEvent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zexCounterBasedEventCreate2(result, hContext, hDevice, desc, phEvent);
         }
 
@@ -314,7 +389,7 @@ return ${failure_return};
             //Unimplemented
         }
 
-        if(context.enableHandleLifetime){
+        if(context.enableHandleLifetime && sampled){
             auto result = context.handleLifetime->zeHandleLifetime.zexCounterBasedEventCreate2Prologue( hContext, hDevice, desc, phEvent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zexCounterBasedEventCreate2(result, hContext, hDevice, desc, phEvent);
         }
@@ -356,8 +431,15 @@ return ${failure_return};
             }
         }
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zexCounterBasedEventCreate2Epilogue( hContext, hDevice, desc, phEvent, driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.ze.zexCounterBasedEventCreate2Epilogue) {
+                auto result = checker->zexCounterBasedEventCreate2Epilogue( hContext, hDevice, desc, phEvent, driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zexCounterBasedEventCreate2(result, hContext, hDevice, desc, phEvent);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.ze.zexCounterBasedEventCreate2Epilogue) {
+            auto result = checker->zexCounterBasedEventCreate2Epilogue( hContext, hDevice, desc, phEvent, driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zexCounterBasedEventCreate2(result, hContext, hDevice, desc, phEvent);
         }
 
@@ -8,6 +8,8 @@
  *
  */
 #include "ze_null.h"
+#include <algorithm>
+#include <chrono>
 #include <cstring>
 
 namespace driver
@@ -19,6 +21,29 @@ namespace driver
     zes_dditable_driver_t pSysman;
     zer_dditable_driver_t pRuntime;
 
+    //////////////////////////////////////////////////////////////////////////
+    uint64_t monotonicMicroseconds()
+    {
+        return static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch() ).count() );
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// zesDeviceEnum* for a device with the given number of components
+    template<typename handle_t>
+    ze_result_t enumComponents( uint32_t available, uint32_t* pCount, handle_t* phComponents )
+    {
+        if( ( nullptr == phComponents ) || ( 0 == *pCount ) )
+        {
+            *pCount = available;
+            return ZE_RESULT_SUCCESS;
+        }
+        *pCount = std::min( *pCount, available );
+        for( uint32_t i = 0; i < *pCount; ++i )
+            phComponents[ i ] = reinterpret_cast<handle_t>( context.get() );
+        return ZE_RESULT_SUCCESS;
+    }
+
     //////////////////////////////////////////////////////////////////////////
     context_t::context_t()
     {
@@ -28,6 +53,8 @@ namespace driver
         #endif
         std::string null_driver_id_str = std::to_string(ZEL_NULL_DRIVER_ID);
         ddiExtensionSupported = (ddi_test_disable != null_driver_id_str && ddi_test_disable != "3");
+        // benchmarks measure loader overhead and opt out of the per-call environment bookkeeping
+        callTrackingEnabled = !getenv_tobool( "ZEL_TEST_NULL_DRIVER_DISABLE_CALL_TRACKING" );
         
         zesDdiTable.Driver.pfnGet = [](
             uint32_t* pCount,
@@ -37,6 +64,79 @@ namespace driver
             if( nullptr != phDrivers ) *reinterpret_cast<void**>( phDrivers ) = context.get();
             return ZE_RESULT_SUCCESS;
         };
+
+        zesDdiTable.Device.pfnGet = [](
+            zes_driver_handle_t,
+            uint32_t* pCount,
+            zes_device_handle_t* phDevices )
+        {
+            *pCount = 1;
+            if( nullptr != phDevices ) *reinterpret_cast<void**>( phDevices ) = context.get();
+            return ZE_RESULT_SUCCESS;
+        };
+
+        //////////////////////////////////////////////////////////////////////////
+        /// every device reports one power domain, GPU and memory frequency
+        /// domains, two temperature sensors, two engine groups and one memory
+        /// module, so sysman telemetry can be exercised without hardware
+        zesDdiTable.Device.pfnEnumPowerDomains = [](
+            zes_device_handle_t,
+            uint32_t* pCount,
+            zes_pwr_handle_t* phPower )
+        {
+            return enumComponents( 1, pCount, phPower );
+        };
+        zesDdiTable.Device.pfnEnumFrequencyDomains = [](
+            zes_device_handle_t,
+            uint32_t* pCount,
+            zes_freq_handle_t* phFrequency )
+        {
+            return enumComponents( 2, pCount, phFrequency );
+        };
+        zesDdiTable.Device.pfnEnumTemperatureSensors = [](
+            zes_device_handle_t,
+            uint32_t* pCount,
+            zes_temp_handle_t* phTemperature )
+        {
+            return enumComponents( 2, pCount, phTemperature );
+        };
+        zesDdiTable.Device.pfnEnumEngineGroups = [](
+            zes_device_handle_t,
+            uint32_t* pCount,
+            zes_engine_handle_t* phEngine )
+        {
+            return enumComponents( 2, pCount, phEngine );
+        };
+        zesDdiTable.Device.pfnEnumMemoryModules = [](
+            zes_device_handle_t,
+            uint32_t* pCount,
+            zes_mem_handle_t* phMemory )
+        {
+            return enumComponents( 1, pCount, phMemory );
+        };
+
+        //////////////////////////////////////////////////////////////////////////
+        /// counters advance with the monotonic clock: every power domain draws
+        /// 25 W and every engine group is busy 40% of the time
+        zesDdiTable.Power.pfnGetEnergyCounter = [](
+            zes_pwr_handle_t,
+            zes_power_energy_counter_t* pEnergy )
+        {
+            const uint64_t now = monotonicMicroseconds();
+            pEnergy->energy = now * 25;
+            pEnergy->timestamp = now;
+            return ZE_RESULT_SUCCESS;
+        };
+        zesDdiTable.Engine.pfnGetActivity = [](
+            zes_engine_handle_t,
+            zes_engine_stats_t* pStats )
+        {
+            const uint64_t now = monotonicMicroseconds();
+            pStats->activeTime = now / 5 * 2;
+            pStats->timestamp = now;
+            return ZE_RESULT_SUCCESS;
+        };
+
         //////////////////////////////////////////////////////////////////////////
         zeDdiTable.Driver.pfnGet = [](
             uint32_t* pCount,
@@ -682,6 +782,8 @@ namespace driver
 
     char *context_t::setenv_var_with_driver_id(const std::string &key, uint32_t driverId)
     {
+        if (!callTrackingEnabled)
+            return nullptr;
         std::string env = key + "=" + std::to_string(driverId);
         char *env_str = strdup_safe(env.c_str());
         putenv_safe(env_str);
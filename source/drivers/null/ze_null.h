@@ -9,6 +9,8 @@
  */
 #pragma once
 #include <stdlib.h>
+#include <atomic>
+#include <mutex>
 #include <vector>
 #include "ze_ddi.h"
 #include "zet_ddi.h"
@@ -34,6 +36,25 @@ namespace driver
             pRuntime = &driver::pRuntime;
         }
     };
+    ///////////////////////////////////////////////////////////////////////////////
+    /// strings handed to putenv by call tracking; they must outlive the
+    /// process environment, so they are kept here and freed with the context
+    class __zedlllocal env_var_list_t
+    {
+        std::mutex mut;
+        std::vector<char *> vars;
+    public:
+        void push_back( char *env_str )
+        {
+            if( nullptr == env_str )
+                return; // call tracking disabled
+            std::lock_guard<std::mutex> lk( mut );
+            vars.push_back( env_str );
+        }
+        std::vector<char *>::const_iterator begin() const { return vars.begin(); }
+        std::vector<char *>::const_iterator end() const { return vars.end(); }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     class __zedlllocal context_t
     {
@@ -45,17 +66,22 @@ namespace driver
         zes_dditable_t  zesDdiTable = {};
         zer_dditable_t  zerDdiTable = {};
         std::vector<BaseNullHandle*> globalBaseNullHandle;
+        std::mutex handleMutex;
 	bool ddiExtensionSupported = false;
-	std::vector<char *> env_vars{};
+	bool callTrackingEnabled = true;
+	env_var_list_t env_vars;
         context_t();
         ~context_t();
 
         void* get( void )
         {
-            static uint64_t count = 0x80800000 >> ZEL_NULL_DRIVER_ID;
+            // handles may be created from several application threads at once
+            static std::atomic<uint64_t> count{ 0x80800000 >> ZEL_NULL_DRIVER_ID };
             if (ddiExtensionSupported) {
-                globalBaseNullHandle.push_back(new BaseNullHandle());
-                return reinterpret_cast<void*>(globalBaseNullHandle.back());
+                auto handle = new BaseNullHandle();
+                std::lock_guard<std::mutex> lk( handleMutex );
+                globalBaseNullHandle.push_back(handle);
+                return reinterpret_cast<void*>(handle);
             } else {
                 return reinterpret_cast<void*>( ++count );
             }
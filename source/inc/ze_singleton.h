@@ -1,18 +1,146 @@
 /*
  *
- * Copyright (C) 2019-2025 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 #pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <tuple>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 #include <mutex>
 #include <iostream>
 
+//////////////////////////////////////////////////////////////////////////
+/// fixed-size block pool carved out of geometrically growing slabs; freed
+/// blocks go on an intrusive free list and are reused before a new slab is
+/// allocated, and slabs are returned to the heap only when the pool dies.
+/// not thread-safe: callers serialize access
+class slab_pool_t
+{
+public:
+    static constexpr size_t firstSlabBlocks = 8;
+    static constexpr size_t maxSlabBlocks = 256;
+
+    slab_pool_t() = default;
+    slab_pool_t( const slab_pool_t& ) = delete;
+    slab_pool_t& operator=( const slab_pool_t& ) = delete;
+
+    //////////////////////////////////////////////////////////////////////////
+    /// the pool serves exactly one object size, fixed by the first query
+    bool servesSize( size_t size )
+    {
+        if( 0 == objectSize )
+        {
+            objectSize = size;
+            blockSize = roundUp( size < sizeof( free_block_t ) ? sizeof( free_block_t ) : size );
+        }
+        return size == objectSize;
+    }
+
+    void* allocate()
+    {
+        if( nullptr == freeList )
+            grow();
+        auto block = freeList;
+        freeList = block->next;
+        return block;
+    }
+
+    void deallocate( void* ptr )
+    {
+        auto block = static_cast<free_block_t*>( ptr );
+        block->next = freeList;
+        freeList = block;
+    }
+
+private:
+    struct free_block_t
+    {
+        free_block_t* next;
+    };
+
+    static size_t roundUp( size_t size )
+    {
+        constexpr size_t alignment = alignof( std::max_align_t );
+        return ( size + alignment - 1 ) & ~( alignment - 1 );
+    }
+
+    void grow()
+    {
+        std::unique_ptr<char[]> slab( new char[ blockSize * nextSlabBlocks ] );
+        for( size_t i = nextSlabBlocks; i > 0; --i )
+            deallocate( slab.get() + ( i - 1 ) * blockSize );
+        slabs.push_back( std::move( slab ) );
+        if( nextSlabBlocks < maxSlabBlocks )
+            nextSlabBlocks *= 2;
+    }
+
+    size_t objectSize = 0;
+    size_t blockSize = 0;
+    size_t nextSlabBlocks = firstSlabBlocks;
+    free_block_t* freeList = nullptr;
+    std::vector<std::unique_ptr<char[]>> slabs;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// allocator routing single-object allocations (container nodes) to a
+/// slab_pool_t and anything else, such as bucket arrays, to the heap
+template<typename T>
+class slab_allocator_t
+{
+public:
+    using value_type = T;
+
+    explicit slab_allocator_t( slab_pool_t* _pool ) : pool( _pool ) {}
+
+    template<typename U>
+    slab_allocator_t( const slab_allocator_t<U>& other ) : pool( other.pool ) {}
+
+    T* allocate( size_t n )
+    {
+        if( 1 == n && pool->servesSize( sizeof( T ) ) )
+            return static_cast<T*>( pool->allocate() );
+        return static_cast<T*>( ::operator new( n * sizeof( T ) ) );
+    }
+
+    void deallocate( T* ptr, size_t n )
+    {
+        if( 1 == n && pool->servesSize( sizeof( T ) ) )
+            pool->deallocate( ptr );
+        else
+            ::operator delete( ptr );
+    }
+
+    template<typename U>
+    bool operator==( const slab_allocator_t<U>& other ) const { return pool == other.pool; }
+    template<typename U>
+    bool operator!=( const slab_allocator_t<U>& other ) const { return pool != other.pool; }
+
+private:
+    template<typename U> friend class slab_allocator_t;
+    slab_pool_t* pool;
+};
+
 //////////////////////////////////////////////////////////////////////////
 /// a abstract factory for creation of singleton objects
+///
+/// instances are spread over shardCount independently locked maps so that
+/// threads creating, looking up and releasing unrelated handles do not
+/// serialize on one lock; each critical section is a single hash probe, so a
+/// plain mutex per shard is used rather than a reader-writer lock, which costs
+/// more uncontended and still bounces its reader count between cores
+///
+/// each singleton lives inside its map node and the nodes come from the
+/// shard's slab pool, so creating a handle wrapper is one free-list pop under
+/// the shard lock and destroyed wrappers are recycled rather than returned to
+/// the heap
 template<typename _singleton_t, typename _key_t>
 class singleton_factory_t
 {
@@ -20,11 +148,32 @@ protected:
     using singleton_t = _singleton_t;
     using key_t = typename std::conditional<std::is_pointer<_key_t>::value, size_t, _key_t>::type;
 
-    using ptr_t = std::unique_ptr < singleton_t >;
-    using map_t = std::unordered_map < key_t, ptr_t >;
+    using allocator_t = slab_allocator_t < std::pair< const key_t, singleton_t > >;
+    using map_t = std::unordered_map < key_t, singleton_t, std::hash< key_t >, std::equal_to< key_t >, allocator_t >;
 
-    std::mutex mut; ///< lock for thread-safety
-    map_t map;      ///< single instance of singleton for each unique key
+    static constexpr size_t shardCount = 16;   ///< power of two
+    static constexpr size_t cacheLineSize = 64;
+
+    struct shard_data_t
+    {
+        std::mutex mut;     ///< lock for thread-safety
+        slab_pool_t pool;   ///< storage for map nodes; must outlive map
+        map_t map;          ///< single instance of singleton for each unique key in this shard
+
+        shard_data_t() : map( 0, std::hash< key_t >(), std::equal_to< key_t >(), allocator_t( &pool ) ) {}
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// padded to a multiple of cacheLineSize to keep the shards' locks apart;
+    /// this is best-effort: the factories live in the heap-allocated loader
+    /// context, and C++14 operator new does not honour alignas(64), so a shard
+    /// is not guaranteed to start on a cache line boundary
+    struct shard_t : shard_data_t
+    {
+        char padding[ cacheLineSize - sizeof( shard_data_t ) % cacheLineSize ];
+    };
+
+    shard_t shards[ shardCount ];
 
     //////////////////////////////////////////////////////////////////////////
     /// extract the key from parameter list and if necessary, convert type
@@ -34,6 +183,16 @@ protected:
         return reinterpret_cast<key_t>( _key );
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    /// handles are allocation addresses, so the low bits carry little entropy;
+    /// fold the hash with a multiplicative mix before picking a shard
+    shard_t& getShard( const key_t& key )
+    {
+        uint64_t hash = static_cast<uint64_t>( std::hash<key_t>()( key ) );
+        hash *= 0x9E3779B97F4A7C15ull;
+        return shards[ static_cast<size_t>( hash >> 32 ) & ( shardCount - 1 ) ];
+    }
+
 public:
     //////////////////////////////////////////////////////////////////////////
     /// default ctor/dtor
@@ -53,28 +212,36 @@ public:
         if(key == 0) // No zero keys allowed in map
             return static_cast<_singleton_t*>(0);
 
-        std::lock_guard<std::mutex> lk( mut );
-        auto iter = map.find( key );
+        auto& shard = getShard( key );
+        std::lock_guard<std::mutex> lk( shard.mut );
+        auto iter = shard.map.find( key );
 
-        if( map.end() == iter )
+        if( shard.map.end() == iter )
         {
-            auto ptr = std::make_unique<singleton_t>( std::forward<Ts>( _params )... );
-            iter = map.emplace( key, std::move( ptr ) ).first;
+            iter = shard.map.emplace( std::piecewise_construct,
+                std::forward_as_tuple( key ),
+                std::forward_as_tuple( std::forward<Ts>( _params )... ) ).first;
         }
-        return iter->second.get();
+        return &iter->second;
     }
 
     bool hasInstance( _key_t _key )
     {
-        std::lock_guard<std::mutex> lk( mut );
-        return map.find( getKey( _key ) ) != map.end();
+        auto key = getKey( _key );
+        auto& shard = getShard( key );
+        std::lock_guard<std::mutex> lk( shard.mut );
+        return shard.map.find( key ) != shard.map.end();
     }
 
     //////////////////////////////////////////////////////////////////////////
     /// once the key is no longer valid, release the singleton
+    /// the singleton is destroyed under the shard lock, since its node goes
+    /// back to the shard's pool, which is not thread-safe
     void release( _key_t _key )
     {
-        std::lock_guard<std::mutex> lk( mut );
-        map.erase( getKey( _key ) );
+        auto key = getKey( _key );
+        auto& shard = getShard( key );
+        std::lock_guard<std::mutex> lk( shard.mut );
+        shard.map.erase( key );
     }
 };
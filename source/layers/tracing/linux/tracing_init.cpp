@@ -1,6 +1,6 @@
 /*
  *
- * Copyright (C) 2019-2021 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,9 +11,15 @@ namespace tracing_layer
 {
     void __attribute__((constructor)) createAPITracerContextImp() {
         pGlobalAPITracerContextImp = new struct APITracerContextImp;
+        pChromeTraceRecorder = createChromeTraceRecorder();
+        pApiLatencyStats = createApiLatencyStats(ZEL_TRACER_API_COUNT);
     }
 
     void __attribute__((destructor)) deleteAPITracerContextImp() {
+        finalizeChromeTraceRecorder();
+        ApiLatencyStats *latencyStats = pApiLatencyStats;
+        pApiLatencyStats = nullptr;
+        delete latencyStats;
         delete pGlobalAPITracerContextImp;
     }
 }
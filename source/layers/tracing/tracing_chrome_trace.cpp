@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "tracing_chrome_trace.h"
+#include "ze_util.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+#define GET_PID() _getpid()
+#else
+#include <sys/syscall.h>
+#include <unistd.h>
+#define GET_PID() getpid()
+#endif
+
+namespace tracing_layer {
+
+ChromeTraceRecorder *pChromeTraceRecorder = nullptr;
+
+namespace {
+
+uint64_t currentThreadId() {
+#ifdef _WIN32
+    return static_cast<uint64_t>(GetCurrentThreadId());
+#elif defined(SYS_gettid)
+    return static_cast<uint64_t>(syscall(SYS_gettid));
+#else
+    return static_cast<uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+#endif
+}
+
+// Microseconds with nanosecond precision, as Chrome trace timestamps are.
+void printMicroseconds(FILE *out, uint64_t ns) {
+    std::fprintf(out, "%" PRIu64 ".%03u", ns / 1000, static_cast<unsigned>(ns % 1000));
+}
+
+} // namespace
+
+constexpr size_t ChromeTraceThreadBuffer::firstChunkEvents;
+constexpr size_t ChromeTraceThreadBuffer::maxChunkEvents;
+
+ChromeTraceThreadBuffer::ChromeTraceThreadBuffer(uint64_t threadId, size_t capacity)
+    : threadId(threadId), capacity(capacity) {
+    size_t chunkCount = 0;
+    for (size_t events = 0; events < capacity; ++chunkCount) {
+        events += chunkEvents(chunkCount);
+    }
+    chunks.reset(new std::unique_ptr<ChromeTraceEvent[]>[chunkCount]);
+}
+
+bool ChromeTraceThreadBuffer::addChunk() {
+    const size_t events = std::min(chunkEvents(chunksUsed), capacity - eventsAllocated);
+    ChromeTraceEvent *chunk = new (std::nothrow) ChromeTraceEvent[events];
+    if (!chunk) {
+        return false;
+    }
+    chunks[chunksUsed++].reset(chunk);
+    eventsAllocated += events;
+    next = chunk;
+    nextFree = events;
+    return true;
+}
+
+ChromeTraceRecorder::ChromeTraceRecorder(const std::string &path, size_t eventsPerThread)
+    : tracePath(path), eventsPerThread(eventsPerThread ? eventsPerThread : 1),
+      startNs(nowNs()), processId(static_cast<uint64_t>(GET_PID())) {}
+
+ChromeTraceThreadBuffer *ChromeTraceRecorder::registerThread() {
+    std::unique_ptr<ChromeTraceThreadBuffer> buffer(
+        new ChromeTraceThreadBuffer(currentThreadId(), eventsPerThread));
+    ChromeTraceThreadBuffer *result = buffer.get();
+    {
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        buffers.push_back(std::move(buffer));
+    }
+    threadBuffers.set(result);
+    return result;
+}
+
+uint64_t ChromeTraceRecorder::droppedEvents() const {
+    std::lock_guard<std::mutex> lock(buffersMutex);
+    uint64_t dropped = 0;
+    for (const auto &buffer : buffers) {
+        dropped += buffer->dropped.load(std::memory_order_relaxed);
+    }
+    return dropped;
+}
+
+bool ChromeTraceRecorder::write() const {
+    FILE *out = std::fopen(tracePath.c_str(), "w");
+    if (!out) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(buffersMutex);
+    uint64_t dropped = 0;
+    std::fprintf(out, "{\"traceEvents\":[\n");
+    std::fprintf(out,
+                 "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%" PRIu64
+                 ",\"tid\":0,\"args\":{\"name\":\"Level Zero API\"}}",
+                 processId);
+    for (const auto &buffer : buffers) {
+        dropped += buffer->dropped.load(std::memory_order_relaxed);
+        size_t remaining = buffer->count.load(std::memory_order_acquire);
+        for (size_t chunk = 0; remaining != 0; ++chunk) {
+            const ChromeTraceEvent *events = buffer->chunks[chunk].get();
+            const size_t count = std::min(ChromeTraceThreadBuffer::chunkEvents(chunk), remaining);
+            remaining -= count;
+            for (size_t i = 0; i < count; ++i) {
+                const ChromeTraceEvent &event = events[i];
+                const uint64_t begin = event.beginNs > startNs ? event.beginNs - startNs : 0;
+                const uint64_t duration = event.endNs > event.beginNs ? event.endNs - event.beginNs : 0;
+                std::fprintf(out, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%" PRIu64 ",\"tid\":%" PRIu64 ",\"ts\":",
+                             event.name ? event.name : "unknown", processId, buffer->threadId);
+                printMicroseconds(out, begin);
+                std::fprintf(out, ",\"dur\":");
+                printMicroseconds(out, duration);
+                std::fprintf(out, "}");
+            }
+        }
+    }
+    std::fprintf(out, "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{\"droppedEvents\":%" PRIu64 "}}\n",
+                 dropped);
+    return std::fclose(out) == 0;
+}
+
+ChromeTraceRecorder *createChromeTraceRecorder() {
+    const std::string path = getenv_string("ZEL_TRACING_CHROME_TRACE_FILE");
+    if (path.empty()) {
+        return nullptr;
+    }
+    // Counts above 1 << 24 (384 MiB of events per thread) are clamped;
+    // 0 and counts that do not parse fall back to the default.
+    const unsigned long long defaultEvents = 131072;
+    const unsigned long long maxEvents = 1ull << 24;
+    unsigned long long events = defaultEvents;
+    const std::string eventsEnv = getenv_string("ZEL_TRACING_CHROME_TRACE_EVENTS");
+    if (!eventsEnv.empty()) {
+        errno = 0;
+        const unsigned long long parsed = std::strtoull(eventsEnv.c_str(), nullptr, 10);
+        if (eventsEnv.find('-') != std::string::npos || errno != 0 || parsed == 0) {
+            std::cerr << "ze_tracing_layer: Ignoring invalid ZEL_TRACING_CHROME_TRACE_EVENTS="
+                      << eventsEnv << "; using " << defaultEvents << "\n";
+        } else if (parsed > maxEvents) {
+            std::cerr << "ze_tracing_layer: ZEL_TRACING_CHROME_TRACE_EVENTS=" << eventsEnv
+                      << " is too large; using " << maxEvents << "\n";
+            events = maxEvents;
+        } else {
+            events = parsed;
+        }
+    }
+    return new ChromeTraceRecorder(path, static_cast<size_t>(events));
+}
+
+void finalizeChromeTraceRecorder() {
+    ChromeTraceRecorder *recorder = pChromeTraceRecorder;
+    if (!recorder) {
+        return;
+    }
+    pChromeTraceRecorder = nullptr;
+    if (!recorder->write()) {
+        std::cerr << "ze_tracing_layer: Failed to write Chrome trace file " << recorder->path() << "\n";
+    } else if (const uint64_t dropped = recorder->droppedEvents()) {
+        std::cerr << "ze_tracing_layer: " << dropped
+                  << " API calls were not traced because a thread's buffer was full; "
+                     "raise ZEL_TRACING_CHROME_TRACE_EVENTS\n";
+    }
+    delete recorder;
+}
+
+} // namespace tracing_layer
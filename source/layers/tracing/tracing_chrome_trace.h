@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "tracing_thread_state.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace tracing_layer {
+
+// One traced API call. name points at the intercept's __func__, which lives
+// as long as the tracing layer is loaded.
+struct ChromeTraceEvent {
+    const char *name;
+    uint64_t beginNs;
+    uint64_t endNs;
+};
+
+// Events of one thread, in chunks allocated as the thread records: the
+// first chunk holds firstChunkEvents events and each next one twice as many,
+// up to maxChunkEvents, so a thread that makes a few calls costs a few
+// kilobytes rather than its whole capacity. Only the owning thread appends;
+// count is published with release after the event and its chunk are
+// written, so that the writer at teardown sees complete events.
+struct ChromeTraceThreadBuffer {
+    static constexpr size_t firstChunkEvents = 64;
+    static constexpr size_t maxChunkEvents = 4096;
+
+    ChromeTraceThreadBuffer(uint64_t threadId, size_t capacity);
+
+    static size_t chunkEvents(size_t chunk) {
+        return chunk < 6 ? firstChunkEvents << chunk : maxChunkEvents;
+    }
+
+    // Allocates the next chunk; returns false when that fails.
+    bool addChunk();
+
+    const uint64_t threadId;
+    const size_t capacity;
+    std::unique_ptr<std::unique_ptr<ChromeTraceEvent[]>[]> chunks;
+    std::atomic<size_t> count{0};
+    std::atomic<uint64_t> dropped{0}; // calls made after the buffer filled up
+
+    // Owner only.
+    size_t chunksUsed = 0;
+    size_t eventsAllocated = 0;
+    ChromeTraceEvent *next = nullptr;
+    size_t nextFree = 0;
+};
+
+// Built-in API timeline for the tracing layer. Every intercepted ze/zer call
+// is recorded as a complete event into a buffer of the calling thread, and
+// write() emits the Chrome trace event JSON format, which chrome://tracing
+// and ui.perfetto.dev both load. Recording takes no lock: a thread's buffer
+// is registered under a mutex on its first call only, and a new chunk is
+// allocated without one. The buffers of exited threads are kept until
+// write(), since their events belong in the trace.
+class ChromeTraceRecorder {
+  public:
+    ChromeTraceRecorder(const std::string &path, size_t eventsPerThread);
+
+    ChromeTraceRecorder(const ChromeTraceRecorder &) = delete;
+    ChromeTraceRecorder &operator=(const ChromeTraceRecorder &) = delete;
+
+    static uint64_t nowNs() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    void record(const char *name, uint64_t beginNs, uint64_t endNs) {
+        ChromeTraceThreadBuffer *buffer = threadBuffer();
+        const size_t index = buffer->count.load(std::memory_order_relaxed);
+        if (index >= buffer->capacity || (buffer->nextFree == 0 && !buffer->addChunk())) {
+            buffer->dropped.store(buffer->dropped.load(std::memory_order_relaxed) + 1,
+                                  std::memory_order_relaxed);
+            return;
+        }
+        *buffer->next++ = ChromeTraceEvent{name, beginNs, endNs};
+        --buffer->nextFree;
+        buffer->count.store(index + 1, std::memory_order_release);
+    }
+
+    // Writes the events recorded so far; returns false if the file cannot
+    // be written.
+    bool write() const;
+
+    const std::string &path() const { return tracePath; }
+    uint64_t droppedEvents() const;
+
+  private:
+    ChromeTraceThreadBuffer *threadBuffer() {
+        if (void *buffer = threadBuffers.get()) {
+            return static_cast<ChromeTraceThreadBuffer *>(buffer);
+        }
+        return registerThread();
+    }
+    ChromeTraceThreadBuffer *registerThread();
+
+    const std::string tracePath;
+    const size_t eventsPerThread;
+    const uint64_t startNs;
+    const uint64_t processId;
+    mutable std::mutex buffersMutex;
+    std::vector<std::unique_ptr<ChromeTraceThreadBuffer>> buffers;
+    PerThreadState threadBuffers{this, nullptr};
+};
+
+// Set while the tracing layer is loaded with the exporter enabled, nullptr
+// otherwise.
+extern ChromeTraceRecorder *pChromeTraceRecorder;
+
+// Reads the exporter's environment configuration:
+//   ZEL_TRACING_CHROME_TRACE_FILE    path of the JSON file; unset disables it
+//   ZEL_TRACING_CHROME_TRACE_EVENTS  events kept per thread (default 131072,
+//                                    at most 1 << 24)
+// Returns nullptr when the exporter is disabled.
+ChromeTraceRecorder *createChromeTraceRecorder();
+
+// Writes and destroys pChromeTraceRecorder, if any, at layer teardown.
+void finalizeChromeTraceRecorder();
+
+} // namespace tracing_layer
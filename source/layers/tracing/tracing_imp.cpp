@@ -7,6 +7,9 @@
 
 #include "tracing_imp.h"
 
+#include <algorithm>
+#include <cstring>
+
 namespace tracing_layer {
 
 thread_local ze_bool_t tracingInProgress = 0;
@@ -339,12 +342,72 @@ size_t APITracerContextImp::testAndFreeRetiredTracers() {
         if (testForTracerArrayReferences(retiringTracerArray))
             continue;
         this->retiringTracerArrayList.remove(retiringTracerArray);
-        delete[] retiringTracerArray->tracerArrayEntries;
-        delete retiringTracerArray;
+        freeTracerArray(retiringTracerArray);
     }
     return this->retiringTracerArrayList.size();
 }
 
+//
+// Build the callbacks of every enabled tracer into flat per-API lists, so the
+// API intercepts can iterate only the tracers that registered callbacks for
+// that API, without copying or allocating on every call.
+//
+template <typename TAllCallbacks>
+static tracer_api_callbacks_t
+buildApiCallbackList(tracer_array_t *tracerArray,
+                     TAllCallbacks tracer_array_entry_t::*prologues,
+                     TAllCallbacks tracer_array_entry_t::*epilogues) {
+    const size_t slotCount = sizeof(TAllCallbacks) / sizeof(tracer_callback_t);
+    tracer_api_callbacks_t apiCallbacks;
+    apiCallbacks.offsets = new size_t[slotCount + 1];
+
+    auto getCallback = [](const TAllCallbacks &allCbs, size_t slot) {
+        tracer_callback_t callback;
+        std::memcpy(&callback,
+                    reinterpret_cast<const char *>(&allCbs) +
+                        slot * sizeof(tracer_callback_t),
+                    sizeof(tracer_callback_t));
+        return callback;
+    };
+
+    std::vector<tracer_api_callback_t> entries;
+    for (size_t slot = 0; slot < slotCount; slot++) {
+        apiCallbacks.offsets[slot] = entries.size();
+        for (size_t i = 0; i < tracerArray->tracerArrayCount; i++) {
+            const tracer_array_entry_t &tracer = tracerArray->tracerArrayEntries[i];
+            tracer_api_callback_t callback;
+            callback.prologue = getCallback(tracer.*prologues, slot);
+            callback.epilogue = getCallback(tracer.*epilogues, slot);
+            callback.pUserData = tracer.pUserData;
+            if (callback.prologue != nullptr || callback.epilogue != nullptr)
+                entries.push_back(callback);
+        }
+    }
+    apiCallbacks.offsets[slotCount] = entries.size();
+
+    apiCallbacks.entries = new tracer_api_callback_t[entries.size() + 1];
+    std::copy(entries.begin(), entries.end(), apiCallbacks.entries);
+    return apiCallbacks;
+}
+
+void APITracerContextImp::buildApiCallbacks(tracer_array_t *tracerArray) {
+    tracerArray->coreCallbacks = buildApiCallbackList(
+        tracerArray, &tracer_array_entry_t::corePrologues,
+        &tracer_array_entry_t::coreEpilogues);
+    tracerArray->runtimeCallbacks = buildApiCallbackList(
+        tracerArray, &tracer_array_entry_t::runtimePrologues,
+        &tracer_array_entry_t::runtimeEpilogues);
+}
+
+void APITracerContextImp::freeTracerArray(tracer_array_t *tracerArray) {
+    delete[] tracerArray->coreCallbacks.offsets;
+    delete[] tracerArray->coreCallbacks.entries;
+    delete[] tracerArray->runtimeCallbacks.offsets;
+    delete[] tracerArray->runtimeCallbacks.entries;
+    delete[] tracerArray->tracerArrayEntries;
+    delete tracerArray;
+}
+
 size_t APITracerContextImp::updateTracerArrays() {
     tracer_array_t *newTracerArray;
     size_t newTracerArrayCount = this->enabledTracerImpList.size();
@@ -367,6 +430,7 @@ size_t APITracerContextImp::updateTracerArrays() {
             newTracerArray->tracerArrayEntries[i] = (*itr)->tracerFunctions;
             i++;
         }
+        buildApiCallbacks(newTracerArray);
 
     } else {
         newTracerArray = &emptyTracerArray;
@@ -8,13 +8,17 @@
 #pragma once
 
 #include "tracing.h"
+#include "tracing_chrome_trace.h"
+#include "tracing_latency_stats.h"
 #include "ze_api.h"
 #include "ze_tracing_cb_structs.h"
 
 #include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <iostream>
 #include <list>
+#include <memory>
 #include <mutex>
 #include <thread>
 #include <vector>
@@ -40,11 +44,49 @@ typedef struct tracer_array_entry {
     void *pUserData;
 } tracer_array_entry_t;
 
+// Generic callback pointer used to store the per-API callbacks in a flat
+// array; it is cast back to the API specific callback type before the call.
+typedef void (*tracer_callback_t)(void);
+
+typedef struct tracerApiCallback {
+    tracer_callback_t prologue;
+    tracer_callback_t epilogue;
+    void *pUserData;
+} tracer_api_callback_t;
+
+// Per-API callbacks of all enabled tracers, built once when the set of
+// enabled tracers changes. The callbacks for the API at a given slot are
+// entries[offsets[slot]] to entries[offsets[slot + 1]], and only tracers
+// with a prologue or an epilogue for that API are listed.
+typedef struct tracerApiCallbacks {
+    size_t *offsets;
+    tracer_api_callback_t *entries;
+} tracer_api_callbacks_t;
+
 typedef struct tracerArray {
     size_t tracerArrayCount;
     tracer_array_entry_t *tracerArrayEntries;
+    tracer_api_callbacks_t coreCallbacks;
+    tracer_api_callbacks_t runtimeCallbacks;
 } tracer_array_t;
 
+// Index of a callback in zel_ze_all_callbacks_t or zel_zer_all_callbacks_t
+#define ZEL_TRACER_CALLBACK_SLOT(allCallbacksType, callbackCategory,   \
+                                 callbackFunction)                     \
+    (offsetof(allCallbacksType, callbackCategory.callbackFunction) /    \
+     sizeof(tracing_layer::tracer_callback_t))
+
+// Dense index of an API across the core and runtime callback tables: core
+// APIs first, then runtime APIs.
+#define ZEL_TRACER_CORE_API_COUNT \
+    (sizeof(zel_ze_all_callbacks_t) / sizeof(tracing_layer::tracer_callback_t))
+#define ZEL_TRACER_API_COUNT \
+    (ZEL_TRACER_CORE_API_COUNT + \
+     sizeof(zel_zer_all_callbacks_t) / sizeof(tracing_layer::tracer_callback_t))
+
+// Number of tracers whose per-call instance data is kept on the stack
+#define ZEL_TRACER_INLINE_INSTANCE_DATA_COUNT 8
+
 typedef enum tracingState {
     disabledState,        // tracing has never been enabled
     enabledState,         // tracing is enabled.
@@ -109,7 +151,7 @@ struct APITracerContextImp : APITracerContext {
 
   private:
     std::mutex traceTableMutex;
-    tracer_array_t emptyTracerArray = {0, NULL};
+    tracer_array_t emptyTracerArray = {0, NULL, {NULL, NULL}, {NULL, NULL}};
     std::atomic<tracer_array_t *> activeTracerArray;
 
     //
@@ -124,6 +166,8 @@ struct APITracerContextImp : APITracerContext {
     std::list<struct APITracerImp *> enabledTracerImpList;
 
     ze_bool_t testForTracerArrayReferences(tracer_array_t *tracerArray);
+    void buildApiCallbacks(tracer_array_t *tracerArray);
+    void freeTracerArray(tracer_array_t *tracerArray);
     size_t testAndFreeRetiredTracers();
     size_t updateTracerArrays();
 
@@ -133,19 +177,14 @@ struct APITracerContextImp : APITracerContext {
 
 extern thread_local ThreadPrivateTracerData myThreadPrivateTracerData;
 
-template <class T>
-class APITracerCallbackStateImp {
-  public:
-    T current_api_callback;
-    void *pUserData;
-};
-
 template <class T>
 class APITracerCallbackDataImp {
   public:
     T apiOrdinal = nullptr;
-    std::vector<tracing_layer::APITracerCallbackStateImp<T>> prologCallbacks;
-    std::vector<tracing_layer::APITracerCallbackStateImp<T>> epilogCallbacks;
+    const tracer_api_callback_t *callbacks = nullptr;
+    size_t callbackCount = 0;
+    const char *apiName = nullptr;
+    size_t apiIndex = 0;
 };
 
 #define ZE_HANDLE_TRACER_RECURSION(ze_api_ptr, ...) \
@@ -156,111 +195,99 @@ class APITracerCallbackDataImp {
         tracing_layer::tracingInProgress = 1;       \
     } while (0)
 
-#define ZE_GEN_TRACER_ARRAY_ENTRY(callbackPtr, tracerArray, tracerArrayIndex, \
-                                  callbackType, callbackCategory,             \
-                                  callbackFunction)                           \
-    do {                                                                      \
-        callbackPtr = tracerArray->tracerArrayEntries[tracerArrayIndex]       \
-                          .callbackType.callbackCategory.callbackFunction;    \
-    } while (0)
-
-#define ZE_GEN_PER_API_CALLBACK_STATE(perApiCallbackData, tracerType,               \
-                                      callbackCategory, callbackFunctionType)       \
-    tracing_layer::tracer_array_t *currentTracerArray;                              \
-    currentTracerArray =                                                            \
-        (tracing_layer::tracer_array_t *)                                           \
-            tracing_layer::pGlobalAPITracerContextImp->getActiveTracersList();      \
+#define ZEL_GEN_PER_API_CALLBACK_STATE(perApiCallbackData, apiCallbacks,         \
+                                       allCallbacksType, apiIndexBase,           \
+                                       callbackCategory, callbackFunctionType)   \
+    const size_t slot = ZEL_TRACER_CALLBACK_SLOT(                               \
+        allCallbacksType, callbackCategory, callbackFunctionType);              \
+    perApiCallbackData.apiName = __func__;                                      \
+    perApiCallbackData.apiIndex = (apiIndexBase) + slot;                        \
+    tracing_layer::tracer_array_t *currentTracerArray;                          \
+    currentTracerArray =                                                        \
+        (tracing_layer::tracer_array_t *)                                       \
+            tracing_layer::pGlobalAPITracerContextImp->getActiveTracersList();  \
     if (currentTracerArray && currentTracerArray->tracerArrayCount) {           \
-        for (size_t i = 0; i < currentTracerArray->tracerArrayCount; i++) {         \
-            tracerType prologueCallbackPtr;                                         \
-            tracerType epilogue_callback_ptr;                                       \
-            ZE_GEN_TRACER_ARRAY_ENTRY(prologueCallbackPtr, currentTracerArray, i,   \
-                                      corePrologues, callbackCategory,              \
-                                      callbackFunctionType);                        \
-            ZE_GEN_TRACER_ARRAY_ENTRY(epilogue_callback_ptr, currentTracerArray, i, \
-                                      coreEpilogues, callbackCategory,              \
-                                      callbackFunctionType);                        \
-                                                                                    \
-            tracing_layer::APITracerCallbackStateImp<tracerType> prologCallback;    \
-            prologCallback.current_api_callback = prologueCallbackPtr;              \
-            prologCallback.pUserData =                                              \
-                currentTracerArray->tracerArrayEntries[i].pUserData;                \
-            perApiCallbackData.prologCallbacks.push_back(prologCallback);           \
-                                                                                    \
-            tracing_layer::APITracerCallbackStateImp<tracerType> epilogCallback;    \
-            epilogCallback.current_api_callback = epilogue_callback_ptr;            \
-            epilogCallback.pUserData =                                              \
-                currentTracerArray->tracerArrayEntries[i].pUserData;                \
-            perApiCallbackData.epilogCallbacks.push_back(epilogCallback);           \
-        }                                                                           \
+        const size_t *offsets = currentTracerArray->apiCallbacks.offsets;       \
+        perApiCallbackData.callbacks =                                          \
+            &currentTracerArray->apiCallbacks.entries[offsets[slot]];           \
+        perApiCallbackData.callbackCount = offsets[slot + 1] - offsets[slot];   \
     }
 
-#define ZER_GEN_PER_API_CALLBACK_STATE(perApiCallbackData, tracerType,               \
-                                       callbackCategory, callbackFunctionType)       \
-    tracing_layer::tracer_array_t *currentTracerArray;                               \
-    currentTracerArray =                                                             \
-        (tracing_layer::tracer_array_t *)                                            \
-            tracing_layer::pGlobalAPITracerContextImp->getActiveTracersList();       \
-    if (currentTracerArray && currentTracerArray->tracerArrayCount) {            \
-        for (size_t i = 0; i < currentTracerArray->tracerArrayCount; i++){           \
-            tracerType prologueCallbackPtr;                                          \
-            tracerType epilogue_callback_ptr;                                        \
-            ZE_GEN_TRACER_ARRAY_ENTRY(prologueCallbackPtr, currentTracerArray, i,    \
-                                       runtimePrologues, callbackCategory,           \
-                                       callbackFunctionType);                        \
-            ZE_GEN_TRACER_ARRAY_ENTRY(epilogue_callback_ptr, currentTracerArray, i,  \
-                                       runtimeEpilogues, callbackCategory,           \
-                                       callbackFunctionType);                        \
-                                                                                     \
-            tracing_layer::APITracerCallbackStateImp<tracerType> prologCallback;     \
-            prologCallback.current_api_callback = prologueCallbackPtr;               \
-            prologCallback.pUserData =                                               \
-                currentTracerArray->tracerArrayEntries[i].pUserData;                 \
-            perApiCallbackData.prologCallbacks.push_back(prologCallback);            \
-                                                                                     \
-            tracing_layer::APITracerCallbackStateImp<tracerType> epilogCallback;     \
-            epilogCallback.current_api_callback = epilogue_callback_ptr;             \
-            epilogCallback.pUserData =                                               \
-                currentTracerArray->tracerArrayEntries[i].pUserData;                 \
-            perApiCallbackData.epilogCallbacks.push_back(epilogCallback);            \
-        }                                                                            \
+#define ZE_GEN_PER_API_CALLBACK_STATE(perApiCallbackData, tracerType,         \
+                                      callbackCategory, callbackFunctionType) \
+    ZEL_GEN_PER_API_CALLBACK_STATE(perApiCallbackData, coreCallbacks,         \
+                                   zel_ze_all_callbacks_t, 0,                 \
+                                   callbackCategory, callbackFunctionType)
+
+#define ZER_GEN_PER_API_CALLBACK_STATE(perApiCallbackData, tracerType,         \
+                                       callbackCategory, callbackFunctionType) \
+    ZEL_GEN_PER_API_CALLBACK_STATE(perApiCallbackData, runtimeCallbacks,       \
+                                   zel_zer_all_callbacks_t,                    \
+                                   ZEL_TRACER_CORE_API_COUNT,                  \
+                                   callbackCategory, callbackFunctionType)
+
+// Calls the API, feeding the built-in timeline and latency statistics when
+// they are enabled. Only the call itself is timed, not the callbacks.
+template <typename TRet, typename TFunction_pointer, typename TTracer, typename... Args>
+inline TRet
+callTimedApi(TFunction_pointer zeApiPtr,
+             const APITracerCallbackDataImp<TTracer> &callbackData,
+             Args &&...args)
+{
+    ChromeTraceRecorder *chromeTrace = pChromeTraceRecorder;
+    ApiLatencyStats *latencyStats = pApiLatencyStats;
+    if (!chromeTrace && !latencyStats) {
+        return zeApiPtr(args...);
     }
+    const uint64_t beginNs = ChromeTraceRecorder::nowNs();
+    TRet ret = zeApiPtr(args...);
+    const uint64_t endNs = ChromeTraceRecorder::nowNs();
+    if (chromeTrace) {
+        chromeTrace->record(callbackData.apiName, beginNs, endNs);
+    }
+    if (latencyStats) {
+        latencyStats->record(callbackData.apiIndex, callbackData.apiName, endNs - beginNs);
+    }
+    return ret;
+}
 
 template <typename TRet, typename TFunction_pointer, typename TParams, typename TTracer,
-          typename TTracerPrologCallbacks, typename TTracerEpilogCallbacks,
           typename... Args>
 TRet
 APITracerWrapperImp(TFunction_pointer zeApiPtr, TParams paramsStruct,
-                    TTracer apiOrdinal, TTracerPrologCallbacks prologCallbacks,
-                    TTracerEpilogCallbacks epilogCallbacks, Args &&...args)
+                    const APITracerCallbackDataImp<TTracer> &callbackData,
+                    Args &&...args)
 {
     TRet ret {};
-    std::vector<APITracerCallbackStateImp<TTracer>> *callbacks_prologs =
-        &prologCallbacks;
-    std::vector<APITracerCallbackStateImp<TTracer>> *callbacksEpilogs =
-        &epilogCallbacks;
+    const tracer_api_callback_t *callbacks = callbackData.callbacks;
+    const size_t callbackCount = callbackData.callbackCount;
     // Fast path: if no callbacks are registered, directly call the API
-    if (callbacks_prologs->empty() && callbacksEpilogs->empty()) {
-        ret = zeApiPtr(args...);
+    if (callbackCount == 0) {
+        ret = callTimedApi<TRet>(zeApiPtr, callbackData, args...);
         tracing_layer::tracingInProgress = 0;
         tracing_layer::pGlobalAPITracerContextImp->releaseActivetracersList();
         return ret;
     }
 
-    std::vector<void *> ppTracerInstanceUserData;
-    ppTracerInstanceUserData.resize(callbacks_prologs->size());
+    void *inlineInstanceUserData[ZEL_TRACER_INLINE_INSTANCE_DATA_COUNT] = {};
+    std::unique_ptr<void *[]> heapInstanceUserData;
+    void **ppTracerInstanceUserData = inlineInstanceUserData;
+    if (callbackCount > ZEL_TRACER_INLINE_INSTANCE_DATA_COUNT) {
+        heapInstanceUserData.reset(new void *[callbackCount]());
+        ppTracerInstanceUserData = heapInstanceUserData.get();
+    }
 
-    for (size_t i = 0; i < callbacks_prologs->size(); i++) {
-        if (callbacks_prologs->at(i).current_api_callback != nullptr)
-            callbacks_prologs->at(i).current_api_callback(
-                paramsStruct, ret, callbacks_prologs->at(i).pUserData,
+    for (size_t i = 0; i < callbackCount; i++) {
+        if (callbacks[i].prologue != nullptr)
+            reinterpret_cast<TTracer>(callbacks[i].prologue)(
+                paramsStruct, ret, callbacks[i].pUserData,
                 &ppTracerInstanceUserData[i]);
     }
-    ret = zeApiPtr(args...);
-    for (size_t i = 0; i < callbacksEpilogs->size(); i++) {
-        if (callbacksEpilogs->at(i).current_api_callback != nullptr)
-            callbacksEpilogs->at(i).current_api_callback(
-                paramsStruct, ret, callbacksEpilogs->at(i).pUserData,
+    ret = callTimedApi<TRet>(zeApiPtr, callbackData, args...);
+    for (size_t i = 0; i < callbackCount; i++) {
+        if (callbacks[i].epilogue != nullptr)
+            reinterpret_cast<TTracer>(callbacks[i].epilogue)(
+                paramsStruct, ret, callbacks[i].pUserData,
                 &ppTracerInstanceUserData[i]);
     }
     tracing_layer::tracingInProgress = 0;
@@ -0,0 +1,267 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "tracing_latency_stats.h"
+#include "ze_util.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace tracing_layer {
+
+ApiLatencyStats *pApiLatencyStats = nullptr;
+
+constexpr uint32_t LatencyHistogram::subBucketBits;
+constexpr uint32_t LatencyHistogram::subBucketCount;
+constexpr uint32_t LatencyHistogram::maxValueBits;
+constexpr size_t LatencyHistogram::bucketCount;
+
+namespace {
+
+uint32_t highestBit(uint64_t value) {
+    uint32_t bit = 0;
+    for (uint32_t shift = 32; shift != 0; shift >>= 1) {
+        if (value >> shift) {
+            value >>= shift;
+            bit += shift;
+        }
+    }
+    return bit;
+}
+
+} // namespace
+
+size_t LatencyHistogram::bucketIndex(uint64_t ns) {
+    if (ns < subBucketCount) {
+        return static_cast<size_t>(ns);
+    }
+    if (ns >> maxValueBits) {
+        return bucketCount - 1;
+    }
+    const uint32_t bit = highestBit(ns);
+    const uint32_t row = bit - subBucketBits + 1;
+    const uint64_t sub = (ns >> (bit - subBucketBits)) & (subBucketCount - 1);
+    return static_cast<size_t>(row) * subBucketCount + static_cast<size_t>(sub);
+}
+
+uint64_t LatencyHistogram::bucketLowest(size_t index) {
+    const size_t row = index / subBucketCount;
+    const uint64_t sub = index % subBucketCount;
+    if (row == 0) {
+        return sub;
+    }
+    return (subBucketCount + sub) << (row - 1);
+}
+
+uint64_t LatencyHistogram::bucketHighest(size_t index) {
+    if (index == bucketCount - 1) {
+        return UINT64_MAX;
+    }
+    const size_t row = index / subBucketCount;
+    return bucketLowest(index) + (row == 0 ? 0 : (uint64_t(1) << (row - 1)) - 1);
+}
+
+void LatencyHistogram::clear() {
+    count.store(0, std::memory_order_relaxed);
+    totalNs.store(0, std::memory_order_relaxed);
+    minNs.store(UINT64_MAX, std::memory_order_relaxed);
+    maxNs.store(0, std::memory_order_relaxed);
+    for (auto &bucket : buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+void LatencyHistogram::merge(const LatencyHistogram &other) {
+    add(count, other.count.load(std::memory_order_relaxed));
+    add(totalNs, other.totalNs.load(std::memory_order_relaxed));
+    minNs.store(std::min(minNs.load(std::memory_order_relaxed), other.minNs.load(std::memory_order_relaxed)),
+                std::memory_order_relaxed);
+    maxNs.store(std::max(maxNs.load(std::memory_order_relaxed), other.maxNs.load(std::memory_order_relaxed)),
+                std::memory_order_relaxed);
+    for (size_t b = 0; b < bucketCount; ++b) {
+        add(buckets[b], other.buckets[b].load(std::memory_order_relaxed));
+    }
+}
+
+ApiLatencyStats::ThreadStats::ThreadStats(size_t apiCount, uint64_t epoch)
+    : apiCount(apiCount), epoch(epoch), histograms(new std::atomic<LatencyHistogram *>[apiCount]) {
+    for (size_t i = 0; i < apiCount; ++i) {
+        histograms[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+ApiLatencyStats::ThreadStats::~ThreadStats() {
+    for (size_t i = 0; i < apiCount; ++i) {
+        delete histograms[i].load(std::memory_order_relaxed);
+    }
+}
+
+void ApiLatencyStats::ThreadStats::clear() {
+    for (size_t i = 0; i < apiCount; ++i) {
+        if (LatencyHistogram *histogram = histograms[i].load(std::memory_order_relaxed)) {
+            histogram->clear();
+        }
+    }
+}
+
+ApiLatencyStats::ApiLatencyStats(size_t apiCount)
+    : apiCount(apiCount), names(new std::atomic<const char *>[apiCount]), retired(apiCount, 1) {
+    for (size_t i = 0; i < apiCount; ++i) {
+        names[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+ApiLatencyStats::~ApiLatencyStats() {
+    // No thread may retire its statistics into the ones freed below.
+    threadStates.close();
+}
+
+ApiLatencyStats::ThreadStats *ApiLatencyStats::registerThread() {
+    std::unique_ptr<ThreadStats> stats(new ThreadStats(apiCount, epoch.load(std::memory_order_relaxed)));
+    ThreadStats *result = stats.get();
+    {
+        std::lock_guard<std::mutex> lock(threadsMutex);
+        threads.push_back(std::move(stats));
+    }
+    threadStates.set(result);
+    return result;
+}
+
+void ApiLatencyStats::threadExited(void *owner, void *stats) {
+    ApiLatencyStats &self = *static_cast<ApiLatencyStats *>(owner);
+    const ThreadStats *exited = static_cast<ThreadStats *>(stats);
+    std::lock_guard<std::mutex> lock(self.threadsMutex);
+    const uint64_t current = self.epoch.load(std::memory_order_relaxed);
+    if (exited->epoch.load(std::memory_order_relaxed) == current) {
+        if (self.retired.epoch.load(std::memory_order_relaxed) != current) {
+            self.retired.clear();
+            self.retired.epoch.store(current, std::memory_order_relaxed);
+        }
+        for (size_t api = 0; api < self.apiCount; ++api) {
+            const LatencyHistogram *histogram = exited->histograms[api].load(std::memory_order_relaxed);
+            if (!histogram) {
+                continue;
+            }
+            LatencyHistogram *total = self.retired.histograms[api].load(std::memory_order_relaxed);
+            if (!total) {
+                total = new LatencyHistogram();
+                self.retired.histograms[api].store(total, std::memory_order_relaxed);
+            }
+            total->merge(*histogram);
+        }
+    }
+    auto it = std::find_if(self.threads.begin(), self.threads.end(),
+                           [exited](const std::unique_ptr<ThreadStats> &thread) { return thread.get() == exited; });
+    if (it != self.threads.end()) {
+        self.threads.erase(it);
+    }
+}
+
+size_t ApiLatencyStats::liveThreadCount() const {
+    std::lock_guard<std::mutex> lock(threadsMutex);
+    return threads.size();
+}
+
+LatencyHistogram *ApiLatencyStats::addHistogram(ThreadStats &stats, size_t apiIndex, const char *name) {
+    if (!names[apiIndex].load(std::memory_order_relaxed)) {
+        names[apiIndex].store(name, std::memory_order_relaxed);
+    }
+    LatencyHistogram *histogram = new LatencyHistogram();
+    stats.histograms[apiIndex].store(histogram, std::memory_order_release);
+    return histogram;
+}
+
+void ApiLatencyStats::accumulate(const ThreadStats &thread, std::vector<zel_api_latency_stats_t> &merged,
+                                 std::vector<uint64_t> &buckets, std::vector<uint64_t> &counts) const {
+    for (size_t api = 0; api < apiCount; ++api) {
+        const LatencyHistogram *histogram = thread.histograms[api].load(std::memory_order_acquire);
+        if (!histogram) {
+            continue;
+        }
+        zel_api_latency_stats_t &stats = merged[api];
+        stats.callCount += histogram->count.load(std::memory_order_relaxed);
+        stats.totalNs += histogram->totalNs.load(std::memory_order_relaxed);
+        stats.minNs = std::min(stats.minNs, histogram->minNs.load(std::memory_order_relaxed));
+        stats.maxNs = std::max(stats.maxNs, histogram->maxNs.load(std::memory_order_relaxed));
+        uint64_t *apiBuckets = &buckets[api * LatencyHistogram::bucketCount];
+        for (size_t b = 0; b < LatencyHistogram::bucketCount; ++b) {
+            const uint64_t n = histogram->buckets[b].load(std::memory_order_relaxed);
+            apiBuckets[b] += n;
+            counts[api] += n;
+        }
+    }
+}
+
+std::vector<zel_api_latency_stats_t> ApiLatencyStats::snapshot() const {
+    std::vector<uint64_t> counts(apiCount);
+    std::vector<zel_api_latency_stats_t> merged(apiCount);
+    std::vector<uint64_t> buckets(apiCount * LatencyHistogram::bucketCount);
+    for (auto &stats : merged) {
+        stats = {};
+        stats.minNs = UINT64_MAX;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(threadsMutex);
+        const uint64_t current = epoch.load(std::memory_order_relaxed);
+        for (const auto &thread : threads) {
+            if (thread->epoch.load(std::memory_order_acquire) == current) {
+                accumulate(*thread, merged, buckets, counts);
+            }
+        }
+        if (retired.epoch.load(std::memory_order_relaxed) == current) {
+            accumulate(retired, merged, buckets, counts);
+        }
+    }
+
+    std::vector<zel_api_latency_stats_t> result;
+    for (size_t api = 0; api < apiCount; ++api) {
+        zel_api_latency_stats_t &stats = merged[api];
+        const uint64_t total = counts[api];
+        if (total == 0) {
+            continue;
+        }
+        stats.name = names[api].load(std::memory_order_relaxed);
+        // Percentiles come from the buckets, which the owning threads may
+        // have advanced past count; rank against the bucket total.
+        const uint64_t *apiBuckets = &buckets[api * LatencyHistogram::bucketCount];
+        const double quantiles[] = {0.5, 0.9, 0.99, 0.999};
+        uint64_t *outputs[] = {&stats.p50Ns, &stats.p90Ns, &stats.p99Ns, &stats.p999Ns};
+        for (size_t q = 0; q < 4; ++q) {
+            const uint64_t rank = std::max<uint64_t>(
+                1, static_cast<uint64_t>(std::ceil(quantiles[q] * static_cast<double>(total))));
+            uint64_t seen = 0;
+            for (size_t b = 0; b < LatencyHistogram::bucketCount; ++b) {
+                seen += apiBuckets[b];
+                if (seen >= rank) {
+                    // The exact extremes are known; do not report past them.
+                    uint64_t value = LatencyHistogram::bucketHighest(b);
+                    if (stats.maxNs >= LatencyHistogram::bucketLowest(b)) {
+                        value = std::min(value, stats.maxNs);
+                    }
+                    *outputs[q] = value;
+                    break;
+                }
+            }
+        }
+        result.push_back(stats);
+    }
+    return result;
+}
+
+void ApiLatencyStats::reset() {
+    epoch.fetch_add(1, std::memory_order_relaxed);
+}
+
+ApiLatencyStats *createApiLatencyStats(size_t apiCount) {
+    if (!getenv_tobool("ZEL_TRACING_LATENCY_STATS")) {
+        return nullptr;
+    }
+    return new ApiLatencyStats(apiCount);
+}
+
+} // namespace tracing_layer
@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "loader/ze_loader.h"
+#include "tracing_thread_state.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace tracing_layer {
+
+// Latency histogram of one API on one thread, in the style of an HDR
+// histogram: values below 16ns have a bucket each, and every power of two
+// above is split into 16 sub-buckets, so a bucket's width is at most 1/16 of
+// its values. Values of 2^40ns (about 18 minutes) and more share a last,
+// overflow bucket. Only the owning thread writes, with relaxed loads and stores; any
+// thread may read a consistent-enough snapshot.
+struct LatencyHistogram {
+    static constexpr uint32_t subBucketBits = 4;
+    static constexpr uint32_t subBucketCount = 1u << subBucketBits;
+    static constexpr uint32_t maxValueBits = 40;
+    static constexpr size_t bucketCount = subBucketCount * (maxValueBits - subBucketBits + 1) + 1;
+
+    static size_t bucketIndex(uint64_t ns);
+    static uint64_t bucketLowest(size_t index);
+    static uint64_t bucketHighest(size_t index);
+
+    void record(uint64_t ns) {
+        add(count, 1);
+        add(totalNs, ns);
+        if (ns < minNs.load(std::memory_order_relaxed)) {
+            minNs.store(ns, std::memory_order_relaxed);
+        }
+        if (ns > maxNs.load(std::memory_order_relaxed)) {
+            maxNs.store(ns, std::memory_order_relaxed);
+        }
+        add(buckets[bucketIndex(ns)], 1);
+    }
+    void clear();
+    // Adds other's values; only for histograms no thread records into.
+    void merge(const LatencyHistogram &other);
+
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> totalNs{0};
+    std::atomic<uint64_t> minNs{UINT64_MAX};
+    std::atomic<uint64_t> maxNs{0};
+    std::atomic<uint64_t> buckets[bucketCount] = {};
+
+  private:
+    static void add(std::atomic<uint64_t> &counter, uint64_t value) {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+};
+
+// Per-API call counts and latency histograms for the tracing layer's
+// statistics mode. APIs are identified by a dense index (see
+// ZEL_TRACER_API_INDEX); each thread records into its own histograms, which
+// it allocates on its first call of an API, so recording takes no lock and
+// no read-modify-write. When a thread exits, its histograms are folded into
+// a retired aggregate and freed, so memory follows the live threads rather
+// than every thread that ever made a call. reset() bumps an epoch: a thread
+// clears its own histograms on its next call, and snapshots skip threads,
+// and a retired aggregate, that have not been updated since.
+class ApiLatencyStats {
+  public:
+    explicit ApiLatencyStats(size_t apiCount);
+    ~ApiLatencyStats();
+
+    ApiLatencyStats(const ApiLatencyStats &) = delete;
+    ApiLatencyStats &operator=(const ApiLatencyStats &) = delete;
+
+    void record(size_t apiIndex, const char *name, uint64_t ns) {
+        ThreadStats *stats = threadStats();
+        const uint64_t current = epoch.load(std::memory_order_relaxed);
+        if (stats->epoch.load(std::memory_order_relaxed) != current) {
+            stats->clear();
+            stats->epoch.store(current, std::memory_order_release);
+        }
+        LatencyHistogram *histogram = stats->histograms[apiIndex].load(std::memory_order_relaxed);
+        if (!histogram) {
+            histogram = addHistogram(*stats, apiIndex, name);
+        }
+        histogram->record(ns);
+    }
+
+    // Statistics of every API called since the last reset, ordered by API
+    // index.
+    std::vector<zel_api_latency_stats_t> snapshot() const;
+    void reset();
+
+    // Threads that have recorded and not exited yet.
+    size_t liveThreadCount() const;
+
+  private:
+    struct ThreadStats {
+        ThreadStats(size_t apiCount, uint64_t epoch);
+        ~ThreadStats();
+        void clear();
+
+        const size_t apiCount;
+        std::atomic<uint64_t> epoch;
+        std::unique_ptr<std::atomic<LatencyHistogram *>[]> histograms;
+    };
+
+    ThreadStats *threadStats() {
+        if (void *stats = threadStates.get()) {
+            return static_cast<ThreadStats *>(stats);
+        }
+        return registerThread();
+    }
+    ThreadStats *registerThread();
+    static void threadExited(void *owner, void *stats);
+    void accumulate(const ThreadStats &stats, std::vector<zel_api_latency_stats_t> &merged,
+                    std::vector<uint64_t> &buckets, std::vector<uint64_t> &counts) const;
+    LatencyHistogram *addHistogram(ThreadStats &stats, size_t apiIndex, const char *name);
+
+    const size_t apiCount;
+    std::atomic<uint64_t> epoch{1};
+    std::unique_ptr<std::atomic<const char *>[]> names;
+    mutable std::mutex threadsMutex;
+    std::vector<std::unique_ptr<ThreadStats>> threads;
+    ThreadStats retired; // guarded by threadsMutex
+    PerThreadState threadStates{this, &ApiLatencyStats::threadExited};
+};
+
+// Set while the tracing layer is loaded with the statistics mode enabled,
+// nullptr otherwise.
+extern ApiLatencyStats *pApiLatencyStats;
+
+// Returns a new ApiLatencyStats if ZEL_TRACING_LATENCY_STATS is set, nullptr
+// otherwise.
+ApiLatencyStats *createApiLatencyStats(size_t apiCount);
+
+} // namespace tracing_layer
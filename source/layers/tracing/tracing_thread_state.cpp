@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "tracing_thread_state.h"
+
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+
+namespace tracing_layer {
+
+namespace {
+
+// Objects whose onThreadExit may still be called. Never destroyed: threads
+// can exit after the layer's static destructors have run.
+struct Registry {
+    std::mutex mutex;
+    std::unordered_map<uint64_t, PerThreadState *> live;
+    uint64_t nextId = 1;
+};
+
+Registry &registry() {
+    static Registry *instance = new Registry();
+    return *instance;
+}
+
+} // namespace
+
+// The calling thread's state in each object it has called into. An id of 0
+// marks a free entry.
+struct ThreadStateTable {
+    struct Entry {
+        uint64_t id;
+        void *state;
+    };
+    static constexpr size_t entryCount = 4;
+
+    ~ThreadStateTable() {
+        Registry &reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        for (Entry &entry : entries) {
+            retireLocked(reg, entry);
+        }
+    }
+
+    static void retireLocked(Registry &reg, Entry &entry) {
+        if (entry.id == 0) {
+            return;
+        }
+        auto it = reg.live.find(entry.id);
+        if (it != reg.live.end() && it->second->onThreadExit) {
+            it->second->onThreadExit(it->second->owner, entry.state);
+        }
+        entry = Entry{0, nullptr};
+    }
+
+    Entry entries[entryCount] = {};
+};
+
+namespace {
+
+thread_local ThreadStateTable threadStateTable;
+
+uint64_t registerOwner(PerThreadState *state) {
+    Registry &reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    const uint64_t id = reg.nextId++;
+    reg.live.emplace(id, state);
+    return id;
+}
+
+} // namespace
+
+PerThreadState::PerThreadState(void *owner, ExitCallback onThreadExit)
+    : owner(owner), onThreadExit(onThreadExit), id(registerOwner(this)) {}
+
+PerThreadState::~PerThreadState() {
+    close();
+}
+
+void PerThreadState::close() {
+    Registry &reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.live.erase(id);
+}
+
+void *PerThreadState::get() const {
+    for (const ThreadStateTable::Entry &entry : threadStateTable.entries) {
+        if (entry.id == id) {
+            return entry.state;
+        }
+    }
+    return nullptr;
+}
+
+void PerThreadState::set(void *state) {
+    ThreadStateTable &table = threadStateTable;
+    Registry &reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    ThreadStateTable::Entry *slot = nullptr;
+    for (auto &entry : table.entries) {
+        if (entry.id == id) {
+            slot = &entry;
+            break;
+        }
+    }
+    // Otherwise take a free entry or one of a destroyed object; with all
+    // entries in use, the first one is retired as if the thread had exited.
+    if (!slot) {
+        for (auto &entry : table.entries) {
+            if (entry.id == 0 || reg.live.find(entry.id) == reg.live.end()) {
+                slot = &entry;
+                break;
+            }
+        }
+    }
+    if (!slot) {
+        slot = &table.entries[0];
+        ThreadStateTable::retireLocked(reg, *slot);
+    }
+    *slot = ThreadStateTable::Entry{id, state};
+}
+
+} // namespace tracing_layer
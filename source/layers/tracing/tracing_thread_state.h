@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace tracing_layer {
+
+// Per-thread state of one object of the tracing layer, such as the Chrome
+// trace recorder's event buffers or the latency statistics' histograms.
+// get() finds the calling thread's state through a small thread_local table
+// without taking a lock. When a thread exits, the state it set on every
+// object still alive is handed to that object's onThreadExit callback, so
+// the object can fold it into its totals or release it.
+//
+// Objects are told apart by an id that is never reused, so an object
+// allocated where a destroyed one lived does not see the old one's state.
+class PerThreadState {
+  public:
+    using ExitCallback = void (*)(void *owner, void *state);
+
+    // onThreadExit may be nullptr when the owner keeps the state of exited
+    // threads as it is.
+    PerThreadState(void *owner, ExitCallback onThreadExit);
+    ~PerThreadState();
+
+    PerThreadState(const PerThreadState &) = delete;
+    PerThreadState &operator=(const PerThreadState &) = delete;
+
+    // Stops handing the state of exiting threads to the owner; once it
+    // returns, no callback is running or will run. Owners call it before
+    // tearing down anything the callback uses.
+    void close();
+
+    // The calling thread's state, or nullptr before set().
+    void *get() const;
+
+    // Sets the calling thread's state. Must not be called with a lock the
+    // owner's onThreadExit takes: it may retire another of the thread's
+    // entries when the thread_local table is full.
+    void set(void *state);
+
+  private:
+    friend struct ThreadStateTable;
+
+    void *const owner;
+    const ExitCallback onThreadExit;
+    const uint64_t id;
+};
+
+} // namespace tracing_layer
@@ -1,6 +1,6 @@
 /*
  *
- * Copyright (C) 2019-2021 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,9 +17,15 @@ namespace tracing_layer {
  */
 extern "C" BOOL APIENTRY DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpvReserved) {
     if (fdwReason == DLL_PROCESS_DETACH) {
+      finalizeChromeTraceRecorder();
+      ApiLatencyStats *latencyStats = pApiLatencyStats;
+      pApiLatencyStats = nullptr;
+      delete latencyStats;
       delete pGlobalAPITracerContextImp;
     } else if (fdwReason == DLL_PROCESS_ATTACH) {
       pGlobalAPITracerContextImp = new APITracerContextImp;
+      pChromeTraceRecorder = createChromeTraceRecorder();
+      pApiLatencyStats = createApiLatencyStats(ZEL_TRACER_API_COUNT);
     }
    return TRUE;
 }
@@ -11,6 +11,9 @@
 #include "layers/zel_tracing_ddi.h"
 #include "loader/ze_loader.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace tracing {
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zelTracerCreate(
@@ -100,6 +103,42 @@ zelLoaderGetVersion(zel_component_version_t *version)
     return ZE_RESULT_SUCCESS;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for the loader's zelGetApiLatencyStats
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_FEATURE
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelTracingLayerGetApiLatencyStats(
+    uint32_t *pCount,                               ///< [in,out] number of entries in pStats
+    zel_api_latency_stats_t *pStats,                ///< [out][optional] per-API statistics
+    ze_bool_t reset                                 ///< [in] clear the statistics after reading them
+    )
+{
+    if( nullptr == pCount )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    tracing_layer::ApiLatencyStats *latencyStats = tracing_layer::pApiLatencyStats;
+    if( nullptr == latencyStats )
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+    const std::vector<zel_api_latency_stats_t> stats = latencyStats->snapshot();
+    if( 0 == *pCount || nullptr == pStats ) {
+        *pCount = static_cast<uint32_t>(stats.size());
+        return ZE_RESULT_SUCCESS;
+    }
+
+    const uint32_t count = std::min(*pCount, static_cast<uint32_t>(stats.size()));
+    std::copy(stats.begin(), stats.begin() + count, pStats);
+    *pCount = count;
+    if( reset )
+        latencyStats->reset();
+
+    return ZE_RESULT_SUCCESS;
+}
+
 
 #if defined(__cplusplus)
 };
@@ -40,9 +40,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Global.pfnInit,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.pflags);
     }
 
@@ -80,9 +78,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Driver.pfnGet,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.ppCount,
                                                   *tracerParams.pphDrivers);
     }
@@ -124,9 +120,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Global.pfnInitDrivers,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.ppCount,
                                                   *tracerParams.pphDrivers,
                                                   *tracerParams.pdesc);
@@ -160,9 +154,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Driver.pfnGetApiVersion,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.pversion);
     }
@@ -195,9 +187,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Driver.pfnGetProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.ppDriverProperties);
     }
@@ -230,9 +220,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Driver.pfnGetIpcProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.ppIpcProperties);
     }
@@ -275,9 +263,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Driver.pfnGetExtensionProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.ppCount,
                                                   *tracerParams.ppExtensionProperties);
@@ -313,9 +299,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Driver.pfnGetExtensionFunctionAddress,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.pname,
                                                   *tracerParams.pppFunctionAddress);
@@ -350,9 +334,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Driver.pfnGetLastErrorDescription,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.pppString);
     }
@@ -383,9 +365,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_context_handle_t>(context.zeDdiTable.Driver.pfnGetDefaultContext,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver);
     }
 
@@ -425,9 +405,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Device.pfnGet,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.ppCount,
                                                   *tracerParams.pphDevices);
@@ -461,9 +439,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Device.pfnGetRootDevice,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pphRootDevice);
     }
@@ -504,9 +480,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Device.pfnGetSubDevices,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppCount,
                                                   *tracerParams.pphSubdevices);
@@ -540,9 +514,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Device.pfnGetProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppDeviceProperties);
     }
@@ -575,9 +547,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Device.pfnGetComputeProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppComputeProperties);
     }
@@ -610,9 +580,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Device.pfnGetModuleProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppModuleProperties);
     }
@@ -660,9 +628,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Device.pfnGetCommandQueueGroupProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppCount,
                                                   *tracerParams.ppCommandQueueGroupProperties);
@@ -706,9 +672,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Device.pfnGetMemoryProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppCount,
                                                   *tracerParams.ppMemProperties);
@@ -742,9 +706,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Device.pfnGetMemoryAccessProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppMemAccessProperties);
     }
@@ -786,9 +748,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Device.pfnGetCacheProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppCount,
                                                   *tracerParams.ppCacheProperties);
@@ -822,9 +782,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Device.pfnGetImageProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppImageProperties);
     }
@@ -857,9 +815,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Device.pfnGetExternalMemoryProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppExternalMemoryProperties);
     }
@@ -894,9 +850,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Device.pfnGetP2PProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.phPeerDevice,
                                                   *tracerParams.ppP2PProperties);
@@ -932,9 +886,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Device.pfnCanAccessPeer,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.phPeerDevice,
                                                   *tracerParams.pvalue);
@@ -966,9 +918,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Device.pfnGetStatus,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice);
     }
 
@@ -1009,9 +959,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Device.pfnGetGlobalTimestamps,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.phostTimestamp,
                                                   *tracerParams.pdeviceTimestamp);
@@ -1043,9 +991,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Device.pfnSynchronize,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice);
     }
 
@@ -1077,9 +1023,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Device.pfnGetAggregatedCopyOffloadIncrementValue,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pincrementValue);
     }
@@ -1114,9 +1058,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Device.pfnGetCounterBasedEventMaxValue,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pmaxValue);
     }
@@ -1154,9 +1096,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Device.pfnGetRuntimeRequirements,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppObjDesc,
                                                   *tracerParams.ppSize,
@@ -1191,9 +1131,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Device.pfnGetRuntimeRequirementsKey,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppKey);
     }
@@ -1230,9 +1168,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Device.pfnValidateRuntimeRequirements,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppRequirements,
                                                   *tracerParams.ppOut);
@@ -1268,9 +1204,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Context.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.pphContext);
@@ -1318,9 +1252,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Context.pfnCreateEx,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.pnumDevices,
@@ -1354,9 +1286,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Context.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext);
     }
 
@@ -1386,9 +1316,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Context.pfnGetStatus,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext);
     }
 
@@ -1424,9 +1352,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandQueue.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
@@ -1459,9 +1385,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandQueue.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandQueue);
     }
 
@@ -1498,9 +1422,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandQueue.pfnExecuteCommandLists,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandQueue,
                                                   *tracerParams.pnumCommandLists,
                                                   *tracerParams.pphCommandLists,
@@ -1541,9 +1463,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandQueue.pfnSynchronize,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandQueue,
                                                   *tracerParams.ptimeout);
     }
@@ -1576,9 +1496,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandQueue.pfnGetOrdinal,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandQueue,
                                                   *tracerParams.ppOrdinal);
     }
@@ -1611,9 +1529,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandQueue.pfnGetIndex,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandQueue,
                                                   *tracerParams.ppIndex);
     }
@@ -1646,9 +1562,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandQueue.pfnGetFlags,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCmdQueue,
                                                   *tracerParams.ppFlags);
     }
@@ -1681,9 +1595,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandQueue.pfnGetMode,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCmdQueue,
                                                   *tracerParams.ppMode);
     }
@@ -1716,9 +1628,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandQueue.pfnGetPriority,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCmdQueue,
                                                   *tracerParams.ppPriority);
     }
@@ -1755,9 +1665,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
@@ -1796,9 +1704,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnCreateImmediate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.paltdesc,
@@ -1831,9 +1737,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList);
     }
 
@@ -1863,9 +1767,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnClose,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList);
     }
 
@@ -1895,9 +1797,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnReset,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList);
     }
 
@@ -1938,9 +1838,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendWriteGlobalTimestamp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pdstptr,
                                                   *tracerParams.phSignalEvent,
@@ -1982,9 +1880,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnHostSynchronize,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.ptimeout);
     }
@@ -2017,9 +1913,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnGetDeviceHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pphDevice);
     }
@@ -2052,9 +1946,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnGetContextHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pphContext);
     }
@@ -2087,9 +1979,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnGetOrdinal,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.ppOrdinal);
     }
@@ -2123,9 +2013,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnImmediateGetIndex,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandListImmediate,
                                                   *tracerParams.ppIndex);
     }
@@ -2159,9 +2047,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnIsImmediate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.ppIsImmediate);
     }
@@ -2194,9 +2080,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnGetFlags,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.ppFlags);
     }
@@ -2229,9 +2113,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnImmediateGetFlags,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.ppFlags);
     }
@@ -2264,9 +2146,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnImmediateGetMode,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.ppMode);
     }
@@ -2299,9 +2179,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnImmediateGetPriority,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.ppPriority);
     }
@@ -2340,9 +2218,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendBarrier,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phSignalEvent,
                                                   *tracerParams.pnumWaitEvents,
@@ -2389,9 +2265,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendMemoryRangesBarrier,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pnumRanges,
                                                   *tracerParams.ppRangeSizes,
@@ -2429,9 +2303,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Context.pfnSystemBarrier,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice);
     }
@@ -2476,9 +2348,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendMemoryCopy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pdstptr,
                                                   *tracerParams.psrcptr,
@@ -2530,9 +2400,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendMemoryCopyWithParameters,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pdstptr,
                                                   *tracerParams.psrcptr,
@@ -2585,9 +2453,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendMemoryFill,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pptr,
                                                   *tracerParams.ppattern,
@@ -2642,9 +2508,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendMemoryFillWithParameters,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pptr,
                                                   *tracerParams.ppattern,
@@ -2710,9 +2574,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendMemoryCopyRegion,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pdstptr,
                                                   *tracerParams.pdstRegion,
@@ -2769,9 +2631,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendMemoryCopyFromContext,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pdstptr,
                                                   *tracerParams.phContextSrc,
@@ -2820,9 +2680,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendImageCopy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phDstImage,
                                                   *tracerParams.phSrcImage,
@@ -2873,9 +2731,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendImageCopyRegion,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phDstImage,
                                                   *tracerParams.phSrcImage,
@@ -2926,9 +2782,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendImageCopyToMemory,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pdstptr,
                                                   *tracerParams.phSrcImage,
@@ -2978,9 +2832,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemory,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phDstImage,
                                                   *tracerParams.psrcptr,
@@ -3020,9 +2872,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendMemoryPrefetch,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pptr,
                                                   *tracerParams.psize);
@@ -3062,9 +2912,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendMemAdvise,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pptr,
@@ -3110,9 +2958,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.EventPool.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.pnumDevices,
@@ -3146,9 +2992,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.EventPool.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEventPool);
     }
 
@@ -3182,9 +3026,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Event.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEventPool,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.pphEvent);
@@ -3222,9 +3064,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Event.pfnCounterBasedCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
@@ -3257,9 +3097,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Event.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent);
     }
 
@@ -3291,9 +3129,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.EventPool.pfnGetIpcHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEventPool,
                                                   *tracerParams.pphIpc);
     }
@@ -3327,9 +3163,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.EventPool.pfnPutIpcHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phIpc);
     }
@@ -3365,9 +3199,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.EventPool.pfnOpenIpcHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phIpc,
                                                   *tracerParams.pphEventPool);
@@ -3399,9 +3231,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.EventPool.pfnCloseIpcHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEventPool);
     }
 
@@ -3433,9 +3263,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Event.pfnCounterBasedGetIpcHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent,
                                                   *tracerParams.pphIpc);
     }
@@ -3471,9 +3299,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Event.pfnCounterBasedOpenIpcHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phIpc,
                                                   *tracerParams.pphEvent);
@@ -3505,9 +3331,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Event.pfnCounterBasedCloseIpcHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent);
     }
 
@@ -3541,9 +3365,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Event.pfnCounterBasedGetDeviceAddress,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent,
                                                   *tracerParams.pcompletionValue,
                                                   *tracerParams.pdeviceAddress);
@@ -3577,9 +3399,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendSignalEvent,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phEvent);
     }
@@ -3615,9 +3435,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendWaitOnEvents,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pnumEvents,
                                                   *tracerParams.pphEvents);
@@ -3649,9 +3467,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Event.pfnHostSignal,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent);
     }
 
@@ -3689,9 +3505,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Event.pfnHostSynchronize,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent,
                                                   *tracerParams.ptimeout);
     }
@@ -3722,9 +3536,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Event.pfnQueryStatus,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent);
     }
 
@@ -3756,9 +3568,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendEventReset,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phEvent);
     }
@@ -3789,9 +3599,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Event.pfnHostReset,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent);
     }
 
@@ -3823,9 +3631,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Event.pfnQueryKernelTimestamp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent,
                                                   *tracerParams.pdstptr);
     }
@@ -3875,9 +3681,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendQueryKernelTimestamps,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pnumEvents,
                                                   *tracerParams.pphEvents,
@@ -3916,9 +3720,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Event.pfnGetEventPool,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent,
                                                   *tracerParams.pphEventPool);
     }
@@ -3953,9 +3755,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Event.pfnGetSignalScope,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent,
                                                   *tracerParams.ppSignalScope);
     }
@@ -3990,9 +3790,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Event.pfnGetWaitScope,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent,
                                                   *tracerParams.ppWaitScope);
     }
@@ -4025,9 +3823,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.EventPool.pfnGetContextHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEventPool,
                                                   *tracerParams.pphContext);
     }
@@ -4061,9 +3857,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.EventPool.pfnGetFlags,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEventPool,
                                                   *tracerParams.ppFlags);
     }
@@ -4097,9 +3891,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Event.pfnGetCounterBasedFlags,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent,
                                                   *tracerParams.ppFlags);
     }
@@ -4134,9 +3926,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Fence.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandQueue,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.pphFence);
@@ -4168,9 +3958,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Fence.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phFence);
     }
 
@@ -4208,9 +3996,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Fence.pfnHostSynchronize,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phFence,
                                                   *tracerParams.ptimeout);
     }
@@ -4241,9 +4027,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Fence.pfnQueryStatus,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phFence);
     }
 
@@ -4273,9 +4057,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Fence.pfnReset,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phFence);
     }
 
@@ -4309,9 +4091,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Image.pfnGetProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.ppImageProperties);
@@ -4349,9 +4129,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Image.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
@@ -4384,9 +4162,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Image.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phImage);
     }
 
@@ -4430,9 +4206,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Mem.pfnAllocShared,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pdevice_desc,
                                                   *tracerParams.phost_desc,
@@ -4480,9 +4254,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Mem.pfnAllocDevice,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pdevice_desc,
                                                   *tracerParams.psize,
@@ -4527,9 +4299,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Mem.pfnAllocHost,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phost_desc,
                                                   *tracerParams.psize,
@@ -4565,9 +4335,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Mem.pfnFree,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr);
     }
@@ -4604,9 +4372,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Mem.pfnGetAllocProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr,
                                                   *tracerParams.ppMemAllocProperties,
@@ -4645,9 +4411,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Mem.pfnGetAddressRange,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr,
                                                   *tracerParams.ppBase,
@@ -4684,9 +4448,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Mem.pfnGetIpcHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr,
                                                   *tracerParams.ppIpcHandle);
@@ -4722,9 +4484,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.MemExp.pfnGetIpcHandleFromFileDescriptorExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phandle,
                                                   *tracerParams.ppIpcHandle);
@@ -4760,9 +4520,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.MemExp.pfnGetFileDescriptorFromIpcHandleExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pipcHandle,
                                                   *tracerParams.ppHandle);
@@ -4796,9 +4554,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Mem.pfnPutIpcHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phandle);
     }
@@ -4838,9 +4594,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Mem.pfnOpenIpcHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.phandle,
@@ -4876,9 +4630,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Mem.pfnCloseIpcHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr);
     }
@@ -4918,9 +4670,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.MemExp.pfnSetAtomicAccessAttributeExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pptr,
@@ -4962,9 +4712,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.MemExp.pfnGetAtomicAccessAttributeExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pptr,
@@ -5006,9 +4754,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Module.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
@@ -5042,9 +4788,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Module.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phModule);
     }
 
@@ -5079,9 +4823,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Module.pfnDynamicLink,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.pnumModules,
                                                   *tracerParams.pphModules,
                                                   *tracerParams.pphLinkLog);
@@ -5113,9 +4855,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.ModuleBuildLog.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phModuleBuildLog);
     }
 
@@ -5149,9 +4889,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.ModuleBuildLog.pfnGetString,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phModuleBuildLog,
                                                   *tracerParams.ppSize,
                                                   *tracerParams.ppBuildLog);
@@ -5187,9 +4925,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Module.pfnGetNativeBinary,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phModule,
                                                   *tracerParams.ppSize,
                                                   *tracerParams.ppModuleNativeBinary);
@@ -5227,9 +4963,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Module.pfnGetGlobalPointer,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phModule,
                                                   *tracerParams.ppGlobalName,
                                                   *tracerParams.ppSize,
@@ -5272,9 +5006,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Module.pfnGetKernelNames,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phModule,
                                                   *tracerParams.ppCount,
                                                   *tracerParams.ppNames);
@@ -5308,9 +5040,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Module.pfnGetProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phModule,
                                                   *tracerParams.ppModuleProperties);
     }
@@ -5345,9 +5075,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Kernel.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phModule,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.pphKernel);
@@ -5379,9 +5107,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Kernel.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel);
     }
 
@@ -5415,9 +5141,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Module.pfnGetFunctionPointer,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phModule,
                                                   *tracerParams.ppFunctionName,
                                                   *tracerParams.ppfnFunction);
@@ -5455,9 +5179,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Kernel.pfnSetGroupSize,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.pgroupSizeX,
                                                   *tracerParams.pgroupSizeY,
@@ -5502,9 +5224,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Kernel.pfnSuggestGroupSize,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.pglobalSizeX,
                                                   *tracerParams.pglobalSizeY,
@@ -5542,9 +5262,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Kernel.pfnSuggestMaxCooperativeGroupCount,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.ptotalGroupCount);
     }
@@ -5582,9 +5300,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Kernel.pfnSetArgumentValue,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.pargIndex,
                                                   *tracerParams.pargSize,
@@ -5619,9 +5335,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Kernel.pfnSetIndirectAccess,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.pflags);
     }
@@ -5654,9 +5368,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Kernel.pfnGetIndirectAccess,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.ppFlags);
     }
@@ -5702,9 +5414,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Kernel.pfnGetSourceAttributes,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.ppSize,
                                                   *tracerParams.ppString);
@@ -5739,9 +5449,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Kernel.pfnSetCacheConfig,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.pflags);
     }
@@ -5774,9 +5482,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Kernel.pfnGetProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.ppKernelProperties);
     }
@@ -5812,9 +5518,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Kernel.pfnGetName,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.ppSize,
                                                   *tracerParams.ppName);
@@ -5858,9 +5562,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendLaunchKernel,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.ppLaunchFuncArgs,
@@ -5909,9 +5611,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendLaunchKernelWithParameters,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.ppGroupCounts,
@@ -5965,9 +5665,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendLaunchKernelWithArguments,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.pgroupCounts,
@@ -6017,9 +5715,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendLaunchCooperativeKernel,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.ppLaunchFuncArgs,
@@ -6067,9 +5763,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendLaunchKernelIndirect,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.ppLaunchArgumentsBuffer,
@@ -6123,9 +5817,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendLaunchMultipleKernelsIndirect,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pnumKernels,
                                                   *tracerParams.pphKernels,
@@ -6168,9 +5860,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Context.pfnMakeMemoryResident,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pptr,
@@ -6209,9 +5899,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Context.pfnEvictMemory,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pptr,
@@ -6248,9 +5936,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Context.pfnMakeImageResident,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.phImage);
@@ -6286,9 +5972,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Context.pfnEvictImage,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.phImage);
@@ -6326,9 +6010,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Sampler.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
@@ -6361,9 +6043,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Sampler.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phSampler);
     }
 
@@ -6400,9 +6080,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.VirtualMem.pfnReserve,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.ppStart,
                                                   *tracerParams.psize,
@@ -6439,9 +6117,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.VirtualMem.pfnFree,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr,
                                                   *tracerParams.psize);
@@ -6480,9 +6156,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.VirtualMem.pfnQueryPageSize,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.psize,
@@ -6519,9 +6193,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.PhysicalMem.pfnGetProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phPhysicalMem,
                                                   *tracerParams.ppMemProperties);
@@ -6560,9 +6232,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.PhysicalMem.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
@@ -6597,9 +6267,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.PhysicalMem.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phPhysicalMemory);
     }
@@ -6643,9 +6311,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.VirtualMem.pfnMap,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr,
                                                   *tracerParams.psize,
@@ -6684,9 +6350,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.VirtualMem.pfnUnmap,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr,
                                                   *tracerParams.psize);
@@ -6725,9 +6389,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.VirtualMem.pfnSetAccessAttribute,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr,
                                                   *tracerParams.psize,
@@ -6769,9 +6431,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.VirtualMem.pfnGetAccessAttribute,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr,
                                                   *tracerParams.psize,
@@ -6811,9 +6471,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.KernelExp.pfnSetGlobalOffsetExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.poffsetX,
                                                   *tracerParams.poffsetY,
@@ -6853,9 +6511,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Device.pfnReserveCacheExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pcacheLevel,
                                                   *tracerParams.pcacheReservationSize);
@@ -6893,9 +6549,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Device.pfnSetCacheAdviceExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pptr,
                                                   *tracerParams.pregionSize,
@@ -6940,9 +6594,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.EventExp.pfnQueryTimestampsExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppCount,
@@ -6977,9 +6629,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.ImageExp.pfnGetMemoryPropertiesExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phImage,
                                                   *tracerParams.ppMemoryProperties);
     }
@@ -7018,9 +6668,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Image.pfnViewCreateExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
@@ -7062,9 +6710,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.ImageExp.pfnViewCreateExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
@@ -7100,9 +6746,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.KernelExp.pfnSchedulingHintExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.ppHint);
     }
@@ -7135,9 +6779,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Device.pfnPciGetPropertiesExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppPciProperties);
     }
@@ -7188,9 +6830,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendImageCopyToMemoryExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pdstptr,
                                                   *tracerParams.phSrcImage,
@@ -7248,9 +6888,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemoryExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phDstImage,
                                                   *tracerParams.psrcptr,
@@ -7292,9 +6930,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Image.pfnGetAllocPropertiesExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phImage,
                                                   *tracerParams.ppImageAllocProperties);
@@ -7334,9 +6970,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Module.pfnInspectLinkageExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.ppInspectDesc,
                                                   *tracerParams.pnumModules,
                                                   *tracerParams.pphModules,
@@ -7373,9 +7007,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Mem.pfnFreeExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.ppMemFreeDesc,
                                                   *tracerParams.pptr);
@@ -7418,9 +7050,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.FabricVertexExp.pfnGetExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.ppCount,
                                                   *tracerParams.pphVertices);
@@ -7463,9 +7093,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.FabricVertexExp.pfnGetSubVerticesExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phVertex,
                                                   *tracerParams.ppCount,
                                                   *tracerParams.pphSubvertices);
@@ -7499,9 +7127,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.FabricVertexExp.pfnGetPropertiesExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phVertex,
                                                   *tracerParams.ppVertexProperties);
     }
@@ -7534,9 +7160,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.FabricVertexExp.pfnGetDeviceExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phVertex,
                                                   *tracerParams.pphDevice);
     }
@@ -7569,9 +7193,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.DeviceExp.pfnGetFabricVertexExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pphVertex);
     }
@@ -7615,9 +7237,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.FabricEdgeExp.pfnGetExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phVertexA,
                                                   *tracerParams.phVertexB,
                                                   *tracerParams.ppCount,
@@ -7654,9 +7274,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.FabricEdgeExp.pfnGetVerticesExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEdge,
                                                   *tracerParams.pphVertexA,
                                                   *tracerParams.pphVertexB);
@@ -7690,9 +7308,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.FabricEdgeExp.pfnGetPropertiesExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEdge,
                                                   *tracerParams.ppEdgeProperties);
     }
@@ -7742,9 +7358,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Event.pfnQueryKernelTimestampsExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppCount,
@@ -7781,9 +7395,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.RTASBuilderExp.pfnCreateExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.ppDescriptor,
                                                   *tracerParams.pphBuilder);
@@ -7819,9 +7431,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.RTASBuilderExp.pfnGetBuildPropertiesExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phBuilder,
                                                   *tracerParams.ppBuildOpDescriptor,
                                                   *tracerParams.ppProperties);
@@ -7857,9 +7467,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.DriverExp.pfnRTASFormatCompatibilityCheckExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.prtasFormatA,
                                                   *tracerParams.prtasFormatB);
@@ -7912,9 +7520,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.RTASBuilderExp.pfnBuildExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phBuilder,
                                                   *tracerParams.ppBuildOpDescriptor,
                                                   *tracerParams.ppScratchBuffer,
@@ -7953,9 +7559,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.RTASBuilderExp.pfnDestroyExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phBuilder);
     }
 
@@ -7987,9 +7591,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.RTASParallelOperationExp.pfnCreateExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.pphParallelOperation);
     }
@@ -8022,9 +7624,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.RTASParallelOperationExp.pfnGetPropertiesExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phParallelOperation,
                                                   *tracerParams.ppProperties);
     }
@@ -8055,9 +7655,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.RTASParallelOperationExp.pfnJoinExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phParallelOperation);
     }
 
@@ -8087,9 +7685,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.RTASParallelOperationExp.pfnDestroyExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phParallelOperation);
     }
 
@@ -8129,9 +7725,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Mem.pfnGetPitchFor2dImage,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pimageWidth,
@@ -8168,9 +7762,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.ImageExp.pfnGetDeviceOffsetExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phImage,
                                                   *tracerParams.ppDeviceOffset);
     }
@@ -8203,9 +7795,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandListExp.pfnCreateCloneExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pphClonedCommandList);
     }
@@ -8252,9 +7842,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandListExp.pfnImmediateAppendCommandListsExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandListImmediate,
                                                   *tracerParams.pnumCommandLists,
                                                   *tracerParams.pphCommandLists,
@@ -8307,9 +7895,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnImmediateAppendCommandListsWithParameters,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandListImmediate,
                                                   *tracerParams.pnumCommandLists,
                                                   *tracerParams.pphCommandLists,
@@ -8349,9 +7935,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandListExp.pfnGetNextCommandIdExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.ppCommandId);
@@ -8393,9 +7977,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandListExp.pfnGetNextCommandIdWithKernelsExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.pnumKernels,
@@ -8432,9 +8014,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandsExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pdesc);
     }
@@ -8468,9 +8048,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandListExp.pfnIsMutableExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.ppIsMutable);
     }
@@ -8505,9 +8083,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandSignalEventExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pcommandId,
                                                   *tracerParams.phSignalEvent);
@@ -8546,9 +8122,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandWaitEventsExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pcommandId,
                                                   *tracerParams.pnumWaitEvents,
@@ -8588,9 +8162,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandKernelsExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pnumKernels,
                                                   *tracerParams.ppCommandId,
@@ -8627,9 +8199,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.KernelExp.pfnGetBinaryExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.ppSize,
                                                   *tracerParams.ppKernelBinary);
@@ -8665,9 +8235,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Device.pfnImportExternalSemaphoreExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.pphSemaphore);
@@ -8699,9 +8267,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Device.pfnReleaseExternalSemaphoreExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phSemaphore);
     }
 
@@ -8747,9 +8313,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendSignalExternalSemaphoreExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pnumSemaphores,
                                                   *tracerParams.pphSemaphores,
@@ -8801,9 +8365,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendWaitExternalSemaphoreExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pnumSemaphores,
                                                   *tracerParams.pphSemaphores,
@@ -8843,9 +8405,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.RTASBuilder.pfnCreateExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.ppDescriptor,
                                                   *tracerParams.pphBuilder);
@@ -8881,9 +8441,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.RTASBuilder.pfnGetBuildPropertiesExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phBuilder,
                                                   *tracerParams.ppBuildOpDescriptor,
                                                   *tracerParams.ppProperties);
@@ -8919,9 +8477,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Driver.pfnRTASFormatCompatibilityCheckExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.prtasFormatA,
                                                   *tracerParams.prtasFormatB);
@@ -8974,9 +8530,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.RTASBuilder.pfnBuildExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phBuilder,
                                                   *tracerParams.ppBuildOpDescriptor,
                                                   *tracerParams.ppScratchBuffer,
@@ -9031,9 +8585,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.RTASBuilder.pfnCommandListAppendCopyExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pdstptr,
                                                   *tracerParams.psrcptr,
@@ -9069,9 +8621,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.RTASBuilder.pfnDestroyExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phBuilder);
     }
 
@@ -9103,9 +8653,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.RTASParallelOperation.pfnCreateExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.pphParallelOperation);
     }
@@ -9138,9 +8686,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.RTASParallelOperation.pfnGetPropertiesExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phParallelOperation,
                                                   *tracerParams.ppProperties);
     }
@@ -9171,9 +8717,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.RTASParallelOperation.pfnJoinExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phParallelOperation);
     }
 
@@ -9203,9 +8747,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.RTASParallelOperation.pfnDestroyExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phParallelOperation);
     }
 
@@ -9246,9 +8788,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Device.pfnGetVectorWidthPropertiesExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppCount,
                                                   *tracerParams.ppVectorWidthProperties);
@@ -9292,9 +8832,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.KernelExp.pfnGetAllocationPropertiesExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.ppCount,
                                                   *tracerParams.ppAllocationProperties);
@@ -9332,9 +8870,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Mem.pfnGetIpcHandleWithProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr,
                                                   *tracerParams.ppNext,
@@ -9372,9 +8908,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Graph.pfnCreateExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.ppNext,
                                                   *tracerParams.pphGraph);
@@ -9409,9 +8943,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnBeginGraphCaptureExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.ppNext);
     }
@@ -9447,9 +8979,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnBeginCaptureIntoGraphExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phGraph,
                                                   *tracerParams.ppNext);
@@ -9481,9 +9011,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnIsGraphCaptureEnabledExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList);
     }
 
@@ -9518,9 +9046,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnEndGraphCaptureExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.ppNext,
                                                   *tracerParams.pphGraph);
@@ -9554,9 +9080,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnGetGraphExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pphGraph);
     }
@@ -9590,9 +9114,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Graph.pfnGetPrimaryCommandListExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phGraph,
                                                   *tracerParams.pphCommandList);
     }
@@ -9630,9 +9152,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Graph.pfnSetDestructionCallbackExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phGraph,
                                                   *tracerParams.ppfnCallback,
                                                   *tracerParams.ppUserData,
@@ -9670,9 +9190,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Graph.pfnInstantiateExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phGraph,
                                                   *tracerParams.ppNext,
                                                   *tracerParams.pphExecutableGraph);
@@ -9717,9 +9235,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendGraphExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phGraph,
                                                   *tracerParams.ppNext,
@@ -9756,9 +9272,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.ExecutableGraph.pfnGetSourceGraphExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phGraph,
                                                   *tracerParams.pphSourceGraph);
     }
@@ -9789,9 +9303,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Graph.pfnIsEmptyExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phGraph);
     }
 
@@ -9826,9 +9338,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Graph.pfnDumpContentsExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phGraph,
                                                   *tracerParams.pfilePath,
                                                   *tracerParams.ppNext);
@@ -9860,9 +9370,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.ExecutableGraph.pfnDestroyExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phGraph);
     }
 
@@ -9892,9 +9400,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.Graph.pfnDestroyExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phGraph);
     }
 
@@ -9940,9 +9446,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zeDdiTable.CommandList.pfnAppendHostFunction,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.ppfnHostFunction,
                                                   *tracerParams.ppUserData,
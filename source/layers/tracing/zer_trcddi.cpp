@@ -40,9 +40,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_result_t>(context.zerDdiTable.Global.pfnGetLastErrorDescription,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.pppString);
     }
 
@@ -72,9 +70,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<uint32_t>(context.zerDdiTable.Global.pfnTranslateDeviceHandleToIdentifier,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice);
     }
 
@@ -104,9 +100,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_device_handle_t>(context.zerDdiTable.Global.pfnTranslateIdentifierToDeviceHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.pidentifier);
     }
 
@@ -135,9 +129,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp<ze_context_handle_t>(context.zerDdiTable.Global.pfnGetDefaultContext,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks);
+                                                  apiCallbackData);
     }
 
 } // namespace tracing_layer
@@ -28,7 +28,7 @@ namespace validation_layer
             basic_leak_checker.zetValidation = zetChecker;
             basic_leak_checker.zesValidation = zesChecker;
             basic_leak_checker.zerValidation = zerChecker;
-            validation_layer::context.getInstance().validationHandlers.push_back(&basic_leak_checker);
+            validation_layer::context.getInstance().registerChecker(zeChecker, zesChecker, zetChecker, zerChecker);
         }
     }
 
@@ -41,8 +41,8 @@ certificationChecker::certificationChecker() {
     certification_checker.zetValidation = zetChecker;
     certification_checker.zesValidation = zesChecker;
     certification_checker.zerValidation = zerChecker;
-    validation_layer::context.getInstance().validationHandlers.push_back(
-        &certification_checker);
+    validation_layer::context.getInstance().registerChecker(
+        zeChecker, zesChecker, zetChecker, zerChecker);
   }
 }
 
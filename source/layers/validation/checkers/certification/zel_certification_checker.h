@@ -25,6 +25,7 @@ public:
   certificationChecker();
   ~certificationChecker();
   class ZEcertificationChecker : public ZEcertificationCheckerGenerated {
+  public:
     ze_result_t zeDriverGetApiVersionEpilogue(ze_driver_handle_t hDriver,
                                               ze_api_version_t *version,
                                               ze_result_t result) override;
@@ -10,6 +10,8 @@
 
 #include <iostream>
 #include <sstream>
+#include <utility>
+#include <vector>
 
 namespace validation_layer {
 class eventsChecker events_checker;
@@ -27,7 +29,7 @@ eventsChecker::eventsChecker() {
         events_checker.zetValidation = zetChecker;
         events_checker.zerValidation = zerChecker;
 
-        validation_layer::context.getInstance().validationHandlers.push_back(&events_checker);
+        validation_layer::context.getInstance().registerChecker(zeChecker, zesChecker, zetChecker, zerChecker);
     }
 }
 
@@ -63,9 +65,14 @@ eventsChecker::ZEeventsChecker::zeEventDestroyEpilogue(
         return ZE_RESULT_SUCCESS;
     }
 
-    if (eventToDagID.find(hEvent) != eventToDagID.end()) {
-        // Delete event from eventToDagID but not from the dagIDToAction map as it may be needed for printing the discription of the action when printing path in the DAG.
-        eventToDagID.erase(hEvent);
+    auto it = eventToDagID.find(hEvent);
+    if (it != eventToDagID.end()) {
+        // Nothing can signal or wait on a destroyed event anymore, so its node can go.
+        if (it->second != invalidDagID) {
+            retireDagNode(it->second);
+        }
+        eventToDagID.erase(it);
+        compactDagIfNeeded();
     }
 
     return ZE_RESULT_SUCCESS;
@@ -83,7 +90,7 @@ eventsChecker::ZEeventsChecker::zeCommandListAppendMemoryCopyPrologue(
     ze_event_handle_t *phWaitEvents        ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
                                            ///< on before launching
 ) {
-    checkForDeadlock("zeCommandListAppendMemoryCopy", hSignalEvent, numWaitEvents, phWaitEvents);
+    checkForDeadlock("zeCommandListAppendMemoryCopy", hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -98,7 +105,7 @@ eventsChecker::ZEeventsChecker::zeCommandListAppendWriteGlobalTimestampPrologue(
     ze_event_handle_t *phWaitEvents        ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
                                            ///< on before executing query
 ) {
-    checkForDeadlock("zeCommandListAppendWriteGlobalTimestamp", hSignalEvent, numWaitEvents, phWaitEvents);
+    checkForDeadlock("zeCommandListAppendWriteGlobalTimestamp", hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -111,7 +118,7 @@ eventsChecker::ZEeventsChecker::zeCommandListAppendBarrierPrologue(
     ze_event_handle_t *phWaitEvents        ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
                                            ///< on before executing barrier
 ) {
-    checkForDeadlock("zeCommandListAppendBarrier", hSignalEvent, numWaitEvents, phWaitEvents);
+    checkForDeadlock("zeCommandListAppendBarrier", hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -127,7 +134,7 @@ eventsChecker::ZEeventsChecker::zeCommandListAppendMemoryRangesBarrierPrologue(
     ze_event_handle_t *phWaitEvents        ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
                                            ///< on before executing barrier
 ) {
-    checkForDeadlock("zeCommandListAppendMemoryRangesBarrier", hSignalEvent, numWaitEvents, phWaitEvents);
+    checkForDeadlock("zeCommandListAppendMemoryRangesBarrier", hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -144,7 +151,7 @@ eventsChecker::ZEeventsChecker::zeCommandListAppendMemoryFillPrologue(
     ze_event_handle_t *phWaitEvents        ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
                                            ///< on before launching
 ) {
-    checkForDeadlock("zeCommandListAppendMemoryFill", hSignalEvent, numWaitEvents, phWaitEvents);
+    checkForDeadlock("zeCommandListAppendMemoryFill", hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -169,7 +176,7 @@ eventsChecker::ZEeventsChecker::zeCommandListAppendMemoryCopyRegionPrologue(
     ze_event_handle_t *phWaitEvents        ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
                                            ///< on before launching
 ) {
-    checkForDeadlock("zeCommandListAppendMemoryCopyRegion", hSignalEvent, numWaitEvents, phWaitEvents);
+    checkForDeadlock("zeCommandListAppendMemoryCopyRegion", hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -186,7 +193,7 @@ eventsChecker::ZEeventsChecker::zeCommandListAppendMemoryCopyFromContextPrologue
     ze_event_handle_t *phWaitEvents        ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
                                            ///< on before launching
 ) {
-    checkForDeadlock("zeCommandListAppendMemoryCopyFromContext", hSignalEvent, numWaitEvents, phWaitEvents);
+    checkForDeadlock("zeCommandListAppendMemoryCopyFromContext", hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -201,7 +208,7 @@ eventsChecker::ZEeventsChecker::zeCommandListAppendImageCopyPrologue(
     ze_event_handle_t *phWaitEvents        ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
                                            ///< on before launching
 ) {
-    checkForDeadlock("zeCommandListAppendImageCopy", hSignalEvent, numWaitEvents, phWaitEvents);
+    checkForDeadlock("zeCommandListAppendImageCopy", hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -218,7 +225,7 @@ eventsChecker::ZEeventsChecker::zeCommandListAppendImageCopyRegionPrologue(
     ze_event_handle_t *phWaitEvents        ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
                                            ///< on before launching
 ) {
-    checkForDeadlock("zeCommandListAppendImageCopyRegion", hSignalEvent, numWaitEvents, phWaitEvents);
+    checkForDeadlock("zeCommandListAppendImageCopyRegion", hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -234,7 +241,7 @@ eventsChecker::ZEeventsChecker::zeCommandListAppendImageCopyToMemoryPrologue(
     ze_event_handle_t *phWaitEvents        ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
                                            ///< on before launching
 ) {
-    checkForDeadlock("zeCommandListAppendImageCopyToMemory", hSignalEvent, numWaitEvents, phWaitEvents);
+    checkForDeadlock("zeCommandListAppendImageCopyToMemory", hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -250,7 +257,7 @@ eventsChecker::ZEeventsChecker::zeCommandListAppendImageCopyFromMemoryPrologue(
     ze_event_handle_t *phWaitEvents        ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
                                            ///< on before launching
 ) {
-    checkForDeadlock("zeCommandListAppendImageCopyFromMemory", hSignalEvent, numWaitEvents, phWaitEvents);
+    checkForDeadlock("zeCommandListAppendImageCopyFromMemory", hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -259,7 +266,7 @@ eventsChecker::ZEeventsChecker::zeCommandListAppendSignalEventPrologue(
     ze_command_list_handle_t hCommandList, ///< [in] handle of the command list
     ze_event_handle_t hEvent               ///< [in] handle of the event
 ) {
-    checkForDeadlock("zeCommandListAppendSignalEvent", hEvent, 0, nullptr);
+    checkForDeadlock("zeCommandListAppendSignalEvent", hCommandList, hEvent, 0, nullptr);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -270,7 +277,7 @@ eventsChecker::ZEeventsChecker::zeCommandListAppendWaitOnEventsPrologue(
     ze_event_handle_t *phEvents            ///< [in][range(0, numEvents)] handles of the events to wait on before
                                            ///< continuing
 ) {
-    checkForDeadlock("zeCommandListAppendWaitOnEvents", nullptr, numEvents, phEvents);
+    checkForDeadlock("zeCommandListAppendWaitOnEvents", hCommandList, nullptr, numEvents, phEvents);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -278,7 +285,7 @@ ze_result_t
 eventsChecker::ZEeventsChecker::zeEventHostSignalPrologue(
     ze_event_handle_t hEvent ///< [in] handle of the event
 ) {
-    checkForDeadlock("zeEventHostSignal", hEvent, 0, nullptr);
+    checkForDeadlock("zeEventHostSignal", nullptr, hEvent, 0, nullptr);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -294,14 +301,153 @@ void eventsChecker::ZEeventsChecker::resetEventInEventToDagID(
     }
 
     if (it->second != invalidDagID) {
+        retireDagNode(it->second);
+        it->second = invalidDagID; // Reset
+        compactDagIfNeeded();
+    }
+}
 
-        auto action = dagIDToAction.find(it->second);
+void eventsChecker::ZEeventsChecker::retireDagNode(uint32_t dagID) {
+    // Any path that went through this node must survive its removal, otherwise a later cycle
+    // closing through it would go unnoticed. The bridging edges cannot form a cycle.
+    const auto predecessors = dag.PredecessorsCopy(dagID);
+    const auto successors = dag.SuccessorsCopy(dagID);
+    for (const int32_t from : predecessors) {
+        for (const int32_t to : successors) {
+            addEdgeInDag(from, to);
+        }
+    }
+
+    dag.RemoveNode(dagID);
+    dagIDToAction.erase(dagID);
+    clearDagIDOwner(dagID);
+    retiredDagNodes++;
+}
+
+void eventsChecker::ZEeventsChecker::retireCommandList(ze_command_list_handle_t hCommandList) {
+    auto owned = commandListToDagIDs.find(hCommandList);
+    if (owned == commandListToDagIDs.end()) {
+        return;
+    }
+    const std::unordered_set<uint32_t> dagIDs = std::move(owned->second);
+    commandListToDagIDs.erase(owned);
+
+    // The actions and the events they waited on are gone with the command list.
+    std::vector<std::pair<uint32_t, ze_event_handle_t>> signalEvents;
+    signalEvents.reserve(dagIDs.size());
+    for (const uint32_t dagID : dagIDs) {
+        dagIDToCommandList.erase(dagID);
+        for (const int32_t from : dag.PredecessorsCopy(dagID)) {
+            dag.RemoveEdge(from, dagID);
+        }
+        auto action = dagIDToAction.find(dagID);
         if (action != dagIDToAction.end()) {
-            action->second.second = invalidEventAddress; // Reset
+            signalEvents.emplace_back(dagID, action->second.second);
+            dagIDToAction.erase(action);
+        } else {
+            signalEvents.emplace_back(dagID, nullptr);
+        }
+    }
+
+    for (const auto &signalEvent : signalEvents) {
+        const uint32_t dagID = signalEvent.first;
+        if (!dag.Successors(dagID).empty()) {
+            // Actions outside this command list still wait on the event; keep the node as a placeholder for the next signaler.
+            continue;
         }
+        dag.RemoveNode(dagID);
+        retiredDagNodes++;
+        auto event = eventToDagID.find(signalEvent.second);
+        if (event != eventToDagID.end() && event->second == dagID) {
+            event->second = invalidDagID;
+        }
+    }
+}
 
-        it->second = invalidDagID; // Reset
+void eventsChecker::ZEeventsChecker::compactDagIfNeeded() {
+    if (retiredDagNodes < dagCompactionThreshold || retiredDagNodes < static_cast<uint32_t>(dag.NumNodes())) {
+        return;
+    }
+    retiredDagNodes = 0;
+
+    const std::vector<int32_t> remap = dag.Compact();
+    auto translate = [&remap](uint32_t dagID) { return static_cast<uint32_t>(remap[dagID]); };
+
+    // Rebuild rather than update in place so the maps also give back the buckets of erased entries.
+    std::unordered_map<ze_event_handle_t, uint32_t> events(eventToDagID.size());
+    for (const auto &entry : eventToDagID) {
+        events.emplace(entry.first, entry.second == invalidDagID ? invalidDagID : translate(entry.second));
+    }
+    eventToDagID.swap(events);
+
+    std::unordered_map<uint32_t, actionAndSignalEvent> actions(dagIDToAction.size());
+    for (auto &entry : dagIDToAction) {
+        actions.emplace(translate(entry.first), std::move(entry.second));
+    }
+    dagIDToAction.swap(actions);
+
+    std::unordered_map<uint32_t, ze_command_list_handle_t> owners(dagIDToCommandList.size());
+    for (const auto &entry : dagIDToCommandList) {
+        owners.emplace(translate(entry.first), entry.second);
+    }
+    dagIDToCommandList.swap(owners);
+
+    for (auto &entry : commandListToDagIDs) {
+        std::unordered_set<uint32_t> dagIDs(entry.second.size());
+        for (const uint32_t dagID : entry.second) {
+            dagIDs.insert(translate(dagID));
+        }
+        entry.second.swap(dagIDs);
+    }
+}
+
+void eventsChecker::ZEeventsChecker::setDagIDOwner(uint32_t dagID, ze_command_list_handle_t hCommandList) {
+    clearDagIDOwner(dagID);
+    if (hCommandList != nullptr) {
+        dagIDToCommandList[dagID] = hCommandList;
+        commandListToDagIDs[hCommandList].insert(dagID);
+    }
+}
+
+void eventsChecker::ZEeventsChecker::clearDagIDOwner(uint32_t dagID) {
+    auto owner = dagIDToCommandList.find(dagID);
+    if (owner == dagIDToCommandList.end()) {
+        return;
+    }
+    auto owned = commandListToDagIDs.find(owner->second);
+    if (owned != commandListToDagIDs.end()) {
+        owned->second.erase(dagID);
+        if (owned->second.empty()) {
+            commandListToDagIDs.erase(owned);
+        }
+    }
+    dagIDToCommandList.erase(owner);
+}
+
+ze_result_t
+eventsChecker::ZEeventsChecker::zeCommandListResetEpilogue(
+    ze_command_list_handle_t hCommandList, ///< [in] handle of command list object to reset
+    ze_result_t result
+) {
+    if (result != ZE_RESULT_SUCCESS) {
+        return ZE_RESULT_SUCCESS;
     }
+    retireCommandList(hCommandList);
+    compactDagIfNeeded();
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t
+eventsChecker::ZEeventsChecker::zeCommandListDestroyEpilogue(
+    ze_command_list_handle_t hCommandList, ///< [in][release] handle of command list object to destroy
+    ze_result_t result
+) {
+    if (result != ZE_RESULT_SUCCESS) {
+        return ZE_RESULT_SUCCESS;
+    }
+    retireCommandList(hCommandList);
+    compactDagIfNeeded();
+    return ZE_RESULT_SUCCESS;
 }
 
 ze_result_t
@@ -337,7 +483,7 @@ eventsChecker::ZEeventsChecker::zeCommandListAppendQueryKernelTimestampsPrologue
     ze_event_handle_t *phWaitEvents        ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
                                            ///< on before executing query
 ) {
-    checkForDeadlock("zeCommandListAppendQueryKernelTimestamps", hSignalEvent, numWaitEvents, phWaitEvents);
+    checkForDeadlock("zeCommandListAppendQueryKernelTimestamps", hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -352,7 +498,7 @@ eventsChecker::ZEeventsChecker::zeCommandListAppendLaunchKernelPrologue(
     ze_event_handle_t *phWaitEvents          ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
                                              ///< on before launching
 ) {
-    checkForDeadlock("zeCommandListAppendLaunchKernel", hSignalEvent, numWaitEvents, phWaitEvents);
+    checkForDeadlock("zeCommandListAppendLaunchKernel", hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -367,7 +513,7 @@ eventsChecker::ZEeventsChecker::zeCommandListAppendLaunchCooperativeKernelProlog
     ze_event_handle_t *phWaitEvents          ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
                                              ///< on before launching
 ) {
-    checkForDeadlock("zeCommandListAppendLaunchCooperativeKernel", hSignalEvent, numWaitEvents, phWaitEvents);
+    checkForDeadlock("zeCommandListAppendLaunchCooperativeKernel", hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -383,7 +529,7 @@ eventsChecker::ZEeventsChecker::zeCommandListAppendLaunchKernelIndirectPrologue(
     ze_event_handle_t *phWaitEvents                 ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
                                                     ///< on before launching
 ) {
-    checkForDeadlock("zeCommandListAppendLaunchKernelIndirect", hSignalEvent, numWaitEvents, phWaitEvents);
+    checkForDeadlock("zeCommandListAppendLaunchKernelIndirect", hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -403,7 +549,7 @@ eventsChecker::ZEeventsChecker::zeCommandListAppendLaunchMultipleKernelsIndirect
     ze_event_handle_t *phWaitEvents                 ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
                                                     ///< on before launching
 ) {
-    checkForDeadlock("zeCommandListAppendLaunchMultipleKernelsIndirect", hSignalEvent, numWaitEvents, phWaitEvents);
+    checkForDeadlock("zeCommandListAppendLaunchMultipleKernelsIndirect", hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -413,7 +559,7 @@ eventsChecker::ZEeventsChecker::zeCommandListUpdateMutableCommandSignalEventExpP
     uint64_t commandId,                    ///< [in] command identifier
     ze_event_handle_t hSignalEvent         ///< [in][optional] handle of the event to signal on completion
 ) {
-    checkForDeadlock("zeCommandListUpdateMutableCommandSignalEventExp", hSignalEvent, 0, nullptr);
+    checkForDeadlock("zeCommandListUpdateMutableCommandSignalEventExp", hCommandList, hSignalEvent, 0, nullptr);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -425,7 +571,7 @@ eventsChecker::ZEeventsChecker::zeCommandListUpdateMutableCommandWaitEventsExpPr
     ze_event_handle_t *phWaitEvents        ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
                                            ///< on before launching
 ) {
-    checkForDeadlock("zeCommandListUpdateMutableCommandWaitEventsExp", nullptr, numWaitEvents, phWaitEvents);
+    checkForDeadlock("zeCommandListUpdateMutableCommandWaitEventsExp", hCommandList, nullptr, numWaitEvents, phWaitEvents);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -445,7 +591,7 @@ eventsChecker::ZEeventsChecker::zeCommandListAppendImageCopyToMemoryExtPrologue(
     ze_event_handle_t *phWaitEvents        ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
                                            ///< on before launching
 ) {
-    checkForDeadlock("zeCommandListAppendImageCopyToMemoryExt", hSignalEvent, numWaitEvents, phWaitEvents);
+    checkForDeadlock("zeCommandListAppendImageCopyToMemoryExt", hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -465,7 +611,7 @@ eventsChecker::ZEeventsChecker::zeCommandListAppendImageCopyFromMemoryExtPrologu
     ze_event_handle_t *phWaitEvents        ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
                                            ///< on before launching
 ) {
-    checkForDeadlock("zeCommandListAppendImageCopyFromMemoryExt", hSignalEvent, numWaitEvents, phWaitEvents);
+    checkForDeadlock("zeCommandListAppendImageCopyFromMemoryExt", hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -484,7 +630,7 @@ eventsChecker::ZEeventsChecker::zeCommandListImmediateAppendCommandListsExpProlo
                                                     ///<    - if not null, all wait events must be satisfied prior to the start
                                                     ///< of any appended command list(s)
 ) {
-    checkForDeadlock("zeCommandListImmediateAppendCommandListsExp", hSignalEvent, numWaitEvents, phWaitEvents);
+    checkForDeadlock("zeCommandListImmediateAppendCommandListsExp", hCommandListImmediate, hSignalEvent, numWaitEvents, phWaitEvents);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -501,10 +647,11 @@ void eventsChecker::ZEeventsChecker::validateSignalEventOwnership(const std::str
 }
 
 void eventsChecker::ZEeventsChecker::checkForDeadlock(
-    const std::string &zeCallDisc,        /// action discription
-    const ze_event_handle_t hSignalEvent, ///< [in][optional] handle of the event to forming the outgoing edge in the DAG
-    const uint32_t numWaitEvents,         ///< [in][optional] number of events that point to this action.
-    const ze_event_handle_t *phWaitEvents ///< [in][optional][range(0, numWaitEvents)] handle of the events that point to this action.
+    const std::string &zeCallDisc,               /// action discription
+    const ze_command_list_handle_t hCommandList, ///< [in][optional] handle of the command list the action is appended to
+    const ze_event_handle_t hSignalEvent,        ///< [in][optional] handle of the event to forming the outgoing edge in the DAG
+    const uint32_t numWaitEvents,                ///< [in][optional] number of events that point to this action.
+    const ze_event_handle_t *phWaitEvents        ///< [in][optional][range(0, numWaitEvents)] handle of the events that point to this action.
 ) {
 
     uint32_t this_action_new_node_id = invalidDagID;
@@ -541,8 +688,11 @@ void eventsChecker::ZEeventsChecker::checkForDeadlock(
         this_action_new_node_id = addNodeInDag();
 
         // Now we know where the hSignalEvent points from/out in the DAG. Update the eventToDagID map.
-        eventToDagID[hSignalEvent] = this_action_new_node_id;
+        if (hSignalEvent != nullptr) {
+            eventToDagID[hSignalEvent] = this_action_new_node_id;
+        }
     }
+    setDagIDOwner(this_action_new_node_id, hCommandList);
 
     // Add this action to the actionToDagID map.
     std::ostringstream oss;
@@ -602,6 +752,12 @@ void eventsChecker::ZEeventsChecker::checkForDeadlock(
             }
         }
     }
+
+    if (hSignalEvent == nullptr) {
+        // Nothing can wait on an action that signals no event, so it can never be part of a cycle.
+        retireDagNode(this_action_new_node_id);
+        compactDagIfNeeded();
+    }
 }
 
 } // namespace validation_layer
@@ -16,12 +16,15 @@
 
 #include <limits>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace validation_layer {
 
 constexpr uint32_t invalidDagID = (std::numeric_limits<uint32_t>::max)();
-constexpr ze_event_handle_t invalidEventAddress = (std::numeric_limits<ze_event_handle_t>::max)();
 using actionAndSignalEvent = std::pair<std::string, ze_event_handle_t>;
+// Retired nodes are compacted out of the DAG once they number at least this many and outnumber the live ones.
+constexpr uint32_t dagCompactionThreshold = 1024;
 
 class __zedlllocal eventsChecker : public validationChecker {
   public:
@@ -58,6 +61,8 @@ class __zedlllocal eventsChecker : public validationChecker {
         ze_result_t zeCommandListAppendImageCopyToMemoryExtPrologue(ze_command_list_handle_t hCommandList, void *dstptr, ze_image_handle_t hSrcImage, const ze_image_region_t *pSrcRegion, uint32_t destRowPitch, uint32_t destSlicePitch, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) override;
         ze_result_t zeCommandListAppendImageCopyFromMemoryExtPrologue(ze_command_list_handle_t hCommandList, ze_image_handle_t hDstImage, const void *srcptr, const ze_image_region_t *pDstRegion, uint32_t srcRowPitch, uint32_t srcSlicePitch, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) override;
         ze_result_t zeCommandListImmediateAppendCommandListsExpPrologue(ze_command_list_handle_t hCommandListImmediate, uint32_t numCommandLists, ze_command_list_handle_t *phCommandLists, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) override;
+        ze_result_t zeCommandListResetEpilogue(ze_command_list_handle_t hCommandList, ze_result_t result) override;
+        ze_result_t zeCommandListDestroyEpilogue(ze_command_list_handle_t hCommandList, ze_result_t result) override;
 
       private:
         // Add node in the DAG and get its ID.
@@ -70,12 +75,27 @@ class __zedlllocal eventsChecker : public validationChecker {
         void validateSignalEventOwnership(const std::string &zeCallDisc, const ze_event_handle_t hSignalEvent);
 
         // Inserts new actions and events in the DAG based on the ze<API CALLS>.
-        void checkForDeadlock(const std::string &zeCallDisc, const ze_event_handle_t hSignalEvent, const uint32_t numWaitEvents, const ze_event_handle_t *phWaitEvents);
+        // hCommandList is the list the action is appended to, or nullptr for host actions.
+        void checkForDeadlock(const std::string &zeCallDisc, const ze_command_list_handle_t hCommandList, const ze_event_handle_t hSignalEvent, const uint32_t numWaitEvents, const ze_event_handle_t *phWaitEvents);
 
-        // Reset the event to have an invalid DAG ID such that it can be reused.
+        // Reset the event to have an invalid DAG ID such that it can be reused, and retire its DAG node.
         // Useful for zeCalls such as zeCommandListAppendEventReset and zeEventHostReset.
         void resetEventInEventToDagID(const std::string &zeCallDisc, ze_event_handle_t hEvent);
 
+        // Remove a node from the DAG. Its predecessors are linked to its successors first so that
+        // reachability between the remaining nodes, and hence cycle detection, is unchanged.
+        void retireDagNode(uint32_t dagID);
+
+        // Drop the actions appended to a command list that is being reset or destroyed.
+        void retireCommandList(ze_command_list_handle_t hCommandList);
+
+        // Renumber the DAG densely once enough nodes have been retired, so memory follows the live work.
+        void compactDagIfNeeded();
+
+        // Record or forget which command list an action node was appended to.
+        void setDagIDOwner(uint32_t dagID, ze_command_list_handle_t hCommandList);
+        void clearDagIDOwner(uint32_t dagID);
+
         // The DAG structure.
         xla::GraphCycles dag;
 
@@ -84,6 +104,13 @@ class __zedlllocal eventsChecker : public validationChecker {
 
         // This map acts as a bi-directional map to eventToDagID. It maps DAG ID to a pair containing action description and signal event.
         std::unordered_map<uint32_t, actionAndSignalEvent> dagIDToAction;
+
+        // Command list each action node was appended to, and the reverse index used on reset and destroy.
+        std::unordered_map<uint32_t, ze_command_list_handle_t> dagIDToCommandList;
+        std::unordered_map<ze_command_list_handle_t, std::unordered_set<uint32_t>> commandListToDagIDs;
+
+        // Nodes retired since the last compaction of the DAG.
+        uint32_t retiredDagNodes = 0;
     };
     class ZESeventsChecker : public ZESValidationEntryPoints {};
     class ZETeventsChecker : public ZETValidationEntryPoints {};
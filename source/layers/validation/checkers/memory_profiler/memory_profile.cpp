@@ -0,0 +1,261 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file memory_profile.cpp
+ *
+ */
+
+#include "memory_profile.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+namespace validation_layer {
+
+constexpr size_t MemoryProfile::sizeBucketCount;
+constexpr size_t MemoryProfile::lifetimeBucketCount;
+
+size_t MemoryProfile::sizeBucket(uint64_t size) {
+  size_t bucket = 0;
+  while (bucket < 64 && (uint64_t(1) << bucket) < size) {
+    ++bucket;
+  }
+  return bucket;
+}
+
+size_t MemoryProfile::lifetimeBucket(uint64_t lifetimeNs) {
+  size_t bucket = 0;
+  for (uint64_t limit = 10000; bucket + 1 < lifetimeBucketCount && lifetimeNs >= limit; limit *= 10) {
+    ++bucket;
+  }
+  return bucket;
+}
+
+uint32_t MemoryProfile::poolIndex(const void *context, const void *device,
+                                  MemoryAllocationType type) {
+  for (size_t i = 0; i < poolStats.size(); ++i) {
+    const PoolStats &pool = poolStats[i];
+    if (pool.context == context && pool.device == device && pool.type == type) {
+      return static_cast<uint32_t>(i);
+    }
+  }
+  PoolStats pool;
+  pool.context = context;
+  pool.device = device;
+  pool.type = type;
+  poolStats.push_back(pool);
+  return static_cast<uint32_t>(poolStats.size() - 1);
+}
+
+void MemoryProfile::retire(const AllocationRecord &record,
+                           uint64_t lifetimeNs) {
+  PoolStats &pool = poolStats[record.pool];
+  pool.liveBytes -= record.size;
+  pool.liveCount--;
+  pool.freeCount++;
+  totalLiveBytes -= record.size;
+  lifetimeBuckets[lifetimeBucket(lifetimeNs)]++;
+}
+
+void MemoryProfile::recordAlloc(const void *ptr, uint64_t size,
+                                const void *context, const void *device,
+                                MemoryAllocationType type, uint64_t nowNs) {
+  const uintptr_t key = reinterpret_cast<uintptr_t>(ptr);
+  if (key == 0) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mut);
+  bool inserted = false;
+  AllocationRecord &record = live.findOrInsert(key, inserted);
+  if (!inserted) {
+    // The address came back without a free we saw (e.g. freed through
+    // another path); close out the stale allocation first.
+    retire(record, nowNs - record.allocTimeNs);
+  }
+  record.size = size;
+  record.allocTimeNs = nowNs;
+  record.pool = poolIndex(context, device, type);
+
+  PoolStats &pool = poolStats[record.pool];
+  pool.liveBytes += size;
+  pool.peakBytes = std::max(pool.peakBytes, pool.liveBytes);
+  pool.liveCount++;
+  pool.allocCount++;
+  totalLiveBytes += size;
+  totalPeakBytes = std::max(totalPeakBytes, totalLiveBytes);
+  sizeBuckets[sizeBucket(size)]++;
+  if (size != 0) {
+    sizeCounts.findOrInsert(static_cast<uintptr_t>(size), inserted)++;
+  }
+}
+
+bool MemoryProfile::takeAlloc(const void *ptr, AllocationRecord &record) {
+  const uintptr_t key = reinterpret_cast<uintptr_t>(ptr);
+  if (key == 0) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(mut);
+  return live.take(key, record);
+}
+
+void MemoryProfile::commitFree(const AllocationRecord &record,
+                               uint64_t nowNs) {
+  std::lock_guard<std::mutex> lock(mut);
+  retire(record, nowNs > record.allocTimeNs ? nowNs - record.allocTimeNs : 0);
+}
+
+void MemoryProfile::restoreAlloc(const void *ptr,
+                                 const AllocationRecord &record) {
+  const uintptr_t key = reinterpret_cast<uintptr_t>(ptr);
+  if (key == 0) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mut);
+  bool inserted = false;
+  live.findOrInsert(key, inserted) = record;
+}
+
+uint64_t MemoryProfile::liveBytes() const {
+  std::lock_guard<std::mutex> lock(mut);
+  return totalLiveBytes;
+}
+
+uint64_t MemoryProfile::peakBytes() const {
+  std::lock_guard<std::mutex> lock(mut);
+  return totalPeakBytes;
+}
+
+std::vector<MemoryProfile::PoolStats> MemoryProfile::pools() const {
+  std::lock_guard<std::mutex> lock(mut);
+  return poolStats;
+}
+
+std::vector<uint64_t> MemoryProfile::sizeHistogram() const {
+  std::lock_guard<std::mutex> lock(mut);
+  return std::vector<uint64_t>(sizeBuckets, sizeBuckets + sizeBucketCount);
+}
+
+std::vector<uint64_t> MemoryProfile::lifetimeHistogram() const {
+  std::lock_guard<std::mutex> lock(mut);
+  return std::vector<uint64_t>(lifetimeBuckets,
+                               lifetimeBuckets + lifetimeBucketCount);
+}
+
+std::vector<std::pair<uint64_t, uint64_t>>
+MemoryProfile::churn(size_t limit) const {
+  std::vector<std::pair<uint64_t, uint64_t>> sizes;
+  {
+    std::lock_guard<std::mutex> lock(mut);
+    sizeCounts.forEach([&sizes](uintptr_t size, uint64_t count) {
+      if (count > 1) {
+        sizes.emplace_back(size, count);
+      }
+    });
+  }
+  std::sort(sizes.begin(), sizes.end(),
+            [](const std::pair<uint64_t, uint64_t> &a,
+               const std::pair<uint64_t, uint64_t> &b) {
+              return a.second != b.second ? a.second > b.second
+                                          : a.first < b.first;
+            });
+  if (sizes.size() > limit) {
+    sizes.resize(limit);
+  }
+  return sizes;
+}
+
+static const char *typeName(MemoryAllocationType type) {
+  switch (type) {
+  case MemoryAllocationType::Host:
+    return "host";
+  case MemoryAllocationType::Device:
+    return "device";
+  case MemoryAllocationType::Shared:
+    return "shared";
+  }
+  return "unknown";
+}
+
+static std::string formatSize(uint64_t bytes) {
+  static const char *units[] = {"B", "KB", "MB", "GB", "TB", "PB", "EB"};
+  size_t unit = 0;
+  while (unit + 1 < sizeof(units) / sizeof(units[0]) && bytes >= 1024 &&
+         bytes % 1024 == 0) {
+    bytes /= 1024;
+    ++unit;
+  }
+  return std::to_string(bytes) + " " + units[unit];
+}
+
+std::string MemoryProfile::report(uint64_t nowNs) const {
+  const auto churnSizes = churn(10);
+
+  std::lock_guard<std::mutex> lock(mut);
+  const double elapsedSec =
+      nowNs > startTimeNs ? (nowNs - startTimeNs) / 1e9 : 0.0;
+
+  std::ostringstream out;
+  out << "Memory allocation profile after " << std::fixed
+      << std::setprecision(3) << elapsedSec << " s\n";
+  out << "----------------------------------------------------------\n";
+  out << "  live bytes = " << totalLiveBytes << ", peak bytes = "
+      << totalPeakBytes << ", live allocations = " << live.size() << "\n";
+
+  out << "Per context/device/type:\n";
+  for (const auto &pool : poolStats) {
+    out << "  context " << pool.context << " device ";
+    if (pool.device) {
+      out << pool.device;
+    } else {
+      out << "-";
+    }
+    out << " " << std::setw(6) << std::left << typeName(pool.type)
+        << std::right << " live = " << pool.liveBytes
+        << " (" << pool.liveCount << "), peak = " << pool.peakBytes
+        << ", allocs = " << pool.allocCount << ", frees = " << pool.freeCount
+        << "\n";
+  }
+
+  out << "Allocation sizes:\n";
+  for (size_t b = 0; b < sizeBucketCount; ++b) {
+    if (sizeBuckets[b] == 0) {
+      continue;
+    }
+    const std::string bound =
+        b < 64 ? formatSize(uint64_t(1) << b) : std::string("16 EB");
+    out << "  <= " << std::setw(8) << bound << " : " << sizeBuckets[b] << "\n";
+  }
+
+  static const char *lifetimeLabels[lifetimeBucketCount] = {
+      "< 10 us", "< 100 us", "< 1 ms", "< 10 ms",
+      "< 100 ms", "< 1 s", "< 10 s", ">= 10 s"};
+  out << "Allocation lifetimes:\n";
+  for (size_t b = 0; b < lifetimeBucketCount; ++b) {
+    if (lifetimeBuckets[b] != 0) {
+      out << "  " << std::setw(8) << lifetimeLabels[b] << " : "
+          << lifetimeBuckets[b] << "\n";
+    }
+  }
+  if (live.size() != 0) {
+    out << "  " << std::setw(8) << "live" << " : " << live.size() << "\n";
+  }
+
+  if (!churnSizes.empty()) {
+    out << "Churn (sizes allocated more than once):\n";
+    for (const auto &entry : churnSizes) {
+      out << "  " << std::setw(8) << formatSize(entry.first) << " : "
+          << entry.second << " allocs";
+      if (elapsedSec > 0.0) {
+        out << ", " << std::setprecision(1) << entry.second / elapsedSec
+            << " allocs/s";
+      }
+      out << "\n";
+    }
+  }
+  return out.str();
+}
+
+} // namespace validation_layer
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file memory_profile.h
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "address_table.h"
+
+namespace validation_layer {
+
+enum class MemoryAllocationType : uint32_t { Host, Device, Shared };
+
+// A live allocation as remembered between zeMemAlloc* and zeMemFree*.
+struct AllocationRecord {
+  uint64_t size = 0;
+  uint64_t allocTimeNs = 0;
+  uint32_t pool = 0; // index into MemoryProfile's pool list
+};
+
+// Allocation statistics for the memory profiler checker: live bytes and peak
+// watermark per (context, device, type) pool and overall, a power-of-two
+// size histogram, a lifetime histogram and per-size churn.  Timestamps are
+// passed in by the caller (steady clock nanoseconds).  Thread-safe.
+class MemoryProfile {
+public:
+  // Bucket b holds sizes in (2^(b-1), 2^b]; bucket 0 holds sizes 0 and 1.
+  static constexpr size_t sizeBucketCount = 65;
+  // Decades from < 10us up to >= 10s.
+  static constexpr size_t lifetimeBucketCount = 8;
+
+  struct PoolStats {
+    const void *context = nullptr;
+    const void *device = nullptr; // nullptr for host allocations
+    MemoryAllocationType type = MemoryAllocationType::Host;
+    uint64_t liveBytes = 0;
+    uint64_t peakBytes = 0;
+    uint64_t liveCount = 0;
+    uint64_t allocCount = 0;
+    uint64_t freeCount = 0;
+  };
+
+  explicit MemoryProfile(uint64_t startTimeNs = 0) : startTimeNs(startTimeNs) {}
+
+  void recordAlloc(const void *ptr, uint64_t size, const void *context,
+                   const void *device, MemoryAllocationType type,
+                   uint64_t nowNs);
+
+  // Removes ptr from the live table ahead of a free.  Accounting waits for
+  // commitFree() so a failed free can be undone with restoreAlloc().
+  bool takeAlloc(const void *ptr, AllocationRecord &record);
+  void commitFree(const AllocationRecord &record, uint64_t nowNs);
+  void restoreAlloc(const void *ptr, const AllocationRecord &record);
+
+  static size_t sizeBucket(uint64_t size);
+  static size_t lifetimeBucket(uint64_t lifetimeNs);
+
+  uint64_t liveBytes() const;
+  uint64_t peakBytes() const;
+  std::vector<PoolStats> pools() const;
+  std::vector<uint64_t> sizeHistogram() const;
+  std::vector<uint64_t> lifetimeHistogram() const;
+
+  // Allocation sizes seen more than once, busiest first, with their count.
+  std::vector<std::pair<uint64_t, uint64_t>> churn(size_t limit) const;
+
+  std::string report(uint64_t nowNs) const;
+
+private:
+  uint32_t poolIndex(const void *context, const void *device,
+                     MemoryAllocationType type);
+  void retire(const AllocationRecord &record, uint64_t lifetimeNs);
+
+  mutable std::mutex mut;
+  uint64_t startTimeNs;
+  AddressTable<AllocationRecord> live;
+  AddressTable<uint64_t> sizeCounts; // allocation size -> allocations
+  std::vector<PoolStats> poolStats;  // few entries; searched linearly
+  uint64_t totalLiveBytes = 0;
+  uint64_t totalPeakBytes = 0;
+  uint64_t sizeBuckets[sizeBucketCount] = {};
+  uint64_t lifetimeBuckets[lifetimeBucketCount] = {};
+};
+
+} // namespace validation_layer
@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file zel_memory_profiler_checker.cpp
+ *
+ */
+#include "zel_memory_profiler_checker.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+namespace validation_layer
+{
+    class memory_profilerChecker memory_profiler_checker;
+
+    static uint64_t nowNs() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    // Allocation taken out of the table by a free Prologue on this thread,
+    // waiting for the matching Epilogue.
+    struct PendingFree {
+        void *ptr = nullptr;
+        AllocationRecord record;
+        bool taken = false;
+    };
+    static thread_local PendingFree pendingFree;
+
+    memory_profilerChecker::memory_profilerChecker() {
+        enablememory_profiler = getenv_tobool( "ZEL_ENABLE_MEMORY_PROFILER_CHECKER" );
+        if(enablememory_profiler) {
+            memory_profilerChecker::ZEmemory_profilerChecker *zeChecker = new memory_profilerChecker::ZEmemory_profilerChecker;
+            memory_profilerChecker::ZESmemory_profilerChecker *zesChecker = new memory_profilerChecker::ZESmemory_profilerChecker;
+            memory_profilerChecker::ZETmemory_profilerChecker *zetChecker = new memory_profilerChecker::ZETmemory_profilerChecker;
+
+            auto reportInterval = getenv_string( "ZEL_MEMORY_PROFILER_REPORT_INTERVAL_MS" );
+            if (!reportInterval.empty()) {
+                auto intervalMs = std::strtoull( reportInterval.c_str(), nullptr, 10 );
+                if (intervalMs > 0 && intervalMs <= UINT32_MAX) {
+                    zeChecker->reportIntervalNs = intervalMs * 1000000ull;
+                }
+            }
+
+            memory_profiler_checker.zeValidation = zeChecker;
+            memory_profiler_checker.zetValidation = zetChecker;
+            memory_profiler_checker.zesValidation = zesChecker;
+            validation_layer::context.registerChecker(zeChecker, zesChecker, zetChecker);
+        }
+    }
+
+    memory_profilerChecker::~memory_profilerChecker() {
+        if(enablememory_profiler) {
+            delete memory_profiler_checker.zeValidation;
+            delete memory_profiler_checker.zetValidation;
+            delete memory_profiler_checker.zesValidation;
+        }
+    }
+
+    memory_profilerChecker::ZEmemory_profilerChecker::ZEmemory_profilerChecker()
+        : profile(nowNs()) {}
+
+    memory_profilerChecker::ZEmemory_profilerChecker::~ZEmemory_profilerChecker() {
+        std::cerr << profile.report(nowNs()) << std::flush;
+    }
+
+    void memory_profilerChecker::ZEmemory_profilerChecker::reportIfDue(uint64_t now) {
+        if (reportIntervalNs == 0) {
+            return;
+        }
+        uint64_t next = nextReportNs.load(std::memory_order_relaxed);
+        if (next == 0) {
+            // First call: start the interval now.
+            nextReportNs.compare_exchange_strong(next, now + reportIntervalNs, std::memory_order_relaxed);
+            return;
+        }
+        // Only the thread that moves the deadline prints.
+        if (now >= next && nextReportNs.compare_exchange_strong(next, now + reportIntervalNs, std::memory_order_relaxed)) {
+            std::cerr << profile.report(now) << std::flush;
+        }
+    }
+
+    void memory_profilerChecker::ZEmemory_profilerChecker::recordAlloc(void **pptr, size_t size, ze_context_handle_t hContext,
+                                                                       ze_device_handle_t hDevice, MemoryAllocationType type, ze_result_t result) {
+        if (result != ZE_RESULT_SUCCESS || pptr == nullptr || *pptr == nullptr) {
+            return;
+        }
+        const uint64_t now = nowNs();
+        profile.recordAlloc(*pptr, size, hContext, hDevice, type, now);
+        reportIfDue(now);
+    }
+
+    void memory_profilerChecker::ZEmemory_profilerChecker::takeAlloc(void *ptr) {
+        if (pendingFree.taken) {
+            // A later checker rejected the previous free before it reached
+            // the driver, so its Epilogue never ran.
+            profile.restoreAlloc(pendingFree.ptr, pendingFree.record);
+        }
+        pendingFree.ptr = ptr;
+        pendingFree.taken = profile.takeAlloc(ptr, pendingFree.record);
+    }
+
+    void memory_profilerChecker::ZEmemory_profilerChecker::finishFree(void *ptr, ze_result_t result) {
+        if (!pendingFree.taken || pendingFree.ptr != ptr) {
+            return;
+        }
+        pendingFree.taken = false;
+        if (result != ZE_RESULT_SUCCESS) {
+            profile.restoreAlloc(ptr, pendingFree.record);
+            return;
+        }
+        const uint64_t now = nowNs();
+        profile.commitFree(pendingFree.record, now);
+        reportIfDue(now);
+    }
+
+    ze_result_t memory_profilerChecker::ZEmemory_profilerChecker::zeMemAllocDeviceEpilogue(ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t *, size_t size, size_t, ze_device_handle_t hDevice, void **pptr, ze_result_t result) {
+        recordAlloc(pptr, size, hContext, hDevice, MemoryAllocationType::Device, result);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t memory_profilerChecker::ZEmemory_profilerChecker::zeMemAllocHostEpilogue(ze_context_handle_t hContext, const ze_host_mem_alloc_desc_t *, size_t size, size_t, void **pptr, ze_result_t result) {
+        recordAlloc(pptr, size, hContext, nullptr, MemoryAllocationType::Host, result);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t memory_profilerChecker::ZEmemory_profilerChecker::zeMemAllocSharedEpilogue(ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t *, const ze_host_mem_alloc_desc_t *, size_t size, size_t, ze_device_handle_t hDevice, void **pptr, ze_result_t result) {
+        recordAlloc(pptr, size, hContext, hDevice, MemoryAllocationType::Shared, result);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t memory_profilerChecker::ZEmemory_profilerChecker::zeMemFreePrologue(ze_context_handle_t, void *ptr) {
+        takeAlloc(ptr);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t memory_profilerChecker::ZEmemory_profilerChecker::zeMemFreeEpilogue(ze_context_handle_t, void *ptr, ze_result_t result) {
+        finishFree(ptr, result);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t memory_profilerChecker::ZEmemory_profilerChecker::zeMemFreeExtPrologue(ze_context_handle_t, const ze_memory_free_ext_desc_t *, void *ptr) {
+        takeAlloc(ptr);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t memory_profilerChecker::ZEmemory_profilerChecker::zeMemFreeExtEpilogue(ze_context_handle_t, const ze_memory_free_ext_desc_t *, void *ptr, ze_result_t result) {
+        finishFree(ptr, result);
+        return ZE_RESULT_SUCCESS;
+    }
+}
@@ -0,0 +1,64 @@
+/*
+ *
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file zel_memory_profiler_checker.h
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include "ze_api.h"
+#include "ze_validation_layer.h"
+#include "memory_profile.h"
+
+namespace validation_layer
+{
+    // Profiles zeMemAlloc* / zeMemFree* traffic for sizing suballocator pools.
+    // Reports (in the dtor, and every ZEL_MEMORY_PROFILER_REPORT_INTERVAL_MS
+    // if set) live bytes and peak watermark per context/device/type, a
+    // power-of-two size histogram, the allocation lifetime distribution and
+    // the sizes allocated most often.
+    //
+    // Frees are split across Prologue and Epilogue: the allocation leaves the
+    // address table before the driver can hand the address out again, and is
+    // put back if the free fails.
+    class __zedlllocal memory_profilerChecker : public validationChecker {
+        public:
+            memory_profilerChecker();
+            ~memory_profilerChecker();
+
+            class ZEmemory_profilerChecker : public ZEValidationEntryPoints {
+            public:
+                ZEmemory_profilerChecker();
+                ~ZEmemory_profilerChecker();
+
+                ze_result_t zeMemAllocDeviceEpilogue(ze_context_handle_t, const ze_device_mem_alloc_desc_t *, size_t, size_t, ze_device_handle_t, void **, ze_result_t result) override;
+                ze_result_t zeMemAllocHostEpilogue(ze_context_handle_t, const ze_host_mem_alloc_desc_t *, size_t, size_t, void **, ze_result_t result) override;
+                ze_result_t zeMemAllocSharedEpilogue(ze_context_handle_t, const ze_device_mem_alloc_desc_t *, const ze_host_mem_alloc_desc_t *, size_t, size_t, ze_device_handle_t, void **, ze_result_t result) override;
+                ze_result_t zeMemFreePrologue(ze_context_handle_t, void *) override;
+                ze_result_t zeMemFreeEpilogue(ze_context_handle_t, void *, ze_result_t result) override;
+                ze_result_t zeMemFreeExtPrologue(ze_context_handle_t, const ze_memory_free_ext_desc_t*, void *) override;
+                ze_result_t zeMemFreeExtEpilogue(ze_context_handle_t, const ze_memory_free_ext_desc_t*, void *, ze_result_t result) override;
+
+                uint64_t reportIntervalNs = 0; // 0 reports only at exit
+            private:
+                void recordAlloc(void **pptr, size_t size, ze_context_handle_t hContext, ze_device_handle_t hDevice, MemoryAllocationType type, ze_result_t result);
+                void takeAlloc(void *ptr);
+                void finishFree(void *ptr, ze_result_t result);
+                void reportIfDue(uint64_t nowNs);
+
+                MemoryProfile profile;
+                std::atomic<uint64_t> nextReportNs{0};
+            };
+
+            class ZESmemory_profilerChecker : public ZESValidationEntryPoints {};
+            class ZETmemory_profilerChecker : public ZETValidationEntryPoints {};
+            bool enablememory_profiler = false;
+    };
+    extern class memory_profilerChecker memory_profiler_checker;
+}
@@ -27,7 +27,9 @@ namespace validation_layer
             parameterChecker.zetValidation = zetChecker;
             parameterChecker.zesValidation = zesChecker;
             parameterChecker.zerValidation = zerChecker;
-            validation_layer::context.getInstance().validationHandlers.push_back(&parameterChecker);
+            // Parameter checks keep no state between calls, so they are
+            // subject to ZEL_VALIDATION_SAMPLE_PERIOD.
+            validation_layer::context.getInstance().registerSampledChecker(zeChecker, zesChecker, zetChecker, zerChecker);
         }
     }
 
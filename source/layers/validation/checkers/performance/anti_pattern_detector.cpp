@@ -0,0 +1,356 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file anti_pattern_detector.cpp
+ *
+ */
+
+#include "anti_pattern_detector.h"
+
+#include <algorithm>
+#include <sstream>
+
+namespace validation_layer {
+
+void AntiPatternDetector::add(FindingMap &map, AntiPattern pattern,
+                              uintptr_t site, uint64_t detail, uint64_t count,
+                              uint64_t total) {
+  if (total == 0) {
+    return;
+  }
+  Counts &counts = map[FindingKey{pattern, site, detail}];
+  counts.count += count;
+  counts.total += total;
+}
+
+void AntiPatternDetector::foldList(FindingMap &map, uintptr_t site,
+                                   const ListState &state) {
+  add(map, AntiPattern::SmallCopy, site, 0, state.smallCopies, state.copies);
+  add(map, AntiPattern::SyncAfterEveryAppend, site, 0, state.singleAppendSyncs,
+      state.syncs);
+  add(map, AntiPattern::SingleCommandList, site, 0,
+      state.singleCommandExecutions, state.singleCommandExecutions);
+}
+
+void AntiPatternDetector::foldKernel(FindingMap &map, uintptr_t site,
+                                     const KernelState &state) {
+  add(map, AntiPattern::RepeatedSetGroupSize, site, 0, state.repeatedSets,
+      state.sets);
+  add(map, AntiPattern::RepeatedSuggestGroupSize, site, 0,
+      state.repeatedSuggests, state.suggests);
+}
+
+AntiPatternDetector::ListState &
+AntiPatternDetector::listState(const void *list) {
+  // Lists created before the checker saw them are tracked from first use.
+  bool inserted = false;
+  return lists.findOrInsert(key(list), inserted);
+}
+
+void AntiPatternDetector::commandListCreated(const void *list,
+                                             bool immediate) {
+  if (!list) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mut);
+  ListState &state = listState(list);
+  state = ListState();
+  state.immediate = immediate;
+}
+
+void AntiPatternDetector::commandListDestroyed(const void *list) {
+  if (!list) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mut);
+  ListState state;
+  if (lists.take(key(list), state)) {
+    foldList(folded, key(list), state);
+  }
+}
+
+void AntiPatternDetector::commandListReset(const void *list) {
+  if (!list) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mut);
+  ListState &state = listState(list);
+  state.commands = 0;
+  state.closedCommands = 0;
+  state.appendsSinceSync = 0;
+}
+
+void AntiPatternDetector::commandListClosed(const void *list) {
+  if (!list) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mut);
+  ListState &state = listState(list);
+  state.closedCommands = state.commands;
+}
+
+void AntiPatternDetector::commandAppended(const void *list) {
+  if (!list) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mut);
+  ListState &state = listState(list);
+  state.commands++;
+  state.appendsSinceSync++;
+}
+
+void AntiPatternDetector::memoryCopyAppended(const void *list,
+                                             uint64_t size) {
+  if (!list) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mut);
+  ListState &state = listState(list);
+  state.commands++;
+  state.appendsSinceSync++;
+  state.copies++;
+  if (size < config.smallCopyBytes) {
+    state.smallCopies++;
+  }
+}
+
+void AntiPatternDetector::commandListsExecuted(const void *const *lists,
+                                               uint32_t count) {
+  if (!lists) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mut);
+  for (uint32_t i = 0; i < count; ++i) {
+    if (!lists[i]) {
+      continue;
+    }
+    ListState &state = listState(lists[i]);
+    if (state.closedCommands == 1) {
+      state.singleCommandExecutions++;
+    }
+  }
+}
+
+void AntiPatternDetector::hostSynchronized(const void *list) {
+  if (!list) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mut);
+  ListState *state = lists.find(key(list));
+  if (!state || !state->immediate || state->appendsSinceSync == 0) {
+    return;
+  }
+  state->syncs++;
+  if (state->appendsSinceSync == 1) {
+    state->singleAppendSyncs++;
+  }
+  state->appendsSinceSync = 0;
+}
+
+void AntiPatternDetector::groupSizeSet(const void *kernel, uint32_t x,
+                                       uint32_t y, uint32_t z) {
+  if (!kernel) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mut);
+  bool inserted = false;
+  KernelState &state = kernels.findOrInsert(key(kernel), inserted);
+  state.sets++;
+  if (state.groupSizeValid && state.groupSize[0] == x &&
+      state.groupSize[1] == y && state.groupSize[2] == z) {
+    state.repeatedSets++;
+  }
+  state.groupSizeValid = true;
+  state.groupSize[0] = x;
+  state.groupSize[1] = y;
+  state.groupSize[2] = z;
+}
+
+void AntiPatternDetector::groupSizeSuggested(const void *kernel, uint32_t x,
+                                             uint32_t y, uint32_t z) {
+  if (!kernel) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mut);
+  bool inserted = false;
+  KernelState &state = kernels.findOrInsert(key(kernel), inserted);
+  state.suggests++;
+  if (state.suggestValid && state.suggestArgs[0] == x &&
+      state.suggestArgs[1] == y && state.suggestArgs[2] == z) {
+    state.repeatedSuggests++;
+  }
+  state.suggestValid = true;
+  state.suggestArgs[0] = x;
+  state.suggestArgs[1] = y;
+  state.suggestArgs[2] = z;
+}
+
+void AntiPatternDetector::kernelDestroyed(const void *kernel) {
+  if (!kernel) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mut);
+  KernelState state;
+  if (kernels.take(key(kernel), state)) {
+    foldKernel(folded, key(kernel), state);
+  }
+}
+
+// A resource was created in context with the given detail: count it as a
+// recreation if an identical one was released earlier.
+void AntiPatternDetector::recreated(AntiPattern pattern, const void *context,
+                                    uint64_t detail) {
+  Counts &counts = folded[FindingKey{pattern, key(context), detail}];
+  counts.total++;
+  if (counts.released != 0) {
+    counts.released--;
+    counts.count++;
+  }
+}
+
+void AntiPatternDetector::released(AntiPattern pattern,
+                                   const ResourceState &state) {
+  folded[FindingKey{pattern, key(state.context), state.detail}].released++;
+}
+
+void AntiPatternDetector::eventPoolCreated(const void *context,
+                                           const void *pool, uint32_t flags,
+                                           uint32_t count) {
+  if (!pool) {
+    return;
+  }
+  const uint64_t detail = (static_cast<uint64_t>(flags) << 32) | count;
+  std::lock_guard<std::mutex> lock(mut);
+  bool inserted = false;
+  ResourceState &state = eventPools.findOrInsert(key(pool), inserted);
+  state.context = context;
+  state.detail = detail;
+  recreated(AntiPattern::EventPoolChurn, context, detail);
+}
+
+void AntiPatternDetector::eventPoolDestroyed(const void *pool) {
+  if (!pool) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mut);
+  ResourceState state;
+  if (eventPools.take(key(pool), state)) {
+    released(AntiPattern::EventPoolChurn, state);
+  }
+}
+
+void AntiPatternDetector::memoryAllocated(const void *context, const void *ptr,
+                                          uint64_t size) {
+  if (!ptr) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mut);
+  bool inserted = false;
+  ResourceState &state = allocations.findOrInsert(key(ptr), inserted);
+  state.context = context;
+  state.detail = size;
+  recreated(AntiPattern::AllocFreeLoop, context, size);
+}
+
+void AntiPatternDetector::memoryFreed(const void *ptr) {
+  if (!ptr) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mut);
+  ResourceState state;
+  if (allocations.take(key(ptr), state)) {
+    released(AntiPattern::AllocFreeLoop, state);
+  }
+}
+
+std::vector<AntiPatternFinding> AntiPatternDetector::findings() const {
+  std::vector<AntiPatternFinding> result;
+  {
+    std::lock_guard<std::mutex> lock(mut);
+    FindingMap all = folded;
+    lists.forEach([&all](uintptr_t site, const ListState &state) {
+      foldList(all, site, state);
+    });
+    kernels.forEach([&all](uintptr_t site, const KernelState &state) {
+      foldKernel(all, site, state);
+    });
+    for (const auto &entry : all) {
+      const Counts &counts = entry.second;
+      if (counts.count >= config.reportThreshold &&
+          counts.count * 2 >= counts.total) {
+        result.push_back(AntiPatternFinding{
+            entry.first.pattern,
+            reinterpret_cast<const void *>(entry.first.site),
+            entry.first.detail, counts.count, counts.total});
+      }
+    }
+  }
+  std::sort(result.begin(), result.end(),
+            [](const AntiPatternFinding &a, const AntiPatternFinding &b) {
+              if (a.pattern != b.pattern) {
+                return a.pattern < b.pattern;
+              }
+              if (a.count != b.count) {
+                return a.count > b.count;
+              }
+              return a.site < b.site;
+            });
+  return result;
+}
+
+std::string
+AntiPatternDetector::describe(const AntiPatternFinding &finding) const {
+  std::ostringstream out;
+  switch (finding.pattern) {
+  case AntiPattern::SmallCopy:
+    out << "Command list " << finding.site << ": " << finding.count << " of "
+        << finding.total
+        << " zeCommandListAppendMemoryCopy calls copied less than "
+        << config.smallCopyBytes
+        << " bytes. Consider batching small copies into fewer, larger ones.";
+    break;
+  case AntiPattern::RepeatedSetGroupSize:
+    out << "Kernel " << finding.site << ": " << finding.count << " of "
+        << finding.total
+        << " zeKernelSetGroupSize calls set the group size it already had. "
+           "Consider setting the group size once per kernel.";
+    break;
+  case AntiPattern::RepeatedSuggestGroupSize:
+    out << "Kernel " << finding.site << ": " << finding.count << " of "
+        << finding.total
+        << " zeKernelSuggestGroupSize calls repeated the previous global size. "
+           "Consider caching the suggested group size.";
+    break;
+  case AntiPattern::SyncAfterEveryAppend:
+    out << "Immediate command list " << finding.site << ": " << finding.count
+        << " of " << finding.total
+        << " host synchronizations waited for a single append. Consider "
+           "appending more work before synchronizing.";
+    break;
+  case AntiPattern::EventPoolChurn:
+    out << "Context " << finding.site << ": " << finding.count << " of "
+        << finding.total << " event pools with count "
+        << (finding.detail & 0xffffffffu) << " and flags 0x" << std::hex
+        << (finding.detail >> 32) << std::dec
+        << " were created after an identical pool was destroyed. Consider "
+           "reusing event pools and resetting their events.";
+    break;
+  case AntiPattern::AllocFreeLoop:
+    out << "Context " << finding.site << ": " << finding.count << " of "
+        << finding.total << " allocations of " << finding.detail
+        << " bytes followed a free of the same size. Consider reusing the "
+           "allocation or suballocating from a pool.";
+    break;
+  case AntiPattern::SingleCommandList:
+    out << "Command list " << finding.site << " was executed "
+        << finding.count
+        << " times with a single command. Consider batching more commands "
+           "into the list or using an immediate command list.";
+    break;
+  }
+  return out.str();
+}
+
+} // namespace validation_layer
@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file anti_pattern_detector.h
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "address_table.h"
+
+namespace validation_layer {
+
+enum class AntiPattern : uint32_t {
+  SmallCopy,                // many tiny zeCommandListAppendMemoryCopy calls
+  RepeatedSetGroupSize,     // zeKernelSetGroupSize with the current size
+  RepeatedSuggestGroupSize, // zeKernelSuggestGroupSize with the last arguments
+  SyncAfterEveryAppend,     // host waits after each single append
+  EventPoolChurn,           // event pools destroyed and recreated alike
+  AllocFreeLoop,            // same-size allocations right after frees
+  SingleCommandList,        // closed lists with one command re-executed
+};
+
+// One aggregated finding.  site is the object the pattern was seen on (a
+// command list, kernel or context); detail distinguishes findings on the same
+// site (the allocation size, or the event pool's count and flags).  count is
+// how many calls showed the pattern out of total relevant calls.
+struct AntiPatternFinding {
+  AntiPattern pattern;
+  const void *site;
+  uint64_t detail;
+  uint64_t count;
+  uint64_t total;
+};
+
+// Counts API usage anti-patterns for the performance checker.  The checker
+// feeds it the relevant calls; it keeps per-object counters in address-keyed
+// tables and folds them into per-site findings when the object is destroyed.
+// Nothing is logged per call: findings() returns the sites whose count
+// reached reportThreshold and at least half of the relevant calls.
+// Thread-safe.
+class AntiPatternDetector {
+public:
+  struct Config {
+    uint64_t smallCopyBytes = 4096; // copies below this are "small"
+    uint64_t reportThreshold = 10;  // minimum count for a finding
+  };
+
+  explicit AntiPatternDetector(const Config &config) : config(config) {}
+  AntiPatternDetector() : AntiPatternDetector(Config()) {}
+
+  void commandListCreated(const void *list, bool immediate);
+  void commandListDestroyed(const void *list);
+  void commandListReset(const void *list);
+  void commandListClosed(const void *list);
+  void commandAppended(const void *list);
+  void memoryCopyAppended(const void *list, uint64_t size);
+  void commandListsExecuted(const void *const *lists, uint32_t count);
+  // The host waited for the work appended so far to an immediate command
+  // list; ignored for regular command lists.
+  void hostSynchronized(const void *list);
+
+  void groupSizeSet(const void *kernel, uint32_t x, uint32_t y, uint32_t z);
+  void groupSizeSuggested(const void *kernel, uint32_t x, uint32_t y,
+                          uint32_t z);
+  void kernelDestroyed(const void *kernel);
+
+  void eventPoolCreated(const void *context, const void *pool, uint32_t flags,
+                        uint32_t count);
+  void eventPoolDestroyed(const void *pool);
+
+  void memoryAllocated(const void *context, const void *ptr, uint64_t size);
+  void memoryFreed(const void *ptr);
+
+  // Findings over the thresholds, grouped by pattern, largest count first.
+  std::vector<AntiPatternFinding> findings() const;
+  std::string describe(const AntiPatternFinding &finding) const;
+
+private:
+  struct ListState {
+    bool immediate = false;
+    uint32_t commands = 0;        // appended since create or reset
+    uint32_t closedCommands = 0;  // commands when last closed
+    uint32_t appendsSinceSync = 0;
+    uint64_t copies = 0;
+    uint64_t smallCopies = 0;
+    uint64_t syncs = 0;
+    uint64_t singleAppendSyncs = 0;
+    uint64_t singleCommandExecutions = 0;
+  };
+
+  struct KernelState {
+    bool groupSizeValid = false;
+    bool suggestValid = false;
+    uint32_t groupSize[3] = {};
+    uint32_t suggestArgs[3] = {};
+    uint64_t sets = 0;
+    uint64_t repeatedSets = 0;
+    uint64_t suggests = 0;
+    uint64_t repeatedSuggests = 0;
+  };
+
+  struct ResourceState {
+    const void *context = nullptr;
+    uint64_t detail = 0; // allocation size, or event pool count and flags
+  };
+
+  struct FindingKey {
+    AntiPattern pattern;
+    uintptr_t site;
+    uint64_t detail;
+    bool operator==(const FindingKey &other) const {
+      return pattern == other.pattern && site == other.site &&
+             detail == other.detail;
+    }
+  };
+  struct FindingKeyHash {
+    size_t operator()(const FindingKey &key) const {
+      uint64_t h = (key.site ^ (key.detail << 8) ^
+                    static_cast<uint64_t>(key.pattern)) *
+                   0x9E3779B97F4A7C15ull;
+      return static_cast<size_t>(h ^ (h >> 29));
+    }
+  };
+  struct Counts {
+    uint64_t count = 0;
+    uint64_t total = 0;
+    uint64_t released = 0; // frees or pool destroys not yet matched
+  };
+
+  using FindingMap = std::unordered_map<FindingKey, Counts, FindingKeyHash>;
+
+  static uintptr_t key(const void *p) { return reinterpret_cast<uintptr_t>(p); }
+  static void add(FindingMap &map, AntiPattern pattern, uintptr_t site,
+                  uint64_t detail, uint64_t count, uint64_t total);
+  static void foldList(FindingMap &map, uintptr_t site,
+                       const ListState &state);
+  static void foldKernel(FindingMap &map, uintptr_t site,
+                         const KernelState &state);
+  ListState &listState(const void *list);
+  void recreated(AntiPattern pattern, const void *context, uint64_t detail);
+  void released(AntiPattern pattern, const ResourceState &state);
+
+  Config config;
+  mutable std::mutex mut;
+  AddressTable<ListState> lists;
+  AddressTable<KernelState> kernels;
+  AddressTable<ResourceState> eventPools;
+  AddressTable<ResourceState> allocations;
+  FindingMap folded; // destroyed objects and per-context patterns
+};
+
+} // namespace validation_layer
@@ -8,20 +8,37 @@
  */
 #include "zel_performance_checker.h"
 
+#include <cstdlib>
+
 namespace validation_layer
 {
     class performanceChecker performance_checker;
 
+    // Command list this thread appended to last, for host waits that name an
+    // event or fence rather than the command list.
+    static thread_local ze_command_list_handle_t lastAppendedCommandList = nullptr;
+
+    static uint64_t getenv_uint64(const char *name, uint64_t defaultValue) {
+        auto value = getenv_string( name );
+        if (value.empty()) {
+            return defaultValue;
+        }
+        return std::strtoull( value.c_str(), nullptr, 10 );
+    }
+
     performanceChecker::performanceChecker() {
         enableperformance = getenv_tobool( "ZEL_ENABLE_PERFORMANCE_CHECKER" );
         if(enableperformance) {
-            performanceChecker::ZEperformanceChecker *zeChecker = new performanceChecker::ZEperformanceChecker;
+            AntiPatternDetector::Config config;
+            config.smallCopyBytes = getenv_uint64( "ZEL_PERFORMANCE_CHECKER_SMALL_COPY_BYTES", config.smallCopyBytes );
+            config.reportThreshold = getenv_uint64( "ZEL_PERFORMANCE_CHECKER_REPORT_THRESHOLD", config.reportThreshold );
+            performanceChecker::ZEperformanceChecker *zeChecker = new performanceChecker::ZEperformanceChecker(config);
             performanceChecker::ZESperformanceChecker *zesChecker = new performanceChecker::ZESperformanceChecker;
             performanceChecker::ZETperformanceChecker *zetChecker = new performanceChecker::ZETperformanceChecker;
             performance_checker.zeValidation = zeChecker;
             performance_checker.zetValidation = zetChecker;
             performance_checker.zesValidation = zesChecker;
-            validation_layer::context.validationHandlers.push_back(&performance_checker);
+            validation_layer::context.registerChecker(zeChecker, zesChecker, zetChecker);
         }
     }
 
@@ -32,7 +49,27 @@ namespace validation_layer
             delete performance_checker.zesValidation;
         }
     }
-    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListCreateImmediateEpilogue(ze_context_handle_t, ze_device_handle_t, const ze_command_queue_desc_t* descriptor, ze_command_list_handle_t*, ze_result_t result)
+
+    performanceChecker::ZEperformanceChecker::ZEperformanceChecker(const AntiPatternDetector::Config &config)
+        : detector(config) {}
+
+    performanceChecker::ZEperformanceChecker::~ZEperformanceChecker() {
+        for (const auto &finding : detector.findings()) {
+            context.logger->log_performance(detector.describe(finding));
+        }
+    }
+
+    void performanceChecker::ZEperformanceChecker::appended(ze_command_list_handle_t hCommandList) {
+        lastAppendedCommandList = hCommandList;
+        detector.commandAppended(hCommandList);
+    }
+
+    void performanceChecker::ZEperformanceChecker::copyAppended(ze_command_list_handle_t hCommandList, size_t size) {
+        lastAppendedCommandList = hCommandList;
+        detector.memoryCopyAppended(hCommandList, size);
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListCreateImmediateEpilogue(ze_context_handle_t, ze_device_handle_t, const ze_command_queue_desc_t* descriptor, ze_command_list_handle_t* phCommandList, ze_result_t result)
     {
         if (result == ZE_RESULT_SUCCESS) {
             if (descriptor->mode & ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS) {
@@ -46,7 +83,369 @@ namespace validation_layer
             else {
                 context.logger->log_performance("Out-of-order command list created. Consider using in-order command lists for better performance.");
             }
+            detector.commandListCreated(*phCommandList, true);
         }
         return result;
     }
-}
\ No newline at end of file
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListCreateEpilogue(ze_context_handle_t, ze_device_handle_t, const ze_command_list_desc_t*, ze_command_list_handle_t* phCommandList, ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            detector.commandListCreated(*phCommandList, false);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListDestroyEpilogue(ze_command_list_handle_t hCommandList, ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            if (lastAppendedCommandList == hCommandList) {
+                lastAppendedCommandList = nullptr;
+            }
+            detector.commandListDestroyed(hCommandList);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListResetEpilogue(ze_command_list_handle_t hCommandList, ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            detector.commandListReset(hCommandList);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListCloseEpilogue(ze_command_list_handle_t hCommandList, ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            detector.commandListClosed(hCommandList);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandQueueExecuteCommandListsEpilogue(ze_command_queue_handle_t, uint32_t numCommandLists, ze_command_list_handle_t* phCommandLists, ze_fence_handle_t, ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            detector.commandListsExecuted(reinterpret_cast<const void *const *>(phCommandLists), numCommandLists);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListImmediateAppendCommandListsExpEpilogue(ze_command_list_handle_t hCommandListImmediate, uint32_t numCommandLists, ze_command_list_handle_t* phCommandLists, ze_event_handle_t, uint32_t, ze_event_handle_t*, ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            appended(hCommandListImmediate);
+            detector.commandListsExecuted(reinterpret_cast<const void *const *>(phCommandLists), numCommandLists);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListHostSynchronizeEpilogue(ze_command_list_handle_t hCommandList, uint64_t, ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            detector.hostSynchronized(hCommandList);
+            if (lastAppendedCommandList == hCommandList) {
+                lastAppendedCommandList = nullptr;
+            }
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeEventHostSynchronizeEpilogue(ze_event_handle_t, uint64_t, ze_result_t result)
+    {
+        // Only a completed wait counts; polling with a zero timeout is not a
+        // synchronization.
+        if (result == ZE_RESULT_SUCCESS && lastAppendedCommandList) {
+            detector.hostSynchronized(lastAppendedCommandList);
+            lastAppendedCommandList = nullptr;
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeFenceHostSynchronizeEpilogue(ze_fence_handle_t, uint64_t, ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS && lastAppendedCommandList) {
+            detector.hostSynchronized(lastAppendedCommandList);
+            lastAppendedCommandList = nullptr;
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeKernelSetGroupSizeEpilogue(ze_kernel_handle_t hKernel, uint32_t groupSizeX, uint32_t groupSizeY, uint32_t groupSizeZ, ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            detector.groupSizeSet(hKernel, groupSizeX, groupSizeY, groupSizeZ);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeKernelSuggestGroupSizeEpilogue(ze_kernel_handle_t hKernel, uint32_t globalSizeX, uint32_t globalSizeY, uint32_t globalSizeZ, uint32_t*, uint32_t*, uint32_t*, ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            detector.groupSizeSuggested(hKernel, globalSizeX, globalSizeY, globalSizeZ);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeKernelDestroyEpilogue(ze_kernel_handle_t hKernel, ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            detector.kernelDestroyed(hKernel);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeEventPoolCreateEpilogue(ze_context_handle_t hContext, const ze_event_pool_desc_t* desc, uint32_t, ze_device_handle_t*, ze_event_pool_handle_t* phEventPool, ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS && desc && phEventPool) {
+            detector.eventPoolCreated(hContext, *phEventPool, desc->flags, desc->count);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeEventPoolDestroyEpilogue(ze_event_pool_handle_t hEventPool, ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            detector.eventPoolDestroyed(hEventPool);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeMemAllocDeviceEpilogue(ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t*, size_t size, size_t, ze_device_handle_t, void** pptr, ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS && pptr) {
+            detector.memoryAllocated(hContext, *pptr, size);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeMemAllocHostEpilogue(ze_context_handle_t hContext, const ze_host_mem_alloc_desc_t*, size_t size, size_t, void** pptr, ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS && pptr) {
+            detector.memoryAllocated(hContext, *pptr, size);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeMemAllocSharedEpilogue(ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t*, const ze_host_mem_alloc_desc_t*, size_t size, size_t, ze_device_handle_t, void** pptr, ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS && pptr) {
+            detector.memoryAllocated(hContext, *pptr, size);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    // Frees are counted before the driver call, while the address cannot yet
+    // be handed out to another thread's allocation.
+    ze_result_t performanceChecker::ZEperformanceChecker::zeMemFreePrologue(ze_context_handle_t, void* ptr)
+    {
+        detector.memoryFreed(ptr);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeMemFreeExtPrologue(ze_context_handle_t, const ze_memory_free_ext_desc_t*, void* ptr)
+    {
+        detector.memoryFreed(ptr);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListAppendMemoryCopyEpilogue(ze_command_list_handle_t hCommandList, void* dstptr, const void* srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            copyAppended(hCommandList, size);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListAppendMemoryCopyWithParametersEpilogue(ze_command_list_handle_t hCommandList, void* dstptr, const void* srcptr, size_t size, const void* pNext, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            copyAppended(hCommandList, size);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListAppendMemoryCopyFromContextEpilogue(ze_command_list_handle_t hCommandList, void* dstptr, ze_context_handle_t hContextSrc, const void* srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            copyAppended(hCommandList, size);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListAppendWriteGlobalTimestampEpilogue(ze_command_list_handle_t hCommandList, uint64_t* dstptr, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            appended(hCommandList);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListAppendBarrierEpilogue(ze_command_list_handle_t hCommandList, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            appended(hCommandList);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListAppendMemoryRangesBarrierEpilogue(ze_command_list_handle_t hCommandList, uint32_t numRanges, const size_t* pRangeSizes, const void** pRanges, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            appended(hCommandList);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListAppendMemoryFillEpilogue(ze_command_list_handle_t hCommandList, void* ptr, const void* pattern, size_t pattern_size, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            appended(hCommandList);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListAppendMemoryFillWithParametersEpilogue(ze_command_list_handle_t hCommandList, void* ptr, const void* pattern, size_t pattern_size, size_t size, const void* pNext, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            appended(hCommandList);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListAppendMemoryCopyRegionEpilogue(ze_command_list_handle_t hCommandList, void* dstptr, const ze_copy_region_t* dstRegion, uint32_t dstPitch, uint32_t dstSlicePitch, const void* srcptr, const ze_copy_region_t* srcRegion, uint32_t srcPitch, uint32_t srcSlicePitch, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            appended(hCommandList);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListAppendImageCopyEpilogue(ze_command_list_handle_t hCommandList, ze_image_handle_t hDstImage, ze_image_handle_t hSrcImage, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            appended(hCommandList);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListAppendImageCopyRegionEpilogue(ze_command_list_handle_t hCommandList, ze_image_handle_t hDstImage, ze_image_handle_t hSrcImage, const ze_image_region_t* pDstRegion, const ze_image_region_t* pSrcRegion, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            appended(hCommandList);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListAppendImageCopyToMemoryEpilogue(ze_command_list_handle_t hCommandList, void* dstptr, ze_image_handle_t hSrcImage, const ze_image_region_t* pSrcRegion, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            appended(hCommandList);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListAppendImageCopyFromMemoryEpilogue(ze_command_list_handle_t hCommandList, ze_image_handle_t hDstImage, const void* srcptr, const ze_image_region_t* pDstRegion, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            appended(hCommandList);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListAppendMemoryPrefetchEpilogue(ze_command_list_handle_t hCommandList, const void* ptr, size_t size , ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            appended(hCommandList);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListAppendMemAdviseEpilogue(ze_command_list_handle_t hCommandList, ze_device_handle_t hDevice, const void* ptr, size_t size, ze_memory_advice_t advice , ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            appended(hCommandList);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListAppendSignalEventEpilogue(ze_command_list_handle_t hCommandList, ze_event_handle_t hEvent , ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            appended(hCommandList);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListAppendWaitOnEventsEpilogue(ze_command_list_handle_t hCommandList, uint32_t numEvents, ze_event_handle_t* phEvents , ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            appended(hCommandList);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListAppendEventResetEpilogue(ze_command_list_handle_t hCommandList, ze_event_handle_t hEvent , ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            appended(hCommandList);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListAppendQueryKernelTimestampsEpilogue(ze_command_list_handle_t hCommandList, uint32_t numEvents, ze_event_handle_t* phEvents, void* dstptr, const size_t* pOffsets, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            appended(hCommandList);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListAppendLaunchKernelEpilogue(ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pLaunchFuncArgs, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            appended(hCommandList);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListAppendLaunchKernelWithParametersEpilogue(ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pGroupCounts, const void * pNext, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            appended(hCommandList);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListAppendLaunchKernelWithArgumentsEpilogue(ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t groupCounts, const ze_group_size_t groupSizes, void ** pArguments, const void * pNext, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            appended(hCommandList);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListAppendLaunchCooperativeKernelEpilogue(ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pLaunchFuncArgs, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            appended(hCommandList);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListAppendLaunchKernelIndirectEpilogue(ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pLaunchArgumentsBuffer, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            appended(hCommandList);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t performanceChecker::ZEperformanceChecker::zeCommandListAppendLaunchMultipleKernelsIndirectEpilogue(ze_command_list_handle_t hCommandList, uint32_t numKernels, ze_kernel_handle_t* phKernels, const uint32_t* pCountBuffer, const ze_group_count_t* pLaunchArgumentsBuffer, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result)
+    {
+        if (result == ZE_RESULT_SUCCESS) {
+            appended(hCommandList);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+}
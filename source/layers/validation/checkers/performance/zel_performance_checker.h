@@ -13,16 +13,76 @@
 #include <string>
 #include "ze_api.h"
 #include "ze_validation_layer.h"
+#include "anti_pattern_detector.h"
 
 namespace validation_layer
 {
+    // Checks command list descriptors against best practices as they are
+    // created, and counts hot-path anti-patterns (see AntiPatternDetector)
+    // which are reported once per site, with counts, in the dtor.
     class __zedlllocal performanceChecker : public validationChecker{
         public:
             performanceChecker();
             ~performanceChecker();
 
             class ZEperformanceChecker : public ZEValidationEntryPoints {
+            public:
+                explicit ZEperformanceChecker(const AntiPatternDetector::Config &config);
+                ~ZEperformanceChecker();
+
                 ze_result_t zeCommandListCreateImmediateEpilogue(ze_context_handle_t, ze_device_handle_t, const ze_command_queue_desc_t*, ze_command_list_handle_t*, ze_result_t result) override;
+                ze_result_t zeCommandListCreateEpilogue(ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_list_desc_t* desc, ze_command_list_handle_t* phCommandList , ze_result_t result) override;
+                ze_result_t zeCommandListDestroyEpilogue(ze_command_list_handle_t hCommandList , ze_result_t result) override;
+                ze_result_t zeCommandListResetEpilogue(ze_command_list_handle_t hCommandList , ze_result_t result) override;
+                ze_result_t zeCommandListCloseEpilogue(ze_command_list_handle_t hCommandList , ze_result_t result) override;
+                ze_result_t zeCommandQueueExecuteCommandListsEpilogue(ze_command_queue_handle_t hCommandQueue, uint32_t numCommandLists, ze_command_list_handle_t* phCommandLists, ze_fence_handle_t hFence , ze_result_t result) override;
+                ze_result_t zeCommandListImmediateAppendCommandListsExpEpilogue(ze_command_list_handle_t hCommandListImmediate, uint32_t numCommandLists, ze_command_list_handle_t* phCommandLists, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result) override;
+                ze_result_t zeCommandListHostSynchronizeEpilogue(ze_command_list_handle_t hCommandList, uint64_t timeout , ze_result_t result) override;
+                ze_result_t zeEventHostSynchronizeEpilogue(ze_event_handle_t hEvent, uint64_t timeout , ze_result_t result) override;
+                ze_result_t zeFenceHostSynchronizeEpilogue(ze_fence_handle_t hFence, uint64_t timeout , ze_result_t result) override;
+                ze_result_t zeKernelSetGroupSizeEpilogue(ze_kernel_handle_t hKernel, uint32_t groupSizeX, uint32_t groupSizeY, uint32_t groupSizeZ , ze_result_t result) override;
+                ze_result_t zeKernelSuggestGroupSizeEpilogue(ze_kernel_handle_t hKernel, uint32_t globalSizeX, uint32_t globalSizeY, uint32_t globalSizeZ, uint32_t* groupSizeX, uint32_t* groupSizeY, uint32_t* groupSizeZ , ze_result_t result) override;
+                ze_result_t zeKernelDestroyEpilogue(ze_kernel_handle_t hKernel , ze_result_t result) override;
+                ze_result_t zeEventPoolCreateEpilogue(ze_context_handle_t hContext, const ze_event_pool_desc_t* desc, uint32_t numDevices, ze_device_handle_t* phDevices, ze_event_pool_handle_t* phEventPool , ze_result_t result) override;
+                ze_result_t zeEventPoolDestroyEpilogue(ze_event_pool_handle_t hEventPool , ze_result_t result) override;
+                ze_result_t zeMemAllocDeviceEpilogue(ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t* device_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void** pptr , ze_result_t result) override;
+                ze_result_t zeMemAllocHostEpilogue(ze_context_handle_t hContext, const ze_host_mem_alloc_desc_t* host_desc, size_t size, size_t alignment, void** pptr , ze_result_t result) override;
+                ze_result_t zeMemAllocSharedEpilogue(ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t* device_desc, const ze_host_mem_alloc_desc_t* host_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void** pptr , ze_result_t result) override;
+                ze_result_t zeMemFreePrologue(ze_context_handle_t hContext, void* ptr) override;
+                ze_result_t zeMemFreeExtPrologue(ze_context_handle_t hContext, const ze_memory_free_ext_desc_t* pMemFreeDesc, void* ptr) override;
+
+                // Copies are checked for size; every append counts toward
+                // single-command lists and host syncs after each append.
+                ze_result_t zeCommandListAppendMemoryCopyEpilogue(ze_command_list_handle_t hCommandList, void* dstptr, const void* srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result) override;
+                ze_result_t zeCommandListAppendMemoryCopyWithParametersEpilogue(ze_command_list_handle_t hCommandList, void* dstptr, const void* srcptr, size_t size, const void* pNext, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result) override;
+                ze_result_t zeCommandListAppendMemoryCopyFromContextEpilogue(ze_command_list_handle_t hCommandList, void* dstptr, ze_context_handle_t hContextSrc, const void* srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result) override;
+                ze_result_t zeCommandListAppendWriteGlobalTimestampEpilogue(ze_command_list_handle_t hCommandList, uint64_t* dstptr, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result) override;
+                ze_result_t zeCommandListAppendBarrierEpilogue(ze_command_list_handle_t hCommandList, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result) override;
+                ze_result_t zeCommandListAppendMemoryRangesBarrierEpilogue(ze_command_list_handle_t hCommandList, uint32_t numRanges, const size_t* pRangeSizes, const void** pRanges, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result) override;
+                ze_result_t zeCommandListAppendMemoryFillEpilogue(ze_command_list_handle_t hCommandList, void* ptr, const void* pattern, size_t pattern_size, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result) override;
+                ze_result_t zeCommandListAppendMemoryFillWithParametersEpilogue(ze_command_list_handle_t hCommandList, void* ptr, const void* pattern, size_t pattern_size, size_t size, const void* pNext, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result) override;
+                ze_result_t zeCommandListAppendMemoryCopyRegionEpilogue(ze_command_list_handle_t hCommandList, void* dstptr, const ze_copy_region_t* dstRegion, uint32_t dstPitch, uint32_t dstSlicePitch, const void* srcptr, const ze_copy_region_t* srcRegion, uint32_t srcPitch, uint32_t srcSlicePitch, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result) override;
+                ze_result_t zeCommandListAppendImageCopyEpilogue(ze_command_list_handle_t hCommandList, ze_image_handle_t hDstImage, ze_image_handle_t hSrcImage, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result) override;
+                ze_result_t zeCommandListAppendImageCopyRegionEpilogue(ze_command_list_handle_t hCommandList, ze_image_handle_t hDstImage, ze_image_handle_t hSrcImage, const ze_image_region_t* pDstRegion, const ze_image_region_t* pSrcRegion, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result) override;
+                ze_result_t zeCommandListAppendImageCopyToMemoryEpilogue(ze_command_list_handle_t hCommandList, void* dstptr, ze_image_handle_t hSrcImage, const ze_image_region_t* pSrcRegion, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result) override;
+                ze_result_t zeCommandListAppendImageCopyFromMemoryEpilogue(ze_command_list_handle_t hCommandList, ze_image_handle_t hDstImage, const void* srcptr, const ze_image_region_t* pDstRegion, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result) override;
+                ze_result_t zeCommandListAppendMemoryPrefetchEpilogue(ze_command_list_handle_t hCommandList, const void* ptr, size_t size , ze_result_t result) override;
+                ze_result_t zeCommandListAppendMemAdviseEpilogue(ze_command_list_handle_t hCommandList, ze_device_handle_t hDevice, const void* ptr, size_t size, ze_memory_advice_t advice , ze_result_t result) override;
+                ze_result_t zeCommandListAppendSignalEventEpilogue(ze_command_list_handle_t hCommandList, ze_event_handle_t hEvent , ze_result_t result) override;
+                ze_result_t zeCommandListAppendWaitOnEventsEpilogue(ze_command_list_handle_t hCommandList, uint32_t numEvents, ze_event_handle_t* phEvents , ze_result_t result) override;
+                ze_result_t zeCommandListAppendEventResetEpilogue(ze_command_list_handle_t hCommandList, ze_event_handle_t hEvent , ze_result_t result) override;
+                ze_result_t zeCommandListAppendQueryKernelTimestampsEpilogue(ze_command_list_handle_t hCommandList, uint32_t numEvents, ze_event_handle_t* phEvents, void* dstptr, const size_t* pOffsets, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result) override;
+                ze_result_t zeCommandListAppendLaunchKernelEpilogue(ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pLaunchFuncArgs, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result) override;
+                ze_result_t zeCommandListAppendLaunchKernelWithParametersEpilogue(ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pGroupCounts, const void * pNext, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result) override;
+                ze_result_t zeCommandListAppendLaunchKernelWithArgumentsEpilogue(ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t groupCounts, const ze_group_size_t groupSizes, void ** pArguments, const void * pNext, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result) override;
+                ze_result_t zeCommandListAppendLaunchCooperativeKernelEpilogue(ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pLaunchFuncArgs, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result) override;
+                ze_result_t zeCommandListAppendLaunchKernelIndirectEpilogue(ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pLaunchArgumentsBuffer, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result) override;
+                ze_result_t zeCommandListAppendLaunchMultipleKernelsIndirectEpilogue(ze_command_list_handle_t hCommandList, uint32_t numKernels, ze_kernel_handle_t* phKernels, const uint32_t* pCountBuffer, const ze_group_count_t* pLaunchArgumentsBuffer, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents , ze_result_t result) override;
+            private:
+                void appended(ze_command_list_handle_t hCommandList);
+                void copyAppended(ze_command_list_handle_t hCommandList, size_t size);
+
+                AntiPatternDetector detector;
             };
             class ZESperformanceChecker : public ZESValidationEntryPoints {};
             class ZETperformanceChecker : public ZETValidationEntryPoints {};
@@ -21,11 +21,18 @@ typedef ptrdiff_t ssize_t;
 #include <sys/resource.h>
 #include <unistd.h>
 #endif
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
 #include <cstring>
+#include <memory>
 #include <mutex>
 #include <chrono>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 extern validation_layer::context_t& validation_layer::context;
 
@@ -97,6 +104,147 @@ namespace validation_layer
         }
     };
 
+    // Latest process metrics published by the background sampler. There is a single writer; readers never
+    // block, they copy the fields and retry if the sampler published a new snapshot meanwhile.
+    class MetricsSnapshot {
+        public:
+            void store(const SystemResourceMetrics& metrics) {
+                const uint64_t seq = sequence.load(std::memory_order_relaxed);
+                sequence.store(seq + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                vmSize.store(metrics.vmSize, std::memory_order_relaxed);
+                vmRSS.store(metrics.vmRSS, std::memory_order_relaxed);
+                vmData.store(metrics.vmData, std::memory_order_relaxed);
+                vmPeak.store(metrics.vmPeak, std::memory_order_relaxed);
+                numThreads.store(metrics.numThreads, std::memory_order_relaxed);
+                numFDs.store(metrics.numFDs, std::memory_order_relaxed);
+                sequence.store(seq + 2, std::memory_order_release);
+            }
+
+            SystemResourceMetrics load() const {
+                SystemResourceMetrics metrics;
+                for (;;) {
+                    const uint64_t before = sequence.load(std::memory_order_acquire);
+                    if (before & 1) {
+                        continue; // sampler is publishing
+                    }
+                    metrics.vmSize = vmSize.load(std::memory_order_relaxed);
+                    metrics.vmRSS = vmRSS.load(std::memory_order_relaxed);
+                    metrics.vmData = vmData.load(std::memory_order_relaxed);
+                    metrics.vmPeak = vmPeak.load(std::memory_order_relaxed);
+                    metrics.numThreads = numThreads.load(std::memory_order_relaxed);
+                    metrics.numFDs = numFDs.load(std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (sequence.load(std::memory_order_relaxed) == before) {
+                        return metrics;
+                    }
+                }
+            }
+
+        private:
+            std::atomic<uint64_t> sequence{0};
+            std::atomic<size_t> vmSize{0};
+            std::atomic<size_t> vmRSS{0};
+            std::atomic<size_t> vmData{0};
+            std::atomic<size_t> vmPeak{0};
+            std::atomic<size_t> numThreads{0};
+            std::atomic<size_t> numFDs{0};
+    };
+
+    // One CSV line, captured by value when the API call completes and formatted later.
+    struct CsvRow {
+        static constexpr size_t apiCallCapacity = 64;
+
+        uint64_t callNumber = 0;
+        int64_t elapsedMs = 0;
+        char apiCall[apiCallCapacity] = {};
+        SystemResourceMetrics current;
+        SystemResourceMetrics delta;
+        size_t contextCount = 0;
+        size_t commandQueueCount = 0;
+        size_t moduleCount = 0;
+        size_t kernelCount = 0;
+        size_t eventPoolCount = 0;
+        size_t commandListCount = 0;
+        size_t eventCount = 0;
+        size_t fenceCount = 0;
+        size_t imageCount = 0;
+        size_t samplerCount = 0;
+        size_t totalMemoryAllocated = 0;
+    };
+
+    // Bounded multi-producer ring of the CSV rows queued in sampled mode. API threads claim a slot with a CAS
+    // on the enqueue position and never block: when the sampler has fallen a full ring behind, the row is
+    // dropped and counted. The claimed position is the row's call number, so rows pop in call number order
+    // and dropped rows leave no gaps. Only the sampler thread, or the destructor once it has joined the
+    // sampler, pops.
+    class CsvRowQueue {
+        public:
+            static constexpr size_t capacity = 4096; // power of two
+
+            CsvRowQueue() : slots(new Slot[capacity]) {
+                for (size_t i = 0; i < capacity; ++i) {
+                    slots[i].sequence.store(i, std::memory_order_relaxed);
+                }
+            }
+
+            bool push(const CsvRow& row) {
+                size_t pos = enqueuePos.load(std::memory_order_relaxed);
+                for (;;) {
+                    Slot& slot = slots[pos & (capacity - 1)];
+                    const size_t seq = slot.sequence.load(std::memory_order_acquire);
+                    const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+                    if (diff == 0) {
+                        if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                            slot.row = row;
+                            slot.row.callNumber = pos;
+                            slot.sequence.store(pos + 1, std::memory_order_release);
+                            return true;
+                        }
+                    } else if (diff < 0) {
+                        dropped.fetch_add(1, std::memory_order_relaxed);
+                        return false;
+                    } else {
+                        pos = enqueuePos.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            bool pop(CsvRow& row) {
+                const size_t pos = dequeuePos.load(std::memory_order_relaxed);
+                Slot& slot = slots[pos & (capacity - 1)];
+                if (slot.sequence.load(std::memory_order_acquire) != pos + 1) {
+                    return false;
+                }
+                row = slot.row;
+                slot.sequence.store(pos + capacity, std::memory_order_release);
+                dequeuePos.store(pos + 1, std::memory_order_relaxed);
+                return true;
+            }
+
+            // True once half of the ring waits to be written. Producers call it without synchronizing with
+            // the sampler, so it is only an estimate.
+            bool isBacklogged() const {
+                return enqueuePos.load(std::memory_order_relaxed) -
+                       dequeuePos.load(std::memory_order_relaxed) >= capacity / 2;
+            }
+
+            uint64_t takeDropped() { return dropped.exchange(0, std::memory_order_relaxed); }
+
+        private:
+            struct Slot {
+                std::atomic<size_t> sequence;
+                CsvRow row;
+            };
+
+            std::unique_ptr<Slot[]> slots;
+            std::atomic<size_t> enqueuePos{0};
+            std::atomic<size_t> dequeuePos{0};
+            std::atomic<uint64_t> dropped{0};
+    };
+
+    constexpr size_t CsvRowQueue::capacity;
+
     // Structure to track resource usage by L0 resource type
     struct ResourceTracker {
         SystemResourceMetrics baseline;
@@ -112,26 +260,38 @@ namespace validation_layer
         SystemResourceMetrics samplers;
         SystemResourceMetrics memoryAllocations;
         
-        size_t contextCount = 0;
-        size_t commandQueueCount = 0;
-        size_t moduleCount = 0;
-        size_t kernelCount = 0;
-        size_t eventPoolCount = 0;
-        size_t commandListCount = 0;
-        size_t eventCount = 0;
-        size_t fenceCount = 0;
-        size_t imageCount = 0;
-        size_t samplerCount = 0;
-        size_t totalMemoryAllocated = 0;  // in bytes
+        // Updated under trackerMutex; atomic so that sampled-mode CSV rows can read them without it.
+        std::atomic<size_t> contextCount{0};
+        std::atomic<size_t> commandQueueCount{0};
+        std::atomic<size_t> moduleCount{0};
+        std::atomic<size_t> kernelCount{0};
+        std::atomic<size_t> eventPoolCount{0};
+        std::atomic<size_t> commandListCount{0};
+        std::atomic<size_t> eventCount{0};
+        std::atomic<size_t> fenceCount{0};
+        std::atomic<size_t> imageCount{0};
+        std::atomic<size_t> samplerCount{0};
+        std::atomic<size_t> totalMemoryAllocated{0};  // in bytes
 
         std::mutex trackerMutex;
         std::ofstream* csvFile = nullptr;
         bool csvEnabled = false;
-        uint64_t callCounter = 0;
+        std::atomic<uint64_t> callCounter{0};
         std::chrono::time_point<std::chrono::steady_clock> startTime;
-        
-        // Pre-call metrics storage for CommandListAppend operations
-        std::unordered_map<std::thread::id, SystemResourceMetrics> appendCallPreMetrics;
+
+        // Sampled mode (ZEL_SYSTEM_RESOURCE_TRACKER_SAMPLE_INTERVAL_MS): a background thread reads the process
+        // metrics at a fixed rate into latestMetrics, API calls queue CSV rows into pendingRows without taking
+        // trackerMutex, and the thread writes the queued rows in batches. Create and destroy calls still take
+        // trackerMutex to update the handle-to-metrics maps below; append calls take no lock.
+        bool sampled = false;
+        uint32_t sampleIntervalMs = 0;
+        MetricsSnapshot latestMetrics;
+        std::unique_ptr<CsvRowQueue> pendingRows;
+        uint64_t totalDroppedRows = 0; // sampler thread only
+        std::thread sampler;
+        std::mutex samplerMutex;
+        std::condition_variable samplerCv;
+        bool samplerStop = false; // guarded by samplerMutex
         
         // Handle-to-metrics maps for leak detection on destroy
         std::unordered_map<void*, SystemResourceMetrics> contextMetrics;
@@ -166,12 +326,13 @@ namespace validation_layer
     }
 
     // Forward declarations
+    static SystemResourceMetrics readSystemResourceMetrics();
     static SystemResourceMetrics getSystemResourceMetrics();
     static void writeCsvData(const std::string& apiCall, const SystemResourceMetrics& current, const SystemResourceMetrics& delta, bool checkLeak);
 
 #ifdef _WIN32
     // Helper function to read system resource metrics (Windows)
-    static SystemResourceMetrics getSystemResourceMetrics() {
+    static SystemResourceMetrics readSystemResourceMetrics() {
         SystemResourceMetrics metrics;
 
         PROCESS_MEMORY_COUNTERS_EX pmc;
@@ -214,7 +375,7 @@ namespace validation_layer
     }
 #else
     // Helper function to read system resource metrics from /proc/self/status
-    static SystemResourceMetrics getSystemResourceMetrics() {
+    static SystemResourceMetrics readSystemResourceMetrics() {
         SystemResourceMetrics metrics;
         
         std::ifstream statusFile("/proc/self/status");
@@ -260,49 +421,134 @@ namespace validation_layer
     }
 #endif
 
-    // Helper function to write CSV data with signed deltas (assumes mutex is already held by caller)
+    // Current process metrics: the sampler's latest snapshot in sampled mode, otherwise read on the spot
+    static SystemResourceMetrics getSystemResourceMetrics() {
+        if (getResourceTracker().sampled) {
+            return getResourceTracker().latestMetrics.load();
+        }
+        return readSystemResourceMetrics();
+    }
+
+    static void formatCsvRow(std::ostream& out, const CsvRow& row) {
+        out << row.callNumber << ","
+            << row.elapsedMs << ","
+            << row.apiCall << ","
+            << row.current.vmSize << ","
+            << row.current.vmRSS << ","
+            << row.current.vmData << ","
+            << row.current.vmPeak << ","
+            << row.current.numThreads << ","
+            << row.delta.vmSize << ","
+            << row.delta.vmRSS << ","
+            << row.delta.vmData << ","
+            << row.contextCount << ","
+            << row.commandQueueCount << ","
+            << row.moduleCount << ","
+            << row.kernelCount << ","
+            << row.eventPoolCount << ","
+            << row.commandListCount << ","
+            << row.eventCount << ","
+            << row.fenceCount << ","
+            << row.imageCount << ","
+            << row.samplerCount << ","
+            << row.totalMemoryAllocated << "\n";
+    }
+
+    // Writes the rows queued in sampled mode. Only the sampler thread, and the destructor once it has joined
+    // the sampler, call this, so the CSV stream itself needs no lock.
+    static void writePendingCsvRows() {
+        ResourceTracker& tracker = getResourceTracker();
+        std::ostringstream batch;
+        CsvRow row;
+        bool written = false;
+        while (tracker.pendingRows->pop(row)) {
+            formatCsvRow(batch, row);
+            written = true;
+        }
+        if (written) {
+            (*tracker.csvFile) << batch.str();
+            tracker.csvFile->flush();
+        }
+        const uint64_t dropped = tracker.pendingRows->takeDropped();
+        if (dropped > 0) {
+            tracker.totalDroppedRows += dropped;
+            context.logger->log_warning("System Resource Tracker dropped " + std::to_string(dropped) +
+                                        " CSV rows, the sampled row queue was full");
+        }
+    }
+
+    static void samplerLoop() {
+        ResourceTracker& tracker = getResourceTracker();
+        const auto interval = std::chrono::milliseconds(tracker.sampleIntervalMs);
+        auto nextSample = std::chrono::steady_clock::now();
+        std::unique_lock<std::mutex> lock(tracker.samplerMutex);
+        while (!tracker.samplerStop) {
+            lock.unlock();
+            // API threads wake the sampler early when the row queue fills up; metrics keep the set interval.
+            if (std::chrono::steady_clock::now() >= nextSample) {
+                tracker.latestMetrics.store(readSystemResourceMetrics());
+                nextSample = std::chrono::steady_clock::now() + interval;
+            }
+            if (tracker.csvEnabled) {
+                writePendingCsvRows();
+            }
+            lock.lock();
+            tracker.samplerCv.wait_until(lock, nextSample);
+        }
+    }
+
+    // Helper function to write CSV data with signed deltas (assumes mutex is already held by caller, except in
+    // sampled mode, where rows are only queued)
     static void writeCsvData(const std::string& apiCall, const SystemResourceMetrics& current, const SystemResourceMetrics& delta, bool checkLeak = false) {
-        if (!getResourceTracker().csvEnabled || !getResourceTracker().csvFile || !getResourceTracker().csvFile->is_open()) {
-            context.logger->log_debug("writeCsvData skipped: csvEnabled=" + std::string(getResourceTracker().csvEnabled ? "true" : "false") + 
-                                     ", csvFile=" + std::string(getResourceTracker().csvFile ? "not-null" : "null") +
-                                     ", is_open=" + std::string((getResourceTracker().csvFile && getResourceTracker().csvFile->is_open()) ? "true" : "false") +
-                                     ", resourceTracker@" + std::to_string(reinterpret_cast<uintptr_t>(&getResourceTracker())));
+        ResourceTracker& tracker = getResourceTracker();
+        if (!tracker.csvEnabled || !tracker.csvFile || !tracker.csvFile->is_open()) {
+            if (context.logger->shouldLog(loader::LogLevel::debug)) {
+                context.logger->log_debug("writeCsvData skipped: csvEnabled=" + std::string(tracker.csvEnabled ? "true" : "false") + 
+                                         ", csvFile=" + std::string(tracker.csvFile ? "not-null" : "null") +
+                                         ", is_open=" + std::string((tracker.csvFile && tracker.csvFile->is_open()) ? "true" : "false") +
+                                         ", resourceTracker@" + std::to_string(reinterpret_cast<uintptr_t>(&tracker)));
+            }
             return;
         }
-        context.logger->log_debug("writeCsvData writing: " + apiCall + ", resourceTracker@" + std::to_string(reinterpret_cast<uintptr_t>(&getResourceTracker())));
+        if (context.logger->shouldLog(loader::LogLevel::debug)) {
+            context.logger->log_debug("writeCsvData writing: " + apiCall + ", resourceTracker@" + std::to_string(reinterpret_cast<uintptr_t>(&tracker)));
+        }
         
         auto now = std::chrono::steady_clock::now();
-        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - getResourceTracker().startTime).count();
-        
-        // Build the CSV line as a string first to ensure atomic write
-        std::ostringstream csvLine;
-        csvLine << getResourceTracker().callCounter << ","
-                << elapsed << ","
-                << apiCall << ","
-                << current.vmSize << ","
-                << current.vmRSS << ","
-                << current.vmData << ","
-                << current.vmPeak << ","
-                << current.numThreads << ","
-                << delta.vmSize << ","
-                << delta.vmRSS << ","
-                << delta.vmData << ","
-                << getResourceTracker().contextCount << ","
-                << getResourceTracker().commandQueueCount << ","
-                << getResourceTracker().moduleCount << ","
-                << getResourceTracker().kernelCount << ","
-                << getResourceTracker().eventPoolCount << ","
-                << getResourceTracker().commandListCount << ","
-                << getResourceTracker().eventCount << ","
-                << getResourceTracker().fenceCount << ","
-                << getResourceTracker().imageCount << ","
-                << getResourceTracker().samplerCount << ","
-                << getResourceTracker().totalMemoryAllocated << "\n";
         
-        // Write the complete line atomically
-        (*getResourceTracker().csvFile) << csvLine.str();
-        getResourceTracker().csvFile->flush();
-        getResourceTracker().callCounter++;
+        CsvRow row;
+        row.elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(now - tracker.startTime).count();
+        const size_t apiCallLength = (std::min)(apiCall.size(), CsvRow::apiCallCapacity - 1);
+        std::memcpy(row.apiCall, apiCall.data(), apiCallLength);
+        row.apiCall[apiCallLength] = '\0';
+        row.current = current;
+        row.delta = delta;
+        row.contextCount = tracker.contextCount;
+        row.commandQueueCount = tracker.commandQueueCount;
+        row.moduleCount = tracker.moduleCount;
+        row.kernelCount = tracker.kernelCount;
+        row.eventPoolCount = tracker.eventPoolCount;
+        row.commandListCount = tracker.commandListCount;
+        row.eventCount = tracker.eventCount;
+        row.fenceCount = tracker.fenceCount;
+        row.imageCount = tracker.imageCount;
+        row.samplerCount = tracker.samplerCount;
+        row.totalMemoryAllocated = tracker.totalMemoryAllocated;
+
+        if (tracker.sampled) {
+            // The sampler thread formats and writes it with the next batch; a full queue drops the row.
+            // The queue numbers the row as it claims the slot.
+            if (tracker.pendingRows->push(row) && tracker.pendingRows->isBacklogged()) {
+                tracker.samplerCv.notify_one();
+            }
+        } else {
+            row.callNumber = tracker.callCounter.fetch_add(1, std::memory_order_relaxed);
+            // Build the CSV line as a string first to ensure atomic write
+            std::ostringstream csvLine;
+            formatCsvRow(csvLine, row);
+            (*tracker.csvFile) << csvLine.str();
+            tracker.csvFile->flush();
+        }
         
         // Check for memory leaks in Append operations
         if (checkLeak && (delta.vmRSS > 1024 || delta.vmSize > 1024)) {  // Leak threshold: 1MB
@@ -313,21 +559,35 @@ namespace validation_layer
         }
     }
 
+    // Pre-call metrics of the thread's API call in progress, set by the prologue and consumed by the epilogue
+    struct AppendCallPreMetrics {
+        bool valid;
+        SystemResourceMetrics metrics;
+    };
+
+    static AppendCallPreMetrics& threadPreMetrics() {
+        static thread_local AppendCallPreMetrics preMetrics = {};
+        return preMetrics;
+    }
+
     // Generic Prologue handler for Append operations
     static void handleAppendPrologue() {
-        std::lock_guard<std::mutex> lock(getResourceTracker().trackerMutex);
-        getResourceTracker().appendCallPreMetrics[std::this_thread::get_id()] = getSystemResourceMetrics();
+        AppendCallPreMetrics& pre = threadPreMetrics();
+        pre.metrics = getSystemResourceMetrics();
+        pre.valid = true;
     }
 
-    // Generic Epilogue handler for Append operations with leak detection
+    // Generic Epilogue handler for Append operations with leak detection. In sampled mode it takes no lock.
     static void handleAppendEpilogue(const std::string& apiName, const std::string& additionalInfo = "") {
-        std::lock_guard<std::mutex> lock(getResourceTracker().trackerMutex);
-        auto threadId = std::this_thread::get_id();
-        auto preIt = getResourceTracker().appendCallPreMetrics.find(threadId);
+        std::unique_lock<std::mutex> lock(getResourceTracker().trackerMutex, std::defer_lock);
+        if (!getResourceTracker().sampled) {
+            lock.lock();
+        }
+        AppendCallPreMetrics& pre = threadPreMetrics();
         
-        if (preIt != getResourceTracker().appendCallPreMetrics.end()) {
+        if (pre.valid) {
             SystemResourceMetrics current = getSystemResourceMetrics();
-            auto signedDelta = current.signedDiff(preIt->second);
+            auto signedDelta = current.signedDiff(pre.metrics);
             
             // Create unsigned delta for CSV output (absolute values)
             SystemResourceMetrics absDelta;
@@ -335,19 +595,24 @@ namespace validation_layer
             absDelta.vmRSS = std::abs(signedDelta.vmRSS);
             absDelta.vmData = std::abs(signedDelta.vmData);
             
-            context.logger->log_debug("handleAppendEpilogue BEFORE writeCsvData: csvEnabled=" + std::string(getResourceTracker().csvEnabled ? "true" : "false") +
-                                    ", csvFile=" + std::string(getResourceTracker().csvFile ? "not-null" : "null"));
+            const bool debugEnabled = context.logger->shouldLog(loader::LogLevel::debug);
+            if (debugEnabled) {
+                context.logger->log_debug("handleAppendEpilogue BEFORE writeCsvData: csvEnabled=" + std::string(getResourceTracker().csvEnabled ? "true" : "false") +
+                                        ", csvFile=" + std::string(getResourceTracker().csvFile ? "not-null" : "null"));
+            }
             writeCsvData(apiName, current, absDelta, true);
             
-            std::ostringstream msg;
-            msg << apiName << ": " << additionalInfo
-                << (additionalInfo.empty() ? "" : ", ")
-                << "Delta: VmRSS=" << (signedDelta.vmRSS >= 0 ? "+" : "") << signedDelta.vmRSS 
-                << "KB, VmSize=" << (signedDelta.vmSize >= 0 ? "+" : "") << signedDelta.vmSize 
-                << "KB, VmData=" << (signedDelta.vmData >= 0 ? "+" : "") << signedDelta.vmData << "KB";
-            context.logger->log_debug(msg.str());
+            if (debugEnabled) {
+                std::ostringstream msg;
+                msg << apiName << ": " << additionalInfo
+                    << (additionalInfo.empty() ? "" : ", ")
+                    << "Delta: VmRSS=" << (signedDelta.vmRSS >= 0 ? "+" : "") << signedDelta.vmRSS 
+                    << "KB, VmSize=" << (signedDelta.vmSize >= 0 ? "+" : "") << signedDelta.vmSize 
+                    << "KB, VmData=" << (signedDelta.vmData >= 0 ? "+" : "") << signedDelta.vmData << "KB";
+                context.logger->log_debug(msg.str());
+            }
             
-            getResourceTracker().appendCallPreMetrics.erase(preIt);
+            pre.valid = false;
         }
     }
 
@@ -372,6 +637,9 @@ namespace validation_layer
 
     // Helper function to log resource summary (assumes mutex is already held by caller)
     static void logResourceSummary() {
+        if (!context.logger->shouldLog(loader::LogLevel::debug)) {
+            return;
+        }
         SystemResourceMetrics current = getSystemResourceMetrics();
         
         std::ostringstream msg;
@@ -448,7 +716,7 @@ namespace validation_layer
                                ", enabled=" + std::string(enablesystem_resource_tracker ? "true" : "false"));
         if(enablesystem_resource_tracker) {
             // Capture baseline metrics
-            getResourceTracker().baseline = getSystemResourceMetrics();
+            getResourceTracker().baseline = readSystemResourceMetrics();
             getResourceTracker().startTime = std::chrono::steady_clock::now();
             context.logger->log_info("System Resource Tracker initialized with baseline metrics, resourceTracker@" + 
                                    std::to_string(reinterpret_cast<uintptr_t>(&getResourceTracker())));
@@ -505,6 +773,26 @@ namespace validation_layer
 #ifdef _WIN32
             free(csvPath);
 #endif
+
+            auto sampleInterval = getenv_string( "ZEL_SYSTEM_RESOURCE_TRACKER_SAMPLE_INTERVAL_MS" );
+            if (!sampleInterval.empty()) {
+                auto intervalMs = std::strtoul( sampleInterval.c_str(), nullptr, 10 );
+#ifdef _WIN32
+                // Joining the sampler from the layer's static destructors would deadlock on the loader lock.
+                (void)intervalMs;
+                context.logger->log_info("System Resource Tracker sampling is not supported on Windows, reading metrics per call");
+#else
+                if (intervalMs > 0 && intervalMs <= UINT32_MAX) {
+                    ResourceTracker& tracker = getResourceTracker();
+                    tracker.sampleIntervalMs = static_cast<uint32_t>( intervalMs );
+                    tracker.latestMetrics.store(tracker.baseline);
+                    tracker.pendingRows.reset(new CsvRowQueue);
+                    tracker.sampled = true;
+                    tracker.sampler = std::thread(samplerLoop);
+                    context.logger->log_info("System Resource Tracker sampling metrics every " + std::to_string(intervalMs) + "ms");
+                }
+#endif
+            }
             
             system_resource_trackerChecker::ZEsystem_resource_trackerChecker *zeChecker = new system_resource_trackerChecker::ZEsystem_resource_trackerChecker;
             system_resource_trackerChecker::ZESsystem_resource_trackerChecker *zesChecker = new system_resource_trackerChecker::ZESsystem_resource_trackerChecker;
@@ -513,7 +801,7 @@ namespace validation_layer
             system_resource_tracker_checker.zetValidation = zetChecker;
             system_resource_tracker_checker.zesValidation = zesChecker;
             context.logger->log_info("Registering system_resource_tracker_checker @ " + std::to_string(reinterpret_cast<uintptr_t>(&system_resource_tracker_checker)));
-            validation_layer::context.validationHandlers.push_back(&system_resource_tracker_checker);
+            validation_layer::context.registerChecker(zeChecker, zesChecker, zetChecker);
             context.logger->log_info("system_resource_tracker_checker registered successfully");
         }
     }
@@ -586,6 +874,23 @@ namespace validation_layer
                 context.logger->log_info(leakSummary.str());
             }
             
+            if (getResourceTracker().sampler.joinable()) {
+                {
+                    std::lock_guard<std::mutex> lock(getResourceTracker().samplerMutex);
+                    getResourceTracker().samplerStop = true;
+                }
+                getResourceTracker().samplerCv.notify_one();
+                getResourceTracker().sampler.join();
+                if (getResourceTracker().csvEnabled) {
+                    writePendingCsvRows();
+                    if (getResourceTracker().totalDroppedRows > 0) {
+                        context.logger->log_warning("System Resource Tracker dropped " +
+                                                    std::to_string(getResourceTracker().totalDroppedRows) +
+                                                    " CSV rows in total, see the gaps in CallNumber");
+                    }
+                }
+            }
+
             if (getResourceTracker().csvEnabled && getResourceTracker().csvFile && getResourceTracker().csvFile->is_open()) {
                 getResourceTracker().csvFile->close();
                 delete getResourceTracker().csvFile;
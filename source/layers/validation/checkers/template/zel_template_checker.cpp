@@ -23,7 +23,7 @@ namespace validation_layer
             templateChecker.zetValidation = zetChecker;
             templateChecker.zesValidation = zesChecker;
             templateChecker.zerValidation = zerChecker;
-            validation_layer::context.getInstance().validationHandlers.push_back(&templateChecker);
+            validation_layer::context.getInstance().registerChecker(zeChecker, zesChecker, zetChecker, zerChecker);
         }
     }
 
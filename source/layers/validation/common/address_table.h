@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file address_table.h
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace validation_layer {
+
+// Linear-probing open-addressing table keyed by a non-zero address (or any
+// other non-zero word).  Slots are stored inline in one array, so lookups
+// touch one or two cache lines and inserts only allocate when the table
+// doubles.  Erase uses backward-shift deletion, so no tombstones accumulate
+// under alloc/free churn.  Not thread-safe.
+template <typename Value>
+class AddressTable {
+public:
+  explicit AddressTable(size_t initialCapacity = 64)
+      : slots(initialCapacity), mask(initialCapacity - 1) {}
+
+  Value *find(uintptr_t key) {
+    Slot *slot = locate(key);
+    return slot->key == key ? &slot->value : nullptr;
+  }
+
+  // Returns the entry for key, inserting a value-initialized one if absent.
+  Value &findOrInsert(uintptr_t key, bool &inserted) {
+    Slot *slot = locate(key);
+    inserted = slot->key != key;
+    if (inserted) {
+      // Keep the load factor at or below 1/2 so probe sequences stay short.
+      if ((live + 1) * 2 > slots.size()) {
+        grow();
+        slot = locate(key);
+      }
+      slot->key = key;
+      slot->value = Value();
+      ++live;
+    }
+    return slot->value;
+  }
+
+  // Moves the entry for key into value and removes it; returns false if the
+  // key is not present.
+  bool take(uintptr_t key, Value &value) {
+    Slot *slot = locate(key);
+    if (slot->key != key) {
+      return false;
+    }
+    value = slot->value;
+    size_t hole = static_cast<size_t>(slot - slots.data());
+    for (size_t next = (hole + 1) & mask;; next = (next + 1) & mask) {
+      const uintptr_t candidate = slots[next].key;
+      if (candidate == 0) {
+        break;
+      }
+      const size_t home = hashOf(candidate) & mask;
+      if (((next - home) & mask) >= ((next - hole) & mask)) {
+        slots[hole] = slots[next];
+        hole = next;
+      }
+    }
+    slots[hole].key = 0;
+    --live;
+    return true;
+  }
+
+  size_t size() const { return live; }
+
+  template <typename F>
+  void forEach(F f) const {
+    for (const auto &slot : slots) {
+      if (slot.key != 0) {
+        f(slot.key, slot.value);
+      }
+    }
+  }
+
+private:
+  struct Slot {
+    uintptr_t key = 0; // 0 when empty
+    Value value{};
+  };
+
+  static uint64_t hashOf(uintptr_t key) {
+    // Addresses are aligned and clustered; mix the high bits down.
+    uint64_t h = static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ull;
+    return h ^ (h >> 29);
+  }
+
+  // Returns the slot holding key, or the empty slot that ends its probe run.
+  Slot *locate(uintptr_t key) {
+    for (size_t i = hashOf(key) & mask;; i = (i + 1) & mask) {
+      if (slots[i].key == key || slots[i].key == 0) {
+        return &slots[i];
+      }
+    }
+  }
+
+  void grow() {
+    std::vector<Slot> old(slots.size() * 2);
+    old.swap(slots);
+    mask = slots.size() - 1;
+    for (const auto &slot : old) {
+      if (slot.key != 0) {
+        *locate(slot.key) = slot;
+      }
+    }
+  }
+
+  std::vector<Slot> slots;
+  size_t mask;
+  size_t live = 0;
+};
+
+} // namespace validation_layer
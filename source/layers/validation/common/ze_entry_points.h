@@ -11,6 +11,8 @@
  */
 #pragma once
 #include "ze_api.h"
+#include <type_traits>
+#include <vector>
 
 namespace validation_layer
 {
@@ -518,4 +520,1022 @@ public:
     virtual ze_result_t zexCounterBasedEventCreate2Epilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const void* desc, ze_event_handle_t* phEvent , ze_result_t result) {return ZE_RESULT_SUCCESS;}
     virtual ~ZEValidationEntryPoints() {}
 };
+
+// Checkers to call for each entry point.  A checker is only listed for the
+// entry points its class overrides, so intercepts never make a virtual call
+// into an inherited no-op default.
+class ZEValidationDispatch {
+public:
+    std::vector<ZEValidationEntryPoints *> zeInitPrologue;
+    std::vector<ZEValidationEntryPoints *> zeInitEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDriverGetPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDriverGetEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeInitDriversPrologue;
+    std::vector<ZEValidationEntryPoints *> zeInitDriversEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDriverGetApiVersionPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDriverGetApiVersionEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDriverGetPropertiesPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDriverGetPropertiesEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDriverGetIpcPropertiesPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDriverGetIpcPropertiesEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDriverGetExtensionPropertiesPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDriverGetExtensionPropertiesEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDriverGetExtensionFunctionAddressPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDriverGetExtensionFunctionAddressEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDriverGetLastErrorDescriptionPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDriverGetLastErrorDescriptionEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDriverGetDefaultContextPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDriverGetDefaultContextEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetRootDevicePrologue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetRootDeviceEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetSubDevicesPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetSubDevicesEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetPropertiesPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetPropertiesEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetComputePropertiesPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetComputePropertiesEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetModulePropertiesPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetModulePropertiesEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetCommandQueueGroupPropertiesPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetCommandQueueGroupPropertiesEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetMemoryPropertiesPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetMemoryPropertiesEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetMemoryAccessPropertiesPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetMemoryAccessPropertiesEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetCachePropertiesPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetCachePropertiesEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetImagePropertiesPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetImagePropertiesEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetExternalMemoryPropertiesPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetExternalMemoryPropertiesEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetP2PPropertiesPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetP2PPropertiesEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceCanAccessPeerPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceCanAccessPeerEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetStatusPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetStatusEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetGlobalTimestampsPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetGlobalTimestampsEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceSynchronizePrologue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceSynchronizeEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetAggregatedCopyOffloadIncrementValuePrologue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetAggregatedCopyOffloadIncrementValueEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetCounterBasedEventMaxValuePrologue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetCounterBasedEventMaxValueEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetRuntimeRequirementsPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetRuntimeRequirementsEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetRuntimeRequirementsKeyPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetRuntimeRequirementsKeyEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceValidateRuntimeRequirementsPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceValidateRuntimeRequirementsEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeContextCreatePrologue;
+    std::vector<ZEValidationEntryPoints *> zeContextCreateEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeContextCreateExPrologue;
+    std::vector<ZEValidationEntryPoints *> zeContextCreateExEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeContextDestroyPrologue;
+    std::vector<ZEValidationEntryPoints *> zeContextDestroyEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeContextGetStatusPrologue;
+    std::vector<ZEValidationEntryPoints *> zeContextGetStatusEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandQueueCreatePrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandQueueCreateEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandQueueDestroyPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandQueueDestroyEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandQueueExecuteCommandListsPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandQueueExecuteCommandListsEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandQueueSynchronizePrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandQueueSynchronizeEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandQueueGetOrdinalPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandQueueGetOrdinalEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandQueueGetIndexPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandQueueGetIndexEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandQueueGetFlagsPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandQueueGetFlagsEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandQueueGetModePrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandQueueGetModeEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandQueueGetPriorityPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandQueueGetPriorityEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListCreatePrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListCreateEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListCreateImmediatePrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListCreateImmediateEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListDestroyPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListDestroyEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListClosePrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListCloseEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListResetPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListResetEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendWriteGlobalTimestampPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendWriteGlobalTimestampEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListHostSynchronizePrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListHostSynchronizeEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListGetDeviceHandlePrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListGetDeviceHandleEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListGetContextHandlePrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListGetContextHandleEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListGetOrdinalPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListGetOrdinalEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListImmediateGetIndexPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListImmediateGetIndexEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListIsImmediatePrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListIsImmediateEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListGetFlagsPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListGetFlagsEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListImmediateGetFlagsPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListImmediateGetFlagsEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListImmediateGetModePrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListImmediateGetModeEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListImmediateGetPriorityPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListImmediateGetPriorityEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendBarrierPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendBarrierEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendMemoryRangesBarrierPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendMemoryRangesBarrierEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeContextSystemBarrierPrologue;
+    std::vector<ZEValidationEntryPoints *> zeContextSystemBarrierEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendMemoryCopyPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendMemoryCopyEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendMemoryCopyWithParametersPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendMemoryCopyWithParametersEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendMemoryFillPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendMemoryFillEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendMemoryFillWithParametersPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendMemoryFillWithParametersEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendMemoryCopyRegionPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendMemoryCopyRegionEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendMemoryCopyFromContextPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendMemoryCopyFromContextEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendImageCopyPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendImageCopyEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendImageCopyRegionPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendImageCopyRegionEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendImageCopyToMemoryPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendImageCopyToMemoryEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendImageCopyFromMemoryPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendImageCopyFromMemoryEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendMemoryPrefetchPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendMemoryPrefetchEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendMemAdvisePrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendMemAdviseEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeEventPoolCreatePrologue;
+    std::vector<ZEValidationEntryPoints *> zeEventPoolCreateEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeEventPoolDestroyPrologue;
+    std::vector<ZEValidationEntryPoints *> zeEventPoolDestroyEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeEventCreatePrologue;
+    std::vector<ZEValidationEntryPoints *> zeEventCreateEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeEventCounterBasedCreatePrologue;
+    std::vector<ZEValidationEntryPoints *> zeEventCounterBasedCreateEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeEventDestroyPrologue;
+    std::vector<ZEValidationEntryPoints *> zeEventDestroyEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeEventPoolGetIpcHandlePrologue;
+    std::vector<ZEValidationEntryPoints *> zeEventPoolGetIpcHandleEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeEventPoolPutIpcHandlePrologue;
+    std::vector<ZEValidationEntryPoints *> zeEventPoolPutIpcHandleEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeEventPoolOpenIpcHandlePrologue;
+    std::vector<ZEValidationEntryPoints *> zeEventPoolOpenIpcHandleEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeEventPoolCloseIpcHandlePrologue;
+    std::vector<ZEValidationEntryPoints *> zeEventPoolCloseIpcHandleEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeEventCounterBasedGetIpcHandlePrologue;
+    std::vector<ZEValidationEntryPoints *> zeEventCounterBasedGetIpcHandleEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeEventCounterBasedOpenIpcHandlePrologue;
+    std::vector<ZEValidationEntryPoints *> zeEventCounterBasedOpenIpcHandleEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeEventCounterBasedCloseIpcHandlePrologue;
+    std::vector<ZEValidationEntryPoints *> zeEventCounterBasedCloseIpcHandleEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeEventCounterBasedGetDeviceAddressPrologue;
+    std::vector<ZEValidationEntryPoints *> zeEventCounterBasedGetDeviceAddressEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendSignalEventPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendSignalEventEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendWaitOnEventsPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendWaitOnEventsEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeEventHostSignalPrologue;
+    std::vector<ZEValidationEntryPoints *> zeEventHostSignalEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeEventHostSynchronizePrologue;
+    std::vector<ZEValidationEntryPoints *> zeEventHostSynchronizeEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeEventQueryStatusPrologue;
+    std::vector<ZEValidationEntryPoints *> zeEventQueryStatusEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendEventResetPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendEventResetEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeEventHostResetPrologue;
+    std::vector<ZEValidationEntryPoints *> zeEventHostResetEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeEventQueryKernelTimestampPrologue;
+    std::vector<ZEValidationEntryPoints *> zeEventQueryKernelTimestampEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendQueryKernelTimestampsPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendQueryKernelTimestampsEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeEventGetEventPoolPrologue;
+    std::vector<ZEValidationEntryPoints *> zeEventGetEventPoolEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeEventGetSignalScopePrologue;
+    std::vector<ZEValidationEntryPoints *> zeEventGetSignalScopeEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeEventGetWaitScopePrologue;
+    std::vector<ZEValidationEntryPoints *> zeEventGetWaitScopeEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeEventPoolGetContextHandlePrologue;
+    std::vector<ZEValidationEntryPoints *> zeEventPoolGetContextHandleEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeEventPoolGetFlagsPrologue;
+    std::vector<ZEValidationEntryPoints *> zeEventPoolGetFlagsEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeEventGetCounterBasedFlagsPrologue;
+    std::vector<ZEValidationEntryPoints *> zeEventGetCounterBasedFlagsEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeFenceCreatePrologue;
+    std::vector<ZEValidationEntryPoints *> zeFenceCreateEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeFenceDestroyPrologue;
+    std::vector<ZEValidationEntryPoints *> zeFenceDestroyEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeFenceHostSynchronizePrologue;
+    std::vector<ZEValidationEntryPoints *> zeFenceHostSynchronizeEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeFenceQueryStatusPrologue;
+    std::vector<ZEValidationEntryPoints *> zeFenceQueryStatusEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeFenceResetPrologue;
+    std::vector<ZEValidationEntryPoints *> zeFenceResetEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeImageGetPropertiesPrologue;
+    std::vector<ZEValidationEntryPoints *> zeImageGetPropertiesEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeImageCreatePrologue;
+    std::vector<ZEValidationEntryPoints *> zeImageCreateEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeImageDestroyPrologue;
+    std::vector<ZEValidationEntryPoints *> zeImageDestroyEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeMemAllocSharedPrologue;
+    std::vector<ZEValidationEntryPoints *> zeMemAllocSharedEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeMemAllocDevicePrologue;
+    std::vector<ZEValidationEntryPoints *> zeMemAllocDeviceEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeMemAllocHostPrologue;
+    std::vector<ZEValidationEntryPoints *> zeMemAllocHostEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeMemFreePrologue;
+    std::vector<ZEValidationEntryPoints *> zeMemFreeEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeMemGetAllocPropertiesPrologue;
+    std::vector<ZEValidationEntryPoints *> zeMemGetAllocPropertiesEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeMemGetAddressRangePrologue;
+    std::vector<ZEValidationEntryPoints *> zeMemGetAddressRangeEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeMemGetIpcHandlePrologue;
+    std::vector<ZEValidationEntryPoints *> zeMemGetIpcHandleEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeMemGetIpcHandleFromFileDescriptorExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeMemGetIpcHandleFromFileDescriptorExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeMemGetFileDescriptorFromIpcHandleExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeMemGetFileDescriptorFromIpcHandleExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeMemPutIpcHandlePrologue;
+    std::vector<ZEValidationEntryPoints *> zeMemPutIpcHandleEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeMemOpenIpcHandlePrologue;
+    std::vector<ZEValidationEntryPoints *> zeMemOpenIpcHandleEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeMemCloseIpcHandlePrologue;
+    std::vector<ZEValidationEntryPoints *> zeMemCloseIpcHandleEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeMemSetAtomicAccessAttributeExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeMemSetAtomicAccessAttributeExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeMemGetAtomicAccessAttributeExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeMemGetAtomicAccessAttributeExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeModuleCreatePrologue;
+    std::vector<ZEValidationEntryPoints *> zeModuleCreateEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeModuleDestroyPrologue;
+    std::vector<ZEValidationEntryPoints *> zeModuleDestroyEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeModuleDynamicLinkPrologue;
+    std::vector<ZEValidationEntryPoints *> zeModuleDynamicLinkEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeModuleBuildLogDestroyPrologue;
+    std::vector<ZEValidationEntryPoints *> zeModuleBuildLogDestroyEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeModuleBuildLogGetStringPrologue;
+    std::vector<ZEValidationEntryPoints *> zeModuleBuildLogGetStringEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeModuleGetNativeBinaryPrologue;
+    std::vector<ZEValidationEntryPoints *> zeModuleGetNativeBinaryEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeModuleGetGlobalPointerPrologue;
+    std::vector<ZEValidationEntryPoints *> zeModuleGetGlobalPointerEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeModuleGetKernelNamesPrologue;
+    std::vector<ZEValidationEntryPoints *> zeModuleGetKernelNamesEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeModuleGetPropertiesPrologue;
+    std::vector<ZEValidationEntryPoints *> zeModuleGetPropertiesEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeKernelCreatePrologue;
+    std::vector<ZEValidationEntryPoints *> zeKernelCreateEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeKernelDestroyPrologue;
+    std::vector<ZEValidationEntryPoints *> zeKernelDestroyEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeModuleGetFunctionPointerPrologue;
+    std::vector<ZEValidationEntryPoints *> zeModuleGetFunctionPointerEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeKernelSetGroupSizePrologue;
+    std::vector<ZEValidationEntryPoints *> zeKernelSetGroupSizeEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeKernelSuggestGroupSizePrologue;
+    std::vector<ZEValidationEntryPoints *> zeKernelSuggestGroupSizeEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeKernelSuggestMaxCooperativeGroupCountPrologue;
+    std::vector<ZEValidationEntryPoints *> zeKernelSuggestMaxCooperativeGroupCountEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeKernelSetArgumentValuePrologue;
+    std::vector<ZEValidationEntryPoints *> zeKernelSetArgumentValueEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeKernelSetIndirectAccessPrologue;
+    std::vector<ZEValidationEntryPoints *> zeKernelSetIndirectAccessEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeKernelGetIndirectAccessPrologue;
+    std::vector<ZEValidationEntryPoints *> zeKernelGetIndirectAccessEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeKernelGetSourceAttributesPrologue;
+    std::vector<ZEValidationEntryPoints *> zeKernelGetSourceAttributesEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeKernelSetCacheConfigPrologue;
+    std::vector<ZEValidationEntryPoints *> zeKernelSetCacheConfigEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeKernelGetPropertiesPrologue;
+    std::vector<ZEValidationEntryPoints *> zeKernelGetPropertiesEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeKernelGetNamePrologue;
+    std::vector<ZEValidationEntryPoints *> zeKernelGetNameEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendLaunchKernelPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendLaunchKernelEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendLaunchKernelWithParametersPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendLaunchKernelWithParametersEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendLaunchKernelWithArgumentsPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendLaunchKernelWithArgumentsEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendLaunchCooperativeKernelPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendLaunchCooperativeKernelEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendLaunchKernelIndirectPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendLaunchKernelIndirectEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendLaunchMultipleKernelsIndirectPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendLaunchMultipleKernelsIndirectEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeContextMakeMemoryResidentPrologue;
+    std::vector<ZEValidationEntryPoints *> zeContextMakeMemoryResidentEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeContextEvictMemoryPrologue;
+    std::vector<ZEValidationEntryPoints *> zeContextEvictMemoryEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeContextMakeImageResidentPrologue;
+    std::vector<ZEValidationEntryPoints *> zeContextMakeImageResidentEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeContextEvictImagePrologue;
+    std::vector<ZEValidationEntryPoints *> zeContextEvictImageEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeSamplerCreatePrologue;
+    std::vector<ZEValidationEntryPoints *> zeSamplerCreateEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeSamplerDestroyPrologue;
+    std::vector<ZEValidationEntryPoints *> zeSamplerDestroyEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeVirtualMemReservePrologue;
+    std::vector<ZEValidationEntryPoints *> zeVirtualMemReserveEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeVirtualMemFreePrologue;
+    std::vector<ZEValidationEntryPoints *> zeVirtualMemFreeEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeVirtualMemQueryPageSizePrologue;
+    std::vector<ZEValidationEntryPoints *> zeVirtualMemQueryPageSizeEpilogue;
+    std::vector<ZEValidationEntryPoints *> zePhysicalMemGetPropertiesPrologue;
+    std::vector<ZEValidationEntryPoints *> zePhysicalMemGetPropertiesEpilogue;
+    std::vector<ZEValidationEntryPoints *> zePhysicalMemCreatePrologue;
+    std::vector<ZEValidationEntryPoints *> zePhysicalMemCreateEpilogue;
+    std::vector<ZEValidationEntryPoints *> zePhysicalMemDestroyPrologue;
+    std::vector<ZEValidationEntryPoints *> zePhysicalMemDestroyEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeVirtualMemMapPrologue;
+    std::vector<ZEValidationEntryPoints *> zeVirtualMemMapEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeVirtualMemUnmapPrologue;
+    std::vector<ZEValidationEntryPoints *> zeVirtualMemUnmapEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeVirtualMemSetAccessAttributePrologue;
+    std::vector<ZEValidationEntryPoints *> zeVirtualMemSetAccessAttributeEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeVirtualMemGetAccessAttributePrologue;
+    std::vector<ZEValidationEntryPoints *> zeVirtualMemGetAccessAttributeEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeKernelSetGlobalOffsetExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeKernelSetGlobalOffsetExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceReserveCacheExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceReserveCacheExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceSetCacheAdviceExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceSetCacheAdviceExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeEventQueryTimestampsExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeEventQueryTimestampsExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeImageGetMemoryPropertiesExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeImageGetMemoryPropertiesExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeImageViewCreateExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeImageViewCreateExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeImageViewCreateExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeImageViewCreateExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeKernelSchedulingHintExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeKernelSchedulingHintExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDevicePciGetPropertiesExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDevicePciGetPropertiesExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendImageCopyToMemoryExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendImageCopyToMemoryExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendImageCopyFromMemoryExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendImageCopyFromMemoryExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeImageGetAllocPropertiesExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeImageGetAllocPropertiesExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeModuleInspectLinkageExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeModuleInspectLinkageExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeMemFreeExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeMemFreeExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeFabricVertexGetExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeFabricVertexGetExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeFabricVertexGetSubVerticesExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeFabricVertexGetSubVerticesExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeFabricVertexGetPropertiesExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeFabricVertexGetPropertiesExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeFabricVertexGetDeviceExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeFabricVertexGetDeviceExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetFabricVertexExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetFabricVertexExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeFabricEdgeGetExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeFabricEdgeGetExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeFabricEdgeGetVerticesExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeFabricEdgeGetVerticesExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeFabricEdgeGetPropertiesExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeFabricEdgeGetPropertiesExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeEventQueryKernelTimestampsExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeEventQueryKernelTimestampsExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeRTASBuilderCreateExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeRTASBuilderCreateExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeRTASBuilderGetBuildPropertiesExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeRTASBuilderGetBuildPropertiesExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDriverRTASFormatCompatibilityCheckExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDriverRTASFormatCompatibilityCheckExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeRTASBuilderBuildExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeRTASBuilderBuildExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeRTASBuilderDestroyExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeRTASBuilderDestroyExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeRTASParallelOperationCreateExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeRTASParallelOperationCreateExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeRTASParallelOperationGetPropertiesExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeRTASParallelOperationGetPropertiesExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeRTASParallelOperationJoinExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeRTASParallelOperationJoinExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeRTASParallelOperationDestroyExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeRTASParallelOperationDestroyExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeMemGetPitchFor2dImagePrologue;
+    std::vector<ZEValidationEntryPoints *> zeMemGetPitchFor2dImageEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeImageGetDeviceOffsetExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeImageGetDeviceOffsetExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListCreateCloneExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListCreateCloneExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListImmediateAppendCommandListsExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListImmediateAppendCommandListsExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListImmediateAppendCommandListsWithParametersPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListImmediateAppendCommandListsWithParametersEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListGetNextCommandIdExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListGetNextCommandIdExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListGetNextCommandIdWithKernelsExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListGetNextCommandIdWithKernelsExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListUpdateMutableCommandsExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListUpdateMutableCommandsExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListIsMutableExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListIsMutableExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListUpdateMutableCommandSignalEventExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListUpdateMutableCommandSignalEventExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListUpdateMutableCommandWaitEventsExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListUpdateMutableCommandWaitEventsExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListUpdateMutableCommandKernelsExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListUpdateMutableCommandKernelsExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeKernelGetBinaryExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeKernelGetBinaryExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceImportExternalSemaphoreExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceImportExternalSemaphoreExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceReleaseExternalSemaphoreExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceReleaseExternalSemaphoreExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendSignalExternalSemaphoreExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendSignalExternalSemaphoreExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendWaitExternalSemaphoreExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendWaitExternalSemaphoreExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeRTASBuilderCreateExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeRTASBuilderCreateExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeRTASBuilderGetBuildPropertiesExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeRTASBuilderGetBuildPropertiesExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDriverRTASFormatCompatibilityCheckExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDriverRTASFormatCompatibilityCheckExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeRTASBuilderBuildExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeRTASBuilderBuildExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeRTASBuilderCommandListAppendCopyExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeRTASBuilderCommandListAppendCopyExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeRTASBuilderDestroyExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeRTASBuilderDestroyExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeRTASParallelOperationCreateExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeRTASParallelOperationCreateExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeRTASParallelOperationGetPropertiesExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeRTASParallelOperationGetPropertiesExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeRTASParallelOperationJoinExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeRTASParallelOperationJoinExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeRTASParallelOperationDestroyExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeRTASParallelOperationDestroyExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetVectorWidthPropertiesExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeDeviceGetVectorWidthPropertiesExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeKernelGetAllocationPropertiesExpPrologue;
+    std::vector<ZEValidationEntryPoints *> zeKernelGetAllocationPropertiesExpEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeMemGetIpcHandleWithPropertiesPrologue;
+    std::vector<ZEValidationEntryPoints *> zeMemGetIpcHandleWithPropertiesEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeGraphCreateExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeGraphCreateExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListBeginGraphCaptureExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListBeginGraphCaptureExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListBeginCaptureIntoGraphExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListBeginCaptureIntoGraphExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListIsGraphCaptureEnabledExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListIsGraphCaptureEnabledExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListEndGraphCaptureExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListEndGraphCaptureExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListGetGraphExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListGetGraphExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeGraphGetPrimaryCommandListExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeGraphGetPrimaryCommandListExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeGraphSetDestructionCallbackExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeGraphSetDestructionCallbackExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeGraphInstantiateExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeGraphInstantiateExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendGraphExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendGraphExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeExecutableGraphGetSourceGraphExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeExecutableGraphGetSourceGraphExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeGraphIsEmptyExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeGraphIsEmptyExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeGraphDumpContentsExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeGraphDumpContentsExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeExecutableGraphDestroyExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeExecutableGraphDestroyExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeGraphDestroyExtPrologue;
+    std::vector<ZEValidationEntryPoints *> zeGraphDestroyExtEpilogue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendHostFunctionPrologue;
+    std::vector<ZEValidationEntryPoints *> zeCommandListAppendHostFunctionEpilogue;
+    std::vector<ZEValidationEntryPoints *> zexCounterBasedEventCreate2Prologue;
+    std::vector<ZEValidationEntryPoints *> zexCounterBasedEventCreate2Epilogue;
+
+    // T is the checker's concrete class.  &T::f has the type of the
+    // ZEValidationEntryPoints member unless T redeclares f, so whether an
+    // entry point is overridden is decided at compile time.
+    template <class T> void addChecker(T *checker) {
+        if (nullptr == checker)
+            return;
+        addIfOverridden(zeInitPrologue, checker, &T::zeInitPrologue, &ZEValidationEntryPoints::zeInitPrologue);
+        addIfOverridden(zeInitEpilogue, checker, &T::zeInitEpilogue, &ZEValidationEntryPoints::zeInitEpilogue);
+        addIfOverridden(zeDriverGetPrologue, checker, &T::zeDriverGetPrologue, &ZEValidationEntryPoints::zeDriverGetPrologue);
+        addIfOverridden(zeDriverGetEpilogue, checker, &T::zeDriverGetEpilogue, &ZEValidationEntryPoints::zeDriverGetEpilogue);
+        addIfOverridden(zeInitDriversPrologue, checker, &T::zeInitDriversPrologue, &ZEValidationEntryPoints::zeInitDriversPrologue);
+        addIfOverridden(zeInitDriversEpilogue, checker, &T::zeInitDriversEpilogue, &ZEValidationEntryPoints::zeInitDriversEpilogue);
+        addIfOverridden(zeDriverGetApiVersionPrologue, checker, &T::zeDriverGetApiVersionPrologue, &ZEValidationEntryPoints::zeDriverGetApiVersionPrologue);
+        addIfOverridden(zeDriverGetApiVersionEpilogue, checker, &T::zeDriverGetApiVersionEpilogue, &ZEValidationEntryPoints::zeDriverGetApiVersionEpilogue);
+        addIfOverridden(zeDriverGetPropertiesPrologue, checker, &T::zeDriverGetPropertiesPrologue, &ZEValidationEntryPoints::zeDriverGetPropertiesPrologue);
+        addIfOverridden(zeDriverGetPropertiesEpilogue, checker, &T::zeDriverGetPropertiesEpilogue, &ZEValidationEntryPoints::zeDriverGetPropertiesEpilogue);
+        addIfOverridden(zeDriverGetIpcPropertiesPrologue, checker, &T::zeDriverGetIpcPropertiesPrologue, &ZEValidationEntryPoints::zeDriverGetIpcPropertiesPrologue);
+        addIfOverridden(zeDriverGetIpcPropertiesEpilogue, checker, &T::zeDriverGetIpcPropertiesEpilogue, &ZEValidationEntryPoints::zeDriverGetIpcPropertiesEpilogue);
+        addIfOverridden(zeDriverGetExtensionPropertiesPrologue, checker, &T::zeDriverGetExtensionPropertiesPrologue, &ZEValidationEntryPoints::zeDriverGetExtensionPropertiesPrologue);
+        addIfOverridden(zeDriverGetExtensionPropertiesEpilogue, checker, &T::zeDriverGetExtensionPropertiesEpilogue, &ZEValidationEntryPoints::zeDriverGetExtensionPropertiesEpilogue);
+        addIfOverridden(zeDriverGetExtensionFunctionAddressPrologue, checker, &T::zeDriverGetExtensionFunctionAddressPrologue, &ZEValidationEntryPoints::zeDriverGetExtensionFunctionAddressPrologue);
+        addIfOverridden(zeDriverGetExtensionFunctionAddressEpilogue, checker, &T::zeDriverGetExtensionFunctionAddressEpilogue, &ZEValidationEntryPoints::zeDriverGetExtensionFunctionAddressEpilogue);
+        addIfOverridden(zeDriverGetLastErrorDescriptionPrologue, checker, &T::zeDriverGetLastErrorDescriptionPrologue, &ZEValidationEntryPoints::zeDriverGetLastErrorDescriptionPrologue);
+        addIfOverridden(zeDriverGetLastErrorDescriptionEpilogue, checker, &T::zeDriverGetLastErrorDescriptionEpilogue, &ZEValidationEntryPoints::zeDriverGetLastErrorDescriptionEpilogue);
+        addIfOverridden(zeDriverGetDefaultContextPrologue, checker, &T::zeDriverGetDefaultContextPrologue, &ZEValidationEntryPoints::zeDriverGetDefaultContextPrologue);
+        addIfOverridden(zeDriverGetDefaultContextEpilogue, checker, &T::zeDriverGetDefaultContextEpilogue, &ZEValidationEntryPoints::zeDriverGetDefaultContextEpilogue);
+        addIfOverridden(zeDeviceGetPrologue, checker, &T::zeDeviceGetPrologue, &ZEValidationEntryPoints::zeDeviceGetPrologue);
+        addIfOverridden(zeDeviceGetEpilogue, checker, &T::zeDeviceGetEpilogue, &ZEValidationEntryPoints::zeDeviceGetEpilogue);
+        addIfOverridden(zeDeviceGetRootDevicePrologue, checker, &T::zeDeviceGetRootDevicePrologue, &ZEValidationEntryPoints::zeDeviceGetRootDevicePrologue);
+        addIfOverridden(zeDeviceGetRootDeviceEpilogue, checker, &T::zeDeviceGetRootDeviceEpilogue, &ZEValidationEntryPoints::zeDeviceGetRootDeviceEpilogue);
+        addIfOverridden(zeDeviceGetSubDevicesPrologue, checker, &T::zeDeviceGetSubDevicesPrologue, &ZEValidationEntryPoints::zeDeviceGetSubDevicesPrologue);
+        addIfOverridden(zeDeviceGetSubDevicesEpilogue, checker, &T::zeDeviceGetSubDevicesEpilogue, &ZEValidationEntryPoints::zeDeviceGetSubDevicesEpilogue);
+        addIfOverridden(zeDeviceGetPropertiesPrologue, checker, &T::zeDeviceGetPropertiesPrologue, &ZEValidationEntryPoints::zeDeviceGetPropertiesPrologue);
+        addIfOverridden(zeDeviceGetPropertiesEpilogue, checker, &T::zeDeviceGetPropertiesEpilogue, &ZEValidationEntryPoints::zeDeviceGetPropertiesEpilogue);
+        addIfOverridden(zeDeviceGetComputePropertiesPrologue, checker, &T::zeDeviceGetComputePropertiesPrologue, &ZEValidationEntryPoints::zeDeviceGetComputePropertiesPrologue);
+        addIfOverridden(zeDeviceGetComputePropertiesEpilogue, checker, &T::zeDeviceGetComputePropertiesEpilogue, &ZEValidationEntryPoints::zeDeviceGetComputePropertiesEpilogue);
+        addIfOverridden(zeDeviceGetModulePropertiesPrologue, checker, &T::zeDeviceGetModulePropertiesPrologue, &ZEValidationEntryPoints::zeDeviceGetModulePropertiesPrologue);
+        addIfOverridden(zeDeviceGetModulePropertiesEpilogue, checker, &T::zeDeviceGetModulePropertiesEpilogue, &ZEValidationEntryPoints::zeDeviceGetModulePropertiesEpilogue);
+        addIfOverridden(zeDeviceGetCommandQueueGroupPropertiesPrologue, checker, &T::zeDeviceGetCommandQueueGroupPropertiesPrologue, &ZEValidationEntryPoints::zeDeviceGetCommandQueueGroupPropertiesPrologue);
+        addIfOverridden(zeDeviceGetCommandQueueGroupPropertiesEpilogue, checker, &T::zeDeviceGetCommandQueueGroupPropertiesEpilogue, &ZEValidationEntryPoints::zeDeviceGetCommandQueueGroupPropertiesEpilogue);
+        addIfOverridden(zeDeviceGetMemoryPropertiesPrologue, checker, &T::zeDeviceGetMemoryPropertiesPrologue, &ZEValidationEntryPoints::zeDeviceGetMemoryPropertiesPrologue);
+        addIfOverridden(zeDeviceGetMemoryPropertiesEpilogue, checker, &T::zeDeviceGetMemoryPropertiesEpilogue, &ZEValidationEntryPoints::zeDeviceGetMemoryPropertiesEpilogue);
+        addIfOverridden(zeDeviceGetMemoryAccessPropertiesPrologue, checker, &T::zeDeviceGetMemoryAccessPropertiesPrologue, &ZEValidationEntryPoints::zeDeviceGetMemoryAccessPropertiesPrologue);
+        addIfOverridden(zeDeviceGetMemoryAccessPropertiesEpilogue, checker, &T::zeDeviceGetMemoryAccessPropertiesEpilogue, &ZEValidationEntryPoints::zeDeviceGetMemoryAccessPropertiesEpilogue);
+        addIfOverridden(zeDeviceGetCachePropertiesPrologue, checker, &T::zeDeviceGetCachePropertiesPrologue, &ZEValidationEntryPoints::zeDeviceGetCachePropertiesPrologue);
+        addIfOverridden(zeDeviceGetCachePropertiesEpilogue, checker, &T::zeDeviceGetCachePropertiesEpilogue, &ZEValidationEntryPoints::zeDeviceGetCachePropertiesEpilogue);
+        addIfOverridden(zeDeviceGetImagePropertiesPrologue, checker, &T::zeDeviceGetImagePropertiesPrologue, &ZEValidationEntryPoints::zeDeviceGetImagePropertiesPrologue);
+        addIfOverridden(zeDeviceGetImagePropertiesEpilogue, checker, &T::zeDeviceGetImagePropertiesEpilogue, &ZEValidationEntryPoints::zeDeviceGetImagePropertiesEpilogue);
+        addIfOverridden(zeDeviceGetExternalMemoryPropertiesPrologue, checker, &T::zeDeviceGetExternalMemoryPropertiesPrologue, &ZEValidationEntryPoints::zeDeviceGetExternalMemoryPropertiesPrologue);
+        addIfOverridden(zeDeviceGetExternalMemoryPropertiesEpilogue, checker, &T::zeDeviceGetExternalMemoryPropertiesEpilogue, &ZEValidationEntryPoints::zeDeviceGetExternalMemoryPropertiesEpilogue);
+        addIfOverridden(zeDeviceGetP2PPropertiesPrologue, checker, &T::zeDeviceGetP2PPropertiesPrologue, &ZEValidationEntryPoints::zeDeviceGetP2PPropertiesPrologue);
+        addIfOverridden(zeDeviceGetP2PPropertiesEpilogue, checker, &T::zeDeviceGetP2PPropertiesEpilogue, &ZEValidationEntryPoints::zeDeviceGetP2PPropertiesEpilogue);
+        addIfOverridden(zeDeviceCanAccessPeerPrologue, checker, &T::zeDeviceCanAccessPeerPrologue, &ZEValidationEntryPoints::zeDeviceCanAccessPeerPrologue);
+        addIfOverridden(zeDeviceCanAccessPeerEpilogue, checker, &T::zeDeviceCanAccessPeerEpilogue, &ZEValidationEntryPoints::zeDeviceCanAccessPeerEpilogue);
+        addIfOverridden(zeDeviceGetStatusPrologue, checker, &T::zeDeviceGetStatusPrologue, &ZEValidationEntryPoints::zeDeviceGetStatusPrologue);
+        addIfOverridden(zeDeviceGetStatusEpilogue, checker, &T::zeDeviceGetStatusEpilogue, &ZEValidationEntryPoints::zeDeviceGetStatusEpilogue);
+        addIfOverridden(zeDeviceGetGlobalTimestampsPrologue, checker, &T::zeDeviceGetGlobalTimestampsPrologue, &ZEValidationEntryPoints::zeDeviceGetGlobalTimestampsPrologue);
+        addIfOverridden(zeDeviceGetGlobalTimestampsEpilogue, checker, &T::zeDeviceGetGlobalTimestampsEpilogue, &ZEValidationEntryPoints::zeDeviceGetGlobalTimestampsEpilogue);
+        addIfOverridden(zeDeviceSynchronizePrologue, checker, &T::zeDeviceSynchronizePrologue, &ZEValidationEntryPoints::zeDeviceSynchronizePrologue);
+        addIfOverridden(zeDeviceSynchronizeEpilogue, checker, &T::zeDeviceSynchronizeEpilogue, &ZEValidationEntryPoints::zeDeviceSynchronizeEpilogue);
+        addIfOverridden(zeDeviceGetAggregatedCopyOffloadIncrementValuePrologue, checker, &T::zeDeviceGetAggregatedCopyOffloadIncrementValuePrologue, &ZEValidationEntryPoints::zeDeviceGetAggregatedCopyOffloadIncrementValuePrologue);
+        addIfOverridden(zeDeviceGetAggregatedCopyOffloadIncrementValueEpilogue, checker, &T::zeDeviceGetAggregatedCopyOffloadIncrementValueEpilogue, &ZEValidationEntryPoints::zeDeviceGetAggregatedCopyOffloadIncrementValueEpilogue);
+        addIfOverridden(zeDeviceGetCounterBasedEventMaxValuePrologue, checker, &T::zeDeviceGetCounterBasedEventMaxValuePrologue, &ZEValidationEntryPoints::zeDeviceGetCounterBasedEventMaxValuePrologue);
+        addIfOverridden(zeDeviceGetCounterBasedEventMaxValueEpilogue, checker, &T::zeDeviceGetCounterBasedEventMaxValueEpilogue, &ZEValidationEntryPoints::zeDeviceGetCounterBasedEventMaxValueEpilogue);
+        addIfOverridden(zeDeviceGetRuntimeRequirementsPrologue, checker, &T::zeDeviceGetRuntimeRequirementsPrologue, &ZEValidationEntryPoints::zeDeviceGetRuntimeRequirementsPrologue);
+        addIfOverridden(zeDeviceGetRuntimeRequirementsEpilogue, checker, &T::zeDeviceGetRuntimeRequirementsEpilogue, &ZEValidationEntryPoints::zeDeviceGetRuntimeRequirementsEpilogue);
+        addIfOverridden(zeDeviceGetRuntimeRequirementsKeyPrologue, checker, &T::zeDeviceGetRuntimeRequirementsKeyPrologue, &ZEValidationEntryPoints::zeDeviceGetRuntimeRequirementsKeyPrologue);
+        addIfOverridden(zeDeviceGetRuntimeRequirementsKeyEpilogue, checker, &T::zeDeviceGetRuntimeRequirementsKeyEpilogue, &ZEValidationEntryPoints::zeDeviceGetRuntimeRequirementsKeyEpilogue);
+        addIfOverridden(zeDeviceValidateRuntimeRequirementsPrologue, checker, &T::zeDeviceValidateRuntimeRequirementsPrologue, &ZEValidationEntryPoints::zeDeviceValidateRuntimeRequirementsPrologue);
+        addIfOverridden(zeDeviceValidateRuntimeRequirementsEpilogue, checker, &T::zeDeviceValidateRuntimeRequirementsEpilogue, &ZEValidationEntryPoints::zeDeviceValidateRuntimeRequirementsEpilogue);
+        addIfOverridden(zeContextCreatePrologue, checker, &T::zeContextCreatePrologue, &ZEValidationEntryPoints::zeContextCreatePrologue);
+        addIfOverridden(zeContextCreateEpilogue, checker, &T::zeContextCreateEpilogue, &ZEValidationEntryPoints::zeContextCreateEpilogue);
+        addIfOverridden(zeContextCreateExPrologue, checker, &T::zeContextCreateExPrologue, &ZEValidationEntryPoints::zeContextCreateExPrologue);
+        addIfOverridden(zeContextCreateExEpilogue, checker, &T::zeContextCreateExEpilogue, &ZEValidationEntryPoints::zeContextCreateExEpilogue);
+        addIfOverridden(zeContextDestroyPrologue, checker, &T::zeContextDestroyPrologue, &ZEValidationEntryPoints::zeContextDestroyPrologue);
+        addIfOverridden(zeContextDestroyEpilogue, checker, &T::zeContextDestroyEpilogue, &ZEValidationEntryPoints::zeContextDestroyEpilogue);
+        addIfOverridden(zeContextGetStatusPrologue, checker, &T::zeContextGetStatusPrologue, &ZEValidationEntryPoints::zeContextGetStatusPrologue);
+        addIfOverridden(zeContextGetStatusEpilogue, checker, &T::zeContextGetStatusEpilogue, &ZEValidationEntryPoints::zeContextGetStatusEpilogue);
+        addIfOverridden(zeCommandQueueCreatePrologue, checker, &T::zeCommandQueueCreatePrologue, &ZEValidationEntryPoints::zeCommandQueueCreatePrologue);
+        addIfOverridden(zeCommandQueueCreateEpilogue, checker, &T::zeCommandQueueCreateEpilogue, &ZEValidationEntryPoints::zeCommandQueueCreateEpilogue);
+        addIfOverridden(zeCommandQueueDestroyPrologue, checker, &T::zeCommandQueueDestroyPrologue, &ZEValidationEntryPoints::zeCommandQueueDestroyPrologue);
+        addIfOverridden(zeCommandQueueDestroyEpilogue, checker, &T::zeCommandQueueDestroyEpilogue, &ZEValidationEntryPoints::zeCommandQueueDestroyEpilogue);
+        addIfOverridden(zeCommandQueueExecuteCommandListsPrologue, checker, &T::zeCommandQueueExecuteCommandListsPrologue, &ZEValidationEntryPoints::zeCommandQueueExecuteCommandListsPrologue);
+        addIfOverridden(zeCommandQueueExecuteCommandListsEpilogue, checker, &T::zeCommandQueueExecuteCommandListsEpilogue, &ZEValidationEntryPoints::zeCommandQueueExecuteCommandListsEpilogue);
+        addIfOverridden(zeCommandQueueSynchronizePrologue, checker, &T::zeCommandQueueSynchronizePrologue, &ZEValidationEntryPoints::zeCommandQueueSynchronizePrologue);
+        addIfOverridden(zeCommandQueueSynchronizeEpilogue, checker, &T::zeCommandQueueSynchronizeEpilogue, &ZEValidationEntryPoints::zeCommandQueueSynchronizeEpilogue);
+        addIfOverridden(zeCommandQueueGetOrdinalPrologue, checker, &T::zeCommandQueueGetOrdinalPrologue, &ZEValidationEntryPoints::zeCommandQueueGetOrdinalPrologue);
+        addIfOverridden(zeCommandQueueGetOrdinalEpilogue, checker, &T::zeCommandQueueGetOrdinalEpilogue, &ZEValidationEntryPoints::zeCommandQueueGetOrdinalEpilogue);
+        addIfOverridden(zeCommandQueueGetIndexPrologue, checker, &T::zeCommandQueueGetIndexPrologue, &ZEValidationEntryPoints::zeCommandQueueGetIndexPrologue);
+        addIfOverridden(zeCommandQueueGetIndexEpilogue, checker, &T::zeCommandQueueGetIndexEpilogue, &ZEValidationEntryPoints::zeCommandQueueGetIndexEpilogue);
+        addIfOverridden(zeCommandQueueGetFlagsPrologue, checker, &T::zeCommandQueueGetFlagsPrologue, &ZEValidationEntryPoints::zeCommandQueueGetFlagsPrologue);
+        addIfOverridden(zeCommandQueueGetFlagsEpilogue, checker, &T::zeCommandQueueGetFlagsEpilogue, &ZEValidationEntryPoints::zeCommandQueueGetFlagsEpilogue);
+        addIfOverridden(zeCommandQueueGetModePrologue, checker, &T::zeCommandQueueGetModePrologue, &ZEValidationEntryPoints::zeCommandQueueGetModePrologue);
+        addIfOverridden(zeCommandQueueGetModeEpilogue, checker, &T::zeCommandQueueGetModeEpilogue, &ZEValidationEntryPoints::zeCommandQueueGetModeEpilogue);
+        addIfOverridden(zeCommandQueueGetPriorityPrologue, checker, &T::zeCommandQueueGetPriorityPrologue, &ZEValidationEntryPoints::zeCommandQueueGetPriorityPrologue);
+        addIfOverridden(zeCommandQueueGetPriorityEpilogue, checker, &T::zeCommandQueueGetPriorityEpilogue, &ZEValidationEntryPoints::zeCommandQueueGetPriorityEpilogue);
+        addIfOverridden(zeCommandListCreatePrologue, checker, &T::zeCommandListCreatePrologue, &ZEValidationEntryPoints::zeCommandListCreatePrologue);
+        addIfOverridden(zeCommandListCreateEpilogue, checker, &T::zeCommandListCreateEpilogue, &ZEValidationEntryPoints::zeCommandListCreateEpilogue);
+        addIfOverridden(zeCommandListCreateImmediatePrologue, checker, &T::zeCommandListCreateImmediatePrologue, &ZEValidationEntryPoints::zeCommandListCreateImmediatePrologue);
+        addIfOverridden(zeCommandListCreateImmediateEpilogue, checker, &T::zeCommandListCreateImmediateEpilogue, &ZEValidationEntryPoints::zeCommandListCreateImmediateEpilogue);
+        addIfOverridden(zeCommandListDestroyPrologue, checker, &T::zeCommandListDestroyPrologue, &ZEValidationEntryPoints::zeCommandListDestroyPrologue);
+        addIfOverridden(zeCommandListDestroyEpilogue, checker, &T::zeCommandListDestroyEpilogue, &ZEValidationEntryPoints::zeCommandListDestroyEpilogue);
+        addIfOverridden(zeCommandListClosePrologue, checker, &T::zeCommandListClosePrologue, &ZEValidationEntryPoints::zeCommandListClosePrologue);
+        addIfOverridden(zeCommandListCloseEpilogue, checker, &T::zeCommandListCloseEpilogue, &ZEValidationEntryPoints::zeCommandListCloseEpilogue);
+        addIfOverridden(zeCommandListResetPrologue, checker, &T::zeCommandListResetPrologue, &ZEValidationEntryPoints::zeCommandListResetPrologue);
+        addIfOverridden(zeCommandListResetEpilogue, checker, &T::zeCommandListResetEpilogue, &ZEValidationEntryPoints::zeCommandListResetEpilogue);
+        addIfOverridden(zeCommandListAppendWriteGlobalTimestampPrologue, checker, &T::zeCommandListAppendWriteGlobalTimestampPrologue, &ZEValidationEntryPoints::zeCommandListAppendWriteGlobalTimestampPrologue);
+        addIfOverridden(zeCommandListAppendWriteGlobalTimestampEpilogue, checker, &T::zeCommandListAppendWriteGlobalTimestampEpilogue, &ZEValidationEntryPoints::zeCommandListAppendWriteGlobalTimestampEpilogue);
+        addIfOverridden(zeCommandListHostSynchronizePrologue, checker, &T::zeCommandListHostSynchronizePrologue, &ZEValidationEntryPoints::zeCommandListHostSynchronizePrologue);
+        addIfOverridden(zeCommandListHostSynchronizeEpilogue, checker, &T::zeCommandListHostSynchronizeEpilogue, &ZEValidationEntryPoints::zeCommandListHostSynchronizeEpilogue);
+        addIfOverridden(zeCommandListGetDeviceHandlePrologue, checker, &T::zeCommandListGetDeviceHandlePrologue, &ZEValidationEntryPoints::zeCommandListGetDeviceHandlePrologue);
+        addIfOverridden(zeCommandListGetDeviceHandleEpilogue, checker, &T::zeCommandListGetDeviceHandleEpilogue, &ZEValidationEntryPoints::zeCommandListGetDeviceHandleEpilogue);
+        addIfOverridden(zeCommandListGetContextHandlePrologue, checker, &T::zeCommandListGetContextHandlePrologue, &ZEValidationEntryPoints::zeCommandListGetContextHandlePrologue);
+        addIfOverridden(zeCommandListGetContextHandleEpilogue, checker, &T::zeCommandListGetContextHandleEpilogue, &ZEValidationEntryPoints::zeCommandListGetContextHandleEpilogue);
+        addIfOverridden(zeCommandListGetOrdinalPrologue, checker, &T::zeCommandListGetOrdinalPrologue, &ZEValidationEntryPoints::zeCommandListGetOrdinalPrologue);
+        addIfOverridden(zeCommandListGetOrdinalEpilogue, checker, &T::zeCommandListGetOrdinalEpilogue, &ZEValidationEntryPoints::zeCommandListGetOrdinalEpilogue);
+        addIfOverridden(zeCommandListImmediateGetIndexPrologue, checker, &T::zeCommandListImmediateGetIndexPrologue, &ZEValidationEntryPoints::zeCommandListImmediateGetIndexPrologue);
+        addIfOverridden(zeCommandListImmediateGetIndexEpilogue, checker, &T::zeCommandListImmediateGetIndexEpilogue, &ZEValidationEntryPoints::zeCommandListImmediateGetIndexEpilogue);
+        addIfOverridden(zeCommandListIsImmediatePrologue, checker, &T::zeCommandListIsImmediatePrologue, &ZEValidationEntryPoints::zeCommandListIsImmediatePrologue);
+        addIfOverridden(zeCommandListIsImmediateEpilogue, checker, &T::zeCommandListIsImmediateEpilogue, &ZEValidationEntryPoints::zeCommandListIsImmediateEpilogue);
+        addIfOverridden(zeCommandListGetFlagsPrologue, checker, &T::zeCommandListGetFlagsPrologue, &ZEValidationEntryPoints::zeCommandListGetFlagsPrologue);
+        addIfOverridden(zeCommandListGetFlagsEpilogue, checker, &T::zeCommandListGetFlagsEpilogue, &ZEValidationEntryPoints::zeCommandListGetFlagsEpilogue);
+        addIfOverridden(zeCommandListImmediateGetFlagsPrologue, checker, &T::zeCommandListImmediateGetFlagsPrologue, &ZEValidationEntryPoints::zeCommandListImmediateGetFlagsPrologue);
+        addIfOverridden(zeCommandListImmediateGetFlagsEpilogue, checker, &T::zeCommandListImmediateGetFlagsEpilogue, &ZEValidationEntryPoints::zeCommandListImmediateGetFlagsEpilogue);
+        addIfOverridden(zeCommandListImmediateGetModePrologue, checker, &T::zeCommandListImmediateGetModePrologue, &ZEValidationEntryPoints::zeCommandListImmediateGetModePrologue);
+        addIfOverridden(zeCommandListImmediateGetModeEpilogue, checker, &T::zeCommandListImmediateGetModeEpilogue, &ZEValidationEntryPoints::zeCommandListImmediateGetModeEpilogue);
+        addIfOverridden(zeCommandListImmediateGetPriorityPrologue, checker, &T::zeCommandListImmediateGetPriorityPrologue, &ZEValidationEntryPoints::zeCommandListImmediateGetPriorityPrologue);
+        addIfOverridden(zeCommandListImmediateGetPriorityEpilogue, checker, &T::zeCommandListImmediateGetPriorityEpilogue, &ZEValidationEntryPoints::zeCommandListImmediateGetPriorityEpilogue);
+        addIfOverridden(zeCommandListAppendBarrierPrologue, checker, &T::zeCommandListAppendBarrierPrologue, &ZEValidationEntryPoints::zeCommandListAppendBarrierPrologue);
+        addIfOverridden(zeCommandListAppendBarrierEpilogue, checker, &T::zeCommandListAppendBarrierEpilogue, &ZEValidationEntryPoints::zeCommandListAppendBarrierEpilogue);
+        addIfOverridden(zeCommandListAppendMemoryRangesBarrierPrologue, checker, &T::zeCommandListAppendMemoryRangesBarrierPrologue, &ZEValidationEntryPoints::zeCommandListAppendMemoryRangesBarrierPrologue);
+        addIfOverridden(zeCommandListAppendMemoryRangesBarrierEpilogue, checker, &T::zeCommandListAppendMemoryRangesBarrierEpilogue, &ZEValidationEntryPoints::zeCommandListAppendMemoryRangesBarrierEpilogue);
+        addIfOverridden(zeContextSystemBarrierPrologue, checker, &T::zeContextSystemBarrierPrologue, &ZEValidationEntryPoints::zeContextSystemBarrierPrologue);
+        addIfOverridden(zeContextSystemBarrierEpilogue, checker, &T::zeContextSystemBarrierEpilogue, &ZEValidationEntryPoints::zeContextSystemBarrierEpilogue);
+        addIfOverridden(zeCommandListAppendMemoryCopyPrologue, checker, &T::zeCommandListAppendMemoryCopyPrologue, &ZEValidationEntryPoints::zeCommandListAppendMemoryCopyPrologue);
+        addIfOverridden(zeCommandListAppendMemoryCopyEpilogue, checker, &T::zeCommandListAppendMemoryCopyEpilogue, &ZEValidationEntryPoints::zeCommandListAppendMemoryCopyEpilogue);
+        addIfOverridden(zeCommandListAppendMemoryCopyWithParametersPrologue, checker, &T::zeCommandListAppendMemoryCopyWithParametersPrologue, &ZEValidationEntryPoints::zeCommandListAppendMemoryCopyWithParametersPrologue);
+        addIfOverridden(zeCommandListAppendMemoryCopyWithParametersEpilogue, checker, &T::zeCommandListAppendMemoryCopyWithParametersEpilogue, &ZEValidationEntryPoints::zeCommandListAppendMemoryCopyWithParametersEpilogue);
+        addIfOverridden(zeCommandListAppendMemoryFillPrologue, checker, &T::zeCommandListAppendMemoryFillPrologue, &ZEValidationEntryPoints::zeCommandListAppendMemoryFillPrologue);
+        addIfOverridden(zeCommandListAppendMemoryFillEpilogue, checker, &T::zeCommandListAppendMemoryFillEpilogue, &ZEValidationEntryPoints::zeCommandListAppendMemoryFillEpilogue);
+        addIfOverridden(zeCommandListAppendMemoryFillWithParametersPrologue, checker, &T::zeCommandListAppendMemoryFillWithParametersPrologue, &ZEValidationEntryPoints::zeCommandListAppendMemoryFillWithParametersPrologue);
+        addIfOverridden(zeCommandListAppendMemoryFillWithParametersEpilogue, checker, &T::zeCommandListAppendMemoryFillWithParametersEpilogue, &ZEValidationEntryPoints::zeCommandListAppendMemoryFillWithParametersEpilogue);
+        addIfOverridden(zeCommandListAppendMemoryCopyRegionPrologue, checker, &T::zeCommandListAppendMemoryCopyRegionPrologue, &ZEValidationEntryPoints::zeCommandListAppendMemoryCopyRegionPrologue);
+        addIfOverridden(zeCommandListAppendMemoryCopyRegionEpilogue, checker, &T::zeCommandListAppendMemoryCopyRegionEpilogue, &ZEValidationEntryPoints::zeCommandListAppendMemoryCopyRegionEpilogue);
+        addIfOverridden(zeCommandListAppendMemoryCopyFromContextPrologue, checker, &T::zeCommandListAppendMemoryCopyFromContextPrologue, &ZEValidationEntryPoints::zeCommandListAppendMemoryCopyFromContextPrologue);
+        addIfOverridden(zeCommandListAppendMemoryCopyFromContextEpilogue, checker, &T::zeCommandListAppendMemoryCopyFromContextEpilogue, &ZEValidationEntryPoints::zeCommandListAppendMemoryCopyFromContextEpilogue);
+        addIfOverridden(zeCommandListAppendImageCopyPrologue, checker, &T::zeCommandListAppendImageCopyPrologue, &ZEValidationEntryPoints::zeCommandListAppendImageCopyPrologue);
+        addIfOverridden(zeCommandListAppendImageCopyEpilogue, checker, &T::zeCommandListAppendImageCopyEpilogue, &ZEValidationEntryPoints::zeCommandListAppendImageCopyEpilogue);
+        addIfOverridden(zeCommandListAppendImageCopyRegionPrologue, checker, &T::zeCommandListAppendImageCopyRegionPrologue, &ZEValidationEntryPoints::zeCommandListAppendImageCopyRegionPrologue);
+        addIfOverridden(zeCommandListAppendImageCopyRegionEpilogue, checker, &T::zeCommandListAppendImageCopyRegionEpilogue, &ZEValidationEntryPoints::zeCommandListAppendImageCopyRegionEpilogue);
+        addIfOverridden(zeCommandListAppendImageCopyToMemoryPrologue, checker, &T::zeCommandListAppendImageCopyToMemoryPrologue, &ZEValidationEntryPoints::zeCommandListAppendImageCopyToMemoryPrologue);
+        addIfOverridden(zeCommandListAppendImageCopyToMemoryEpilogue, checker, &T::zeCommandListAppendImageCopyToMemoryEpilogue, &ZEValidationEntryPoints::zeCommandListAppendImageCopyToMemoryEpilogue);
+        addIfOverridden(zeCommandListAppendImageCopyFromMemoryPrologue, checker, &T::zeCommandListAppendImageCopyFromMemoryPrologue, &ZEValidationEntryPoints::zeCommandListAppendImageCopyFromMemoryPrologue);
+        addIfOverridden(zeCommandListAppendImageCopyFromMemoryEpilogue, checker, &T::zeCommandListAppendImageCopyFromMemoryEpilogue, &ZEValidationEntryPoints::zeCommandListAppendImageCopyFromMemoryEpilogue);
+        addIfOverridden(zeCommandListAppendMemoryPrefetchPrologue, checker, &T::zeCommandListAppendMemoryPrefetchPrologue, &ZEValidationEntryPoints::zeCommandListAppendMemoryPrefetchPrologue);
+        addIfOverridden(zeCommandListAppendMemoryPrefetchEpilogue, checker, &T::zeCommandListAppendMemoryPrefetchEpilogue, &ZEValidationEntryPoints::zeCommandListAppendMemoryPrefetchEpilogue);
+        addIfOverridden(zeCommandListAppendMemAdvisePrologue, checker, &T::zeCommandListAppendMemAdvisePrologue, &ZEValidationEntryPoints::zeCommandListAppendMemAdvisePrologue);
+        addIfOverridden(zeCommandListAppendMemAdviseEpilogue, checker, &T::zeCommandListAppendMemAdviseEpilogue, &ZEValidationEntryPoints::zeCommandListAppendMemAdviseEpilogue);
+        addIfOverridden(zeEventPoolCreatePrologue, checker, &T::zeEventPoolCreatePrologue, &ZEValidationEntryPoints::zeEventPoolCreatePrologue);
+        addIfOverridden(zeEventPoolCreateEpilogue, checker, &T::zeEventPoolCreateEpilogue, &ZEValidationEntryPoints::zeEventPoolCreateEpilogue);
+        addIfOverridden(zeEventPoolDestroyPrologue, checker, &T::zeEventPoolDestroyPrologue, &ZEValidationEntryPoints::zeEventPoolDestroyPrologue);
+        addIfOverridden(zeEventPoolDestroyEpilogue, checker, &T::zeEventPoolDestroyEpilogue, &ZEValidationEntryPoints::zeEventPoolDestroyEpilogue);
+        addIfOverridden(zeEventCreatePrologue, checker, &T::zeEventCreatePrologue, &ZEValidationEntryPoints::zeEventCreatePrologue);
+        addIfOverridden(zeEventCreateEpilogue, checker, &T::zeEventCreateEpilogue, &ZEValidationEntryPoints::zeEventCreateEpilogue);
+        addIfOverridden(zeEventCounterBasedCreatePrologue, checker, &T::zeEventCounterBasedCreatePrologue, &ZEValidationEntryPoints::zeEventCounterBasedCreatePrologue);
+        addIfOverridden(zeEventCounterBasedCreateEpilogue, checker, &T::zeEventCounterBasedCreateEpilogue, &ZEValidationEntryPoints::zeEventCounterBasedCreateEpilogue);
+        addIfOverridden(zeEventDestroyPrologue, checker, &T::zeEventDestroyPrologue, &ZEValidationEntryPoints::zeEventDestroyPrologue);
+        addIfOverridden(zeEventDestroyEpilogue, checker, &T::zeEventDestroyEpilogue, &ZEValidationEntryPoints::zeEventDestroyEpilogue);
+        addIfOverridden(zeEventPoolGetIpcHandlePrologue, checker, &T::zeEventPoolGetIpcHandlePrologue, &ZEValidationEntryPoints::zeEventPoolGetIpcHandlePrologue);
+        addIfOverridden(zeEventPoolGetIpcHandleEpilogue, checker, &T::zeEventPoolGetIpcHandleEpilogue, &ZEValidationEntryPoints::zeEventPoolGetIpcHandleEpilogue);
+        addIfOverridden(zeEventPoolPutIpcHandlePrologue, checker, &T::zeEventPoolPutIpcHandlePrologue, &ZEValidationEntryPoints::zeEventPoolPutIpcHandlePrologue);
+        addIfOverridden(zeEventPoolPutIpcHandleEpilogue, checker, &T::zeEventPoolPutIpcHandleEpilogue, &ZEValidationEntryPoints::zeEventPoolPutIpcHandleEpilogue);
+        addIfOverridden(zeEventPoolOpenIpcHandlePrologue, checker, &T::zeEventPoolOpenIpcHandlePrologue, &ZEValidationEntryPoints::zeEventPoolOpenIpcHandlePrologue);
+        addIfOverridden(zeEventPoolOpenIpcHandleEpilogue, checker, &T::zeEventPoolOpenIpcHandleEpilogue, &ZEValidationEntryPoints::zeEventPoolOpenIpcHandleEpilogue);
+        addIfOverridden(zeEventPoolCloseIpcHandlePrologue, checker, &T::zeEventPoolCloseIpcHandlePrologue, &ZEValidationEntryPoints::zeEventPoolCloseIpcHandlePrologue);
+        addIfOverridden(zeEventPoolCloseIpcHandleEpilogue, checker, &T::zeEventPoolCloseIpcHandleEpilogue, &ZEValidationEntryPoints::zeEventPoolCloseIpcHandleEpilogue);
+        addIfOverridden(zeEventCounterBasedGetIpcHandlePrologue, checker, &T::zeEventCounterBasedGetIpcHandlePrologue, &ZEValidationEntryPoints::zeEventCounterBasedGetIpcHandlePrologue);
+        addIfOverridden(zeEventCounterBasedGetIpcHandleEpilogue, checker, &T::zeEventCounterBasedGetIpcHandleEpilogue, &ZEValidationEntryPoints::zeEventCounterBasedGetIpcHandleEpilogue);
+        addIfOverridden(zeEventCounterBasedOpenIpcHandlePrologue, checker, &T::zeEventCounterBasedOpenIpcHandlePrologue, &ZEValidationEntryPoints::zeEventCounterBasedOpenIpcHandlePrologue);
+        addIfOverridden(zeEventCounterBasedOpenIpcHandleEpilogue, checker, &T::zeEventCounterBasedOpenIpcHandleEpilogue, &ZEValidationEntryPoints::zeEventCounterBasedOpenIpcHandleEpilogue);
+        addIfOverridden(zeEventCounterBasedCloseIpcHandlePrologue, checker, &T::zeEventCounterBasedCloseIpcHandlePrologue, &ZEValidationEntryPoints::zeEventCounterBasedCloseIpcHandlePrologue);
+        addIfOverridden(zeEventCounterBasedCloseIpcHandleEpilogue, checker, &T::zeEventCounterBasedCloseIpcHandleEpilogue, &ZEValidationEntryPoints::zeEventCounterBasedCloseIpcHandleEpilogue);
+        addIfOverridden(zeEventCounterBasedGetDeviceAddressPrologue, checker, &T::zeEventCounterBasedGetDeviceAddressPrologue, &ZEValidationEntryPoints::zeEventCounterBasedGetDeviceAddressPrologue);
+        addIfOverridden(zeEventCounterBasedGetDeviceAddressEpilogue, checker, &T::zeEventCounterBasedGetDeviceAddressEpilogue, &ZEValidationEntryPoints::zeEventCounterBasedGetDeviceAddressEpilogue);
+        addIfOverridden(zeCommandListAppendSignalEventPrologue, checker, &T::zeCommandListAppendSignalEventPrologue, &ZEValidationEntryPoints::zeCommandListAppendSignalEventPrologue);
+        addIfOverridden(zeCommandListAppendSignalEventEpilogue, checker, &T::zeCommandListAppendSignalEventEpilogue, &ZEValidationEntryPoints::zeCommandListAppendSignalEventEpilogue);
+        addIfOverridden(zeCommandListAppendWaitOnEventsPrologue, checker, &T::zeCommandListAppendWaitOnEventsPrologue, &ZEValidationEntryPoints::zeCommandListAppendWaitOnEventsPrologue);
+        addIfOverridden(zeCommandListAppendWaitOnEventsEpilogue, checker, &T::zeCommandListAppendWaitOnEventsEpilogue, &ZEValidationEntryPoints::zeCommandListAppendWaitOnEventsEpilogue);
+        addIfOverridden(zeEventHostSignalPrologue, checker, &T::zeEventHostSignalPrologue, &ZEValidationEntryPoints::zeEventHostSignalPrologue);
+        addIfOverridden(zeEventHostSignalEpilogue, checker, &T::zeEventHostSignalEpilogue, &ZEValidationEntryPoints::zeEventHostSignalEpilogue);
+        addIfOverridden(zeEventHostSynchronizePrologue, checker, &T::zeEventHostSynchronizePrologue, &ZEValidationEntryPoints::zeEventHostSynchronizePrologue);
+        addIfOverridden(zeEventHostSynchronizeEpilogue, checker, &T::zeEventHostSynchronizeEpilogue, &ZEValidationEntryPoints::zeEventHostSynchronizeEpilogue);
+        addIfOverridden(zeEventQueryStatusPrologue, checker, &T::zeEventQueryStatusPrologue, &ZEValidationEntryPoints::zeEventQueryStatusPrologue);
+        addIfOverridden(zeEventQueryStatusEpilogue, checker, &T::zeEventQueryStatusEpilogue, &ZEValidationEntryPoints::zeEventQueryStatusEpilogue);
+        addIfOverridden(zeCommandListAppendEventResetPrologue, checker, &T::zeCommandListAppendEventResetPrologue, &ZEValidationEntryPoints::zeCommandListAppendEventResetPrologue);
+        addIfOverridden(zeCommandListAppendEventResetEpilogue, checker, &T::zeCommandListAppendEventResetEpilogue, &ZEValidationEntryPoints::zeCommandListAppendEventResetEpilogue);
+        addIfOverridden(zeEventHostResetPrologue, checker, &T::zeEventHostResetPrologue, &ZEValidationEntryPoints::zeEventHostResetPrologue);
+        addIfOverridden(zeEventHostResetEpilogue, checker, &T::zeEventHostResetEpilogue, &ZEValidationEntryPoints::zeEventHostResetEpilogue);
+        addIfOverridden(zeEventQueryKernelTimestampPrologue, checker, &T::zeEventQueryKernelTimestampPrologue, &ZEValidationEntryPoints::zeEventQueryKernelTimestampPrologue);
+        addIfOverridden(zeEventQueryKernelTimestampEpilogue, checker, &T::zeEventQueryKernelTimestampEpilogue, &ZEValidationEntryPoints::zeEventQueryKernelTimestampEpilogue);
+        addIfOverridden(zeCommandListAppendQueryKernelTimestampsPrologue, checker, &T::zeCommandListAppendQueryKernelTimestampsPrologue, &ZEValidationEntryPoints::zeCommandListAppendQueryKernelTimestampsPrologue);
+        addIfOverridden(zeCommandListAppendQueryKernelTimestampsEpilogue, checker, &T::zeCommandListAppendQueryKernelTimestampsEpilogue, &ZEValidationEntryPoints::zeCommandListAppendQueryKernelTimestampsEpilogue);
+        addIfOverridden(zeEventGetEventPoolPrologue, checker, &T::zeEventGetEventPoolPrologue, &ZEValidationEntryPoints::zeEventGetEventPoolPrologue);
+        addIfOverridden(zeEventGetEventPoolEpilogue, checker, &T::zeEventGetEventPoolEpilogue, &ZEValidationEntryPoints::zeEventGetEventPoolEpilogue);
+        addIfOverridden(zeEventGetSignalScopePrologue, checker, &T::zeEventGetSignalScopePrologue, &ZEValidationEntryPoints::zeEventGetSignalScopePrologue);
+        addIfOverridden(zeEventGetSignalScopeEpilogue, checker, &T::zeEventGetSignalScopeEpilogue, &ZEValidationEntryPoints::zeEventGetSignalScopeEpilogue);
+        addIfOverridden(zeEventGetWaitScopePrologue, checker, &T::zeEventGetWaitScopePrologue, &ZEValidationEntryPoints::zeEventGetWaitScopePrologue);
+        addIfOverridden(zeEventGetWaitScopeEpilogue, checker, &T::zeEventGetWaitScopeEpilogue, &ZEValidationEntryPoints::zeEventGetWaitScopeEpilogue);
+        addIfOverridden(zeEventPoolGetContextHandlePrologue, checker, &T::zeEventPoolGetContextHandlePrologue, &ZEValidationEntryPoints::zeEventPoolGetContextHandlePrologue);
+        addIfOverridden(zeEventPoolGetContextHandleEpilogue, checker, &T::zeEventPoolGetContextHandleEpilogue, &ZEValidationEntryPoints::zeEventPoolGetContextHandleEpilogue);
+        addIfOverridden(zeEventPoolGetFlagsPrologue, checker, &T::zeEventPoolGetFlagsPrologue, &ZEValidationEntryPoints::zeEventPoolGetFlagsPrologue);
+        addIfOverridden(zeEventPoolGetFlagsEpilogue, checker, &T::zeEventPoolGetFlagsEpilogue, &ZEValidationEntryPoints::zeEventPoolGetFlagsEpilogue);
+        addIfOverridden(zeEventGetCounterBasedFlagsPrologue, checker, &T::zeEventGetCounterBasedFlagsPrologue, &ZEValidationEntryPoints::zeEventGetCounterBasedFlagsPrologue);
+        addIfOverridden(zeEventGetCounterBasedFlagsEpilogue, checker, &T::zeEventGetCounterBasedFlagsEpilogue, &ZEValidationEntryPoints::zeEventGetCounterBasedFlagsEpilogue);
+        addIfOverridden(zeFenceCreatePrologue, checker, &T::zeFenceCreatePrologue, &ZEValidationEntryPoints::zeFenceCreatePrologue);
+        addIfOverridden(zeFenceCreateEpilogue, checker, &T::zeFenceCreateEpilogue, &ZEValidationEntryPoints::zeFenceCreateEpilogue);
+        addIfOverridden(zeFenceDestroyPrologue, checker, &T::zeFenceDestroyPrologue, &ZEValidationEntryPoints::zeFenceDestroyPrologue);
+        addIfOverridden(zeFenceDestroyEpilogue, checker, &T::zeFenceDestroyEpilogue, &ZEValidationEntryPoints::zeFenceDestroyEpilogue);
+        addIfOverridden(zeFenceHostSynchronizePrologue, checker, &T::zeFenceHostSynchronizePrologue, &ZEValidationEntryPoints::zeFenceHostSynchronizePrologue);
+        addIfOverridden(zeFenceHostSynchronizeEpilogue, checker, &T::zeFenceHostSynchronizeEpilogue, &ZEValidationEntryPoints::zeFenceHostSynchronizeEpilogue);
+        addIfOverridden(zeFenceQueryStatusPrologue, checker, &T::zeFenceQueryStatusPrologue, &ZEValidationEntryPoints::zeFenceQueryStatusPrologue);
+        addIfOverridden(zeFenceQueryStatusEpilogue, checker, &T::zeFenceQueryStatusEpilogue, &ZEValidationEntryPoints::zeFenceQueryStatusEpilogue);
+        addIfOverridden(zeFenceResetPrologue, checker, &T::zeFenceResetPrologue, &ZEValidationEntryPoints::zeFenceResetPrologue);
+        addIfOverridden(zeFenceResetEpilogue, checker, &T::zeFenceResetEpilogue, &ZEValidationEntryPoints::zeFenceResetEpilogue);
+        addIfOverridden(zeImageGetPropertiesPrologue, checker, &T::zeImageGetPropertiesPrologue, &ZEValidationEntryPoints::zeImageGetPropertiesPrologue);
+        addIfOverridden(zeImageGetPropertiesEpilogue, checker, &T::zeImageGetPropertiesEpilogue, &ZEValidationEntryPoints::zeImageGetPropertiesEpilogue);
+        addIfOverridden(zeImageCreatePrologue, checker, &T::zeImageCreatePrologue, &ZEValidationEntryPoints::zeImageCreatePrologue);
+        addIfOverridden(zeImageCreateEpilogue, checker, &T::zeImageCreateEpilogue, &ZEValidationEntryPoints::zeImageCreateEpilogue);
+        addIfOverridden(zeImageDestroyPrologue, checker, &T::zeImageDestroyPrologue, &ZEValidationEntryPoints::zeImageDestroyPrologue);
+        addIfOverridden(zeImageDestroyEpilogue, checker, &T::zeImageDestroyEpilogue, &ZEValidationEntryPoints::zeImageDestroyEpilogue);
+        addIfOverridden(zeMemAllocSharedPrologue, checker, &T::zeMemAllocSharedPrologue, &ZEValidationEntryPoints::zeMemAllocSharedPrologue);
+        addIfOverridden(zeMemAllocSharedEpilogue, checker, &T::zeMemAllocSharedEpilogue, &ZEValidationEntryPoints::zeMemAllocSharedEpilogue);
+        addIfOverridden(zeMemAllocDevicePrologue, checker, &T::zeMemAllocDevicePrologue, &ZEValidationEntryPoints::zeMemAllocDevicePrologue);
+        addIfOverridden(zeMemAllocDeviceEpilogue, checker, &T::zeMemAllocDeviceEpilogue, &ZEValidationEntryPoints::zeMemAllocDeviceEpilogue);
+        addIfOverridden(zeMemAllocHostPrologue, checker, &T::zeMemAllocHostPrologue, &ZEValidationEntryPoints::zeMemAllocHostPrologue);
+        addIfOverridden(zeMemAllocHostEpilogue, checker, &T::zeMemAllocHostEpilogue, &ZEValidationEntryPoints::zeMemAllocHostEpilogue);
+        addIfOverridden(zeMemFreePrologue, checker, &T::zeMemFreePrologue, &ZEValidationEntryPoints::zeMemFreePrologue);
+        addIfOverridden(zeMemFreeEpilogue, checker, &T::zeMemFreeEpilogue, &ZEValidationEntryPoints::zeMemFreeEpilogue);
+        addIfOverridden(zeMemGetAllocPropertiesPrologue, checker, &T::zeMemGetAllocPropertiesPrologue, &ZEValidationEntryPoints::zeMemGetAllocPropertiesPrologue);
+        addIfOverridden(zeMemGetAllocPropertiesEpilogue, checker, &T::zeMemGetAllocPropertiesEpilogue, &ZEValidationEntryPoints::zeMemGetAllocPropertiesEpilogue);
+        addIfOverridden(zeMemGetAddressRangePrologue, checker, &T::zeMemGetAddressRangePrologue, &ZEValidationEntryPoints::zeMemGetAddressRangePrologue);
+        addIfOverridden(zeMemGetAddressRangeEpilogue, checker, &T::zeMemGetAddressRangeEpilogue, &ZEValidationEntryPoints::zeMemGetAddressRangeEpilogue);
+        addIfOverridden(zeMemGetIpcHandlePrologue, checker, &T::zeMemGetIpcHandlePrologue, &ZEValidationEntryPoints::zeMemGetIpcHandlePrologue);
+        addIfOverridden(zeMemGetIpcHandleEpilogue, checker, &T::zeMemGetIpcHandleEpilogue, &ZEValidationEntryPoints::zeMemGetIpcHandleEpilogue);
+        addIfOverridden(zeMemGetIpcHandleFromFileDescriptorExpPrologue, checker, &T::zeMemGetIpcHandleFromFileDescriptorExpPrologue, &ZEValidationEntryPoints::zeMemGetIpcHandleFromFileDescriptorExpPrologue);
+        addIfOverridden(zeMemGetIpcHandleFromFileDescriptorExpEpilogue, checker, &T::zeMemGetIpcHandleFromFileDescriptorExpEpilogue, &ZEValidationEntryPoints::zeMemGetIpcHandleFromFileDescriptorExpEpilogue);
+        addIfOverridden(zeMemGetFileDescriptorFromIpcHandleExpPrologue, checker, &T::zeMemGetFileDescriptorFromIpcHandleExpPrologue, &ZEValidationEntryPoints::zeMemGetFileDescriptorFromIpcHandleExpPrologue);
+        addIfOverridden(zeMemGetFileDescriptorFromIpcHandleExpEpilogue, checker, &T::zeMemGetFileDescriptorFromIpcHandleExpEpilogue, &ZEValidationEntryPoints::zeMemGetFileDescriptorFromIpcHandleExpEpilogue);
+        addIfOverridden(zeMemPutIpcHandlePrologue, checker, &T::zeMemPutIpcHandlePrologue, &ZEValidationEntryPoints::zeMemPutIpcHandlePrologue);
+        addIfOverridden(zeMemPutIpcHandleEpilogue, checker, &T::zeMemPutIpcHandleEpilogue, &ZEValidationEntryPoints::zeMemPutIpcHandleEpilogue);
+        addIfOverridden(zeMemOpenIpcHandlePrologue, checker, &T::zeMemOpenIpcHandlePrologue, &ZEValidationEntryPoints::zeMemOpenIpcHandlePrologue);
+        addIfOverridden(zeMemOpenIpcHandleEpilogue, checker, &T::zeMemOpenIpcHandleEpilogue, &ZEValidationEntryPoints::zeMemOpenIpcHandleEpilogue);
+        addIfOverridden(zeMemCloseIpcHandlePrologue, checker, &T::zeMemCloseIpcHandlePrologue, &ZEValidationEntryPoints::zeMemCloseIpcHandlePrologue);
+        addIfOverridden(zeMemCloseIpcHandleEpilogue, checker, &T::zeMemCloseIpcHandleEpilogue, &ZEValidationEntryPoints::zeMemCloseIpcHandleEpilogue);
+        addIfOverridden(zeMemSetAtomicAccessAttributeExpPrologue, checker, &T::zeMemSetAtomicAccessAttributeExpPrologue, &ZEValidationEntryPoints::zeMemSetAtomicAccessAttributeExpPrologue);
+        addIfOverridden(zeMemSetAtomicAccessAttributeExpEpilogue, checker, &T::zeMemSetAtomicAccessAttributeExpEpilogue, &ZEValidationEntryPoints::zeMemSetAtomicAccessAttributeExpEpilogue);
+        addIfOverridden(zeMemGetAtomicAccessAttributeExpPrologue, checker, &T::zeMemGetAtomicAccessAttributeExpPrologue, &ZEValidationEntryPoints::zeMemGetAtomicAccessAttributeExpPrologue);
+        addIfOverridden(zeMemGetAtomicAccessAttributeExpEpilogue, checker, &T::zeMemGetAtomicAccessAttributeExpEpilogue, &ZEValidationEntryPoints::zeMemGetAtomicAccessAttributeExpEpilogue);
+        addIfOverridden(zeModuleCreatePrologue, checker, &T::zeModuleCreatePrologue, &ZEValidationEntryPoints::zeModuleCreatePrologue);
+        addIfOverridden(zeModuleCreateEpilogue, checker, &T::zeModuleCreateEpilogue, &ZEValidationEntryPoints::zeModuleCreateEpilogue);
+        addIfOverridden(zeModuleDestroyPrologue, checker, &T::zeModuleDestroyPrologue, &ZEValidationEntryPoints::zeModuleDestroyPrologue);
+        addIfOverridden(zeModuleDestroyEpilogue, checker, &T::zeModuleDestroyEpilogue, &ZEValidationEntryPoints::zeModuleDestroyEpilogue);
+        addIfOverridden(zeModuleDynamicLinkPrologue, checker, &T::zeModuleDynamicLinkPrologue, &ZEValidationEntryPoints::zeModuleDynamicLinkPrologue);
+        addIfOverridden(zeModuleDynamicLinkEpilogue, checker, &T::zeModuleDynamicLinkEpilogue, &ZEValidationEntryPoints::zeModuleDynamicLinkEpilogue);
+        addIfOverridden(zeModuleBuildLogDestroyPrologue, checker, &T::zeModuleBuildLogDestroyPrologue, &ZEValidationEntryPoints::zeModuleBuildLogDestroyPrologue);
+        addIfOverridden(zeModuleBuildLogDestroyEpilogue, checker, &T::zeModuleBuildLogDestroyEpilogue, &ZEValidationEntryPoints::zeModuleBuildLogDestroyEpilogue);
+        addIfOverridden(zeModuleBuildLogGetStringPrologue, checker, &T::zeModuleBuildLogGetStringPrologue, &ZEValidationEntryPoints::zeModuleBuildLogGetStringPrologue);
+        addIfOverridden(zeModuleBuildLogGetStringEpilogue, checker, &T::zeModuleBuildLogGetStringEpilogue, &ZEValidationEntryPoints::zeModuleBuildLogGetStringEpilogue);
+        addIfOverridden(zeModuleGetNativeBinaryPrologue, checker, &T::zeModuleGetNativeBinaryPrologue, &ZEValidationEntryPoints::zeModuleGetNativeBinaryPrologue);
+        addIfOverridden(zeModuleGetNativeBinaryEpilogue, checker, &T::zeModuleGetNativeBinaryEpilogue, &ZEValidationEntryPoints::zeModuleGetNativeBinaryEpilogue);
+        addIfOverridden(zeModuleGetGlobalPointerPrologue, checker, &T::zeModuleGetGlobalPointerPrologue, &ZEValidationEntryPoints::zeModuleGetGlobalPointerPrologue);
+        addIfOverridden(zeModuleGetGlobalPointerEpilogue, checker, &T::zeModuleGetGlobalPointerEpilogue, &ZEValidationEntryPoints::zeModuleGetGlobalPointerEpilogue);
+        addIfOverridden(zeModuleGetKernelNamesPrologue, checker, &T::zeModuleGetKernelNamesPrologue, &ZEValidationEntryPoints::zeModuleGetKernelNamesPrologue);
+        addIfOverridden(zeModuleGetKernelNamesEpilogue, checker, &T::zeModuleGetKernelNamesEpilogue, &ZEValidationEntryPoints::zeModuleGetKernelNamesEpilogue);
+        addIfOverridden(zeModuleGetPropertiesPrologue, checker, &T::zeModuleGetPropertiesPrologue, &ZEValidationEntryPoints::zeModuleGetPropertiesPrologue);
+        addIfOverridden(zeModuleGetPropertiesEpilogue, checker, &T::zeModuleGetPropertiesEpilogue, &ZEValidationEntryPoints::zeModuleGetPropertiesEpilogue);
+        addIfOverridden(zeKernelCreatePrologue, checker, &T::zeKernelCreatePrologue, &ZEValidationEntryPoints::zeKernelCreatePrologue);
+        addIfOverridden(zeKernelCreateEpilogue, checker, &T::zeKernelCreateEpilogue, &ZEValidationEntryPoints::zeKernelCreateEpilogue);
+        addIfOverridden(zeKernelDestroyPrologue, checker, &T::zeKernelDestroyPrologue, &ZEValidationEntryPoints::zeKernelDestroyPrologue);
+        addIfOverridden(zeKernelDestroyEpilogue, checker, &T::zeKernelDestroyEpilogue, &ZEValidationEntryPoints::zeKernelDestroyEpilogue);
+        addIfOverridden(zeModuleGetFunctionPointerPrologue, checker, &T::zeModuleGetFunctionPointerPrologue, &ZEValidationEntryPoints::zeModuleGetFunctionPointerPrologue);
+        addIfOverridden(zeModuleGetFunctionPointerEpilogue, checker, &T::zeModuleGetFunctionPointerEpilogue, &ZEValidationEntryPoints::zeModuleGetFunctionPointerEpilogue);
+        addIfOverridden(zeKernelSetGroupSizePrologue, checker, &T::zeKernelSetGroupSizePrologue, &ZEValidationEntryPoints::zeKernelSetGroupSizePrologue);
+        addIfOverridden(zeKernelSetGroupSizeEpilogue, checker, &T::zeKernelSetGroupSizeEpilogue, &ZEValidationEntryPoints::zeKernelSetGroupSizeEpilogue);
+        addIfOverridden(zeKernelSuggestGroupSizePrologue, checker, &T::zeKernelSuggestGroupSizePrologue, &ZEValidationEntryPoints::zeKernelSuggestGroupSizePrologue);
+        addIfOverridden(zeKernelSuggestGroupSizeEpilogue, checker, &T::zeKernelSuggestGroupSizeEpilogue, &ZEValidationEntryPoints::zeKernelSuggestGroupSizeEpilogue);
+        addIfOverridden(zeKernelSuggestMaxCooperativeGroupCountPrologue, checker, &T::zeKernelSuggestMaxCooperativeGroupCountPrologue, &ZEValidationEntryPoints::zeKernelSuggestMaxCooperativeGroupCountPrologue);
+        addIfOverridden(zeKernelSuggestMaxCooperativeGroupCountEpilogue, checker, &T::zeKernelSuggestMaxCooperativeGroupCountEpilogue, &ZEValidationEntryPoints::zeKernelSuggestMaxCooperativeGroupCountEpilogue);
+        addIfOverridden(zeKernelSetArgumentValuePrologue, checker, &T::zeKernelSetArgumentValuePrologue, &ZEValidationEntryPoints::zeKernelSetArgumentValuePrologue);
+        addIfOverridden(zeKernelSetArgumentValueEpilogue, checker, &T::zeKernelSetArgumentValueEpilogue, &ZEValidationEntryPoints::zeKernelSetArgumentValueEpilogue);
+        addIfOverridden(zeKernelSetIndirectAccessPrologue, checker, &T::zeKernelSetIndirectAccessPrologue, &ZEValidationEntryPoints::zeKernelSetIndirectAccessPrologue);
+        addIfOverridden(zeKernelSetIndirectAccessEpilogue, checker, &T::zeKernelSetIndirectAccessEpilogue, &ZEValidationEntryPoints::zeKernelSetIndirectAccessEpilogue);
+        addIfOverridden(zeKernelGetIndirectAccessPrologue, checker, &T::zeKernelGetIndirectAccessPrologue, &ZEValidationEntryPoints::zeKernelGetIndirectAccessPrologue);
+        addIfOverridden(zeKernelGetIndirectAccessEpilogue, checker, &T::zeKernelGetIndirectAccessEpilogue, &ZEValidationEntryPoints::zeKernelGetIndirectAccessEpilogue);
+        addIfOverridden(zeKernelGetSourceAttributesPrologue, checker, &T::zeKernelGetSourceAttributesPrologue, &ZEValidationEntryPoints::zeKernelGetSourceAttributesPrologue);
+        addIfOverridden(zeKernelGetSourceAttributesEpilogue, checker, &T::zeKernelGetSourceAttributesEpilogue, &ZEValidationEntryPoints::zeKernelGetSourceAttributesEpilogue);
+        addIfOverridden(zeKernelSetCacheConfigPrologue, checker, &T::zeKernelSetCacheConfigPrologue, &ZEValidationEntryPoints::zeKernelSetCacheConfigPrologue);
+        addIfOverridden(zeKernelSetCacheConfigEpilogue, checker, &T::zeKernelSetCacheConfigEpilogue, &ZEValidationEntryPoints::zeKernelSetCacheConfigEpilogue);
+        addIfOverridden(zeKernelGetPropertiesPrologue, checker, &T::zeKernelGetPropertiesPrologue, &ZEValidationEntryPoints::zeKernelGetPropertiesPrologue);
+        addIfOverridden(zeKernelGetPropertiesEpilogue, checker, &T::zeKernelGetPropertiesEpilogue, &ZEValidationEntryPoints::zeKernelGetPropertiesEpilogue);
+        addIfOverridden(zeKernelGetNamePrologue, checker, &T::zeKernelGetNamePrologue, &ZEValidationEntryPoints::zeKernelGetNamePrologue);
+        addIfOverridden(zeKernelGetNameEpilogue, checker, &T::zeKernelGetNameEpilogue, &ZEValidationEntryPoints::zeKernelGetNameEpilogue);
+        addIfOverridden(zeCommandListAppendLaunchKernelPrologue, checker, &T::zeCommandListAppendLaunchKernelPrologue, &ZEValidationEntryPoints::zeCommandListAppendLaunchKernelPrologue);
+        addIfOverridden(zeCommandListAppendLaunchKernelEpilogue, checker, &T::zeCommandListAppendLaunchKernelEpilogue, &ZEValidationEntryPoints::zeCommandListAppendLaunchKernelEpilogue);
+        addIfOverridden(zeCommandListAppendLaunchKernelWithParametersPrologue, checker, &T::zeCommandListAppendLaunchKernelWithParametersPrologue, &ZEValidationEntryPoints::zeCommandListAppendLaunchKernelWithParametersPrologue);
+        addIfOverridden(zeCommandListAppendLaunchKernelWithParametersEpilogue, checker, &T::zeCommandListAppendLaunchKernelWithParametersEpilogue, &ZEValidationEntryPoints::zeCommandListAppendLaunchKernelWithParametersEpilogue);
+        addIfOverridden(zeCommandListAppendLaunchKernelWithArgumentsPrologue, checker, &T::zeCommandListAppendLaunchKernelWithArgumentsPrologue, &ZEValidationEntryPoints::zeCommandListAppendLaunchKernelWithArgumentsPrologue);
+        addIfOverridden(zeCommandListAppendLaunchKernelWithArgumentsEpilogue, checker, &T::zeCommandListAppendLaunchKernelWithArgumentsEpilogue, &ZEValidationEntryPoints::zeCommandListAppendLaunchKernelWithArgumentsEpilogue);
+        addIfOverridden(zeCommandListAppendLaunchCooperativeKernelPrologue, checker, &T::zeCommandListAppendLaunchCooperativeKernelPrologue, &ZEValidationEntryPoints::zeCommandListAppendLaunchCooperativeKernelPrologue);
+        addIfOverridden(zeCommandListAppendLaunchCooperativeKernelEpilogue, checker, &T::zeCommandListAppendLaunchCooperativeKernelEpilogue, &ZEValidationEntryPoints::zeCommandListAppendLaunchCooperativeKernelEpilogue);
+        addIfOverridden(zeCommandListAppendLaunchKernelIndirectPrologue, checker, &T::zeCommandListAppendLaunchKernelIndirectPrologue, &ZEValidationEntryPoints::zeCommandListAppendLaunchKernelIndirectPrologue);
+        addIfOverridden(zeCommandListAppendLaunchKernelIndirectEpilogue, checker, &T::zeCommandListAppendLaunchKernelIndirectEpilogue, &ZEValidationEntryPoints::zeCommandListAppendLaunchKernelIndirectEpilogue);
+        addIfOverridden(zeCommandListAppendLaunchMultipleKernelsIndirectPrologue, checker, &T::zeCommandListAppendLaunchMultipleKernelsIndirectPrologue, &ZEValidationEntryPoints::zeCommandListAppendLaunchMultipleKernelsIndirectPrologue);
+        addIfOverridden(zeCommandListAppendLaunchMultipleKernelsIndirectEpilogue, checker, &T::zeCommandListAppendLaunchMultipleKernelsIndirectEpilogue, &ZEValidationEntryPoints::zeCommandListAppendLaunchMultipleKernelsIndirectEpilogue);
+        addIfOverridden(zeContextMakeMemoryResidentPrologue, checker, &T::zeContextMakeMemoryResidentPrologue, &ZEValidationEntryPoints::zeContextMakeMemoryResidentPrologue);
+        addIfOverridden(zeContextMakeMemoryResidentEpilogue, checker, &T::zeContextMakeMemoryResidentEpilogue, &ZEValidationEntryPoints::zeContextMakeMemoryResidentEpilogue);
+        addIfOverridden(zeContextEvictMemoryPrologue, checker, &T::zeContextEvictMemoryPrologue, &ZEValidationEntryPoints::zeContextEvictMemoryPrologue);
+        addIfOverridden(zeContextEvictMemoryEpilogue, checker, &T::zeContextEvictMemoryEpilogue, &ZEValidationEntryPoints::zeContextEvictMemoryEpilogue);
+        addIfOverridden(zeContextMakeImageResidentPrologue, checker, &T::zeContextMakeImageResidentPrologue, &ZEValidationEntryPoints::zeContextMakeImageResidentPrologue);
+        addIfOverridden(zeContextMakeImageResidentEpilogue, checker, &T::zeContextMakeImageResidentEpilogue, &ZEValidationEntryPoints::zeContextMakeImageResidentEpilogue);
+        addIfOverridden(zeContextEvictImagePrologue, checker, &T::zeContextEvictImagePrologue, &ZEValidationEntryPoints::zeContextEvictImagePrologue);
+        addIfOverridden(zeContextEvictImageEpilogue, checker, &T::zeContextEvictImageEpilogue, &ZEValidationEntryPoints::zeContextEvictImageEpilogue);
+        addIfOverridden(zeSamplerCreatePrologue, checker, &T::zeSamplerCreatePrologue, &ZEValidationEntryPoints::zeSamplerCreatePrologue);
+        addIfOverridden(zeSamplerCreateEpilogue, checker, &T::zeSamplerCreateEpilogue, &ZEValidationEntryPoints::zeSamplerCreateEpilogue);
+        addIfOverridden(zeSamplerDestroyPrologue, checker, &T::zeSamplerDestroyPrologue, &ZEValidationEntryPoints::zeSamplerDestroyPrologue);
+        addIfOverridden(zeSamplerDestroyEpilogue, checker, &T::zeSamplerDestroyEpilogue, &ZEValidationEntryPoints::zeSamplerDestroyEpilogue);
+        addIfOverridden(zeVirtualMemReservePrologue, checker, &T::zeVirtualMemReservePrologue, &ZEValidationEntryPoints::zeVirtualMemReservePrologue);
+        addIfOverridden(zeVirtualMemReserveEpilogue, checker, &T::zeVirtualMemReserveEpilogue, &ZEValidationEntryPoints::zeVirtualMemReserveEpilogue);
+        addIfOverridden(zeVirtualMemFreePrologue, checker, &T::zeVirtualMemFreePrologue, &ZEValidationEntryPoints::zeVirtualMemFreePrologue);
+        addIfOverridden(zeVirtualMemFreeEpilogue, checker, &T::zeVirtualMemFreeEpilogue, &ZEValidationEntryPoints::zeVirtualMemFreeEpilogue);
+        addIfOverridden(zeVirtualMemQueryPageSizePrologue, checker, &T::zeVirtualMemQueryPageSizePrologue, &ZEValidationEntryPoints::zeVirtualMemQueryPageSizePrologue);
+        addIfOverridden(zeVirtualMemQueryPageSizeEpilogue, checker, &T::zeVirtualMemQueryPageSizeEpilogue, &ZEValidationEntryPoints::zeVirtualMemQueryPageSizeEpilogue);
+        addIfOverridden(zePhysicalMemGetPropertiesPrologue, checker, &T::zePhysicalMemGetPropertiesPrologue, &ZEValidationEntryPoints::zePhysicalMemGetPropertiesPrologue);
+        addIfOverridden(zePhysicalMemGetPropertiesEpilogue, checker, &T::zePhysicalMemGetPropertiesEpilogue, &ZEValidationEntryPoints::zePhysicalMemGetPropertiesEpilogue);
+        addIfOverridden(zePhysicalMemCreatePrologue, checker, &T::zePhysicalMemCreatePrologue, &ZEValidationEntryPoints::zePhysicalMemCreatePrologue);
+        addIfOverridden(zePhysicalMemCreateEpilogue, checker, &T::zePhysicalMemCreateEpilogue, &ZEValidationEntryPoints::zePhysicalMemCreateEpilogue);
+        addIfOverridden(zePhysicalMemDestroyPrologue, checker, &T::zePhysicalMemDestroyPrologue, &ZEValidationEntryPoints::zePhysicalMemDestroyPrologue);
+        addIfOverridden(zePhysicalMemDestroyEpilogue, checker, &T::zePhysicalMemDestroyEpilogue, &ZEValidationEntryPoints::zePhysicalMemDestroyEpilogue);
+        addIfOverridden(zeVirtualMemMapPrologue, checker, &T::zeVirtualMemMapPrologue, &ZEValidationEntryPoints::zeVirtualMemMapPrologue);
+        addIfOverridden(zeVirtualMemMapEpilogue, checker, &T::zeVirtualMemMapEpilogue, &ZEValidationEntryPoints::zeVirtualMemMapEpilogue);
+        addIfOverridden(zeVirtualMemUnmapPrologue, checker, &T::zeVirtualMemUnmapPrologue, &ZEValidationEntryPoints::zeVirtualMemUnmapPrologue);
+        addIfOverridden(zeVirtualMemUnmapEpilogue, checker, &T::zeVirtualMemUnmapEpilogue, &ZEValidationEntryPoints::zeVirtualMemUnmapEpilogue);
+        addIfOverridden(zeVirtualMemSetAccessAttributePrologue, checker, &T::zeVirtualMemSetAccessAttributePrologue, &ZEValidationEntryPoints::zeVirtualMemSetAccessAttributePrologue);
+        addIfOverridden(zeVirtualMemSetAccessAttributeEpilogue, checker, &T::zeVirtualMemSetAccessAttributeEpilogue, &ZEValidationEntryPoints::zeVirtualMemSetAccessAttributeEpilogue);
+        addIfOverridden(zeVirtualMemGetAccessAttributePrologue, checker, &T::zeVirtualMemGetAccessAttributePrologue, &ZEValidationEntryPoints::zeVirtualMemGetAccessAttributePrologue);
+        addIfOverridden(zeVirtualMemGetAccessAttributeEpilogue, checker, &T::zeVirtualMemGetAccessAttributeEpilogue, &ZEValidationEntryPoints::zeVirtualMemGetAccessAttributeEpilogue);
+        addIfOverridden(zeKernelSetGlobalOffsetExpPrologue, checker, &T::zeKernelSetGlobalOffsetExpPrologue, &ZEValidationEntryPoints::zeKernelSetGlobalOffsetExpPrologue);
+        addIfOverridden(zeKernelSetGlobalOffsetExpEpilogue, checker, &T::zeKernelSetGlobalOffsetExpEpilogue, &ZEValidationEntryPoints::zeKernelSetGlobalOffsetExpEpilogue);
+        addIfOverridden(zeDeviceReserveCacheExtPrologue, checker, &T::zeDeviceReserveCacheExtPrologue, &ZEValidationEntryPoints::zeDeviceReserveCacheExtPrologue);
+        addIfOverridden(zeDeviceReserveCacheExtEpilogue, checker, &T::zeDeviceReserveCacheExtEpilogue, &ZEValidationEntryPoints::zeDeviceReserveCacheExtEpilogue);
+        addIfOverridden(zeDeviceSetCacheAdviceExtPrologue, checker, &T::zeDeviceSetCacheAdviceExtPrologue, &ZEValidationEntryPoints::zeDeviceSetCacheAdviceExtPrologue);
+        addIfOverridden(zeDeviceSetCacheAdviceExtEpilogue, checker, &T::zeDeviceSetCacheAdviceExtEpilogue, &ZEValidationEntryPoints::zeDeviceSetCacheAdviceExtEpilogue);
+        addIfOverridden(zeEventQueryTimestampsExpPrologue, checker, &T::zeEventQueryTimestampsExpPrologue, &ZEValidationEntryPoints::zeEventQueryTimestampsExpPrologue);
+        addIfOverridden(zeEventQueryTimestampsExpEpilogue, checker, &T::zeEventQueryTimestampsExpEpilogue, &ZEValidationEntryPoints::zeEventQueryTimestampsExpEpilogue);
+        addIfOverridden(zeImageGetMemoryPropertiesExpPrologue, checker, &T::zeImageGetMemoryPropertiesExpPrologue, &ZEValidationEntryPoints::zeImageGetMemoryPropertiesExpPrologue);
+        addIfOverridden(zeImageGetMemoryPropertiesExpEpilogue, checker, &T::zeImageGetMemoryPropertiesExpEpilogue, &ZEValidationEntryPoints::zeImageGetMemoryPropertiesExpEpilogue);
+        addIfOverridden(zeImageViewCreateExtPrologue, checker, &T::zeImageViewCreateExtPrologue, &ZEValidationEntryPoints::zeImageViewCreateExtPrologue);
+        addIfOverridden(zeImageViewCreateExtEpilogue, checker, &T::zeImageViewCreateExtEpilogue, &ZEValidationEntryPoints::zeImageViewCreateExtEpilogue);
+        addIfOverridden(zeImageViewCreateExpPrologue, checker, &T::zeImageViewCreateExpPrologue, &ZEValidationEntryPoints::zeImageViewCreateExpPrologue);
+        addIfOverridden(zeImageViewCreateExpEpilogue, checker, &T::zeImageViewCreateExpEpilogue, &ZEValidationEntryPoints::zeImageViewCreateExpEpilogue);
+        addIfOverridden(zeKernelSchedulingHintExpPrologue, checker, &T::zeKernelSchedulingHintExpPrologue, &ZEValidationEntryPoints::zeKernelSchedulingHintExpPrologue);
+        addIfOverridden(zeKernelSchedulingHintExpEpilogue, checker, &T::zeKernelSchedulingHintExpEpilogue, &ZEValidationEntryPoints::zeKernelSchedulingHintExpEpilogue);
+        addIfOverridden(zeDevicePciGetPropertiesExtPrologue, checker, &T::zeDevicePciGetPropertiesExtPrologue, &ZEValidationEntryPoints::zeDevicePciGetPropertiesExtPrologue);
+        addIfOverridden(zeDevicePciGetPropertiesExtEpilogue, checker, &T::zeDevicePciGetPropertiesExtEpilogue, &ZEValidationEntryPoints::zeDevicePciGetPropertiesExtEpilogue);
+        addIfOverridden(zeCommandListAppendImageCopyToMemoryExtPrologue, checker, &T::zeCommandListAppendImageCopyToMemoryExtPrologue, &ZEValidationEntryPoints::zeCommandListAppendImageCopyToMemoryExtPrologue);
+        addIfOverridden(zeCommandListAppendImageCopyToMemoryExtEpilogue, checker, &T::zeCommandListAppendImageCopyToMemoryExtEpilogue, &ZEValidationEntryPoints::zeCommandListAppendImageCopyToMemoryExtEpilogue);
+        addIfOverridden(zeCommandListAppendImageCopyFromMemoryExtPrologue, checker, &T::zeCommandListAppendImageCopyFromMemoryExtPrologue, &ZEValidationEntryPoints::zeCommandListAppendImageCopyFromMemoryExtPrologue);
+        addIfOverridden(zeCommandListAppendImageCopyFromMemoryExtEpilogue, checker, &T::zeCommandListAppendImageCopyFromMemoryExtEpilogue, &ZEValidationEntryPoints::zeCommandListAppendImageCopyFromMemoryExtEpilogue);
+        addIfOverridden(zeImageGetAllocPropertiesExtPrologue, checker, &T::zeImageGetAllocPropertiesExtPrologue, &ZEValidationEntryPoints::zeImageGetAllocPropertiesExtPrologue);
+        addIfOverridden(zeImageGetAllocPropertiesExtEpilogue, checker, &T::zeImageGetAllocPropertiesExtEpilogue, &ZEValidationEntryPoints::zeImageGetAllocPropertiesExtEpilogue);
+        addIfOverridden(zeModuleInspectLinkageExtPrologue, checker, &T::zeModuleInspectLinkageExtPrologue, &ZEValidationEntryPoints::zeModuleInspectLinkageExtPrologue);
+        addIfOverridden(zeModuleInspectLinkageExtEpilogue, checker, &T::zeModuleInspectLinkageExtEpilogue, &ZEValidationEntryPoints::zeModuleInspectLinkageExtEpilogue);
+        addIfOverridden(zeMemFreeExtPrologue, checker, &T::zeMemFreeExtPrologue, &ZEValidationEntryPoints::zeMemFreeExtPrologue);
+        addIfOverridden(zeMemFreeExtEpilogue, checker, &T::zeMemFreeExtEpilogue, &ZEValidationEntryPoints::zeMemFreeExtEpilogue);
+        addIfOverridden(zeFabricVertexGetExpPrologue, checker, &T::zeFabricVertexGetExpPrologue, &ZEValidationEntryPoints::zeFabricVertexGetExpPrologue);
+        addIfOverridden(zeFabricVertexGetExpEpilogue, checker, &T::zeFabricVertexGetExpEpilogue, &ZEValidationEntryPoints::zeFabricVertexGetExpEpilogue);
+        addIfOverridden(zeFabricVertexGetSubVerticesExpPrologue, checker, &T::zeFabricVertexGetSubVerticesExpPrologue, &ZEValidationEntryPoints::zeFabricVertexGetSubVerticesExpPrologue);
+        addIfOverridden(zeFabricVertexGetSubVerticesExpEpilogue, checker, &T::zeFabricVertexGetSubVerticesExpEpilogue, &ZEValidationEntryPoints::zeFabricVertexGetSubVerticesExpEpilogue);
+        addIfOverridden(zeFabricVertexGetPropertiesExpPrologue, checker, &T::zeFabricVertexGetPropertiesExpPrologue, &ZEValidationEntryPoints::zeFabricVertexGetPropertiesExpPrologue);
+        addIfOverridden(zeFabricVertexGetPropertiesExpEpilogue, checker, &T::zeFabricVertexGetPropertiesExpEpilogue, &ZEValidationEntryPoints::zeFabricVertexGetPropertiesExpEpilogue);
+        addIfOverridden(zeFabricVertexGetDeviceExpPrologue, checker, &T::zeFabricVertexGetDeviceExpPrologue, &ZEValidationEntryPoints::zeFabricVertexGetDeviceExpPrologue);
+        addIfOverridden(zeFabricVertexGetDeviceExpEpilogue, checker, &T::zeFabricVertexGetDeviceExpEpilogue, &ZEValidationEntryPoints::zeFabricVertexGetDeviceExpEpilogue);
+        addIfOverridden(zeDeviceGetFabricVertexExpPrologue, checker, &T::zeDeviceGetFabricVertexExpPrologue, &ZEValidationEntryPoints::zeDeviceGetFabricVertexExpPrologue);
+        addIfOverridden(zeDeviceGetFabricVertexExpEpilogue, checker, &T::zeDeviceGetFabricVertexExpEpilogue, &ZEValidationEntryPoints::zeDeviceGetFabricVertexExpEpilogue);
+        addIfOverridden(zeFabricEdgeGetExpPrologue, checker, &T::zeFabricEdgeGetExpPrologue, &ZEValidationEntryPoints::zeFabricEdgeGetExpPrologue);
+        addIfOverridden(zeFabricEdgeGetExpEpilogue, checker, &T::zeFabricEdgeGetExpEpilogue, &ZEValidationEntryPoints::zeFabricEdgeGetExpEpilogue);
+        addIfOverridden(zeFabricEdgeGetVerticesExpPrologue, checker, &T::zeFabricEdgeGetVerticesExpPrologue, &ZEValidationEntryPoints::zeFabricEdgeGetVerticesExpPrologue);
+        addIfOverridden(zeFabricEdgeGetVerticesExpEpilogue, checker, &T::zeFabricEdgeGetVerticesExpEpilogue, &ZEValidationEntryPoints::zeFabricEdgeGetVerticesExpEpilogue);
+        addIfOverridden(zeFabricEdgeGetPropertiesExpPrologue, checker, &T::zeFabricEdgeGetPropertiesExpPrologue, &ZEValidationEntryPoints::zeFabricEdgeGetPropertiesExpPrologue);
+        addIfOverridden(zeFabricEdgeGetPropertiesExpEpilogue, checker, &T::zeFabricEdgeGetPropertiesExpEpilogue, &ZEValidationEntryPoints::zeFabricEdgeGetPropertiesExpEpilogue);
+        addIfOverridden(zeEventQueryKernelTimestampsExtPrologue, checker, &T::zeEventQueryKernelTimestampsExtPrologue, &ZEValidationEntryPoints::zeEventQueryKernelTimestampsExtPrologue);
+        addIfOverridden(zeEventQueryKernelTimestampsExtEpilogue, checker, &T::zeEventQueryKernelTimestampsExtEpilogue, &ZEValidationEntryPoints::zeEventQueryKernelTimestampsExtEpilogue);
+        addIfOverridden(zeRTASBuilderCreateExpPrologue, checker, &T::zeRTASBuilderCreateExpPrologue, &ZEValidationEntryPoints::zeRTASBuilderCreateExpPrologue);
+        addIfOverridden(zeRTASBuilderCreateExpEpilogue, checker, &T::zeRTASBuilderCreateExpEpilogue, &ZEValidationEntryPoints::zeRTASBuilderCreateExpEpilogue);
+        addIfOverridden(zeRTASBuilderGetBuildPropertiesExpPrologue, checker, &T::zeRTASBuilderGetBuildPropertiesExpPrologue, &ZEValidationEntryPoints::zeRTASBuilderGetBuildPropertiesExpPrologue);
+        addIfOverridden(zeRTASBuilderGetBuildPropertiesExpEpilogue, checker, &T::zeRTASBuilderGetBuildPropertiesExpEpilogue, &ZEValidationEntryPoints::zeRTASBuilderGetBuildPropertiesExpEpilogue);
+        addIfOverridden(zeDriverRTASFormatCompatibilityCheckExpPrologue, checker, &T::zeDriverRTASFormatCompatibilityCheckExpPrologue, &ZEValidationEntryPoints::zeDriverRTASFormatCompatibilityCheckExpPrologue);
+        addIfOverridden(zeDriverRTASFormatCompatibilityCheckExpEpilogue, checker, &T::zeDriverRTASFormatCompatibilityCheckExpEpilogue, &ZEValidationEntryPoints::zeDriverRTASFormatCompatibilityCheckExpEpilogue);
+        addIfOverridden(zeRTASBuilderBuildExpPrologue, checker, &T::zeRTASBuilderBuildExpPrologue, &ZEValidationEntryPoints::zeRTASBuilderBuildExpPrologue);
+        addIfOverridden(zeRTASBuilderBuildExpEpilogue, checker, &T::zeRTASBuilderBuildExpEpilogue, &ZEValidationEntryPoints::zeRTASBuilderBuildExpEpilogue);
+        addIfOverridden(zeRTASBuilderDestroyExpPrologue, checker, &T::zeRTASBuilderDestroyExpPrologue, &ZEValidationEntryPoints::zeRTASBuilderDestroyExpPrologue);
+        addIfOverridden(zeRTASBuilderDestroyExpEpilogue, checker, &T::zeRTASBuilderDestroyExpEpilogue, &ZEValidationEntryPoints::zeRTASBuilderDestroyExpEpilogue);
+        addIfOverridden(zeRTASParallelOperationCreateExpPrologue, checker, &T::zeRTASParallelOperationCreateExpPrologue, &ZEValidationEntryPoints::zeRTASParallelOperationCreateExpPrologue);
+        addIfOverridden(zeRTASParallelOperationCreateExpEpilogue, checker, &T::zeRTASParallelOperationCreateExpEpilogue, &ZEValidationEntryPoints::zeRTASParallelOperationCreateExpEpilogue);
+        addIfOverridden(zeRTASParallelOperationGetPropertiesExpPrologue, checker, &T::zeRTASParallelOperationGetPropertiesExpPrologue, &ZEValidationEntryPoints::zeRTASParallelOperationGetPropertiesExpPrologue);
+        addIfOverridden(zeRTASParallelOperationGetPropertiesExpEpilogue, checker, &T::zeRTASParallelOperationGetPropertiesExpEpilogue, &ZEValidationEntryPoints::zeRTASParallelOperationGetPropertiesExpEpilogue);
+        addIfOverridden(zeRTASParallelOperationJoinExpPrologue, checker, &T::zeRTASParallelOperationJoinExpPrologue, &ZEValidationEntryPoints::zeRTASParallelOperationJoinExpPrologue);
+        addIfOverridden(zeRTASParallelOperationJoinExpEpilogue, checker, &T::zeRTASParallelOperationJoinExpEpilogue, &ZEValidationEntryPoints::zeRTASParallelOperationJoinExpEpilogue);
+        addIfOverridden(zeRTASParallelOperationDestroyExpPrologue, checker, &T::zeRTASParallelOperationDestroyExpPrologue, &ZEValidationEntryPoints::zeRTASParallelOperationDestroyExpPrologue);
+        addIfOverridden(zeRTASParallelOperationDestroyExpEpilogue, checker, &T::zeRTASParallelOperationDestroyExpEpilogue, &ZEValidationEntryPoints::zeRTASParallelOperationDestroyExpEpilogue);
+        addIfOverridden(zeMemGetPitchFor2dImagePrologue, checker, &T::zeMemGetPitchFor2dImagePrologue, &ZEValidationEntryPoints::zeMemGetPitchFor2dImagePrologue);
+        addIfOverridden(zeMemGetPitchFor2dImageEpilogue, checker, &T::zeMemGetPitchFor2dImageEpilogue, &ZEValidationEntryPoints::zeMemGetPitchFor2dImageEpilogue);
+        addIfOverridden(zeImageGetDeviceOffsetExpPrologue, checker, &T::zeImageGetDeviceOffsetExpPrologue, &ZEValidationEntryPoints::zeImageGetDeviceOffsetExpPrologue);
+        addIfOverridden(zeImageGetDeviceOffsetExpEpilogue, checker, &T::zeImageGetDeviceOffsetExpEpilogue, &ZEValidationEntryPoints::zeImageGetDeviceOffsetExpEpilogue);
+        addIfOverridden(zeCommandListCreateCloneExpPrologue, checker, &T::zeCommandListCreateCloneExpPrologue, &ZEValidationEntryPoints::zeCommandListCreateCloneExpPrologue);
+        addIfOverridden(zeCommandListCreateCloneExpEpilogue, checker, &T::zeCommandListCreateCloneExpEpilogue, &ZEValidationEntryPoints::zeCommandListCreateCloneExpEpilogue);
+        addIfOverridden(zeCommandListImmediateAppendCommandListsExpPrologue, checker, &T::zeCommandListImmediateAppendCommandListsExpPrologue, &ZEValidationEntryPoints::zeCommandListImmediateAppendCommandListsExpPrologue);
+        addIfOverridden(zeCommandListImmediateAppendCommandListsExpEpilogue, checker, &T::zeCommandListImmediateAppendCommandListsExpEpilogue, &ZEValidationEntryPoints::zeCommandListImmediateAppendCommandListsExpEpilogue);
+        addIfOverridden(zeCommandListImmediateAppendCommandListsWithParametersPrologue, checker, &T::zeCommandListImmediateAppendCommandListsWithParametersPrologue, &ZEValidationEntryPoints::zeCommandListImmediateAppendCommandListsWithParametersPrologue);
+        addIfOverridden(zeCommandListImmediateAppendCommandListsWithParametersEpilogue, checker, &T::zeCommandListImmediateAppendCommandListsWithParametersEpilogue, &ZEValidationEntryPoints::zeCommandListImmediateAppendCommandListsWithParametersEpilogue);
+        addIfOverridden(zeCommandListGetNextCommandIdExpPrologue, checker, &T::zeCommandListGetNextCommandIdExpPrologue, &ZEValidationEntryPoints::zeCommandListGetNextCommandIdExpPrologue);
+        addIfOverridden(zeCommandListGetNextCommandIdExpEpilogue, checker, &T::zeCommandListGetNextCommandIdExpEpilogue, &ZEValidationEntryPoints::zeCommandListGetNextCommandIdExpEpilogue);
+        addIfOverridden(zeCommandListGetNextCommandIdWithKernelsExpPrologue, checker, &T::zeCommandListGetNextCommandIdWithKernelsExpPrologue, &ZEValidationEntryPoints::zeCommandListGetNextCommandIdWithKernelsExpPrologue);
+        addIfOverridden(zeCommandListGetNextCommandIdWithKernelsExpEpilogue, checker, &T::zeCommandListGetNextCommandIdWithKernelsExpEpilogue, &ZEValidationEntryPoints::zeCommandListGetNextCommandIdWithKernelsExpEpilogue);
+        addIfOverridden(zeCommandListUpdateMutableCommandsExpPrologue, checker, &T::zeCommandListUpdateMutableCommandsExpPrologue, &ZEValidationEntryPoints::zeCommandListUpdateMutableCommandsExpPrologue);
+        addIfOverridden(zeCommandListUpdateMutableCommandsExpEpilogue, checker, &T::zeCommandListUpdateMutableCommandsExpEpilogue, &ZEValidationEntryPoints::zeCommandListUpdateMutableCommandsExpEpilogue);
+        addIfOverridden(zeCommandListIsMutableExpPrologue, checker, &T::zeCommandListIsMutableExpPrologue, &ZEValidationEntryPoints::zeCommandListIsMutableExpPrologue);
+        addIfOverridden(zeCommandListIsMutableExpEpilogue, checker, &T::zeCommandListIsMutableExpEpilogue, &ZEValidationEntryPoints::zeCommandListIsMutableExpEpilogue);
+        addIfOverridden(zeCommandListUpdateMutableCommandSignalEventExpPrologue, checker, &T::zeCommandListUpdateMutableCommandSignalEventExpPrologue, &ZEValidationEntryPoints::zeCommandListUpdateMutableCommandSignalEventExpPrologue);
+        addIfOverridden(zeCommandListUpdateMutableCommandSignalEventExpEpilogue, checker, &T::zeCommandListUpdateMutableCommandSignalEventExpEpilogue, &ZEValidationEntryPoints::zeCommandListUpdateMutableCommandSignalEventExpEpilogue);
+        addIfOverridden(zeCommandListUpdateMutableCommandWaitEventsExpPrologue, checker, &T::zeCommandListUpdateMutableCommandWaitEventsExpPrologue, &ZEValidationEntryPoints::zeCommandListUpdateMutableCommandWaitEventsExpPrologue);
+        addIfOverridden(zeCommandListUpdateMutableCommandWaitEventsExpEpilogue, checker, &T::zeCommandListUpdateMutableCommandWaitEventsExpEpilogue, &ZEValidationEntryPoints::zeCommandListUpdateMutableCommandWaitEventsExpEpilogue);
+        addIfOverridden(zeCommandListUpdateMutableCommandKernelsExpPrologue, checker, &T::zeCommandListUpdateMutableCommandKernelsExpPrologue, &ZEValidationEntryPoints::zeCommandListUpdateMutableCommandKernelsExpPrologue);
+        addIfOverridden(zeCommandListUpdateMutableCommandKernelsExpEpilogue, checker, &T::zeCommandListUpdateMutableCommandKernelsExpEpilogue, &ZEValidationEntryPoints::zeCommandListUpdateMutableCommandKernelsExpEpilogue);
+        addIfOverridden(zeKernelGetBinaryExpPrologue, checker, &T::zeKernelGetBinaryExpPrologue, &ZEValidationEntryPoints::zeKernelGetBinaryExpPrologue);
+        addIfOverridden(zeKernelGetBinaryExpEpilogue, checker, &T::zeKernelGetBinaryExpEpilogue, &ZEValidationEntryPoints::zeKernelGetBinaryExpEpilogue);
+        addIfOverridden(zeDeviceImportExternalSemaphoreExtPrologue, checker, &T::zeDeviceImportExternalSemaphoreExtPrologue, &ZEValidationEntryPoints::zeDeviceImportExternalSemaphoreExtPrologue);
+        addIfOverridden(zeDeviceImportExternalSemaphoreExtEpilogue, checker, &T::zeDeviceImportExternalSemaphoreExtEpilogue, &ZEValidationEntryPoints::zeDeviceImportExternalSemaphoreExtEpilogue);
+        addIfOverridden(zeDeviceReleaseExternalSemaphoreExtPrologue, checker, &T::zeDeviceReleaseExternalSemaphoreExtPrologue, &ZEValidationEntryPoints::zeDeviceReleaseExternalSemaphoreExtPrologue);
+        addIfOverridden(zeDeviceReleaseExternalSemaphoreExtEpilogue, checker, &T::zeDeviceReleaseExternalSemaphoreExtEpilogue, &ZEValidationEntryPoints::zeDeviceReleaseExternalSemaphoreExtEpilogue);
+        addIfOverridden(zeCommandListAppendSignalExternalSemaphoreExtPrologue, checker, &T::zeCommandListAppendSignalExternalSemaphoreExtPrologue, &ZEValidationEntryPoints::zeCommandListAppendSignalExternalSemaphoreExtPrologue);
+        addIfOverridden(zeCommandListAppendSignalExternalSemaphoreExtEpilogue, checker, &T::zeCommandListAppendSignalExternalSemaphoreExtEpilogue, &ZEValidationEntryPoints::zeCommandListAppendSignalExternalSemaphoreExtEpilogue);
+        addIfOverridden(zeCommandListAppendWaitExternalSemaphoreExtPrologue, checker, &T::zeCommandListAppendWaitExternalSemaphoreExtPrologue, &ZEValidationEntryPoints::zeCommandListAppendWaitExternalSemaphoreExtPrologue);
+        addIfOverridden(zeCommandListAppendWaitExternalSemaphoreExtEpilogue, checker, &T::zeCommandListAppendWaitExternalSemaphoreExtEpilogue, &ZEValidationEntryPoints::zeCommandListAppendWaitExternalSemaphoreExtEpilogue);
+        addIfOverridden(zeRTASBuilderCreateExtPrologue, checker, &T::zeRTASBuilderCreateExtPrologue, &ZEValidationEntryPoints::zeRTASBuilderCreateExtPrologue);
+        addIfOverridden(zeRTASBuilderCreateExtEpilogue, checker, &T::zeRTASBuilderCreateExtEpilogue, &ZEValidationEntryPoints::zeRTASBuilderCreateExtEpilogue);
+        addIfOverridden(zeRTASBuilderGetBuildPropertiesExtPrologue, checker, &T::zeRTASBuilderGetBuildPropertiesExtPrologue, &ZEValidationEntryPoints::zeRTASBuilderGetBuildPropertiesExtPrologue);
+        addIfOverridden(zeRTASBuilderGetBuildPropertiesExtEpilogue, checker, &T::zeRTASBuilderGetBuildPropertiesExtEpilogue, &ZEValidationEntryPoints::zeRTASBuilderGetBuildPropertiesExtEpilogue);
+        addIfOverridden(zeDriverRTASFormatCompatibilityCheckExtPrologue, checker, &T::zeDriverRTASFormatCompatibilityCheckExtPrologue, &ZEValidationEntryPoints::zeDriverRTASFormatCompatibilityCheckExtPrologue);
+        addIfOverridden(zeDriverRTASFormatCompatibilityCheckExtEpilogue, checker, &T::zeDriverRTASFormatCompatibilityCheckExtEpilogue, &ZEValidationEntryPoints::zeDriverRTASFormatCompatibilityCheckExtEpilogue);
+        addIfOverridden(zeRTASBuilderBuildExtPrologue, checker, &T::zeRTASBuilderBuildExtPrologue, &ZEValidationEntryPoints::zeRTASBuilderBuildExtPrologue);
+        addIfOverridden(zeRTASBuilderBuildExtEpilogue, checker, &T::zeRTASBuilderBuildExtEpilogue, &ZEValidationEntryPoints::zeRTASBuilderBuildExtEpilogue);
+        addIfOverridden(zeRTASBuilderCommandListAppendCopyExtPrologue, checker, &T::zeRTASBuilderCommandListAppendCopyExtPrologue, &ZEValidationEntryPoints::zeRTASBuilderCommandListAppendCopyExtPrologue);
+        addIfOverridden(zeRTASBuilderCommandListAppendCopyExtEpilogue, checker, &T::zeRTASBuilderCommandListAppendCopyExtEpilogue, &ZEValidationEntryPoints::zeRTASBuilderCommandListAppendCopyExtEpilogue);
+        addIfOverridden(zeRTASBuilderDestroyExtPrologue, checker, &T::zeRTASBuilderDestroyExtPrologue, &ZEValidationEntryPoints::zeRTASBuilderDestroyExtPrologue);
+        addIfOverridden(zeRTASBuilderDestroyExtEpilogue, checker, &T::zeRTASBuilderDestroyExtEpilogue, &ZEValidationEntryPoints::zeRTASBuilderDestroyExtEpilogue);
+        addIfOverridden(zeRTASParallelOperationCreateExtPrologue, checker, &T::zeRTASParallelOperationCreateExtPrologue, &ZEValidationEntryPoints::zeRTASParallelOperationCreateExtPrologue);
+        addIfOverridden(zeRTASParallelOperationCreateExtEpilogue, checker, &T::zeRTASParallelOperationCreateExtEpilogue, &ZEValidationEntryPoints::zeRTASParallelOperationCreateExtEpilogue);
+        addIfOverridden(zeRTASParallelOperationGetPropertiesExtPrologue, checker, &T::zeRTASParallelOperationGetPropertiesExtPrologue, &ZEValidationEntryPoints::zeRTASParallelOperationGetPropertiesExtPrologue);
+        addIfOverridden(zeRTASParallelOperationGetPropertiesExtEpilogue, checker, &T::zeRTASParallelOperationGetPropertiesExtEpilogue, &ZEValidationEntryPoints::zeRTASParallelOperationGetPropertiesExtEpilogue);
+        addIfOverridden(zeRTASParallelOperationJoinExtPrologue, checker, &T::zeRTASParallelOperationJoinExtPrologue, &ZEValidationEntryPoints::zeRTASParallelOperationJoinExtPrologue);
+        addIfOverridden(zeRTASParallelOperationJoinExtEpilogue, checker, &T::zeRTASParallelOperationJoinExtEpilogue, &ZEValidationEntryPoints::zeRTASParallelOperationJoinExtEpilogue);
+        addIfOverridden(zeRTASParallelOperationDestroyExtPrologue, checker, &T::zeRTASParallelOperationDestroyExtPrologue, &ZEValidationEntryPoints::zeRTASParallelOperationDestroyExtPrologue);
+        addIfOverridden(zeRTASParallelOperationDestroyExtEpilogue, checker, &T::zeRTASParallelOperationDestroyExtEpilogue, &ZEValidationEntryPoints::zeRTASParallelOperationDestroyExtEpilogue);
+        addIfOverridden(zeDeviceGetVectorWidthPropertiesExtPrologue, checker, &T::zeDeviceGetVectorWidthPropertiesExtPrologue, &ZEValidationEntryPoints::zeDeviceGetVectorWidthPropertiesExtPrologue);
+        addIfOverridden(zeDeviceGetVectorWidthPropertiesExtEpilogue, checker, &T::zeDeviceGetVectorWidthPropertiesExtEpilogue, &ZEValidationEntryPoints::zeDeviceGetVectorWidthPropertiesExtEpilogue);
+        addIfOverridden(zeKernelGetAllocationPropertiesExpPrologue, checker, &T::zeKernelGetAllocationPropertiesExpPrologue, &ZEValidationEntryPoints::zeKernelGetAllocationPropertiesExpPrologue);
+        addIfOverridden(zeKernelGetAllocationPropertiesExpEpilogue, checker, &T::zeKernelGetAllocationPropertiesExpEpilogue, &ZEValidationEntryPoints::zeKernelGetAllocationPropertiesExpEpilogue);
+        addIfOverridden(zeMemGetIpcHandleWithPropertiesPrologue, checker, &T::zeMemGetIpcHandleWithPropertiesPrologue, &ZEValidationEntryPoints::zeMemGetIpcHandleWithPropertiesPrologue);
+        addIfOverridden(zeMemGetIpcHandleWithPropertiesEpilogue, checker, &T::zeMemGetIpcHandleWithPropertiesEpilogue, &ZEValidationEntryPoints::zeMemGetIpcHandleWithPropertiesEpilogue);
+        addIfOverridden(zeGraphCreateExtPrologue, checker, &T::zeGraphCreateExtPrologue, &ZEValidationEntryPoints::zeGraphCreateExtPrologue);
+        addIfOverridden(zeGraphCreateExtEpilogue, checker, &T::zeGraphCreateExtEpilogue, &ZEValidationEntryPoints::zeGraphCreateExtEpilogue);
+        addIfOverridden(zeCommandListBeginGraphCaptureExtPrologue, checker, &T::zeCommandListBeginGraphCaptureExtPrologue, &ZEValidationEntryPoints::zeCommandListBeginGraphCaptureExtPrologue);
+        addIfOverridden(zeCommandListBeginGraphCaptureExtEpilogue, checker, &T::zeCommandListBeginGraphCaptureExtEpilogue, &ZEValidationEntryPoints::zeCommandListBeginGraphCaptureExtEpilogue);
+        addIfOverridden(zeCommandListBeginCaptureIntoGraphExtPrologue, checker, &T::zeCommandListBeginCaptureIntoGraphExtPrologue, &ZEValidationEntryPoints::zeCommandListBeginCaptureIntoGraphExtPrologue);
+        addIfOverridden(zeCommandListBeginCaptureIntoGraphExtEpilogue, checker, &T::zeCommandListBeginCaptureIntoGraphExtEpilogue, &ZEValidationEntryPoints::zeCommandListBeginCaptureIntoGraphExtEpilogue);
+        addIfOverridden(zeCommandListIsGraphCaptureEnabledExtPrologue, checker, &T::zeCommandListIsGraphCaptureEnabledExtPrologue, &ZEValidationEntryPoints::zeCommandListIsGraphCaptureEnabledExtPrologue);
+        addIfOverridden(zeCommandListIsGraphCaptureEnabledExtEpilogue, checker, &T::zeCommandListIsGraphCaptureEnabledExtEpilogue, &ZEValidationEntryPoints::zeCommandListIsGraphCaptureEnabledExtEpilogue);
+        addIfOverridden(zeCommandListEndGraphCaptureExtPrologue, checker, &T::zeCommandListEndGraphCaptureExtPrologue, &ZEValidationEntryPoints::zeCommandListEndGraphCaptureExtPrologue);
+        addIfOverridden(zeCommandListEndGraphCaptureExtEpilogue, checker, &T::zeCommandListEndGraphCaptureExtEpilogue, &ZEValidationEntryPoints::zeCommandListEndGraphCaptureExtEpilogue);
+        addIfOverridden(zeCommandListGetGraphExtPrologue, checker, &T::zeCommandListGetGraphExtPrologue, &ZEValidationEntryPoints::zeCommandListGetGraphExtPrologue);
+        addIfOverridden(zeCommandListGetGraphExtEpilogue, checker, &T::zeCommandListGetGraphExtEpilogue, &ZEValidationEntryPoints::zeCommandListGetGraphExtEpilogue);
+        addIfOverridden(zeGraphGetPrimaryCommandListExtPrologue, checker, &T::zeGraphGetPrimaryCommandListExtPrologue, &ZEValidationEntryPoints::zeGraphGetPrimaryCommandListExtPrologue);
+        addIfOverridden(zeGraphGetPrimaryCommandListExtEpilogue, checker, &T::zeGraphGetPrimaryCommandListExtEpilogue, &ZEValidationEntryPoints::zeGraphGetPrimaryCommandListExtEpilogue);
+        addIfOverridden(zeGraphSetDestructionCallbackExtPrologue, checker, &T::zeGraphSetDestructionCallbackExtPrologue, &ZEValidationEntryPoints::zeGraphSetDestructionCallbackExtPrologue);
+        addIfOverridden(zeGraphSetDestructionCallbackExtEpilogue, checker, &T::zeGraphSetDestructionCallbackExtEpilogue, &ZEValidationEntryPoints::zeGraphSetDestructionCallbackExtEpilogue);
+        addIfOverridden(zeGraphInstantiateExtPrologue, checker, &T::zeGraphInstantiateExtPrologue, &ZEValidationEntryPoints::zeGraphInstantiateExtPrologue);
+        addIfOverridden(zeGraphInstantiateExtEpilogue, checker, &T::zeGraphInstantiateExtEpilogue, &ZEValidationEntryPoints::zeGraphInstantiateExtEpilogue);
+        addIfOverridden(zeCommandListAppendGraphExtPrologue, checker, &T::zeCommandListAppendGraphExtPrologue, &ZEValidationEntryPoints::zeCommandListAppendGraphExtPrologue);
+        addIfOverridden(zeCommandListAppendGraphExtEpilogue, checker, &T::zeCommandListAppendGraphExtEpilogue, &ZEValidationEntryPoints::zeCommandListAppendGraphExtEpilogue);
+        addIfOverridden(zeExecutableGraphGetSourceGraphExtPrologue, checker, &T::zeExecutableGraphGetSourceGraphExtPrologue, &ZEValidationEntryPoints::zeExecutableGraphGetSourceGraphExtPrologue);
+        addIfOverridden(zeExecutableGraphGetSourceGraphExtEpilogue, checker, &T::zeExecutableGraphGetSourceGraphExtEpilogue, &ZEValidationEntryPoints::zeExecutableGraphGetSourceGraphExtEpilogue);
+        addIfOverridden(zeGraphIsEmptyExtPrologue, checker, &T::zeGraphIsEmptyExtPrologue, &ZEValidationEntryPoints::zeGraphIsEmptyExtPrologue);
+        addIfOverridden(zeGraphIsEmptyExtEpilogue, checker, &T::zeGraphIsEmptyExtEpilogue, &ZEValidationEntryPoints::zeGraphIsEmptyExtEpilogue);
+        addIfOverridden(zeGraphDumpContentsExtPrologue, checker, &T::zeGraphDumpContentsExtPrologue, &ZEValidationEntryPoints::zeGraphDumpContentsExtPrologue);
+        addIfOverridden(zeGraphDumpContentsExtEpilogue, checker, &T::zeGraphDumpContentsExtEpilogue, &ZEValidationEntryPoints::zeGraphDumpContentsExtEpilogue);
+        addIfOverridden(zeExecutableGraphDestroyExtPrologue, checker, &T::zeExecutableGraphDestroyExtPrologue, &ZEValidationEntryPoints::zeExecutableGraphDestroyExtPrologue);
+        addIfOverridden(zeExecutableGraphDestroyExtEpilogue, checker, &T::zeExecutableGraphDestroyExtEpilogue, &ZEValidationEntryPoints::zeExecutableGraphDestroyExtEpilogue);
+        addIfOverridden(zeGraphDestroyExtPrologue, checker, &T::zeGraphDestroyExtPrologue, &ZEValidationEntryPoints::zeGraphDestroyExtPrologue);
+        addIfOverridden(zeGraphDestroyExtEpilogue, checker, &T::zeGraphDestroyExtEpilogue, &ZEValidationEntryPoints::zeGraphDestroyExtEpilogue);
+        addIfOverridden(zeCommandListAppendHostFunctionPrologue, checker, &T::zeCommandListAppendHostFunctionPrologue, &ZEValidationEntryPoints::zeCommandListAppendHostFunctionPrologue);
+        addIfOverridden(zeCommandListAppendHostFunctionEpilogue, checker, &T::zeCommandListAppendHostFunctionEpilogue, &ZEValidationEntryPoints::zeCommandListAppendHostFunctionEpilogue);
+        addIfOverridden(zexCounterBasedEventCreate2Prologue, checker, &T::zexCounterBasedEventCreate2Prologue, &ZEValidationEntryPoints::zexCounterBasedEventCreate2Prologue);
+        addIfOverridden(zexCounterBasedEventCreate2Epilogue, checker, &T::zexCounterBasedEventCreate2Epilogue, &ZEValidationEntryPoints::zexCounterBasedEventCreate2Epilogue);
+    }
+
+private:
+    template <class Derived, class Base>
+    static void addIfOverridden(std::vector<ZEValidationEntryPoints *> &checkers, ZEValidationEntryPoints *checker, Derived, Base) {
+        if (!std::is_same<Derived, Base>::value)
+            checkers.push_back(checker);
+    }
+};
 }
\ No newline at end of file
@@ -11,6 +11,8 @@
  */
 #pragma once
 #include "zer_api.h"
+#include <type_traits>
+#include <vector>
 
 namespace validation_layer
 {
@@ -27,4 +29,42 @@ public:
     virtual ze_result_t zerGetDefaultContextEpilogue( ze_context_handle_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ~ZERValidationEntryPoints() {}
 };
+
+// Checkers to call for each entry point.  A checker is only listed for the
+// entry points its class overrides, so intercepts never make a virtual call
+// into an inherited no-op default.
+class ZERValidationDispatch {
+public:
+    std::vector<ZERValidationEntryPoints *> zerGetLastErrorDescriptionPrologue;
+    std::vector<ZERValidationEntryPoints *> zerGetLastErrorDescriptionEpilogue;
+    std::vector<ZERValidationEntryPoints *> zerTranslateDeviceHandleToIdentifierPrologue;
+    std::vector<ZERValidationEntryPoints *> zerTranslateDeviceHandleToIdentifierEpilogue;
+    std::vector<ZERValidationEntryPoints *> zerTranslateIdentifierToDeviceHandlePrologue;
+    std::vector<ZERValidationEntryPoints *> zerTranslateIdentifierToDeviceHandleEpilogue;
+    std::vector<ZERValidationEntryPoints *> zerGetDefaultContextPrologue;
+    std::vector<ZERValidationEntryPoints *> zerGetDefaultContextEpilogue;
+
+    // T is the checker's concrete class.  &T::f has the type of the
+    // ZERValidationEntryPoints member unless T redeclares f, so whether an
+    // entry point is overridden is decided at compile time.
+    template <class T> void addChecker(T *checker) {
+        if (nullptr == checker)
+            return;
+        addIfOverridden(zerGetLastErrorDescriptionPrologue, checker, &T::zerGetLastErrorDescriptionPrologue, &ZERValidationEntryPoints::zerGetLastErrorDescriptionPrologue);
+        addIfOverridden(zerGetLastErrorDescriptionEpilogue, checker, &T::zerGetLastErrorDescriptionEpilogue, &ZERValidationEntryPoints::zerGetLastErrorDescriptionEpilogue);
+        addIfOverridden(zerTranslateDeviceHandleToIdentifierPrologue, checker, &T::zerTranslateDeviceHandleToIdentifierPrologue, &ZERValidationEntryPoints::zerTranslateDeviceHandleToIdentifierPrologue);
+        addIfOverridden(zerTranslateDeviceHandleToIdentifierEpilogue, checker, &T::zerTranslateDeviceHandleToIdentifierEpilogue, &ZERValidationEntryPoints::zerTranslateDeviceHandleToIdentifierEpilogue);
+        addIfOverridden(zerTranslateIdentifierToDeviceHandlePrologue, checker, &T::zerTranslateIdentifierToDeviceHandlePrologue, &ZERValidationEntryPoints::zerTranslateIdentifierToDeviceHandlePrologue);
+        addIfOverridden(zerTranslateIdentifierToDeviceHandleEpilogue, checker, &T::zerTranslateIdentifierToDeviceHandleEpilogue, &ZERValidationEntryPoints::zerTranslateIdentifierToDeviceHandleEpilogue);
+        addIfOverridden(zerGetDefaultContextPrologue, checker, &T::zerGetDefaultContextPrologue, &ZERValidationEntryPoints::zerGetDefaultContextPrologue);
+        addIfOverridden(zerGetDefaultContextEpilogue, checker, &T::zerGetDefaultContextEpilogue, &ZERValidationEntryPoints::zerGetDefaultContextEpilogue);
+    }
+
+private:
+    template <class Derived, class Base>
+    static void addIfOverridden(std::vector<ZERValidationEntryPoints *> &checkers, ZERValidationEntryPoints *checker, Derived, Base) {
+        if (!std::is_same<Derived, Base>::value)
+            checkers.push_back(checker);
+    }
+};
 }
\ No newline at end of file
@@ -11,6 +11,8 @@
  */
 #pragma once
 #include "zes_api.h"
+#include <type_traits>
+#include <vector>
 
 namespace validation_layer
 {
@@ -333,4 +335,654 @@ public:
     virtual ze_result_t zesDevicePciLinkSpeedUpdateExtEpilogue( zes_device_handle_t hDevice, ze_bool_t shouldDowngrade, zes_device_action_t* pendingAction , ze_result_t result) {return ZE_RESULT_SUCCESS;}
     virtual ~ZESValidationEntryPoints() {}
 };
+
+// Checkers to call for each entry point.  A checker is only listed for the
+// entry points its class overrides, so intercepts never make a virtual call
+// into an inherited no-op default.
+class ZESValidationDispatch {
+public:
+    std::vector<ZESValidationEntryPoints *> zesInitPrologue;
+    std::vector<ZESValidationEntryPoints *> zesInitEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDriverGetPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDriverGetEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDriverGetExtensionPropertiesPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDriverGetExtensionPropertiesEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDriverGetExtensionFunctionAddressPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDriverGetExtensionFunctionAddressEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceGetPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceGetEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceGetPropertiesPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceGetPropertiesEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceGetStatePrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceGetStateEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceResetPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceResetEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceResetExtPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceResetExtEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceProcessesGetStatePrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceProcessesGetStateEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDevicePciGetPropertiesPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDevicePciGetPropertiesEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDevicePciGetStatePrologue;
+    std::vector<ZESValidationEntryPoints *> zesDevicePciGetStateEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDevicePciGetBarsPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDevicePciGetBarsEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDevicePciGetStatsPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDevicePciGetStatsEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceSetOverclockWaiverPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceSetOverclockWaiverEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceGetOverclockDomainsPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceGetOverclockDomainsEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceGetOverclockControlsPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceGetOverclockControlsEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceResetOverclockSettingsPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceResetOverclockSettingsEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceReadOverclockStatePrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceReadOverclockStateEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumOverclockDomainsPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumOverclockDomainsEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesOverclockGetDomainPropertiesPrologue;
+    std::vector<ZESValidationEntryPoints *> zesOverclockGetDomainPropertiesEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesOverclockGetDomainVFPropertiesPrologue;
+    std::vector<ZESValidationEntryPoints *> zesOverclockGetDomainVFPropertiesEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesOverclockGetDomainControlPropertiesPrologue;
+    std::vector<ZESValidationEntryPoints *> zesOverclockGetDomainControlPropertiesEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesOverclockGetControlCurrentValuePrologue;
+    std::vector<ZESValidationEntryPoints *> zesOverclockGetControlCurrentValueEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesOverclockGetControlPendingValuePrologue;
+    std::vector<ZESValidationEntryPoints *> zesOverclockGetControlPendingValueEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesOverclockSetControlUserValuePrologue;
+    std::vector<ZESValidationEntryPoints *> zesOverclockSetControlUserValueEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesOverclockGetControlStatePrologue;
+    std::vector<ZESValidationEntryPoints *> zesOverclockGetControlStateEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesOverclockGetVFPointValuesPrologue;
+    std::vector<ZESValidationEntryPoints *> zesOverclockGetVFPointValuesEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesOverclockSetVFPointValuesPrologue;
+    std::vector<ZESValidationEntryPoints *> zesOverclockSetVFPointValuesEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumDiagnosticTestSuitesPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumDiagnosticTestSuitesEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDiagnosticsGetPropertiesPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDiagnosticsGetPropertiesEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDiagnosticsGetTestsPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDiagnosticsGetTestsEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDiagnosticsRunTestsPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDiagnosticsRunTestsEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEccAvailablePrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEccAvailableEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEccConfigurablePrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEccConfigurableEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceGetEccStatePrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceGetEccStateEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceSetEccStatePrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceSetEccStateEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumEngineGroupsPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumEngineGroupsEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesEngineGetPropertiesPrologue;
+    std::vector<ZESValidationEntryPoints *> zesEngineGetPropertiesEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesEngineGetActivityPrologue;
+    std::vector<ZESValidationEntryPoints *> zesEngineGetActivityEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEventRegisterPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEventRegisterEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDriverEventListenPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDriverEventListenEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDriverEventListenExPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDriverEventListenExEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumFabricPortsPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumFabricPortsEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFabricPortGetPropertiesPrologue;
+    std::vector<ZESValidationEntryPoints *> zesFabricPortGetPropertiesEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFabricPortGetLinkTypePrologue;
+    std::vector<ZESValidationEntryPoints *> zesFabricPortGetLinkTypeEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFabricPortGetConfigPrologue;
+    std::vector<ZESValidationEntryPoints *> zesFabricPortGetConfigEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFabricPortSetConfigPrologue;
+    std::vector<ZESValidationEntryPoints *> zesFabricPortSetConfigEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFabricPortGetStatePrologue;
+    std::vector<ZESValidationEntryPoints *> zesFabricPortGetStateEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFabricPortGetThroughputPrologue;
+    std::vector<ZESValidationEntryPoints *> zesFabricPortGetThroughputEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFabricPortGetFabricErrorCountersPrologue;
+    std::vector<ZESValidationEntryPoints *> zesFabricPortGetFabricErrorCountersEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFabricPortGetMultiPortThroughputPrologue;
+    std::vector<ZESValidationEntryPoints *> zesFabricPortGetMultiPortThroughputEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumFansPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumFansEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFanGetPropertiesPrologue;
+    std::vector<ZESValidationEntryPoints *> zesFanGetPropertiesEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFanGetConfigPrologue;
+    std::vector<ZESValidationEntryPoints *> zesFanGetConfigEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFanSetDefaultModePrologue;
+    std::vector<ZESValidationEntryPoints *> zesFanSetDefaultModeEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFanSetFixedSpeedModePrologue;
+    std::vector<ZESValidationEntryPoints *> zesFanSetFixedSpeedModeEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFanSetSpeedTableModePrologue;
+    std::vector<ZESValidationEntryPoints *> zesFanSetSpeedTableModeEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFanGetStatePrologue;
+    std::vector<ZESValidationEntryPoints *> zesFanGetStateEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumFirmwaresPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumFirmwaresEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFirmwareGetPropertiesPrologue;
+    std::vector<ZESValidationEntryPoints *> zesFirmwareGetPropertiesEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFirmwareFlashPrologue;
+    std::vector<ZESValidationEntryPoints *> zesFirmwareFlashEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFirmwareGetFlashProgressPrologue;
+    std::vector<ZESValidationEntryPoints *> zesFirmwareGetFlashProgressEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFirmwareGetConsoleLogsPrologue;
+    std::vector<ZESValidationEntryPoints *> zesFirmwareGetConsoleLogsEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumFrequencyDomainsPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumFrequencyDomainsEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyGetPropertiesPrologue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyGetPropertiesEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyGetAvailableClocksPrologue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyGetAvailableClocksEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyGetRangePrologue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyGetRangeEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencySetRangePrologue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencySetRangeEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyGetStatePrologue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyGetStateEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyGetThrottleTimePrologue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyGetThrottleTimeEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyOcGetCapabilitiesPrologue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyOcGetCapabilitiesEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyOcGetFrequencyTargetPrologue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyOcGetFrequencyTargetEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyOcSetFrequencyTargetPrologue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyOcSetFrequencyTargetEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyOcGetVoltageTargetPrologue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyOcGetVoltageTargetEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyOcSetVoltageTargetPrologue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyOcSetVoltageTargetEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyOcSetModePrologue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyOcSetModeEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyOcGetModePrologue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyOcGetModeEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyOcGetIccMaxPrologue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyOcGetIccMaxEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyOcSetIccMaxPrologue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyOcSetIccMaxEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyOcGetTjMaxPrologue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyOcGetTjMaxEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyOcSetTjMaxPrologue;
+    std::vector<ZESValidationEntryPoints *> zesFrequencyOcSetTjMaxEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumLedsPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumLedsEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesLedGetPropertiesPrologue;
+    std::vector<ZESValidationEntryPoints *> zesLedGetPropertiesEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesLedGetStatePrologue;
+    std::vector<ZESValidationEntryPoints *> zesLedGetStateEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesLedSetStatePrologue;
+    std::vector<ZESValidationEntryPoints *> zesLedSetStateEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesLedSetColorPrologue;
+    std::vector<ZESValidationEntryPoints *> zesLedSetColorEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumMemoryModulesPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumMemoryModulesEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesMemoryGetPropertiesPrologue;
+    std::vector<ZESValidationEntryPoints *> zesMemoryGetPropertiesEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesMemoryGetStatePrologue;
+    std::vector<ZESValidationEntryPoints *> zesMemoryGetStateEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesMemoryGetBandwidthPrologue;
+    std::vector<ZESValidationEntryPoints *> zesMemoryGetBandwidthEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumPerformanceFactorDomainsPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumPerformanceFactorDomainsEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesPerformanceFactorGetPropertiesPrologue;
+    std::vector<ZESValidationEntryPoints *> zesPerformanceFactorGetPropertiesEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesPerformanceFactorGetConfigPrologue;
+    std::vector<ZESValidationEntryPoints *> zesPerformanceFactorGetConfigEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesPerformanceFactorSetConfigPrologue;
+    std::vector<ZESValidationEntryPoints *> zesPerformanceFactorSetConfigEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumPowerDomainsPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumPowerDomainsEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceGetCardPowerDomainPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceGetCardPowerDomainEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesPowerGetPropertiesPrologue;
+    std::vector<ZESValidationEntryPoints *> zesPowerGetPropertiesEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesPowerGetEnergyCounterPrologue;
+    std::vector<ZESValidationEntryPoints *> zesPowerGetEnergyCounterEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesPowerGetLimitsPrologue;
+    std::vector<ZESValidationEntryPoints *> zesPowerGetLimitsEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesPowerSetLimitsPrologue;
+    std::vector<ZESValidationEntryPoints *> zesPowerSetLimitsEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesPowerGetEnergyThresholdPrologue;
+    std::vector<ZESValidationEntryPoints *> zesPowerGetEnergyThresholdEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesPowerSetEnergyThresholdPrologue;
+    std::vector<ZESValidationEntryPoints *> zesPowerSetEnergyThresholdEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesPowerGetUsagePrologue;
+    std::vector<ZESValidationEntryPoints *> zesPowerGetUsageEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumPsusPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumPsusEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesPsuGetPropertiesPrologue;
+    std::vector<ZESValidationEntryPoints *> zesPsuGetPropertiesEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesPsuGetStatePrologue;
+    std::vector<ZESValidationEntryPoints *> zesPsuGetStateEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumRasErrorSetsPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumRasErrorSetsEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesRasGetPropertiesPrologue;
+    std::vector<ZESValidationEntryPoints *> zesRasGetPropertiesEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesRasGetConfigPrologue;
+    std::vector<ZESValidationEntryPoints *> zesRasGetConfigEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesRasSetConfigPrologue;
+    std::vector<ZESValidationEntryPoints *> zesRasSetConfigEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesRasGetStatePrologue;
+    std::vector<ZESValidationEntryPoints *> zesRasGetStateEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumSchedulersPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumSchedulersEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesSchedulerGetPropertiesPrologue;
+    std::vector<ZESValidationEntryPoints *> zesSchedulerGetPropertiesEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesSchedulerGetCurrentModePrologue;
+    std::vector<ZESValidationEntryPoints *> zesSchedulerGetCurrentModeEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesSchedulerGetTimeoutModePropertiesPrologue;
+    std::vector<ZESValidationEntryPoints *> zesSchedulerGetTimeoutModePropertiesEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesSchedulerGetTimesliceModePropertiesPrologue;
+    std::vector<ZESValidationEntryPoints *> zesSchedulerGetTimesliceModePropertiesEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesSchedulerSetTimeoutModePrologue;
+    std::vector<ZESValidationEntryPoints *> zesSchedulerSetTimeoutModeEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesSchedulerSetTimesliceModePrologue;
+    std::vector<ZESValidationEntryPoints *> zesSchedulerSetTimesliceModeEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesSchedulerSetExclusiveModePrologue;
+    std::vector<ZESValidationEntryPoints *> zesSchedulerSetExclusiveModeEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesSchedulerSetComputeUnitDebugModePrologue;
+    std::vector<ZESValidationEntryPoints *> zesSchedulerSetComputeUnitDebugModeEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumStandbyDomainsPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumStandbyDomainsEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesStandbyGetPropertiesPrologue;
+    std::vector<ZESValidationEntryPoints *> zesStandbyGetPropertiesEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesStandbyGetModePrologue;
+    std::vector<ZESValidationEntryPoints *> zesStandbyGetModeEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesStandbySetModePrologue;
+    std::vector<ZESValidationEntryPoints *> zesStandbySetModeEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumTemperatureSensorsPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumTemperatureSensorsEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesTemperatureGetPropertiesPrologue;
+    std::vector<ZESValidationEntryPoints *> zesTemperatureGetPropertiesEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesTemperatureGetConfigPrologue;
+    std::vector<ZESValidationEntryPoints *> zesTemperatureGetConfigEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesTemperatureSetConfigPrologue;
+    std::vector<ZESValidationEntryPoints *> zesTemperatureSetConfigEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesTemperatureGetStatePrologue;
+    std::vector<ZESValidationEntryPoints *> zesTemperatureGetStateEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesPowerGetLimitsExtPrologue;
+    std::vector<ZESValidationEntryPoints *> zesPowerGetLimitsExtEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesPowerSetLimitsExtPrologue;
+    std::vector<ZESValidationEntryPoints *> zesPowerSetLimitsExtEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesPowerGetLimitsExt2Prologue;
+    std::vector<ZESValidationEntryPoints *> zesPowerGetLimitsExt2Epilogue;
+    std::vector<ZESValidationEntryPoints *> zesPowerSetLimitsExt2Prologue;
+    std::vector<ZESValidationEntryPoints *> zesPowerSetLimitsExt2Epilogue;
+    std::vector<ZESValidationEntryPoints *> zesEngineGetActivityExtPrologue;
+    std::vector<ZESValidationEntryPoints *> zesEngineGetActivityExtEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesRasGetStateExpPrologue;
+    std::vector<ZESValidationEntryPoints *> zesRasGetStateExpEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesRasClearStateExpPrologue;
+    std::vector<ZESValidationEntryPoints *> zesRasClearStateExpEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesRasGetSupportedCategoriesExpPrologue;
+    std::vector<ZESValidationEntryPoints *> zesRasGetSupportedCategoriesExpEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesRasGetStateExp2Prologue;
+    std::vector<ZESValidationEntryPoints *> zesRasGetStateExp2Epilogue;
+    std::vector<ZESValidationEntryPoints *> zesRasGetConfigExpPrologue;
+    std::vector<ZESValidationEntryPoints *> zesRasGetConfigExpEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesRasSetConfigExpPrologue;
+    std::vector<ZESValidationEntryPoints *> zesRasSetConfigExpEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFirmwareGetSecurityVersionExpPrologue;
+    std::vector<ZESValidationEntryPoints *> zesFirmwareGetSecurityVersionExpEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesFirmwareSetSecurityVersionExpPrologue;
+    std::vector<ZESValidationEntryPoints *> zesFirmwareSetSecurityVersionExpEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceGetSubDevicePropertiesExpPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceGetSubDevicePropertiesExpEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDriverGetDeviceByUuidExpPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDriverGetDeviceByUuidExpEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumActiveVFExpPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumActiveVFExpEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesVFManagementGetVFPropertiesExpPrologue;
+    std::vector<ZESValidationEntryPoints *> zesVFManagementGetVFPropertiesExpEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesVFManagementGetVFMemoryUtilizationExpPrologue;
+    std::vector<ZESValidationEntryPoints *> zesVFManagementGetVFMemoryUtilizationExpEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesVFManagementGetVFEngineUtilizationExpPrologue;
+    std::vector<ZESValidationEntryPoints *> zesVFManagementGetVFEngineUtilizationExpEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesVFManagementSetVFTelemetryModeExpPrologue;
+    std::vector<ZESValidationEntryPoints *> zesVFManagementSetVFTelemetryModeExpEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesVFManagementSetVFTelemetrySamplingIntervalExpPrologue;
+    std::vector<ZESValidationEntryPoints *> zesVFManagementSetVFTelemetrySamplingIntervalExpEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumEnabledVFExpPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDeviceEnumEnabledVFExpEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesVFManagementGetVFCapabilitiesExpPrologue;
+    std::vector<ZESValidationEntryPoints *> zesVFManagementGetVFCapabilitiesExpEpilogue;
+    std::vector<ZESValidationEntryPoints *> zesVFManagementGetVFMemoryUtilizationExp2Prologue;
+    std::vector<ZESValidationEntryPoints *> zesVFManagementGetVFMemoryUtilizationExp2Epilogue;
+    std::vector<ZESValidationEntryPoints *> zesVFManagementGetVFEngineUtilizationExp2Prologue;
+    std::vector<ZESValidationEntryPoints *> zesVFManagementGetVFEngineUtilizationExp2Epilogue;
+    std::vector<ZESValidationEntryPoints *> zesVFManagementGetVFCapabilitiesExp2Prologue;
+    std::vector<ZESValidationEntryPoints *> zesVFManagementGetVFCapabilitiesExp2Epilogue;
+    std::vector<ZESValidationEntryPoints *> zesDevicePciLinkSpeedUpdateExtPrologue;
+    std::vector<ZESValidationEntryPoints *> zesDevicePciLinkSpeedUpdateExtEpilogue;
+
+    // T is the checker's concrete class.  &T::f has the type of the
+    // ZESValidationEntryPoints member unless T redeclares f, so whether an
+    // entry point is overridden is decided at compile time.
+    template <class T> void addChecker(T *checker) {
+        if (nullptr == checker)
+            return;
+        addIfOverridden(zesInitPrologue, checker, &T::zesInitPrologue, &ZESValidationEntryPoints::zesInitPrologue);
+        addIfOverridden(zesInitEpilogue, checker, &T::zesInitEpilogue, &ZESValidationEntryPoints::zesInitEpilogue);
+        addIfOverridden(zesDriverGetPrologue, checker, &T::zesDriverGetPrologue, &ZESValidationEntryPoints::zesDriverGetPrologue);
+        addIfOverridden(zesDriverGetEpilogue, checker, &T::zesDriverGetEpilogue, &ZESValidationEntryPoints::zesDriverGetEpilogue);
+        addIfOverridden(zesDriverGetExtensionPropertiesPrologue, checker, &T::zesDriverGetExtensionPropertiesPrologue, &ZESValidationEntryPoints::zesDriverGetExtensionPropertiesPrologue);
+        addIfOverridden(zesDriverGetExtensionPropertiesEpilogue, checker, &T::zesDriverGetExtensionPropertiesEpilogue, &ZESValidationEntryPoints::zesDriverGetExtensionPropertiesEpilogue);
+        addIfOverridden(zesDriverGetExtensionFunctionAddressPrologue, checker, &T::zesDriverGetExtensionFunctionAddressPrologue, &ZESValidationEntryPoints::zesDriverGetExtensionFunctionAddressPrologue);
+        addIfOverridden(zesDriverGetExtensionFunctionAddressEpilogue, checker, &T::zesDriverGetExtensionFunctionAddressEpilogue, &ZESValidationEntryPoints::zesDriverGetExtensionFunctionAddressEpilogue);
+        addIfOverridden(zesDeviceGetPrologue, checker, &T::zesDeviceGetPrologue, &ZESValidationEntryPoints::zesDeviceGetPrologue);
+        addIfOverridden(zesDeviceGetEpilogue, checker, &T::zesDeviceGetEpilogue, &ZESValidationEntryPoints::zesDeviceGetEpilogue);
+        addIfOverridden(zesDeviceGetPropertiesPrologue, checker, &T::zesDeviceGetPropertiesPrologue, &ZESValidationEntryPoints::zesDeviceGetPropertiesPrologue);
+        addIfOverridden(zesDeviceGetPropertiesEpilogue, checker, &T::zesDeviceGetPropertiesEpilogue, &ZESValidationEntryPoints::zesDeviceGetPropertiesEpilogue);
+        addIfOverridden(zesDeviceGetStatePrologue, checker, &T::zesDeviceGetStatePrologue, &ZESValidationEntryPoints::zesDeviceGetStatePrologue);
+        addIfOverridden(zesDeviceGetStateEpilogue, checker, &T::zesDeviceGetStateEpilogue, &ZESValidationEntryPoints::zesDeviceGetStateEpilogue);
+        addIfOverridden(zesDeviceResetPrologue, checker, &T::zesDeviceResetPrologue, &ZESValidationEntryPoints::zesDeviceResetPrologue);
+        addIfOverridden(zesDeviceResetEpilogue, checker, &T::zesDeviceResetEpilogue, &ZESValidationEntryPoints::zesDeviceResetEpilogue);
+        addIfOverridden(zesDeviceResetExtPrologue, checker, &T::zesDeviceResetExtPrologue, &ZESValidationEntryPoints::zesDeviceResetExtPrologue);
+        addIfOverridden(zesDeviceResetExtEpilogue, checker, &T::zesDeviceResetExtEpilogue, &ZESValidationEntryPoints::zesDeviceResetExtEpilogue);
+        addIfOverridden(zesDeviceProcessesGetStatePrologue, checker, &T::zesDeviceProcessesGetStatePrologue, &ZESValidationEntryPoints::zesDeviceProcessesGetStatePrologue);
+        addIfOverridden(zesDeviceProcessesGetStateEpilogue, checker, &T::zesDeviceProcessesGetStateEpilogue, &ZESValidationEntryPoints::zesDeviceProcessesGetStateEpilogue);
+        addIfOverridden(zesDevicePciGetPropertiesPrologue, checker, &T::zesDevicePciGetPropertiesPrologue, &ZESValidationEntryPoints::zesDevicePciGetPropertiesPrologue);
+        addIfOverridden(zesDevicePciGetPropertiesEpilogue, checker, &T::zesDevicePciGetPropertiesEpilogue, &ZESValidationEntryPoints::zesDevicePciGetPropertiesEpilogue);
+        addIfOverridden(zesDevicePciGetStatePrologue, checker, &T::zesDevicePciGetStatePrologue, &ZESValidationEntryPoints::zesDevicePciGetStatePrologue);
+        addIfOverridden(zesDevicePciGetStateEpilogue, checker, &T::zesDevicePciGetStateEpilogue, &ZESValidationEntryPoints::zesDevicePciGetStateEpilogue);
+        addIfOverridden(zesDevicePciGetBarsPrologue, checker, &T::zesDevicePciGetBarsPrologue, &ZESValidationEntryPoints::zesDevicePciGetBarsPrologue);
+        addIfOverridden(zesDevicePciGetBarsEpilogue, checker, &T::zesDevicePciGetBarsEpilogue, &ZESValidationEntryPoints::zesDevicePciGetBarsEpilogue);
+        addIfOverridden(zesDevicePciGetStatsPrologue, checker, &T::zesDevicePciGetStatsPrologue, &ZESValidationEntryPoints::zesDevicePciGetStatsPrologue);
+        addIfOverridden(zesDevicePciGetStatsEpilogue, checker, &T::zesDevicePciGetStatsEpilogue, &ZESValidationEntryPoints::zesDevicePciGetStatsEpilogue);
+        addIfOverridden(zesDeviceSetOverclockWaiverPrologue, checker, &T::zesDeviceSetOverclockWaiverPrologue, &ZESValidationEntryPoints::zesDeviceSetOverclockWaiverPrologue);
+        addIfOverridden(zesDeviceSetOverclockWaiverEpilogue, checker, &T::zesDeviceSetOverclockWaiverEpilogue, &ZESValidationEntryPoints::zesDeviceSetOverclockWaiverEpilogue);
+        addIfOverridden(zesDeviceGetOverclockDomainsPrologue, checker, &T::zesDeviceGetOverclockDomainsPrologue, &ZESValidationEntryPoints::zesDeviceGetOverclockDomainsPrologue);
+        addIfOverridden(zesDeviceGetOverclockDomainsEpilogue, checker, &T::zesDeviceGetOverclockDomainsEpilogue, &ZESValidationEntryPoints::zesDeviceGetOverclockDomainsEpilogue);
+        addIfOverridden(zesDeviceGetOverclockControlsPrologue, checker, &T::zesDeviceGetOverclockControlsPrologue, &ZESValidationEntryPoints::zesDeviceGetOverclockControlsPrologue);
+        addIfOverridden(zesDeviceGetOverclockControlsEpilogue, checker, &T::zesDeviceGetOverclockControlsEpilogue, &ZESValidationEntryPoints::zesDeviceGetOverclockControlsEpilogue);
+        addIfOverridden(zesDeviceResetOverclockSettingsPrologue, checker, &T::zesDeviceResetOverclockSettingsPrologue, &ZESValidationEntryPoints::zesDeviceResetOverclockSettingsPrologue);
+        addIfOverridden(zesDeviceResetOverclockSettingsEpilogue, checker, &T::zesDeviceResetOverclockSettingsEpilogue, &ZESValidationEntryPoints::zesDeviceResetOverclockSettingsEpilogue);
+        addIfOverridden(zesDeviceReadOverclockStatePrologue, checker, &T::zesDeviceReadOverclockStatePrologue, &ZESValidationEntryPoints::zesDeviceReadOverclockStatePrologue);
+        addIfOverridden(zesDeviceReadOverclockStateEpilogue, checker, &T::zesDeviceReadOverclockStateEpilogue, &ZESValidationEntryPoints::zesDeviceReadOverclockStateEpilogue);
+        addIfOverridden(zesDeviceEnumOverclockDomainsPrologue, checker, &T::zesDeviceEnumOverclockDomainsPrologue, &ZESValidationEntryPoints::zesDeviceEnumOverclockDomainsPrologue);
+        addIfOverridden(zesDeviceEnumOverclockDomainsEpilogue, checker, &T::zesDeviceEnumOverclockDomainsEpilogue, &ZESValidationEntryPoints::zesDeviceEnumOverclockDomainsEpilogue);
+        addIfOverridden(zesOverclockGetDomainPropertiesPrologue, checker, &T::zesOverclockGetDomainPropertiesPrologue, &ZESValidationEntryPoints::zesOverclockGetDomainPropertiesPrologue);
+        addIfOverridden(zesOverclockGetDomainPropertiesEpilogue, checker, &T::zesOverclockGetDomainPropertiesEpilogue, &ZESValidationEntryPoints::zesOverclockGetDomainPropertiesEpilogue);
+        addIfOverridden(zesOverclockGetDomainVFPropertiesPrologue, checker, &T::zesOverclockGetDomainVFPropertiesPrologue, &ZESValidationEntryPoints::zesOverclockGetDomainVFPropertiesPrologue);
+        addIfOverridden(zesOverclockGetDomainVFPropertiesEpilogue, checker, &T::zesOverclockGetDomainVFPropertiesEpilogue, &ZESValidationEntryPoints::zesOverclockGetDomainVFPropertiesEpilogue);
+        addIfOverridden(zesOverclockGetDomainControlPropertiesPrologue, checker, &T::zesOverclockGetDomainControlPropertiesPrologue, &ZESValidationEntryPoints::zesOverclockGetDomainControlPropertiesPrologue);
+        addIfOverridden(zesOverclockGetDomainControlPropertiesEpilogue, checker, &T::zesOverclockGetDomainControlPropertiesEpilogue, &ZESValidationEntryPoints::zesOverclockGetDomainControlPropertiesEpilogue);
+        addIfOverridden(zesOverclockGetControlCurrentValuePrologue, checker, &T::zesOverclockGetControlCurrentValuePrologue, &ZESValidationEntryPoints::zesOverclockGetControlCurrentValuePrologue);
+        addIfOverridden(zesOverclockGetControlCurrentValueEpilogue, checker, &T::zesOverclockGetControlCurrentValueEpilogue, &ZESValidationEntryPoints::zesOverclockGetControlCurrentValueEpilogue);
+        addIfOverridden(zesOverclockGetControlPendingValuePrologue, checker, &T::zesOverclockGetControlPendingValuePrologue, &ZESValidationEntryPoints::zesOverclockGetControlPendingValuePrologue);
+        addIfOverridden(zesOverclockGetControlPendingValueEpilogue, checker, &T::zesOverclockGetControlPendingValueEpilogue, &ZESValidationEntryPoints::zesOverclockGetControlPendingValueEpilogue);
+        addIfOverridden(zesOverclockSetControlUserValuePrologue, checker, &T::zesOverclockSetControlUserValuePrologue, &ZESValidationEntryPoints::zesOverclockSetControlUserValuePrologue);
+        addIfOverridden(zesOverclockSetControlUserValueEpilogue, checker, &T::zesOverclockSetControlUserValueEpilogue, &ZESValidationEntryPoints::zesOverclockSetControlUserValueEpilogue);
+        addIfOverridden(zesOverclockGetControlStatePrologue, checker, &T::zesOverclockGetControlStatePrologue, &ZESValidationEntryPoints::zesOverclockGetControlStatePrologue);
+        addIfOverridden(zesOverclockGetControlStateEpilogue, checker, &T::zesOverclockGetControlStateEpilogue, &ZESValidationEntryPoints::zesOverclockGetControlStateEpilogue);
+        addIfOverridden(zesOverclockGetVFPointValuesPrologue, checker, &T::zesOverclockGetVFPointValuesPrologue, &ZESValidationEntryPoints::zesOverclockGetVFPointValuesPrologue);
+        addIfOverridden(zesOverclockGetVFPointValuesEpilogue, checker, &T::zesOverclockGetVFPointValuesEpilogue, &ZESValidationEntryPoints::zesOverclockGetVFPointValuesEpilogue);
+        addIfOverridden(zesOverclockSetVFPointValuesPrologue, checker, &T::zesOverclockSetVFPointValuesPrologue, &ZESValidationEntryPoints::zesOverclockSetVFPointValuesPrologue);
+        addIfOverridden(zesOverclockSetVFPointValuesEpilogue, checker, &T::zesOverclockSetVFPointValuesEpilogue, &ZESValidationEntryPoints::zesOverclockSetVFPointValuesEpilogue);
+        addIfOverridden(zesDeviceEnumDiagnosticTestSuitesPrologue, checker, &T::zesDeviceEnumDiagnosticTestSuitesPrologue, &ZESValidationEntryPoints::zesDeviceEnumDiagnosticTestSuitesPrologue);
+        addIfOverridden(zesDeviceEnumDiagnosticTestSuitesEpilogue, checker, &T::zesDeviceEnumDiagnosticTestSuitesEpilogue, &ZESValidationEntryPoints::zesDeviceEnumDiagnosticTestSuitesEpilogue);
+        addIfOverridden(zesDiagnosticsGetPropertiesPrologue, checker, &T::zesDiagnosticsGetPropertiesPrologue, &ZESValidationEntryPoints::zesDiagnosticsGetPropertiesPrologue);
+        addIfOverridden(zesDiagnosticsGetPropertiesEpilogue, checker, &T::zesDiagnosticsGetPropertiesEpilogue, &ZESValidationEntryPoints::zesDiagnosticsGetPropertiesEpilogue);
+        addIfOverridden(zesDiagnosticsGetTestsPrologue, checker, &T::zesDiagnosticsGetTestsPrologue, &ZESValidationEntryPoints::zesDiagnosticsGetTestsPrologue);
+        addIfOverridden(zesDiagnosticsGetTestsEpilogue, checker, &T::zesDiagnosticsGetTestsEpilogue, &ZESValidationEntryPoints::zesDiagnosticsGetTestsEpilogue);
+        addIfOverridden(zesDiagnosticsRunTestsPrologue, checker, &T::zesDiagnosticsRunTestsPrologue, &ZESValidationEntryPoints::zesDiagnosticsRunTestsPrologue);
+        addIfOverridden(zesDiagnosticsRunTestsEpilogue, checker, &T::zesDiagnosticsRunTestsEpilogue, &ZESValidationEntryPoints::zesDiagnosticsRunTestsEpilogue);
+        addIfOverridden(zesDeviceEccAvailablePrologue, checker, &T::zesDeviceEccAvailablePrologue, &ZESValidationEntryPoints::zesDeviceEccAvailablePrologue);
+        addIfOverridden(zesDeviceEccAvailableEpilogue, checker, &T::zesDeviceEccAvailableEpilogue, &ZESValidationEntryPoints::zesDeviceEccAvailableEpilogue);
+        addIfOverridden(zesDeviceEccConfigurablePrologue, checker, &T::zesDeviceEccConfigurablePrologue, &ZESValidationEntryPoints::zesDeviceEccConfigurablePrologue);
+        addIfOverridden(zesDeviceEccConfigurableEpilogue, checker, &T::zesDeviceEccConfigurableEpilogue, &ZESValidationEntryPoints::zesDeviceEccConfigurableEpilogue);
+        addIfOverridden(zesDeviceGetEccStatePrologue, checker, &T::zesDeviceGetEccStatePrologue, &ZESValidationEntryPoints::zesDeviceGetEccStatePrologue);
+        addIfOverridden(zesDeviceGetEccStateEpilogue, checker, &T::zesDeviceGetEccStateEpilogue, &ZESValidationEntryPoints::zesDeviceGetEccStateEpilogue);
+        addIfOverridden(zesDeviceSetEccStatePrologue, checker, &T::zesDeviceSetEccStatePrologue, &ZESValidationEntryPoints::zesDeviceSetEccStatePrologue);
+        addIfOverridden(zesDeviceSetEccStateEpilogue, checker, &T::zesDeviceSetEccStateEpilogue, &ZESValidationEntryPoints::zesDeviceSetEccStateEpilogue);
+        addIfOverridden(zesDeviceEnumEngineGroupsPrologue, checker, &T::zesDeviceEnumEngineGroupsPrologue, &ZESValidationEntryPoints::zesDeviceEnumEngineGroupsPrologue);
+        addIfOverridden(zesDeviceEnumEngineGroupsEpilogue, checker, &T::zesDeviceEnumEngineGroupsEpilogue, &ZESValidationEntryPoints::zesDeviceEnumEngineGroupsEpilogue);
+        addIfOverridden(zesEngineGetPropertiesPrologue, checker, &T::zesEngineGetPropertiesPrologue, &ZESValidationEntryPoints::zesEngineGetPropertiesPrologue);
+        addIfOverridden(zesEngineGetPropertiesEpilogue, checker, &T::zesEngineGetPropertiesEpilogue, &ZESValidationEntryPoints::zesEngineGetPropertiesEpilogue);
+        addIfOverridden(zesEngineGetActivityPrologue, checker, &T::zesEngineGetActivityPrologue, &ZESValidationEntryPoints::zesEngineGetActivityPrologue);
+        addIfOverridden(zesEngineGetActivityEpilogue, checker, &T::zesEngineGetActivityEpilogue, &ZESValidationEntryPoints::zesEngineGetActivityEpilogue);
+        addIfOverridden(zesDeviceEventRegisterPrologue, checker, &T::zesDeviceEventRegisterPrologue, &ZESValidationEntryPoints::zesDeviceEventRegisterPrologue);
+        addIfOverridden(zesDeviceEventRegisterEpilogue, checker, &T::zesDeviceEventRegisterEpilogue, &ZESValidationEntryPoints::zesDeviceEventRegisterEpilogue);
+        addIfOverridden(zesDriverEventListenPrologue, checker, &T::zesDriverEventListenPrologue, &ZESValidationEntryPoints::zesDriverEventListenPrologue);
+        addIfOverridden(zesDriverEventListenEpilogue, checker, &T::zesDriverEventListenEpilogue, &ZESValidationEntryPoints::zesDriverEventListenEpilogue);
+        addIfOverridden(zesDriverEventListenExPrologue, checker, &T::zesDriverEventListenExPrologue, &ZESValidationEntryPoints::zesDriverEventListenExPrologue);
+        addIfOverridden(zesDriverEventListenExEpilogue, checker, &T::zesDriverEventListenExEpilogue, &ZESValidationEntryPoints::zesDriverEventListenExEpilogue);
+        addIfOverridden(zesDeviceEnumFabricPortsPrologue, checker, &T::zesDeviceEnumFabricPortsPrologue, &ZESValidationEntryPoints::zesDeviceEnumFabricPortsPrologue);
+        addIfOverridden(zesDeviceEnumFabricPortsEpilogue, checker, &T::zesDeviceEnumFabricPortsEpilogue, &ZESValidationEntryPoints::zesDeviceEnumFabricPortsEpilogue);
+        addIfOverridden(zesFabricPortGetPropertiesPrologue, checker, &T::zesFabricPortGetPropertiesPrologue, &ZESValidationEntryPoints::zesFabricPortGetPropertiesPrologue);
+        addIfOverridden(zesFabricPortGetPropertiesEpilogue, checker, &T::zesFabricPortGetPropertiesEpilogue, &ZESValidationEntryPoints::zesFabricPortGetPropertiesEpilogue);
+        addIfOverridden(zesFabricPortGetLinkTypePrologue, checker, &T::zesFabricPortGetLinkTypePrologue, &ZESValidationEntryPoints::zesFabricPortGetLinkTypePrologue);
+        addIfOverridden(zesFabricPortGetLinkTypeEpilogue, checker, &T::zesFabricPortGetLinkTypeEpilogue, &ZESValidationEntryPoints::zesFabricPortGetLinkTypeEpilogue);
+        addIfOverridden(zesFabricPortGetConfigPrologue, checker, &T::zesFabricPortGetConfigPrologue, &ZESValidationEntryPoints::zesFabricPortGetConfigPrologue);
+        addIfOverridden(zesFabricPortGetConfigEpilogue, checker, &T::zesFabricPortGetConfigEpilogue, &ZESValidationEntryPoints::zesFabricPortGetConfigEpilogue);
+        addIfOverridden(zesFabricPortSetConfigPrologue, checker, &T::zesFabricPortSetConfigPrologue, &ZESValidationEntryPoints::zesFabricPortSetConfigPrologue);
+        addIfOverridden(zesFabricPortSetConfigEpilogue, checker, &T::zesFabricPortSetConfigEpilogue, &ZESValidationEntryPoints::zesFabricPortSetConfigEpilogue);
+        addIfOverridden(zesFabricPortGetStatePrologue, checker, &T::zesFabricPortGetStatePrologue, &ZESValidationEntryPoints::zesFabricPortGetStatePrologue);
+        addIfOverridden(zesFabricPortGetStateEpilogue, checker, &T::zesFabricPortGetStateEpilogue, &ZESValidationEntryPoints::zesFabricPortGetStateEpilogue);
+        addIfOverridden(zesFabricPortGetThroughputPrologue, checker, &T::zesFabricPortGetThroughputPrologue, &ZESValidationEntryPoints::zesFabricPortGetThroughputPrologue);
+        addIfOverridden(zesFabricPortGetThroughputEpilogue, checker, &T::zesFabricPortGetThroughputEpilogue, &ZESValidationEntryPoints::zesFabricPortGetThroughputEpilogue);
+        addIfOverridden(zesFabricPortGetFabricErrorCountersPrologue, checker, &T::zesFabricPortGetFabricErrorCountersPrologue, &ZESValidationEntryPoints::zesFabricPortGetFabricErrorCountersPrologue);
+        addIfOverridden(zesFabricPortGetFabricErrorCountersEpilogue, checker, &T::zesFabricPortGetFabricErrorCountersEpilogue, &ZESValidationEntryPoints::zesFabricPortGetFabricErrorCountersEpilogue);
+        addIfOverridden(zesFabricPortGetMultiPortThroughputPrologue, checker, &T::zesFabricPortGetMultiPortThroughputPrologue, &ZESValidationEntryPoints::zesFabricPortGetMultiPortThroughputPrologue);
+        addIfOverridden(zesFabricPortGetMultiPortThroughputEpilogue, checker, &T::zesFabricPortGetMultiPortThroughputEpilogue, &ZESValidationEntryPoints::zesFabricPortGetMultiPortThroughputEpilogue);
+        addIfOverridden(zesDeviceEnumFansPrologue, checker, &T::zesDeviceEnumFansPrologue, &ZESValidationEntryPoints::zesDeviceEnumFansPrologue);
+        addIfOverridden(zesDeviceEnumFansEpilogue, checker, &T::zesDeviceEnumFansEpilogue, &ZESValidationEntryPoints::zesDeviceEnumFansEpilogue);
+        addIfOverridden(zesFanGetPropertiesPrologue, checker, &T::zesFanGetPropertiesPrologue, &ZESValidationEntryPoints::zesFanGetPropertiesPrologue);
+        addIfOverridden(zesFanGetPropertiesEpilogue, checker, &T::zesFanGetPropertiesEpilogue, &ZESValidationEntryPoints::zesFanGetPropertiesEpilogue);
+        addIfOverridden(zesFanGetConfigPrologue, checker, &T::zesFanGetConfigPrologue, &ZESValidationEntryPoints::zesFanGetConfigPrologue);
+        addIfOverridden(zesFanGetConfigEpilogue, checker, &T::zesFanGetConfigEpilogue, &ZESValidationEntryPoints::zesFanGetConfigEpilogue);
+        addIfOverridden(zesFanSetDefaultModePrologue, checker, &T::zesFanSetDefaultModePrologue, &ZESValidationEntryPoints::zesFanSetDefaultModePrologue);
+        addIfOverridden(zesFanSetDefaultModeEpilogue, checker, &T::zesFanSetDefaultModeEpilogue, &ZESValidationEntryPoints::zesFanSetDefaultModeEpilogue);
+        addIfOverridden(zesFanSetFixedSpeedModePrologue, checker, &T::zesFanSetFixedSpeedModePrologue, &ZESValidationEntryPoints::zesFanSetFixedSpeedModePrologue);
+        addIfOverridden(zesFanSetFixedSpeedModeEpilogue, checker, &T::zesFanSetFixedSpeedModeEpilogue, &ZESValidationEntryPoints::zesFanSetFixedSpeedModeEpilogue);
+        addIfOverridden(zesFanSetSpeedTableModePrologue, checker, &T::zesFanSetSpeedTableModePrologue, &ZESValidationEntryPoints::zesFanSetSpeedTableModePrologue);
+        addIfOverridden(zesFanSetSpeedTableModeEpilogue, checker, &T::zesFanSetSpeedTableModeEpilogue, &ZESValidationEntryPoints::zesFanSetSpeedTableModeEpilogue);
+        addIfOverridden(zesFanGetStatePrologue, checker, &T::zesFanGetStatePrologue, &ZESValidationEntryPoints::zesFanGetStatePrologue);
+        addIfOverridden(zesFanGetStateEpilogue, checker, &T::zesFanGetStateEpilogue, &ZESValidationEntryPoints::zesFanGetStateEpilogue);
+        addIfOverridden(zesDeviceEnumFirmwaresPrologue, checker, &T::zesDeviceEnumFirmwaresPrologue, &ZESValidationEntryPoints::zesDeviceEnumFirmwaresPrologue);
+        addIfOverridden(zesDeviceEnumFirmwaresEpilogue, checker, &T::zesDeviceEnumFirmwaresEpilogue, &ZESValidationEntryPoints::zesDeviceEnumFirmwaresEpilogue);
+        addIfOverridden(zesFirmwareGetPropertiesPrologue, checker, &T::zesFirmwareGetPropertiesPrologue, &ZESValidationEntryPoints::zesFirmwareGetPropertiesPrologue);
+        addIfOverridden(zesFirmwareGetPropertiesEpilogue, checker, &T::zesFirmwareGetPropertiesEpilogue, &ZESValidationEntryPoints::zesFirmwareGetPropertiesEpilogue);
+        addIfOverridden(zesFirmwareFlashPrologue, checker, &T::zesFirmwareFlashPrologue, &ZESValidationEntryPoints::zesFirmwareFlashPrologue);
+        addIfOverridden(zesFirmwareFlashEpilogue, checker, &T::zesFirmwareFlashEpilogue, &ZESValidationEntryPoints::zesFirmwareFlashEpilogue);
+        addIfOverridden(zesFirmwareGetFlashProgressPrologue, checker, &T::zesFirmwareGetFlashProgressPrologue, &ZESValidationEntryPoints::zesFirmwareGetFlashProgressPrologue);
+        addIfOverridden(zesFirmwareGetFlashProgressEpilogue, checker, &T::zesFirmwareGetFlashProgressEpilogue, &ZESValidationEntryPoints::zesFirmwareGetFlashProgressEpilogue);
+        addIfOverridden(zesFirmwareGetConsoleLogsPrologue, checker, &T::zesFirmwareGetConsoleLogsPrologue, &ZESValidationEntryPoints::zesFirmwareGetConsoleLogsPrologue);
+        addIfOverridden(zesFirmwareGetConsoleLogsEpilogue, checker, &T::zesFirmwareGetConsoleLogsEpilogue, &ZESValidationEntryPoints::zesFirmwareGetConsoleLogsEpilogue);
+        addIfOverridden(zesDeviceEnumFrequencyDomainsPrologue, checker, &T::zesDeviceEnumFrequencyDomainsPrologue, &ZESValidationEntryPoints::zesDeviceEnumFrequencyDomainsPrologue);
+        addIfOverridden(zesDeviceEnumFrequencyDomainsEpilogue, checker, &T::zesDeviceEnumFrequencyDomainsEpilogue, &ZESValidationEntryPoints::zesDeviceEnumFrequencyDomainsEpilogue);
+        addIfOverridden(zesFrequencyGetPropertiesPrologue, checker, &T::zesFrequencyGetPropertiesPrologue, &ZESValidationEntryPoints::zesFrequencyGetPropertiesPrologue);
+        addIfOverridden(zesFrequencyGetPropertiesEpilogue, checker, &T::zesFrequencyGetPropertiesEpilogue, &ZESValidationEntryPoints::zesFrequencyGetPropertiesEpilogue);
+        addIfOverridden(zesFrequencyGetAvailableClocksPrologue, checker, &T::zesFrequencyGetAvailableClocksPrologue, &ZESValidationEntryPoints::zesFrequencyGetAvailableClocksPrologue);
+        addIfOverridden(zesFrequencyGetAvailableClocksEpilogue, checker, &T::zesFrequencyGetAvailableClocksEpilogue, &ZESValidationEntryPoints::zesFrequencyGetAvailableClocksEpilogue);
+        addIfOverridden(zesFrequencyGetRangePrologue, checker, &T::zesFrequencyGetRangePrologue, &ZESValidationEntryPoints::zesFrequencyGetRangePrologue);
+        addIfOverridden(zesFrequencyGetRangeEpilogue, checker, &T::zesFrequencyGetRangeEpilogue, &ZESValidationEntryPoints::zesFrequencyGetRangeEpilogue);
+        addIfOverridden(zesFrequencySetRangePrologue, checker, &T::zesFrequencySetRangePrologue, &ZESValidationEntryPoints::zesFrequencySetRangePrologue);
+        addIfOverridden(zesFrequencySetRangeEpilogue, checker, &T::zesFrequencySetRangeEpilogue, &ZESValidationEntryPoints::zesFrequencySetRangeEpilogue);
+        addIfOverridden(zesFrequencyGetStatePrologue, checker, &T::zesFrequencyGetStatePrologue, &ZESValidationEntryPoints::zesFrequencyGetStatePrologue);
+        addIfOverridden(zesFrequencyGetStateEpilogue, checker, &T::zesFrequencyGetStateEpilogue, &ZESValidationEntryPoints::zesFrequencyGetStateEpilogue);
+        addIfOverridden(zesFrequencyGetThrottleTimePrologue, checker, &T::zesFrequencyGetThrottleTimePrologue, &ZESValidationEntryPoints::zesFrequencyGetThrottleTimePrologue);
+        addIfOverridden(zesFrequencyGetThrottleTimeEpilogue, checker, &T::zesFrequencyGetThrottleTimeEpilogue, &ZESValidationEntryPoints::zesFrequencyGetThrottleTimeEpilogue);
+        addIfOverridden(zesFrequencyOcGetCapabilitiesPrologue, checker, &T::zesFrequencyOcGetCapabilitiesPrologue, &ZESValidationEntryPoints::zesFrequencyOcGetCapabilitiesPrologue);
+        addIfOverridden(zesFrequencyOcGetCapabilitiesEpilogue, checker, &T::zesFrequencyOcGetCapabilitiesEpilogue, &ZESValidationEntryPoints::zesFrequencyOcGetCapabilitiesEpilogue);
+        addIfOverridden(zesFrequencyOcGetFrequencyTargetPrologue, checker, &T::zesFrequencyOcGetFrequencyTargetPrologue, &ZESValidationEntryPoints::zesFrequencyOcGetFrequencyTargetPrologue);
+        addIfOverridden(zesFrequencyOcGetFrequencyTargetEpilogue, checker, &T::zesFrequencyOcGetFrequencyTargetEpilogue, &ZESValidationEntryPoints::zesFrequencyOcGetFrequencyTargetEpilogue);
+        addIfOverridden(zesFrequencyOcSetFrequencyTargetPrologue, checker, &T::zesFrequencyOcSetFrequencyTargetPrologue, &ZESValidationEntryPoints::zesFrequencyOcSetFrequencyTargetPrologue);
+        addIfOverridden(zesFrequencyOcSetFrequencyTargetEpilogue, checker, &T::zesFrequencyOcSetFrequencyTargetEpilogue, &ZESValidationEntryPoints::zesFrequencyOcSetFrequencyTargetEpilogue);
+        addIfOverridden(zesFrequencyOcGetVoltageTargetPrologue, checker, &T::zesFrequencyOcGetVoltageTargetPrologue, &ZESValidationEntryPoints::zesFrequencyOcGetVoltageTargetPrologue);
+        addIfOverridden(zesFrequencyOcGetVoltageTargetEpilogue, checker, &T::zesFrequencyOcGetVoltageTargetEpilogue, &ZESValidationEntryPoints::zesFrequencyOcGetVoltageTargetEpilogue);
+        addIfOverridden(zesFrequencyOcSetVoltageTargetPrologue, checker, &T::zesFrequencyOcSetVoltageTargetPrologue, &ZESValidationEntryPoints::zesFrequencyOcSetVoltageTargetPrologue);
+        addIfOverridden(zesFrequencyOcSetVoltageTargetEpilogue, checker, &T::zesFrequencyOcSetVoltageTargetEpilogue, &ZESValidationEntryPoints::zesFrequencyOcSetVoltageTargetEpilogue);
+        addIfOverridden(zesFrequencyOcSetModePrologue, checker, &T::zesFrequencyOcSetModePrologue, &ZESValidationEntryPoints::zesFrequencyOcSetModePrologue);
+        addIfOverridden(zesFrequencyOcSetModeEpilogue, checker, &T::zesFrequencyOcSetModeEpilogue, &ZESValidationEntryPoints::zesFrequencyOcSetModeEpilogue);
+        addIfOverridden(zesFrequencyOcGetModePrologue, checker, &T::zesFrequencyOcGetModePrologue, &ZESValidationEntryPoints::zesFrequencyOcGetModePrologue);
+        addIfOverridden(zesFrequencyOcGetModeEpilogue, checker, &T::zesFrequencyOcGetModeEpilogue, &ZESValidationEntryPoints::zesFrequencyOcGetModeEpilogue);
+        addIfOverridden(zesFrequencyOcGetIccMaxPrologue, checker, &T::zesFrequencyOcGetIccMaxPrologue, &ZESValidationEntryPoints::zesFrequencyOcGetIccMaxPrologue);
+        addIfOverridden(zesFrequencyOcGetIccMaxEpilogue, checker, &T::zesFrequencyOcGetIccMaxEpilogue, &ZESValidationEntryPoints::zesFrequencyOcGetIccMaxEpilogue);
+        addIfOverridden(zesFrequencyOcSetIccMaxPrologue, checker, &T::zesFrequencyOcSetIccMaxPrologue, &ZESValidationEntryPoints::zesFrequencyOcSetIccMaxPrologue);
+        addIfOverridden(zesFrequencyOcSetIccMaxEpilogue, checker, &T::zesFrequencyOcSetIccMaxEpilogue, &ZESValidationEntryPoints::zesFrequencyOcSetIccMaxEpilogue);
+        addIfOverridden(zesFrequencyOcGetTjMaxPrologue, checker, &T::zesFrequencyOcGetTjMaxPrologue, &ZESValidationEntryPoints::zesFrequencyOcGetTjMaxPrologue);
+        addIfOverridden(zesFrequencyOcGetTjMaxEpilogue, checker, &T::zesFrequencyOcGetTjMaxEpilogue, &ZESValidationEntryPoints::zesFrequencyOcGetTjMaxEpilogue);
+        addIfOverridden(zesFrequencyOcSetTjMaxPrologue, checker, &T::zesFrequencyOcSetTjMaxPrologue, &ZESValidationEntryPoints::zesFrequencyOcSetTjMaxPrologue);
+        addIfOverridden(zesFrequencyOcSetTjMaxEpilogue, checker, &T::zesFrequencyOcSetTjMaxEpilogue, &ZESValidationEntryPoints::zesFrequencyOcSetTjMaxEpilogue);
+        addIfOverridden(zesDeviceEnumLedsPrologue, checker, &T::zesDeviceEnumLedsPrologue, &ZESValidationEntryPoints::zesDeviceEnumLedsPrologue);
+        addIfOverridden(zesDeviceEnumLedsEpilogue, checker, &T::zesDeviceEnumLedsEpilogue, &ZESValidationEntryPoints::zesDeviceEnumLedsEpilogue);
+        addIfOverridden(zesLedGetPropertiesPrologue, checker, &T::zesLedGetPropertiesPrologue, &ZESValidationEntryPoints::zesLedGetPropertiesPrologue);
+        addIfOverridden(zesLedGetPropertiesEpilogue, checker, &T::zesLedGetPropertiesEpilogue, &ZESValidationEntryPoints::zesLedGetPropertiesEpilogue);
+        addIfOverridden(zesLedGetStatePrologue, checker, &T::zesLedGetStatePrologue, &ZESValidationEntryPoints::zesLedGetStatePrologue);
+        addIfOverridden(zesLedGetStateEpilogue, checker, &T::zesLedGetStateEpilogue, &ZESValidationEntryPoints::zesLedGetStateEpilogue);
+        addIfOverridden(zesLedSetStatePrologue, checker, &T::zesLedSetStatePrologue, &ZESValidationEntryPoints::zesLedSetStatePrologue);
+        addIfOverridden(zesLedSetStateEpilogue, checker, &T::zesLedSetStateEpilogue, &ZESValidationEntryPoints::zesLedSetStateEpilogue);
+        addIfOverridden(zesLedSetColorPrologue, checker, &T::zesLedSetColorPrologue, &ZESValidationEntryPoints::zesLedSetColorPrologue);
+        addIfOverridden(zesLedSetColorEpilogue, checker, &T::zesLedSetColorEpilogue, &ZESValidationEntryPoints::zesLedSetColorEpilogue);
+        addIfOverridden(zesDeviceEnumMemoryModulesPrologue, checker, &T::zesDeviceEnumMemoryModulesPrologue, &ZESValidationEntryPoints::zesDeviceEnumMemoryModulesPrologue);
+        addIfOverridden(zesDeviceEnumMemoryModulesEpilogue, checker, &T::zesDeviceEnumMemoryModulesEpilogue, &ZESValidationEntryPoints::zesDeviceEnumMemoryModulesEpilogue);
+        addIfOverridden(zesMemoryGetPropertiesPrologue, checker, &T::zesMemoryGetPropertiesPrologue, &ZESValidationEntryPoints::zesMemoryGetPropertiesPrologue);
+        addIfOverridden(zesMemoryGetPropertiesEpilogue, checker, &T::zesMemoryGetPropertiesEpilogue, &ZESValidationEntryPoints::zesMemoryGetPropertiesEpilogue);
+        addIfOverridden(zesMemoryGetStatePrologue, checker, &T::zesMemoryGetStatePrologue, &ZESValidationEntryPoints::zesMemoryGetStatePrologue);
+        addIfOverridden(zesMemoryGetStateEpilogue, checker, &T::zesMemoryGetStateEpilogue, &ZESValidationEntryPoints::zesMemoryGetStateEpilogue);
+        addIfOverridden(zesMemoryGetBandwidthPrologue, checker, &T::zesMemoryGetBandwidthPrologue, &ZESValidationEntryPoints::zesMemoryGetBandwidthPrologue);
+        addIfOverridden(zesMemoryGetBandwidthEpilogue, checker, &T::zesMemoryGetBandwidthEpilogue, &ZESValidationEntryPoints::zesMemoryGetBandwidthEpilogue);
+        addIfOverridden(zesDeviceEnumPerformanceFactorDomainsPrologue, checker, &T::zesDeviceEnumPerformanceFactorDomainsPrologue, &ZESValidationEntryPoints::zesDeviceEnumPerformanceFactorDomainsPrologue);
+        addIfOverridden(zesDeviceEnumPerformanceFactorDomainsEpilogue, checker, &T::zesDeviceEnumPerformanceFactorDomainsEpilogue, &ZESValidationEntryPoints::zesDeviceEnumPerformanceFactorDomainsEpilogue);
+        addIfOverridden(zesPerformanceFactorGetPropertiesPrologue, checker, &T::zesPerformanceFactorGetPropertiesPrologue, &ZESValidationEntryPoints::zesPerformanceFactorGetPropertiesPrologue);
+        addIfOverridden(zesPerformanceFactorGetPropertiesEpilogue, checker, &T::zesPerformanceFactorGetPropertiesEpilogue, &ZESValidationEntryPoints::zesPerformanceFactorGetPropertiesEpilogue);
+        addIfOverridden(zesPerformanceFactorGetConfigPrologue, checker, &T::zesPerformanceFactorGetConfigPrologue, &ZESValidationEntryPoints::zesPerformanceFactorGetConfigPrologue);
+        addIfOverridden(zesPerformanceFactorGetConfigEpilogue, checker, &T::zesPerformanceFactorGetConfigEpilogue, &ZESValidationEntryPoints::zesPerformanceFactorGetConfigEpilogue);
+        addIfOverridden(zesPerformanceFactorSetConfigPrologue, checker, &T::zesPerformanceFactorSetConfigPrologue, &ZESValidationEntryPoints::zesPerformanceFactorSetConfigPrologue);
+        addIfOverridden(zesPerformanceFactorSetConfigEpilogue, checker, &T::zesPerformanceFactorSetConfigEpilogue, &ZESValidationEntryPoints::zesPerformanceFactorSetConfigEpilogue);
+        addIfOverridden(zesDeviceEnumPowerDomainsPrologue, checker, &T::zesDeviceEnumPowerDomainsPrologue, &ZESValidationEntryPoints::zesDeviceEnumPowerDomainsPrologue);
+        addIfOverridden(zesDeviceEnumPowerDomainsEpilogue, checker, &T::zesDeviceEnumPowerDomainsEpilogue, &ZESValidationEntryPoints::zesDeviceEnumPowerDomainsEpilogue);
+        addIfOverridden(zesDeviceGetCardPowerDomainPrologue, checker, &T::zesDeviceGetCardPowerDomainPrologue, &ZESValidationEntryPoints::zesDeviceGetCardPowerDomainPrologue);
+        addIfOverridden(zesDeviceGetCardPowerDomainEpilogue, checker, &T::zesDeviceGetCardPowerDomainEpilogue, &ZESValidationEntryPoints::zesDeviceGetCardPowerDomainEpilogue);
+        addIfOverridden(zesPowerGetPropertiesPrologue, checker, &T::zesPowerGetPropertiesPrologue, &ZESValidationEntryPoints::zesPowerGetPropertiesPrologue);
+        addIfOverridden(zesPowerGetPropertiesEpilogue, checker, &T::zesPowerGetPropertiesEpilogue, &ZESValidationEntryPoints::zesPowerGetPropertiesEpilogue);
+        addIfOverridden(zesPowerGetEnergyCounterPrologue, checker, &T::zesPowerGetEnergyCounterPrologue, &ZESValidationEntryPoints::zesPowerGetEnergyCounterPrologue);
+        addIfOverridden(zesPowerGetEnergyCounterEpilogue, checker, &T::zesPowerGetEnergyCounterEpilogue, &ZESValidationEntryPoints::zesPowerGetEnergyCounterEpilogue);
+        addIfOverridden(zesPowerGetLimitsPrologue, checker, &T::zesPowerGetLimitsPrologue, &ZESValidationEntryPoints::zesPowerGetLimitsPrologue);
+        addIfOverridden(zesPowerGetLimitsEpilogue, checker, &T::zesPowerGetLimitsEpilogue, &ZESValidationEntryPoints::zesPowerGetLimitsEpilogue);
+        addIfOverridden(zesPowerSetLimitsPrologue, checker, &T::zesPowerSetLimitsPrologue, &ZESValidationEntryPoints::zesPowerSetLimitsPrologue);
+        addIfOverridden(zesPowerSetLimitsEpilogue, checker, &T::zesPowerSetLimitsEpilogue, &ZESValidationEntryPoints::zesPowerSetLimitsEpilogue);
+        addIfOverridden(zesPowerGetEnergyThresholdPrologue, checker, &T::zesPowerGetEnergyThresholdPrologue, &ZESValidationEntryPoints::zesPowerGetEnergyThresholdPrologue);
+        addIfOverridden(zesPowerGetEnergyThresholdEpilogue, checker, &T::zesPowerGetEnergyThresholdEpilogue, &ZESValidationEntryPoints::zesPowerGetEnergyThresholdEpilogue);
+        addIfOverridden(zesPowerSetEnergyThresholdPrologue, checker, &T::zesPowerSetEnergyThresholdPrologue, &ZESValidationEntryPoints::zesPowerSetEnergyThresholdPrologue);
+        addIfOverridden(zesPowerSetEnergyThresholdEpilogue, checker, &T::zesPowerSetEnergyThresholdEpilogue, &ZESValidationEntryPoints::zesPowerSetEnergyThresholdEpilogue);
+        addIfOverridden(zesPowerGetUsagePrologue, checker, &T::zesPowerGetUsagePrologue, &ZESValidationEntryPoints::zesPowerGetUsagePrologue);
+        addIfOverridden(zesPowerGetUsageEpilogue, checker, &T::zesPowerGetUsageEpilogue, &ZESValidationEntryPoints::zesPowerGetUsageEpilogue);
+        addIfOverridden(zesDeviceEnumPsusPrologue, checker, &T::zesDeviceEnumPsusPrologue, &ZESValidationEntryPoints::zesDeviceEnumPsusPrologue);
+        addIfOverridden(zesDeviceEnumPsusEpilogue, checker, &T::zesDeviceEnumPsusEpilogue, &ZESValidationEntryPoints::zesDeviceEnumPsusEpilogue);
+        addIfOverridden(zesPsuGetPropertiesPrologue, checker, &T::zesPsuGetPropertiesPrologue, &ZESValidationEntryPoints::zesPsuGetPropertiesPrologue);
+        addIfOverridden(zesPsuGetPropertiesEpilogue, checker, &T::zesPsuGetPropertiesEpilogue, &ZESValidationEntryPoints::zesPsuGetPropertiesEpilogue);
+        addIfOverridden(zesPsuGetStatePrologue, checker, &T::zesPsuGetStatePrologue, &ZESValidationEntryPoints::zesPsuGetStatePrologue);
+        addIfOverridden(zesPsuGetStateEpilogue, checker, &T::zesPsuGetStateEpilogue, &ZESValidationEntryPoints::zesPsuGetStateEpilogue);
+        addIfOverridden(zesDeviceEnumRasErrorSetsPrologue, checker, &T::zesDeviceEnumRasErrorSetsPrologue, &ZESValidationEntryPoints::zesDeviceEnumRasErrorSetsPrologue);
+        addIfOverridden(zesDeviceEnumRasErrorSetsEpilogue, checker, &T::zesDeviceEnumRasErrorSetsEpilogue, &ZESValidationEntryPoints::zesDeviceEnumRasErrorSetsEpilogue);
+        addIfOverridden(zesRasGetPropertiesPrologue, checker, &T::zesRasGetPropertiesPrologue, &ZESValidationEntryPoints::zesRasGetPropertiesPrologue);
+        addIfOverridden(zesRasGetPropertiesEpilogue, checker, &T::zesRasGetPropertiesEpilogue, &ZESValidationEntryPoints::zesRasGetPropertiesEpilogue);
+        addIfOverridden(zesRasGetConfigPrologue, checker, &T::zesRasGetConfigPrologue, &ZESValidationEntryPoints::zesRasGetConfigPrologue);
+        addIfOverridden(zesRasGetConfigEpilogue, checker, &T::zesRasGetConfigEpilogue, &ZESValidationEntryPoints::zesRasGetConfigEpilogue);
+        addIfOverridden(zesRasSetConfigPrologue, checker, &T::zesRasSetConfigPrologue, &ZESValidationEntryPoints::zesRasSetConfigPrologue);
+        addIfOverridden(zesRasSetConfigEpilogue, checker, &T::zesRasSetConfigEpilogue, &ZESValidationEntryPoints::zesRasSetConfigEpilogue);
+        addIfOverridden(zesRasGetStatePrologue, checker, &T::zesRasGetStatePrologue, &ZESValidationEntryPoints::zesRasGetStatePrologue);
+        addIfOverridden(zesRasGetStateEpilogue, checker, &T::zesRasGetStateEpilogue, &ZESValidationEntryPoints::zesRasGetStateEpilogue);
+        addIfOverridden(zesDeviceEnumSchedulersPrologue, checker, &T::zesDeviceEnumSchedulersPrologue, &ZESValidationEntryPoints::zesDeviceEnumSchedulersPrologue);
+        addIfOverridden(zesDeviceEnumSchedulersEpilogue, checker, &T::zesDeviceEnumSchedulersEpilogue, &ZESValidationEntryPoints::zesDeviceEnumSchedulersEpilogue);
+        addIfOverridden(zesSchedulerGetPropertiesPrologue, checker, &T::zesSchedulerGetPropertiesPrologue, &ZESValidationEntryPoints::zesSchedulerGetPropertiesPrologue);
+        addIfOverridden(zesSchedulerGetPropertiesEpilogue, checker, &T::zesSchedulerGetPropertiesEpilogue, &ZESValidationEntryPoints::zesSchedulerGetPropertiesEpilogue);
+        addIfOverridden(zesSchedulerGetCurrentModePrologue, checker, &T::zesSchedulerGetCurrentModePrologue, &ZESValidationEntryPoints::zesSchedulerGetCurrentModePrologue);
+        addIfOverridden(zesSchedulerGetCurrentModeEpilogue, checker, &T::zesSchedulerGetCurrentModeEpilogue, &ZESValidationEntryPoints::zesSchedulerGetCurrentModeEpilogue);
+        addIfOverridden(zesSchedulerGetTimeoutModePropertiesPrologue, checker, &T::zesSchedulerGetTimeoutModePropertiesPrologue, &ZESValidationEntryPoints::zesSchedulerGetTimeoutModePropertiesPrologue);
+        addIfOverridden(zesSchedulerGetTimeoutModePropertiesEpilogue, checker, &T::zesSchedulerGetTimeoutModePropertiesEpilogue, &ZESValidationEntryPoints::zesSchedulerGetTimeoutModePropertiesEpilogue);
+        addIfOverridden(zesSchedulerGetTimesliceModePropertiesPrologue, checker, &T::zesSchedulerGetTimesliceModePropertiesPrologue, &ZESValidationEntryPoints::zesSchedulerGetTimesliceModePropertiesPrologue);
+        addIfOverridden(zesSchedulerGetTimesliceModePropertiesEpilogue, checker, &T::zesSchedulerGetTimesliceModePropertiesEpilogue, &ZESValidationEntryPoints::zesSchedulerGetTimesliceModePropertiesEpilogue);
+        addIfOverridden(zesSchedulerSetTimeoutModePrologue, checker, &T::zesSchedulerSetTimeoutModePrologue, &ZESValidationEntryPoints::zesSchedulerSetTimeoutModePrologue);
+        addIfOverridden(zesSchedulerSetTimeoutModeEpilogue, checker, &T::zesSchedulerSetTimeoutModeEpilogue, &ZESValidationEntryPoints::zesSchedulerSetTimeoutModeEpilogue);
+        addIfOverridden(zesSchedulerSetTimesliceModePrologue, checker, &T::zesSchedulerSetTimesliceModePrologue, &ZESValidationEntryPoints::zesSchedulerSetTimesliceModePrologue);
+        addIfOverridden(zesSchedulerSetTimesliceModeEpilogue, checker, &T::zesSchedulerSetTimesliceModeEpilogue, &ZESValidationEntryPoints::zesSchedulerSetTimesliceModeEpilogue);
+        addIfOverridden(zesSchedulerSetExclusiveModePrologue, checker, &T::zesSchedulerSetExclusiveModePrologue, &ZESValidationEntryPoints::zesSchedulerSetExclusiveModePrologue);
+        addIfOverridden(zesSchedulerSetExclusiveModeEpilogue, checker, &T::zesSchedulerSetExclusiveModeEpilogue, &ZESValidationEntryPoints::zesSchedulerSetExclusiveModeEpilogue);
+        addIfOverridden(zesSchedulerSetComputeUnitDebugModePrologue, checker, &T::zesSchedulerSetComputeUnitDebugModePrologue, &ZESValidationEntryPoints::zesSchedulerSetComputeUnitDebugModePrologue);
+        addIfOverridden(zesSchedulerSetComputeUnitDebugModeEpilogue, checker, &T::zesSchedulerSetComputeUnitDebugModeEpilogue, &ZESValidationEntryPoints::zesSchedulerSetComputeUnitDebugModeEpilogue);
+        addIfOverridden(zesDeviceEnumStandbyDomainsPrologue, checker, &T::zesDeviceEnumStandbyDomainsPrologue, &ZESValidationEntryPoints::zesDeviceEnumStandbyDomainsPrologue);
+        addIfOverridden(zesDeviceEnumStandbyDomainsEpilogue, checker, &T::zesDeviceEnumStandbyDomainsEpilogue, &ZESValidationEntryPoints::zesDeviceEnumStandbyDomainsEpilogue);
+        addIfOverridden(zesStandbyGetPropertiesPrologue, checker, &T::zesStandbyGetPropertiesPrologue, &ZESValidationEntryPoints::zesStandbyGetPropertiesPrologue);
+        addIfOverridden(zesStandbyGetPropertiesEpilogue, checker, &T::zesStandbyGetPropertiesEpilogue, &ZESValidationEntryPoints::zesStandbyGetPropertiesEpilogue);
+        addIfOverridden(zesStandbyGetModePrologue, checker, &T::zesStandbyGetModePrologue, &ZESValidationEntryPoints::zesStandbyGetModePrologue);
+        addIfOverridden(zesStandbyGetModeEpilogue, checker, &T::zesStandbyGetModeEpilogue, &ZESValidationEntryPoints::zesStandbyGetModeEpilogue);
+        addIfOverridden(zesStandbySetModePrologue, checker, &T::zesStandbySetModePrologue, &ZESValidationEntryPoints::zesStandbySetModePrologue);
+        addIfOverridden(zesStandbySetModeEpilogue, checker, &T::zesStandbySetModeEpilogue, &ZESValidationEntryPoints::zesStandbySetModeEpilogue);
+        addIfOverridden(zesDeviceEnumTemperatureSensorsPrologue, checker, &T::zesDeviceEnumTemperatureSensorsPrologue, &ZESValidationEntryPoints::zesDeviceEnumTemperatureSensorsPrologue);
+        addIfOverridden(zesDeviceEnumTemperatureSensorsEpilogue, checker, &T::zesDeviceEnumTemperatureSensorsEpilogue, &ZESValidationEntryPoints::zesDeviceEnumTemperatureSensorsEpilogue);
+        addIfOverridden(zesTemperatureGetPropertiesPrologue, checker, &T::zesTemperatureGetPropertiesPrologue, &ZESValidationEntryPoints::zesTemperatureGetPropertiesPrologue);
+        addIfOverridden(zesTemperatureGetPropertiesEpilogue, checker, &T::zesTemperatureGetPropertiesEpilogue, &ZESValidationEntryPoints::zesTemperatureGetPropertiesEpilogue);
+        addIfOverridden(zesTemperatureGetConfigPrologue, checker, &T::zesTemperatureGetConfigPrologue, &ZESValidationEntryPoints::zesTemperatureGetConfigPrologue);
+        addIfOverridden(zesTemperatureGetConfigEpilogue, checker, &T::zesTemperatureGetConfigEpilogue, &ZESValidationEntryPoints::zesTemperatureGetConfigEpilogue);
+        addIfOverridden(zesTemperatureSetConfigPrologue, checker, &T::zesTemperatureSetConfigPrologue, &ZESValidationEntryPoints::zesTemperatureSetConfigPrologue);
+        addIfOverridden(zesTemperatureSetConfigEpilogue, checker, &T::zesTemperatureSetConfigEpilogue, &ZESValidationEntryPoints::zesTemperatureSetConfigEpilogue);
+        addIfOverridden(zesTemperatureGetStatePrologue, checker, &T::zesTemperatureGetStatePrologue, &ZESValidationEntryPoints::zesTemperatureGetStatePrologue);
+        addIfOverridden(zesTemperatureGetStateEpilogue, checker, &T::zesTemperatureGetStateEpilogue, &ZESValidationEntryPoints::zesTemperatureGetStateEpilogue);
+        addIfOverridden(zesPowerGetLimitsExtPrologue, checker, &T::zesPowerGetLimitsExtPrologue, &ZESValidationEntryPoints::zesPowerGetLimitsExtPrologue);
+        addIfOverridden(zesPowerGetLimitsExtEpilogue, checker, &T::zesPowerGetLimitsExtEpilogue, &ZESValidationEntryPoints::zesPowerGetLimitsExtEpilogue);
+        addIfOverridden(zesPowerSetLimitsExtPrologue, checker, &T::zesPowerSetLimitsExtPrologue, &ZESValidationEntryPoints::zesPowerSetLimitsExtPrologue);
+        addIfOverridden(zesPowerSetLimitsExtEpilogue, checker, &T::zesPowerSetLimitsExtEpilogue, &ZESValidationEntryPoints::zesPowerSetLimitsExtEpilogue);
+        addIfOverridden(zesPowerGetLimitsExt2Prologue, checker, &T::zesPowerGetLimitsExt2Prologue, &ZESValidationEntryPoints::zesPowerGetLimitsExt2Prologue);
+        addIfOverridden(zesPowerGetLimitsExt2Epilogue, checker, &T::zesPowerGetLimitsExt2Epilogue, &ZESValidationEntryPoints::zesPowerGetLimitsExt2Epilogue);
+        addIfOverridden(zesPowerSetLimitsExt2Prologue, checker, &T::zesPowerSetLimitsExt2Prologue, &ZESValidationEntryPoints::zesPowerSetLimitsExt2Prologue);
+        addIfOverridden(zesPowerSetLimitsExt2Epilogue, checker, &T::zesPowerSetLimitsExt2Epilogue, &ZESValidationEntryPoints::zesPowerSetLimitsExt2Epilogue);
+        addIfOverridden(zesEngineGetActivityExtPrologue, checker, &T::zesEngineGetActivityExtPrologue, &ZESValidationEntryPoints::zesEngineGetActivityExtPrologue);
+        addIfOverridden(zesEngineGetActivityExtEpilogue, checker, &T::zesEngineGetActivityExtEpilogue, &ZESValidationEntryPoints::zesEngineGetActivityExtEpilogue);
+        addIfOverridden(zesRasGetStateExpPrologue, checker, &T::zesRasGetStateExpPrologue, &ZESValidationEntryPoints::zesRasGetStateExpPrologue);
+        addIfOverridden(zesRasGetStateExpEpilogue, checker, &T::zesRasGetStateExpEpilogue, &ZESValidationEntryPoints::zesRasGetStateExpEpilogue);
+        addIfOverridden(zesRasClearStateExpPrologue, checker, &T::zesRasClearStateExpPrologue, &ZESValidationEntryPoints::zesRasClearStateExpPrologue);
+        addIfOverridden(zesRasClearStateExpEpilogue, checker, &T::zesRasClearStateExpEpilogue, &ZESValidationEntryPoints::zesRasClearStateExpEpilogue);
+        addIfOverridden(zesRasGetSupportedCategoriesExpPrologue, checker, &T::zesRasGetSupportedCategoriesExpPrologue, &ZESValidationEntryPoints::zesRasGetSupportedCategoriesExpPrologue);
+        addIfOverridden(zesRasGetSupportedCategoriesExpEpilogue, checker, &T::zesRasGetSupportedCategoriesExpEpilogue, &ZESValidationEntryPoints::zesRasGetSupportedCategoriesExpEpilogue);
+        addIfOverridden(zesRasGetStateExp2Prologue, checker, &T::zesRasGetStateExp2Prologue, &ZESValidationEntryPoints::zesRasGetStateExp2Prologue);
+        addIfOverridden(zesRasGetStateExp2Epilogue, checker, &T::zesRasGetStateExp2Epilogue, &ZESValidationEntryPoints::zesRasGetStateExp2Epilogue);
+        addIfOverridden(zesRasGetConfigExpPrologue, checker, &T::zesRasGetConfigExpPrologue, &ZESValidationEntryPoints::zesRasGetConfigExpPrologue);
+        addIfOverridden(zesRasGetConfigExpEpilogue, checker, &T::zesRasGetConfigExpEpilogue, &ZESValidationEntryPoints::zesRasGetConfigExpEpilogue);
+        addIfOverridden(zesRasSetConfigExpPrologue, checker, &T::zesRasSetConfigExpPrologue, &ZESValidationEntryPoints::zesRasSetConfigExpPrologue);
+        addIfOverridden(zesRasSetConfigExpEpilogue, checker, &T::zesRasSetConfigExpEpilogue, &ZESValidationEntryPoints::zesRasSetConfigExpEpilogue);
+        addIfOverridden(zesFirmwareGetSecurityVersionExpPrologue, checker, &T::zesFirmwareGetSecurityVersionExpPrologue, &ZESValidationEntryPoints::zesFirmwareGetSecurityVersionExpPrologue);
+        addIfOverridden(zesFirmwareGetSecurityVersionExpEpilogue, checker, &T::zesFirmwareGetSecurityVersionExpEpilogue, &ZESValidationEntryPoints::zesFirmwareGetSecurityVersionExpEpilogue);
+        addIfOverridden(zesFirmwareSetSecurityVersionExpPrologue, checker, &T::zesFirmwareSetSecurityVersionExpPrologue, &ZESValidationEntryPoints::zesFirmwareSetSecurityVersionExpPrologue);
+        addIfOverridden(zesFirmwareSetSecurityVersionExpEpilogue, checker, &T::zesFirmwareSetSecurityVersionExpEpilogue, &ZESValidationEntryPoints::zesFirmwareSetSecurityVersionExpEpilogue);
+        addIfOverridden(zesDeviceGetSubDevicePropertiesExpPrologue, checker, &T::zesDeviceGetSubDevicePropertiesExpPrologue, &ZESValidationEntryPoints::zesDeviceGetSubDevicePropertiesExpPrologue);
+        addIfOverridden(zesDeviceGetSubDevicePropertiesExpEpilogue, checker, &T::zesDeviceGetSubDevicePropertiesExpEpilogue, &ZESValidationEntryPoints::zesDeviceGetSubDevicePropertiesExpEpilogue);
+        addIfOverridden(zesDriverGetDeviceByUuidExpPrologue, checker, &T::zesDriverGetDeviceByUuidExpPrologue, &ZESValidationEntryPoints::zesDriverGetDeviceByUuidExpPrologue);
+        addIfOverridden(zesDriverGetDeviceByUuidExpEpilogue, checker, &T::zesDriverGetDeviceByUuidExpEpilogue, &ZESValidationEntryPoints::zesDriverGetDeviceByUuidExpEpilogue);
+        addIfOverridden(zesDeviceEnumActiveVFExpPrologue, checker, &T::zesDeviceEnumActiveVFExpPrologue, &ZESValidationEntryPoints::zesDeviceEnumActiveVFExpPrologue);
+        addIfOverridden(zesDeviceEnumActiveVFExpEpilogue, checker, &T::zesDeviceEnumActiveVFExpEpilogue, &ZESValidationEntryPoints::zesDeviceEnumActiveVFExpEpilogue);
+        addIfOverridden(zesVFManagementGetVFPropertiesExpPrologue, checker, &T::zesVFManagementGetVFPropertiesExpPrologue, &ZESValidationEntryPoints::zesVFManagementGetVFPropertiesExpPrologue);
+        addIfOverridden(zesVFManagementGetVFPropertiesExpEpilogue, checker, &T::zesVFManagementGetVFPropertiesExpEpilogue, &ZESValidationEntryPoints::zesVFManagementGetVFPropertiesExpEpilogue);
+        addIfOverridden(zesVFManagementGetVFMemoryUtilizationExpPrologue, checker, &T::zesVFManagementGetVFMemoryUtilizationExpPrologue, &ZESValidationEntryPoints::zesVFManagementGetVFMemoryUtilizationExpPrologue);
+        addIfOverridden(zesVFManagementGetVFMemoryUtilizationExpEpilogue, checker, &T::zesVFManagementGetVFMemoryUtilizationExpEpilogue, &ZESValidationEntryPoints::zesVFManagementGetVFMemoryUtilizationExpEpilogue);
+        addIfOverridden(zesVFManagementGetVFEngineUtilizationExpPrologue, checker, &T::zesVFManagementGetVFEngineUtilizationExpPrologue, &ZESValidationEntryPoints::zesVFManagementGetVFEngineUtilizationExpPrologue);
+        addIfOverridden(zesVFManagementGetVFEngineUtilizationExpEpilogue, checker, &T::zesVFManagementGetVFEngineUtilizationExpEpilogue, &ZESValidationEntryPoints::zesVFManagementGetVFEngineUtilizationExpEpilogue);
+        addIfOverridden(zesVFManagementSetVFTelemetryModeExpPrologue, checker, &T::zesVFManagementSetVFTelemetryModeExpPrologue, &ZESValidationEntryPoints::zesVFManagementSetVFTelemetryModeExpPrologue);
+        addIfOverridden(zesVFManagementSetVFTelemetryModeExpEpilogue, checker, &T::zesVFManagementSetVFTelemetryModeExpEpilogue, &ZESValidationEntryPoints::zesVFManagementSetVFTelemetryModeExpEpilogue);
+        addIfOverridden(zesVFManagementSetVFTelemetrySamplingIntervalExpPrologue, checker, &T::zesVFManagementSetVFTelemetrySamplingIntervalExpPrologue, &ZESValidationEntryPoints::zesVFManagementSetVFTelemetrySamplingIntervalExpPrologue);
+        addIfOverridden(zesVFManagementSetVFTelemetrySamplingIntervalExpEpilogue, checker, &T::zesVFManagementSetVFTelemetrySamplingIntervalExpEpilogue, &ZESValidationEntryPoints::zesVFManagementSetVFTelemetrySamplingIntervalExpEpilogue);
+        addIfOverridden(zesDeviceEnumEnabledVFExpPrologue, checker, &T::zesDeviceEnumEnabledVFExpPrologue, &ZESValidationEntryPoints::zesDeviceEnumEnabledVFExpPrologue);
+        addIfOverridden(zesDeviceEnumEnabledVFExpEpilogue, checker, &T::zesDeviceEnumEnabledVFExpEpilogue, &ZESValidationEntryPoints::zesDeviceEnumEnabledVFExpEpilogue);
+        addIfOverridden(zesVFManagementGetVFCapabilitiesExpPrologue, checker, &T::zesVFManagementGetVFCapabilitiesExpPrologue, &ZESValidationEntryPoints::zesVFManagementGetVFCapabilitiesExpPrologue);
+        addIfOverridden(zesVFManagementGetVFCapabilitiesExpEpilogue, checker, &T::zesVFManagementGetVFCapabilitiesExpEpilogue, &ZESValidationEntryPoints::zesVFManagementGetVFCapabilitiesExpEpilogue);
+        addIfOverridden(zesVFManagementGetVFMemoryUtilizationExp2Prologue, checker, &T::zesVFManagementGetVFMemoryUtilizationExp2Prologue, &ZESValidationEntryPoints::zesVFManagementGetVFMemoryUtilizationExp2Prologue);
+        addIfOverridden(zesVFManagementGetVFMemoryUtilizationExp2Epilogue, checker, &T::zesVFManagementGetVFMemoryUtilizationExp2Epilogue, &ZESValidationEntryPoints::zesVFManagementGetVFMemoryUtilizationExp2Epilogue);
+        addIfOverridden(zesVFManagementGetVFEngineUtilizationExp2Prologue, checker, &T::zesVFManagementGetVFEngineUtilizationExp2Prologue, &ZESValidationEntryPoints::zesVFManagementGetVFEngineUtilizationExp2Prologue);
+        addIfOverridden(zesVFManagementGetVFEngineUtilizationExp2Epilogue, checker, &T::zesVFManagementGetVFEngineUtilizationExp2Epilogue, &ZESValidationEntryPoints::zesVFManagementGetVFEngineUtilizationExp2Epilogue);
+        addIfOverridden(zesVFManagementGetVFCapabilitiesExp2Prologue, checker, &T::zesVFManagementGetVFCapabilitiesExp2Prologue, &ZESValidationEntryPoints::zesVFManagementGetVFCapabilitiesExp2Prologue);
+        addIfOverridden(zesVFManagementGetVFCapabilitiesExp2Epilogue, checker, &T::zesVFManagementGetVFCapabilitiesExp2Epilogue, &ZESValidationEntryPoints::zesVFManagementGetVFCapabilitiesExp2Epilogue);
+        addIfOverridden(zesDevicePciLinkSpeedUpdateExtPrologue, checker, &T::zesDevicePciLinkSpeedUpdateExtPrologue, &ZESValidationEntryPoints::zesDevicePciLinkSpeedUpdateExtPrologue);
+        addIfOverridden(zesDevicePciLinkSpeedUpdateExtEpilogue, checker, &T::zesDevicePciLinkSpeedUpdateExtEpilogue, &ZESValidationEntryPoints::zesDevicePciLinkSpeedUpdateExtEpilogue);
+    }
+
+private:
+    template <class Derived, class Base>
+    static void addIfOverridden(std::vector<ZESValidationEntryPoints *> &checkers, ZESValidationEntryPoints *checker, Derived, Base) {
+        if (!std::is_same<Derived, Base>::value)
+            checkers.push_back(checker);
+    }
+};
 }
\ No newline at end of file
@@ -11,6 +11,8 @@
  */
 #pragma once
 #include "zet_api.h"
+#include <type_traits>
+#include <vector>
 
 namespace validation_layer
 {
@@ -157,4 +159,302 @@ public:
     virtual ze_result_t zetDeviceDisableMetricsExpEpilogue( zet_device_handle_t hDevice , ze_result_t result) {return ZE_RESULT_SUCCESS;}
     virtual ~ZETValidationEntryPoints() {}
 };
+
+// Checkers to call for each entry point.  A checker is only listed for the
+// entry points its class overrides, so intercepts never make a virtual call
+// into an inherited no-op default.
+class ZETValidationDispatch {
+public:
+    std::vector<ZETValidationEntryPoints *> zetModuleGetDebugInfoPrologue;
+    std::vector<ZETValidationEntryPoints *> zetModuleGetDebugInfoEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetDeviceGetDebugPropertiesPrologue;
+    std::vector<ZETValidationEntryPoints *> zetDeviceGetDebugPropertiesEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetDebugAttachPrologue;
+    std::vector<ZETValidationEntryPoints *> zetDebugAttachEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetDebugDetachPrologue;
+    std::vector<ZETValidationEntryPoints *> zetDebugDetachEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetDebugReadEventPrologue;
+    std::vector<ZETValidationEntryPoints *> zetDebugReadEventEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetDebugAcknowledgeEventPrologue;
+    std::vector<ZETValidationEntryPoints *> zetDebugAcknowledgeEventEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetDebugInterruptPrologue;
+    std::vector<ZETValidationEntryPoints *> zetDebugInterruptEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetDebugResumePrologue;
+    std::vector<ZETValidationEntryPoints *> zetDebugResumeEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetDebugReadMemoryPrologue;
+    std::vector<ZETValidationEntryPoints *> zetDebugReadMemoryEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetDebugWriteMemoryPrologue;
+    std::vector<ZETValidationEntryPoints *> zetDebugWriteMemoryEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetDebugGetRegisterSetPropertiesPrologue;
+    std::vector<ZETValidationEntryPoints *> zetDebugGetRegisterSetPropertiesEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetDebugGetThreadRegisterSetPropertiesPrologue;
+    std::vector<ZETValidationEntryPoints *> zetDebugGetThreadRegisterSetPropertiesEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetDebugReadRegistersPrologue;
+    std::vector<ZETValidationEntryPoints *> zetDebugReadRegistersEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetDebugWriteRegistersPrologue;
+    std::vector<ZETValidationEntryPoints *> zetDebugWriteRegistersEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricGroupGetPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricGroupGetEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricGroupGetPropertiesPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricGroupGetPropertiesEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricGroupCalculateMetricValuesPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricGroupCalculateMetricValuesEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricGetPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricGetEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricGetPropertiesPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricGetPropertiesEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetContextActivateMetricGroupsPrologue;
+    std::vector<ZETValidationEntryPoints *> zetContextActivateMetricGroupsEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricStreamerOpenPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricStreamerOpenEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetCommandListAppendMetricStreamerMarkerPrologue;
+    std::vector<ZETValidationEntryPoints *> zetCommandListAppendMetricStreamerMarkerEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricStreamerClosePrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricStreamerCloseEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricStreamerReadDataPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricStreamerReadDataEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricQueryPoolCreatePrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricQueryPoolCreateEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricQueryPoolDestroyPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricQueryPoolDestroyEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricQueryCreatePrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricQueryCreateEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricQueryDestroyPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricQueryDestroyEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricQueryResetPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricQueryResetEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetCommandListAppendMetricQueryBeginPrologue;
+    std::vector<ZETValidationEntryPoints *> zetCommandListAppendMetricQueryBeginEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetCommandListAppendMetricQueryEndPrologue;
+    std::vector<ZETValidationEntryPoints *> zetCommandListAppendMetricQueryEndEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetCommandListAppendMetricMemoryBarrierPrologue;
+    std::vector<ZETValidationEntryPoints *> zetCommandListAppendMetricMemoryBarrierEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricQueryGetDataPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricQueryGetDataEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetKernelGetProfileInfoPrologue;
+    std::vector<ZETValidationEntryPoints *> zetKernelGetProfileInfoEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetTracerExpCreatePrologue;
+    std::vector<ZETValidationEntryPoints *> zetTracerExpCreateEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetTracerExpDestroyPrologue;
+    std::vector<ZETValidationEntryPoints *> zetTracerExpDestroyEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetTracerExpSetProloguesPrologue;
+    std::vector<ZETValidationEntryPoints *> zetTracerExpSetProloguesEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetTracerExpSetEpiloguesPrologue;
+    std::vector<ZETValidationEntryPoints *> zetTracerExpSetEpiloguesEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetTracerExpSetEnabledPrologue;
+    std::vector<ZETValidationEntryPoints *> zetTracerExpSetEnabledEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricGroupCalculateMultipleMetricValuesExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricGroupCalculateMultipleMetricValuesExpEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricGroupGetGlobalTimestampsExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricGroupGetGlobalTimestampsExpEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricGroupGetExportDataExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricGroupGetExportDataExpEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricGroupCalculateMetricExportDataExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricGroupCalculateMetricExportDataExpEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricProgrammableGetExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricProgrammableGetExpEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricProgrammableGetPropertiesExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricProgrammableGetPropertiesExpEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricProgrammableGetParamInfoExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricProgrammableGetParamInfoExpEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricProgrammableGetParamValueInfoExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricProgrammableGetParamValueInfoExpEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricCreateFromProgrammableExp2Prologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricCreateFromProgrammableExp2Epilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricCreateFromProgrammableExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricCreateFromProgrammableExpEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetDeviceCreateMetricGroupsFromMetricsExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetDeviceCreateMetricGroupsFromMetricsExpEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricGroupCreateExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricGroupCreateExpEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricGroupAddMetricExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricGroupAddMetricExpEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricGroupRemoveMetricExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricGroupRemoveMetricExpEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricGroupCloseExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricGroupCloseExpEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricGroupDestroyExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricGroupDestroyExpEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricDestroyExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricDestroyExpEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetDeviceGetConcurrentMetricGroupsExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetDeviceGetConcurrentMetricGroupsExpEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricTracerCreateExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricTracerCreateExpEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricTracerDestroyExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricTracerDestroyExpEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricTracerEnableExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricTracerEnableExpEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricTracerDisableExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricTracerDisableExpEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricTracerReadDataExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricTracerReadDataExpEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricDecoderCreateExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricDecoderCreateExpEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricDecoderDestroyExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricDecoderDestroyExpEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricDecoderGetDecodableMetricsExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricDecoderGetDecodableMetricsExpEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetMetricTracerDecodeExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetMetricTracerDecodeExpEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetCommandListAppendMarkerExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetCommandListAppendMarkerExpEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetDeviceEnableMetricsExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetDeviceEnableMetricsExpEpilogue;
+    std::vector<ZETValidationEntryPoints *> zetDeviceDisableMetricsExpPrologue;
+    std::vector<ZETValidationEntryPoints *> zetDeviceDisableMetricsExpEpilogue;
+
+    // T is the checker's concrete class.  &T::f has the type of the
+    // ZETValidationEntryPoints member unless T redeclares f, so whether an
+    // entry point is overridden is decided at compile time.
+    template <class T> void addChecker(T *checker) {
+        if (nullptr == checker)
+            return;
+        addIfOverridden(zetModuleGetDebugInfoPrologue, checker, &T::zetModuleGetDebugInfoPrologue, &ZETValidationEntryPoints::zetModuleGetDebugInfoPrologue);
+        addIfOverridden(zetModuleGetDebugInfoEpilogue, checker, &T::zetModuleGetDebugInfoEpilogue, &ZETValidationEntryPoints::zetModuleGetDebugInfoEpilogue);
+        addIfOverridden(zetDeviceGetDebugPropertiesPrologue, checker, &T::zetDeviceGetDebugPropertiesPrologue, &ZETValidationEntryPoints::zetDeviceGetDebugPropertiesPrologue);
+        addIfOverridden(zetDeviceGetDebugPropertiesEpilogue, checker, &T::zetDeviceGetDebugPropertiesEpilogue, &ZETValidationEntryPoints::zetDeviceGetDebugPropertiesEpilogue);
+        addIfOverridden(zetDebugAttachPrologue, checker, &T::zetDebugAttachPrologue, &ZETValidationEntryPoints::zetDebugAttachPrologue);
+        addIfOverridden(zetDebugAttachEpilogue, checker, &T::zetDebugAttachEpilogue, &ZETValidationEntryPoints::zetDebugAttachEpilogue);
+        addIfOverridden(zetDebugDetachPrologue, checker, &T::zetDebugDetachPrologue, &ZETValidationEntryPoints::zetDebugDetachPrologue);
+        addIfOverridden(zetDebugDetachEpilogue, checker, &T::zetDebugDetachEpilogue, &ZETValidationEntryPoints::zetDebugDetachEpilogue);
+        addIfOverridden(zetDebugReadEventPrologue, checker, &T::zetDebugReadEventPrologue, &ZETValidationEntryPoints::zetDebugReadEventPrologue);
+        addIfOverridden(zetDebugReadEventEpilogue, checker, &T::zetDebugReadEventEpilogue, &ZETValidationEntryPoints::zetDebugReadEventEpilogue);
+        addIfOverridden(zetDebugAcknowledgeEventPrologue, checker, &T::zetDebugAcknowledgeEventPrologue, &ZETValidationEntryPoints::zetDebugAcknowledgeEventPrologue);
+        addIfOverridden(zetDebugAcknowledgeEventEpilogue, checker, &T::zetDebugAcknowledgeEventEpilogue, &ZETValidationEntryPoints::zetDebugAcknowledgeEventEpilogue);
+        addIfOverridden(zetDebugInterruptPrologue, checker, &T::zetDebugInterruptPrologue, &ZETValidationEntryPoints::zetDebugInterruptPrologue);
+        addIfOverridden(zetDebugInterruptEpilogue, checker, &T::zetDebugInterruptEpilogue, &ZETValidationEntryPoints::zetDebugInterruptEpilogue);
+        addIfOverridden(zetDebugResumePrologue, checker, &T::zetDebugResumePrologue, &ZETValidationEntryPoints::zetDebugResumePrologue);
+        addIfOverridden(zetDebugResumeEpilogue, checker, &T::zetDebugResumeEpilogue, &ZETValidationEntryPoints::zetDebugResumeEpilogue);
+        addIfOverridden(zetDebugReadMemoryPrologue, checker, &T::zetDebugReadMemoryPrologue, &ZETValidationEntryPoints::zetDebugReadMemoryPrologue);
+        addIfOverridden(zetDebugReadMemoryEpilogue, checker, &T::zetDebugReadMemoryEpilogue, &ZETValidationEntryPoints::zetDebugReadMemoryEpilogue);
+        addIfOverridden(zetDebugWriteMemoryPrologue, checker, &T::zetDebugWriteMemoryPrologue, &ZETValidationEntryPoints::zetDebugWriteMemoryPrologue);
+        addIfOverridden(zetDebugWriteMemoryEpilogue, checker, &T::zetDebugWriteMemoryEpilogue, &ZETValidationEntryPoints::zetDebugWriteMemoryEpilogue);
+        addIfOverridden(zetDebugGetRegisterSetPropertiesPrologue, checker, &T::zetDebugGetRegisterSetPropertiesPrologue, &ZETValidationEntryPoints::zetDebugGetRegisterSetPropertiesPrologue);
+        addIfOverridden(zetDebugGetRegisterSetPropertiesEpilogue, checker, &T::zetDebugGetRegisterSetPropertiesEpilogue, &ZETValidationEntryPoints::zetDebugGetRegisterSetPropertiesEpilogue);
+        addIfOverridden(zetDebugGetThreadRegisterSetPropertiesPrologue, checker, &T::zetDebugGetThreadRegisterSetPropertiesPrologue, &ZETValidationEntryPoints::zetDebugGetThreadRegisterSetPropertiesPrologue);
+        addIfOverridden(zetDebugGetThreadRegisterSetPropertiesEpilogue, checker, &T::zetDebugGetThreadRegisterSetPropertiesEpilogue, &ZETValidationEntryPoints::zetDebugGetThreadRegisterSetPropertiesEpilogue);
+        addIfOverridden(zetDebugReadRegistersPrologue, checker, &T::zetDebugReadRegistersPrologue, &ZETValidationEntryPoints::zetDebugReadRegistersPrologue);
+        addIfOverridden(zetDebugReadRegistersEpilogue, checker, &T::zetDebugReadRegistersEpilogue, &ZETValidationEntryPoints::zetDebugReadRegistersEpilogue);
+        addIfOverridden(zetDebugWriteRegistersPrologue, checker, &T::zetDebugWriteRegistersPrologue, &ZETValidationEntryPoints::zetDebugWriteRegistersPrologue);
+        addIfOverridden(zetDebugWriteRegistersEpilogue, checker, &T::zetDebugWriteRegistersEpilogue, &ZETValidationEntryPoints::zetDebugWriteRegistersEpilogue);
+        addIfOverridden(zetMetricGroupGetPrologue, checker, &T::zetMetricGroupGetPrologue, &ZETValidationEntryPoints::zetMetricGroupGetPrologue);
+        addIfOverridden(zetMetricGroupGetEpilogue, checker, &T::zetMetricGroupGetEpilogue, &ZETValidationEntryPoints::zetMetricGroupGetEpilogue);
+        addIfOverridden(zetMetricGroupGetPropertiesPrologue, checker, &T::zetMetricGroupGetPropertiesPrologue, &ZETValidationEntryPoints::zetMetricGroupGetPropertiesPrologue);
+        addIfOverridden(zetMetricGroupGetPropertiesEpilogue, checker, &T::zetMetricGroupGetPropertiesEpilogue, &ZETValidationEntryPoints::zetMetricGroupGetPropertiesEpilogue);
+        addIfOverridden(zetMetricGroupCalculateMetricValuesPrologue, checker, &T::zetMetricGroupCalculateMetricValuesPrologue, &ZETValidationEntryPoints::zetMetricGroupCalculateMetricValuesPrologue);
+        addIfOverridden(zetMetricGroupCalculateMetricValuesEpilogue, checker, &T::zetMetricGroupCalculateMetricValuesEpilogue, &ZETValidationEntryPoints::zetMetricGroupCalculateMetricValuesEpilogue);
+        addIfOverridden(zetMetricGetPrologue, checker, &T::zetMetricGetPrologue, &ZETValidationEntryPoints::zetMetricGetPrologue);
+        addIfOverridden(zetMetricGetEpilogue, checker, &T::zetMetricGetEpilogue, &ZETValidationEntryPoints::zetMetricGetEpilogue);
+        addIfOverridden(zetMetricGetPropertiesPrologue, checker, &T::zetMetricGetPropertiesPrologue, &ZETValidationEntryPoints::zetMetricGetPropertiesPrologue);
+        addIfOverridden(zetMetricGetPropertiesEpilogue, checker, &T::zetMetricGetPropertiesEpilogue, &ZETValidationEntryPoints::zetMetricGetPropertiesEpilogue);
+        addIfOverridden(zetContextActivateMetricGroupsPrologue, checker, &T::zetContextActivateMetricGroupsPrologue, &ZETValidationEntryPoints::zetContextActivateMetricGroupsPrologue);
+        addIfOverridden(zetContextActivateMetricGroupsEpilogue, checker, &T::zetContextActivateMetricGroupsEpilogue, &ZETValidationEntryPoints::zetContextActivateMetricGroupsEpilogue);
+        addIfOverridden(zetMetricStreamerOpenPrologue, checker, &T::zetMetricStreamerOpenPrologue, &ZETValidationEntryPoints::zetMetricStreamerOpenPrologue);
+        addIfOverridden(zetMetricStreamerOpenEpilogue, checker, &T::zetMetricStreamerOpenEpilogue, &ZETValidationEntryPoints::zetMetricStreamerOpenEpilogue);
+        addIfOverridden(zetCommandListAppendMetricStreamerMarkerPrologue, checker, &T::zetCommandListAppendMetricStreamerMarkerPrologue, &ZETValidationEntryPoints::zetCommandListAppendMetricStreamerMarkerPrologue);
+        addIfOverridden(zetCommandListAppendMetricStreamerMarkerEpilogue, checker, &T::zetCommandListAppendMetricStreamerMarkerEpilogue, &ZETValidationEntryPoints::zetCommandListAppendMetricStreamerMarkerEpilogue);
+        addIfOverridden(zetMetricStreamerClosePrologue, checker, &T::zetMetricStreamerClosePrologue, &ZETValidationEntryPoints::zetMetricStreamerClosePrologue);
+        addIfOverridden(zetMetricStreamerCloseEpilogue, checker, &T::zetMetricStreamerCloseEpilogue, &ZETValidationEntryPoints::zetMetricStreamerCloseEpilogue);
+        addIfOverridden(zetMetricStreamerReadDataPrologue, checker, &T::zetMetricStreamerReadDataPrologue, &ZETValidationEntryPoints::zetMetricStreamerReadDataPrologue);
+        addIfOverridden(zetMetricStreamerReadDataEpilogue, checker, &T::zetMetricStreamerReadDataEpilogue, &ZETValidationEntryPoints::zetMetricStreamerReadDataEpilogue);
+        addIfOverridden(zetMetricQueryPoolCreatePrologue, checker, &T::zetMetricQueryPoolCreatePrologue, &ZETValidationEntryPoints::zetMetricQueryPoolCreatePrologue);
+        addIfOverridden(zetMetricQueryPoolCreateEpilogue, checker, &T::zetMetricQueryPoolCreateEpilogue, &ZETValidationEntryPoints::zetMetricQueryPoolCreateEpilogue);
+        addIfOverridden(zetMetricQueryPoolDestroyPrologue, checker, &T::zetMetricQueryPoolDestroyPrologue, &ZETValidationEntryPoints::zetMetricQueryPoolDestroyPrologue);
+        addIfOverridden(zetMetricQueryPoolDestroyEpilogue, checker, &T::zetMetricQueryPoolDestroyEpilogue, &ZETValidationEntryPoints::zetMetricQueryPoolDestroyEpilogue);
+        addIfOverridden(zetMetricQueryCreatePrologue, checker, &T::zetMetricQueryCreatePrologue, &ZETValidationEntryPoints::zetMetricQueryCreatePrologue);
+        addIfOverridden(zetMetricQueryCreateEpilogue, checker, &T::zetMetricQueryCreateEpilogue, &ZETValidationEntryPoints::zetMetricQueryCreateEpilogue);
+        addIfOverridden(zetMetricQueryDestroyPrologue, checker, &T::zetMetricQueryDestroyPrologue, &ZETValidationEntryPoints::zetMetricQueryDestroyPrologue);
+        addIfOverridden(zetMetricQueryDestroyEpilogue, checker, &T::zetMetricQueryDestroyEpilogue, &ZETValidationEntryPoints::zetMetricQueryDestroyEpilogue);
+        addIfOverridden(zetMetricQueryResetPrologue, checker, &T::zetMetricQueryResetPrologue, &ZETValidationEntryPoints::zetMetricQueryResetPrologue);
+        addIfOverridden(zetMetricQueryResetEpilogue, checker, &T::zetMetricQueryResetEpilogue, &ZETValidationEntryPoints::zetMetricQueryResetEpilogue);
+        addIfOverridden(zetCommandListAppendMetricQueryBeginPrologue, checker, &T::zetCommandListAppendMetricQueryBeginPrologue, &ZETValidationEntryPoints::zetCommandListAppendMetricQueryBeginPrologue);
+        addIfOverridden(zetCommandListAppendMetricQueryBeginEpilogue, checker, &T::zetCommandListAppendMetricQueryBeginEpilogue, &ZETValidationEntryPoints::zetCommandListAppendMetricQueryBeginEpilogue);
+        addIfOverridden(zetCommandListAppendMetricQueryEndPrologue, checker, &T::zetCommandListAppendMetricQueryEndPrologue, &ZETValidationEntryPoints::zetCommandListAppendMetricQueryEndPrologue);
+        addIfOverridden(zetCommandListAppendMetricQueryEndEpilogue, checker, &T::zetCommandListAppendMetricQueryEndEpilogue, &ZETValidationEntryPoints::zetCommandListAppendMetricQueryEndEpilogue);
+        addIfOverridden(zetCommandListAppendMetricMemoryBarrierPrologue, checker, &T::zetCommandListAppendMetricMemoryBarrierPrologue, &ZETValidationEntryPoints::zetCommandListAppendMetricMemoryBarrierPrologue);
+        addIfOverridden(zetCommandListAppendMetricMemoryBarrierEpilogue, checker, &T::zetCommandListAppendMetricMemoryBarrierEpilogue, &ZETValidationEntryPoints::zetCommandListAppendMetricMemoryBarrierEpilogue);
+        addIfOverridden(zetMetricQueryGetDataPrologue, checker, &T::zetMetricQueryGetDataPrologue, &ZETValidationEntryPoints::zetMetricQueryGetDataPrologue);
+        addIfOverridden(zetMetricQueryGetDataEpilogue, checker, &T::zetMetricQueryGetDataEpilogue, &ZETValidationEntryPoints::zetMetricQueryGetDataEpilogue);
+        addIfOverridden(zetKernelGetProfileInfoPrologue, checker, &T::zetKernelGetProfileInfoPrologue, &ZETValidationEntryPoints::zetKernelGetProfileInfoPrologue);
+        addIfOverridden(zetKernelGetProfileInfoEpilogue, checker, &T::zetKernelGetProfileInfoEpilogue, &ZETValidationEntryPoints::zetKernelGetProfileInfoEpilogue);
+        addIfOverridden(zetTracerExpCreatePrologue, checker, &T::zetTracerExpCreatePrologue, &ZETValidationEntryPoints::zetTracerExpCreatePrologue);
+        addIfOverridden(zetTracerExpCreateEpilogue, checker, &T::zetTracerExpCreateEpilogue, &ZETValidationEntryPoints::zetTracerExpCreateEpilogue);
+        addIfOverridden(zetTracerExpDestroyPrologue, checker, &T::zetTracerExpDestroyPrologue, &ZETValidationEntryPoints::zetTracerExpDestroyPrologue);
+        addIfOverridden(zetTracerExpDestroyEpilogue, checker, &T::zetTracerExpDestroyEpilogue, &ZETValidationEntryPoints::zetTracerExpDestroyEpilogue);
+        addIfOverridden(zetTracerExpSetProloguesPrologue, checker, &T::zetTracerExpSetProloguesPrologue, &ZETValidationEntryPoints::zetTracerExpSetProloguesPrologue);
+        addIfOverridden(zetTracerExpSetProloguesEpilogue, checker, &T::zetTracerExpSetProloguesEpilogue, &ZETValidationEntryPoints::zetTracerExpSetProloguesEpilogue);
+        addIfOverridden(zetTracerExpSetEpiloguesPrologue, checker, &T::zetTracerExpSetEpiloguesPrologue, &ZETValidationEntryPoints::zetTracerExpSetEpiloguesPrologue);
+        addIfOverridden(zetTracerExpSetEpiloguesEpilogue, checker, &T::zetTracerExpSetEpiloguesEpilogue, &ZETValidationEntryPoints::zetTracerExpSetEpiloguesEpilogue);
+        addIfOverridden(zetTracerExpSetEnabledPrologue, checker, &T::zetTracerExpSetEnabledPrologue, &ZETValidationEntryPoints::zetTracerExpSetEnabledPrologue);
+        addIfOverridden(zetTracerExpSetEnabledEpilogue, checker, &T::zetTracerExpSetEnabledEpilogue, &ZETValidationEntryPoints::zetTracerExpSetEnabledEpilogue);
+        addIfOverridden(zetMetricGroupCalculateMultipleMetricValuesExpPrologue, checker, &T::zetMetricGroupCalculateMultipleMetricValuesExpPrologue, &ZETValidationEntryPoints::zetMetricGroupCalculateMultipleMetricValuesExpPrologue);
+        addIfOverridden(zetMetricGroupCalculateMultipleMetricValuesExpEpilogue, checker, &T::zetMetricGroupCalculateMultipleMetricValuesExpEpilogue, &ZETValidationEntryPoints::zetMetricGroupCalculateMultipleMetricValuesExpEpilogue);
+        addIfOverridden(zetMetricGroupGetGlobalTimestampsExpPrologue, checker, &T::zetMetricGroupGetGlobalTimestampsExpPrologue, &ZETValidationEntryPoints::zetMetricGroupGetGlobalTimestampsExpPrologue);
+        addIfOverridden(zetMetricGroupGetGlobalTimestampsExpEpilogue, checker, &T::zetMetricGroupGetGlobalTimestampsExpEpilogue, &ZETValidationEntryPoints::zetMetricGroupGetGlobalTimestampsExpEpilogue);
+        addIfOverridden(zetMetricGroupGetExportDataExpPrologue, checker, &T::zetMetricGroupGetExportDataExpPrologue, &ZETValidationEntryPoints::zetMetricGroupGetExportDataExpPrologue);
+        addIfOverridden(zetMetricGroupGetExportDataExpEpilogue, checker, &T::zetMetricGroupGetExportDataExpEpilogue, &ZETValidationEntryPoints::zetMetricGroupGetExportDataExpEpilogue);
+        addIfOverridden(zetMetricGroupCalculateMetricExportDataExpPrologue, checker, &T::zetMetricGroupCalculateMetricExportDataExpPrologue, &ZETValidationEntryPoints::zetMetricGroupCalculateMetricExportDataExpPrologue);
+        addIfOverridden(zetMetricGroupCalculateMetricExportDataExpEpilogue, checker, &T::zetMetricGroupCalculateMetricExportDataExpEpilogue, &ZETValidationEntryPoints::zetMetricGroupCalculateMetricExportDataExpEpilogue);
+        addIfOverridden(zetMetricProgrammableGetExpPrologue, checker, &T::zetMetricProgrammableGetExpPrologue, &ZETValidationEntryPoints::zetMetricProgrammableGetExpPrologue);
+        addIfOverridden(zetMetricProgrammableGetExpEpilogue, checker, &T::zetMetricProgrammableGetExpEpilogue, &ZETValidationEntryPoints::zetMetricProgrammableGetExpEpilogue);
+        addIfOverridden(zetMetricProgrammableGetPropertiesExpPrologue, checker, &T::zetMetricProgrammableGetPropertiesExpPrologue, &ZETValidationEntryPoints::zetMetricProgrammableGetPropertiesExpPrologue);
+        addIfOverridden(zetMetricProgrammableGetPropertiesExpEpilogue, checker, &T::zetMetricProgrammableGetPropertiesExpEpilogue, &ZETValidationEntryPoints::zetMetricProgrammableGetPropertiesExpEpilogue);
+        addIfOverridden(zetMetricProgrammableGetParamInfoExpPrologue, checker, &T::zetMetricProgrammableGetParamInfoExpPrologue, &ZETValidationEntryPoints::zetMetricProgrammableGetParamInfoExpPrologue);
+        addIfOverridden(zetMetricProgrammableGetParamInfoExpEpilogue, checker, &T::zetMetricProgrammableGetParamInfoExpEpilogue, &ZETValidationEntryPoints::zetMetricProgrammableGetParamInfoExpEpilogue);
+        addIfOverridden(zetMetricProgrammableGetParamValueInfoExpPrologue, checker, &T::zetMetricProgrammableGetParamValueInfoExpPrologue, &ZETValidationEntryPoints::zetMetricProgrammableGetParamValueInfoExpPrologue);
+        addIfOverridden(zetMetricProgrammableGetParamValueInfoExpEpilogue, checker, &T::zetMetricProgrammableGetParamValueInfoExpEpilogue, &ZETValidationEntryPoints::zetMetricProgrammableGetParamValueInfoExpEpilogue);
+        addIfOverridden(zetMetricCreateFromProgrammableExp2Prologue, checker, &T::zetMetricCreateFromProgrammableExp2Prologue, &ZETValidationEntryPoints::zetMetricCreateFromProgrammableExp2Prologue);
+        addIfOverridden(zetMetricCreateFromProgrammableExp2Epilogue, checker, &T::zetMetricCreateFromProgrammableExp2Epilogue, &ZETValidationEntryPoints::zetMetricCreateFromProgrammableExp2Epilogue);
+        addIfOverridden(zetMetricCreateFromProgrammableExpPrologue, checker, &T::zetMetricCreateFromProgrammableExpPrologue, &ZETValidationEntryPoints::zetMetricCreateFromProgrammableExpPrologue);
+        addIfOverridden(zetMetricCreateFromProgrammableExpEpilogue, checker, &T::zetMetricCreateFromProgrammableExpEpilogue, &ZETValidationEntryPoints::zetMetricCreateFromProgrammableExpEpilogue);
+        addIfOverridden(zetDeviceCreateMetricGroupsFromMetricsExpPrologue, checker, &T::zetDeviceCreateMetricGroupsFromMetricsExpPrologue, &ZETValidationEntryPoints::zetDeviceCreateMetricGroupsFromMetricsExpPrologue);
+        addIfOverridden(zetDeviceCreateMetricGroupsFromMetricsExpEpilogue, checker, &T::zetDeviceCreateMetricGroupsFromMetricsExpEpilogue, &ZETValidationEntryPoints::zetDeviceCreateMetricGroupsFromMetricsExpEpilogue);
+        addIfOverridden(zetMetricGroupCreateExpPrologue, checker, &T::zetMetricGroupCreateExpPrologue, &ZETValidationEntryPoints::zetMetricGroupCreateExpPrologue);
+        addIfOverridden(zetMetricGroupCreateExpEpilogue, checker, &T::zetMetricGroupCreateExpEpilogue, &ZETValidationEntryPoints::zetMetricGroupCreateExpEpilogue);
+        addIfOverridden(zetMetricGroupAddMetricExpPrologue, checker, &T::zetMetricGroupAddMetricExpPrologue, &ZETValidationEntryPoints::zetMetricGroupAddMetricExpPrologue);
+        addIfOverridden(zetMetricGroupAddMetricExpEpilogue, checker, &T::zetMetricGroupAddMetricExpEpilogue, &ZETValidationEntryPoints::zetMetricGroupAddMetricExpEpilogue);
+        addIfOverridden(zetMetricGroupRemoveMetricExpPrologue, checker, &T::zetMetricGroupRemoveMetricExpPrologue, &ZETValidationEntryPoints::zetMetricGroupRemoveMetricExpPrologue);
+        addIfOverridden(zetMetricGroupRemoveMetricExpEpilogue, checker, &T::zetMetricGroupRemoveMetricExpEpilogue, &ZETValidationEntryPoints::zetMetricGroupRemoveMetricExpEpilogue);
+        addIfOverridden(zetMetricGroupCloseExpPrologue, checker, &T::zetMetricGroupCloseExpPrologue, &ZETValidationEntryPoints::zetMetricGroupCloseExpPrologue);
+        addIfOverridden(zetMetricGroupCloseExpEpilogue, checker, &T::zetMetricGroupCloseExpEpilogue, &ZETValidationEntryPoints::zetMetricGroupCloseExpEpilogue);
+        addIfOverridden(zetMetricGroupDestroyExpPrologue, checker, &T::zetMetricGroupDestroyExpPrologue, &ZETValidationEntryPoints::zetMetricGroupDestroyExpPrologue);
+        addIfOverridden(zetMetricGroupDestroyExpEpilogue, checker, &T::zetMetricGroupDestroyExpEpilogue, &ZETValidationEntryPoints::zetMetricGroupDestroyExpEpilogue);
+        addIfOverridden(zetMetricDestroyExpPrologue, checker, &T::zetMetricDestroyExpPrologue, &ZETValidationEntryPoints::zetMetricDestroyExpPrologue);
+        addIfOverridden(zetMetricDestroyExpEpilogue, checker, &T::zetMetricDestroyExpEpilogue, &ZETValidationEntryPoints::zetMetricDestroyExpEpilogue);
+        addIfOverridden(zetDeviceGetConcurrentMetricGroupsExpPrologue, checker, &T::zetDeviceGetConcurrentMetricGroupsExpPrologue, &ZETValidationEntryPoints::zetDeviceGetConcurrentMetricGroupsExpPrologue);
+        addIfOverridden(zetDeviceGetConcurrentMetricGroupsExpEpilogue, checker, &T::zetDeviceGetConcurrentMetricGroupsExpEpilogue, &ZETValidationEntryPoints::zetDeviceGetConcurrentMetricGroupsExpEpilogue);
+        addIfOverridden(zetMetricTracerCreateExpPrologue, checker, &T::zetMetricTracerCreateExpPrologue, &ZETValidationEntryPoints::zetMetricTracerCreateExpPrologue);
+        addIfOverridden(zetMetricTracerCreateExpEpilogue, checker, &T::zetMetricTracerCreateExpEpilogue, &ZETValidationEntryPoints::zetMetricTracerCreateExpEpilogue);
+        addIfOverridden(zetMetricTracerDestroyExpPrologue, checker, &T::zetMetricTracerDestroyExpPrologue, &ZETValidationEntryPoints::zetMetricTracerDestroyExpPrologue);
+        addIfOverridden(zetMetricTracerDestroyExpEpilogue, checker, &T::zetMetricTracerDestroyExpEpilogue, &ZETValidationEntryPoints::zetMetricTracerDestroyExpEpilogue);
+        addIfOverridden(zetMetricTracerEnableExpPrologue, checker, &T::zetMetricTracerEnableExpPrologue, &ZETValidationEntryPoints::zetMetricTracerEnableExpPrologue);
+        addIfOverridden(zetMetricTracerEnableExpEpilogue, checker, &T::zetMetricTracerEnableExpEpilogue, &ZETValidationEntryPoints::zetMetricTracerEnableExpEpilogue);
+        addIfOverridden(zetMetricTracerDisableExpPrologue, checker, &T::zetMetricTracerDisableExpPrologue, &ZETValidationEntryPoints::zetMetricTracerDisableExpPrologue);
+        addIfOverridden(zetMetricTracerDisableExpEpilogue, checker, &T::zetMetricTracerDisableExpEpilogue, &ZETValidationEntryPoints::zetMetricTracerDisableExpEpilogue);
+        addIfOverridden(zetMetricTracerReadDataExpPrologue, checker, &T::zetMetricTracerReadDataExpPrologue, &ZETValidationEntryPoints::zetMetricTracerReadDataExpPrologue);
+        addIfOverridden(zetMetricTracerReadDataExpEpilogue, checker, &T::zetMetricTracerReadDataExpEpilogue, &ZETValidationEntryPoints::zetMetricTracerReadDataExpEpilogue);
+        addIfOverridden(zetMetricDecoderCreateExpPrologue, checker, &T::zetMetricDecoderCreateExpPrologue, &ZETValidationEntryPoints::zetMetricDecoderCreateExpPrologue);
+        addIfOverridden(zetMetricDecoderCreateExpEpilogue, checker, &T::zetMetricDecoderCreateExpEpilogue, &ZETValidationEntryPoints::zetMetricDecoderCreateExpEpilogue);
+        addIfOverridden(zetMetricDecoderDestroyExpPrologue, checker, &T::zetMetricDecoderDestroyExpPrologue, &ZETValidationEntryPoints::zetMetricDecoderDestroyExpPrologue);
+        addIfOverridden(zetMetricDecoderDestroyExpEpilogue, checker, &T::zetMetricDecoderDestroyExpEpilogue, &ZETValidationEntryPoints::zetMetricDecoderDestroyExpEpilogue);
+        addIfOverridden(zetMetricDecoderGetDecodableMetricsExpPrologue, checker, &T::zetMetricDecoderGetDecodableMetricsExpPrologue, &ZETValidationEntryPoints::zetMetricDecoderGetDecodableMetricsExpPrologue);
+        addIfOverridden(zetMetricDecoderGetDecodableMetricsExpEpilogue, checker, &T::zetMetricDecoderGetDecodableMetricsExpEpilogue, &ZETValidationEntryPoints::zetMetricDecoderGetDecodableMetricsExpEpilogue);
+        addIfOverridden(zetMetricTracerDecodeExpPrologue, checker, &T::zetMetricTracerDecodeExpPrologue, &ZETValidationEntryPoints::zetMetricTracerDecodeExpPrologue);
+        addIfOverridden(zetMetricTracerDecodeExpEpilogue, checker, &T::zetMetricTracerDecodeExpEpilogue, &ZETValidationEntryPoints::zetMetricTracerDecodeExpEpilogue);
+        addIfOverridden(zetCommandListAppendMarkerExpPrologue, checker, &T::zetCommandListAppendMarkerExpPrologue, &ZETValidationEntryPoints::zetCommandListAppendMarkerExpPrologue);
+        addIfOverridden(zetCommandListAppendMarkerExpEpilogue, checker, &T::zetCommandListAppendMarkerExpEpilogue, &ZETValidationEntryPoints::zetCommandListAppendMarkerExpEpilogue);
+        addIfOverridden(zetDeviceEnableMetricsExpPrologue, checker, &T::zetDeviceEnableMetricsExpPrologue, &ZETValidationEntryPoints::zetDeviceEnableMetricsExpPrologue);
+        addIfOverridden(zetDeviceEnableMetricsExpEpilogue, checker, &T::zetDeviceEnableMetricsExpEpilogue, &ZETValidationEntryPoints::zetDeviceEnableMetricsExpEpilogue);
+        addIfOverridden(zetDeviceDisableMetricsExpPrologue, checker, &T::zetDeviceDisableMetricsExpPrologue, &ZETValidationEntryPoints::zetDeviceDisableMetricsExpPrologue);
+        addIfOverridden(zetDeviceDisableMetricsExpEpilogue, checker, &T::zetDeviceDisableMetricsExpEpilogue, &ZETValidationEntryPoints::zetDeviceDisableMetricsExpEpilogue);
+    }
+
+private:
+    template <class Derived, class Base>
+    static void addIfOverridden(std::vector<ZETValidationEntryPoints *> &checkers, ZETValidationEntryPoints *checker, Derived, Base) {
+        if (!std::is_same<Derived, Base>::value)
+            checkers.push_back(checker);
+    }
+};
 }
\ No newline at end of file
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2025 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,21 +7,23 @@
 
 #pragma once
 
+#include "handle_registry.h"
 #include "ze_handle_lifetime.h"
 #include "zes_handle_lifetime.h"
 #include "zet_handle_lifetime.h"
 #include "zer_handle_lifetime.h"
-#include <memory>
-#include <type_traits>
+#include <atomic>
+#include <cstdio>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 
 namespace validation_layer {
 
-typedef struct _zel_handle_state_t {
-  bool is_open;
-} zel_handle_state_t;
-
+// Live handles of every type are kept in one HandleRegistry keyed by
+// (handle, HandleKind), so isHandleValid() on the hot validation path is a
+// lock-free probe and application threads creating or destroying objects
+// only contend when they hit the same registry shard.
 class HandleLifetimeValidation {
 public:
   ZEHandleLifetimeValidation zeHandleLifetime;
@@ -33,479 +35,451 @@ public:
   template <class T> void addHandle(T handle) {
     // TODO : Log warning
     untrackedHandles++;
-    defaultHandleStateMap.insert({static_cast<void *>(handle), nullptr});
+    registry.insert(static_cast<void *>(handle), HandleKind::Default);
   }
 
   template <class T> void removeHandle(T handle) {
     // TODO: Log warning
     untrackedHandles--;
-    defaultHandleStateMap.erase(static_cast<void *>(handle));
+    registry.erase(static_cast<void *>(handle), HandleKind::Default);
   }
 
   template <class T> bool isHandleValid(T handle) {
-    return defaultHandleStateMap.find(static_cast<void *>(handle)) !=
-           defaultHandleStateMap.end();
-  }
-
-  template <class S, class T> S get_handle_map(T handle) {
-    if (std::is_same<T, ze_context_handle_t>::value) {
-      return contextHandleStateMap;
-    } else if (std::is_same<T, ze_driver_handle_t>::value) {
-      return driverHandleStateMap;
-    } else {
-      return defaultHandleStateMap;
-    }
+    return registry.contains(static_cast<void *>(handle), HandleKind::Default);
   }
 
   void addHandle(ze_context_handle_t handle) {
-    contextHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::Context);
   }
   void addHandle(ze_driver_handle_t handle) {
-    driverHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::Driver);
   }
   void addHandle(ze_device_handle_t handle) {
-    deviceHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::Device);
   }
   void addHandle(ze_command_queue_handle_t handle) {
-    commandQueueHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::CommandQueue);
   }
   void addHandle(ze_command_list_handle_t handle, bool is_open = true) {
-    commandListHandleStateMap.insert(
-        {handle, std::make_unique<zel_handle_state_t>()});
-    commandListHandleStateMap[handle]->is_open = is_open;
+    registry.insertOrAssign(handle, HandleKind::CommandList,
+                            is_open ? HandleStateOpen : 0);
   }
   void addHandle(ze_fence_handle_t handle) {
-    fenceHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::Fence);
   }
   void addHandle(ze_event_pool_handle_t handle) {
-    eventPoolHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::EventPool);
   }
   void addHandle(ze_event_handle_t handle) {
-    eventHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::Event);
   }
   void addHandle(ze_image_handle_t handle) {
-    imageHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::Image);
   }
   void addHandle(ze_module_handle_t handle) {
-    moduleHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::Module);
   }
   void addHandle(ze_module_build_log_handle_t handle) {
-    moduleBuildLogHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::ModuleBuildLog);
   }
   void addHandle(ze_kernel_handle_t handle) {
-    kernelHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::Kernel);
   }
   void addHandle(ze_sampler_handle_t handle) {
-    samplerHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::Sampler);
   }
   void addHandle(ze_fabric_vertex_handle_t handle) {
-    fabricVertexHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::FabricVertex);
   }
   void addHandle(ze_fabric_edge_handle_t handle) {
-    fabricEdgeHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::FabricEdge);
   }
   void addHandle(ze_physical_mem_handle_t handle) {
-    physicalMemHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::PhysicalMem);
   }
   void addHandle(ze_ipc_event_pool_handle_t handle) {
-    ipcEventPoolHandleStateMap.insert({&handle, nullptr});
+    registry.insert(&handle, HandleKind::IpcEventPool);
   }
   void addHandle(ze_ipc_mem_handle_t handle) {
-    ipcMemHandleStateMap.insert({&handle, nullptr});
+    registry.insert(&handle, HandleKind::IpcMem);
   }
   void addHandle(ze_external_memory_import_win32_handle_t &handle) {
-    externalMemoryImportWin32HandleStateMap.insert({&handle, nullptr});
+    registry.insert(&handle, HandleKind::ExternalMemoryImportWin32);
   }
   void addHandle(ze_external_memory_export_win32_handle_t &handle) {
-    externalMemoryExportWin32HandleStateMap.insert({&handle, nullptr});
+    registry.insert(&handle, HandleKind::ExternalMemoryExportWin32);
   }
 
   void addHandle(zet_metric_group_handle_t handle) {
-    metricGroupHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::MetricGroup);
   }
   void addHandle(zet_metric_handle_t handle) {
-    metricHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::Metric);
   }
   void addHandle(zet_metric_streamer_handle_t handle) {
-    metricStreamerHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::MetricStreamer);
   }
   void addHandle(zet_metric_query_pool_handle_t handle) {
-    metricQueryPoolHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::MetricQueryPool);
   }
   void addHandle(zet_metric_query_handle_t handle) {
-    metricQueryHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::MetricQuery);
   }
   void addHandle(zet_tracer_exp_handle_t handle) {
-    tracerExpHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::TracerExp);
   }
   void addHandle(zet_debug_session_handle_t handle) {
-    debugSessionHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::DebugSession);
   }
 
   void addHandle(zes_sched_handle_t handle) {
-    schedHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::Sched);
   }
   void addHandle(zes_perf_handle_t handle) {
-    perfHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::Perf);
   }
   void addHandle(zes_pwr_handle_t handle) {
-    pwrHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::Pwr);
   }
   void addHandle(zes_freq_handle_t handle) {
-    freqHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::Freq);
   }
   void addHandle(zes_engine_handle_t handle) {
-    engineHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::Engine);
   }
   void addHandle(zes_standby_handle_t handle) {
-    standbyHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::Standby);
   }
   void addHandle(zes_firmware_handle_t handle) {
-    firmwareHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::Firmware);
   }
   void addHandle(zes_mem_handle_t handle) {
-    memHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::Mem);
   }
   void addHandle(zes_fabric_port_handle_t handle) {
-    fabricPortHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::FabricPort);
   }
   void addHandle(zes_temp_handle_t handle) {
-    tempHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::Temp);
   }
   void addHandle(zes_psu_handle_t handle) {
-    psuHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::Psu);
   }
   void addHandle(zes_fan_handle_t handle) {
-    fanHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::Fan);
   }
   void addHandle(zes_led_handle_t handle) {
-    ledHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::Led);
   }
   void addHandle(zes_ras_handle_t handle) {
-    rasHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::Ras);
   }
   void addHandle(zes_diag_handle_t handle) {
-    diagHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::Diag);
   }
   void addHandle(zes_overclock_handle_t handle) {
-    overclockHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::Overclock);
   }
+
   void addHandle(ze_rtas_parallel_operation_exp_handle_t handle) {
-    rtasParallelOperationHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::RtasParallelOperation);
   }
   void addHandle(ze_rtas_builder_exp_handle_t handle) {
-    rtasBuilderHandleStateMap.insert({handle, nullptr});
+    registry.insert(handle, HandleKind::RtasBuilder);
   }
 
   void removeHandle(ze_context_handle_t handle) {
-    contextHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::Context);
   }
   void removeHandle(ze_driver_handle_t handle) {
-    driverHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::Driver);
   }
   void removeHandle(ze_device_handle_t handle) {
-    deviceHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::Device);
   }
   void removeHandle(ze_command_queue_handle_t handle) {
-    commandQueueHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::CommandQueue);
   }
   void removeHandle(ze_command_list_handle_t handle) {
-    commandListHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::CommandList);
   }
   void removeHandle(ze_fence_handle_t handle) {
-    fenceHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::Fence);
   }
   void removeHandle(ze_event_pool_handle_t handle) {
-    eventPoolHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::EventPool);
   }
   void removeHandle(ze_event_handle_t handle) {
-    eventHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::Event);
   }
   void removeHandle(ze_image_handle_t handle) {
-    imageHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::Image);
   }
   void removeHandle(ze_module_handle_t handle) {
-    moduleHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::Module);
   }
   void removeHandle(ze_module_build_log_handle_t handle) {
-    moduleBuildLogHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::ModuleBuildLog);
   }
   void removeHandle(ze_kernel_handle_t handle) {
-    kernelHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::Kernel);
   }
   void removeHandle(ze_sampler_handle_t handle) {
-    samplerHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::Sampler);
   }
   void removeHandle(ze_physical_mem_handle_t handle) {
-    physicalMemHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::PhysicalMem);
   }
   void removeHandle(ze_fabric_vertex_handle_t handle) {
-    fabricVertexHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::FabricVertex);
   }
   void removeHandle(ze_fabric_edge_handle_t handle) {
-    fabricEdgeHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::FabricEdge);
   }
   void removeHandle(ze_ipc_mem_handle_t &handle) {
-    ipcMemHandleStateMap.erase(&handle);
+    registry.erase(&handle, HandleKind::IpcMem);
   }
   void removeHandle(ze_ipc_event_pool_handle_t &handle) {
-    ipcEventPoolHandleStateMap.erase(&handle);
+    registry.erase(&handle, HandleKind::IpcEventPool);
   }
   void removeHandle(ze_external_memory_export_win32_handle_t &handle) {
-    externalMemoryExportWin32HandleStateMap.erase(&handle);
+    registry.erase(&handle, HandleKind::ExternalMemoryExportWin32);
   }
   void removeHandle(ze_external_memory_import_win32_handle_t &handle) {
-    externalMemoryImportWin32HandleStateMap.erase(&handle);
+    registry.erase(&handle, HandleKind::ExternalMemoryImportWin32);
   }
 
   void removeHandle(zet_metric_group_handle_t handle) {
-    metricGroupHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::MetricGroup);
   }
   void removeHandle(zet_metric_handle_t handle) {
-    metricHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::Metric);
   }
   void removeHandle(zet_metric_streamer_handle_t handle) {
-    metricStreamerHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::MetricStreamer);
   }
   void removeHandle(zet_metric_query_pool_handle_t handle) {
-    metricQueryPoolHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::MetricQueryPool);
   }
   void removeHandle(zet_metric_query_handle_t handle) {
-    metricQueryHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::MetricQuery);
   }
   void removeHandle(zet_tracer_exp_handle_t handle) {
-    tracerExpHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::TracerExp);
   }
   void removeHandle(zet_debug_session_handle_t handle) {
-    debugSessionHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::DebugSession);
   }
 
   void removeHandle(zes_sched_handle_t handle) {
-    schedHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::Sched);
   }
   void removeHandle(zes_perf_handle_t handle) {
-    perfHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::Perf);
   }
   void removeHandle(zes_pwr_handle_t handle) {
-    pwrHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::Pwr);
   }
   void removeHandle(zes_freq_handle_t handle) {
-    freqHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::Freq);
   }
   void removeHandle(zes_engine_handle_t handle) {
-    engineHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::Engine);
   }
   void removeHandle(zes_standby_handle_t handle) {
-    standbyHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::Standby);
   }
   void removeHandle(zes_firmware_handle_t handle) {
-    firmwareHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::Firmware);
   }
   void removeHandle(zes_mem_handle_t handle) {
-    memHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::Mem);
   }
   void removeHandle(zes_fabric_port_handle_t handle) {
-    fabricPortHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::FabricPort);
   }
   void removeHandle(zes_temp_handle_t handle) {
-    tempHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::Temp);
   }
   void removeHandle(zes_psu_handle_t handle) {
-    psuHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::Psu);
   }
   void removeHandle(zes_fan_handle_t handle) {
-    fanHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::Fan);
   }
   void removeHandle(zes_led_handle_t handle) {
-    ledHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::Led);
   }
   void removeHandle(zes_ras_handle_t handle) {
-    rasHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::Ras);
   }
   void removeHandle(zes_diag_handle_t handle) {
-    diagHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::Diag);
   }
   void removeHandle(zes_overclock_handle_t handle) {
-    overclockHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::Overclock);
   }
+
   void removeHandle(ze_rtas_parallel_operation_exp_handle_t handle) {
-    rtasParallelOperationHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::RtasParallelOperation);
   }
   void removeHandle(ze_rtas_builder_exp_handle_t handle) {
-    rtasBuilderHandleStateMap.erase(handle);
+    registry.erase(handle, HandleKind::RtasBuilder);
   }
 
   bool isHandleValid(ze_context_handle_t handle) {
-    return contextHandleStateMap.find(handle) != contextHandleStateMap.end();
+    return registry.contains(handle, HandleKind::Context);
   }
   bool isHandleValid(ze_driver_handle_t handle) {
-    return driverHandleStateMap.find(handle) != driverHandleStateMap.end();
+    return registry.contains(handle, HandleKind::Driver);
   }
   bool isHandleValid(ze_device_handle_t handle) {
-    return deviceHandleStateMap.find(handle) != deviceHandleStateMap.end();
+    return registry.contains(handle, HandleKind::Device);
   }
   bool isHandleValid(ze_command_queue_handle_t handle) {
-    return commandQueueHandleStateMap.find(handle) !=
-           commandQueueHandleStateMap.end();
+    return registry.contains(handle, HandleKind::CommandQueue);
   }
   bool isHandleValid(ze_command_list_handle_t handle) {
-    return commandListHandleStateMap.find(handle) !=
-           commandListHandleStateMap.end();
+    return registry.contains(handle, HandleKind::CommandList);
   }
   bool isHandleValid(ze_fence_handle_t handle) {
-    return fenceHandleStateMap.find(handle) != fenceHandleStateMap.end();
+    return registry.contains(handle, HandleKind::Fence);
   }
   bool isHandleValid(ze_event_pool_handle_t handle) {
-    return eventPoolHandleStateMap.find(handle) !=
-           eventPoolHandleStateMap.end();
+    return registry.contains(handle, HandleKind::EventPool);
   }
   bool isHandleValid(ze_event_handle_t handle) {
-    return eventHandleStateMap.find(handle) != eventHandleStateMap.end();
+    return registry.contains(handle, HandleKind::Event);
   }
   bool isHandleValid(ze_image_handle_t handle) {
-    return imageHandleStateMap.find(handle) != imageHandleStateMap.end();
+    return registry.contains(handle, HandleKind::Image);
   }
   bool isHandleValid(ze_module_handle_t handle) {
-    return moduleHandleStateMap.find(handle) != moduleHandleStateMap.end();
+    return registry.contains(handle, HandleKind::Module);
   }
   bool isHandleValid(ze_module_build_log_handle_t handle) {
-    return moduleBuildLogHandleStateMap.find(handle) !=
-           moduleBuildLogHandleStateMap.end();
+    return registry.contains(handle, HandleKind::ModuleBuildLog);
   }
   bool isHandleValid(ze_kernel_handle_t handle) {
-    return kernelHandleStateMap.find(handle) != kernelHandleStateMap.end();
+    return registry.contains(handle, HandleKind::Kernel);
   }
   bool isHandleValid(ze_sampler_handle_t handle) {
-    return samplerHandleStateMap.find(handle) != samplerHandleStateMap.end();
+    return registry.contains(handle, HandleKind::Sampler);
   }
   bool isHandleValid(ze_physical_mem_handle_t handle) {
-    return physicalMemHandleStateMap.find(handle) !=
-           physicalMemHandleStateMap.end();
+    return registry.contains(handle, HandleKind::PhysicalMem);
   }
   bool isHandleValid(ze_fabric_vertex_handle_t handle) {
-    return fabricVertexHandleStateMap.find(handle) !=
-           fabricVertexHandleStateMap.end();
+    return registry.contains(handle, HandleKind::FabricVertex);
   }
   bool isHandleValid(ze_fabric_edge_handle_t handle) {
-    return fabricEdgeHandleStateMap.find(handle) !=
-           fabricEdgeHandleStateMap.end();
+    return registry.contains(handle, HandleKind::FabricEdge);
   }
   bool isHandleValid(ze_ipc_mem_handle_t &handle) {
-    return ipcMemHandleStateMap.find(&handle) != ipcMemHandleStateMap.end();
+    return registry.contains(&handle, HandleKind::IpcMem);
   }
   bool isHandleValid(ze_ipc_event_pool_handle_t &handle) {
-    return ipcEventPoolHandleStateMap.find(&handle) !=
-           ipcEventPoolHandleStateMap.end();
+    return registry.contains(&handle, HandleKind::IpcEventPool);
   }
   bool isHandleValid(ze_external_memory_import_win32_handle_t &handle) {
-    return externalMemoryImportWin32HandleStateMap.find(&handle) !=
-           externalMemoryImportWin32HandleStateMap.end();
+    return registry.contains(&handle, HandleKind::ExternalMemoryImportWin32);
   }
   bool isHandleValid(ze_external_memory_export_win32_handle_t &handle) {
-    return externalMemoryExportWin32HandleStateMap.find(&handle) !=
-           externalMemoryExportWin32HandleStateMap.end();
+    return registry.contains(&handle, HandleKind::ExternalMemoryExportWin32);
   }
 
   bool isHandleValid(zet_metric_group_handle_t handle) {
-    return metricGroupHandleStateMap.find(handle) !=
-           metricGroupHandleStateMap.end();
+    return registry.contains(handle, HandleKind::MetricGroup);
   }
   bool isHandleValid(zet_metric_handle_t handle) {
-    return metricHandleStateMap.find(handle) != metricHandleStateMap.end();
+    return registry.contains(handle, HandleKind::Metric);
   }
   bool isHandleValid(zet_metric_streamer_handle_t handle) {
-    return metricStreamerHandleStateMap.find(handle) !=
-           metricStreamerHandleStateMap.end();
+    return registry.contains(handle, HandleKind::MetricStreamer);
   }
   bool isHandleValid(zet_metric_query_pool_handle_t handle) {
-    return metricQueryPoolHandleStateMap.find(handle) !=
-           metricQueryPoolHandleStateMap.end();
+    return registry.contains(handle, HandleKind::MetricQueryPool);
   }
   bool isHandleValid(zet_metric_query_handle_t handle) {
-    return metricQueryHandleStateMap.find(handle) !=
-           metricQueryHandleStateMap.end();
+    return registry.contains(handle, HandleKind::MetricQuery);
   }
   bool isHandleValid(zet_tracer_exp_handle_t handle) {
-    return tracerExpHandleStateMap.find(handle) !=
-           tracerExpHandleStateMap.end();
+    return registry.contains(handle, HandleKind::TracerExp);
   }
   bool isHandleValid(zet_debug_session_handle_t handle) {
-    return debugSessionHandleStateMap.find(handle) !=
-           debugSessionHandleStateMap.end();
+    return registry.contains(handle, HandleKind::DebugSession);
   }
 
   bool isHandleValid(zes_sched_handle_t handle) {
-    return schedHandleStateMap.find(handle) != schedHandleStateMap.end();
+    return registry.contains(handle, HandleKind::Sched);
   }
   bool isHandleValid(zes_perf_handle_t handle) {
-    return perfHandleStateMap.find(handle) != perfHandleStateMap.end();
+    return registry.contains(handle, HandleKind::Perf);
   }
   bool isHandleValid(zes_pwr_handle_t handle) {
-    return pwrHandleStateMap.find(handle) != pwrHandleStateMap.end();
+    return registry.contains(handle, HandleKind::Pwr);
   }
   bool isHandleValid(zes_freq_handle_t handle) {
-    return freqHandleStateMap.find(handle) != freqHandleStateMap.end();
+    return registry.contains(handle, HandleKind::Freq);
   }
   bool isHandleValid(zes_engine_handle_t handle) {
-    return engineHandleStateMap.find(handle) != engineHandleStateMap.end();
+    return registry.contains(handle, HandleKind::Engine);
   }
   bool isHandleValid(zes_standby_handle_t handle) {
-    return standbyHandleStateMap.find(handle) != standbyHandleStateMap.end();
+    return registry.contains(handle, HandleKind::Standby);
   }
   bool isHandleValid(zes_firmware_handle_t handle) {
-    return firmwareHandleStateMap.find(handle) != firmwareHandleStateMap.end();
+    return registry.contains(handle, HandleKind::Firmware);
   }
   bool isHandleValid(zes_mem_handle_t handle) {
-    return memHandleStateMap.find(handle) != memHandleStateMap.end();
+    return registry.contains(handle, HandleKind::Mem);
   }
   bool isHandleValid(zes_fabric_port_handle_t handle) {
-    return fabricPortHandleStateMap.find(handle) !=
-           fabricPortHandleStateMap.end();
+    return registry.contains(handle, HandleKind::FabricPort);
   }
   bool isHandleValid(zes_temp_handle_t handle) {
-    return tempHandleStateMap.find(handle) != tempHandleStateMap.end();
+    return registry.contains(handle, HandleKind::Temp);
   }
   bool isHandleValid(zes_psu_handle_t handle) {
-    return psuHandleStateMap.find(handle) != psuHandleStateMap.end();
+    return registry.contains(handle, HandleKind::Psu);
   }
   bool isHandleValid(zes_fan_handle_t handle) {
-    return fanHandleStateMap.find(handle) != fanHandleStateMap.end();
+    return registry.contains(handle, HandleKind::Fan);
   }
   bool isHandleValid(zes_led_handle_t handle) {
-    return ledHandleStateMap.find(handle) != ledHandleStateMap.end();
+    return registry.contains(handle, HandleKind::Led);
   }
   bool isHandleValid(zes_ras_handle_t handle) {
-    return rasHandleStateMap.find(handle) != rasHandleStateMap.end();
+    return registry.contains(handle, HandleKind::Ras);
   }
   bool isHandleValid(zes_diag_handle_t handle) {
-    return diagHandleStateMap.find(handle) != diagHandleStateMap.end();
+    return registry.contains(handle, HandleKind::Diag);
   }
   bool isHandleValid(zes_overclock_handle_t handle) {
-    return overclockHandleStateMap.find(handle) !=
-           overclockHandleStateMap.end();
+    return registry.contains(handle, HandleKind::Overclock);
   }
 
   bool isHandleValid(ze_rtas_parallel_operation_exp_handle_t handle) {
-    return rtasParallelOperationHandleStateMap.find(handle) !=
-           rtasParallelOperationHandleStateMap.end();
+    return registry.contains(handle, HandleKind::RtasParallelOperation);
   }
-
   bool isHandleValid(ze_rtas_builder_exp_handle_t handle) {
-    return rtasBuilderHandleStateMap.find(handle) !=
-           rtasBuilderHandleStateMap.end();
+    return registry.contains(handle, HandleKind::RtasBuilder);
   }
 
   bool isOpen(ze_command_list_handle_t handle) {
-    return commandListHandleStateMap[handle]->is_open;
+    uint32_t state = 0;
+    return registry.find(handle, HandleKind::CommandList, state) &&
+           (state & HandleStateOpen);
   }
   void close(ze_command_list_handle_t handle) {
-    commandListHandleStateMap[handle]->is_open = false;
+    registry.setState(handle, HandleKind::CommandList, 0);
   }
   void reset(ze_command_list_handle_t handle) {
-    commandListHandleStateMap[handle]->is_open = true;
+    registry.setState(handle, HandleKind::CommandList, HandleStateOpen);
   }
 
   void printDependentMap() {
+    std::lock_guard<std::mutex> lock(dependentMutex);
 
     printf("\n--------------------------------------------\n");
     for (auto &handle : dependentMap) {
@@ -521,177 +495,70 @@ public:
 
   void addDependent(const void *handle, const void *dependent) {
     // No need to track driver dependents
-    for (auto &driverHandle : driverHandleStateMap){
-      if (handle == (void*)driverHandle.first){
-        return;
-      }
+    if (registry.contains(handle, HandleKind::Driver)) {
+      return;
     }
 
-    if (dependentMap.count(handle) == 0) {
-      dependentMap[handle] = std::unordered_set<const void *>();
-    }
+    std::lock_guard<std::mutex> lock(dependentMutex);
     dependentMap[handle].insert(dependent);
+    parentMap[dependent].insert(handle);
   }
 
   void removeDependent(const void *dependent) {
-    for (auto &handle : dependentMap) {
-      handle.second.erase(dependent);
+    std::lock_guard<std::mutex> lock(dependentMutex);
+    auto parents = parentMap.find(dependent);
+    if (parents == parentMap.end()) {
+      return;
+    }
+    for (auto parent : parents->second) {
+      auto dependents = dependentMap.find(parent);
+      if (dependents != dependentMap.end()) {
+        dependents->second.erase(dependent);
+        if (dependents->second.empty()) {
+          dependentMap.erase(dependents);
+        }
+      }
     }
+    parentMap.erase(parents);
   }
 
   void removeDependent(const void *handle, const void *dependent) {
-    if (dependentMap.count(handle) == 0) {
+    std::lock_guard<std::mutex> lock(dependentMutex);
+    auto dependents = dependentMap.find(handle);
+    if (dependents == dependentMap.end()) {
       return;
     }
-    dependentMap[handle].erase(dependent);
+    dependents->second.erase(dependent);
+    if (dependents->second.empty()) {
+      dependentMap.erase(dependents);
+    }
+    auto parents = parentMap.find(dependent);
+    if (parents != parentMap.end()) {
+      parents->second.erase(handle);
+      if (parents->second.empty()) {
+        parentMap.erase(parents);
+      }
+    }
   }
 
   bool hasDependents(const void *handle) {
-    return dependentMap.count(handle) && !dependentMap[handle].empty();
+    std::lock_guard<std::mutex> lock(dependentMutex);
+    auto dependents = dependentMap.find(handle);
+    return dependents != dependentMap.end() && !dependents->second.empty();
   }
 
 private:
-  std::unordered_map<void *, std::unique_ptr<zel_handle_state_t>>
-      defaultHandleStateMap;
-  std::unordered_map<ze_context_handle_t, std::unique_ptr<zel_handle_state_t>>
-      contextHandleStateMap;
-  std::unordered_map<ze_driver_handle_t, std::unique_ptr<zel_handle_state_t>>
-      driverHandleStateMap;
-  std::unordered_map<ze_device_handle_t, std::unique_ptr<zel_handle_state_t>>
-      deviceHandleStateMap;
-  std::unordered_map<ze_command_queue_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      commandQueueHandleStateMap;
-  std::unordered_map<ze_command_list_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      commandListHandleStateMap;
-  std::unordered_map<ze_fence_handle_t, std::unique_ptr<zel_handle_state_t>>
-      fenceHandleStateMap;
-  std::unordered_map<ze_event_pool_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      eventPoolHandleStateMap;
-  std::unordered_map<ze_event_handle_t, std::unique_ptr<zel_handle_state_t>>
-      eventHandleStateMap;
-  std::unordered_map<ze_image_handle_t, std::unique_ptr<zel_handle_state_t>>
-      imageHandleStateMap;
-  std::unordered_map<ze_module_handle_t, std::unique_ptr<zel_handle_state_t>>
-      moduleHandleStateMap;
-  std::unordered_map<ze_module_build_log_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      moduleBuildLogHandleStateMap;
-  std::unordered_map<ze_kernel_handle_t, std::unique_ptr<zel_handle_state_t>>
-      kernelHandleStateMap;
-  std::unordered_map<ze_sampler_handle_t, std::unique_ptr<zel_handle_state_t>>
-      samplerHandleStateMap;
-  std::unordered_map<ze_physical_mem_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      physicalMemHandleStateMap;
-
-  std::unordered_map<ze_fabric_vertex_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      fabricVertexHandleStateMap;
-  std::unordered_map<ze_fabric_edge_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      fabricEdgeHandleStateMap;
-
-  std::unordered_map<ze_ipc_event_pool_handle_t *,
-                     std::unique_ptr<zel_handle_state_t>>
-      ipcEventPoolHandleStateMap;
-  std::unordered_map<ze_ipc_mem_handle_t *, std::unique_ptr<zel_handle_state_t>>
-      ipcMemHandleStateMap;
-
-  std::unordered_map<ze_external_memory_import_win32_handle_t *,
-                     std::unique_ptr<zel_handle_state_t>>
-      externalMemoryImportWin32HandleStateMap;
-  std::unordered_map<ze_external_memory_export_win32_handle_t *,
-                     std::unique_ptr<zel_handle_state_t>>
-      externalMemoryExportWin32HandleStateMap;
-
-  // tools
-  std::unordered_map<zet_driver_handle_t, std::unique_ptr<zel_handle_state_t>>
-      zetDriverHandleStateMap;
-  std::unordered_map<zet_device_handle_t, std::unique_ptr<zel_handle_state_t>>
-      zetDeviceHandleStateMap;
-  std::unordered_map<zet_context_handle_t, std::unique_ptr<zel_handle_state_t>>
-      zetContextHandleStateMap;
-  std::unordered_map<zet_command_list_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      zetCommandListHandleStateMap;
-  std::unordered_map<zet_module_handle_t, std::unique_ptr<zel_handle_state_t>>
-      zetModuleHandleStateMap;
-  std::unordered_map<zet_kernel_handle_t, std::unique_ptr<zel_handle_state_t>>
-      zetKernelHandleStateMap;
-  std::unordered_map<zet_metric_group_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      metricGroupHandleStateMap;
-  std::unordered_map<zet_metric_handle_t, std::unique_ptr<zel_handle_state_t>>
-      metricHandleStateMap;
-  std::unordered_map<zet_metric_streamer_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      metricStreamerHandleStateMap;
-  std::unordered_map<zet_metric_query_pool_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      metricQueryPoolHandleStateMap;
-  std::unordered_map<zet_metric_query_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      metricQueryHandleStateMap;
-  std::unordered_map<zet_tracer_exp_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      tracerExpHandleStateMap;
-  std::unordered_map<zet_debug_session_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      debugSessionHandleStateMap;
-
-  // sysman
-  std::unordered_map<zes_driver_handle_t, std::unique_ptr<zel_handle_state_t>>
-      zesDriverHandleStateMap;
-  std::unordered_map<zes_device_handle_t, std::unique_ptr<zel_handle_state_t>>
-      zesDeviceHandleStateMap;
-  std::unordered_map<zes_sched_handle_t, std::unique_ptr<zel_handle_state_t>>
-      schedHandleStateMap;
-  std::unordered_map<zes_perf_handle_t, std::unique_ptr<zel_handle_state_t>>
-      perfHandleStateMap;
-  std::unordered_map<zes_pwr_handle_t, std::unique_ptr<zel_handle_state_t>>
-      pwrHandleStateMap;
-  std::unordered_map<zes_freq_handle_t, std::unique_ptr<zel_handle_state_t>>
-      freqHandleStateMap;
-  std::unordered_map<zes_engine_handle_t, std::unique_ptr<zel_handle_state_t>>
-      engineHandleStateMap;
-  std::unordered_map<zes_standby_handle_t, std::unique_ptr<zel_handle_state_t>>
-      standbyHandleStateMap;
-  std::unordered_map<zes_firmware_handle_t, std::unique_ptr<zel_handle_state_t>>
-      firmwareHandleStateMap;
-  std::unordered_map<zes_mem_handle_t, std::unique_ptr<zel_handle_state_t>>
-      memHandleStateMap;
-  std::unordered_map<zes_fabric_port_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      fabricPortHandleStateMap;
-  std::unordered_map<zes_temp_handle_t, std::unique_ptr<zel_handle_state_t>>
-      tempHandleStateMap;
-  std::unordered_map<zes_psu_handle_t, std::unique_ptr<zel_handle_state_t>>
-      psuHandleStateMap;
-  std::unordered_map<zes_fan_handle_t, std::unique_ptr<zel_handle_state_t>>
-      fanHandleStateMap;
-  std::unordered_map<zes_led_handle_t, std::unique_ptr<zel_handle_state_t>>
-      ledHandleStateMap;
-  std::unordered_map<zes_ras_handle_t, std::unique_ptr<zel_handle_state_t>>
-      rasHandleStateMap;
-  std::unordered_map<zes_diag_handle_t, std::unique_ptr<zel_handle_state_t>>
-      diagHandleStateMap;
-  std::unordered_map<zes_overclock_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      overclockHandleStateMap;
-  std::unordered_map<ze_rtas_parallel_operation_exp_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      rtasParallelOperationHandleStateMap;
-  std::unordered_map<ze_rtas_builder_exp_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      rtasBuilderHandleStateMap;
+  HandleRegistry registry;
 
+  // Parent handle -> handles created from it, plus the reverse index so
+  // destroying a dependent only visits its own parents.
+  std::mutex dependentMutex;
   std::unordered_map<const void *, std::unordered_set<const void *>>
       dependentMap;
+  std::unordered_map<const void *, std::unordered_set<const void *>>
+      parentMap;
 
-  int untrackedHandles = 0;
+  std::atomic<int> untrackedHandles{0};
 
 }; // class HandleLifetimeValidation
 
@@ -0,0 +1,239 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "handle_registry.h"
+
+namespace validation_layer {
+
+HandleRegistry::HandleRegistry() : shards(new Shard[shardCount]) {
+  for (size_t i = 0; i < shardCount; ++i) {
+    shards[i].tables.emplace_back(new Table(initialCapacity));
+    shards[i].table.store(shards[i].tables.back().get(),
+                          std::memory_order_release);
+  }
+}
+
+HandleRegistry::~HandleRegistry() = default;
+
+bool HandleRegistry::find(const void *handle, HandleKind kind,
+                          uint32_t &state) const {
+  const uintptr_t key = reinterpret_cast<uintptr_t>(handle);
+  if (key == 0) {
+    return false;
+  }
+  const uint64_t hash = hashOf(key, kind);
+  const Shard &shard = shardFor(hash);
+  const uint32_t kindValue = static_cast<uint32_t>(kind);
+
+  for (;;) {
+    const uint64_t before = shard.sequence.load(std::memory_order_acquire);
+    if (before & 1) {
+      continue; // writer in progress
+    }
+    const Table *table = shard.table.load(std::memory_order_acquire);
+    bool found = false;
+    uint32_t foundState = 0;
+    for (size_t i = hash & table->mask, probes = 0; probes <= table->mask;
+         i = (i + 1) & table->mask, ++probes) {
+      const Slot &slot = table->slots[i];
+      const uintptr_t slotHandle = slot.handle.load(std::memory_order_relaxed);
+      if (slotHandle == 0) {
+        break;
+      }
+      if (slotHandle == key &&
+          slot.kind.load(std::memory_order_relaxed) == kindValue) {
+        found = true;
+        foundState = slot.state.load(std::memory_order_relaxed);
+        break;
+      }
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (shard.sequence.load(std::memory_order_relaxed) == before) {
+      state = foundState;
+      return found;
+    }
+  }
+}
+
+HandleRegistry::Slot *HandleRegistry::locate(Table *table, uintptr_t handle,
+                                             HandleKind kind, uint64_t hash) {
+  const uint32_t kindValue = static_cast<uint32_t>(kind);
+  for (size_t i = hash & table->mask, probes = 0; probes <= table->mask;
+       i = (i + 1) & table->mask, ++probes) {
+    Slot &slot = table->slots[i];
+    const uintptr_t slotHandle = slot.handle.load(std::memory_order_relaxed);
+    if (slotHandle == 0 || (slotHandle == handle &&
+                            slot.kind.load(std::memory_order_relaxed) ==
+                                kindValue)) {
+      return &slot;
+    }
+  }
+  return nullptr;
+}
+
+void HandleRegistry::beginWrite(Shard &shard) {
+  shard.sequence.store(shard.sequence.load(std::memory_order_relaxed) + 1,
+                       std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+}
+
+void HandleRegistry::endWrite(Shard &shard) {
+  shard.sequence.store(shard.sequence.load(std::memory_order_relaxed) + 1,
+                       std::memory_order_release);
+}
+
+void HandleRegistry::grow(Shard &shard) {
+  Table *oldTable = shard.table.load(std::memory_order_relaxed);
+  std::unique_ptr<Table> newTable(new Table((oldTable->mask + 1) * 2));
+  for (size_t i = 0; i <= oldTable->mask; ++i) {
+    const Slot &from = oldTable->slots[i];
+    const uintptr_t handle = from.handle.load(std::memory_order_relaxed);
+    if (handle == 0) {
+      continue;
+    }
+    const HandleKind kind =
+        static_cast<HandleKind>(from.kind.load(std::memory_order_relaxed));
+    Slot *to = locate(newTable.get(), handle, kind, hashOf(handle, kind));
+    to->kind.store(from.kind.load(std::memory_order_relaxed),
+                   std::memory_order_relaxed);
+    to->state.store(from.state.load(std::memory_order_relaxed),
+                    std::memory_order_relaxed);
+    to->handle.store(handle, std::memory_order_relaxed);
+  }
+  // The new table is fully built before it is published; readers still on
+  // the old one see the sequence change and retry.
+  shard.table.store(newTable.get(), std::memory_order_release);
+  shard.tables.push_back(std::move(newTable));
+}
+
+bool HandleRegistry::insertLocked(Shard &shard, uintptr_t handle,
+                                  HandleKind kind, uint32_t state,
+                                  uint64_t hash, bool assign) {
+  Table *table = shard.table.load(std::memory_order_relaxed);
+  Slot *slot = locate(table, handle, kind, hash);
+  if (slot && slot->handle.load(std::memory_order_relaxed) != 0) {
+    if (assign) {
+      slot->state.store(state, std::memory_order_relaxed);
+    }
+    return false;
+  }
+
+  beginWrite(shard);
+  // Keep the load factor at or below 1/2 so probe sequences stay short.
+  if ((shard.live + 1) * 2 > table->mask + 1) {
+    grow(shard);
+    table = shard.table.load(std::memory_order_relaxed);
+    slot = locate(table, handle, kind, hash);
+  }
+  slot->kind.store(static_cast<uint32_t>(kind), std::memory_order_relaxed);
+  slot->state.store(state, std::memory_order_relaxed);
+  slot->handle.store(handle, std::memory_order_relaxed);
+  ++shard.live;
+  endWrite(shard);
+  return true;
+}
+
+bool HandleRegistry::insert(const void *handle, HandleKind kind,
+                            uint32_t state) {
+  const uintptr_t key = reinterpret_cast<uintptr_t>(handle);
+  if (key == 0) {
+    return false;
+  }
+  const uint64_t hash = hashOf(key, kind);
+  Shard &shard = shardFor(hash);
+  std::lock_guard<std::mutex> lock(shard.mut);
+  return insertLocked(shard, key, kind, state, hash, false);
+}
+
+void HandleRegistry::insertOrAssign(const void *handle, HandleKind kind,
+                                    uint32_t state) {
+  const uintptr_t key = reinterpret_cast<uintptr_t>(handle);
+  if (key == 0) {
+    return;
+  }
+  const uint64_t hash = hashOf(key, kind);
+  Shard &shard = shardFor(hash);
+  std::lock_guard<std::mutex> lock(shard.mut);
+  insertLocked(shard, key, kind, state, hash, true);
+}
+
+bool HandleRegistry::setState(const void *handle, HandleKind kind,
+                              uint32_t state) {
+  const uintptr_t key = reinterpret_cast<uintptr_t>(handle);
+  if (key == 0) {
+    return false;
+  }
+  const uint64_t hash = hashOf(key, kind);
+  Shard &shard = shardFor(hash);
+  std::lock_guard<std::mutex> lock(shard.mut);
+  Slot *slot =
+      locate(shard.table.load(std::memory_order_relaxed), key, kind, hash);
+  if (!slot || slot->handle.load(std::memory_order_relaxed) == 0) {
+    return false;
+  }
+  // A single word; readers need no sequence change to see it consistently.
+  slot->state.store(state, std::memory_order_relaxed);
+  return true;
+}
+
+bool HandleRegistry::erase(const void *handle, HandleKind kind) {
+  const uintptr_t key = reinterpret_cast<uintptr_t>(handle);
+  if (key == 0) {
+    return false;
+  }
+  const uint64_t hash = hashOf(key, kind);
+  Shard &shard = shardFor(hash);
+  std::lock_guard<std::mutex> lock(shard.mut);
+  Table *table = shard.table.load(std::memory_order_relaxed);
+  Slot *slot = locate(table, key, kind, hash);
+  if (!slot || slot->handle.load(std::memory_order_relaxed) == 0) {
+    return false;
+  }
+
+  beginWrite(shard);
+  // Backward-shift deletion: pull later entries of the probe run into the
+  // hole when their home slot is at or before it, so lookups can keep
+  // stopping at the first empty slot.
+  size_t hole = static_cast<size_t>(slot - table->slots.get());
+  for (size_t next = (hole + 1) & table->mask;;
+       next = (next + 1) & table->mask) {
+    Slot &candidate = table->slots[next];
+    const uintptr_t candidateHandle =
+        candidate.handle.load(std::memory_order_relaxed);
+    if (candidateHandle == 0) {
+      break;
+    }
+    const HandleKind candidateKind = static_cast<HandleKind>(
+        candidate.kind.load(std::memory_order_relaxed));
+    const size_t home = hashOf(candidateHandle, candidateKind) & table->mask;
+    // Distance from home to next versus hole to next, both modulo capacity.
+    if (((next - home) & table->mask) >= ((next - hole) & table->mask)) {
+      Slot &target = table->slots[hole];
+      target.kind.store(candidate.kind.load(std::memory_order_relaxed),
+                        std::memory_order_relaxed);
+      target.state.store(candidate.state.load(std::memory_order_relaxed),
+                         std::memory_order_relaxed);
+      target.handle.store(candidateHandle, std::memory_order_relaxed);
+      hole = next;
+    }
+  }
+  table->slots[hole].handle.store(0, std::memory_order_relaxed);
+  --shard.live;
+  endWrite(shard);
+  return true;
+}
+
+size_t HandleRegistry::size() const {
+  size_t total = 0;
+  for (size_t i = 0; i < shardCount; ++i) {
+    std::lock_guard<std::mutex> lock(shards[i].mut);
+    total += shards[i].live;
+  }
+  return total;
+}
+
+} // namespace validation_layer
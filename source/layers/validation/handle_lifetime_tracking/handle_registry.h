@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace validation_layer {
+
+// Object type a tracked handle was registered as.  The same address may be
+// live under several kinds at once (e.g. a ze and a zes view of one device),
+// so lookups always match on the (handle, kind) pair.
+enum class HandleKind : uint32_t {
+  Default,
+  Context,
+  Driver,
+  Device,
+  CommandQueue,
+  CommandList,
+  Fence,
+  EventPool,
+  Event,
+  Image,
+  Module,
+  ModuleBuildLog,
+  Kernel,
+  Sampler,
+  PhysicalMem,
+  FabricVertex,
+  FabricEdge,
+  IpcEventPool,
+  IpcMem,
+  ExternalMemoryImportWin32,
+  ExternalMemoryExportWin32,
+  RtasParallelOperation,
+  RtasBuilder,
+  MetricGroup,
+  Metric,
+  MetricStreamer,
+  MetricQueryPool,
+  MetricQuery,
+  TracerExp,
+  DebugSession,
+  Sched,
+  Perf,
+  Pwr,
+  Freq,
+  Engine,
+  Standby,
+  Firmware,
+  Mem,
+  FabricPort,
+  Temp,
+  Psu,
+  Fan,
+  Led,
+  Ras,
+  Diag,
+  Overclock,
+};
+
+// Per-handle state bits stored inline next to the handle.
+constexpr uint32_t HandleStateOpen = 0x1; // command list accepts appends
+
+// Concurrent set of live (handle, kind) pairs with a 32-bit state word each,
+// shared by the ze/zes/zet/zer handle lifetime checkers.
+//
+// Entries are spread over shardCount shards by handle bits.  Each shard is a
+// linear-probing open-addressing table of inline slots, so a lookup touches
+// one or two cache lines and never allocates.  Lookups are lock-free: they
+// read under a per-shard sequence counter and retry if a writer changed the
+// shard meanwhile.  Inserts and erases take the shard mutex; erase uses
+// backward-shift deletion so no tombstones accumulate.  A grown shard's old
+// table stays allocated until the registry is destroyed because a concurrent
+// reader may still be probing it; tables only double, so that costs at most
+// the size of the live tables.
+class HandleRegistry {
+public:
+  static constexpr size_t shardCount = 16;
+  static constexpr size_t initialCapacity = 64; // slots per shard, power of two
+
+  HandleRegistry();
+  ~HandleRegistry();
+
+  HandleRegistry(const HandleRegistry &) = delete;
+  HandleRegistry &operator=(const HandleRegistry &) = delete;
+
+  // Returns false, leaving the entry unchanged, if the pair is already live.
+  // Null handles are never tracked.
+  bool insert(const void *handle, HandleKind kind, uint32_t state = 0);
+
+  // Inserts the pair or overwrites the state of the live entry.
+  void insertOrAssign(const void *handle, HandleKind kind, uint32_t state);
+
+  // Returns false if the pair was not live.
+  bool erase(const void *handle, HandleKind kind);
+
+  bool contains(const void *handle, HandleKind kind) const {
+    uint32_t state;
+    return find(handle, kind, state);
+  }
+
+  // Reads the entry's state; returns false if the pair is not live.
+  bool find(const void *handle, HandleKind kind, uint32_t &state) const;
+
+  // Overwrites the entry's state; returns false if the pair is not live.
+  bool setState(const void *handle, HandleKind kind, uint32_t state);
+
+  size_t size() const;
+
+private:
+  struct Slot {
+    std::atomic<uintptr_t> handle{0}; // 0 when empty
+    std::atomic<uint32_t> kind{0};
+    std::atomic<uint32_t> state{0};
+  };
+
+  struct Table {
+    explicit Table(size_t capacity)
+        : mask(capacity - 1), slots(new Slot[capacity]) {}
+    size_t mask;
+    std::unique_ptr<Slot[]> slots;
+  };
+
+  struct Shard {
+    std::atomic<uint64_t> sequence{0}; // odd while a writer is modifying
+    std::atomic<Table *> table{nullptr};
+    std::mutex mut;
+    size_t live = 0;
+    std::vector<std::unique_ptr<Table>> tables; // current one is last
+  };
+
+  static uint64_t hashOf(uintptr_t handle, HandleKind kind) {
+    uint64_t h = (static_cast<uint64_t>(handle) ^
+                  (static_cast<uint64_t>(kind) << 56)) *
+                 0x9E3779B97F4A7C15ull;
+    return h ^ (h >> 29);
+  }
+
+  Shard &shardFor(uint64_t hash) const {
+    return shards[(hash >> 60) & (shardCount - 1)];
+  }
+
+  // Writer-side helpers; the shard mutex must be held.
+  static Slot *locate(Table *table, uintptr_t handle, HandleKind kind,
+                      uint64_t hash);
+  void beginWrite(Shard &shard);
+  void endWrite(Shard &shard);
+  void grow(Shard &shard);
+  bool insertLocked(Shard &shard, uintptr_t handle, HandleKind kind,
+                    uint32_t state, uint64_t hash, bool assign);
+
+  std::unique_ptr<Shard[]> shards;
+};
+
+} // namespace validation_layer
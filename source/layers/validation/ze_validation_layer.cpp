@@ -9,6 +9,8 @@
  */
 #include "ze_validation_layer.h"
 #include "param_validation.h"
+#include <cstdint>
+#include <cstdlib>
 #include <memory>
 
 namespace validation_layer
@@ -25,17 +27,30 @@ namespace validation_layer
         enableThreadingValidation = getenv_tobool( "ZE_ENABLE_THREADING_VALIDATION" );
         verboseLogging = getenv_tobool( "ZEL_LOADER_LOGGING_ENABLE_SUCCESS_PRINT" );
 
+        auto samplePeriod = getenv_string( "ZEL_VALIDATION_SAMPLE_PERIOD" );
+        if (!samplePeriod.empty()) {
+            auto period = std::strtoul( samplePeriod.c_str(), nullptr, 10 );
+            if (period > 1 && period <= UINT32_MAX) {
+                sampleCallPeriod = static_cast<uint32_t>( period );
+                sampleAllCalls = false;
+            }
+        }
+
         // Point at the process-lifetime no-op logger until the loader calls
         // zelLoaderSetLogger().  This is never null, so call sites need no null check.
         // Thread-safety: zelLoaderSetLogger() writes this field exactly once on the
         // init thread before zeDdiTable.exchange() makes the layer reachable.
         logger = loader::noopLogger();
+
+        binaryTrace = loader::createBinaryTraceWriter().release();
     }
 
     ///////////////////////////////////////////////////////////////////////////////
     context_t::~context_t()
     {
-        validationHandlers.clear();
+        if (binaryTrace) {
+            binaryTrace->flush();
+        }
     }
 } // namespace validation_layer
 
@@ -20,6 +20,7 @@
 #include "zes_entry_points.h"
 #include "zer_entry_points.h"
 #include "ze_logger.h"
+#include "ze_binary_trace.h"
 #include "ze_to_string.h"
 #include "zes_to_string.h"
 #include "zet_to_string.h"
@@ -40,6 +41,21 @@ namespace validation_layer
         ZETValidationEntryPoints *zetValidation;
         ZERValidationEntryPoints *zerValidation;
     };
+    struct ValidationDispatch {
+        ZEValidationDispatch ze;
+        ZESValidationDispatch zes;
+        ZETValidationDispatch zet;
+        ZERValidationDispatch zer;
+
+        template <class ZE, class ZES, class ZET, class ZER>
+        void addChecker( ZE *zeChecker, ZES *zesChecker, ZET *zetChecker, ZER *zerChecker ) {
+            ze.addChecker( zeChecker );
+            zes.addChecker( zesChecker );
+            zet.addChecker( zetChecker );
+            zer.addChecker( zerChecker );
+        }
+    };
+
     class __zedlllocal context_t
     {
     public:
@@ -54,7 +70,44 @@ namespace validation_layer
         zes_dditable_t  zesDdiTable = {};
         zer_dditable_t  zerDdiTable = {};
 
-        std::vector<validationChecker *> validationHandlers;
+        // Per-entry-point checker lists, built by registerChecker().
+        // Checkers that track state across calls (leaks, events, resources)
+        // run on every call.  Stateless checkers are registered with
+        // registerSampledChecker() and only run on sampled calls.
+        ValidationDispatch validationDispatch;
+        ValidationDispatch sampledValidationDispatch;
+
+        // Pass the checker's concrete classes so that only the entry points
+        // they override are dispatched.  A checker with nothing to check for
+        // an API family may pass nullptr.
+        template <class ZE, class ZES, class ZET, class ZER = ZERValidationEntryPoints>
+        void registerChecker( ZE *ze, ZES *zes, ZET *zet, ZER *zer = nullptr ) {
+            validationDispatch.addChecker( ze, zes, zet, zer );
+        }
+        template <class ZE, class ZES, class ZET, class ZER = ZERValidationEntryPoints>
+        void registerSampledChecker( ZE *ze, ZES *zes, ZET *zet, ZER *zer = nullptr ) {
+            sampledValidationDispatch.addChecker( ze, zes, zet, zer );
+        }
+
+        // ZEL_VALIDATION_SAMPLE_PERIOD=N validates one in every N calls to
+        // each API on each thread, starting with the first.  Unsampled calls
+        // skip the stateless checkers and the read-only handle lifetime
+        // checks.  They still run the stateful checkers and keep the handle
+        // registry current, so later sampled calls see correct state.  An
+        // entry point with a stateful checker always runs the stateless
+        // ones first, since the stateful checker reads the arguments.
+        uint32_t sampleCallPeriod = 1;
+        bool sampleAllCalls = true;
+
+        // countdown is the calling intercept's thread_local counter.
+        bool sampleCall( uint32_t &countdown ) const {
+            if( countdown == 0 ) {
+                countdown = sampleCallPeriod - 1;
+                return true;
+            }
+            --countdown;
+            return false;
+        }
         std::unique_ptr<HandleLifetimeValidation> handleLifetime;
         
         // Raw pointer — the loader owns the ZeLogger and guarantees it outlives
@@ -64,6 +117,13 @@ namespace validation_layer
         // called during _dl_call_fini after the control block has been freed.
         loader::ZeLogger *logger;
 
+        // Set when ZEL_LOADER_BINARY_TRACE_FILE is defined: every call is also
+        // appended as a fixed-size record to a memory-mapped trace file.
+        // Raw pointer for the same reason as logger: calls made during static
+        // teardown may still append after context_t::~context_t(), so the
+        // destructor only flushes the file and the mapping is never freed.
+        loader::BinaryTraceWriter *binaryTrace = nullptr;
+
         static context_t& getInstance() {
             static context_t instance;
             return instance;
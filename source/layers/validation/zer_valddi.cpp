@@ -31,10 +31,20 @@ namespace validation_layer
         const char** ppString                           ///< [in,out] pointer to a null-terminated array of characters describing
                                                         ///< cause of error.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zerGetLastErrorDescription", "const char** ppString");
+            context.binaryTrace->record(binaryTraceApiId, result, ppString);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zerGetLastErrorDescription(";
@@ -50,10 +60,20 @@ namespace validation_layer
         ze_result_t result,
         ze_device_handle_t hDevice                      ///< [in] handle of the device
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zerTranslateDeviceHandleToIdentifier", "ze_device_handle_t hDevice");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zerTranslateDeviceHandleToIdentifier(";
@@ -69,10 +89,20 @@ namespace validation_layer
         ze_result_t result,
         uint32_t identifier                             ///< [in] integer identifier of the device
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zerTranslateIdentifierToDeviceHandle", "uint32_t identifier");
+            context.binaryTrace->record(binaryTraceApiId, result, identifier);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zerTranslateIdentifierToDeviceHandle(";
@@ -90,6 +120,10 @@ namespace validation_layer
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         context.logger->log_trace(status + " (" + loader::to_string(result) + ") in zerGetDefaultContext()");
         return result;
@@ -103,16 +137,24 @@ namespace validation_layer
                                                         ///< cause of error.
         )
     {
-        context.logger->log_trace("zerGetLastErrorDescription(ppString)");
+        ZEL_LOG_TRACE(context.logger, "zerGetLastErrorDescription(ppString)");
 
         auto pfnGetLastErrorDescription = context.zerDdiTable.Global.pfnGetLastErrorDescription;
 
         if( nullptr == pfnGetLastErrorDescription )
             return logAndPropagateResult_zerGetLastErrorDescription(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, ppString);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zerValidation->zerGetLastErrorDescriptionPrologue( ppString );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zer.zerGetLastErrorDescriptionPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zer.zerGetLastErrorDescriptionPrologue) {
+                auto result = checker->zerGetLastErrorDescriptionPrologue( ppString );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zerGetLastErrorDescription(result, ppString);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zer.zerGetLastErrorDescriptionPrologue) {
+            auto result = checker->zerGetLastErrorDescriptionPrologue( ppString );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zerGetLastErrorDescription(result, ppString);
         }
 
@@ -122,15 +164,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zerHandleLifetime.zerGetLastErrorDescriptionPrologue( ppString );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zerGetLastErrorDescription(result, ppString);
         }
 
         auto driver_result = pfnGetLastErrorDescription( ppString );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zerValidation->zerGetLastErrorDescriptionEpilogue( ppString ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zer.zerGetLastErrorDescriptionEpilogue) {
+                auto result = checker->zerGetLastErrorDescriptionEpilogue( ppString ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zerGetLastErrorDescription(result, ppString);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zer.zerGetLastErrorDescriptionEpilogue) {
+            auto result = checker->zerGetLastErrorDescriptionEpilogue( ppString ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zerGetLastErrorDescription(result, ppString);
         }
 
@@ -144,16 +193,24 @@ namespace validation_layer
         ze_device_handle_t hDevice                      ///< [in] handle of the device
         )
     {
-        context.logger->log_trace("zerTranslateDeviceHandleToIdentifier(hDevice)");
+        ZEL_LOG_TRACE(context.logger, "zerTranslateDeviceHandleToIdentifier(hDevice)");
 
         auto pfnTranslateDeviceHandleToIdentifier = context.zerDdiTable.Global.pfnTranslateDeviceHandleToIdentifier;
 
         if( nullptr == pfnTranslateDeviceHandleToIdentifier )
             return UINT32_MAX;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zerValidation->zerTranslateDeviceHandleToIdentifierPrologue( hDevice );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zer.zerTranslateDeviceHandleToIdentifierPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zer.zerTranslateDeviceHandleToIdentifierPrologue) {
+                auto result = checker->zerTranslateDeviceHandleToIdentifierPrologue( hDevice );
+                if(result!=ZE_RESULT_SUCCESS) return UINT32_MAX;
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zer.zerTranslateDeviceHandleToIdentifierPrologue) {
+            auto result = checker->zerTranslateDeviceHandleToIdentifierPrologue( hDevice );
             if(result!=ZE_RESULT_SUCCESS) return UINT32_MAX;
         }
 
@@ -163,15 +220,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zerHandleLifetime.zerTranslateDeviceHandleToIdentifierPrologue( hDevice );
             if(result!=ZE_RESULT_SUCCESS) return UINT32_MAX;
         }
 
         auto driver_result = pfnTranslateDeviceHandleToIdentifier( hDevice );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zerValidation->zerTranslateDeviceHandleToIdentifierEpilogue( hDevice ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zer.zerTranslateDeviceHandleToIdentifierEpilogue) {
+                auto result = checker->zerTranslateDeviceHandleToIdentifierEpilogue( hDevice ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return UINT32_MAX;
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zer.zerTranslateDeviceHandleToIdentifierEpilogue) {
+            auto result = checker->zerTranslateDeviceHandleToIdentifierEpilogue( hDevice ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return UINT32_MAX;
         }
 
@@ -185,16 +249,24 @@ namespace validation_layer
         uint32_t identifier                             ///< [in] integer identifier of the device
         )
     {
-        context.logger->log_trace("zerTranslateIdentifierToDeviceHandle(identifier)");
+        ZEL_LOG_TRACE(context.logger, "zerTranslateIdentifierToDeviceHandle(identifier)");
 
         auto pfnTranslateIdentifierToDeviceHandle = context.zerDdiTable.Global.pfnTranslateIdentifierToDeviceHandle;
 
         if( nullptr == pfnTranslateIdentifierToDeviceHandle )
             return nullptr;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zerValidation->zerTranslateIdentifierToDeviceHandlePrologue( identifier );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zer.zerTranslateIdentifierToDeviceHandlePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zer.zerTranslateIdentifierToDeviceHandlePrologue) {
+                auto result = checker->zerTranslateIdentifierToDeviceHandlePrologue( identifier );
+                if(result!=ZE_RESULT_SUCCESS) return nullptr;
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zer.zerTranslateIdentifierToDeviceHandlePrologue) {
+            auto result = checker->zerTranslateIdentifierToDeviceHandlePrologue( identifier );
             if(result!=ZE_RESULT_SUCCESS) return nullptr;
         }
 
@@ -204,15 +276,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zerHandleLifetime.zerTranslateIdentifierToDeviceHandlePrologue( identifier );
             if(result!=ZE_RESULT_SUCCESS) return nullptr;
         }
 
         auto driver_result = pfnTranslateIdentifierToDeviceHandle( identifier );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zerValidation->zerTranslateIdentifierToDeviceHandleEpilogue( identifier ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zer.zerTranslateIdentifierToDeviceHandleEpilogue) {
+                auto result = checker->zerTranslateIdentifierToDeviceHandleEpilogue( identifier ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return nullptr;
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zer.zerTranslateIdentifierToDeviceHandleEpilogue) {
+            auto result = checker->zerTranslateIdentifierToDeviceHandleEpilogue( identifier ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return nullptr;
         }
 
@@ -226,16 +305,24 @@ namespace validation_layer
         void
         )
     {
-        context.logger->log_trace("zerGetDefaultContext()");
+        ZEL_LOG_TRACE(context.logger, "zerGetDefaultContext()");
 
         auto pfnGetDefaultContext = context.zerDdiTable.Global.pfnGetDefaultContext;
 
         if( nullptr == pfnGetDefaultContext )
             return nullptr;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zerValidation->zerGetDefaultContextPrologue( );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zer.zerGetDefaultContextPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zer.zerGetDefaultContextPrologue) {
+                auto result = checker->zerGetDefaultContextPrologue( );
+                if(result!=ZE_RESULT_SUCCESS) return nullptr;
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zer.zerGetDefaultContextPrologue) {
+            auto result = checker->zerGetDefaultContextPrologue( );
             if(result!=ZE_RESULT_SUCCESS) return nullptr;
         }
 
@@ -245,15 +332,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zerHandleLifetime.zerGetDefaultContextPrologue( );
             if(result!=ZE_RESULT_SUCCESS) return nullptr;
         }
 
         auto driver_result = pfnGetDefaultContext(  );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zerValidation->zerGetDefaultContextEpilogue( driver_result );
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zer.zerGetDefaultContextEpilogue) {
+                auto result = checker->zerGetDefaultContextEpilogue( driver_result );
+                if(result!=ZE_RESULT_SUCCESS) return nullptr;
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zer.zerGetDefaultContextEpilogue) {
+            auto result = checker->zerGetDefaultContextEpilogue( driver_result );
             if(result!=ZE_RESULT_SUCCESS) return nullptr;
         }
 
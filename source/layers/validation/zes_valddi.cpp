@@ -31,10 +31,20 @@ namespace validation_layer
         zes_init_flags_t flags                          ///< [in] initialization flags.
                                                         ///< currently unused, must be 0 (default).
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesInit", "zes_init_flags_t flags");
+            context.binaryTrace->record(binaryTraceApiId, result, flags);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesInit(";
@@ -58,10 +68,20 @@ namespace validation_layer
                                                         ///< if count is less than the number of sysman drivers available, then the
                                                         ///< loader shall only retrieve that number of sysman drivers.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDriverGet", "uint32_t* pCount,zes_driver_handle_t* phDrivers");
+            context.binaryTrace->record(binaryTraceApiId, result, pCount, phDrivers);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDriverGet(";
@@ -91,10 +111,20 @@ namespace validation_layer
                                                         ///< if count is less than the number of extension properties available,
                                                         ///< then driver shall only retrieve that number of extension properties.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDriverGetExtensionProperties", "zes_driver_handle_t hDriver,uint32_t* pCount,zes_driver_extension_properties_t* pExtensionProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hDriver, pCount, pExtensionProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDriverGetExtensionProperties(";
@@ -120,10 +150,20 @@ namespace validation_layer
         const char* name,                               ///< [in] extension function name
         void** ppFunctionAddress                        ///< [out] pointer to function pointer
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDriverGetExtensionFunctionAddress", "zes_driver_handle_t hDriver,const char* name,void** ppFunctionAddress");
+            context.binaryTrace->record(binaryTraceApiId, result, hDriver, name, ppFunctionAddress);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDriverGetExtensionFunctionAddress(";
@@ -161,10 +201,20 @@ namespace validation_layer
                                                         ///< if count is less than the number of sysman devices available, then
                                                         ///< driver shall only retrieve that number of sysman devices.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceGet", "zes_driver_handle_t hDriver,uint32_t* pCount,zes_device_handle_t* phDevices");
+            context.binaryTrace->record(binaryTraceApiId, result, hDriver, pCount, phDevices);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceGet(";
@@ -189,10 +239,20 @@ namespace validation_layer
         zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
         zes_device_properties_t* pProperties            ///< [in,out] Structure that will contain information about the device.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceGetProperties", "zes_device_handle_t hDevice,zes_device_properties_t* pProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceGetProperties(";
@@ -213,10 +273,20 @@ namespace validation_layer
         zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
         zes_device_state_t* pState                      ///< [in,out] Structure that will contain information about the device.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceGetState", "zes_device_handle_t hDevice,zes_device_state_t* pState");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pState);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceGetState(";
@@ -238,10 +308,20 @@ namespace validation_layer
         ze_bool_t force                                 ///< [in] If set to true, all applications that are currently using the
                                                         ///< device will be forcibly killed.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceReset", "zes_device_handle_t hDevice,ze_bool_t force");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, force);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceReset(";
@@ -262,10 +342,20 @@ namespace validation_layer
         zes_device_handle_t hDevice,                    ///< [in] Sysman handle for the device
         zes_reset_properties_t* pProperties             ///< [in] Device reset properties to apply
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceResetExt", "zes_device_handle_t hDevice,zes_reset_properties_t* pProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceResetExt(";
@@ -295,10 +385,20 @@ namespace validation_layer
                                                         ///< the device, then the driver shall only retrieve information about that
                                                         ///< number of processes. In this case, the return code will ::ZE_RESULT_ERROR_INVALID_SIZE.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceProcessesGetState", "zes_device_handle_t hDevice,uint32_t* pCount,zes_process_state_t* pProcesses");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pCount, pProcesses);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceProcessesGetState(";
@@ -323,10 +423,20 @@ namespace validation_layer
         zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
         zes_pci_properties_t* pProperties               ///< [in,out] Will contain the PCI properties.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDevicePciGetProperties", "zes_device_handle_t hDevice,zes_pci_properties_t* pProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDevicePciGetProperties(";
@@ -347,10 +457,20 @@ namespace validation_layer
         zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
         zes_pci_state_t* pState                         ///< [in,out] Will contain the PCI properties.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDevicePciGetState", "zes_device_handle_t hDevice,zes_pci_state_t* pState");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pState);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDevicePciGetState(";
@@ -379,10 +499,20 @@ namespace validation_layer
                                                         ///< if count is less than the number of PCI bars that are setup, then the
                                                         ///< driver shall only retrieve information about that number of PCI bars.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDevicePciGetBars", "zes_device_handle_t hDevice,uint32_t* pCount,zes_pci_bar_properties_t* pProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pCount, pProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDevicePciGetBars(";
@@ -407,10 +537,20 @@ namespace validation_layer
         zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
         zes_pci_stats_t* pStats                         ///< [in,out] Will contain a snapshot of the latest stats.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDevicePciGetStats", "zes_device_handle_t hDevice,zes_pci_stats_t* pStats");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pStats);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDevicePciGetStats(";
@@ -430,10 +570,20 @@ namespace validation_layer
         ze_result_t result,
         zes_device_handle_t hDevice                     ///< [in] Sysman handle of the device.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceSetOverclockWaiver", "zes_device_handle_t hDevice");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceSetOverclockWaiver(";
@@ -452,10 +602,20 @@ namespace validation_layer
                                                         ///< each of enum ::zes_overclock_domain_t). If no bits are set, the device
                                                         ///< doesn't support overclocking.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceGetOverclockDomains", "zes_device_handle_t hDevice,uint32_t* pOverclockDomains");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pOverclockDomains);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceGetOverclockDomains(";
@@ -479,10 +639,20 @@ namespace validation_layer
                                                         ///< specified overclock domain (a bit for each of enum
                                                         ///< ::zes_overclock_control_t).
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceGetOverclockControls", "zes_device_handle_t hDevice,zes_overclock_domain_t domainType,uint32_t* pAvailableControls");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, domainType, pAvailableControls);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceGetOverclockControls(";
@@ -508,10 +678,20 @@ namespace validation_layer
         ze_bool_t onShippedState                        ///< [in] True will reset to shipped state; false will reset to
                                                         ///< manufacturing state
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceResetOverclockSettings", "zes_device_handle_t hDevice,ze_bool_t onShippedState");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, onShippedState);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceResetOverclockSettings(";
@@ -537,10 +717,20 @@ namespace validation_layer
                                                         ///< overclock control or reset overclock settings.
         ze_bool_t* pPendingReset                        ///< [out] Pending reset 0 =manufacturing state, 1= shipped state)..
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceReadOverclockState", "zes_device_handle_t hDevice,zes_overclock_mode_t* pOverclockMode,ze_bool_t* pWaiverSetting,ze_bool_t* pOverclockState,zes_pending_action_t* pPendingAction,ze_bool_t* pPendingReset");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceReadOverclockState(";
@@ -612,10 +802,20 @@ namespace validation_layer
                                                         ///< available, then the driver shall only retrieve that number of
                                                         ///< component handles.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceEnumOverclockDomains", "zes_device_handle_t hDevice,uint32_t* pCount,zes_overclock_handle_t* phDomainHandle");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pCount, phDomainHandle);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceEnumOverclockDomains(";
@@ -640,10 +840,20 @@ namespace validation_layer
         zes_overclock_handle_t hDomainHandle,           ///< [in] Handle for the component domain.
         zes_overclock_properties_t* pDomainProperties   ///< [in,out] The overclock properties for the specified domain.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesOverclockGetDomainProperties", "zes_overclock_handle_t hDomainHandle,zes_overclock_properties_t* pDomainProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hDomainHandle, pDomainProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesOverclockGetDomainProperties(";
@@ -664,10 +874,20 @@ namespace validation_layer
         zes_overclock_handle_t hDomainHandle,           ///< [in] Handle for the component domain.
         zes_vf_property_t* pVFProperties                ///< [in,out] The VF min,max,step for a specified domain.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesOverclockGetDomainVFProperties", "zes_overclock_handle_t hDomainHandle,zes_vf_property_t* pVFProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hDomainHandle, pVFProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesOverclockGetDomainVFProperties(";
@@ -689,10 +909,20 @@ namespace validation_layer
         zes_overclock_control_t DomainControl,          ///< [in] Handle for the component.
         zes_control_property_t* pControlProperties      ///< [in,out] overclock control values.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesOverclockGetDomainControlProperties", "zes_overclock_handle_t hDomainHandle,zes_overclock_control_t DomainControl,zes_control_property_t* pControlProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hDomainHandle, DomainControl, pControlProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesOverclockGetDomainControlProperties(";
@@ -718,10 +948,20 @@ namespace validation_layer
         zes_overclock_control_t DomainControl,          ///< [in] Overclock Control.
         double* pValue                                  ///< [in,out] Getting overclock control value for the specified control.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesOverclockGetControlCurrentValue", "zes_overclock_handle_t hDomainHandle,zes_overclock_control_t DomainControl,double* pValue");
+            context.binaryTrace->record(binaryTraceApiId, result, hDomainHandle, DomainControl, pValue);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesOverclockGetControlCurrentValue(";
@@ -748,10 +988,20 @@ namespace validation_layer
         double* pValue                                  ///< [out] Returns the pending value for a given control. The units and
                                                         ///< format of the value depend on the control type.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesOverclockGetControlPendingValue", "zes_overclock_handle_t hDomainHandle,zes_overclock_control_t DomainControl,double* pValue");
+            context.binaryTrace->record(binaryTraceApiId, result, hDomainHandle, DomainControl, pValue);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesOverclockGetControlPendingValue(";
@@ -784,10 +1034,20 @@ namespace validation_layer
                                                         ///< depend on the control type.
         zes_pending_action_t* pPendingAction            ///< [out] Pending overclock setting.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesOverclockSetControlUserValue", "zes_overclock_handle_t hDomainHandle,zes_overclock_control_t DomainControl,double pValue,zes_pending_action_t* pPendingAction");
+            context.binaryTrace->record(binaryTraceApiId, result, hDomainHandle, DomainControl, pValue, pPendingAction);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesOverclockSetControlUserValue(";
@@ -823,10 +1083,20 @@ namespace validation_layer
         zes_control_state_t* pControlState,             ///< [out] Current overclock control state.
         zes_pending_action_t* pPendingAction            ///< [out] Pending overclock setting.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesOverclockGetControlState", "zes_overclock_handle_t hDomainHandle,zes_overclock_control_t DomainControl,zes_control_state_t* pControlState,zes_pending_action_t* pPendingAction");
+            context.binaryTrace->record(binaryTraceApiId, result, hDomainHandle, DomainControl, pControlState, pPendingAction);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesOverclockGetControlState(";
@@ -869,10 +1139,20 @@ namespace validation_layer
         uint32_t* PointValue                            ///< [out] Returns the frequency in 1kHz units or voltage in millivolt
                                                         ///< units from the custom V-F curve at the specified zero-based index 
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesOverclockGetVFPointValues", "zes_overclock_handle_t hDomainHandle,zes_vf_type_t VFType,zes_vf_array_type_t VFArrayType,uint32_t PointIndex,uint32_t* PointValue");
+            context.binaryTrace->record(binaryTraceApiId, result, hDomainHandle, VFType, VFArrayType, PointIndex, PointValue);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesOverclockGetVFPointValues(";
@@ -913,10 +1193,20 @@ namespace validation_layer
         uint32_t PointValue                             ///< [in] Writes frequency in 1kHz units or voltage in millivolt units to
                                                         ///< custom V-F curve at the specified zero-based index 
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesOverclockSetVFPointValues", "zes_overclock_handle_t hDomainHandle,zes_vf_type_t VFType,uint32_t PointIndex,uint32_t PointValue");
+            context.binaryTrace->record(binaryTraceApiId, result, hDomainHandle, VFType, PointIndex, PointValue);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesOverclockSetVFPointValues(";
@@ -955,10 +1245,20 @@ namespace validation_layer
                                                         ///< available, then the driver shall only retrieve that number of
                                                         ///< component handles.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceEnumDiagnosticTestSuites", "zes_device_handle_t hDevice,uint32_t* pCount,zes_diag_handle_t* phDiagnostics");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pCount, phDiagnostics);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceEnumDiagnosticTestSuites(";
@@ -984,10 +1284,20 @@ namespace validation_layer
         zes_diag_properties_t* pProperties              ///< [in,out] Structure describing the properties of a diagnostics test
                                                         ///< suite
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDiagnosticsGetProperties", "zes_diag_handle_t hDiagnostics,zes_diag_properties_t* pProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hDiagnostics, pProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDiagnosticsGetProperties(";
@@ -1016,10 +1326,20 @@ namespace validation_layer
                                                         ///< if count is less than the number of tests that are available, then the
                                                         ///< driver shall only retrieve that number of tests.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDiagnosticsGetTests", "zes_diag_handle_t hDiagnostics,uint32_t* pCount,zes_diag_test_t* pTests");
+            context.binaryTrace->record(binaryTraceApiId, result, hDiagnostics, pCount, pTests);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDiagnosticsGetTests(";
@@ -1048,10 +1368,20 @@ namespace validation_layer
                                                         ///< ::ZES_DIAG_LAST_TEST_INDEX to complete all tests after the start test.
         zes_diag_result_t* pResult                      ///< [in,out] The result of the diagnostics
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDiagnosticsRunTests", "zes_diag_handle_t hDiagnostics,uint32_t startIndex,uint32_t endIndex,zes_diag_result_t* pResult");
+            context.binaryTrace->record(binaryTraceApiId, result, hDiagnostics, startIndex, endIndex, pResult);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDiagnosticsRunTests(";
@@ -1080,10 +1410,20 @@ namespace validation_layer
         zes_device_handle_t hDevice,                    ///< [in] Handle for the component.
         ze_bool_t* pAvailable                           ///< [out] ECC functionality is available (true)/unavailable (false).
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceEccAvailable", "zes_device_handle_t hDevice,ze_bool_t* pAvailable");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pAvailable);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceEccAvailable(";
@@ -1109,10 +1449,20 @@ namespace validation_layer
         zes_device_handle_t hDevice,                    ///< [in] Handle for the component.
         ze_bool_t* pConfigurable                        ///< [out] ECC can be enabled/disabled (true)/enabled/disabled (false).
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceEccConfigurable", "zes_device_handle_t hDevice,ze_bool_t* pConfigurable");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pConfigurable);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceEccConfigurable(";
@@ -1138,10 +1488,20 @@ namespace validation_layer
         zes_device_handle_t hDevice,                    ///< [in] Handle for the component.
         zes_device_ecc_properties_t* pState             ///< [out] ECC state, pending state, and pending action for state change.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceGetEccState", "zes_device_handle_t hDevice,zes_device_ecc_properties_t* pState");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pState);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceGetEccState(";
@@ -1168,10 +1528,20 @@ namespace validation_layer
         const zes_device_ecc_desc_t* newState,          ///< [in] Pointer to desired ECC state.
         zes_device_ecc_properties_t* pState             ///< [out] ECC state, pending state, and pending action for state change.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceSetEccState", "zes_device_handle_t hDevice,const zes_device_ecc_desc_t* newState,zes_device_ecc_properties_t* pState");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, newState, pState);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceSetEccState(";
@@ -1211,10 +1581,20 @@ namespace validation_layer
                                                         ///< available, then the driver shall only retrieve that number of
                                                         ///< component handles.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceEnumEngineGroups", "zes_device_handle_t hDevice,uint32_t* pCount,zes_engine_handle_t* phEngine");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pCount, phEngine);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceEnumEngineGroups(";
@@ -1239,10 +1619,20 @@ namespace validation_layer
         zes_engine_handle_t hEngine,                    ///< [in] Handle for the component.
         zes_engine_properties_t* pProperties            ///< [in,out] The properties for the specified engine group.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesEngineGetProperties", "zes_engine_handle_t hEngine,zes_engine_properties_t* pProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hEngine, pProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesEngineGetProperties(";
@@ -1264,10 +1654,20 @@ namespace validation_layer
         zes_engine_stats_t* pStats                      ///< [in,out] Will contain a snapshot of the engine group activity
                                                         ///< counters.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesEngineGetActivity", "zes_engine_handle_t hEngine,zes_engine_stats_t* pStats");
+            context.binaryTrace->record(binaryTraceApiId, result, hEngine, pStats);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesEngineGetActivity(";
@@ -1288,10 +1688,20 @@ namespace validation_layer
         zes_device_handle_t hDevice,                    ///< [in] The device handle.
         zes_event_type_flags_t events                   ///< [in] List of events to listen to.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceEventRegister", "zes_device_handle_t hDevice,zes_event_type_flags_t events");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, events);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceEventRegister(";
@@ -1328,10 +1738,20 @@ namespace validation_layer
                                                         ///< no event was received for a given device, the corresponding array
                                                         ///< entry will be zero.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDriverEventListen", "ze_driver_handle_t hDriver,uint32_t timeout,uint32_t count,zes_device_handle_t* phDevices,uint32_t* pNumDeviceEvents,zes_event_type_flags_t* pEvents");
+            context.binaryTrace->record(binaryTraceApiId, result, hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDriverEventListen(";
@@ -1384,10 +1804,20 @@ namespace validation_layer
                                                         ///< no event was received for a given device, the corresponding array
                                                         ///< entry will be zero.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDriverEventListenEx", "ze_driver_handle_t hDriver,uint64_t timeout,uint32_t count,zes_device_handle_t* phDevices,uint32_t* pNumDeviceEvents,zes_event_type_flags_t* pEvents");
+            context.binaryTrace->record(binaryTraceApiId, result, hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDriverEventListenEx(";
@@ -1434,10 +1864,20 @@ namespace validation_layer
                                                         ///< available, then the driver shall only retrieve that number of
                                                         ///< component handles.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceEnumFabricPorts", "zes_device_handle_t hDevice,uint32_t* pCount,zes_fabric_port_handle_t* phPort");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pCount, phPort);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceEnumFabricPorts(";
@@ -1462,10 +1902,20 @@ namespace validation_layer
         zes_fabric_port_handle_t hPort,                 ///< [in] Handle for the component.
         zes_fabric_port_properties_t* pProperties       ///< [in,out] Will contain properties of the Fabric Port.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFabricPortGetProperties", "zes_fabric_port_handle_t hPort,zes_fabric_port_properties_t* pProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hPort, pProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFabricPortGetProperties(";
@@ -1487,10 +1937,20 @@ namespace validation_layer
         zes_fabric_link_type_t* pLinkType               ///< [in,out] Will contain details about the link attached to the Fabric
                                                         ///< port.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFabricPortGetLinkType", "zes_fabric_port_handle_t hPort,zes_fabric_link_type_t* pLinkType");
+            context.binaryTrace->record(binaryTraceApiId, result, hPort, pLinkType);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFabricPortGetLinkType(";
@@ -1511,10 +1971,20 @@ namespace validation_layer
         zes_fabric_port_handle_t hPort,                 ///< [in] Handle for the component.
         zes_fabric_port_config_t* pConfig               ///< [in,out] Will contain configuration of the Fabric Port.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFabricPortGetConfig", "zes_fabric_port_handle_t hPort,zes_fabric_port_config_t* pConfig");
+            context.binaryTrace->record(binaryTraceApiId, result, hPort, pConfig);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFabricPortGetConfig(";
@@ -1535,10 +2005,20 @@ namespace validation_layer
         zes_fabric_port_handle_t hPort,                 ///< [in] Handle for the component.
         const zes_fabric_port_config_t* pConfig         ///< [in] Contains new configuration of the Fabric Port.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFabricPortSetConfig", "zes_fabric_port_handle_t hPort,const zes_fabric_port_config_t* pConfig");
+            context.binaryTrace->record(binaryTraceApiId, result, hPort, pConfig);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFabricPortSetConfig(";
@@ -1559,10 +2039,20 @@ namespace validation_layer
         zes_fabric_port_handle_t hPort,                 ///< [in] Handle for the component.
         zes_fabric_port_state_t* pState                 ///< [in,out] Will contain the current state of the Fabric Port
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFabricPortGetState", "zes_fabric_port_handle_t hPort,zes_fabric_port_state_t* pState");
+            context.binaryTrace->record(binaryTraceApiId, result, hPort, pState);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFabricPortGetState(";
@@ -1583,10 +2073,20 @@ namespace validation_layer
         zes_fabric_port_handle_t hPort,                 ///< [in] Handle for the component.
         zes_fabric_port_throughput_t* pThroughput       ///< [in,out] Will contain the Fabric port throughput counters.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFabricPortGetThroughput", "zes_fabric_port_handle_t hPort,zes_fabric_port_throughput_t* pThroughput");
+            context.binaryTrace->record(binaryTraceApiId, result, hPort, pThroughput);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFabricPortGetThroughput(";
@@ -1607,10 +2107,20 @@ namespace validation_layer
         zes_fabric_port_handle_t hPort,                 ///< [in] Handle for the component.
         zes_fabric_port_error_counters_t* pErrors       ///< [in,out] Will contain the Fabric port Error counters.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFabricPortGetFabricErrorCounters", "zes_fabric_port_handle_t hPort,zes_fabric_port_error_counters_t* pErrors");
+            context.binaryTrace->record(binaryTraceApiId, result, hPort, pErrors);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFabricPortGetFabricErrorCounters(";
@@ -1635,10 +2145,20 @@ namespace validation_layer
         zes_fabric_port_throughput_t** pThroughput      ///< [out][range(0, numPorts)] array of fabric port throughput counters
                                                         ///< from multiple ports of type ::zes_fabric_port_throughput_t.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFabricPortGetMultiPortThroughput", "zes_device_handle_t hDevice,uint32_t numPorts,zes_fabric_port_handle_t* phPort,zes_fabric_port_throughput_t** pThroughput");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, numPorts, phPort, pThroughput);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFabricPortGetMultiPortThroughput(";
@@ -1682,10 +2202,20 @@ namespace validation_layer
                                                         ///< available, then the driver shall only retrieve that number of
                                                         ///< component handles.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceEnumFans", "zes_device_handle_t hDevice,uint32_t* pCount,zes_fan_handle_t* phFan");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pCount, phFan);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceEnumFans(";
@@ -1710,10 +2240,20 @@ namespace validation_layer
         zes_fan_handle_t hFan,                          ///< [in] Handle for the component.
         zes_fan_properties_t* pProperties               ///< [in,out] Will contain the properties of the fan.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFanGetProperties", "zes_fan_handle_t hFan,zes_fan_properties_t* pProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hFan, pProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFanGetProperties(";
@@ -1734,10 +2274,20 @@ namespace validation_layer
         zes_fan_handle_t hFan,                          ///< [in] Handle for the component.
         zes_fan_config_t* pConfig                       ///< [in,out] Will contain the current configuration of the fan.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFanGetConfig", "zes_fan_handle_t hFan,zes_fan_config_t* pConfig");
+            context.binaryTrace->record(binaryTraceApiId, result, hFan, pConfig);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFanGetConfig(";
@@ -1757,10 +2307,20 @@ namespace validation_layer
         ze_result_t result,
         zes_fan_handle_t hFan                           ///< [in] Handle for the component.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFanSetDefaultMode", "zes_fan_handle_t hFan");
+            context.binaryTrace->record(binaryTraceApiId, result, hFan);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFanSetDefaultMode(";
@@ -1777,10 +2337,20 @@ namespace validation_layer
         zes_fan_handle_t hFan,                          ///< [in] Handle for the component.
         const zes_fan_speed_t* speed                    ///< [in] The fixed fan speed setting
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFanSetFixedSpeedMode", "zes_fan_handle_t hFan,const zes_fan_speed_t* speed");
+            context.binaryTrace->record(binaryTraceApiId, result, hFan, speed);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFanSetFixedSpeedMode(";
@@ -1801,10 +2371,20 @@ namespace validation_layer
         zes_fan_handle_t hFan,                          ///< [in] Handle for the component.
         const zes_fan_speed_table_t* speedTable         ///< [in] A table containing temperature/speed pairs.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFanSetSpeedTableMode", "zes_fan_handle_t hFan,const zes_fan_speed_table_t* speedTable");
+            context.binaryTrace->record(binaryTraceApiId, result, hFan, speedTable);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFanSetSpeedTableMode(";
@@ -1828,10 +2408,20 @@ namespace validation_layer
                                                         ///< requested. A value of -1 indicates that the fan speed cannot be
                                                         ///< measured.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFanGetState", "zes_fan_handle_t hFan,zes_fan_speed_units_t units,int32_t* pSpeed");
+            context.binaryTrace->record(binaryTraceApiId, result, hFan, units, pSpeed);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFanGetState(";
@@ -1866,10 +2456,20 @@ namespace validation_layer
                                                         ///< available, then the driver shall only retrieve that number of
                                                         ///< component handles.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceEnumFirmwares", "zes_device_handle_t hDevice,uint32_t* pCount,zes_firmware_handle_t* phFirmware");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pCount, phFirmware);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceEnumFirmwares(";
@@ -1895,10 +2495,20 @@ namespace validation_layer
         zes_firmware_properties_t* pProperties          ///< [in,out] Pointer to an array that will hold the properties of the
                                                         ///< firmware
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFirmwareGetProperties", "zes_firmware_handle_t hFirmware,zes_firmware_properties_t* pProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hFirmware, pProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFirmwareGetProperties(";
@@ -1920,10 +2530,20 @@ namespace validation_layer
         void* pImage,                                   ///< [in] Image of the new firmware to flash.
         uint32_t size                                   ///< [in] Size of the flash image.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFirmwareFlash", "zes_firmware_handle_t hFirmware,void* pImage,uint32_t size");
+            context.binaryTrace->record(binaryTraceApiId, result, hFirmware, pImage, size);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFirmwareFlash(";
@@ -1948,10 +2568,20 @@ namespace validation_layer
         zes_firmware_handle_t hFirmware,                ///< [in] Handle for the component.
         uint32_t* pCompletionPercent                    ///< [in,out] Pointer to the Completion Percentage of Firmware Update
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFirmwareGetFlashProgress", "zes_firmware_handle_t hFirmware,uint32_t* pCompletionPercent");
+            context.binaryTrace->record(binaryTraceApiId, result, hFirmware, pCompletionPercent);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFirmwareGetFlashProgress(";
@@ -1973,10 +2603,20 @@ namespace validation_layer
         size_t* pSize,                                  ///< [in,out] size of firmware log
         char* pFirmwareLog                              ///< [in,out][optional] pointer to null-terminated string of the log.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFirmwareGetConsoleLogs", "zes_firmware_handle_t hFirmware,size_t* pSize,char* pFirmwareLog");
+            context.binaryTrace->record(binaryTraceApiId, result, hFirmware, pSize, pFirmwareLog);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFirmwareGetConsoleLogs(";
@@ -2011,10 +2651,20 @@ namespace validation_layer
                                                         ///< available, then the driver shall only retrieve that number of
                                                         ///< component handles.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceEnumFrequencyDomains", "zes_device_handle_t hDevice,uint32_t* pCount,zes_freq_handle_t* phFrequency");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pCount, phFrequency);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceEnumFrequencyDomains(";
@@ -2039,10 +2689,20 @@ namespace validation_layer
         zes_freq_handle_t hFrequency,                   ///< [in] Handle for the component.
         zes_freq_properties_t* pProperties              ///< [in,out] The frequency properties for the specified domain.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFrequencyGetProperties", "zes_freq_handle_t hFrequency,zes_freq_properties_t* pProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hFrequency, pProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFrequencyGetProperties(";
@@ -2071,10 +2731,20 @@ namespace validation_layer
                                                         ///< if count is less than the number of frequencies that are available,
                                                         ///< then the driver shall only retrieve that number of frequencies.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFrequencyGetAvailableClocks", "zes_freq_handle_t hFrequency,uint32_t* pCount,double* phFrequency");
+            context.binaryTrace->record(binaryTraceApiId, result, hFrequency, pCount, phFrequency);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFrequencyGetAvailableClocks(";
@@ -2100,10 +2770,20 @@ namespace validation_layer
         zes_freq_range_t* pLimits                       ///< [in,out] The range between which the hardware can operate for the
                                                         ///< specified domain.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFrequencyGetRange", "zes_freq_handle_t hFrequency,zes_freq_range_t* pLimits");
+            context.binaryTrace->record(binaryTraceApiId, result, hFrequency, pLimits);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFrequencyGetRange(";
@@ -2125,10 +2805,20 @@ namespace validation_layer
         const zes_freq_range_t* pLimits                 ///< [in] The limits between which the hardware can operate for the
                                                         ///< specified domain.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFrequencySetRange", "zes_freq_handle_t hFrequency,const zes_freq_range_t* pLimits");
+            context.binaryTrace->record(binaryTraceApiId, result, hFrequency, pLimits);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFrequencySetRange(";
@@ -2149,10 +2839,20 @@ namespace validation_layer
         zes_freq_handle_t hFrequency,                   ///< [in] Handle for the component.
         zes_freq_state_t* pState                        ///< [in,out] Frequency state for the specified domain.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFrequencyGetState", "zes_freq_handle_t hFrequency,zes_freq_state_t* pState");
+            context.binaryTrace->record(binaryTraceApiId, result, hFrequency, pState);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFrequencyGetState(";
@@ -2174,10 +2874,20 @@ namespace validation_layer
         zes_freq_throttle_time_t* pThrottleTime         ///< [in,out] Will contain a snapshot of the throttle time counters for the
                                                         ///< specified domain.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFrequencyGetThrottleTime", "zes_freq_handle_t hFrequency,zes_freq_throttle_time_t* pThrottleTime");
+            context.binaryTrace->record(binaryTraceApiId, result, hFrequency, pThrottleTime);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFrequencyGetThrottleTime(";
@@ -2198,10 +2908,20 @@ namespace validation_layer
         zes_freq_handle_t hFrequency,                   ///< [in] Handle for the component.
         zes_oc_capabilities_t* pOcCapabilities          ///< [in,out] Pointer to the capabilities structure.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFrequencyOcGetCapabilities", "zes_freq_handle_t hFrequency,zes_oc_capabilities_t* pOcCapabilities");
+            context.binaryTrace->record(binaryTraceApiId, result, hFrequency, pOcCapabilities);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFrequencyOcGetCapabilities(";
@@ -2225,10 +2945,20 @@ namespace validation_layer
                                                         ///< cannot be greater than the `maxOcFrequency` member of
                                                         ///< ::zes_oc_capabilities_t.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFrequencyOcGetFrequencyTarget", "zes_freq_handle_t hFrequency,double* pCurrentOcFrequency");
+            context.binaryTrace->record(binaryTraceApiId, result, hFrequency, pCurrentOcFrequency);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFrequencyOcGetFrequencyTarget(";
@@ -2257,10 +2987,20 @@ namespace validation_layer
                                                         ///< cannot be greater than the `maxOcFrequency` member of
                                                         ///< ::zes_oc_capabilities_t.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFrequencyOcSetFrequencyTarget", "zes_freq_handle_t hFrequency,double CurrentOcFrequency");
+            context.binaryTrace->record(binaryTraceApiId, result, hFrequency, CurrentOcFrequency);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFrequencyOcSetFrequencyTarget(";
@@ -2286,10 +3026,20 @@ namespace validation_layer
                                                         ///< Valid range is between the `minOcVoltageOffset` and
                                                         ///< `maxOcVoltageOffset` members of ::zes_oc_capabilities_t.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFrequencyOcGetVoltageTarget", "zes_freq_handle_t hFrequency,double* pCurrentVoltageTarget,double* pCurrentVoltageOffset");
+            context.binaryTrace->record(binaryTraceApiId, result, hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFrequencyOcGetVoltageTarget(";
@@ -2329,10 +3079,20 @@ namespace validation_layer
                                                         ///< Valid range is between the `minOcVoltageOffset` and
                                                         ///< `maxOcVoltageOffset` members of ::zes_oc_capabilities_t.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFrequencyOcSetVoltageTarget", "zes_freq_handle_t hFrequency,double CurrentVoltageTarget,double CurrentVoltageOffset");
+            context.binaryTrace->record(binaryTraceApiId, result, hFrequency, CurrentVoltageTarget, CurrentVoltageOffset);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFrequencyOcSetVoltageTarget(";
@@ -2357,10 +3117,20 @@ namespace validation_layer
         zes_freq_handle_t hFrequency,                   ///< [in] Handle for the component.
         zes_oc_mode_t CurrentOcMode                     ///< [in] Current Overclocking Mode ::zes_oc_mode_t.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFrequencyOcSetMode", "zes_freq_handle_t hFrequency,zes_oc_mode_t CurrentOcMode");
+            context.binaryTrace->record(binaryTraceApiId, result, hFrequency, CurrentOcMode);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFrequencyOcSetMode(";
@@ -2381,10 +3151,20 @@ namespace validation_layer
         zes_freq_handle_t hFrequency,                   ///< [in] Handle for the component.
         zes_oc_mode_t* pCurrentOcMode                   ///< [out] Current Overclocking Mode ::zes_oc_mode_t.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFrequencyOcGetMode", "zes_freq_handle_t hFrequency,zes_oc_mode_t* pCurrentOcMode");
+            context.binaryTrace->record(binaryTraceApiId, result, hFrequency, pCurrentOcMode);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFrequencyOcGetMode(";
@@ -2411,10 +3191,20 @@ namespace validation_layer
         double* pOcIccMax                               ///< [in,out] Will contain the maximum current limit in Amperes on
                                                         ///< successful return.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFrequencyOcGetIccMax", "zes_freq_handle_t hFrequency,double* pOcIccMax");
+            context.binaryTrace->record(binaryTraceApiId, result, hFrequency, pOcIccMax);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFrequencyOcGetIccMax(";
@@ -2435,10 +3225,20 @@ namespace validation_layer
         zes_freq_handle_t hFrequency,                   ///< [in] Handle for the component.
         double ocIccMax                                 ///< [in] The new maximum current limit in Amperes.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFrequencyOcSetIccMax", "zes_freq_handle_t hFrequency,double ocIccMax");
+            context.binaryTrace->record(binaryTraceApiId, result, hFrequency, ocIccMax);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFrequencyOcSetIccMax(";
@@ -2460,10 +3260,20 @@ namespace validation_layer
         double* pOcTjMax                                ///< [in,out] Will contain the maximum temperature limit in degrees Celsius
                                                         ///< on successful return.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFrequencyOcGetTjMax", "zes_freq_handle_t hFrequency,double* pOcTjMax");
+            context.binaryTrace->record(binaryTraceApiId, result, hFrequency, pOcTjMax);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFrequencyOcGetTjMax(";
@@ -2484,10 +3294,20 @@ namespace validation_layer
         zes_freq_handle_t hFrequency,                   ///< [in] Handle for the component.
         double ocTjMax                                  ///< [in] The new maximum temperature limit in degrees Celsius.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFrequencyOcSetTjMax", "zes_freq_handle_t hFrequency,double ocTjMax");
+            context.binaryTrace->record(binaryTraceApiId, result, hFrequency, ocTjMax);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFrequencyOcSetTjMax(";
@@ -2518,10 +3338,20 @@ namespace validation_layer
                                                         ///< available, then the driver shall only retrieve that number of
                                                         ///< component handles.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceEnumLeds", "zes_device_handle_t hDevice,uint32_t* pCount,zes_led_handle_t* phLed");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pCount, phLed);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceEnumLeds(";
@@ -2546,10 +3376,20 @@ namespace validation_layer
         zes_led_handle_t hLed,                          ///< [in] Handle for the component.
         zes_led_properties_t* pProperties               ///< [in,out] Will contain the properties of the LED.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesLedGetProperties", "zes_led_handle_t hLed,zes_led_properties_t* pProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hLed, pProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesLedGetProperties(";
@@ -2570,10 +3410,20 @@ namespace validation_layer
         zes_led_handle_t hLed,                          ///< [in] Handle for the component.
         zes_led_state_t* pState                         ///< [in,out] Will contain the current state of the LED.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesLedGetState", "zes_led_handle_t hLed,zes_led_state_t* pState");
+            context.binaryTrace->record(binaryTraceApiId, result, hLed, pState);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesLedGetState(";
@@ -2594,10 +3444,20 @@ namespace validation_layer
         zes_led_handle_t hLed,                          ///< [in] Handle for the component.
         ze_bool_t enable                                ///< [in] Set to TRUE to turn the LED on, FALSE to turn off.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesLedSetState", "zes_led_handle_t hLed,ze_bool_t enable");
+            context.binaryTrace->record(binaryTraceApiId, result, hLed, enable);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesLedSetState(";
@@ -2618,10 +3478,20 @@ namespace validation_layer
         zes_led_handle_t hLed,                          ///< [in] Handle for the component.
         const zes_led_color_t* pColor                   ///< [in] New color of the LED.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesLedSetColor", "zes_led_handle_t hLed,const zes_led_color_t* pColor");
+            context.binaryTrace->record(binaryTraceApiId, result, hLed, pColor);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesLedSetColor(";
@@ -2652,10 +3522,20 @@ namespace validation_layer
                                                         ///< available, then the driver shall only retrieve that number of
                                                         ///< component handles.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceEnumMemoryModules", "zes_device_handle_t hDevice,uint32_t* pCount,zes_mem_handle_t* phMemory");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pCount, phMemory);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceEnumMemoryModules(";
@@ -2680,10 +3560,20 @@ namespace validation_layer
         zes_mem_handle_t hMemory,                       ///< [in] Handle for the component.
         zes_mem_properties_t* pProperties               ///< [in,out] Will contain memory properties.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesMemoryGetProperties", "zes_mem_handle_t hMemory,zes_mem_properties_t* pProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hMemory, pProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesMemoryGetProperties(";
@@ -2704,10 +3594,20 @@ namespace validation_layer
         zes_mem_handle_t hMemory,                       ///< [in] Handle for the component.
         zes_mem_state_t* pState                         ///< [in,out] Will contain the current health and allocated memory.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesMemoryGetState", "zes_mem_handle_t hMemory,zes_mem_state_t* pState");
+            context.binaryTrace->record(binaryTraceApiId, result, hMemory, pState);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesMemoryGetState(";
@@ -2729,10 +3629,20 @@ namespace validation_layer
         zes_mem_bandwidth_t* pBandwidth                 ///< [in,out] Will contain the total number of bytes read from and written
                                                         ///< to memory, as well as the current maximum bandwidth.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesMemoryGetBandwidth", "zes_mem_handle_t hMemory,zes_mem_bandwidth_t* pBandwidth");
+            context.binaryTrace->record(binaryTraceApiId, result, hMemory, pBandwidth);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesMemoryGetBandwidth(";
@@ -2763,10 +3673,20 @@ namespace validation_layer
                                                         ///< available, then the driver shall only retrieve that number of
                                                         ///< component handles.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceEnumPerformanceFactorDomains", "zes_device_handle_t hDevice,uint32_t* pCount,zes_perf_handle_t* phPerf");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pCount, phPerf);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceEnumPerformanceFactorDomains(";
@@ -2792,10 +3712,20 @@ namespace validation_layer
         zes_perf_properties_t* pProperties              ///< [in,out] Will contain information about the specified Performance
                                                         ///< Factor domain.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesPerformanceFactorGetProperties", "zes_perf_handle_t hPerf,zes_perf_properties_t* pProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hPerf, pProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesPerformanceFactorGetProperties(";
@@ -2817,10 +3747,20 @@ namespace validation_layer
         double* pFactor                                 ///< [in,out] Will contain the actual Performance Factor being used by the
                                                         ///< hardware (may not be the same as the requested Performance Factor).
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesPerformanceFactorGetConfig", "zes_perf_handle_t hPerf,double* pFactor");
+            context.binaryTrace->record(binaryTraceApiId, result, hPerf, pFactor);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesPerformanceFactorGetConfig(";
@@ -2841,10 +3781,20 @@ namespace validation_layer
         zes_perf_handle_t hPerf,                        ///< [in] Handle for the Performance Factor domain.
         double factor                                   ///< [in] The new Performance Factor.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesPerformanceFactorSetConfig", "zes_perf_handle_t hPerf,double factor");
+            context.binaryTrace->record(binaryTraceApiId, result, hPerf, factor);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesPerformanceFactorSetConfig(";
@@ -2875,10 +3825,20 @@ namespace validation_layer
                                                         ///< available, then the driver shall only retrieve that number of
                                                         ///< component handles.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceEnumPowerDomains", "zes_device_handle_t hDevice,uint32_t* pCount,zes_pwr_handle_t* phPower");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pCount, phPower);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceEnumPowerDomains(";
@@ -2903,10 +3863,20 @@ namespace validation_layer
         zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
         zes_pwr_handle_t* phPower                       ///< [in,out] power domain handle for the entire PCIe card.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceGetCardPowerDomain", "zes_device_handle_t hDevice,zes_pwr_handle_t* phPower");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, phPower);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceGetCardPowerDomain(";
@@ -2927,10 +3897,20 @@ namespace validation_layer
         zes_pwr_handle_t hPower,                        ///< [in] Handle for the component.
         zes_power_properties_t* pProperties             ///< [in,out] Structure that will contain property data.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesPowerGetProperties", "zes_pwr_handle_t hPower,zes_power_properties_t* pProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hPower, pProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesPowerGetProperties(";
@@ -2952,10 +3932,20 @@ namespace validation_layer
         zes_power_energy_counter_t* pEnergy             ///< [in,out] Will contain the latest snapshot of the energy counter and
                                                         ///< timestamp when the last counter value was measured.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesPowerGetEnergyCounter", "zes_pwr_handle_t hPower,zes_power_energy_counter_t* pEnergy");
+            context.binaryTrace->record(binaryTraceApiId, result, hPower, pEnergy);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesPowerGetEnergyCounter(";
@@ -2981,10 +3971,20 @@ namespace validation_layer
         zes_power_peak_limit_t* pPeak                   ///< [in,out][optional] The peak power limit. If this is null, the peak
                                                         ///< power limits will not be returned.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesPowerGetLimits", "zes_pwr_handle_t hPower,zes_power_sustained_limit_t* pSustained,zes_power_burst_limit_t* pBurst,zes_power_peak_limit_t* pPeak");
+            context.binaryTrace->record(binaryTraceApiId, result, hPower, pSustained, pBurst, pPeak);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesPowerGetLimits(";
@@ -3018,10 +4018,20 @@ namespace validation_layer
         const zes_power_peak_limit_t* pPeak             ///< [in][optional] The peak power limit. If this is null, no changes will
                                                         ///< be made to the peak power limits.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesPowerSetLimits", "zes_pwr_handle_t hPower,const zes_power_sustained_limit_t* pSustained,const zes_power_burst_limit_t* pBurst,const zes_power_peak_limit_t* pPeak");
+            context.binaryTrace->record(binaryTraceApiId, result, hPower, pSustained, pBurst, pPeak);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesPowerSetLimits(";
@@ -3051,10 +4061,20 @@ namespace validation_layer
         zes_energy_threshold_t* pThreshold              ///< [in,out] Returns information about the energy threshold setting -
                                                         ///< enabled/energy threshold/process ID.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesPowerGetEnergyThreshold", "zes_pwr_handle_t hPower,zes_energy_threshold_t* pThreshold");
+            context.binaryTrace->record(binaryTraceApiId, result, hPower, pThreshold);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesPowerGetEnergyThreshold(";
@@ -3075,10 +4095,20 @@ namespace validation_layer
         zes_pwr_handle_t hPower,                        ///< [in] Handle for the component.
         double threshold                                ///< [in] The energy threshold to be set in joules.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesPowerSetEnergyThreshold", "zes_pwr_handle_t hPower,double threshold");
+            context.binaryTrace->record(binaryTraceApiId, result, hPower, threshold);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesPowerSetEnergyThreshold(";
@@ -3100,10 +4130,20 @@ namespace validation_layer
         uint32_t* pInstantPower,                        ///< [out] Returns the instant power usage in milliwatts.
         uint32_t* pAveragePower                         ///< [out] Returns the average power usage in milliwatts.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesPowerGetUsage", "zes_pwr_handle_t hPower,uint32_t* pInstantPower,uint32_t* pAveragePower");
+            context.binaryTrace->record(binaryTraceApiId, result, hPower, pInstantPower, pAveragePower);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesPowerGetUsage(";
@@ -3148,10 +4188,20 @@ namespace validation_layer
                                                         ///< available, then the driver shall only retrieve that number of
                                                         ///< component handles.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceEnumPsus", "zes_device_handle_t hDevice,uint32_t* pCount,zes_psu_handle_t* phPsu");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pCount, phPsu);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceEnumPsus(";
@@ -3176,10 +4226,20 @@ namespace validation_layer
         zes_psu_handle_t hPsu,                          ///< [in] Handle for the component.
         zes_psu_properties_t* pProperties               ///< [in,out] Will contain the properties of the power supply.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesPsuGetProperties", "zes_psu_handle_t hPsu,zes_psu_properties_t* pProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hPsu, pProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesPsuGetProperties(";
@@ -3200,10 +4260,20 @@ namespace validation_layer
         zes_psu_handle_t hPsu,                          ///< [in] Handle for the component.
         zes_psu_state_t* pState                         ///< [in,out] Will contain the current state of the power supply.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesPsuGetState", "zes_psu_handle_t hPsu,zes_psu_state_t* pState");
+            context.binaryTrace->record(binaryTraceApiId, result, hPsu, pState);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesPsuGetState(";
@@ -3234,10 +4304,20 @@ namespace validation_layer
                                                         ///< available, then the driver shall only retrieve that number of
                                                         ///< component handles.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceEnumRasErrorSets", "zes_device_handle_t hDevice,uint32_t* pCount,zes_ras_handle_t* phRas");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pCount, phRas);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceEnumRasErrorSets(";
@@ -3262,10 +4342,20 @@ namespace validation_layer
         zes_ras_handle_t hRas,                          ///< [in] Handle for the component.
         zes_ras_properties_t* pProperties               ///< [in,out] Structure describing RAS properties
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesRasGetProperties", "zes_ras_handle_t hRas,zes_ras_properties_t* pProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hRas, pProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesRasGetProperties(";
@@ -3287,10 +4377,20 @@ namespace validation_layer
         zes_ras_config_t* pConfig                       ///< [in,out] Will be populed with the current RAS configuration -
                                                         ///< thresholds used to trigger events
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesRasGetConfig", "zes_ras_handle_t hRas,zes_ras_config_t* pConfig");
+            context.binaryTrace->record(binaryTraceApiId, result, hRas, pConfig);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesRasGetConfig(";
@@ -3311,10 +4411,20 @@ namespace validation_layer
         zes_ras_handle_t hRas,                          ///< [in] Handle for the component.
         const zes_ras_config_t* pConfig                 ///< [in] Change the RAS configuration - thresholds used to trigger events
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesRasSetConfig", "zes_ras_handle_t hRas,const zes_ras_config_t* pConfig");
+            context.binaryTrace->record(binaryTraceApiId, result, hRas, pConfig);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesRasSetConfig(";
@@ -3336,10 +4446,20 @@ namespace validation_layer
         ze_bool_t clear,                                ///< [in] Set to 1 to clear the counters of this type
         zes_ras_state_t* pState                         ///< [in,out] Breakdown of where errors have occurred
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesRasGetState", "zes_ras_handle_t hRas,ze_bool_t clear,zes_ras_state_t* pState");
+            context.binaryTrace->record(binaryTraceApiId, result, hRas, clear, pState);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesRasGetState(";
@@ -3374,10 +4494,20 @@ namespace validation_layer
                                                         ///< available, then the driver shall only retrieve that number of
                                                         ///< component handles.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceEnumSchedulers", "zes_device_handle_t hDevice,uint32_t* pCount,zes_sched_handle_t* phScheduler");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pCount, phScheduler);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceEnumSchedulers(";
@@ -3402,10 +4532,20 @@ namespace validation_layer
         zes_sched_handle_t hScheduler,                  ///< [in] Handle for the component.
         zes_sched_properties_t* pProperties             ///< [in,out] Structure that will contain property data.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesSchedulerGetProperties", "zes_sched_handle_t hScheduler,zes_sched_properties_t* pProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hScheduler, pProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesSchedulerGetProperties(";
@@ -3426,10 +4566,20 @@ namespace validation_layer
         zes_sched_handle_t hScheduler,                  ///< [in] Sysman handle for the component.
         zes_sched_mode_t* pMode                         ///< [in,out] Will contain the current scheduler mode.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesSchedulerGetCurrentMode", "zes_sched_handle_t hScheduler,zes_sched_mode_t* pMode");
+            context.binaryTrace->record(binaryTraceApiId, result, hScheduler, pMode);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesSchedulerGetCurrentMode(";
@@ -3452,10 +4602,20 @@ namespace validation_layer
                                                         ///< this mode, otherwise it will return the current properties.
         zes_sched_timeout_properties_t* pConfig         ///< [in,out] Will contain the current parameters for this mode.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesSchedulerGetTimeoutModeProperties", "zes_sched_handle_t hScheduler,ze_bool_t getDefaults,zes_sched_timeout_properties_t* pConfig");
+            context.binaryTrace->record(binaryTraceApiId, result, hScheduler, getDefaults, pConfig);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesSchedulerGetTimeoutModeProperties(";
@@ -3482,10 +4642,20 @@ namespace validation_layer
                                                         ///< this mode, otherwise it will return the current properties.
         zes_sched_timeslice_properties_t* pConfig       ///< [in,out] Will contain the current parameters for this mode.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesSchedulerGetTimesliceModeProperties", "zes_sched_handle_t hScheduler,ze_bool_t getDefaults,zes_sched_timeslice_properties_t* pConfig");
+            context.binaryTrace->record(binaryTraceApiId, result, hScheduler, getDefaults, pConfig);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesSchedulerGetTimesliceModeProperties(";
@@ -3512,10 +4682,20 @@ namespace validation_layer
         ze_bool_t* pNeedReload                          ///< [in,out] Will be set to TRUE if a device driver reload is needed to
                                                         ///< apply the new scheduler mode.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesSchedulerSetTimeoutMode", "zes_sched_handle_t hScheduler,zes_sched_timeout_properties_t* pProperties,ze_bool_t* pNeedReload");
+            context.binaryTrace->record(binaryTraceApiId, result, hScheduler, pProperties, pNeedReload);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesSchedulerSetTimeoutMode(";
@@ -3542,10 +4722,20 @@ namespace validation_layer
         ze_bool_t* pNeedReload                          ///< [in,out] Will be set to TRUE if a device driver reload is needed to
                                                         ///< apply the new scheduler mode.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesSchedulerSetTimesliceMode", "zes_sched_handle_t hScheduler,zes_sched_timeslice_properties_t* pProperties,ze_bool_t* pNeedReload");
+            context.binaryTrace->record(binaryTraceApiId, result, hScheduler, pProperties, pNeedReload);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesSchedulerSetTimesliceMode(";
@@ -3571,10 +4761,20 @@ namespace validation_layer
         ze_bool_t* pNeedReload                          ///< [in,out] Will be set to TRUE if a device driver reload is needed to
                                                         ///< apply the new scheduler mode.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesSchedulerSetExclusiveMode", "zes_sched_handle_t hScheduler,ze_bool_t* pNeedReload");
+            context.binaryTrace->record(binaryTraceApiId, result, hScheduler, pNeedReload);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesSchedulerSetExclusiveMode(";
@@ -3596,10 +4796,20 @@ namespace validation_layer
         ze_bool_t* pNeedReload                          ///< [in,out] Will be set to TRUE if a device driver reload is needed to
                                                         ///< apply the new scheduler mode.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesSchedulerSetComputeUnitDebugMode", "zes_sched_handle_t hScheduler,ze_bool_t* pNeedReload");
+            context.binaryTrace->record(binaryTraceApiId, result, hScheduler, pNeedReload);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesSchedulerSetComputeUnitDebugMode(";
@@ -3630,10 +4840,20 @@ namespace validation_layer
                                                         ///< available, then the driver shall only retrieve that number of
                                                         ///< component handles.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceEnumStandbyDomains", "zes_device_handle_t hDevice,uint32_t* pCount,zes_standby_handle_t* phStandby");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pCount, phStandby);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceEnumStandbyDomains(";
@@ -3658,10 +4878,20 @@ namespace validation_layer
         zes_standby_handle_t hStandby,                  ///< [in] Handle for the component.
         zes_standby_properties_t* pProperties           ///< [in,out] Will contain the standby hardware properties.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesStandbyGetProperties", "zes_standby_handle_t hStandby,zes_standby_properties_t* pProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hStandby, pProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesStandbyGetProperties(";
@@ -3682,10 +4912,20 @@ namespace validation_layer
         zes_standby_handle_t hStandby,                  ///< [in] Handle for the component.
         zes_standby_promo_mode_t* pMode                 ///< [in,out] Will contain the current standby mode.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesStandbyGetMode", "zes_standby_handle_t hStandby,zes_standby_promo_mode_t* pMode");
+            context.binaryTrace->record(binaryTraceApiId, result, hStandby, pMode);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesStandbyGetMode(";
@@ -3706,10 +4946,20 @@ namespace validation_layer
         zes_standby_handle_t hStandby,                  ///< [in] Handle for the component.
         zes_standby_promo_mode_t mode                   ///< [in] New standby mode.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesStandbySetMode", "zes_standby_handle_t hStandby,zes_standby_promo_mode_t mode");
+            context.binaryTrace->record(binaryTraceApiId, result, hStandby, mode);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesStandbySetMode(";
@@ -3740,10 +4990,20 @@ namespace validation_layer
                                                         ///< available, then the driver shall only retrieve that number of
                                                         ///< component handles.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceEnumTemperatureSensors", "zes_device_handle_t hDevice,uint32_t* pCount,zes_temp_handle_t* phTemperature");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pCount, phTemperature);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceEnumTemperatureSensors(";
@@ -3768,10 +5028,20 @@ namespace validation_layer
         zes_temp_handle_t hTemperature,                 ///< [in] Handle for the component.
         zes_temp_properties_t* pProperties              ///< [in,out] Will contain the temperature sensor properties.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesTemperatureGetProperties", "zes_temp_handle_t hTemperature,zes_temp_properties_t* pProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hTemperature, pProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesTemperatureGetProperties(";
@@ -3792,10 +5062,20 @@ namespace validation_layer
         zes_temp_handle_t hTemperature,                 ///< [in] Handle for the component.
         zes_temp_config_t* pConfig                      ///< [in,out] Returns current configuration.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesTemperatureGetConfig", "zes_temp_handle_t hTemperature,zes_temp_config_t* pConfig");
+            context.binaryTrace->record(binaryTraceApiId, result, hTemperature, pConfig);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesTemperatureGetConfig(";
@@ -3816,10 +5096,20 @@ namespace validation_layer
         zes_temp_handle_t hTemperature,                 ///< [in] Handle for the component.
         const zes_temp_config_t* pConfig                ///< [in] New configuration.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesTemperatureSetConfig", "zes_temp_handle_t hTemperature,const zes_temp_config_t* pConfig");
+            context.binaryTrace->record(binaryTraceApiId, result, hTemperature, pConfig);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesTemperatureSetConfig(";
@@ -3841,10 +5131,20 @@ namespace validation_layer
         double* pTemperature                            ///< [in,out] Will contain the temperature read from the specified sensor
                                                         ///< in degrees Celsius.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesTemperatureGetState", "zes_temp_handle_t hTemperature,double* pTemperature");
+            context.binaryTrace->record(binaryTraceApiId, result, hTemperature, pTemperature);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesTemperatureGetState(";
@@ -3873,10 +5173,20 @@ namespace validation_layer
                                                         ///< this type that are available, then the driver shall only retrieve that
                                                         ///< number of components.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesPowerGetLimitsExt", "zes_pwr_handle_t hPower,uint32_t* pCount,zes_power_limit_ext_desc_t* pSustained");
+            context.binaryTrace->record(binaryTraceApiId, result, hPower, pCount, pSustained);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesPowerGetLimitsExt(";
@@ -3902,10 +5212,20 @@ namespace validation_layer
         uint32_t* pCount,                               ///< [in] Pointer to the number of power limit descriptors.
         zes_power_limit_ext_desc_t* pSustained          ///< [in][optional][range(0, *pCount)] Array of power limit descriptors.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesPowerSetLimitsExt", "zes_pwr_handle_t hPower,uint32_t* pCount,zes_power_limit_ext_desc_t* pSustained");
+            context.binaryTrace->record(binaryTraceApiId, result, hPower, pCount, pSustained);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesPowerSetLimitsExt(";
@@ -3930,10 +5250,20 @@ namespace validation_layer
         zes_pwr_handle_t hPower,                        ///< [in] Power domain handle instance.
         uint32_t* pLimit                                ///< [out] Returns limit value in milliwatts for given power domain.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesPowerGetLimitsExt2", "zes_pwr_handle_t hPower,uint32_t* pLimit");
+            context.binaryTrace->record(binaryTraceApiId, result, hPower, pLimit);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesPowerGetLimitsExt2(";
@@ -3959,10 +5289,20 @@ namespace validation_layer
         zes_pwr_handle_t hPower,                        ///< [in] Power domain handle instance.
         const uint32_t limit                            ///< [in] Limit value in milliwatts to be set for given power domain.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesPowerSetLimitsExt2", "zes_pwr_handle_t hPower,const uint32_t limit");
+            context.binaryTrace->record(binaryTraceApiId, result, hPower, limit);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesPowerSetLimitsExt2(";
@@ -3996,10 +5336,20 @@ namespace validation_layer
                                                         ///< PF at index 0 of the vector followed by user provided pCount-1 number
                                                         ///< of VF engine stats.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesEngineGetActivityExt", "zes_engine_handle_t hEngine,uint32_t* pCount,zes_engine_stats_t* pStats");
+            context.binaryTrace->record(binaryTraceApiId, result, hEngine, pCount, pStats);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesEngineGetActivityExt(";
@@ -4032,10 +5382,20 @@ namespace validation_layer
                                                         ///< if count is less than the number of RAS states available, then driver
                                                         ///< shall only retrieve that number of RAS states.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesRasGetStateExp", "zes_ras_handle_t hRas,uint32_t* pCount,zes_ras_state_exp_t* pState");
+            context.binaryTrace->record(binaryTraceApiId, result, hRas, pCount, pState);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesRasGetStateExp(";
@@ -4060,10 +5420,20 @@ namespace validation_layer
         zes_ras_handle_t hRas,                          ///< [in] Handle for the component.
         zes_ras_error_category_exp_t category           ///< [in] category for which error counter is to be cleared.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesRasClearStateExp", "zes_ras_handle_t hRas,zes_ras_error_category_exp_t category");
+            context.binaryTrace->record(binaryTraceApiId, result, hRas, category);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesRasClearStateExp(";
@@ -4090,10 +5460,20 @@ namespace validation_layer
                                                         ///< if count is less than the number of categories supported, then driver
                                                         ///< shall only retrieve that number of categories.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesRasGetSupportedCategoriesExp", "zes_ras_handle_t hRas,uint32_t* pCount,zes_ras_error_category_exp_t* pCategories");
+            context.binaryTrace->record(binaryTraceApiId, result, hRas, pCount, pCategories);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesRasGetSupportedCategoriesExp(";
@@ -4121,10 +5501,20 @@ namespace validation_layer
         zes_ras_state_exp2_t* pState                    ///< [out][range(0, count)] Array of RAS error states. Caller must
                                                         ///< initialize stype and pNext for each element.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesRasGetStateExp2", "zes_ras_handle_t hRas,const uint32_t count,const zes_ras_error_category_exp_t* pCategories,zes_ras_state_exp2_t* pState");
+            context.binaryTrace->record(binaryTraceApiId, result, hRas, count, pCategories, pState);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesRasGetStateExp2(";
@@ -4161,10 +5551,20 @@ namespace validation_layer
                                                         ///< The caller should set the category field for each entry to specify
                                                         ///< which categories to query.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesRasGetConfigExp", "zes_ras_handle_t hRas,const uint32_t count,zes_ras_config_exp_t* pConfig");
+            context.binaryTrace->record(binaryTraceApiId, result, hRas, count, pConfig);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesRasGetConfigExp(";
@@ -4191,10 +5591,20 @@ namespace validation_layer
         const zes_ras_config_exp_t* pConfig             ///< [in][range(0, count)] array of RAS configuration structures specifying
                                                         ///< thresholds for different error categories.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesRasSetConfigExp", "zes_ras_handle_t hRas,const uint32_t count,const zes_ras_config_exp_t* pConfig");
+            context.binaryTrace->record(binaryTraceApiId, result, hRas, count, pConfig);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesRasSetConfigExp(";
@@ -4220,10 +5630,20 @@ namespace validation_layer
         char* pVersion                                  ///< [in,out] NULL terminated string value. The string "unknown" will be
                                                         ///< returned if this property cannot be determined.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFirmwareGetSecurityVersionExp", "zes_firmware_handle_t hFirmware,char* pVersion");
+            context.binaryTrace->record(binaryTraceApiId, result, hFirmware, pVersion);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFirmwareGetSecurityVersionExp(";
@@ -4243,10 +5663,20 @@ namespace validation_layer
         ze_result_t result,
         zes_firmware_handle_t hFirmware                 ///< [in] Handle for the component.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesFirmwareSetSecurityVersionExp", "zes_firmware_handle_t hFirmware");
+            context.binaryTrace->record(binaryTraceApiId, result, hFirmware);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesFirmwareSetSecurityVersionExp(";
@@ -4271,10 +5701,20 @@ namespace validation_layer
                                                         ///< if count is less than the number of sysman sub devices available, then
                                                         ///< the driver shall only retrieve that number of sub device property structures.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceGetSubDevicePropertiesExp", "zes_device_handle_t hDevice,uint32_t* pCount,zes_subdevice_exp_properties_t* pSubdeviceProps");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pCount, pSubdeviceProps);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceGetSubDevicePropertiesExp(";
@@ -4303,10 +5743,20 @@ namespace validation_layer
                                                         ///< UUID belongs to the root device.
         uint32_t* subdeviceId                           ///< [out] If onSubdevice is true, this gives the ID of the sub-device
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDriverGetDeviceByUuidExp", "zes_driver_handle_t hDriver,zes_uuid_t uuid,zes_device_handle_t* phDevice,ze_bool_t* onSubdevice,uint32_t* subdeviceId");
+            context.binaryTrace->record(binaryTraceApiId, result, hDriver, uuid, phDevice, onSubdevice, subdeviceId);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDriverGetDeviceByUuidExp(";
@@ -4364,10 +5814,20 @@ namespace validation_layer
                                                         ///< available, then the driver shall only retrieve that number of
                                                         ///< component handles.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceEnumActiveVFExp", "zes_device_handle_t hDevice,uint32_t* pCount,zes_vf_handle_t* phVFhandle");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pCount, phVFhandle);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceEnumActiveVFExp(";
@@ -4392,10 +5852,20 @@ namespace validation_layer
         zes_vf_handle_t hVFhandle,                      ///< [in] Sysman handle for the VF component.
         zes_vf_exp_properties_t* pProperties            ///< [in,out] Will contain VF properties.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesVFManagementGetVFPropertiesExp", "zes_vf_handle_t hVFhandle,zes_vf_exp_properties_t* pProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hVFhandle, pProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesVFManagementGetVFPropertiesExp(";
@@ -4428,10 +5898,20 @@ namespace validation_layer
                                                         ///<  - the implementation shall populate the vector pCount-1 number of VF
                                                         ///< memory stats.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesVFManagementGetVFMemoryUtilizationExp", "zes_vf_handle_t hVFhandle,uint32_t* pCount,zes_vf_util_mem_exp_t* pMemUtil");
+            context.binaryTrace->record(binaryTraceApiId, result, hVFhandle, pCount, pMemUtil);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesVFManagementGetVFMemoryUtilizationExp(";
@@ -4468,10 +5948,20 @@ namespace validation_layer
                                                         ///<  - the implementation shall populate the vector pCount-1 number of VF
                                                         ///< engine stats.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesVFManagementGetVFEngineUtilizationExp", "zes_vf_handle_t hVFhandle,uint32_t* pCount,zes_vf_util_engine_exp_t* pEngineUtil");
+            context.binaryTrace->record(binaryTraceApiId, result, hVFhandle, pCount, pEngineUtil);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesVFManagementGetVFEngineUtilizationExp(";
@@ -4498,10 +5988,20 @@ namespace validation_layer
                                                         ///< combination of ::zes_vf_info_util_exp_flag_t.
         ze_bool_t enable                                ///< [in] Enable utilization telemetry.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesVFManagementSetVFTelemetryModeExp", "zes_vf_handle_t hVFhandle,zes_vf_info_util_exp_flags_t flags,ze_bool_t enable");
+            context.binaryTrace->record(binaryTraceApiId, result, hVFhandle, flags, enable);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesVFManagementSetVFTelemetryModeExp(";
@@ -4528,10 +6028,20 @@ namespace validation_layer
                                                         ///< combination of ::zes_vf_info_util_exp_flag_t.
         uint64_t samplingInterval                       ///< [in] Sampling interval value.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesVFManagementSetVFTelemetrySamplingIntervalExp", "zes_vf_handle_t hVFhandle,zes_vf_info_util_exp_flags_t flag,uint64_t samplingInterval");
+            context.binaryTrace->record(binaryTraceApiId, result, hVFhandle, flag, samplingInterval);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesVFManagementSetVFTelemetrySamplingIntervalExp(";
@@ -4566,10 +6076,20 @@ namespace validation_layer
                                                         ///< available, then the driver shall only retrieve that number of
                                                         ///< component handles.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDeviceEnumEnabledVFExp", "zes_device_handle_t hDevice,uint32_t* pCount,zes_vf_handle_t* phVFhandle");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pCount, phVFhandle);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDeviceEnumEnabledVFExp(";
@@ -4594,10 +6114,20 @@ namespace validation_layer
         zes_vf_handle_t hVFhandle,                      ///< [in] Sysman handle for the VF component.
         zes_vf_exp_capabilities_t* pCapability          ///< [in,out] Will contain VF capability.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesVFManagementGetVFCapabilitiesExp", "zes_vf_handle_t hVFhandle,zes_vf_exp_capabilities_t* pCapability");
+            context.binaryTrace->record(binaryTraceApiId, result, hVFhandle, pCapability);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesVFManagementGetVFCapabilitiesExp(";
@@ -4628,10 +6158,20 @@ namespace validation_layer
                                                         ///<  - the implementation shall populate the vector pCount-1 number of VF
                                                         ///< memory stats.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesVFManagementGetVFMemoryUtilizationExp2", "zes_vf_handle_t hVFhandle,uint32_t* pCount,zes_vf_util_mem_exp2_t* pMemUtil");
+            context.binaryTrace->record(binaryTraceApiId, result, hVFhandle, pCount, pMemUtil);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesVFManagementGetVFMemoryUtilizationExp2(";
@@ -4666,10 +6206,20 @@ namespace validation_layer
                                                         ///<  - the implementation shall populate the vector pCount-1 number of VF
                                                         ///< engine stats.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesVFManagementGetVFEngineUtilizationExp2", "zes_vf_handle_t hVFhandle,uint32_t* pCount,zes_vf_util_engine_exp2_t* pEngineUtil");
+            context.binaryTrace->record(binaryTraceApiId, result, hVFhandle, pCount, pEngineUtil);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesVFManagementGetVFEngineUtilizationExp2(";
@@ -4694,10 +6244,20 @@ namespace validation_layer
         zes_vf_handle_t hVFhandle,                      ///< [in] Sysman handle for the VF component.
         zes_vf_exp2_capabilities_t* pCapability         ///< [in,out] Will contain VF capability.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesVFManagementGetVFCapabilitiesExp2", "zes_vf_handle_t hVFhandle,zes_vf_exp2_capabilities_t* pCapability");
+            context.binaryTrace->record(binaryTraceApiId, result, hVFhandle, pCapability);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesVFManagementGetVFCapabilitiesExp2(";
@@ -4720,10 +6280,20 @@ namespace validation_layer
                                                         ///< or set to default speed(false)
         zes_device_action_t* pendingAction              ///< [out] Pending action
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zesDevicePciLinkSpeedUpdateExt", "zes_device_handle_t hDevice,ze_bool_t shouldDowngrade,zes_device_action_t* pendingAction");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, shouldDowngrade, pendingAction);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zesDevicePciLinkSpeedUpdateExt(";
@@ -4757,16 +6327,24 @@ namespace validation_layer
                                                         ///< currently unused, must be 0 (default).
         )
     {
-        context.logger->log_trace("zesInit(flags)");
+        ZEL_LOG_TRACE(context.logger, "zesInit(flags)");
 
         auto pfnInit = context.zesDdiTable.Global.pfnInit;
 
         if( nullptr == pfnInit )
             return logAndPropagateResult_zesInit(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, flags);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesInitPrologue( flags );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesInitPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesInitPrologue) {
+                auto result = checker->zesInitPrologue( flags );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesInit(result, flags);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesInitPrologue) {
+            auto result = checker->zesInitPrologue( flags );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesInit(result, flags);
         }
 
@@ -4776,15 +6354,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesInitPrologue( flags );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesInit(result, flags);
         }
 
         auto driver_result = pfnInit( flags );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesInitEpilogue( flags ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesInitEpilogue) {
+                auto result = checker->zesInitEpilogue( flags ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesInit(result, flags);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesInitEpilogue) {
+            auto result = checker->zesInitEpilogue( flags ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesInit(result, flags);
         }
 
@@ -4806,16 +6391,24 @@ namespace validation_layer
                                                         ///< loader shall only retrieve that number of sysman drivers.
         )
     {
-        context.logger->log_trace("zesDriverGet(pCount, phDrivers)");
+        ZEL_LOG_TRACE(context.logger, "zesDriverGet(pCount, phDrivers)");
 
         auto pfnGet = context.zesDdiTable.Driver.pfnGet;
 
         if( nullptr == pfnGet )
             return logAndPropagateResult_zesDriverGet(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, pCount, phDrivers);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDriverGetPrologue( pCount, phDrivers );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDriverGetPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDriverGetPrologue) {
+                auto result = checker->zesDriverGetPrologue( pCount, phDrivers );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverGet(result, pCount, phDrivers);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDriverGetPrologue) {
+            auto result = checker->zesDriverGetPrologue( pCount, phDrivers );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverGet(result, pCount, phDrivers);
         }
 
@@ -4825,15 +6418,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDriverGetPrologue( pCount, phDrivers );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverGet(result, pCount, phDrivers);
         }
 
         auto driver_result = pfnGet( pCount, phDrivers );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDriverGetEpilogue( pCount, phDrivers ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDriverGetEpilogue) {
+                auto result = checker->zesDriverGetEpilogue( pCount, phDrivers ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverGet(result, pCount, phDrivers);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDriverGetEpilogue) {
+            auto result = checker->zesDriverGetEpilogue( pCount, phDrivers ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverGet(result, pCount, phDrivers);
         }
 
@@ -4867,16 +6467,24 @@ namespace validation_layer
                                                         ///< then driver shall only retrieve that number of extension properties.
         )
     {
-        context.logger->log_trace("zesDriverGetExtensionProperties(hDriver, pCount, pExtensionProperties)");
+        ZEL_LOG_TRACE(context.logger, "zesDriverGetExtensionProperties(hDriver, pCount, pExtensionProperties)");
 
         auto pfnGetExtensionProperties = context.zesDdiTable.Driver.pfnGetExtensionProperties;
 
         if( nullptr == pfnGetExtensionProperties )
             return logAndPropagateResult_zesDriverGetExtensionProperties(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDriver, pCount, pExtensionProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDriverGetExtensionPropertiesPrologue( hDriver, pCount, pExtensionProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDriverGetExtensionPropertiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDriverGetExtensionPropertiesPrologue) {
+                auto result = checker->zesDriverGetExtensionPropertiesPrologue( hDriver, pCount, pExtensionProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverGetExtensionProperties(result, hDriver, pCount, pExtensionProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDriverGetExtensionPropertiesPrologue) {
+            auto result = checker->zesDriverGetExtensionPropertiesPrologue( hDriver, pCount, pExtensionProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverGetExtensionProperties(result, hDriver, pCount, pExtensionProperties);
         }
 
@@ -4886,15 +6494,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDriverGetExtensionPropertiesPrologue( hDriver, pCount, pExtensionProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverGetExtensionProperties(result, hDriver, pCount, pExtensionProperties);
         }
 
         auto driver_result = pfnGetExtensionProperties( hDriver, pCount, pExtensionProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDriverGetExtensionPropertiesEpilogue( hDriver, pCount, pExtensionProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDriverGetExtensionPropertiesEpilogue) {
+                auto result = checker->zesDriverGetExtensionPropertiesEpilogue( hDriver, pCount, pExtensionProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverGetExtensionProperties(result, hDriver, pCount, pExtensionProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDriverGetExtensionPropertiesEpilogue) {
+            auto result = checker->zesDriverGetExtensionPropertiesEpilogue( hDriver, pCount, pExtensionProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverGetExtensionProperties(result, hDriver, pCount, pExtensionProperties);
         }
 
@@ -4910,16 +6525,24 @@ namespace validation_layer
         void** ppFunctionAddress                        ///< [out] pointer to function pointer
         )
     {
-        context.logger->log_trace("zesDriverGetExtensionFunctionAddress(hDriver, name, ppFunctionAddress)");
+        ZEL_LOG_TRACE(context.logger, "zesDriverGetExtensionFunctionAddress(hDriver, name, ppFunctionAddress)");
 
         auto pfnGetExtensionFunctionAddress = context.zesDdiTable.Driver.pfnGetExtensionFunctionAddress;
 
         if( nullptr == pfnGetExtensionFunctionAddress )
             return logAndPropagateResult_zesDriverGetExtensionFunctionAddress(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDriver, name, ppFunctionAddress);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDriverGetExtensionFunctionAddressPrologue( hDriver, name, ppFunctionAddress );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDriverGetExtensionFunctionAddressPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDriverGetExtensionFunctionAddressPrologue) {
+                auto result = checker->zesDriverGetExtensionFunctionAddressPrologue( hDriver, name, ppFunctionAddress );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverGetExtensionFunctionAddress(result, hDriver, name, ppFunctionAddress);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDriverGetExtensionFunctionAddressPrologue) {
+            auto result = checker->zesDriverGetExtensionFunctionAddressPrologue( hDriver, name, ppFunctionAddress );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverGetExtensionFunctionAddress(result, hDriver, name, ppFunctionAddress);
         }
 
@@ -4929,15 +6552,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDriverGetExtensionFunctionAddressPrologue( hDriver, name, ppFunctionAddress );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverGetExtensionFunctionAddress(result, hDriver, name, ppFunctionAddress);
         }
 
         auto driver_result = pfnGetExtensionFunctionAddress( hDriver, name, ppFunctionAddress );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDriverGetExtensionFunctionAddressEpilogue( hDriver, name, ppFunctionAddress ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDriverGetExtensionFunctionAddressEpilogue) {
+                auto result = checker->zesDriverGetExtensionFunctionAddressEpilogue( hDriver, name, ppFunctionAddress ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverGetExtensionFunctionAddress(result, hDriver, name, ppFunctionAddress);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDriverGetExtensionFunctionAddressEpilogue) {
+            auto result = checker->zesDriverGetExtensionFunctionAddressEpilogue( hDriver, name, ppFunctionAddress ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverGetExtensionFunctionAddress(result, hDriver, name, ppFunctionAddress);
         }
 
@@ -4960,16 +6590,24 @@ namespace validation_layer
                                                         ///< driver shall only retrieve that number of sysman devices.
         )
     {
-        context.logger->log_trace("zesDeviceGet(hDriver, pCount, phDevices)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceGet(hDriver, pCount, phDevices)");
 
         auto pfnGet = context.zesDdiTable.Device.pfnGet;
 
         if( nullptr == pfnGet )
             return logAndPropagateResult_zesDeviceGet(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDriver, pCount, phDevices);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetPrologue( hDriver, pCount, phDevices );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceGetPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceGetPrologue) {
+                auto result = checker->zesDeviceGetPrologue( hDriver, pCount, phDevices );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGet(result, hDriver, pCount, phDevices);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceGetPrologue) {
+            auto result = checker->zesDeviceGetPrologue( hDriver, pCount, phDevices );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGet(result, hDriver, pCount, phDevices);
         }
 
@@ -4979,15 +6617,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetPrologue( hDriver, pCount, phDevices );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGet(result, hDriver, pCount, phDevices);
         }
 
         auto driver_result = pfnGet( hDriver, pCount, phDevices );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetEpilogue( hDriver, pCount, phDevices ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceGetEpilogue) {
+                auto result = checker->zesDeviceGetEpilogue( hDriver, pCount, phDevices ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGet(result, hDriver, pCount, phDevices);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceGetEpilogue) {
+            auto result = checker->zesDeviceGetEpilogue( hDriver, pCount, phDevices ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGet(result, hDriver, pCount, phDevices);
         }
 
@@ -5012,16 +6657,24 @@ namespace validation_layer
         zes_device_properties_t* pProperties            ///< [in,out] Structure that will contain information about the device.
         )
     {
-        context.logger->log_trace("zesDeviceGetProperties(hDevice, pProperties)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceGetProperties(hDevice, pProperties)");
 
         auto pfnGetProperties = context.zesDdiTable.Device.pfnGetProperties;
 
         if( nullptr == pfnGetProperties )
             return logAndPropagateResult_zesDeviceGetProperties(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetPropertiesPrologue( hDevice, pProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceGetPropertiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceGetPropertiesPrologue) {
+                auto result = checker->zesDeviceGetPropertiesPrologue( hDevice, pProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetProperties(result, hDevice, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceGetPropertiesPrologue) {
+            auto result = checker->zesDeviceGetPropertiesPrologue( hDevice, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetProperties(result, hDevice, pProperties);
         }
 
@@ -5031,15 +6684,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetPropertiesPrologue( hDevice, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetProperties(result, hDevice, pProperties);
         }
 
         auto driver_result = pfnGetProperties( hDevice, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetPropertiesEpilogue( hDevice, pProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceGetPropertiesEpilogue) {
+                auto result = checker->zesDeviceGetPropertiesEpilogue( hDevice, pProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetProperties(result, hDevice, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceGetPropertiesEpilogue) {
+            auto result = checker->zesDeviceGetPropertiesEpilogue( hDevice, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetProperties(result, hDevice, pProperties);
         }
 
@@ -5054,16 +6714,24 @@ namespace validation_layer
         zes_device_state_t* pState                      ///< [in,out] Structure that will contain information about the device.
         )
     {
-        context.logger->log_trace("zesDeviceGetState(hDevice, pState)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceGetState(hDevice, pState)");
 
         auto pfnGetState = context.zesDdiTable.Device.pfnGetState;
 
         if( nullptr == pfnGetState )
             return logAndPropagateResult_zesDeviceGetState(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pState);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetStatePrologue( hDevice, pState );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceGetStatePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceGetStatePrologue) {
+                auto result = checker->zesDeviceGetStatePrologue( hDevice, pState );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetState(result, hDevice, pState);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceGetStatePrologue) {
+            auto result = checker->zesDeviceGetStatePrologue( hDevice, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetState(result, hDevice, pState);
         }
 
@@ -5073,16 +6741,23 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetStatePrologue( hDevice, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetState(result, hDevice, pState);
         }
 
         auto driver_result = pfnGetState( hDevice, pState );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetStateEpilogue( hDevice, pState ,driver_result);
-            if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetState(result, hDevice, pState);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceGetStateEpilogue) {
+                auto result = checker->zesDeviceGetStateEpilogue( hDevice, pState ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetState(result, hDevice, pState);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceGetStateEpilogue) {
+            auto result = checker->zesDeviceGetStateEpilogue( hDevice, pState ,driver_result);
+            if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetState(result, hDevice, pState);
         }
 
         return logAndPropagateResult_zesDeviceGetState(driver_result, hDevice, pState);
@@ -5097,16 +6772,24 @@ namespace validation_layer
                                                         ///< device will be forcibly killed.
         )
     {
-        context.logger->log_trace("zesDeviceReset(hDevice, force)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceReset(hDevice, force)");
 
         auto pfnReset = context.zesDdiTable.Device.pfnReset;
 
         if( nullptr == pfnReset )
             return logAndPropagateResult_zesDeviceReset(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, force);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceResetPrologue( hDevice, force );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceResetPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceResetPrologue) {
+                auto result = checker->zesDeviceResetPrologue( hDevice, force );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceReset(result, hDevice, force);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceResetPrologue) {
+            auto result = checker->zesDeviceResetPrologue( hDevice, force );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceReset(result, hDevice, force);
         }
 
@@ -5116,15 +6799,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceResetPrologue( hDevice, force );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceReset(result, hDevice, force);
         }
 
         auto driver_result = pfnReset( hDevice, force );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceResetEpilogue( hDevice, force ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceResetEpilogue) {
+                auto result = checker->zesDeviceResetEpilogue( hDevice, force ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceReset(result, hDevice, force);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceResetEpilogue) {
+            auto result = checker->zesDeviceResetEpilogue( hDevice, force ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceReset(result, hDevice, force);
         }
 
@@ -5139,16 +6829,24 @@ namespace validation_layer
         zes_reset_properties_t* pProperties             ///< [in] Device reset properties to apply
         )
     {
-        context.logger->log_trace("zesDeviceResetExt(hDevice, pProperties)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceResetExt(hDevice, pProperties)");
 
         auto pfnResetExt = context.zesDdiTable.Device.pfnResetExt;
 
         if( nullptr == pfnResetExt )
             return logAndPropagateResult_zesDeviceResetExt(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceResetExtPrologue( hDevice, pProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceResetExtPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceResetExtPrologue) {
+                auto result = checker->zesDeviceResetExtPrologue( hDevice, pProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceResetExt(result, hDevice, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceResetExtPrologue) {
+            auto result = checker->zesDeviceResetExtPrologue( hDevice, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceResetExt(result, hDevice, pProperties);
         }
 
@@ -5158,15 +6856,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceResetExtPrologue( hDevice, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceResetExt(result, hDevice, pProperties);
         }
 
         auto driver_result = pfnResetExt( hDevice, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceResetExtEpilogue( hDevice, pProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceResetExtEpilogue) {
+                auto result = checker->zesDeviceResetExtEpilogue( hDevice, pProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceResetExt(result, hDevice, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceResetExtEpilogue) {
+            auto result = checker->zesDeviceResetExtEpilogue( hDevice, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceResetExt(result, hDevice, pProperties);
         }
 
@@ -5190,16 +6895,24 @@ namespace validation_layer
                                                         ///< number of processes. In this case, the return code will ::ZE_RESULT_ERROR_INVALID_SIZE.
         )
     {
-        context.logger->log_trace("zesDeviceProcessesGetState(hDevice, pCount, pProcesses)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceProcessesGetState(hDevice, pCount, pProcesses)");
 
         auto pfnProcessesGetState = context.zesDdiTable.Device.pfnProcessesGetState;
 
         if( nullptr == pfnProcessesGetState )
             return logAndPropagateResult_zesDeviceProcessesGetState(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pCount, pProcesses);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceProcessesGetStatePrologue( hDevice, pCount, pProcesses );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceProcessesGetStatePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceProcessesGetStatePrologue) {
+                auto result = checker->zesDeviceProcessesGetStatePrologue( hDevice, pCount, pProcesses );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceProcessesGetState(result, hDevice, pCount, pProcesses);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceProcessesGetStatePrologue) {
+            auto result = checker->zesDeviceProcessesGetStatePrologue( hDevice, pCount, pProcesses );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceProcessesGetState(result, hDevice, pCount, pProcesses);
         }
 
@@ -5209,15 +6922,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceProcessesGetStatePrologue( hDevice, pCount, pProcesses );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceProcessesGetState(result, hDevice, pCount, pProcesses);
         }
 
         auto driver_result = pfnProcessesGetState( hDevice, pCount, pProcesses );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceProcessesGetStateEpilogue( hDevice, pCount, pProcesses ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceProcessesGetStateEpilogue) {
+                auto result = checker->zesDeviceProcessesGetStateEpilogue( hDevice, pCount, pProcesses ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceProcessesGetState(result, hDevice, pCount, pProcesses);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceProcessesGetStateEpilogue) {
+            auto result = checker->zesDeviceProcessesGetStateEpilogue( hDevice, pCount, pProcesses ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceProcessesGetState(result, hDevice, pCount, pProcesses);
         }
 
@@ -5232,16 +6952,24 @@ namespace validation_layer
         zes_pci_properties_t* pProperties               ///< [in,out] Will contain the PCI properties.
         )
     {
-        context.logger->log_trace("zesDevicePciGetProperties(hDevice, pProperties)");
+        ZEL_LOG_TRACE(context.logger, "zesDevicePciGetProperties(hDevice, pProperties)");
 
         auto pfnPciGetProperties = context.zesDdiTable.Device.pfnPciGetProperties;
 
         if( nullptr == pfnPciGetProperties )
             return logAndPropagateResult_zesDevicePciGetProperties(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDevicePciGetPropertiesPrologue( hDevice, pProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDevicePciGetPropertiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDevicePciGetPropertiesPrologue) {
+                auto result = checker->zesDevicePciGetPropertiesPrologue( hDevice, pProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDevicePciGetProperties(result, hDevice, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDevicePciGetPropertiesPrologue) {
+            auto result = checker->zesDevicePciGetPropertiesPrologue( hDevice, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDevicePciGetProperties(result, hDevice, pProperties);
         }
 
@@ -5251,15 +6979,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDevicePciGetPropertiesPrologue( hDevice, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDevicePciGetProperties(result, hDevice, pProperties);
         }
 
         auto driver_result = pfnPciGetProperties( hDevice, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDevicePciGetPropertiesEpilogue( hDevice, pProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDevicePciGetPropertiesEpilogue) {
+                auto result = checker->zesDevicePciGetPropertiesEpilogue( hDevice, pProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDevicePciGetProperties(result, hDevice, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDevicePciGetPropertiesEpilogue) {
+            auto result = checker->zesDevicePciGetPropertiesEpilogue( hDevice, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDevicePciGetProperties(result, hDevice, pProperties);
         }
 
@@ -5274,16 +7009,24 @@ namespace validation_layer
         zes_pci_state_t* pState                         ///< [in,out] Will contain the PCI properties.
         )
     {
-        context.logger->log_trace("zesDevicePciGetState(hDevice, pState)");
+        ZEL_LOG_TRACE(context.logger, "zesDevicePciGetState(hDevice, pState)");
 
         auto pfnPciGetState = context.zesDdiTable.Device.pfnPciGetState;
 
         if( nullptr == pfnPciGetState )
             return logAndPropagateResult_zesDevicePciGetState(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pState);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDevicePciGetStatePrologue( hDevice, pState );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDevicePciGetStatePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDevicePciGetStatePrologue) {
+                auto result = checker->zesDevicePciGetStatePrologue( hDevice, pState );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDevicePciGetState(result, hDevice, pState);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDevicePciGetStatePrologue) {
+            auto result = checker->zesDevicePciGetStatePrologue( hDevice, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDevicePciGetState(result, hDevice, pState);
         }
 
@@ -5293,15 +7036,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDevicePciGetStatePrologue( hDevice, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDevicePciGetState(result, hDevice, pState);
         }
 
         auto driver_result = pfnPciGetState( hDevice, pState );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDevicePciGetStateEpilogue( hDevice, pState ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDevicePciGetStateEpilogue) {
+                auto result = checker->zesDevicePciGetStateEpilogue( hDevice, pState ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDevicePciGetState(result, hDevice, pState);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDevicePciGetStateEpilogue) {
+            auto result = checker->zesDevicePciGetStateEpilogue( hDevice, pState ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDevicePciGetState(result, hDevice, pState);
         }
 
@@ -5324,16 +7074,24 @@ namespace validation_layer
                                                         ///< driver shall only retrieve information about that number of PCI bars.
         )
     {
-        context.logger->log_trace("zesDevicePciGetBars(hDevice, pCount, pProperties)");
+        ZEL_LOG_TRACE(context.logger, "zesDevicePciGetBars(hDevice, pCount, pProperties)");
 
         auto pfnPciGetBars = context.zesDdiTable.Device.pfnPciGetBars;
 
         if( nullptr == pfnPciGetBars )
             return logAndPropagateResult_zesDevicePciGetBars(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pCount, pProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDevicePciGetBarsPrologue( hDevice, pCount, pProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDevicePciGetBarsPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDevicePciGetBarsPrologue) {
+                auto result = checker->zesDevicePciGetBarsPrologue( hDevice, pCount, pProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDevicePciGetBars(result, hDevice, pCount, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDevicePciGetBarsPrologue) {
+            auto result = checker->zesDevicePciGetBarsPrologue( hDevice, pCount, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDevicePciGetBars(result, hDevice, pCount, pProperties);
         }
 
@@ -5343,15 +7101,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDevicePciGetBarsPrologue( hDevice, pCount, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDevicePciGetBars(result, hDevice, pCount, pProperties);
         }
 
         auto driver_result = pfnPciGetBars( hDevice, pCount, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDevicePciGetBarsEpilogue( hDevice, pCount, pProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDevicePciGetBarsEpilogue) {
+                auto result = checker->zesDevicePciGetBarsEpilogue( hDevice, pCount, pProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDevicePciGetBars(result, hDevice, pCount, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDevicePciGetBarsEpilogue) {
+            auto result = checker->zesDevicePciGetBarsEpilogue( hDevice, pCount, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDevicePciGetBars(result, hDevice, pCount, pProperties);
         }
 
@@ -5366,16 +7131,24 @@ namespace validation_layer
         zes_pci_stats_t* pStats                         ///< [in,out] Will contain a snapshot of the latest stats.
         )
     {
-        context.logger->log_trace("zesDevicePciGetStats(hDevice, pStats)");
+        ZEL_LOG_TRACE(context.logger, "zesDevicePciGetStats(hDevice, pStats)");
 
         auto pfnPciGetStats = context.zesDdiTable.Device.pfnPciGetStats;
 
         if( nullptr == pfnPciGetStats )
             return logAndPropagateResult_zesDevicePciGetStats(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pStats);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDevicePciGetStatsPrologue( hDevice, pStats );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDevicePciGetStatsPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDevicePciGetStatsPrologue) {
+                auto result = checker->zesDevicePciGetStatsPrologue( hDevice, pStats );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDevicePciGetStats(result, hDevice, pStats);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDevicePciGetStatsPrologue) {
+            auto result = checker->zesDevicePciGetStatsPrologue( hDevice, pStats );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDevicePciGetStats(result, hDevice, pStats);
         }
 
@@ -5385,15 +7158,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDevicePciGetStatsPrologue( hDevice, pStats );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDevicePciGetStats(result, hDevice, pStats);
         }
 
         auto driver_result = pfnPciGetStats( hDevice, pStats );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDevicePciGetStatsEpilogue( hDevice, pStats ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDevicePciGetStatsEpilogue) {
+                auto result = checker->zesDevicePciGetStatsEpilogue( hDevice, pStats ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDevicePciGetStats(result, hDevice, pStats);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDevicePciGetStatsEpilogue) {
+            auto result = checker->zesDevicePciGetStatsEpilogue( hDevice, pStats ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDevicePciGetStats(result, hDevice, pStats);
         }
 
@@ -5407,16 +7187,24 @@ namespace validation_layer
         zes_device_handle_t hDevice                     ///< [in] Sysman handle of the device.
         )
     {
-        context.logger->log_trace("zesDeviceSetOverclockWaiver(hDevice)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceSetOverclockWaiver(hDevice)");
 
         auto pfnSetOverclockWaiver = context.zesDdiTable.Device.pfnSetOverclockWaiver;
 
         if( nullptr == pfnSetOverclockWaiver )
             return logAndPropagateResult_zesDeviceSetOverclockWaiver(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceSetOverclockWaiverPrologue( hDevice );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceSetOverclockWaiverPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceSetOverclockWaiverPrologue) {
+                auto result = checker->zesDeviceSetOverclockWaiverPrologue( hDevice );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceSetOverclockWaiver(result, hDevice);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceSetOverclockWaiverPrologue) {
+            auto result = checker->zesDeviceSetOverclockWaiverPrologue( hDevice );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceSetOverclockWaiver(result, hDevice);
         }
 
@@ -5426,15 +7214,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceSetOverclockWaiverPrologue( hDevice );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceSetOverclockWaiver(result, hDevice);
         }
 
         auto driver_result = pfnSetOverclockWaiver( hDevice );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceSetOverclockWaiverEpilogue( hDevice ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceSetOverclockWaiverEpilogue) {
+                auto result = checker->zesDeviceSetOverclockWaiverEpilogue( hDevice ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceSetOverclockWaiver(result, hDevice);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceSetOverclockWaiverEpilogue) {
+            auto result = checker->zesDeviceSetOverclockWaiverEpilogue( hDevice ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceSetOverclockWaiver(result, hDevice);
         }
 
@@ -5451,16 +7246,24 @@ namespace validation_layer
                                                         ///< doesn't support overclocking.
         )
     {
-        context.logger->log_trace("zesDeviceGetOverclockDomains(hDevice, pOverclockDomains)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceGetOverclockDomains(hDevice, pOverclockDomains)");
 
         auto pfnGetOverclockDomains = context.zesDdiTable.Device.pfnGetOverclockDomains;
 
         if( nullptr == pfnGetOverclockDomains )
             return logAndPropagateResult_zesDeviceGetOverclockDomains(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pOverclockDomains);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetOverclockDomainsPrologue( hDevice, pOverclockDomains );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceGetOverclockDomainsPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceGetOverclockDomainsPrologue) {
+                auto result = checker->zesDeviceGetOverclockDomainsPrologue( hDevice, pOverclockDomains );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetOverclockDomains(result, hDevice, pOverclockDomains);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceGetOverclockDomainsPrologue) {
+            auto result = checker->zesDeviceGetOverclockDomainsPrologue( hDevice, pOverclockDomains );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetOverclockDomains(result, hDevice, pOverclockDomains);
         }
 
@@ -5470,15 +7273,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetOverclockDomainsPrologue( hDevice, pOverclockDomains );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetOverclockDomains(result, hDevice, pOverclockDomains);
         }
 
         auto driver_result = pfnGetOverclockDomains( hDevice, pOverclockDomains );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetOverclockDomainsEpilogue( hDevice, pOverclockDomains ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceGetOverclockDomainsEpilogue) {
+                auto result = checker->zesDeviceGetOverclockDomainsEpilogue( hDevice, pOverclockDomains ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetOverclockDomains(result, hDevice, pOverclockDomains);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceGetOverclockDomainsEpilogue) {
+            auto result = checker->zesDeviceGetOverclockDomainsEpilogue( hDevice, pOverclockDomains ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetOverclockDomains(result, hDevice, pOverclockDomains);
         }
 
@@ -5496,16 +7306,24 @@ namespace validation_layer
                                                         ///< ::zes_overclock_control_t).
         )
     {
-        context.logger->log_trace("zesDeviceGetOverclockControls(hDevice, domainType, pAvailableControls)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceGetOverclockControls(hDevice, domainType, pAvailableControls)");
 
         auto pfnGetOverclockControls = context.zesDdiTable.Device.pfnGetOverclockControls;
 
         if( nullptr == pfnGetOverclockControls )
             return logAndPropagateResult_zesDeviceGetOverclockControls(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, domainType, pAvailableControls);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetOverclockControlsPrologue( hDevice, domainType, pAvailableControls );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceGetOverclockControlsPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceGetOverclockControlsPrologue) {
+                auto result = checker->zesDeviceGetOverclockControlsPrologue( hDevice, domainType, pAvailableControls );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetOverclockControls(result, hDevice, domainType, pAvailableControls);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceGetOverclockControlsPrologue) {
+            auto result = checker->zesDeviceGetOverclockControlsPrologue( hDevice, domainType, pAvailableControls );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetOverclockControls(result, hDevice, domainType, pAvailableControls);
         }
 
@@ -5515,15 +7333,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetOverclockControlsPrologue( hDevice, domainType, pAvailableControls );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetOverclockControls(result, hDevice, domainType, pAvailableControls);
         }
 
         auto driver_result = pfnGetOverclockControls( hDevice, domainType, pAvailableControls );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetOverclockControlsEpilogue( hDevice, domainType, pAvailableControls ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceGetOverclockControlsEpilogue) {
+                auto result = checker->zesDeviceGetOverclockControlsEpilogue( hDevice, domainType, pAvailableControls ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetOverclockControls(result, hDevice, domainType, pAvailableControls);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceGetOverclockControlsEpilogue) {
+            auto result = checker->zesDeviceGetOverclockControlsEpilogue( hDevice, domainType, pAvailableControls ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetOverclockControls(result, hDevice, domainType, pAvailableControls);
         }
 
@@ -5539,16 +7364,24 @@ namespace validation_layer
                                                         ///< manufacturing state
         )
     {
-        context.logger->log_trace("zesDeviceResetOverclockSettings(hDevice, onShippedState)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceResetOverclockSettings(hDevice, onShippedState)");
 
         auto pfnResetOverclockSettings = context.zesDdiTable.Device.pfnResetOverclockSettings;
 
         if( nullptr == pfnResetOverclockSettings )
             return logAndPropagateResult_zesDeviceResetOverclockSettings(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, onShippedState);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceResetOverclockSettingsPrologue( hDevice, onShippedState );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceResetOverclockSettingsPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceResetOverclockSettingsPrologue) {
+                auto result = checker->zesDeviceResetOverclockSettingsPrologue( hDevice, onShippedState );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceResetOverclockSettings(result, hDevice, onShippedState);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceResetOverclockSettingsPrologue) {
+            auto result = checker->zesDeviceResetOverclockSettingsPrologue( hDevice, onShippedState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceResetOverclockSettings(result, hDevice, onShippedState);
         }
 
@@ -5558,15 +7391,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceResetOverclockSettingsPrologue( hDevice, onShippedState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceResetOverclockSettings(result, hDevice, onShippedState);
         }
 
         auto driver_result = pfnResetOverclockSettings( hDevice, onShippedState );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceResetOverclockSettingsEpilogue( hDevice, onShippedState ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceResetOverclockSettingsEpilogue) {
+                auto result = checker->zesDeviceResetOverclockSettingsEpilogue( hDevice, onShippedState ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceResetOverclockSettings(result, hDevice, onShippedState);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceResetOverclockSettingsEpilogue) {
+            auto result = checker->zesDeviceResetOverclockSettingsEpilogue( hDevice, onShippedState ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceResetOverclockSettings(result, hDevice, onShippedState);
         }
 
@@ -5586,16 +7426,24 @@ namespace validation_layer
         ze_bool_t* pPendingReset                        ///< [out] Pending reset 0 =manufacturing state, 1= shipped state)..
         )
     {
-        context.logger->log_trace("zesDeviceReadOverclockState(hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceReadOverclockState(hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset)");
 
         auto pfnReadOverclockState = context.zesDdiTable.Device.pfnReadOverclockState;
 
         if( nullptr == pfnReadOverclockState )
             return logAndPropagateResult_zesDeviceReadOverclockState(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceReadOverclockStatePrologue( hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceReadOverclockStatePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceReadOverclockStatePrologue) {
+                auto result = checker->zesDeviceReadOverclockStatePrologue( hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceReadOverclockState(result, hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceReadOverclockStatePrologue) {
+            auto result = checker->zesDeviceReadOverclockStatePrologue( hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceReadOverclockState(result, hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset);
         }
 
@@ -5605,15 +7453,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceReadOverclockStatePrologue( hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceReadOverclockState(result, hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset);
         }
 
         auto driver_result = pfnReadOverclockState( hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceReadOverclockStateEpilogue( hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceReadOverclockStateEpilogue) {
+                auto result = checker->zesDeviceReadOverclockStateEpilogue( hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceReadOverclockState(result, hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceReadOverclockStateEpilogue) {
+            auto result = checker->zesDeviceReadOverclockStateEpilogue( hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceReadOverclockState(result, hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset);
         }
 
@@ -5638,16 +7493,24 @@ namespace validation_layer
                                                         ///< component handles.
         )
     {
-        context.logger->log_trace("zesDeviceEnumOverclockDomains(hDevice, pCount, phDomainHandle)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceEnumOverclockDomains(hDevice, pCount, phDomainHandle)");
 
         auto pfnEnumOverclockDomains = context.zesDdiTable.Device.pfnEnumOverclockDomains;
 
         if( nullptr == pfnEnumOverclockDomains )
             return logAndPropagateResult_zesDeviceEnumOverclockDomains(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pCount, phDomainHandle);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumOverclockDomainsPrologue( hDevice, pCount, phDomainHandle );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceEnumOverclockDomainsPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumOverclockDomainsPrologue) {
+                auto result = checker->zesDeviceEnumOverclockDomainsPrologue( hDevice, pCount, phDomainHandle );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumOverclockDomains(result, hDevice, pCount, phDomainHandle);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumOverclockDomainsPrologue) {
+            auto result = checker->zesDeviceEnumOverclockDomainsPrologue( hDevice, pCount, phDomainHandle );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumOverclockDomains(result, hDevice, pCount, phDomainHandle);
         }
 
@@ -5657,15 +7520,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumOverclockDomainsPrologue( hDevice, pCount, phDomainHandle );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumOverclockDomains(result, hDevice, pCount, phDomainHandle);
         }
 
         auto driver_result = pfnEnumOverclockDomains( hDevice, pCount, phDomainHandle );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumOverclockDomainsEpilogue( hDevice, pCount, phDomainHandle ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumOverclockDomainsEpilogue) {
+                auto result = checker->zesDeviceEnumOverclockDomainsEpilogue( hDevice, pCount, phDomainHandle ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumOverclockDomains(result, hDevice, pCount, phDomainHandle);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumOverclockDomainsEpilogue) {
+            auto result = checker->zesDeviceEnumOverclockDomainsEpilogue( hDevice, pCount, phDomainHandle ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumOverclockDomains(result, hDevice, pCount, phDomainHandle);
         }
 
@@ -5680,16 +7550,24 @@ namespace validation_layer
         zes_overclock_properties_t* pDomainProperties   ///< [in,out] The overclock properties for the specified domain.
         )
     {
-        context.logger->log_trace("zesOverclockGetDomainProperties(hDomainHandle, pDomainProperties)");
+        ZEL_LOG_TRACE(context.logger, "zesOverclockGetDomainProperties(hDomainHandle, pDomainProperties)");
 
         auto pfnGetDomainProperties = context.zesDdiTable.Overclock.pfnGetDomainProperties;
 
         if( nullptr == pfnGetDomainProperties )
             return logAndPropagateResult_zesOverclockGetDomainProperties(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDomainHandle, pDomainProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetDomainPropertiesPrologue( hDomainHandle, pDomainProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesOverclockGetDomainPropertiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesOverclockGetDomainPropertiesPrologue) {
+                auto result = checker->zesOverclockGetDomainPropertiesPrologue( hDomainHandle, pDomainProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetDomainProperties(result, hDomainHandle, pDomainProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesOverclockGetDomainPropertiesPrologue) {
+            auto result = checker->zesOverclockGetDomainPropertiesPrologue( hDomainHandle, pDomainProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetDomainProperties(result, hDomainHandle, pDomainProperties);
         }
 
@@ -5699,15 +7577,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockGetDomainPropertiesPrologue( hDomainHandle, pDomainProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetDomainProperties(result, hDomainHandle, pDomainProperties);
         }
 
         auto driver_result = pfnGetDomainProperties( hDomainHandle, pDomainProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetDomainPropertiesEpilogue( hDomainHandle, pDomainProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesOverclockGetDomainPropertiesEpilogue) {
+                auto result = checker->zesOverclockGetDomainPropertiesEpilogue( hDomainHandle, pDomainProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetDomainProperties(result, hDomainHandle, pDomainProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesOverclockGetDomainPropertiesEpilogue) {
+            auto result = checker->zesOverclockGetDomainPropertiesEpilogue( hDomainHandle, pDomainProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetDomainProperties(result, hDomainHandle, pDomainProperties);
         }
 
@@ -5722,16 +7607,24 @@ namespace validation_layer
         zes_vf_property_t* pVFProperties                ///< [in,out] The VF min,max,step for a specified domain.
         )
     {
-        context.logger->log_trace("zesOverclockGetDomainVFProperties(hDomainHandle, pVFProperties)");
+        ZEL_LOG_TRACE(context.logger, "zesOverclockGetDomainVFProperties(hDomainHandle, pVFProperties)");
 
         auto pfnGetDomainVFProperties = context.zesDdiTable.Overclock.pfnGetDomainVFProperties;
 
         if( nullptr == pfnGetDomainVFProperties )
             return logAndPropagateResult_zesOverclockGetDomainVFProperties(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDomainHandle, pVFProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetDomainVFPropertiesPrologue( hDomainHandle, pVFProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesOverclockGetDomainVFPropertiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesOverclockGetDomainVFPropertiesPrologue) {
+                auto result = checker->zesOverclockGetDomainVFPropertiesPrologue( hDomainHandle, pVFProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetDomainVFProperties(result, hDomainHandle, pVFProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesOverclockGetDomainVFPropertiesPrologue) {
+            auto result = checker->zesOverclockGetDomainVFPropertiesPrologue( hDomainHandle, pVFProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetDomainVFProperties(result, hDomainHandle, pVFProperties);
         }
 
@@ -5741,15 +7634,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockGetDomainVFPropertiesPrologue( hDomainHandle, pVFProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetDomainVFProperties(result, hDomainHandle, pVFProperties);
         }
 
         auto driver_result = pfnGetDomainVFProperties( hDomainHandle, pVFProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetDomainVFPropertiesEpilogue( hDomainHandle, pVFProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesOverclockGetDomainVFPropertiesEpilogue) {
+                auto result = checker->zesOverclockGetDomainVFPropertiesEpilogue( hDomainHandle, pVFProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetDomainVFProperties(result, hDomainHandle, pVFProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesOverclockGetDomainVFPropertiesEpilogue) {
+            auto result = checker->zesOverclockGetDomainVFPropertiesEpilogue( hDomainHandle, pVFProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetDomainVFProperties(result, hDomainHandle, pVFProperties);
         }
 
@@ -5765,16 +7665,24 @@ namespace validation_layer
         zes_control_property_t* pControlProperties      ///< [in,out] overclock control values.
         )
     {
-        context.logger->log_trace("zesOverclockGetDomainControlProperties(hDomainHandle, DomainControl, pControlProperties)");
+        ZEL_LOG_TRACE(context.logger, "zesOverclockGetDomainControlProperties(hDomainHandle, DomainControl, pControlProperties)");
 
         auto pfnGetDomainControlProperties = context.zesDdiTable.Overclock.pfnGetDomainControlProperties;
 
         if( nullptr == pfnGetDomainControlProperties )
             return logAndPropagateResult_zesOverclockGetDomainControlProperties(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDomainHandle, DomainControl, pControlProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetDomainControlPropertiesPrologue( hDomainHandle, DomainControl, pControlProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesOverclockGetDomainControlPropertiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesOverclockGetDomainControlPropertiesPrologue) {
+                auto result = checker->zesOverclockGetDomainControlPropertiesPrologue( hDomainHandle, DomainControl, pControlProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetDomainControlProperties(result, hDomainHandle, DomainControl, pControlProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesOverclockGetDomainControlPropertiesPrologue) {
+            auto result = checker->zesOverclockGetDomainControlPropertiesPrologue( hDomainHandle, DomainControl, pControlProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetDomainControlProperties(result, hDomainHandle, DomainControl, pControlProperties);
         }
 
@@ -5784,15 +7692,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockGetDomainControlPropertiesPrologue( hDomainHandle, DomainControl, pControlProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetDomainControlProperties(result, hDomainHandle, DomainControl, pControlProperties);
         }
 
         auto driver_result = pfnGetDomainControlProperties( hDomainHandle, DomainControl, pControlProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetDomainControlPropertiesEpilogue( hDomainHandle, DomainControl, pControlProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesOverclockGetDomainControlPropertiesEpilogue) {
+                auto result = checker->zesOverclockGetDomainControlPropertiesEpilogue( hDomainHandle, DomainControl, pControlProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetDomainControlProperties(result, hDomainHandle, DomainControl, pControlProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesOverclockGetDomainControlPropertiesEpilogue) {
+            auto result = checker->zesOverclockGetDomainControlPropertiesEpilogue( hDomainHandle, DomainControl, pControlProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetDomainControlProperties(result, hDomainHandle, DomainControl, pControlProperties);
         }
 
@@ -5808,16 +7723,24 @@ namespace validation_layer
         double* pValue                                  ///< [in,out] Getting overclock control value for the specified control.
         )
     {
-        context.logger->log_trace("zesOverclockGetControlCurrentValue(hDomainHandle, DomainControl, pValue)");
+        ZEL_LOG_TRACE(context.logger, "zesOverclockGetControlCurrentValue(hDomainHandle, DomainControl, pValue)");
 
         auto pfnGetControlCurrentValue = context.zesDdiTable.Overclock.pfnGetControlCurrentValue;
 
         if( nullptr == pfnGetControlCurrentValue )
             return logAndPropagateResult_zesOverclockGetControlCurrentValue(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDomainHandle, DomainControl, pValue);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetControlCurrentValuePrologue( hDomainHandle, DomainControl, pValue );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesOverclockGetControlCurrentValuePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesOverclockGetControlCurrentValuePrologue) {
+                auto result = checker->zesOverclockGetControlCurrentValuePrologue( hDomainHandle, DomainControl, pValue );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetControlCurrentValue(result, hDomainHandle, DomainControl, pValue);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesOverclockGetControlCurrentValuePrologue) {
+            auto result = checker->zesOverclockGetControlCurrentValuePrologue( hDomainHandle, DomainControl, pValue );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetControlCurrentValue(result, hDomainHandle, DomainControl, pValue);
         }
 
@@ -5827,15 +7750,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockGetControlCurrentValuePrologue( hDomainHandle, DomainControl, pValue );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetControlCurrentValue(result, hDomainHandle, DomainControl, pValue);
         }
 
         auto driver_result = pfnGetControlCurrentValue( hDomainHandle, DomainControl, pValue );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetControlCurrentValueEpilogue( hDomainHandle, DomainControl, pValue ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesOverclockGetControlCurrentValueEpilogue) {
+                auto result = checker->zesOverclockGetControlCurrentValueEpilogue( hDomainHandle, DomainControl, pValue ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetControlCurrentValue(result, hDomainHandle, DomainControl, pValue);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesOverclockGetControlCurrentValueEpilogue) {
+            auto result = checker->zesOverclockGetControlCurrentValueEpilogue( hDomainHandle, DomainControl, pValue ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetControlCurrentValue(result, hDomainHandle, DomainControl, pValue);
         }
 
@@ -5852,16 +7782,24 @@ namespace validation_layer
                                                         ///< format of the value depend on the control type.
         )
     {
-        context.logger->log_trace("zesOverclockGetControlPendingValue(hDomainHandle, DomainControl, pValue)");
+        ZEL_LOG_TRACE(context.logger, "zesOverclockGetControlPendingValue(hDomainHandle, DomainControl, pValue)");
 
         auto pfnGetControlPendingValue = context.zesDdiTable.Overclock.pfnGetControlPendingValue;
 
         if( nullptr == pfnGetControlPendingValue )
             return logAndPropagateResult_zesOverclockGetControlPendingValue(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDomainHandle, DomainControl, pValue);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetControlPendingValuePrologue( hDomainHandle, DomainControl, pValue );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesOverclockGetControlPendingValuePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesOverclockGetControlPendingValuePrologue) {
+                auto result = checker->zesOverclockGetControlPendingValuePrologue( hDomainHandle, DomainControl, pValue );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetControlPendingValue(result, hDomainHandle, DomainControl, pValue);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesOverclockGetControlPendingValuePrologue) {
+            auto result = checker->zesOverclockGetControlPendingValuePrologue( hDomainHandle, DomainControl, pValue );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetControlPendingValue(result, hDomainHandle, DomainControl, pValue);
         }
 
@@ -5871,15 +7809,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockGetControlPendingValuePrologue( hDomainHandle, DomainControl, pValue );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetControlPendingValue(result, hDomainHandle, DomainControl, pValue);
         }
 
         auto driver_result = pfnGetControlPendingValue( hDomainHandle, DomainControl, pValue );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetControlPendingValueEpilogue( hDomainHandle, DomainControl, pValue ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesOverclockGetControlPendingValueEpilogue) {
+                auto result = checker->zesOverclockGetControlPendingValueEpilogue( hDomainHandle, DomainControl, pValue ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetControlPendingValue(result, hDomainHandle, DomainControl, pValue);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesOverclockGetControlPendingValueEpilogue) {
+            auto result = checker->zesOverclockGetControlPendingValueEpilogue( hDomainHandle, DomainControl, pValue ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetControlPendingValue(result, hDomainHandle, DomainControl, pValue);
         }
 
@@ -5897,16 +7842,24 @@ namespace validation_layer
         zes_pending_action_t* pPendingAction            ///< [out] Pending overclock setting.
         )
     {
-        context.logger->log_trace("zesOverclockSetControlUserValue(hDomainHandle, DomainControl, pValue, pPendingAction)");
+        ZEL_LOG_TRACE(context.logger, "zesOverclockSetControlUserValue(hDomainHandle, DomainControl, pValue, pPendingAction)");
 
         auto pfnSetControlUserValue = context.zesDdiTable.Overclock.pfnSetControlUserValue;
 
         if( nullptr == pfnSetControlUserValue )
             return logAndPropagateResult_zesOverclockSetControlUserValue(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDomainHandle, DomainControl, pValue, pPendingAction);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockSetControlUserValuePrologue( hDomainHandle, DomainControl, pValue, pPendingAction );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesOverclockSetControlUserValuePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesOverclockSetControlUserValuePrologue) {
+                auto result = checker->zesOverclockSetControlUserValuePrologue( hDomainHandle, DomainControl, pValue, pPendingAction );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockSetControlUserValue(result, hDomainHandle, DomainControl, pValue, pPendingAction);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesOverclockSetControlUserValuePrologue) {
+            auto result = checker->zesOverclockSetControlUserValuePrologue( hDomainHandle, DomainControl, pValue, pPendingAction );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockSetControlUserValue(result, hDomainHandle, DomainControl, pValue, pPendingAction);
         }
 
@@ -5916,15 +7869,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockSetControlUserValuePrologue( hDomainHandle, DomainControl, pValue, pPendingAction );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockSetControlUserValue(result, hDomainHandle, DomainControl, pValue, pPendingAction);
         }
 
         auto driver_result = pfnSetControlUserValue( hDomainHandle, DomainControl, pValue, pPendingAction );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockSetControlUserValueEpilogue( hDomainHandle, DomainControl, pValue, pPendingAction ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesOverclockSetControlUserValueEpilogue) {
+                auto result = checker->zesOverclockSetControlUserValueEpilogue( hDomainHandle, DomainControl, pValue, pPendingAction ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockSetControlUserValue(result, hDomainHandle, DomainControl, pValue, pPendingAction);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesOverclockSetControlUserValueEpilogue) {
+            auto result = checker->zesOverclockSetControlUserValueEpilogue( hDomainHandle, DomainControl, pValue, pPendingAction ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockSetControlUserValue(result, hDomainHandle, DomainControl, pValue, pPendingAction);
         }
 
@@ -5941,16 +7901,24 @@ namespace validation_layer
         zes_pending_action_t* pPendingAction            ///< [out] Pending overclock setting.
         )
     {
-        context.logger->log_trace("zesOverclockGetControlState(hDomainHandle, DomainControl, pControlState, pPendingAction)");
+        ZEL_LOG_TRACE(context.logger, "zesOverclockGetControlState(hDomainHandle, DomainControl, pControlState, pPendingAction)");
 
         auto pfnGetControlState = context.zesDdiTable.Overclock.pfnGetControlState;
 
         if( nullptr == pfnGetControlState )
             return logAndPropagateResult_zesOverclockGetControlState(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDomainHandle, DomainControl, pControlState, pPendingAction);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetControlStatePrologue( hDomainHandle, DomainControl, pControlState, pPendingAction );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesOverclockGetControlStatePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesOverclockGetControlStatePrologue) {
+                auto result = checker->zesOverclockGetControlStatePrologue( hDomainHandle, DomainControl, pControlState, pPendingAction );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetControlState(result, hDomainHandle, DomainControl, pControlState, pPendingAction);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesOverclockGetControlStatePrologue) {
+            auto result = checker->zesOverclockGetControlStatePrologue( hDomainHandle, DomainControl, pControlState, pPendingAction );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetControlState(result, hDomainHandle, DomainControl, pControlState, pPendingAction);
         }
 
@@ -5960,15 +7928,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockGetControlStatePrologue( hDomainHandle, DomainControl, pControlState, pPendingAction );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetControlState(result, hDomainHandle, DomainControl, pControlState, pPendingAction);
         }
 
         auto driver_result = pfnGetControlState( hDomainHandle, DomainControl, pControlState, pPendingAction );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetControlStateEpilogue( hDomainHandle, DomainControl, pControlState, pPendingAction ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesOverclockGetControlStateEpilogue) {
+                auto result = checker->zesOverclockGetControlStateEpilogue( hDomainHandle, DomainControl, pControlState, pPendingAction ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetControlState(result, hDomainHandle, DomainControl, pControlState, pPendingAction);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesOverclockGetControlStateEpilogue) {
+            auto result = checker->zesOverclockGetControlStateEpilogue( hDomainHandle, DomainControl, pControlState, pPendingAction ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetControlState(result, hDomainHandle, DomainControl, pControlState, pPendingAction);
         }
 
@@ -5987,16 +7962,24 @@ namespace validation_layer
                                                         ///< units from the custom V-F curve at the specified zero-based index 
         )
     {
-        context.logger->log_trace("zesOverclockGetVFPointValues(hDomainHandle, VFType, VFArrayType, PointIndex, PointValue)");
+        ZEL_LOG_TRACE(context.logger, "zesOverclockGetVFPointValues(hDomainHandle, VFType, VFArrayType, PointIndex, PointValue)");
 
         auto pfnGetVFPointValues = context.zesDdiTable.Overclock.pfnGetVFPointValues;
 
         if( nullptr == pfnGetVFPointValues )
             return logAndPropagateResult_zesOverclockGetVFPointValues(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDomainHandle, VFType, VFArrayType, PointIndex, PointValue);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetVFPointValuesPrologue( hDomainHandle, VFType, VFArrayType, PointIndex, PointValue );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesOverclockGetVFPointValuesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesOverclockGetVFPointValuesPrologue) {
+                auto result = checker->zesOverclockGetVFPointValuesPrologue( hDomainHandle, VFType, VFArrayType, PointIndex, PointValue );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetVFPointValues(result, hDomainHandle, VFType, VFArrayType, PointIndex, PointValue);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesOverclockGetVFPointValuesPrologue) {
+            auto result = checker->zesOverclockGetVFPointValuesPrologue( hDomainHandle, VFType, VFArrayType, PointIndex, PointValue );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetVFPointValues(result, hDomainHandle, VFType, VFArrayType, PointIndex, PointValue);
         }
 
@@ -6006,15 +7989,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockGetVFPointValuesPrologue( hDomainHandle, VFType, VFArrayType, PointIndex, PointValue );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetVFPointValues(result, hDomainHandle, VFType, VFArrayType, PointIndex, PointValue);
         }
 
         auto driver_result = pfnGetVFPointValues( hDomainHandle, VFType, VFArrayType, PointIndex, PointValue );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetVFPointValuesEpilogue( hDomainHandle, VFType, VFArrayType, PointIndex, PointValue ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesOverclockGetVFPointValuesEpilogue) {
+                auto result = checker->zesOverclockGetVFPointValuesEpilogue( hDomainHandle, VFType, VFArrayType, PointIndex, PointValue ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetVFPointValues(result, hDomainHandle, VFType, VFArrayType, PointIndex, PointValue);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesOverclockGetVFPointValuesEpilogue) {
+            auto result = checker->zesOverclockGetVFPointValuesEpilogue( hDomainHandle, VFType, VFArrayType, PointIndex, PointValue ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockGetVFPointValues(result, hDomainHandle, VFType, VFArrayType, PointIndex, PointValue);
         }
 
@@ -6032,16 +8022,24 @@ namespace validation_layer
                                                         ///< custom V-F curve at the specified zero-based index 
         )
     {
-        context.logger->log_trace("zesOverclockSetVFPointValues(hDomainHandle, VFType, PointIndex, PointValue)");
+        ZEL_LOG_TRACE(context.logger, "zesOverclockSetVFPointValues(hDomainHandle, VFType, PointIndex, PointValue)");
 
         auto pfnSetVFPointValues = context.zesDdiTable.Overclock.pfnSetVFPointValues;
 
         if( nullptr == pfnSetVFPointValues )
             return logAndPropagateResult_zesOverclockSetVFPointValues(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDomainHandle, VFType, PointIndex, PointValue);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockSetVFPointValuesPrologue( hDomainHandle, VFType, PointIndex, PointValue );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesOverclockSetVFPointValuesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesOverclockSetVFPointValuesPrologue) {
+                auto result = checker->zesOverclockSetVFPointValuesPrologue( hDomainHandle, VFType, PointIndex, PointValue );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockSetVFPointValues(result, hDomainHandle, VFType, PointIndex, PointValue);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesOverclockSetVFPointValuesPrologue) {
+            auto result = checker->zesOverclockSetVFPointValuesPrologue( hDomainHandle, VFType, PointIndex, PointValue );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockSetVFPointValues(result, hDomainHandle, VFType, PointIndex, PointValue);
         }
 
@@ -6051,15 +8049,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockSetVFPointValuesPrologue( hDomainHandle, VFType, PointIndex, PointValue );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockSetVFPointValues(result, hDomainHandle, VFType, PointIndex, PointValue);
         }
 
         auto driver_result = pfnSetVFPointValues( hDomainHandle, VFType, PointIndex, PointValue );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockSetVFPointValuesEpilogue( hDomainHandle, VFType, PointIndex, PointValue ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesOverclockSetVFPointValuesEpilogue) {
+                auto result = checker->zesOverclockSetVFPointValuesEpilogue( hDomainHandle, VFType, PointIndex, PointValue ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockSetVFPointValues(result, hDomainHandle, VFType, PointIndex, PointValue);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesOverclockSetVFPointValuesEpilogue) {
+            auto result = checker->zesOverclockSetVFPointValuesEpilogue( hDomainHandle, VFType, PointIndex, PointValue ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesOverclockSetVFPointValues(result, hDomainHandle, VFType, PointIndex, PointValue);
         }
 
@@ -6084,16 +8089,24 @@ namespace validation_layer
                                                         ///< component handles.
         )
     {
-        context.logger->log_trace("zesDeviceEnumDiagnosticTestSuites(hDevice, pCount, phDiagnostics)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceEnumDiagnosticTestSuites(hDevice, pCount, phDiagnostics)");
 
         auto pfnEnumDiagnosticTestSuites = context.zesDdiTable.Device.pfnEnumDiagnosticTestSuites;
 
         if( nullptr == pfnEnumDiagnosticTestSuites )
             return logAndPropagateResult_zesDeviceEnumDiagnosticTestSuites(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pCount, phDiagnostics);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumDiagnosticTestSuitesPrologue( hDevice, pCount, phDiagnostics );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceEnumDiagnosticTestSuitesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumDiagnosticTestSuitesPrologue) {
+                auto result = checker->zesDeviceEnumDiagnosticTestSuitesPrologue( hDevice, pCount, phDiagnostics );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumDiagnosticTestSuites(result, hDevice, pCount, phDiagnostics);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumDiagnosticTestSuitesPrologue) {
+            auto result = checker->zesDeviceEnumDiagnosticTestSuitesPrologue( hDevice, pCount, phDiagnostics );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumDiagnosticTestSuites(result, hDevice, pCount, phDiagnostics);
         }
 
@@ -6103,15 +8116,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumDiagnosticTestSuitesPrologue( hDevice, pCount, phDiagnostics );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumDiagnosticTestSuites(result, hDevice, pCount, phDiagnostics);
         }
 
         auto driver_result = pfnEnumDiagnosticTestSuites( hDevice, pCount, phDiagnostics );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumDiagnosticTestSuitesEpilogue( hDevice, pCount, phDiagnostics ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumDiagnosticTestSuitesEpilogue) {
+                auto result = checker->zesDeviceEnumDiagnosticTestSuitesEpilogue( hDevice, pCount, phDiagnostics ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumDiagnosticTestSuites(result, hDevice, pCount, phDiagnostics);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumDiagnosticTestSuitesEpilogue) {
+            auto result = checker->zesDeviceEnumDiagnosticTestSuitesEpilogue( hDevice, pCount, phDiagnostics ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumDiagnosticTestSuites(result, hDevice, pCount, phDiagnostics);
         }
 
@@ -6127,16 +8147,24 @@ namespace validation_layer
                                                         ///< suite
         )
     {
-        context.logger->log_trace("zesDiagnosticsGetProperties(hDiagnostics, pProperties)");
+        ZEL_LOG_TRACE(context.logger, "zesDiagnosticsGetProperties(hDiagnostics, pProperties)");
 
         auto pfnGetProperties = context.zesDdiTable.Diagnostics.pfnGetProperties;
 
         if( nullptr == pfnGetProperties )
             return logAndPropagateResult_zesDiagnosticsGetProperties(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDiagnostics, pProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDiagnosticsGetPropertiesPrologue( hDiagnostics, pProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDiagnosticsGetPropertiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDiagnosticsGetPropertiesPrologue) {
+                auto result = checker->zesDiagnosticsGetPropertiesPrologue( hDiagnostics, pProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDiagnosticsGetProperties(result, hDiagnostics, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDiagnosticsGetPropertiesPrologue) {
+            auto result = checker->zesDiagnosticsGetPropertiesPrologue( hDiagnostics, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDiagnosticsGetProperties(result, hDiagnostics, pProperties);
         }
 
@@ -6146,15 +8174,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDiagnosticsGetPropertiesPrologue( hDiagnostics, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDiagnosticsGetProperties(result, hDiagnostics, pProperties);
         }
 
         auto driver_result = pfnGetProperties( hDiagnostics, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDiagnosticsGetPropertiesEpilogue( hDiagnostics, pProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDiagnosticsGetPropertiesEpilogue) {
+                auto result = checker->zesDiagnosticsGetPropertiesEpilogue( hDiagnostics, pProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDiagnosticsGetProperties(result, hDiagnostics, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDiagnosticsGetPropertiesEpilogue) {
+            auto result = checker->zesDiagnosticsGetPropertiesEpilogue( hDiagnostics, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDiagnosticsGetProperties(result, hDiagnostics, pProperties);
         }
 
@@ -6177,16 +8212,24 @@ namespace validation_layer
                                                         ///< driver shall only retrieve that number of tests.
         )
     {
-        context.logger->log_trace("zesDiagnosticsGetTests(hDiagnostics, pCount, pTests)");
+        ZEL_LOG_TRACE(context.logger, "zesDiagnosticsGetTests(hDiagnostics, pCount, pTests)");
 
         auto pfnGetTests = context.zesDdiTable.Diagnostics.pfnGetTests;
 
         if( nullptr == pfnGetTests )
             return logAndPropagateResult_zesDiagnosticsGetTests(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDiagnostics, pCount, pTests);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDiagnosticsGetTestsPrologue( hDiagnostics, pCount, pTests );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDiagnosticsGetTestsPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDiagnosticsGetTestsPrologue) {
+                auto result = checker->zesDiagnosticsGetTestsPrologue( hDiagnostics, pCount, pTests );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDiagnosticsGetTests(result, hDiagnostics, pCount, pTests);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDiagnosticsGetTestsPrologue) {
+            auto result = checker->zesDiagnosticsGetTestsPrologue( hDiagnostics, pCount, pTests );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDiagnosticsGetTests(result, hDiagnostics, pCount, pTests);
         }
 
@@ -6196,15 +8239,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDiagnosticsGetTestsPrologue( hDiagnostics, pCount, pTests );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDiagnosticsGetTests(result, hDiagnostics, pCount, pTests);
         }
 
         auto driver_result = pfnGetTests( hDiagnostics, pCount, pTests );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDiagnosticsGetTestsEpilogue( hDiagnostics, pCount, pTests ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDiagnosticsGetTestsEpilogue) {
+                auto result = checker->zesDiagnosticsGetTestsEpilogue( hDiagnostics, pCount, pTests ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDiagnosticsGetTests(result, hDiagnostics, pCount, pTests);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDiagnosticsGetTestsEpilogue) {
+            auto result = checker->zesDiagnosticsGetTestsEpilogue( hDiagnostics, pCount, pTests ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDiagnosticsGetTests(result, hDiagnostics, pCount, pTests);
         }
 
@@ -6223,16 +8273,24 @@ namespace validation_layer
         zes_diag_result_t* pResult                      ///< [in,out] The result of the diagnostics
         )
     {
-        context.logger->log_trace("zesDiagnosticsRunTests(hDiagnostics, startIndex, endIndex, pResult)");
+        ZEL_LOG_TRACE(context.logger, "zesDiagnosticsRunTests(hDiagnostics, startIndex, endIndex, pResult)");
 
         auto pfnRunTests = context.zesDdiTable.Diagnostics.pfnRunTests;
 
         if( nullptr == pfnRunTests )
             return logAndPropagateResult_zesDiagnosticsRunTests(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDiagnostics, startIndex, endIndex, pResult);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDiagnosticsRunTestsPrologue( hDiagnostics, startIndex, endIndex, pResult );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDiagnosticsRunTestsPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDiagnosticsRunTestsPrologue) {
+                auto result = checker->zesDiagnosticsRunTestsPrologue( hDiagnostics, startIndex, endIndex, pResult );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDiagnosticsRunTests(result, hDiagnostics, startIndex, endIndex, pResult);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDiagnosticsRunTestsPrologue) {
+            auto result = checker->zesDiagnosticsRunTestsPrologue( hDiagnostics, startIndex, endIndex, pResult );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDiagnosticsRunTests(result, hDiagnostics, startIndex, endIndex, pResult);
         }
 
@@ -6242,15 +8300,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDiagnosticsRunTestsPrologue( hDiagnostics, startIndex, endIndex, pResult );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDiagnosticsRunTests(result, hDiagnostics, startIndex, endIndex, pResult);
         }
 
         auto driver_result = pfnRunTests( hDiagnostics, startIndex, endIndex, pResult );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDiagnosticsRunTestsEpilogue( hDiagnostics, startIndex, endIndex, pResult ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDiagnosticsRunTestsEpilogue) {
+                auto result = checker->zesDiagnosticsRunTestsEpilogue( hDiagnostics, startIndex, endIndex, pResult ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDiagnosticsRunTests(result, hDiagnostics, startIndex, endIndex, pResult);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDiagnosticsRunTestsEpilogue) {
+            auto result = checker->zesDiagnosticsRunTestsEpilogue( hDiagnostics, startIndex, endIndex, pResult ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDiagnosticsRunTests(result, hDiagnostics, startIndex, endIndex, pResult);
         }
 
@@ -6265,16 +8330,24 @@ namespace validation_layer
         ze_bool_t* pAvailable                           ///< [out] ECC functionality is available (true)/unavailable (false).
         )
     {
-        context.logger->log_trace("zesDeviceEccAvailable(hDevice, pAvailable)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceEccAvailable(hDevice, pAvailable)");
 
         auto pfnEccAvailable = context.zesDdiTable.Device.pfnEccAvailable;
 
         if( nullptr == pfnEccAvailable )
             return logAndPropagateResult_zesDeviceEccAvailable(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pAvailable);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEccAvailablePrologue( hDevice, pAvailable );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceEccAvailablePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEccAvailablePrologue) {
+                auto result = checker->zesDeviceEccAvailablePrologue( hDevice, pAvailable );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEccAvailable(result, hDevice, pAvailable);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEccAvailablePrologue) {
+            auto result = checker->zesDeviceEccAvailablePrologue( hDevice, pAvailable );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEccAvailable(result, hDevice, pAvailable);
         }
 
@@ -6284,15 +8357,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEccAvailablePrologue( hDevice, pAvailable );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEccAvailable(result, hDevice, pAvailable);
         }
 
         auto driver_result = pfnEccAvailable( hDevice, pAvailable );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEccAvailableEpilogue( hDevice, pAvailable ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEccAvailableEpilogue) {
+                auto result = checker->zesDeviceEccAvailableEpilogue( hDevice, pAvailable ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEccAvailable(result, hDevice, pAvailable);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEccAvailableEpilogue) {
+            auto result = checker->zesDeviceEccAvailableEpilogue( hDevice, pAvailable ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEccAvailable(result, hDevice, pAvailable);
         }
 
@@ -6307,16 +8387,24 @@ namespace validation_layer
         ze_bool_t* pConfigurable                        ///< [out] ECC can be enabled/disabled (true)/enabled/disabled (false).
         )
     {
-        context.logger->log_trace("zesDeviceEccConfigurable(hDevice, pConfigurable)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceEccConfigurable(hDevice, pConfigurable)");
 
         auto pfnEccConfigurable = context.zesDdiTable.Device.pfnEccConfigurable;
 
         if( nullptr == pfnEccConfigurable )
             return logAndPropagateResult_zesDeviceEccConfigurable(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pConfigurable);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEccConfigurablePrologue( hDevice, pConfigurable );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceEccConfigurablePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEccConfigurablePrologue) {
+                auto result = checker->zesDeviceEccConfigurablePrologue( hDevice, pConfigurable );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEccConfigurable(result, hDevice, pConfigurable);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEccConfigurablePrologue) {
+            auto result = checker->zesDeviceEccConfigurablePrologue( hDevice, pConfigurable );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEccConfigurable(result, hDevice, pConfigurable);
         }
 
@@ -6326,15 +8414,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEccConfigurablePrologue( hDevice, pConfigurable );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEccConfigurable(result, hDevice, pConfigurable);
         }
 
         auto driver_result = pfnEccConfigurable( hDevice, pConfigurable );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEccConfigurableEpilogue( hDevice, pConfigurable ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEccConfigurableEpilogue) {
+                auto result = checker->zesDeviceEccConfigurableEpilogue( hDevice, pConfigurable ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEccConfigurable(result, hDevice, pConfigurable);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEccConfigurableEpilogue) {
+            auto result = checker->zesDeviceEccConfigurableEpilogue( hDevice, pConfigurable ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEccConfigurable(result, hDevice, pConfigurable);
         }
 
@@ -6349,16 +8444,24 @@ namespace validation_layer
         zes_device_ecc_properties_t* pState             ///< [out] ECC state, pending state, and pending action for state change.
         )
     {
-        context.logger->log_trace("zesDeviceGetEccState(hDevice, pState)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceGetEccState(hDevice, pState)");
 
         auto pfnGetEccState = context.zesDdiTable.Device.pfnGetEccState;
 
         if( nullptr == pfnGetEccState )
             return logAndPropagateResult_zesDeviceGetEccState(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pState);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetEccStatePrologue( hDevice, pState );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceGetEccStatePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceGetEccStatePrologue) {
+                auto result = checker->zesDeviceGetEccStatePrologue( hDevice, pState );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetEccState(result, hDevice, pState);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceGetEccStatePrologue) {
+            auto result = checker->zesDeviceGetEccStatePrologue( hDevice, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetEccState(result, hDevice, pState);
         }
 
@@ -6368,15 +8471,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetEccStatePrologue( hDevice, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetEccState(result, hDevice, pState);
         }
 
         auto driver_result = pfnGetEccState( hDevice, pState );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetEccStateEpilogue( hDevice, pState ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceGetEccStateEpilogue) {
+                auto result = checker->zesDeviceGetEccStateEpilogue( hDevice, pState ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetEccState(result, hDevice, pState);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceGetEccStateEpilogue) {
+            auto result = checker->zesDeviceGetEccStateEpilogue( hDevice, pState ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetEccState(result, hDevice, pState);
         }
 
@@ -6392,16 +8502,24 @@ namespace validation_layer
         zes_device_ecc_properties_t* pState             ///< [out] ECC state, pending state, and pending action for state change.
         )
     {
-        context.logger->log_trace("zesDeviceSetEccState(hDevice, newState, pState)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceSetEccState(hDevice, newState, pState)");
 
         auto pfnSetEccState = context.zesDdiTable.Device.pfnSetEccState;
 
         if( nullptr == pfnSetEccState )
             return logAndPropagateResult_zesDeviceSetEccState(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, newState, pState);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceSetEccStatePrologue( hDevice, newState, pState );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceSetEccStatePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceSetEccStatePrologue) {
+                auto result = checker->zesDeviceSetEccStatePrologue( hDevice, newState, pState );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceSetEccState(result, hDevice, newState, pState);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceSetEccStatePrologue) {
+            auto result = checker->zesDeviceSetEccStatePrologue( hDevice, newState, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceSetEccState(result, hDevice, newState, pState);
         }
 
@@ -6411,15 +8529,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceSetEccStatePrologue( hDevice, newState, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceSetEccState(result, hDevice, newState, pState);
         }
 
         auto driver_result = pfnSetEccState( hDevice, newState, pState );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceSetEccStateEpilogue( hDevice, newState, pState ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceSetEccStateEpilogue) {
+                auto result = checker->zesDeviceSetEccStateEpilogue( hDevice, newState, pState ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceSetEccState(result, hDevice, newState, pState);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceSetEccStateEpilogue) {
+            auto result = checker->zesDeviceSetEccStateEpilogue( hDevice, newState, pState ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceSetEccState(result, hDevice, newState, pState);
         }
 
@@ -6444,16 +8569,24 @@ namespace validation_layer
                                                         ///< component handles.
         )
     {
-        context.logger->log_trace("zesDeviceEnumEngineGroups(hDevice, pCount, phEngine)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceEnumEngineGroups(hDevice, pCount, phEngine)");
 
         auto pfnEnumEngineGroups = context.zesDdiTable.Device.pfnEnumEngineGroups;
 
         if( nullptr == pfnEnumEngineGroups )
             return logAndPropagateResult_zesDeviceEnumEngineGroups(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pCount, phEngine);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumEngineGroupsPrologue( hDevice, pCount, phEngine );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceEnumEngineGroupsPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumEngineGroupsPrologue) {
+                auto result = checker->zesDeviceEnumEngineGroupsPrologue( hDevice, pCount, phEngine );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumEngineGroups(result, hDevice, pCount, phEngine);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumEngineGroupsPrologue) {
+            auto result = checker->zesDeviceEnumEngineGroupsPrologue( hDevice, pCount, phEngine );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumEngineGroups(result, hDevice, pCount, phEngine);
         }
 
@@ -6463,15 +8596,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumEngineGroupsPrologue( hDevice, pCount, phEngine );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumEngineGroups(result, hDevice, pCount, phEngine);
         }
 
         auto driver_result = pfnEnumEngineGroups( hDevice, pCount, phEngine );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumEngineGroupsEpilogue( hDevice, pCount, phEngine ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumEngineGroupsEpilogue) {
+                auto result = checker->zesDeviceEnumEngineGroupsEpilogue( hDevice, pCount, phEngine ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumEngineGroups(result, hDevice, pCount, phEngine);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumEngineGroupsEpilogue) {
+            auto result = checker->zesDeviceEnumEngineGroupsEpilogue( hDevice, pCount, phEngine ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumEngineGroups(result, hDevice, pCount, phEngine);
         }
 
@@ -6486,16 +8626,24 @@ namespace validation_layer
         zes_engine_properties_t* pProperties            ///< [in,out] The properties for the specified engine group.
         )
     {
-        context.logger->log_trace("zesEngineGetProperties(hEngine, pProperties)");
+        ZEL_LOG_TRACE(context.logger, "zesEngineGetProperties(hEngine, pProperties)");
 
         auto pfnGetProperties = context.zesDdiTable.Engine.pfnGetProperties;
 
         if( nullptr == pfnGetProperties )
             return logAndPropagateResult_zesEngineGetProperties(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hEngine, pProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesEngineGetPropertiesPrologue( hEngine, pProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesEngineGetPropertiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesEngineGetPropertiesPrologue) {
+                auto result = checker->zesEngineGetPropertiesPrologue( hEngine, pProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesEngineGetProperties(result, hEngine, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesEngineGetPropertiesPrologue) {
+            auto result = checker->zesEngineGetPropertiesPrologue( hEngine, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesEngineGetProperties(result, hEngine, pProperties);
         }
 
@@ -6505,15 +8653,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesEngineGetPropertiesPrologue( hEngine, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesEngineGetProperties(result, hEngine, pProperties);
         }
 
         auto driver_result = pfnGetProperties( hEngine, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesEngineGetPropertiesEpilogue( hEngine, pProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesEngineGetPropertiesEpilogue) {
+                auto result = checker->zesEngineGetPropertiesEpilogue( hEngine, pProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesEngineGetProperties(result, hEngine, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesEngineGetPropertiesEpilogue) {
+            auto result = checker->zesEngineGetPropertiesEpilogue( hEngine, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesEngineGetProperties(result, hEngine, pProperties);
         }
 
@@ -6529,16 +8684,24 @@ namespace validation_layer
                                                         ///< counters.
         )
     {
-        context.logger->log_trace("zesEngineGetActivity(hEngine, pStats)");
+        ZEL_LOG_TRACE(context.logger, "zesEngineGetActivity(hEngine, pStats)");
 
         auto pfnGetActivity = context.zesDdiTable.Engine.pfnGetActivity;
 
         if( nullptr == pfnGetActivity )
             return logAndPropagateResult_zesEngineGetActivity(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hEngine, pStats);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesEngineGetActivityPrologue( hEngine, pStats );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesEngineGetActivityPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesEngineGetActivityPrologue) {
+                auto result = checker->zesEngineGetActivityPrologue( hEngine, pStats );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesEngineGetActivity(result, hEngine, pStats);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesEngineGetActivityPrologue) {
+            auto result = checker->zesEngineGetActivityPrologue( hEngine, pStats );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesEngineGetActivity(result, hEngine, pStats);
         }
 
@@ -6548,15 +8711,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesEngineGetActivityPrologue( hEngine, pStats );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesEngineGetActivity(result, hEngine, pStats);
         }
 
         auto driver_result = pfnGetActivity( hEngine, pStats );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesEngineGetActivityEpilogue( hEngine, pStats ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesEngineGetActivityEpilogue) {
+                auto result = checker->zesEngineGetActivityEpilogue( hEngine, pStats ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesEngineGetActivity(result, hEngine, pStats);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesEngineGetActivityEpilogue) {
+            auto result = checker->zesEngineGetActivityEpilogue( hEngine, pStats ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesEngineGetActivity(result, hEngine, pStats);
         }
 
@@ -6571,16 +8741,24 @@ namespace validation_layer
         zes_event_type_flags_t events                   ///< [in] List of events to listen to.
         )
     {
-        context.logger->log_trace("zesDeviceEventRegister(hDevice, events)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceEventRegister(hDevice, events)");
 
         auto pfnEventRegister = context.zesDdiTable.Device.pfnEventRegister;
 
         if( nullptr == pfnEventRegister )
             return logAndPropagateResult_zesDeviceEventRegister(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, events);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEventRegisterPrologue( hDevice, events );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceEventRegisterPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEventRegisterPrologue) {
+                auto result = checker->zesDeviceEventRegisterPrologue( hDevice, events );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEventRegister(result, hDevice, events);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEventRegisterPrologue) {
+            auto result = checker->zesDeviceEventRegisterPrologue( hDevice, events );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEventRegister(result, hDevice, events);
         }
 
@@ -6590,15 +8768,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEventRegisterPrologue( hDevice, events );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEventRegister(result, hDevice, events);
         }
 
         auto driver_result = pfnEventRegister( hDevice, events );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEventRegisterEpilogue( hDevice, events ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEventRegisterEpilogue) {
+                auto result = checker->zesDeviceEventRegisterEpilogue( hDevice, events ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEventRegister(result, hDevice, events);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEventRegisterEpilogue) {
+            auto result = checker->zesDeviceEventRegisterEpilogue( hDevice, events ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEventRegister(result, hDevice, events);
         }
 
@@ -6629,16 +8814,24 @@ namespace validation_layer
                                                         ///< entry will be zero.
         )
     {
-        context.logger->log_trace("zesDriverEventListen(hDriver, timeout, count, phDevicesLocal, pNumDeviceEvents, pEvents)");
+        ZEL_LOG_TRACE(context.logger, "zesDriverEventListen(hDriver, timeout, count, phDevicesLocal, pNumDeviceEvents, pEvents)");
 
         auto pfnEventListen = context.zesDdiTable.Driver.pfnEventListen;
 
         if( nullptr == pfnEventListen )
             return logAndPropagateResult_zesDriverEventListen(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDriverEventListenPrologue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDriverEventListenPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDriverEventListenPrologue) {
+                auto result = checker->zesDriverEventListenPrologue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverEventListen(result, hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDriverEventListenPrologue) {
+            auto result = checker->zesDriverEventListenPrologue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverEventListen(result, hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents);
         }
 
@@ -6648,15 +8841,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDriverEventListenPrologue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverEventListen(result, hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents);
         }
 
         auto driver_result = pfnEventListen( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDriverEventListenEpilogue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDriverEventListenEpilogue) {
+                auto result = checker->zesDriverEventListenEpilogue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverEventListen(result, hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDriverEventListenEpilogue) {
+            auto result = checker->zesDriverEventListenEpilogue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverEventListen(result, hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents);
         }
 
@@ -6687,16 +8887,24 @@ namespace validation_layer
                                                         ///< entry will be zero.
         )
     {
-        context.logger->log_trace("zesDriverEventListenEx(hDriver, timeout, count, phDevicesLocal, pNumDeviceEvents, pEvents)");
+        ZEL_LOG_TRACE(context.logger, "zesDriverEventListenEx(hDriver, timeout, count, phDevicesLocal, pNumDeviceEvents, pEvents)");
 
         auto pfnEventListenEx = context.zesDdiTable.Driver.pfnEventListenEx;
 
         if( nullptr == pfnEventListenEx )
             return logAndPropagateResult_zesDriverEventListenEx(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDriverEventListenExPrologue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDriverEventListenExPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDriverEventListenExPrologue) {
+                auto result = checker->zesDriverEventListenExPrologue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverEventListenEx(result, hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDriverEventListenExPrologue) {
+            auto result = checker->zesDriverEventListenExPrologue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverEventListenEx(result, hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents);
         }
 
@@ -6706,15 +8914,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDriverEventListenExPrologue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverEventListenEx(result, hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents);
         }
 
         auto driver_result = pfnEventListenEx( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDriverEventListenExEpilogue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDriverEventListenExEpilogue) {
+                auto result = checker->zesDriverEventListenExEpilogue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverEventListenEx(result, hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDriverEventListenExEpilogue) {
+            auto result = checker->zesDriverEventListenExEpilogue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverEventListenEx(result, hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents);
         }
 
@@ -6739,16 +8954,24 @@ namespace validation_layer
                                                         ///< component handles.
         )
     {
-        context.logger->log_trace("zesDeviceEnumFabricPorts(hDevice, pCount, phPort)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceEnumFabricPorts(hDevice, pCount, phPort)");
 
         auto pfnEnumFabricPorts = context.zesDdiTable.Device.pfnEnumFabricPorts;
 
         if( nullptr == pfnEnumFabricPorts )
             return logAndPropagateResult_zesDeviceEnumFabricPorts(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pCount, phPort);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumFabricPortsPrologue( hDevice, pCount, phPort );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceEnumFabricPortsPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumFabricPortsPrologue) {
+                auto result = checker->zesDeviceEnumFabricPortsPrologue( hDevice, pCount, phPort );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumFabricPorts(result, hDevice, pCount, phPort);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumFabricPortsPrologue) {
+            auto result = checker->zesDeviceEnumFabricPortsPrologue( hDevice, pCount, phPort );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumFabricPorts(result, hDevice, pCount, phPort);
         }
 
@@ -6758,15 +8981,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumFabricPortsPrologue( hDevice, pCount, phPort );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumFabricPorts(result, hDevice, pCount, phPort);
         }
 
         auto driver_result = pfnEnumFabricPorts( hDevice, pCount, phPort );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumFabricPortsEpilogue( hDevice, pCount, phPort ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumFabricPortsEpilogue) {
+                auto result = checker->zesDeviceEnumFabricPortsEpilogue( hDevice, pCount, phPort ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumFabricPorts(result, hDevice, pCount, phPort);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumFabricPortsEpilogue) {
+            auto result = checker->zesDeviceEnumFabricPortsEpilogue( hDevice, pCount, phPort ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumFabricPorts(result, hDevice, pCount, phPort);
         }
 
@@ -6781,16 +9011,24 @@ namespace validation_layer
         zes_fabric_port_properties_t* pProperties       ///< [in,out] Will contain properties of the Fabric Port.
         )
     {
-        context.logger->log_trace("zesFabricPortGetProperties(hPort, pProperties)");
+        ZEL_LOG_TRACE(context.logger, "zesFabricPortGetProperties(hPort, pProperties)");
 
         auto pfnGetProperties = context.zesDdiTable.FabricPort.pfnGetProperties;
 
         if( nullptr == pfnGetProperties )
             return logAndPropagateResult_zesFabricPortGetProperties(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hPort, pProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetPropertiesPrologue( hPort, pProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFabricPortGetPropertiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFabricPortGetPropertiesPrologue) {
+                auto result = checker->zesFabricPortGetPropertiesPrologue( hPort, pProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetProperties(result, hPort, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFabricPortGetPropertiesPrologue) {
+            auto result = checker->zesFabricPortGetPropertiesPrologue( hPort, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetProperties(result, hPort, pProperties);
         }
 
@@ -6800,15 +9038,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortGetPropertiesPrologue( hPort, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetProperties(result, hPort, pProperties);
         }
 
         auto driver_result = pfnGetProperties( hPort, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetPropertiesEpilogue( hPort, pProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFabricPortGetPropertiesEpilogue) {
+                auto result = checker->zesFabricPortGetPropertiesEpilogue( hPort, pProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetProperties(result, hPort, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFabricPortGetPropertiesEpilogue) {
+            auto result = checker->zesFabricPortGetPropertiesEpilogue( hPort, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetProperties(result, hPort, pProperties);
         }
 
@@ -6824,16 +9069,24 @@ namespace validation_layer
                                                         ///< port.
         )
     {
-        context.logger->log_trace("zesFabricPortGetLinkType(hPort, pLinkType)");
+        ZEL_LOG_TRACE(context.logger, "zesFabricPortGetLinkType(hPort, pLinkType)");
 
         auto pfnGetLinkType = context.zesDdiTable.FabricPort.pfnGetLinkType;
 
         if( nullptr == pfnGetLinkType )
             return logAndPropagateResult_zesFabricPortGetLinkType(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hPort, pLinkType);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetLinkTypePrologue( hPort, pLinkType );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFabricPortGetLinkTypePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFabricPortGetLinkTypePrologue) {
+                auto result = checker->zesFabricPortGetLinkTypePrologue( hPort, pLinkType );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetLinkType(result, hPort, pLinkType);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFabricPortGetLinkTypePrologue) {
+            auto result = checker->zesFabricPortGetLinkTypePrologue( hPort, pLinkType );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetLinkType(result, hPort, pLinkType);
         }
 
@@ -6843,15 +9096,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortGetLinkTypePrologue( hPort, pLinkType );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetLinkType(result, hPort, pLinkType);
         }
 
         auto driver_result = pfnGetLinkType( hPort, pLinkType );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetLinkTypeEpilogue( hPort, pLinkType ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFabricPortGetLinkTypeEpilogue) {
+                auto result = checker->zesFabricPortGetLinkTypeEpilogue( hPort, pLinkType ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetLinkType(result, hPort, pLinkType);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFabricPortGetLinkTypeEpilogue) {
+            auto result = checker->zesFabricPortGetLinkTypeEpilogue( hPort, pLinkType ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetLinkType(result, hPort, pLinkType);
         }
 
@@ -6866,16 +9126,24 @@ namespace validation_layer
         zes_fabric_port_config_t* pConfig               ///< [in,out] Will contain configuration of the Fabric Port.
         )
     {
-        context.logger->log_trace("zesFabricPortGetConfig(hPort, pConfig)");
+        ZEL_LOG_TRACE(context.logger, "zesFabricPortGetConfig(hPort, pConfig)");
 
         auto pfnGetConfig = context.zesDdiTable.FabricPort.pfnGetConfig;
 
         if( nullptr == pfnGetConfig )
             return logAndPropagateResult_zesFabricPortGetConfig(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hPort, pConfig);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetConfigPrologue( hPort, pConfig );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFabricPortGetConfigPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFabricPortGetConfigPrologue) {
+                auto result = checker->zesFabricPortGetConfigPrologue( hPort, pConfig );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetConfig(result, hPort, pConfig);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFabricPortGetConfigPrologue) {
+            auto result = checker->zesFabricPortGetConfigPrologue( hPort, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetConfig(result, hPort, pConfig);
         }
 
@@ -6885,15 +9153,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortGetConfigPrologue( hPort, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetConfig(result, hPort, pConfig);
         }
 
         auto driver_result = pfnGetConfig( hPort, pConfig );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetConfigEpilogue( hPort, pConfig ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFabricPortGetConfigEpilogue) {
+                auto result = checker->zesFabricPortGetConfigEpilogue( hPort, pConfig ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetConfig(result, hPort, pConfig);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFabricPortGetConfigEpilogue) {
+            auto result = checker->zesFabricPortGetConfigEpilogue( hPort, pConfig ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetConfig(result, hPort, pConfig);
         }
 
@@ -6908,16 +9183,24 @@ namespace validation_layer
         const zes_fabric_port_config_t* pConfig         ///< [in] Contains new configuration of the Fabric Port.
         )
     {
-        context.logger->log_trace("zesFabricPortSetConfig(hPort, pConfig)");
+        ZEL_LOG_TRACE(context.logger, "zesFabricPortSetConfig(hPort, pConfig)");
 
         auto pfnSetConfig = context.zesDdiTable.FabricPort.pfnSetConfig;
 
         if( nullptr == pfnSetConfig )
             return logAndPropagateResult_zesFabricPortSetConfig(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hPort, pConfig);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortSetConfigPrologue( hPort, pConfig );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFabricPortSetConfigPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFabricPortSetConfigPrologue) {
+                auto result = checker->zesFabricPortSetConfigPrologue( hPort, pConfig );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortSetConfig(result, hPort, pConfig);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFabricPortSetConfigPrologue) {
+            auto result = checker->zesFabricPortSetConfigPrologue( hPort, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortSetConfig(result, hPort, pConfig);
         }
 
@@ -6927,15 +9210,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortSetConfigPrologue( hPort, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortSetConfig(result, hPort, pConfig);
         }
 
         auto driver_result = pfnSetConfig( hPort, pConfig );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortSetConfigEpilogue( hPort, pConfig ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFabricPortSetConfigEpilogue) {
+                auto result = checker->zesFabricPortSetConfigEpilogue( hPort, pConfig ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortSetConfig(result, hPort, pConfig);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFabricPortSetConfigEpilogue) {
+            auto result = checker->zesFabricPortSetConfigEpilogue( hPort, pConfig ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortSetConfig(result, hPort, pConfig);
         }
 
@@ -6950,16 +9240,24 @@ namespace validation_layer
         zes_fabric_port_state_t* pState                 ///< [in,out] Will contain the current state of the Fabric Port
         )
     {
-        context.logger->log_trace("zesFabricPortGetState(hPort, pState)");
+        ZEL_LOG_TRACE(context.logger, "zesFabricPortGetState(hPort, pState)");
 
         auto pfnGetState = context.zesDdiTable.FabricPort.pfnGetState;
 
         if( nullptr == pfnGetState )
             return logAndPropagateResult_zesFabricPortGetState(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hPort, pState);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetStatePrologue( hPort, pState );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFabricPortGetStatePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFabricPortGetStatePrologue) {
+                auto result = checker->zesFabricPortGetStatePrologue( hPort, pState );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetState(result, hPort, pState);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFabricPortGetStatePrologue) {
+            auto result = checker->zesFabricPortGetStatePrologue( hPort, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetState(result, hPort, pState);
         }
 
@@ -6969,15 +9267,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortGetStatePrologue( hPort, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetState(result, hPort, pState);
         }
 
         auto driver_result = pfnGetState( hPort, pState );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetStateEpilogue( hPort, pState ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFabricPortGetStateEpilogue) {
+                auto result = checker->zesFabricPortGetStateEpilogue( hPort, pState ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetState(result, hPort, pState);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFabricPortGetStateEpilogue) {
+            auto result = checker->zesFabricPortGetStateEpilogue( hPort, pState ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetState(result, hPort, pState);
         }
 
@@ -6992,17 +9297,25 @@ namespace validation_layer
         zes_fabric_port_throughput_t* pThroughput       ///< [in,out] Will contain the Fabric port throughput counters.
         )
     {
-        context.logger->log_trace("zesFabricPortGetThroughput(hPort, pThroughput)");
+        ZEL_LOG_TRACE(context.logger, "zesFabricPortGetThroughput(hPort, pThroughput)");
 
         auto pfnGetThroughput = context.zesDdiTable.FabricPort.pfnGetThroughput;
 
         if( nullptr == pfnGetThroughput )
             return logAndPropagateResult_zesFabricPortGetThroughput(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hPort, pThroughput);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetThroughputPrologue( hPort, pThroughput );
-            if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetThroughput(result, hPort, pThroughput);
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFabricPortGetThroughputPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFabricPortGetThroughputPrologue) {
+                auto result = checker->zesFabricPortGetThroughputPrologue( hPort, pThroughput );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetThroughput(result, hPort, pThroughput);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFabricPortGetThroughputPrologue) {
+            auto result = checker->zesFabricPortGetThroughputPrologue( hPort, pThroughput );
+            if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetThroughput(result, hPort, pThroughput);
         }
 
 
@@ -7011,15 +9324,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortGetThroughputPrologue( hPort, pThroughput );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetThroughput(result, hPort, pThroughput);
         }
 
         auto driver_result = pfnGetThroughput( hPort, pThroughput );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetThroughputEpilogue( hPort, pThroughput ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFabricPortGetThroughputEpilogue) {
+                auto result = checker->zesFabricPortGetThroughputEpilogue( hPort, pThroughput ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetThroughput(result, hPort, pThroughput);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFabricPortGetThroughputEpilogue) {
+            auto result = checker->zesFabricPortGetThroughputEpilogue( hPort, pThroughput ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetThroughput(result, hPort, pThroughput);
         }
 
@@ -7034,16 +9354,24 @@ namespace validation_layer
         zes_fabric_port_error_counters_t* pErrors       ///< [in,out] Will contain the Fabric port Error counters.
         )
     {
-        context.logger->log_trace("zesFabricPortGetFabricErrorCounters(hPort, pErrors)");
+        ZEL_LOG_TRACE(context.logger, "zesFabricPortGetFabricErrorCounters(hPort, pErrors)");
 
         auto pfnGetFabricErrorCounters = context.zesDdiTable.FabricPort.pfnGetFabricErrorCounters;
 
         if( nullptr == pfnGetFabricErrorCounters )
             return logAndPropagateResult_zesFabricPortGetFabricErrorCounters(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hPort, pErrors);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetFabricErrorCountersPrologue( hPort, pErrors );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFabricPortGetFabricErrorCountersPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFabricPortGetFabricErrorCountersPrologue) {
+                auto result = checker->zesFabricPortGetFabricErrorCountersPrologue( hPort, pErrors );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetFabricErrorCounters(result, hPort, pErrors);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFabricPortGetFabricErrorCountersPrologue) {
+            auto result = checker->zesFabricPortGetFabricErrorCountersPrologue( hPort, pErrors );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetFabricErrorCounters(result, hPort, pErrors);
         }
 
@@ -7053,15 +9381,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortGetFabricErrorCountersPrologue( hPort, pErrors );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetFabricErrorCounters(result, hPort, pErrors);
         }
 
         auto driver_result = pfnGetFabricErrorCounters( hPort, pErrors );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetFabricErrorCountersEpilogue( hPort, pErrors ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFabricPortGetFabricErrorCountersEpilogue) {
+                auto result = checker->zesFabricPortGetFabricErrorCountersEpilogue( hPort, pErrors ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetFabricErrorCounters(result, hPort, pErrors);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFabricPortGetFabricErrorCountersEpilogue) {
+            auto result = checker->zesFabricPortGetFabricErrorCountersEpilogue( hPort, pErrors ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetFabricErrorCounters(result, hPort, pErrors);
         }
 
@@ -7080,16 +9415,24 @@ namespace validation_layer
                                                         ///< from multiple ports of type ::zes_fabric_port_throughput_t.
         )
     {
-        context.logger->log_trace("zesFabricPortGetMultiPortThroughput(hDevice, numPorts, phPortLocal, pThroughput)");
+        ZEL_LOG_TRACE(context.logger, "zesFabricPortGetMultiPortThroughput(hDevice, numPorts, phPortLocal, pThroughput)");
 
         auto pfnGetMultiPortThroughput = context.zesDdiTable.FabricPort.pfnGetMultiPortThroughput;
 
         if( nullptr == pfnGetMultiPortThroughput )
             return logAndPropagateResult_zesFabricPortGetMultiPortThroughput(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, numPorts, phPort, pThroughput);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetMultiPortThroughputPrologue( hDevice, numPorts, phPort, pThroughput );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFabricPortGetMultiPortThroughputPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFabricPortGetMultiPortThroughputPrologue) {
+                auto result = checker->zesFabricPortGetMultiPortThroughputPrologue( hDevice, numPorts, phPort, pThroughput );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetMultiPortThroughput(result, hDevice, numPorts, phPort, pThroughput);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFabricPortGetMultiPortThroughputPrologue) {
+            auto result = checker->zesFabricPortGetMultiPortThroughputPrologue( hDevice, numPorts, phPort, pThroughput );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetMultiPortThroughput(result, hDevice, numPorts, phPort, pThroughput);
         }
 
@@ -7099,15 +9442,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortGetMultiPortThroughputPrologue( hDevice, numPorts, phPort, pThroughput );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetMultiPortThroughput(result, hDevice, numPorts, phPort, pThroughput);
         }
 
         auto driver_result = pfnGetMultiPortThroughput( hDevice, numPorts, phPort, pThroughput );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetMultiPortThroughputEpilogue( hDevice, numPorts, phPort, pThroughput ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFabricPortGetMultiPortThroughputEpilogue) {
+                auto result = checker->zesFabricPortGetMultiPortThroughputEpilogue( hDevice, numPorts, phPort, pThroughput ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetMultiPortThroughput(result, hDevice, numPorts, phPort, pThroughput);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFabricPortGetMultiPortThroughputEpilogue) {
+            auto result = checker->zesFabricPortGetMultiPortThroughputEpilogue( hDevice, numPorts, phPort, pThroughput ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFabricPortGetMultiPortThroughput(result, hDevice, numPorts, phPort, pThroughput);
         }
 
@@ -7132,16 +9482,24 @@ namespace validation_layer
                                                         ///< component handles.
         )
     {
-        context.logger->log_trace("zesDeviceEnumFans(hDevice, pCount, phFan)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceEnumFans(hDevice, pCount, phFan)");
 
         auto pfnEnumFans = context.zesDdiTable.Device.pfnEnumFans;
 
         if( nullptr == pfnEnumFans )
             return logAndPropagateResult_zesDeviceEnumFans(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pCount, phFan);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumFansPrologue( hDevice, pCount, phFan );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceEnumFansPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumFansPrologue) {
+                auto result = checker->zesDeviceEnumFansPrologue( hDevice, pCount, phFan );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumFans(result, hDevice, pCount, phFan);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumFansPrologue) {
+            auto result = checker->zesDeviceEnumFansPrologue( hDevice, pCount, phFan );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumFans(result, hDevice, pCount, phFan);
         }
 
@@ -7151,15 +9509,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumFansPrologue( hDevice, pCount, phFan );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumFans(result, hDevice, pCount, phFan);
         }
 
         auto driver_result = pfnEnumFans( hDevice, pCount, phFan );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumFansEpilogue( hDevice, pCount, phFan ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumFansEpilogue) {
+                auto result = checker->zesDeviceEnumFansEpilogue( hDevice, pCount, phFan ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumFans(result, hDevice, pCount, phFan);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumFansEpilogue) {
+            auto result = checker->zesDeviceEnumFansEpilogue( hDevice, pCount, phFan ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumFans(result, hDevice, pCount, phFan);
         }
 
@@ -7174,16 +9539,24 @@ namespace validation_layer
         zes_fan_properties_t* pProperties               ///< [in,out] Will contain the properties of the fan.
         )
     {
-        context.logger->log_trace("zesFanGetProperties(hFan, pProperties)");
+        ZEL_LOG_TRACE(context.logger, "zesFanGetProperties(hFan, pProperties)");
 
         auto pfnGetProperties = context.zesDdiTable.Fan.pfnGetProperties;
 
         if( nullptr == pfnGetProperties )
             return logAndPropagateResult_zesFanGetProperties(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFan, pProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFanGetPropertiesPrologue( hFan, pProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFanGetPropertiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFanGetPropertiesPrologue) {
+                auto result = checker->zesFanGetPropertiesPrologue( hFan, pProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanGetProperties(result, hFan, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFanGetPropertiesPrologue) {
+            auto result = checker->zesFanGetPropertiesPrologue( hFan, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanGetProperties(result, hFan, pProperties);
         }
 
@@ -7193,15 +9566,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFanGetPropertiesPrologue( hFan, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanGetProperties(result, hFan, pProperties);
         }
 
         auto driver_result = pfnGetProperties( hFan, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFanGetPropertiesEpilogue( hFan, pProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFanGetPropertiesEpilogue) {
+                auto result = checker->zesFanGetPropertiesEpilogue( hFan, pProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanGetProperties(result, hFan, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFanGetPropertiesEpilogue) {
+            auto result = checker->zesFanGetPropertiesEpilogue( hFan, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanGetProperties(result, hFan, pProperties);
         }
 
@@ -7216,16 +9596,24 @@ namespace validation_layer
         zes_fan_config_t* pConfig                       ///< [in,out] Will contain the current configuration of the fan.
         )
     {
-        context.logger->log_trace("zesFanGetConfig(hFan, pConfig)");
+        ZEL_LOG_TRACE(context.logger, "zesFanGetConfig(hFan, pConfig)");
 
         auto pfnGetConfig = context.zesDdiTable.Fan.pfnGetConfig;
 
         if( nullptr == pfnGetConfig )
             return logAndPropagateResult_zesFanGetConfig(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFan, pConfig);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFanGetConfigPrologue( hFan, pConfig );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFanGetConfigPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFanGetConfigPrologue) {
+                auto result = checker->zesFanGetConfigPrologue( hFan, pConfig );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanGetConfig(result, hFan, pConfig);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFanGetConfigPrologue) {
+            auto result = checker->zesFanGetConfigPrologue( hFan, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanGetConfig(result, hFan, pConfig);
         }
 
@@ -7235,15 +9623,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFanGetConfigPrologue( hFan, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanGetConfig(result, hFan, pConfig);
         }
 
         auto driver_result = pfnGetConfig( hFan, pConfig );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFanGetConfigEpilogue( hFan, pConfig ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFanGetConfigEpilogue) {
+                auto result = checker->zesFanGetConfigEpilogue( hFan, pConfig ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanGetConfig(result, hFan, pConfig);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFanGetConfigEpilogue) {
+            auto result = checker->zesFanGetConfigEpilogue( hFan, pConfig ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanGetConfig(result, hFan, pConfig);
         }
 
@@ -7257,16 +9652,24 @@ namespace validation_layer
         zes_fan_handle_t hFan                           ///< [in] Handle for the component.
         )
     {
-        context.logger->log_trace("zesFanSetDefaultMode(hFan)");
+        ZEL_LOG_TRACE(context.logger, "zesFanSetDefaultMode(hFan)");
 
         auto pfnSetDefaultMode = context.zesDdiTable.Fan.pfnSetDefaultMode;
 
         if( nullptr == pfnSetDefaultMode )
             return logAndPropagateResult_zesFanSetDefaultMode(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFan);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFanSetDefaultModePrologue( hFan );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFanSetDefaultModePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFanSetDefaultModePrologue) {
+                auto result = checker->zesFanSetDefaultModePrologue( hFan );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanSetDefaultMode(result, hFan);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFanSetDefaultModePrologue) {
+            auto result = checker->zesFanSetDefaultModePrologue( hFan );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanSetDefaultMode(result, hFan);
         }
 
@@ -7276,15 +9679,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFanSetDefaultModePrologue( hFan );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanSetDefaultMode(result, hFan);
         }
 
         auto driver_result = pfnSetDefaultMode( hFan );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFanSetDefaultModeEpilogue( hFan ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFanSetDefaultModeEpilogue) {
+                auto result = checker->zesFanSetDefaultModeEpilogue( hFan ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanSetDefaultMode(result, hFan);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFanSetDefaultModeEpilogue) {
+            auto result = checker->zesFanSetDefaultModeEpilogue( hFan ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanSetDefaultMode(result, hFan);
         }
 
@@ -7299,16 +9709,24 @@ namespace validation_layer
         const zes_fan_speed_t* speed                    ///< [in] The fixed fan speed setting
         )
     {
-        context.logger->log_trace("zesFanSetFixedSpeedMode(hFan, speed)");
+        ZEL_LOG_TRACE(context.logger, "zesFanSetFixedSpeedMode(hFan, speed)");
 
         auto pfnSetFixedSpeedMode = context.zesDdiTable.Fan.pfnSetFixedSpeedMode;
 
         if( nullptr == pfnSetFixedSpeedMode )
             return logAndPropagateResult_zesFanSetFixedSpeedMode(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFan, speed);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFanSetFixedSpeedModePrologue( hFan, speed );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFanSetFixedSpeedModePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFanSetFixedSpeedModePrologue) {
+                auto result = checker->zesFanSetFixedSpeedModePrologue( hFan, speed );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanSetFixedSpeedMode(result, hFan, speed);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFanSetFixedSpeedModePrologue) {
+            auto result = checker->zesFanSetFixedSpeedModePrologue( hFan, speed );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanSetFixedSpeedMode(result, hFan, speed);
         }
 
@@ -7318,15 +9736,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFanSetFixedSpeedModePrologue( hFan, speed );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanSetFixedSpeedMode(result, hFan, speed);
         }
 
         auto driver_result = pfnSetFixedSpeedMode( hFan, speed );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFanSetFixedSpeedModeEpilogue( hFan, speed ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFanSetFixedSpeedModeEpilogue) {
+                auto result = checker->zesFanSetFixedSpeedModeEpilogue( hFan, speed ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanSetFixedSpeedMode(result, hFan, speed);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFanSetFixedSpeedModeEpilogue) {
+            auto result = checker->zesFanSetFixedSpeedModeEpilogue( hFan, speed ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanSetFixedSpeedMode(result, hFan, speed);
         }
 
@@ -7341,16 +9766,24 @@ namespace validation_layer
         const zes_fan_speed_table_t* speedTable         ///< [in] A table containing temperature/speed pairs.
         )
     {
-        context.logger->log_trace("zesFanSetSpeedTableMode(hFan, speedTable)");
+        ZEL_LOG_TRACE(context.logger, "zesFanSetSpeedTableMode(hFan, speedTable)");
 
         auto pfnSetSpeedTableMode = context.zesDdiTable.Fan.pfnSetSpeedTableMode;
 
         if( nullptr == pfnSetSpeedTableMode )
             return logAndPropagateResult_zesFanSetSpeedTableMode(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFan, speedTable);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFanSetSpeedTableModePrologue( hFan, speedTable );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFanSetSpeedTableModePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFanSetSpeedTableModePrologue) {
+                auto result = checker->zesFanSetSpeedTableModePrologue( hFan, speedTable );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanSetSpeedTableMode(result, hFan, speedTable);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFanSetSpeedTableModePrologue) {
+            auto result = checker->zesFanSetSpeedTableModePrologue( hFan, speedTable );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanSetSpeedTableMode(result, hFan, speedTable);
         }
 
@@ -7360,15 +9793,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFanSetSpeedTableModePrologue( hFan, speedTable );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanSetSpeedTableMode(result, hFan, speedTable);
         }
 
         auto driver_result = pfnSetSpeedTableMode( hFan, speedTable );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFanSetSpeedTableModeEpilogue( hFan, speedTable ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFanSetSpeedTableModeEpilogue) {
+                auto result = checker->zesFanSetSpeedTableModeEpilogue( hFan, speedTable ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanSetSpeedTableMode(result, hFan, speedTable);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFanSetSpeedTableModeEpilogue) {
+            auto result = checker->zesFanSetSpeedTableModeEpilogue( hFan, speedTable ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanSetSpeedTableMode(result, hFan, speedTable);
         }
 
@@ -7386,16 +9826,24 @@ namespace validation_layer
                                                         ///< measured.
         )
     {
-        context.logger->log_trace("zesFanGetState(hFan, units, pSpeed)");
+        ZEL_LOG_TRACE(context.logger, "zesFanGetState(hFan, units, pSpeed)");
 
         auto pfnGetState = context.zesDdiTable.Fan.pfnGetState;
 
         if( nullptr == pfnGetState )
             return logAndPropagateResult_zesFanGetState(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFan, units, pSpeed);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFanGetStatePrologue( hFan, units, pSpeed );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFanGetStatePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFanGetStatePrologue) {
+                auto result = checker->zesFanGetStatePrologue( hFan, units, pSpeed );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanGetState(result, hFan, units, pSpeed);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFanGetStatePrologue) {
+            auto result = checker->zesFanGetStatePrologue( hFan, units, pSpeed );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanGetState(result, hFan, units, pSpeed);
         }
 
@@ -7405,15 +9853,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFanGetStatePrologue( hFan, units, pSpeed );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanGetState(result, hFan, units, pSpeed);
         }
 
         auto driver_result = pfnGetState( hFan, units, pSpeed );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFanGetStateEpilogue( hFan, units, pSpeed ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFanGetStateEpilogue) {
+                auto result = checker->zesFanGetStateEpilogue( hFan, units, pSpeed ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanGetState(result, hFan, units, pSpeed);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFanGetStateEpilogue) {
+            auto result = checker->zesFanGetStateEpilogue( hFan, units, pSpeed ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFanGetState(result, hFan, units, pSpeed);
         }
 
@@ -7438,16 +9893,24 @@ namespace validation_layer
                                                         ///< component handles.
         )
     {
-        context.logger->log_trace("zesDeviceEnumFirmwares(hDevice, pCount, phFirmware)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceEnumFirmwares(hDevice, pCount, phFirmware)");
 
         auto pfnEnumFirmwares = context.zesDdiTable.Device.pfnEnumFirmwares;
 
         if( nullptr == pfnEnumFirmwares )
             return logAndPropagateResult_zesDeviceEnumFirmwares(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pCount, phFirmware);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumFirmwaresPrologue( hDevice, pCount, phFirmware );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceEnumFirmwaresPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumFirmwaresPrologue) {
+                auto result = checker->zesDeviceEnumFirmwaresPrologue( hDevice, pCount, phFirmware );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumFirmwares(result, hDevice, pCount, phFirmware);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumFirmwaresPrologue) {
+            auto result = checker->zesDeviceEnumFirmwaresPrologue( hDevice, pCount, phFirmware );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumFirmwares(result, hDevice, pCount, phFirmware);
         }
 
@@ -7457,15 +9920,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumFirmwaresPrologue( hDevice, pCount, phFirmware );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumFirmwares(result, hDevice, pCount, phFirmware);
         }
 
         auto driver_result = pfnEnumFirmwares( hDevice, pCount, phFirmware );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumFirmwaresEpilogue( hDevice, pCount, phFirmware ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumFirmwaresEpilogue) {
+                auto result = checker->zesDeviceEnumFirmwaresEpilogue( hDevice, pCount, phFirmware ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumFirmwares(result, hDevice, pCount, phFirmware);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumFirmwaresEpilogue) {
+            auto result = checker->zesDeviceEnumFirmwaresEpilogue( hDevice, pCount, phFirmware ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumFirmwares(result, hDevice, pCount, phFirmware);
         }
 
@@ -7481,16 +9951,24 @@ namespace validation_layer
                                                         ///< firmware
         )
     {
-        context.logger->log_trace("zesFirmwareGetProperties(hFirmware, pProperties)");
+        ZEL_LOG_TRACE(context.logger, "zesFirmwareGetProperties(hFirmware, pProperties)");
 
         auto pfnGetProperties = context.zesDdiTable.Firmware.pfnGetProperties;
 
         if( nullptr == pfnGetProperties )
             return logAndPropagateResult_zesFirmwareGetProperties(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFirmware, pProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFirmwareGetPropertiesPrologue( hFirmware, pProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFirmwareGetPropertiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFirmwareGetPropertiesPrologue) {
+                auto result = checker->zesFirmwareGetPropertiesPrologue( hFirmware, pProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareGetProperties(result, hFirmware, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFirmwareGetPropertiesPrologue) {
+            auto result = checker->zesFirmwareGetPropertiesPrologue( hFirmware, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareGetProperties(result, hFirmware, pProperties);
         }
 
@@ -7500,15 +9978,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFirmwareGetPropertiesPrologue( hFirmware, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareGetProperties(result, hFirmware, pProperties);
         }
 
         auto driver_result = pfnGetProperties( hFirmware, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFirmwareGetPropertiesEpilogue( hFirmware, pProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFirmwareGetPropertiesEpilogue) {
+                auto result = checker->zesFirmwareGetPropertiesEpilogue( hFirmware, pProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareGetProperties(result, hFirmware, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFirmwareGetPropertiesEpilogue) {
+            auto result = checker->zesFirmwareGetPropertiesEpilogue( hFirmware, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareGetProperties(result, hFirmware, pProperties);
         }
 
@@ -7524,16 +10009,24 @@ namespace validation_layer
         uint32_t size                                   ///< [in] Size of the flash image.
         )
     {
-        context.logger->log_trace("zesFirmwareFlash(hFirmware, pImage, size)");
+        ZEL_LOG_TRACE(context.logger, "zesFirmwareFlash(hFirmware, pImage, size)");
 
         auto pfnFlash = context.zesDdiTable.Firmware.pfnFlash;
 
         if( nullptr == pfnFlash )
             return logAndPropagateResult_zesFirmwareFlash(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFirmware, pImage, size);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFirmwareFlashPrologue( hFirmware, pImage, size );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFirmwareFlashPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFirmwareFlashPrologue) {
+                auto result = checker->zesFirmwareFlashPrologue( hFirmware, pImage, size );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareFlash(result, hFirmware, pImage, size);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFirmwareFlashPrologue) {
+            auto result = checker->zesFirmwareFlashPrologue( hFirmware, pImage, size );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareFlash(result, hFirmware, pImage, size);
         }
 
@@ -7543,15 +10036,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFirmwareFlashPrologue( hFirmware, pImage, size );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareFlash(result, hFirmware, pImage, size);
         }
 
         auto driver_result = pfnFlash( hFirmware, pImage, size );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFirmwareFlashEpilogue( hFirmware, pImage, size ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFirmwareFlashEpilogue) {
+                auto result = checker->zesFirmwareFlashEpilogue( hFirmware, pImage, size ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareFlash(result, hFirmware, pImage, size);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFirmwareFlashEpilogue) {
+            auto result = checker->zesFirmwareFlashEpilogue( hFirmware, pImage, size ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareFlash(result, hFirmware, pImage, size);
         }
 
@@ -7566,16 +10066,24 @@ namespace validation_layer
         uint32_t* pCompletionPercent                    ///< [in,out] Pointer to the Completion Percentage of Firmware Update
         )
     {
-        context.logger->log_trace("zesFirmwareGetFlashProgress(hFirmware, pCompletionPercent)");
+        ZEL_LOG_TRACE(context.logger, "zesFirmwareGetFlashProgress(hFirmware, pCompletionPercent)");
 
         auto pfnGetFlashProgress = context.zesDdiTable.Firmware.pfnGetFlashProgress;
 
         if( nullptr == pfnGetFlashProgress )
             return logAndPropagateResult_zesFirmwareGetFlashProgress(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFirmware, pCompletionPercent);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFirmwareGetFlashProgressPrologue( hFirmware, pCompletionPercent );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFirmwareGetFlashProgressPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFirmwareGetFlashProgressPrologue) {
+                auto result = checker->zesFirmwareGetFlashProgressPrologue( hFirmware, pCompletionPercent );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareGetFlashProgress(result, hFirmware, pCompletionPercent);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFirmwareGetFlashProgressPrologue) {
+            auto result = checker->zesFirmwareGetFlashProgressPrologue( hFirmware, pCompletionPercent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareGetFlashProgress(result, hFirmware, pCompletionPercent);
         }
 
@@ -7585,15 +10093,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFirmwareGetFlashProgressPrologue( hFirmware, pCompletionPercent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareGetFlashProgress(result, hFirmware, pCompletionPercent);
         }
 
         auto driver_result = pfnGetFlashProgress( hFirmware, pCompletionPercent );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFirmwareGetFlashProgressEpilogue( hFirmware, pCompletionPercent ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFirmwareGetFlashProgressEpilogue) {
+                auto result = checker->zesFirmwareGetFlashProgressEpilogue( hFirmware, pCompletionPercent ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareGetFlashProgress(result, hFirmware, pCompletionPercent);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFirmwareGetFlashProgressEpilogue) {
+            auto result = checker->zesFirmwareGetFlashProgressEpilogue( hFirmware, pCompletionPercent ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareGetFlashProgress(result, hFirmware, pCompletionPercent);
         }
 
@@ -7609,16 +10124,24 @@ namespace validation_layer
         char* pFirmwareLog                              ///< [in,out][optional] pointer to null-terminated string of the log.
         )
     {
-        context.logger->log_trace("zesFirmwareGetConsoleLogs(hFirmware, pSize, pFirmwareLog)");
+        ZEL_LOG_TRACE(context.logger, "zesFirmwareGetConsoleLogs(hFirmware, pSize, pFirmwareLog)");
 
         auto pfnGetConsoleLogs = context.zesDdiTable.Firmware.pfnGetConsoleLogs;
 
         if( nullptr == pfnGetConsoleLogs )
             return logAndPropagateResult_zesFirmwareGetConsoleLogs(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFirmware, pSize, pFirmwareLog);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFirmwareGetConsoleLogsPrologue( hFirmware, pSize, pFirmwareLog );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFirmwareGetConsoleLogsPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFirmwareGetConsoleLogsPrologue) {
+                auto result = checker->zesFirmwareGetConsoleLogsPrologue( hFirmware, pSize, pFirmwareLog );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareGetConsoleLogs(result, hFirmware, pSize, pFirmwareLog);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFirmwareGetConsoleLogsPrologue) {
+            auto result = checker->zesFirmwareGetConsoleLogsPrologue( hFirmware, pSize, pFirmwareLog );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareGetConsoleLogs(result, hFirmware, pSize, pFirmwareLog);
         }
 
@@ -7628,15 +10151,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFirmwareGetConsoleLogsPrologue( hFirmware, pSize, pFirmwareLog );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareGetConsoleLogs(result, hFirmware, pSize, pFirmwareLog);
         }
 
         auto driver_result = pfnGetConsoleLogs( hFirmware, pSize, pFirmwareLog );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFirmwareGetConsoleLogsEpilogue( hFirmware, pSize, pFirmwareLog ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFirmwareGetConsoleLogsEpilogue) {
+                auto result = checker->zesFirmwareGetConsoleLogsEpilogue( hFirmware, pSize, pFirmwareLog ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareGetConsoleLogs(result, hFirmware, pSize, pFirmwareLog);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFirmwareGetConsoleLogsEpilogue) {
+            auto result = checker->zesFirmwareGetConsoleLogsEpilogue( hFirmware, pSize, pFirmwareLog ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareGetConsoleLogs(result, hFirmware, pSize, pFirmwareLog);
         }
 
@@ -7661,16 +10191,24 @@ namespace validation_layer
                                                         ///< component handles.
         )
     {
-        context.logger->log_trace("zesDeviceEnumFrequencyDomains(hDevice, pCount, phFrequency)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceEnumFrequencyDomains(hDevice, pCount, phFrequency)");
 
         auto pfnEnumFrequencyDomains = context.zesDdiTable.Device.pfnEnumFrequencyDomains;
 
         if( nullptr == pfnEnumFrequencyDomains )
             return logAndPropagateResult_zesDeviceEnumFrequencyDomains(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pCount, phFrequency);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumFrequencyDomainsPrologue( hDevice, pCount, phFrequency );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceEnumFrequencyDomainsPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumFrequencyDomainsPrologue) {
+                auto result = checker->zesDeviceEnumFrequencyDomainsPrologue( hDevice, pCount, phFrequency );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumFrequencyDomains(result, hDevice, pCount, phFrequency);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumFrequencyDomainsPrologue) {
+            auto result = checker->zesDeviceEnumFrequencyDomainsPrologue( hDevice, pCount, phFrequency );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumFrequencyDomains(result, hDevice, pCount, phFrequency);
         }
 
@@ -7680,15 +10218,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumFrequencyDomainsPrologue( hDevice, pCount, phFrequency );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumFrequencyDomains(result, hDevice, pCount, phFrequency);
         }
 
         auto driver_result = pfnEnumFrequencyDomains( hDevice, pCount, phFrequency );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumFrequencyDomainsEpilogue( hDevice, pCount, phFrequency ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumFrequencyDomainsEpilogue) {
+                auto result = checker->zesDeviceEnumFrequencyDomainsEpilogue( hDevice, pCount, phFrequency ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumFrequencyDomains(result, hDevice, pCount, phFrequency);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumFrequencyDomainsEpilogue) {
+            auto result = checker->zesDeviceEnumFrequencyDomainsEpilogue( hDevice, pCount, phFrequency ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumFrequencyDomains(result, hDevice, pCount, phFrequency);
         }
 
@@ -7703,16 +10248,24 @@ namespace validation_layer
         zes_freq_properties_t* pProperties              ///< [in,out] The frequency properties for the specified domain.
         )
     {
-        context.logger->log_trace("zesFrequencyGetProperties(hFrequency, pProperties)");
+        ZEL_LOG_TRACE(context.logger, "zesFrequencyGetProperties(hFrequency, pProperties)");
 
         auto pfnGetProperties = context.zesDdiTable.Frequency.pfnGetProperties;
 
         if( nullptr == pfnGetProperties )
             return logAndPropagateResult_zesFrequencyGetProperties(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFrequency, pProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetPropertiesPrologue( hFrequency, pProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFrequencyGetPropertiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyGetPropertiesPrologue) {
+                auto result = checker->zesFrequencyGetPropertiesPrologue( hFrequency, pProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyGetProperties(result, hFrequency, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyGetPropertiesPrologue) {
+            auto result = checker->zesFrequencyGetPropertiesPrologue( hFrequency, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyGetProperties(result, hFrequency, pProperties);
         }
 
@@ -7722,15 +10275,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyGetPropertiesPrologue( hFrequency, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyGetProperties(result, hFrequency, pProperties);
         }
 
         auto driver_result = pfnGetProperties( hFrequency, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetPropertiesEpilogue( hFrequency, pProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyGetPropertiesEpilogue) {
+                auto result = checker->zesFrequencyGetPropertiesEpilogue( hFrequency, pProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyGetProperties(result, hFrequency, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyGetPropertiesEpilogue) {
+            auto result = checker->zesFrequencyGetPropertiesEpilogue( hFrequency, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyGetProperties(result, hFrequency, pProperties);
         }
 
@@ -7753,16 +10313,24 @@ namespace validation_layer
                                                         ///< then the driver shall only retrieve that number of frequencies.
         )
     {
-        context.logger->log_trace("zesFrequencyGetAvailableClocks(hFrequency, pCount, phFrequency)");
+        ZEL_LOG_TRACE(context.logger, "zesFrequencyGetAvailableClocks(hFrequency, pCount, phFrequency)");
 
         auto pfnGetAvailableClocks = context.zesDdiTable.Frequency.pfnGetAvailableClocks;
 
         if( nullptr == pfnGetAvailableClocks )
             return logAndPropagateResult_zesFrequencyGetAvailableClocks(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFrequency, pCount, phFrequency);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetAvailableClocksPrologue( hFrequency, pCount, phFrequency );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFrequencyGetAvailableClocksPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyGetAvailableClocksPrologue) {
+                auto result = checker->zesFrequencyGetAvailableClocksPrologue( hFrequency, pCount, phFrequency );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyGetAvailableClocks(result, hFrequency, pCount, phFrequency);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyGetAvailableClocksPrologue) {
+            auto result = checker->zesFrequencyGetAvailableClocksPrologue( hFrequency, pCount, phFrequency );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyGetAvailableClocks(result, hFrequency, pCount, phFrequency);
         }
 
@@ -7772,15 +10340,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyGetAvailableClocksPrologue( hFrequency, pCount, phFrequency );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyGetAvailableClocks(result, hFrequency, pCount, phFrequency);
         }
 
         auto driver_result = pfnGetAvailableClocks( hFrequency, pCount, phFrequency );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetAvailableClocksEpilogue( hFrequency, pCount, phFrequency ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyGetAvailableClocksEpilogue) {
+                auto result = checker->zesFrequencyGetAvailableClocksEpilogue( hFrequency, pCount, phFrequency ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyGetAvailableClocks(result, hFrequency, pCount, phFrequency);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyGetAvailableClocksEpilogue) {
+            auto result = checker->zesFrequencyGetAvailableClocksEpilogue( hFrequency, pCount, phFrequency ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyGetAvailableClocks(result, hFrequency, pCount, phFrequency);
         }
 
@@ -7796,16 +10371,24 @@ namespace validation_layer
                                                         ///< specified domain.
         )
     {
-        context.logger->log_trace("zesFrequencyGetRange(hFrequency, pLimits)");
+        ZEL_LOG_TRACE(context.logger, "zesFrequencyGetRange(hFrequency, pLimits)");
 
         auto pfnGetRange = context.zesDdiTable.Frequency.pfnGetRange;
 
         if( nullptr == pfnGetRange )
             return logAndPropagateResult_zesFrequencyGetRange(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFrequency, pLimits);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetRangePrologue( hFrequency, pLimits );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFrequencyGetRangePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyGetRangePrologue) {
+                auto result = checker->zesFrequencyGetRangePrologue( hFrequency, pLimits );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyGetRange(result, hFrequency, pLimits);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyGetRangePrologue) {
+            auto result = checker->zesFrequencyGetRangePrologue( hFrequency, pLimits );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyGetRange(result, hFrequency, pLimits);
         }
 
@@ -7815,15 +10398,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyGetRangePrologue( hFrequency, pLimits );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyGetRange(result, hFrequency, pLimits);
         }
 
         auto driver_result = pfnGetRange( hFrequency, pLimits );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetRangeEpilogue( hFrequency, pLimits ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyGetRangeEpilogue) {
+                auto result = checker->zesFrequencyGetRangeEpilogue( hFrequency, pLimits ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyGetRange(result, hFrequency, pLimits);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyGetRangeEpilogue) {
+            auto result = checker->zesFrequencyGetRangeEpilogue( hFrequency, pLimits ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyGetRange(result, hFrequency, pLimits);
         }
 
@@ -7839,16 +10429,24 @@ namespace validation_layer
                                                         ///< specified domain.
         )
     {
-        context.logger->log_trace("zesFrequencySetRange(hFrequency, pLimits)");
+        ZEL_LOG_TRACE(context.logger, "zesFrequencySetRange(hFrequency, pLimits)");
 
         auto pfnSetRange = context.zesDdiTable.Frequency.pfnSetRange;
 
         if( nullptr == pfnSetRange )
             return logAndPropagateResult_zesFrequencySetRange(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFrequency, pLimits);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencySetRangePrologue( hFrequency, pLimits );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFrequencySetRangePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencySetRangePrologue) {
+                auto result = checker->zesFrequencySetRangePrologue( hFrequency, pLimits );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencySetRange(result, hFrequency, pLimits);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencySetRangePrologue) {
+            auto result = checker->zesFrequencySetRangePrologue( hFrequency, pLimits );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencySetRange(result, hFrequency, pLimits);
         }
 
@@ -7858,15 +10456,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencySetRangePrologue( hFrequency, pLimits );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencySetRange(result, hFrequency, pLimits);
         }
 
         auto driver_result = pfnSetRange( hFrequency, pLimits );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencySetRangeEpilogue( hFrequency, pLimits ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencySetRangeEpilogue) {
+                auto result = checker->zesFrequencySetRangeEpilogue( hFrequency, pLimits ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencySetRange(result, hFrequency, pLimits);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencySetRangeEpilogue) {
+            auto result = checker->zesFrequencySetRangeEpilogue( hFrequency, pLimits ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencySetRange(result, hFrequency, pLimits);
         }
 
@@ -7881,16 +10486,24 @@ namespace validation_layer
         zes_freq_state_t* pState                        ///< [in,out] Frequency state for the specified domain.
         )
     {
-        context.logger->log_trace("zesFrequencyGetState(hFrequency, pState)");
+        ZEL_LOG_TRACE(context.logger, "zesFrequencyGetState(hFrequency, pState)");
 
         auto pfnGetState = context.zesDdiTable.Frequency.pfnGetState;
 
         if( nullptr == pfnGetState )
             return logAndPropagateResult_zesFrequencyGetState(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFrequency, pState);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetStatePrologue( hFrequency, pState );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFrequencyGetStatePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyGetStatePrologue) {
+                auto result = checker->zesFrequencyGetStatePrologue( hFrequency, pState );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyGetState(result, hFrequency, pState);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyGetStatePrologue) {
+            auto result = checker->zesFrequencyGetStatePrologue( hFrequency, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyGetState(result, hFrequency, pState);
         }
 
@@ -7900,15 +10513,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyGetStatePrologue( hFrequency, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyGetState(result, hFrequency, pState);
         }
 
         auto driver_result = pfnGetState( hFrequency, pState );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetStateEpilogue( hFrequency, pState ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyGetStateEpilogue) {
+                auto result = checker->zesFrequencyGetStateEpilogue( hFrequency, pState ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyGetState(result, hFrequency, pState);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyGetStateEpilogue) {
+            auto result = checker->zesFrequencyGetStateEpilogue( hFrequency, pState ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyGetState(result, hFrequency, pState);
         }
 
@@ -7924,16 +10544,24 @@ namespace validation_layer
                                                         ///< specified domain.
         )
     {
-        context.logger->log_trace("zesFrequencyGetThrottleTime(hFrequency, pThrottleTime)");
+        ZEL_LOG_TRACE(context.logger, "zesFrequencyGetThrottleTime(hFrequency, pThrottleTime)");
 
         auto pfnGetThrottleTime = context.zesDdiTable.Frequency.pfnGetThrottleTime;
 
         if( nullptr == pfnGetThrottleTime )
             return logAndPropagateResult_zesFrequencyGetThrottleTime(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFrequency, pThrottleTime);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetThrottleTimePrologue( hFrequency, pThrottleTime );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFrequencyGetThrottleTimePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyGetThrottleTimePrologue) {
+                auto result = checker->zesFrequencyGetThrottleTimePrologue( hFrequency, pThrottleTime );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyGetThrottleTime(result, hFrequency, pThrottleTime);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyGetThrottleTimePrologue) {
+            auto result = checker->zesFrequencyGetThrottleTimePrologue( hFrequency, pThrottleTime );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyGetThrottleTime(result, hFrequency, pThrottleTime);
         }
 
@@ -7943,15 +10571,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyGetThrottleTimePrologue( hFrequency, pThrottleTime );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyGetThrottleTime(result, hFrequency, pThrottleTime);
         }
 
         auto driver_result = pfnGetThrottleTime( hFrequency, pThrottleTime );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetThrottleTimeEpilogue( hFrequency, pThrottleTime ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyGetThrottleTimeEpilogue) {
+                auto result = checker->zesFrequencyGetThrottleTimeEpilogue( hFrequency, pThrottleTime ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyGetThrottleTime(result, hFrequency, pThrottleTime);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyGetThrottleTimeEpilogue) {
+            auto result = checker->zesFrequencyGetThrottleTimeEpilogue( hFrequency, pThrottleTime ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyGetThrottleTime(result, hFrequency, pThrottleTime);
         }
 
@@ -7966,16 +10601,24 @@ namespace validation_layer
         zes_oc_capabilities_t* pOcCapabilities          ///< [in,out] Pointer to the capabilities structure.
         )
     {
-        context.logger->log_trace("zesFrequencyOcGetCapabilities(hFrequency, pOcCapabilities)");
+        ZEL_LOG_TRACE(context.logger, "zesFrequencyOcGetCapabilities(hFrequency, pOcCapabilities)");
 
         auto pfnOcGetCapabilities = context.zesDdiTable.Frequency.pfnOcGetCapabilities;
 
         if( nullptr == pfnOcGetCapabilities )
             return logAndPropagateResult_zesFrequencyOcGetCapabilities(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFrequency, pOcCapabilities);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetCapabilitiesPrologue( hFrequency, pOcCapabilities );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFrequencyOcGetCapabilitiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyOcGetCapabilitiesPrologue) {
+                auto result = checker->zesFrequencyOcGetCapabilitiesPrologue( hFrequency, pOcCapabilities );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetCapabilities(result, hFrequency, pOcCapabilities);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyOcGetCapabilitiesPrologue) {
+            auto result = checker->zesFrequencyOcGetCapabilitiesPrologue( hFrequency, pOcCapabilities );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetCapabilities(result, hFrequency, pOcCapabilities);
         }
 
@@ -7985,15 +10628,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetCapabilitiesPrologue( hFrequency, pOcCapabilities );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetCapabilities(result, hFrequency, pOcCapabilities);
         }
 
         auto driver_result = pfnOcGetCapabilities( hFrequency, pOcCapabilities );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetCapabilitiesEpilogue( hFrequency, pOcCapabilities ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyOcGetCapabilitiesEpilogue) {
+                auto result = checker->zesFrequencyOcGetCapabilitiesEpilogue( hFrequency, pOcCapabilities ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetCapabilities(result, hFrequency, pOcCapabilities);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyOcGetCapabilitiesEpilogue) {
+            auto result = checker->zesFrequencyOcGetCapabilitiesEpilogue( hFrequency, pOcCapabilities ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetCapabilities(result, hFrequency, pOcCapabilities);
         }
 
@@ -8011,16 +10661,24 @@ namespace validation_layer
                                                         ///< ::zes_oc_capabilities_t.
         )
     {
-        context.logger->log_trace("zesFrequencyOcGetFrequencyTarget(hFrequency, pCurrentOcFrequency)");
+        ZEL_LOG_TRACE(context.logger, "zesFrequencyOcGetFrequencyTarget(hFrequency, pCurrentOcFrequency)");
 
         auto pfnOcGetFrequencyTarget = context.zesDdiTable.Frequency.pfnOcGetFrequencyTarget;
 
         if( nullptr == pfnOcGetFrequencyTarget )
             return logAndPropagateResult_zesFrequencyOcGetFrequencyTarget(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFrequency, pCurrentOcFrequency);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetFrequencyTargetPrologue( hFrequency, pCurrentOcFrequency );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFrequencyOcGetFrequencyTargetPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyOcGetFrequencyTargetPrologue) {
+                auto result = checker->zesFrequencyOcGetFrequencyTargetPrologue( hFrequency, pCurrentOcFrequency );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetFrequencyTarget(result, hFrequency, pCurrentOcFrequency);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyOcGetFrequencyTargetPrologue) {
+            auto result = checker->zesFrequencyOcGetFrequencyTargetPrologue( hFrequency, pCurrentOcFrequency );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetFrequencyTarget(result, hFrequency, pCurrentOcFrequency);
         }
 
@@ -8030,15 +10688,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetFrequencyTargetPrologue( hFrequency, pCurrentOcFrequency );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetFrequencyTarget(result, hFrequency, pCurrentOcFrequency);
         }
 
         auto driver_result = pfnOcGetFrequencyTarget( hFrequency, pCurrentOcFrequency );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetFrequencyTargetEpilogue( hFrequency, pCurrentOcFrequency ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyOcGetFrequencyTargetEpilogue) {
+                auto result = checker->zesFrequencyOcGetFrequencyTargetEpilogue( hFrequency, pCurrentOcFrequency ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetFrequencyTarget(result, hFrequency, pCurrentOcFrequency);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyOcGetFrequencyTargetEpilogue) {
+            auto result = checker->zesFrequencyOcGetFrequencyTargetEpilogue( hFrequency, pCurrentOcFrequency ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetFrequencyTarget(result, hFrequency, pCurrentOcFrequency);
         }
 
@@ -8056,16 +10721,24 @@ namespace validation_layer
                                                         ///< ::zes_oc_capabilities_t.
         )
     {
-        context.logger->log_trace("zesFrequencyOcSetFrequencyTarget(hFrequency, CurrentOcFrequency)");
+        ZEL_LOG_TRACE(context.logger, "zesFrequencyOcSetFrequencyTarget(hFrequency, CurrentOcFrequency)");
 
         auto pfnOcSetFrequencyTarget = context.zesDdiTable.Frequency.pfnOcSetFrequencyTarget;
 
         if( nullptr == pfnOcSetFrequencyTarget )
             return logAndPropagateResult_zesFrequencyOcSetFrequencyTarget(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFrequency, CurrentOcFrequency);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetFrequencyTargetPrologue( hFrequency, CurrentOcFrequency );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFrequencyOcSetFrequencyTargetPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyOcSetFrequencyTargetPrologue) {
+                auto result = checker->zesFrequencyOcSetFrequencyTargetPrologue( hFrequency, CurrentOcFrequency );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcSetFrequencyTarget(result, hFrequency, CurrentOcFrequency);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyOcSetFrequencyTargetPrologue) {
+            auto result = checker->zesFrequencyOcSetFrequencyTargetPrologue( hFrequency, CurrentOcFrequency );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcSetFrequencyTarget(result, hFrequency, CurrentOcFrequency);
         }
 
@@ -8075,15 +10748,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcSetFrequencyTargetPrologue( hFrequency, CurrentOcFrequency );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcSetFrequencyTarget(result, hFrequency, CurrentOcFrequency);
         }
 
         auto driver_result = pfnOcSetFrequencyTarget( hFrequency, CurrentOcFrequency );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetFrequencyTargetEpilogue( hFrequency, CurrentOcFrequency ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyOcSetFrequencyTargetEpilogue) {
+                auto result = checker->zesFrequencyOcSetFrequencyTargetEpilogue( hFrequency, CurrentOcFrequency ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcSetFrequencyTarget(result, hFrequency, CurrentOcFrequency);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyOcSetFrequencyTargetEpilogue) {
+            auto result = checker->zesFrequencyOcSetFrequencyTargetEpilogue( hFrequency, CurrentOcFrequency ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcSetFrequencyTarget(result, hFrequency, CurrentOcFrequency);
         }
 
@@ -8103,16 +10783,24 @@ namespace validation_layer
                                                         ///< `maxOcVoltageOffset` members of ::zes_oc_capabilities_t.
         )
     {
-        context.logger->log_trace("zesFrequencyOcGetVoltageTarget(hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset)");
+        ZEL_LOG_TRACE(context.logger, "zesFrequencyOcGetVoltageTarget(hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset)");
 
         auto pfnOcGetVoltageTarget = context.zesDdiTable.Frequency.pfnOcGetVoltageTarget;
 
         if( nullptr == pfnOcGetVoltageTarget )
             return logAndPropagateResult_zesFrequencyOcGetVoltageTarget(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetVoltageTargetPrologue( hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFrequencyOcGetVoltageTargetPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyOcGetVoltageTargetPrologue) {
+                auto result = checker->zesFrequencyOcGetVoltageTargetPrologue( hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetVoltageTarget(result, hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyOcGetVoltageTargetPrologue) {
+            auto result = checker->zesFrequencyOcGetVoltageTargetPrologue( hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetVoltageTarget(result, hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset);
         }
 
@@ -8122,15 +10810,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetVoltageTargetPrologue( hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetVoltageTarget(result, hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset);
         }
 
         auto driver_result = pfnOcGetVoltageTarget( hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetVoltageTargetEpilogue( hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyOcGetVoltageTargetEpilogue) {
+                auto result = checker->zesFrequencyOcGetVoltageTargetEpilogue( hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetVoltageTarget(result, hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyOcGetVoltageTargetEpilogue) {
+            auto result = checker->zesFrequencyOcGetVoltageTargetEpilogue( hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetVoltageTarget(result, hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset);
         }
 
@@ -8150,16 +10845,24 @@ namespace validation_layer
                                                         ///< `maxOcVoltageOffset` members of ::zes_oc_capabilities_t.
         )
     {
-        context.logger->log_trace("zesFrequencyOcSetVoltageTarget(hFrequency, CurrentVoltageTarget, CurrentVoltageOffset)");
+        ZEL_LOG_TRACE(context.logger, "zesFrequencyOcSetVoltageTarget(hFrequency, CurrentVoltageTarget, CurrentVoltageOffset)");
 
         auto pfnOcSetVoltageTarget = context.zesDdiTable.Frequency.pfnOcSetVoltageTarget;
 
         if( nullptr == pfnOcSetVoltageTarget )
             return logAndPropagateResult_zesFrequencyOcSetVoltageTarget(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFrequency, CurrentVoltageTarget, CurrentVoltageOffset);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetVoltageTargetPrologue( hFrequency, CurrentVoltageTarget, CurrentVoltageOffset );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFrequencyOcSetVoltageTargetPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyOcSetVoltageTargetPrologue) {
+                auto result = checker->zesFrequencyOcSetVoltageTargetPrologue( hFrequency, CurrentVoltageTarget, CurrentVoltageOffset );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcSetVoltageTarget(result, hFrequency, CurrentVoltageTarget, CurrentVoltageOffset);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyOcSetVoltageTargetPrologue) {
+            auto result = checker->zesFrequencyOcSetVoltageTargetPrologue( hFrequency, CurrentVoltageTarget, CurrentVoltageOffset );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcSetVoltageTarget(result, hFrequency, CurrentVoltageTarget, CurrentVoltageOffset);
         }
 
@@ -8169,15 +10872,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcSetVoltageTargetPrologue( hFrequency, CurrentVoltageTarget, CurrentVoltageOffset );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcSetVoltageTarget(result, hFrequency, CurrentVoltageTarget, CurrentVoltageOffset);
         }
 
         auto driver_result = pfnOcSetVoltageTarget( hFrequency, CurrentVoltageTarget, CurrentVoltageOffset );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetVoltageTargetEpilogue( hFrequency, CurrentVoltageTarget, CurrentVoltageOffset ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyOcSetVoltageTargetEpilogue) {
+                auto result = checker->zesFrequencyOcSetVoltageTargetEpilogue( hFrequency, CurrentVoltageTarget, CurrentVoltageOffset ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcSetVoltageTarget(result, hFrequency, CurrentVoltageTarget, CurrentVoltageOffset);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyOcSetVoltageTargetEpilogue) {
+            auto result = checker->zesFrequencyOcSetVoltageTargetEpilogue( hFrequency, CurrentVoltageTarget, CurrentVoltageOffset ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcSetVoltageTarget(result, hFrequency, CurrentVoltageTarget, CurrentVoltageOffset);
         }
 
@@ -8192,16 +10902,24 @@ namespace validation_layer
         zes_oc_mode_t CurrentOcMode                     ///< [in] Current Overclocking Mode ::zes_oc_mode_t.
         )
     {
-        context.logger->log_trace("zesFrequencyOcSetMode(hFrequency, CurrentOcMode)");
+        ZEL_LOG_TRACE(context.logger, "zesFrequencyOcSetMode(hFrequency, CurrentOcMode)");
 
         auto pfnOcSetMode = context.zesDdiTable.Frequency.pfnOcSetMode;
 
         if( nullptr == pfnOcSetMode )
             return logAndPropagateResult_zesFrequencyOcSetMode(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFrequency, CurrentOcMode);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetModePrologue( hFrequency, CurrentOcMode );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFrequencyOcSetModePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyOcSetModePrologue) {
+                auto result = checker->zesFrequencyOcSetModePrologue( hFrequency, CurrentOcMode );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcSetMode(result, hFrequency, CurrentOcMode);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyOcSetModePrologue) {
+            auto result = checker->zesFrequencyOcSetModePrologue( hFrequency, CurrentOcMode );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcSetMode(result, hFrequency, CurrentOcMode);
         }
 
@@ -8211,15 +10929,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcSetModePrologue( hFrequency, CurrentOcMode );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcSetMode(result, hFrequency, CurrentOcMode);
         }
 
         auto driver_result = pfnOcSetMode( hFrequency, CurrentOcMode );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetModeEpilogue( hFrequency, CurrentOcMode ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyOcSetModeEpilogue) {
+                auto result = checker->zesFrequencyOcSetModeEpilogue( hFrequency, CurrentOcMode ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcSetMode(result, hFrequency, CurrentOcMode);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyOcSetModeEpilogue) {
+            auto result = checker->zesFrequencyOcSetModeEpilogue( hFrequency, CurrentOcMode ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcSetMode(result, hFrequency, CurrentOcMode);
         }
 
@@ -8234,16 +10959,24 @@ namespace validation_layer
         zes_oc_mode_t* pCurrentOcMode                   ///< [out] Current Overclocking Mode ::zes_oc_mode_t.
         )
     {
-        context.logger->log_trace("zesFrequencyOcGetMode(hFrequency, pCurrentOcMode)");
+        ZEL_LOG_TRACE(context.logger, "zesFrequencyOcGetMode(hFrequency, pCurrentOcMode)");
 
         auto pfnOcGetMode = context.zesDdiTable.Frequency.pfnOcGetMode;
 
         if( nullptr == pfnOcGetMode )
             return logAndPropagateResult_zesFrequencyOcGetMode(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFrequency, pCurrentOcMode);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetModePrologue( hFrequency, pCurrentOcMode );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFrequencyOcGetModePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyOcGetModePrologue) {
+                auto result = checker->zesFrequencyOcGetModePrologue( hFrequency, pCurrentOcMode );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetMode(result, hFrequency, pCurrentOcMode);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyOcGetModePrologue) {
+            auto result = checker->zesFrequencyOcGetModePrologue( hFrequency, pCurrentOcMode );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetMode(result, hFrequency, pCurrentOcMode);
         }
 
@@ -8253,15 +10986,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetModePrologue( hFrequency, pCurrentOcMode );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetMode(result, hFrequency, pCurrentOcMode);
         }
 
         auto driver_result = pfnOcGetMode( hFrequency, pCurrentOcMode );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetModeEpilogue( hFrequency, pCurrentOcMode ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyOcGetModeEpilogue) {
+                auto result = checker->zesFrequencyOcGetModeEpilogue( hFrequency, pCurrentOcMode ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetMode(result, hFrequency, pCurrentOcMode);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyOcGetModeEpilogue) {
+            auto result = checker->zesFrequencyOcGetModeEpilogue( hFrequency, pCurrentOcMode ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetMode(result, hFrequency, pCurrentOcMode);
         }
 
@@ -8277,16 +11017,24 @@ namespace validation_layer
                                                         ///< successful return.
         )
     {
-        context.logger->log_trace("zesFrequencyOcGetIccMax(hFrequency, pOcIccMax)");
+        ZEL_LOG_TRACE(context.logger, "zesFrequencyOcGetIccMax(hFrequency, pOcIccMax)");
 
         auto pfnOcGetIccMax = context.zesDdiTable.Frequency.pfnOcGetIccMax;
 
         if( nullptr == pfnOcGetIccMax )
             return logAndPropagateResult_zesFrequencyOcGetIccMax(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFrequency, pOcIccMax);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetIccMaxPrologue( hFrequency, pOcIccMax );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFrequencyOcGetIccMaxPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyOcGetIccMaxPrologue) {
+                auto result = checker->zesFrequencyOcGetIccMaxPrologue( hFrequency, pOcIccMax );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetIccMax(result, hFrequency, pOcIccMax);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyOcGetIccMaxPrologue) {
+            auto result = checker->zesFrequencyOcGetIccMaxPrologue( hFrequency, pOcIccMax );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetIccMax(result, hFrequency, pOcIccMax);
         }
 
@@ -8296,15 +11044,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetIccMaxPrologue( hFrequency, pOcIccMax );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetIccMax(result, hFrequency, pOcIccMax);
         }
 
         auto driver_result = pfnOcGetIccMax( hFrequency, pOcIccMax );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetIccMaxEpilogue( hFrequency, pOcIccMax ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyOcGetIccMaxEpilogue) {
+                auto result = checker->zesFrequencyOcGetIccMaxEpilogue( hFrequency, pOcIccMax ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetIccMax(result, hFrequency, pOcIccMax);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyOcGetIccMaxEpilogue) {
+            auto result = checker->zesFrequencyOcGetIccMaxEpilogue( hFrequency, pOcIccMax ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetIccMax(result, hFrequency, pOcIccMax);
         }
 
@@ -8319,16 +11074,24 @@ namespace validation_layer
         double ocIccMax                                 ///< [in] The new maximum current limit in Amperes.
         )
     {
-        context.logger->log_trace("zesFrequencyOcSetIccMax(hFrequency, ocIccMax)");
+        ZEL_LOG_TRACE(context.logger, "zesFrequencyOcSetIccMax(hFrequency, ocIccMax)");
 
         auto pfnOcSetIccMax = context.zesDdiTable.Frequency.pfnOcSetIccMax;
 
         if( nullptr == pfnOcSetIccMax )
             return logAndPropagateResult_zesFrequencyOcSetIccMax(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFrequency, ocIccMax);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetIccMaxPrologue( hFrequency, ocIccMax );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFrequencyOcSetIccMaxPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyOcSetIccMaxPrologue) {
+                auto result = checker->zesFrequencyOcSetIccMaxPrologue( hFrequency, ocIccMax );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcSetIccMax(result, hFrequency, ocIccMax);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyOcSetIccMaxPrologue) {
+            auto result = checker->zesFrequencyOcSetIccMaxPrologue( hFrequency, ocIccMax );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcSetIccMax(result, hFrequency, ocIccMax);
         }
 
@@ -8338,15 +11101,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcSetIccMaxPrologue( hFrequency, ocIccMax );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcSetIccMax(result, hFrequency, ocIccMax);
         }
 
         auto driver_result = pfnOcSetIccMax( hFrequency, ocIccMax );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetIccMaxEpilogue( hFrequency, ocIccMax ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyOcSetIccMaxEpilogue) {
+                auto result = checker->zesFrequencyOcSetIccMaxEpilogue( hFrequency, ocIccMax ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcSetIccMax(result, hFrequency, ocIccMax);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyOcSetIccMaxEpilogue) {
+            auto result = checker->zesFrequencyOcSetIccMaxEpilogue( hFrequency, ocIccMax ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcSetIccMax(result, hFrequency, ocIccMax);
         }
 
@@ -8362,16 +11132,24 @@ namespace validation_layer
                                                         ///< on successful return.
         )
     {
-        context.logger->log_trace("zesFrequencyOcGetTjMax(hFrequency, pOcTjMax)");
+        ZEL_LOG_TRACE(context.logger, "zesFrequencyOcGetTjMax(hFrequency, pOcTjMax)");
 
         auto pfnOcGetTjMax = context.zesDdiTable.Frequency.pfnOcGetTjMax;
 
         if( nullptr == pfnOcGetTjMax )
             return logAndPropagateResult_zesFrequencyOcGetTjMax(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFrequency, pOcTjMax);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetTjMaxPrologue( hFrequency, pOcTjMax );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFrequencyOcGetTjMaxPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyOcGetTjMaxPrologue) {
+                auto result = checker->zesFrequencyOcGetTjMaxPrologue( hFrequency, pOcTjMax );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetTjMax(result, hFrequency, pOcTjMax);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyOcGetTjMaxPrologue) {
+            auto result = checker->zesFrequencyOcGetTjMaxPrologue( hFrequency, pOcTjMax );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetTjMax(result, hFrequency, pOcTjMax);
         }
 
@@ -8381,15 +11159,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetTjMaxPrologue( hFrequency, pOcTjMax );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetTjMax(result, hFrequency, pOcTjMax);
         }
 
         auto driver_result = pfnOcGetTjMax( hFrequency, pOcTjMax );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetTjMaxEpilogue( hFrequency, pOcTjMax ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyOcGetTjMaxEpilogue) {
+                auto result = checker->zesFrequencyOcGetTjMaxEpilogue( hFrequency, pOcTjMax ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetTjMax(result, hFrequency, pOcTjMax);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyOcGetTjMaxEpilogue) {
+            auto result = checker->zesFrequencyOcGetTjMaxEpilogue( hFrequency, pOcTjMax ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcGetTjMax(result, hFrequency, pOcTjMax);
         }
 
@@ -8404,16 +11189,24 @@ namespace validation_layer
         double ocTjMax                                  ///< [in] The new maximum temperature limit in degrees Celsius.
         )
     {
-        context.logger->log_trace("zesFrequencyOcSetTjMax(hFrequency, ocTjMax)");
+        ZEL_LOG_TRACE(context.logger, "zesFrequencyOcSetTjMax(hFrequency, ocTjMax)");
 
         auto pfnOcSetTjMax = context.zesDdiTable.Frequency.pfnOcSetTjMax;
 
         if( nullptr == pfnOcSetTjMax )
             return logAndPropagateResult_zesFrequencyOcSetTjMax(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFrequency, ocTjMax);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetTjMaxPrologue( hFrequency, ocTjMax );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFrequencyOcSetTjMaxPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyOcSetTjMaxPrologue) {
+                auto result = checker->zesFrequencyOcSetTjMaxPrologue( hFrequency, ocTjMax );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcSetTjMax(result, hFrequency, ocTjMax);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyOcSetTjMaxPrologue) {
+            auto result = checker->zesFrequencyOcSetTjMaxPrologue( hFrequency, ocTjMax );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcSetTjMax(result, hFrequency, ocTjMax);
         }
 
@@ -8423,15 +11216,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcSetTjMaxPrologue( hFrequency, ocTjMax );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcSetTjMax(result, hFrequency, ocTjMax);
         }
 
         auto driver_result = pfnOcSetTjMax( hFrequency, ocTjMax );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetTjMaxEpilogue( hFrequency, ocTjMax ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFrequencyOcSetTjMaxEpilogue) {
+                auto result = checker->zesFrequencyOcSetTjMaxEpilogue( hFrequency, ocTjMax ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcSetTjMax(result, hFrequency, ocTjMax);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFrequencyOcSetTjMaxEpilogue) {
+            auto result = checker->zesFrequencyOcSetTjMaxEpilogue( hFrequency, ocTjMax ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFrequencyOcSetTjMax(result, hFrequency, ocTjMax);
         }
 
@@ -8456,16 +11256,24 @@ namespace validation_layer
                                                         ///< component handles.
         )
     {
-        context.logger->log_trace("zesDeviceEnumLeds(hDevice, pCount, phLed)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceEnumLeds(hDevice, pCount, phLed)");
 
         auto pfnEnumLeds = context.zesDdiTable.Device.pfnEnumLeds;
 
         if( nullptr == pfnEnumLeds )
             return logAndPropagateResult_zesDeviceEnumLeds(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pCount, phLed);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumLedsPrologue( hDevice, pCount, phLed );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceEnumLedsPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumLedsPrologue) {
+                auto result = checker->zesDeviceEnumLedsPrologue( hDevice, pCount, phLed );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumLeds(result, hDevice, pCount, phLed);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumLedsPrologue) {
+            auto result = checker->zesDeviceEnumLedsPrologue( hDevice, pCount, phLed );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumLeds(result, hDevice, pCount, phLed);
         }
 
@@ -8475,15 +11283,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumLedsPrologue( hDevice, pCount, phLed );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumLeds(result, hDevice, pCount, phLed);
         }
 
         auto driver_result = pfnEnumLeds( hDevice, pCount, phLed );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumLedsEpilogue( hDevice, pCount, phLed ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumLedsEpilogue) {
+                auto result = checker->zesDeviceEnumLedsEpilogue( hDevice, pCount, phLed ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumLeds(result, hDevice, pCount, phLed);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumLedsEpilogue) {
+            auto result = checker->zesDeviceEnumLedsEpilogue( hDevice, pCount, phLed ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumLeds(result, hDevice, pCount, phLed);
         }
 
@@ -8498,16 +11313,24 @@ namespace validation_layer
         zes_led_properties_t* pProperties               ///< [in,out] Will contain the properties of the LED.
         )
     {
-        context.logger->log_trace("zesLedGetProperties(hLed, pProperties)");
+        ZEL_LOG_TRACE(context.logger, "zesLedGetProperties(hLed, pProperties)");
 
         auto pfnGetProperties = context.zesDdiTable.Led.pfnGetProperties;
 
         if( nullptr == pfnGetProperties )
             return logAndPropagateResult_zesLedGetProperties(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hLed, pProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesLedGetPropertiesPrologue( hLed, pProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesLedGetPropertiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesLedGetPropertiesPrologue) {
+                auto result = checker->zesLedGetPropertiesPrologue( hLed, pProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesLedGetProperties(result, hLed, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesLedGetPropertiesPrologue) {
+            auto result = checker->zesLedGetPropertiesPrologue( hLed, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesLedGetProperties(result, hLed, pProperties);
         }
 
@@ -8517,15 +11340,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesLedGetPropertiesPrologue( hLed, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesLedGetProperties(result, hLed, pProperties);
         }
 
         auto driver_result = pfnGetProperties( hLed, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesLedGetPropertiesEpilogue( hLed, pProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesLedGetPropertiesEpilogue) {
+                auto result = checker->zesLedGetPropertiesEpilogue( hLed, pProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesLedGetProperties(result, hLed, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesLedGetPropertiesEpilogue) {
+            auto result = checker->zesLedGetPropertiesEpilogue( hLed, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesLedGetProperties(result, hLed, pProperties);
         }
 
@@ -8540,16 +11370,24 @@ namespace validation_layer
         zes_led_state_t* pState                         ///< [in,out] Will contain the current state of the LED.
         )
     {
-        context.logger->log_trace("zesLedGetState(hLed, pState)");
+        ZEL_LOG_TRACE(context.logger, "zesLedGetState(hLed, pState)");
 
         auto pfnGetState = context.zesDdiTable.Led.pfnGetState;
 
         if( nullptr == pfnGetState )
             return logAndPropagateResult_zesLedGetState(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hLed, pState);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesLedGetStatePrologue( hLed, pState );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesLedGetStatePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesLedGetStatePrologue) {
+                auto result = checker->zesLedGetStatePrologue( hLed, pState );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesLedGetState(result, hLed, pState);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesLedGetStatePrologue) {
+            auto result = checker->zesLedGetStatePrologue( hLed, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesLedGetState(result, hLed, pState);
         }
 
@@ -8559,15 +11397,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesLedGetStatePrologue( hLed, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesLedGetState(result, hLed, pState);
         }
 
         auto driver_result = pfnGetState( hLed, pState );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesLedGetStateEpilogue( hLed, pState ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesLedGetStateEpilogue) {
+                auto result = checker->zesLedGetStateEpilogue( hLed, pState ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesLedGetState(result, hLed, pState);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesLedGetStateEpilogue) {
+            auto result = checker->zesLedGetStateEpilogue( hLed, pState ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesLedGetState(result, hLed, pState);
         }
 
@@ -8582,16 +11427,24 @@ namespace validation_layer
         ze_bool_t enable                                ///< [in] Set to TRUE to turn the LED on, FALSE to turn off.
         )
     {
-        context.logger->log_trace("zesLedSetState(hLed, enable)");
+        ZEL_LOG_TRACE(context.logger, "zesLedSetState(hLed, enable)");
 
         auto pfnSetState = context.zesDdiTable.Led.pfnSetState;
 
         if( nullptr == pfnSetState )
             return logAndPropagateResult_zesLedSetState(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hLed, enable);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesLedSetStatePrologue( hLed, enable );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesLedSetStatePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesLedSetStatePrologue) {
+                auto result = checker->zesLedSetStatePrologue( hLed, enable );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesLedSetState(result, hLed, enable);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesLedSetStatePrologue) {
+            auto result = checker->zesLedSetStatePrologue( hLed, enable );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesLedSetState(result, hLed, enable);
         }
 
@@ -8601,15 +11454,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesLedSetStatePrologue( hLed, enable );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesLedSetState(result, hLed, enable);
         }
 
         auto driver_result = pfnSetState( hLed, enable );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesLedSetStateEpilogue( hLed, enable ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesLedSetStateEpilogue) {
+                auto result = checker->zesLedSetStateEpilogue( hLed, enable ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesLedSetState(result, hLed, enable);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesLedSetStateEpilogue) {
+            auto result = checker->zesLedSetStateEpilogue( hLed, enable ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesLedSetState(result, hLed, enable);
         }
 
@@ -8624,16 +11484,24 @@ namespace validation_layer
         const zes_led_color_t* pColor                   ///< [in] New color of the LED.
         )
     {
-        context.logger->log_trace("zesLedSetColor(hLed, pColor)");
+        ZEL_LOG_TRACE(context.logger, "zesLedSetColor(hLed, pColor)");
 
         auto pfnSetColor = context.zesDdiTable.Led.pfnSetColor;
 
         if( nullptr == pfnSetColor )
             return logAndPropagateResult_zesLedSetColor(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hLed, pColor);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesLedSetColorPrologue( hLed, pColor );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesLedSetColorPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesLedSetColorPrologue) {
+                auto result = checker->zesLedSetColorPrologue( hLed, pColor );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesLedSetColor(result, hLed, pColor);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesLedSetColorPrologue) {
+            auto result = checker->zesLedSetColorPrologue( hLed, pColor );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesLedSetColor(result, hLed, pColor);
         }
 
@@ -8643,15 +11511,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesLedSetColorPrologue( hLed, pColor );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesLedSetColor(result, hLed, pColor);
         }
 
         auto driver_result = pfnSetColor( hLed, pColor );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesLedSetColorEpilogue( hLed, pColor ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesLedSetColorEpilogue) {
+                auto result = checker->zesLedSetColorEpilogue( hLed, pColor ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesLedSetColor(result, hLed, pColor);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesLedSetColorEpilogue) {
+            auto result = checker->zesLedSetColorEpilogue( hLed, pColor ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesLedSetColor(result, hLed, pColor);
         }
 
@@ -8676,16 +11551,24 @@ namespace validation_layer
                                                         ///< component handles.
         )
     {
-        context.logger->log_trace("zesDeviceEnumMemoryModules(hDevice, pCount, phMemory)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceEnumMemoryModules(hDevice, pCount, phMemory)");
 
         auto pfnEnumMemoryModules = context.zesDdiTable.Device.pfnEnumMemoryModules;
 
         if( nullptr == pfnEnumMemoryModules )
             return logAndPropagateResult_zesDeviceEnumMemoryModules(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pCount, phMemory);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumMemoryModulesPrologue( hDevice, pCount, phMemory );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceEnumMemoryModulesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumMemoryModulesPrologue) {
+                auto result = checker->zesDeviceEnumMemoryModulesPrologue( hDevice, pCount, phMemory );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumMemoryModules(result, hDevice, pCount, phMemory);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumMemoryModulesPrologue) {
+            auto result = checker->zesDeviceEnumMemoryModulesPrologue( hDevice, pCount, phMemory );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumMemoryModules(result, hDevice, pCount, phMemory);
         }
 
@@ -8695,15 +11578,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumMemoryModulesPrologue( hDevice, pCount, phMemory );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumMemoryModules(result, hDevice, pCount, phMemory);
         }
 
         auto driver_result = pfnEnumMemoryModules( hDevice, pCount, phMemory );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumMemoryModulesEpilogue( hDevice, pCount, phMemory ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumMemoryModulesEpilogue) {
+                auto result = checker->zesDeviceEnumMemoryModulesEpilogue( hDevice, pCount, phMemory ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumMemoryModules(result, hDevice, pCount, phMemory);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumMemoryModulesEpilogue) {
+            auto result = checker->zesDeviceEnumMemoryModulesEpilogue( hDevice, pCount, phMemory ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumMemoryModules(result, hDevice, pCount, phMemory);
         }
 
@@ -8718,16 +11608,24 @@ namespace validation_layer
         zes_mem_properties_t* pProperties               ///< [in,out] Will contain memory properties.
         )
     {
-        context.logger->log_trace("zesMemoryGetProperties(hMemory, pProperties)");
+        ZEL_LOG_TRACE(context.logger, "zesMemoryGetProperties(hMemory, pProperties)");
 
         auto pfnGetProperties = context.zesDdiTable.Memory.pfnGetProperties;
 
         if( nullptr == pfnGetProperties )
             return logAndPropagateResult_zesMemoryGetProperties(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMemory, pProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesMemoryGetPropertiesPrologue( hMemory, pProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesMemoryGetPropertiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesMemoryGetPropertiesPrologue) {
+                auto result = checker->zesMemoryGetPropertiesPrologue( hMemory, pProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesMemoryGetProperties(result, hMemory, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesMemoryGetPropertiesPrologue) {
+            auto result = checker->zesMemoryGetPropertiesPrologue( hMemory, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesMemoryGetProperties(result, hMemory, pProperties);
         }
 
@@ -8737,15 +11635,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesMemoryGetPropertiesPrologue( hMemory, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesMemoryGetProperties(result, hMemory, pProperties);
         }
 
         auto driver_result = pfnGetProperties( hMemory, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesMemoryGetPropertiesEpilogue( hMemory, pProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesMemoryGetPropertiesEpilogue) {
+                auto result = checker->zesMemoryGetPropertiesEpilogue( hMemory, pProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesMemoryGetProperties(result, hMemory, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesMemoryGetPropertiesEpilogue) {
+            auto result = checker->zesMemoryGetPropertiesEpilogue( hMemory, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesMemoryGetProperties(result, hMemory, pProperties);
         }
 
@@ -8760,16 +11665,24 @@ namespace validation_layer
         zes_mem_state_t* pState                         ///< [in,out] Will contain the current health and allocated memory.
         )
     {
-        context.logger->log_trace("zesMemoryGetState(hMemory, pState)");
+        ZEL_LOG_TRACE(context.logger, "zesMemoryGetState(hMemory, pState)");
 
         auto pfnGetState = context.zesDdiTable.Memory.pfnGetState;
 
         if( nullptr == pfnGetState )
             return logAndPropagateResult_zesMemoryGetState(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMemory, pState);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesMemoryGetStatePrologue( hMemory, pState );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesMemoryGetStatePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesMemoryGetStatePrologue) {
+                auto result = checker->zesMemoryGetStatePrologue( hMemory, pState );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesMemoryGetState(result, hMemory, pState);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesMemoryGetStatePrologue) {
+            auto result = checker->zesMemoryGetStatePrologue( hMemory, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesMemoryGetState(result, hMemory, pState);
         }
 
@@ -8779,15 +11692,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesMemoryGetStatePrologue( hMemory, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesMemoryGetState(result, hMemory, pState);
         }
 
         auto driver_result = pfnGetState( hMemory, pState );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesMemoryGetStateEpilogue( hMemory, pState ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesMemoryGetStateEpilogue) {
+                auto result = checker->zesMemoryGetStateEpilogue( hMemory, pState ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesMemoryGetState(result, hMemory, pState);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesMemoryGetStateEpilogue) {
+            auto result = checker->zesMemoryGetStateEpilogue( hMemory, pState ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesMemoryGetState(result, hMemory, pState);
         }
 
@@ -8803,16 +11723,24 @@ namespace validation_layer
                                                         ///< to memory, as well as the current maximum bandwidth.
         )
     {
-        context.logger->log_trace("zesMemoryGetBandwidth(hMemory, pBandwidth)");
+        ZEL_LOG_TRACE(context.logger, "zesMemoryGetBandwidth(hMemory, pBandwidth)");
 
         auto pfnGetBandwidth = context.zesDdiTable.Memory.pfnGetBandwidth;
 
         if( nullptr == pfnGetBandwidth )
             return logAndPropagateResult_zesMemoryGetBandwidth(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMemory, pBandwidth);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesMemoryGetBandwidthPrologue( hMemory, pBandwidth );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesMemoryGetBandwidthPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesMemoryGetBandwidthPrologue) {
+                auto result = checker->zesMemoryGetBandwidthPrologue( hMemory, pBandwidth );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesMemoryGetBandwidth(result, hMemory, pBandwidth);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesMemoryGetBandwidthPrologue) {
+            auto result = checker->zesMemoryGetBandwidthPrologue( hMemory, pBandwidth );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesMemoryGetBandwidth(result, hMemory, pBandwidth);
         }
 
@@ -8822,15 +11750,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesMemoryGetBandwidthPrologue( hMemory, pBandwidth );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesMemoryGetBandwidth(result, hMemory, pBandwidth);
         }
 
         auto driver_result = pfnGetBandwidth( hMemory, pBandwidth );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesMemoryGetBandwidthEpilogue( hMemory, pBandwidth ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesMemoryGetBandwidthEpilogue) {
+                auto result = checker->zesMemoryGetBandwidthEpilogue( hMemory, pBandwidth ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesMemoryGetBandwidth(result, hMemory, pBandwidth);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesMemoryGetBandwidthEpilogue) {
+            auto result = checker->zesMemoryGetBandwidthEpilogue( hMemory, pBandwidth ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesMemoryGetBandwidth(result, hMemory, pBandwidth);
         }
 
@@ -8855,16 +11790,24 @@ namespace validation_layer
                                                         ///< component handles.
         )
     {
-        context.logger->log_trace("zesDeviceEnumPerformanceFactorDomains(hDevice, pCount, phPerf)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceEnumPerformanceFactorDomains(hDevice, pCount, phPerf)");
 
         auto pfnEnumPerformanceFactorDomains = context.zesDdiTable.Device.pfnEnumPerformanceFactorDomains;
 
         if( nullptr == pfnEnumPerformanceFactorDomains )
             return logAndPropagateResult_zesDeviceEnumPerformanceFactorDomains(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pCount, phPerf);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumPerformanceFactorDomainsPrologue( hDevice, pCount, phPerf );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceEnumPerformanceFactorDomainsPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumPerformanceFactorDomainsPrologue) {
+                auto result = checker->zesDeviceEnumPerformanceFactorDomainsPrologue( hDevice, pCount, phPerf );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumPerformanceFactorDomains(result, hDevice, pCount, phPerf);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumPerformanceFactorDomainsPrologue) {
+            auto result = checker->zesDeviceEnumPerformanceFactorDomainsPrologue( hDevice, pCount, phPerf );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumPerformanceFactorDomains(result, hDevice, pCount, phPerf);
         }
 
@@ -8874,15 +11817,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumPerformanceFactorDomainsPrologue( hDevice, pCount, phPerf );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumPerformanceFactorDomains(result, hDevice, pCount, phPerf);
         }
 
         auto driver_result = pfnEnumPerformanceFactorDomains( hDevice, pCount, phPerf );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumPerformanceFactorDomainsEpilogue( hDevice, pCount, phPerf ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumPerformanceFactorDomainsEpilogue) {
+                auto result = checker->zesDeviceEnumPerformanceFactorDomainsEpilogue( hDevice, pCount, phPerf ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumPerformanceFactorDomains(result, hDevice, pCount, phPerf);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumPerformanceFactorDomainsEpilogue) {
+            auto result = checker->zesDeviceEnumPerformanceFactorDomainsEpilogue( hDevice, pCount, phPerf ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumPerformanceFactorDomains(result, hDevice, pCount, phPerf);
         }
 
@@ -8898,16 +11848,24 @@ namespace validation_layer
                                                         ///< Factor domain.
         )
     {
-        context.logger->log_trace("zesPerformanceFactorGetProperties(hPerf, pProperties)");
+        ZEL_LOG_TRACE(context.logger, "zesPerformanceFactorGetProperties(hPerf, pProperties)");
 
         auto pfnGetProperties = context.zesDdiTable.PerformanceFactor.pfnGetProperties;
 
         if( nullptr == pfnGetProperties )
             return logAndPropagateResult_zesPerformanceFactorGetProperties(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hPerf, pProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPerformanceFactorGetPropertiesPrologue( hPerf, pProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesPerformanceFactorGetPropertiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPerformanceFactorGetPropertiesPrologue) {
+                auto result = checker->zesPerformanceFactorGetPropertiesPrologue( hPerf, pProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPerformanceFactorGetProperties(result, hPerf, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPerformanceFactorGetPropertiesPrologue) {
+            auto result = checker->zesPerformanceFactorGetPropertiesPrologue( hPerf, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPerformanceFactorGetProperties(result, hPerf, pProperties);
         }
 
@@ -8917,15 +11875,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPerformanceFactorGetPropertiesPrologue( hPerf, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPerformanceFactorGetProperties(result, hPerf, pProperties);
         }
 
         auto driver_result = pfnGetProperties( hPerf, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPerformanceFactorGetPropertiesEpilogue( hPerf, pProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPerformanceFactorGetPropertiesEpilogue) {
+                auto result = checker->zesPerformanceFactorGetPropertiesEpilogue( hPerf, pProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPerformanceFactorGetProperties(result, hPerf, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPerformanceFactorGetPropertiesEpilogue) {
+            auto result = checker->zesPerformanceFactorGetPropertiesEpilogue( hPerf, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPerformanceFactorGetProperties(result, hPerf, pProperties);
         }
 
@@ -8941,16 +11906,24 @@ namespace validation_layer
                                                         ///< hardware (may not be the same as the requested Performance Factor).
         )
     {
-        context.logger->log_trace("zesPerformanceFactorGetConfig(hPerf, pFactor)");
+        ZEL_LOG_TRACE(context.logger, "zesPerformanceFactorGetConfig(hPerf, pFactor)");
 
         auto pfnGetConfig = context.zesDdiTable.PerformanceFactor.pfnGetConfig;
 
         if( nullptr == pfnGetConfig )
             return logAndPropagateResult_zesPerformanceFactorGetConfig(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hPerf, pFactor);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPerformanceFactorGetConfigPrologue( hPerf, pFactor );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesPerformanceFactorGetConfigPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPerformanceFactorGetConfigPrologue) {
+                auto result = checker->zesPerformanceFactorGetConfigPrologue( hPerf, pFactor );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPerformanceFactorGetConfig(result, hPerf, pFactor);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPerformanceFactorGetConfigPrologue) {
+            auto result = checker->zesPerformanceFactorGetConfigPrologue( hPerf, pFactor );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPerformanceFactorGetConfig(result, hPerf, pFactor);
         }
 
@@ -8960,15 +11933,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPerformanceFactorGetConfigPrologue( hPerf, pFactor );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPerformanceFactorGetConfig(result, hPerf, pFactor);
         }
 
         auto driver_result = pfnGetConfig( hPerf, pFactor );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPerformanceFactorGetConfigEpilogue( hPerf, pFactor ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPerformanceFactorGetConfigEpilogue) {
+                auto result = checker->zesPerformanceFactorGetConfigEpilogue( hPerf, pFactor ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPerformanceFactorGetConfig(result, hPerf, pFactor);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPerformanceFactorGetConfigEpilogue) {
+            auto result = checker->zesPerformanceFactorGetConfigEpilogue( hPerf, pFactor ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPerformanceFactorGetConfig(result, hPerf, pFactor);
         }
 
@@ -8983,16 +11963,24 @@ namespace validation_layer
         double factor                                   ///< [in] The new Performance Factor.
         )
     {
-        context.logger->log_trace("zesPerformanceFactorSetConfig(hPerf, factor)");
+        ZEL_LOG_TRACE(context.logger, "zesPerformanceFactorSetConfig(hPerf, factor)");
 
         auto pfnSetConfig = context.zesDdiTable.PerformanceFactor.pfnSetConfig;
 
         if( nullptr == pfnSetConfig )
             return logAndPropagateResult_zesPerformanceFactorSetConfig(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hPerf, factor);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPerformanceFactorSetConfigPrologue( hPerf, factor );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesPerformanceFactorSetConfigPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPerformanceFactorSetConfigPrologue) {
+                auto result = checker->zesPerformanceFactorSetConfigPrologue( hPerf, factor );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPerformanceFactorSetConfig(result, hPerf, factor);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPerformanceFactorSetConfigPrologue) {
+            auto result = checker->zesPerformanceFactorSetConfigPrologue( hPerf, factor );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPerformanceFactorSetConfig(result, hPerf, factor);
         }
 
@@ -9002,15 +11990,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPerformanceFactorSetConfigPrologue( hPerf, factor );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPerformanceFactorSetConfig(result, hPerf, factor);
         }
 
         auto driver_result = pfnSetConfig( hPerf, factor );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPerformanceFactorSetConfigEpilogue( hPerf, factor ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPerformanceFactorSetConfigEpilogue) {
+                auto result = checker->zesPerformanceFactorSetConfigEpilogue( hPerf, factor ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPerformanceFactorSetConfig(result, hPerf, factor);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPerformanceFactorSetConfigEpilogue) {
+            auto result = checker->zesPerformanceFactorSetConfigEpilogue( hPerf, factor ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPerformanceFactorSetConfig(result, hPerf, factor);
         }
 
@@ -9035,16 +12030,24 @@ namespace validation_layer
                                                         ///< component handles.
         )
     {
-        context.logger->log_trace("zesDeviceEnumPowerDomains(hDevice, pCount, phPower)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceEnumPowerDomains(hDevice, pCount, phPower)");
 
         auto pfnEnumPowerDomains = context.zesDdiTable.Device.pfnEnumPowerDomains;
 
         if( nullptr == pfnEnumPowerDomains )
             return logAndPropagateResult_zesDeviceEnumPowerDomains(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pCount, phPower);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumPowerDomainsPrologue( hDevice, pCount, phPower );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceEnumPowerDomainsPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumPowerDomainsPrologue) {
+                auto result = checker->zesDeviceEnumPowerDomainsPrologue( hDevice, pCount, phPower );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumPowerDomains(result, hDevice, pCount, phPower);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumPowerDomainsPrologue) {
+            auto result = checker->zesDeviceEnumPowerDomainsPrologue( hDevice, pCount, phPower );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumPowerDomains(result, hDevice, pCount, phPower);
         }
 
@@ -9054,15 +12057,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumPowerDomainsPrologue( hDevice, pCount, phPower );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumPowerDomains(result, hDevice, pCount, phPower);
         }
 
         auto driver_result = pfnEnumPowerDomains( hDevice, pCount, phPower );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumPowerDomainsEpilogue( hDevice, pCount, phPower ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumPowerDomainsEpilogue) {
+                auto result = checker->zesDeviceEnumPowerDomainsEpilogue( hDevice, pCount, phPower ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumPowerDomains(result, hDevice, pCount, phPower);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumPowerDomainsEpilogue) {
+            auto result = checker->zesDeviceEnumPowerDomainsEpilogue( hDevice, pCount, phPower ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumPowerDomains(result, hDevice, pCount, phPower);
         }
 
@@ -9077,16 +12087,24 @@ namespace validation_layer
         zes_pwr_handle_t* phPower                       ///< [in,out] power domain handle for the entire PCIe card.
         )
     {
-        context.logger->log_trace("zesDeviceGetCardPowerDomain(hDevice, phPower)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceGetCardPowerDomain(hDevice, phPower)");
 
         auto pfnGetCardPowerDomain = context.zesDdiTable.Device.pfnGetCardPowerDomain;
 
         if( nullptr == pfnGetCardPowerDomain )
             return logAndPropagateResult_zesDeviceGetCardPowerDomain(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, phPower);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetCardPowerDomainPrologue( hDevice, phPower );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceGetCardPowerDomainPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceGetCardPowerDomainPrologue) {
+                auto result = checker->zesDeviceGetCardPowerDomainPrologue( hDevice, phPower );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetCardPowerDomain(result, hDevice, phPower);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceGetCardPowerDomainPrologue) {
+            auto result = checker->zesDeviceGetCardPowerDomainPrologue( hDevice, phPower );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetCardPowerDomain(result, hDevice, phPower);
         }
 
@@ -9096,15 +12114,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetCardPowerDomainPrologue( hDevice, phPower );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetCardPowerDomain(result, hDevice, phPower);
         }
 
         auto driver_result = pfnGetCardPowerDomain( hDevice, phPower );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetCardPowerDomainEpilogue( hDevice, phPower ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceGetCardPowerDomainEpilogue) {
+                auto result = checker->zesDeviceGetCardPowerDomainEpilogue( hDevice, phPower ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetCardPowerDomain(result, hDevice, phPower);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceGetCardPowerDomainEpilogue) {
+            auto result = checker->zesDeviceGetCardPowerDomainEpilogue( hDevice, phPower ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetCardPowerDomain(result, hDevice, phPower);
         }
 
@@ -9119,16 +12144,24 @@ namespace validation_layer
         zes_power_properties_t* pProperties             ///< [in,out] Structure that will contain property data.
         )
     {
-        context.logger->log_trace("zesPowerGetProperties(hPower, pProperties)");
+        ZEL_LOG_TRACE(context.logger, "zesPowerGetProperties(hPower, pProperties)");
 
         auto pfnGetProperties = context.zesDdiTable.Power.pfnGetProperties;
 
         if( nullptr == pfnGetProperties )
             return logAndPropagateResult_zesPowerGetProperties(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hPower, pProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerGetPropertiesPrologue( hPower, pProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesPowerGetPropertiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPowerGetPropertiesPrologue) {
+                auto result = checker->zesPowerGetPropertiesPrologue( hPower, pProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetProperties(result, hPower, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPowerGetPropertiesPrologue) {
+            auto result = checker->zesPowerGetPropertiesPrologue( hPower, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetProperties(result, hPower, pProperties);
         }
 
@@ -9138,15 +12171,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerGetPropertiesPrologue( hPower, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetProperties(result, hPower, pProperties);
         }
 
         auto driver_result = pfnGetProperties( hPower, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerGetPropertiesEpilogue( hPower, pProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPowerGetPropertiesEpilogue) {
+                auto result = checker->zesPowerGetPropertiesEpilogue( hPower, pProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetProperties(result, hPower, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPowerGetPropertiesEpilogue) {
+            auto result = checker->zesPowerGetPropertiesEpilogue( hPower, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetProperties(result, hPower, pProperties);
         }
 
@@ -9162,16 +12202,24 @@ namespace validation_layer
                                                         ///< timestamp when the last counter value was measured.
         )
     {
-        context.logger->log_trace("zesPowerGetEnergyCounter(hPower, pEnergy)");
+        ZEL_LOG_TRACE(context.logger, "zesPowerGetEnergyCounter(hPower, pEnergy)");
 
         auto pfnGetEnergyCounter = context.zesDdiTable.Power.pfnGetEnergyCounter;
 
         if( nullptr == pfnGetEnergyCounter )
             return logAndPropagateResult_zesPowerGetEnergyCounter(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hPower, pEnergy);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerGetEnergyCounterPrologue( hPower, pEnergy );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesPowerGetEnergyCounterPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPowerGetEnergyCounterPrologue) {
+                auto result = checker->zesPowerGetEnergyCounterPrologue( hPower, pEnergy );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetEnergyCounter(result, hPower, pEnergy);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPowerGetEnergyCounterPrologue) {
+            auto result = checker->zesPowerGetEnergyCounterPrologue( hPower, pEnergy );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetEnergyCounter(result, hPower, pEnergy);
         }
 
@@ -9181,15 +12229,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerGetEnergyCounterPrologue( hPower, pEnergy );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetEnergyCounter(result, hPower, pEnergy);
         }
 
         auto driver_result = pfnGetEnergyCounter( hPower, pEnergy );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerGetEnergyCounterEpilogue( hPower, pEnergy ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPowerGetEnergyCounterEpilogue) {
+                auto result = checker->zesPowerGetEnergyCounterEpilogue( hPower, pEnergy ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetEnergyCounter(result, hPower, pEnergy);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPowerGetEnergyCounterEpilogue) {
+            auto result = checker->zesPowerGetEnergyCounterEpilogue( hPower, pEnergy ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetEnergyCounter(result, hPower, pEnergy);
         }
 
@@ -9209,16 +12264,24 @@ namespace validation_layer
                                                         ///< power limits will not be returned.
         )
     {
-        context.logger->log_trace("zesPowerGetLimits(hPower, pSustained, pBurst, pPeak)");
+        ZEL_LOG_TRACE(context.logger, "zesPowerGetLimits(hPower, pSustained, pBurst, pPeak)");
 
         auto pfnGetLimits = context.zesDdiTable.Power.pfnGetLimits;
 
         if( nullptr == pfnGetLimits )
             return logAndPropagateResult_zesPowerGetLimits(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hPower, pSustained, pBurst, pPeak);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerGetLimitsPrologue( hPower, pSustained, pBurst, pPeak );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesPowerGetLimitsPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPowerGetLimitsPrologue) {
+                auto result = checker->zesPowerGetLimitsPrologue( hPower, pSustained, pBurst, pPeak );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetLimits(result, hPower, pSustained, pBurst, pPeak);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPowerGetLimitsPrologue) {
+            auto result = checker->zesPowerGetLimitsPrologue( hPower, pSustained, pBurst, pPeak );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetLimits(result, hPower, pSustained, pBurst, pPeak);
         }
 
@@ -9228,15 +12291,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerGetLimitsPrologue( hPower, pSustained, pBurst, pPeak );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetLimits(result, hPower, pSustained, pBurst, pPeak);
         }
 
         auto driver_result = pfnGetLimits( hPower, pSustained, pBurst, pPeak );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerGetLimitsEpilogue( hPower, pSustained, pBurst, pPeak ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPowerGetLimitsEpilogue) {
+                auto result = checker->zesPowerGetLimitsEpilogue( hPower, pSustained, pBurst, pPeak ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetLimits(result, hPower, pSustained, pBurst, pPeak);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPowerGetLimitsEpilogue) {
+            auto result = checker->zesPowerGetLimitsEpilogue( hPower, pSustained, pBurst, pPeak ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetLimits(result, hPower, pSustained, pBurst, pPeak);
         }
 
@@ -9256,16 +12326,24 @@ namespace validation_layer
                                                         ///< be made to the peak power limits.
         )
     {
-        context.logger->log_trace("zesPowerSetLimits(hPower, pSustained, pBurst, pPeak)");
+        ZEL_LOG_TRACE(context.logger, "zesPowerSetLimits(hPower, pSustained, pBurst, pPeak)");
 
         auto pfnSetLimits = context.zesDdiTable.Power.pfnSetLimits;
 
         if( nullptr == pfnSetLimits )
             return logAndPropagateResult_zesPowerSetLimits(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hPower, pSustained, pBurst, pPeak);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerSetLimitsPrologue( hPower, pSustained, pBurst, pPeak );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesPowerSetLimitsPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPowerSetLimitsPrologue) {
+                auto result = checker->zesPowerSetLimitsPrologue( hPower, pSustained, pBurst, pPeak );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerSetLimits(result, hPower, pSustained, pBurst, pPeak);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPowerSetLimitsPrologue) {
+            auto result = checker->zesPowerSetLimitsPrologue( hPower, pSustained, pBurst, pPeak );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerSetLimits(result, hPower, pSustained, pBurst, pPeak);
         }
 
@@ -9275,15 +12353,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerSetLimitsPrologue( hPower, pSustained, pBurst, pPeak );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerSetLimits(result, hPower, pSustained, pBurst, pPeak);
         }
 
         auto driver_result = pfnSetLimits( hPower, pSustained, pBurst, pPeak );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerSetLimitsEpilogue( hPower, pSustained, pBurst, pPeak ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPowerSetLimitsEpilogue) {
+                auto result = checker->zesPowerSetLimitsEpilogue( hPower, pSustained, pBurst, pPeak ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerSetLimits(result, hPower, pSustained, pBurst, pPeak);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPowerSetLimitsEpilogue) {
+            auto result = checker->zesPowerSetLimitsEpilogue( hPower, pSustained, pBurst, pPeak ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerSetLimits(result, hPower, pSustained, pBurst, pPeak);
         }
 
@@ -9299,16 +12384,24 @@ namespace validation_layer
                                                         ///< enabled/energy threshold/process ID.
         )
     {
-        context.logger->log_trace("zesPowerGetEnergyThreshold(hPower, pThreshold)");
+        ZEL_LOG_TRACE(context.logger, "zesPowerGetEnergyThreshold(hPower, pThreshold)");
 
         auto pfnGetEnergyThreshold = context.zesDdiTable.Power.pfnGetEnergyThreshold;
 
         if( nullptr == pfnGetEnergyThreshold )
             return logAndPropagateResult_zesPowerGetEnergyThreshold(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hPower, pThreshold);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerGetEnergyThresholdPrologue( hPower, pThreshold );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesPowerGetEnergyThresholdPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPowerGetEnergyThresholdPrologue) {
+                auto result = checker->zesPowerGetEnergyThresholdPrologue( hPower, pThreshold );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetEnergyThreshold(result, hPower, pThreshold);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPowerGetEnergyThresholdPrologue) {
+            auto result = checker->zesPowerGetEnergyThresholdPrologue( hPower, pThreshold );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetEnergyThreshold(result, hPower, pThreshold);
         }
 
@@ -9318,15 +12411,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerGetEnergyThresholdPrologue( hPower, pThreshold );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetEnergyThreshold(result, hPower, pThreshold);
         }
 
         auto driver_result = pfnGetEnergyThreshold( hPower, pThreshold );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerGetEnergyThresholdEpilogue( hPower, pThreshold ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPowerGetEnergyThresholdEpilogue) {
+                auto result = checker->zesPowerGetEnergyThresholdEpilogue( hPower, pThreshold ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetEnergyThreshold(result, hPower, pThreshold);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPowerGetEnergyThresholdEpilogue) {
+            auto result = checker->zesPowerGetEnergyThresholdEpilogue( hPower, pThreshold ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetEnergyThreshold(result, hPower, pThreshold);
         }
 
@@ -9341,16 +12441,24 @@ namespace validation_layer
         double threshold                                ///< [in] The energy threshold to be set in joules.
         )
     {
-        context.logger->log_trace("zesPowerSetEnergyThreshold(hPower, threshold)");
+        ZEL_LOG_TRACE(context.logger, "zesPowerSetEnergyThreshold(hPower, threshold)");
 
         auto pfnSetEnergyThreshold = context.zesDdiTable.Power.pfnSetEnergyThreshold;
 
         if( nullptr == pfnSetEnergyThreshold )
             return logAndPropagateResult_zesPowerSetEnergyThreshold(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hPower, threshold);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerSetEnergyThresholdPrologue( hPower, threshold );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesPowerSetEnergyThresholdPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPowerSetEnergyThresholdPrologue) {
+                auto result = checker->zesPowerSetEnergyThresholdPrologue( hPower, threshold );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerSetEnergyThreshold(result, hPower, threshold);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPowerSetEnergyThresholdPrologue) {
+            auto result = checker->zesPowerSetEnergyThresholdPrologue( hPower, threshold );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerSetEnergyThreshold(result, hPower, threshold);
         }
 
@@ -9360,15 +12468,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerSetEnergyThresholdPrologue( hPower, threshold );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerSetEnergyThreshold(result, hPower, threshold);
         }
 
         auto driver_result = pfnSetEnergyThreshold( hPower, threshold );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerSetEnergyThresholdEpilogue( hPower, threshold ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPowerSetEnergyThresholdEpilogue) {
+                auto result = checker->zesPowerSetEnergyThresholdEpilogue( hPower, threshold ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerSetEnergyThreshold(result, hPower, threshold);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPowerSetEnergyThresholdEpilogue) {
+            auto result = checker->zesPowerSetEnergyThresholdEpilogue( hPower, threshold ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerSetEnergyThreshold(result, hPower, threshold);
         }
 
@@ -9384,16 +12499,24 @@ namespace validation_layer
         uint32_t* pAveragePower                         ///< [out] Returns the average power usage in milliwatts.
         )
     {
-        context.logger->log_trace("zesPowerGetUsage(hPower, pInstantPower, pAveragePower)");
+        ZEL_LOG_TRACE(context.logger, "zesPowerGetUsage(hPower, pInstantPower, pAveragePower)");
 
         auto pfnGetUsage = context.zesDdiTable.Power.pfnGetUsage;
 
         if( nullptr == pfnGetUsage )
             return logAndPropagateResult_zesPowerGetUsage(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hPower, pInstantPower, pAveragePower);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerGetUsagePrologue( hPower, pInstantPower, pAveragePower );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesPowerGetUsagePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPowerGetUsagePrologue) {
+                auto result = checker->zesPowerGetUsagePrologue( hPower, pInstantPower, pAveragePower );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetUsage(result, hPower, pInstantPower, pAveragePower);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPowerGetUsagePrologue) {
+            auto result = checker->zesPowerGetUsagePrologue( hPower, pInstantPower, pAveragePower );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetUsage(result, hPower, pInstantPower, pAveragePower);
         }
 
@@ -9403,15 +12526,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerGetUsagePrologue( hPower, pInstantPower, pAveragePower );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetUsage(result, hPower, pInstantPower, pAveragePower);
         }
 
         auto driver_result = pfnGetUsage( hPower, pInstantPower, pAveragePower );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerGetUsageEpilogue( hPower, pInstantPower, pAveragePower ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPowerGetUsageEpilogue) {
+                auto result = checker->zesPowerGetUsageEpilogue( hPower, pInstantPower, pAveragePower ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetUsage(result, hPower, pInstantPower, pAveragePower);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPowerGetUsageEpilogue) {
+            auto result = checker->zesPowerGetUsageEpilogue( hPower, pInstantPower, pAveragePower ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetUsage(result, hPower, pInstantPower, pAveragePower);
         }
 
@@ -9436,16 +12566,24 @@ namespace validation_layer
                                                         ///< component handles.
         )
     {
-        context.logger->log_trace("zesDeviceEnumPsus(hDevice, pCount, phPsu)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceEnumPsus(hDevice, pCount, phPsu)");
 
         auto pfnEnumPsus = context.zesDdiTable.Device.pfnEnumPsus;
 
         if( nullptr == pfnEnumPsus )
             return logAndPropagateResult_zesDeviceEnumPsus(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pCount, phPsu);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumPsusPrologue( hDevice, pCount, phPsu );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceEnumPsusPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumPsusPrologue) {
+                auto result = checker->zesDeviceEnumPsusPrologue( hDevice, pCount, phPsu );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumPsus(result, hDevice, pCount, phPsu);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumPsusPrologue) {
+            auto result = checker->zesDeviceEnumPsusPrologue( hDevice, pCount, phPsu );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumPsus(result, hDevice, pCount, phPsu);
         }
 
@@ -9455,15 +12593,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumPsusPrologue( hDevice, pCount, phPsu );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumPsus(result, hDevice, pCount, phPsu);
         }
 
         auto driver_result = pfnEnumPsus( hDevice, pCount, phPsu );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumPsusEpilogue( hDevice, pCount, phPsu ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumPsusEpilogue) {
+                auto result = checker->zesDeviceEnumPsusEpilogue( hDevice, pCount, phPsu ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumPsus(result, hDevice, pCount, phPsu);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumPsusEpilogue) {
+            auto result = checker->zesDeviceEnumPsusEpilogue( hDevice, pCount, phPsu ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumPsus(result, hDevice, pCount, phPsu);
         }
 
@@ -9478,16 +12623,24 @@ namespace validation_layer
         zes_psu_properties_t* pProperties               ///< [in,out] Will contain the properties of the power supply.
         )
     {
-        context.logger->log_trace("zesPsuGetProperties(hPsu, pProperties)");
+        ZEL_LOG_TRACE(context.logger, "zesPsuGetProperties(hPsu, pProperties)");
 
         auto pfnGetProperties = context.zesDdiTable.Psu.pfnGetProperties;
 
         if( nullptr == pfnGetProperties )
             return logAndPropagateResult_zesPsuGetProperties(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hPsu, pProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPsuGetPropertiesPrologue( hPsu, pProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesPsuGetPropertiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPsuGetPropertiesPrologue) {
+                auto result = checker->zesPsuGetPropertiesPrologue( hPsu, pProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPsuGetProperties(result, hPsu, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPsuGetPropertiesPrologue) {
+            auto result = checker->zesPsuGetPropertiesPrologue( hPsu, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPsuGetProperties(result, hPsu, pProperties);
         }
 
@@ -9497,15 +12650,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPsuGetPropertiesPrologue( hPsu, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPsuGetProperties(result, hPsu, pProperties);
         }
 
         auto driver_result = pfnGetProperties( hPsu, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPsuGetPropertiesEpilogue( hPsu, pProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPsuGetPropertiesEpilogue) {
+                auto result = checker->zesPsuGetPropertiesEpilogue( hPsu, pProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPsuGetProperties(result, hPsu, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPsuGetPropertiesEpilogue) {
+            auto result = checker->zesPsuGetPropertiesEpilogue( hPsu, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPsuGetProperties(result, hPsu, pProperties);
         }
 
@@ -9520,16 +12680,24 @@ namespace validation_layer
         zes_psu_state_t* pState                         ///< [in,out] Will contain the current state of the power supply.
         )
     {
-        context.logger->log_trace("zesPsuGetState(hPsu, pState)");
+        ZEL_LOG_TRACE(context.logger, "zesPsuGetState(hPsu, pState)");
 
         auto pfnGetState = context.zesDdiTable.Psu.pfnGetState;
 
         if( nullptr == pfnGetState )
             return logAndPropagateResult_zesPsuGetState(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hPsu, pState);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPsuGetStatePrologue( hPsu, pState );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesPsuGetStatePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPsuGetStatePrologue) {
+                auto result = checker->zesPsuGetStatePrologue( hPsu, pState );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPsuGetState(result, hPsu, pState);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPsuGetStatePrologue) {
+            auto result = checker->zesPsuGetStatePrologue( hPsu, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPsuGetState(result, hPsu, pState);
         }
 
@@ -9539,15 +12707,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPsuGetStatePrologue( hPsu, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPsuGetState(result, hPsu, pState);
         }
 
         auto driver_result = pfnGetState( hPsu, pState );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPsuGetStateEpilogue( hPsu, pState ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPsuGetStateEpilogue) {
+                auto result = checker->zesPsuGetStateEpilogue( hPsu, pState ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPsuGetState(result, hPsu, pState);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPsuGetStateEpilogue) {
+            auto result = checker->zesPsuGetStateEpilogue( hPsu, pState ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPsuGetState(result, hPsu, pState);
         }
 
@@ -9572,16 +12747,24 @@ namespace validation_layer
                                                         ///< component handles.
         )
     {
-        context.logger->log_trace("zesDeviceEnumRasErrorSets(hDevice, pCount, phRas)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceEnumRasErrorSets(hDevice, pCount, phRas)");
 
         auto pfnEnumRasErrorSets = context.zesDdiTable.Device.pfnEnumRasErrorSets;
 
         if( nullptr == pfnEnumRasErrorSets )
             return logAndPropagateResult_zesDeviceEnumRasErrorSets(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pCount, phRas);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumRasErrorSetsPrologue( hDevice, pCount, phRas );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceEnumRasErrorSetsPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumRasErrorSetsPrologue) {
+                auto result = checker->zesDeviceEnumRasErrorSetsPrologue( hDevice, pCount, phRas );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumRasErrorSets(result, hDevice, pCount, phRas);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumRasErrorSetsPrologue) {
+            auto result = checker->zesDeviceEnumRasErrorSetsPrologue( hDevice, pCount, phRas );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumRasErrorSets(result, hDevice, pCount, phRas);
         }
 
@@ -9591,15 +12774,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumRasErrorSetsPrologue( hDevice, pCount, phRas );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumRasErrorSets(result, hDevice, pCount, phRas);
         }
 
         auto driver_result = pfnEnumRasErrorSets( hDevice, pCount, phRas );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumRasErrorSetsEpilogue( hDevice, pCount, phRas ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumRasErrorSetsEpilogue) {
+                auto result = checker->zesDeviceEnumRasErrorSetsEpilogue( hDevice, pCount, phRas ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumRasErrorSets(result, hDevice, pCount, phRas);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumRasErrorSetsEpilogue) {
+            auto result = checker->zesDeviceEnumRasErrorSetsEpilogue( hDevice, pCount, phRas ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumRasErrorSets(result, hDevice, pCount, phRas);
         }
 
@@ -9614,16 +12804,24 @@ namespace validation_layer
         zes_ras_properties_t* pProperties               ///< [in,out] Structure describing RAS properties
         )
     {
-        context.logger->log_trace("zesRasGetProperties(hRas, pProperties)");
+        ZEL_LOG_TRACE(context.logger, "zesRasGetProperties(hRas, pProperties)");
 
         auto pfnGetProperties = context.zesDdiTable.Ras.pfnGetProperties;
 
         if( nullptr == pfnGetProperties )
             return logAndPropagateResult_zesRasGetProperties(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hRas, pProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasGetPropertiesPrologue( hRas, pProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesRasGetPropertiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesRasGetPropertiesPrologue) {
+                auto result = checker->zesRasGetPropertiesPrologue( hRas, pProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetProperties(result, hRas, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesRasGetPropertiesPrologue) {
+            auto result = checker->zesRasGetPropertiesPrologue( hRas, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetProperties(result, hRas, pProperties);
         }
 
@@ -9633,15 +12831,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesRasGetPropertiesPrologue( hRas, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetProperties(result, hRas, pProperties);
         }
 
         auto driver_result = pfnGetProperties( hRas, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasGetPropertiesEpilogue( hRas, pProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesRasGetPropertiesEpilogue) {
+                auto result = checker->zesRasGetPropertiesEpilogue( hRas, pProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetProperties(result, hRas, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesRasGetPropertiesEpilogue) {
+            auto result = checker->zesRasGetPropertiesEpilogue( hRas, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetProperties(result, hRas, pProperties);
         }
 
@@ -9657,16 +12862,24 @@ namespace validation_layer
                                                         ///< thresholds used to trigger events
         )
     {
-        context.logger->log_trace("zesRasGetConfig(hRas, pConfig)");
+        ZEL_LOG_TRACE(context.logger, "zesRasGetConfig(hRas, pConfig)");
 
         auto pfnGetConfig = context.zesDdiTable.Ras.pfnGetConfig;
 
         if( nullptr == pfnGetConfig )
             return logAndPropagateResult_zesRasGetConfig(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hRas, pConfig);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasGetConfigPrologue( hRas, pConfig );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesRasGetConfigPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesRasGetConfigPrologue) {
+                auto result = checker->zesRasGetConfigPrologue( hRas, pConfig );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetConfig(result, hRas, pConfig);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesRasGetConfigPrologue) {
+            auto result = checker->zesRasGetConfigPrologue( hRas, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetConfig(result, hRas, pConfig);
         }
 
@@ -9676,15 +12889,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesRasGetConfigPrologue( hRas, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetConfig(result, hRas, pConfig);
         }
 
         auto driver_result = pfnGetConfig( hRas, pConfig );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasGetConfigEpilogue( hRas, pConfig ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesRasGetConfigEpilogue) {
+                auto result = checker->zesRasGetConfigEpilogue( hRas, pConfig ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetConfig(result, hRas, pConfig);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesRasGetConfigEpilogue) {
+            auto result = checker->zesRasGetConfigEpilogue( hRas, pConfig ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetConfig(result, hRas, pConfig);
         }
 
@@ -9699,16 +12919,24 @@ namespace validation_layer
         const zes_ras_config_t* pConfig                 ///< [in] Change the RAS configuration - thresholds used to trigger events
         )
     {
-        context.logger->log_trace("zesRasSetConfig(hRas, pConfig)");
+        ZEL_LOG_TRACE(context.logger, "zesRasSetConfig(hRas, pConfig)");
 
         auto pfnSetConfig = context.zesDdiTable.Ras.pfnSetConfig;
 
         if( nullptr == pfnSetConfig )
             return logAndPropagateResult_zesRasSetConfig(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hRas, pConfig);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasSetConfigPrologue( hRas, pConfig );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesRasSetConfigPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesRasSetConfigPrologue) {
+                auto result = checker->zesRasSetConfigPrologue( hRas, pConfig );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasSetConfig(result, hRas, pConfig);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesRasSetConfigPrologue) {
+            auto result = checker->zesRasSetConfigPrologue( hRas, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasSetConfig(result, hRas, pConfig);
         }
 
@@ -9718,15 +12946,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesRasSetConfigPrologue( hRas, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasSetConfig(result, hRas, pConfig);
         }
 
         auto driver_result = pfnSetConfig( hRas, pConfig );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasSetConfigEpilogue( hRas, pConfig ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesRasSetConfigEpilogue) {
+                auto result = checker->zesRasSetConfigEpilogue( hRas, pConfig ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasSetConfig(result, hRas, pConfig);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesRasSetConfigEpilogue) {
+            auto result = checker->zesRasSetConfigEpilogue( hRas, pConfig ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasSetConfig(result, hRas, pConfig);
         }
 
@@ -9742,16 +12977,24 @@ namespace validation_layer
         zes_ras_state_t* pState                         ///< [in,out] Breakdown of where errors have occurred
         )
     {
-        context.logger->log_trace("zesRasGetState(hRas, clear, pState)");
+        ZEL_LOG_TRACE(context.logger, "zesRasGetState(hRas, clear, pState)");
 
         auto pfnGetState = context.zesDdiTable.Ras.pfnGetState;
 
         if( nullptr == pfnGetState )
             return logAndPropagateResult_zesRasGetState(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hRas, clear, pState);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasGetStatePrologue( hRas, clear, pState );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesRasGetStatePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesRasGetStatePrologue) {
+                auto result = checker->zesRasGetStatePrologue( hRas, clear, pState );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetState(result, hRas, clear, pState);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesRasGetStatePrologue) {
+            auto result = checker->zesRasGetStatePrologue( hRas, clear, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetState(result, hRas, clear, pState);
         }
 
@@ -9761,15 +13004,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesRasGetStatePrologue( hRas, clear, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetState(result, hRas, clear, pState);
         }
 
         auto driver_result = pfnGetState( hRas, clear, pState );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasGetStateEpilogue( hRas, clear, pState ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesRasGetStateEpilogue) {
+                auto result = checker->zesRasGetStateEpilogue( hRas, clear, pState ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetState(result, hRas, clear, pState);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesRasGetStateEpilogue) {
+            auto result = checker->zesRasGetStateEpilogue( hRas, clear, pState ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetState(result, hRas, clear, pState);
         }
 
@@ -9794,16 +13044,24 @@ namespace validation_layer
                                                         ///< component handles.
         )
     {
-        context.logger->log_trace("zesDeviceEnumSchedulers(hDevice, pCount, phScheduler)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceEnumSchedulers(hDevice, pCount, phScheduler)");
 
         auto pfnEnumSchedulers = context.zesDdiTable.Device.pfnEnumSchedulers;
 
         if( nullptr == pfnEnumSchedulers )
             return logAndPropagateResult_zesDeviceEnumSchedulers(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pCount, phScheduler);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumSchedulersPrologue( hDevice, pCount, phScheduler );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceEnumSchedulersPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumSchedulersPrologue) {
+                auto result = checker->zesDeviceEnumSchedulersPrologue( hDevice, pCount, phScheduler );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumSchedulers(result, hDevice, pCount, phScheduler);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumSchedulersPrologue) {
+            auto result = checker->zesDeviceEnumSchedulersPrologue( hDevice, pCount, phScheduler );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumSchedulers(result, hDevice, pCount, phScheduler);
         }
 
@@ -9813,15 +13071,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumSchedulersPrologue( hDevice, pCount, phScheduler );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumSchedulers(result, hDevice, pCount, phScheduler);
         }
 
         auto driver_result = pfnEnumSchedulers( hDevice, pCount, phScheduler );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumSchedulersEpilogue( hDevice, pCount, phScheduler ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumSchedulersEpilogue) {
+                auto result = checker->zesDeviceEnumSchedulersEpilogue( hDevice, pCount, phScheduler ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumSchedulers(result, hDevice, pCount, phScheduler);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumSchedulersEpilogue) {
+            auto result = checker->zesDeviceEnumSchedulersEpilogue( hDevice, pCount, phScheduler ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumSchedulers(result, hDevice, pCount, phScheduler);
         }
 
@@ -9836,16 +13101,24 @@ namespace validation_layer
         zes_sched_properties_t* pProperties             ///< [in,out] Structure that will contain property data.
         )
     {
-        context.logger->log_trace("zesSchedulerGetProperties(hScheduler, pProperties)");
+        ZEL_LOG_TRACE(context.logger, "zesSchedulerGetProperties(hScheduler, pProperties)");
 
         auto pfnGetProperties = context.zesDdiTable.Scheduler.pfnGetProperties;
 
         if( nullptr == pfnGetProperties )
             return logAndPropagateResult_zesSchedulerGetProperties(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hScheduler, pProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerGetPropertiesPrologue( hScheduler, pProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesSchedulerGetPropertiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesSchedulerGetPropertiesPrologue) {
+                auto result = checker->zesSchedulerGetPropertiesPrologue( hScheduler, pProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerGetProperties(result, hScheduler, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesSchedulerGetPropertiesPrologue) {
+            auto result = checker->zesSchedulerGetPropertiesPrologue( hScheduler, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerGetProperties(result, hScheduler, pProperties);
         }
 
@@ -9855,15 +13128,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerGetPropertiesPrologue( hScheduler, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerGetProperties(result, hScheduler, pProperties);
         }
 
         auto driver_result = pfnGetProperties( hScheduler, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerGetPropertiesEpilogue( hScheduler, pProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesSchedulerGetPropertiesEpilogue) {
+                auto result = checker->zesSchedulerGetPropertiesEpilogue( hScheduler, pProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerGetProperties(result, hScheduler, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesSchedulerGetPropertiesEpilogue) {
+            auto result = checker->zesSchedulerGetPropertiesEpilogue( hScheduler, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerGetProperties(result, hScheduler, pProperties);
         }
 
@@ -9878,16 +13158,24 @@ namespace validation_layer
         zes_sched_mode_t* pMode                         ///< [in,out] Will contain the current scheduler mode.
         )
     {
-        context.logger->log_trace("zesSchedulerGetCurrentMode(hScheduler, pMode)");
+        ZEL_LOG_TRACE(context.logger, "zesSchedulerGetCurrentMode(hScheduler, pMode)");
 
         auto pfnGetCurrentMode = context.zesDdiTable.Scheduler.pfnGetCurrentMode;
 
         if( nullptr == pfnGetCurrentMode )
             return logAndPropagateResult_zesSchedulerGetCurrentMode(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hScheduler, pMode);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerGetCurrentModePrologue( hScheduler, pMode );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesSchedulerGetCurrentModePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesSchedulerGetCurrentModePrologue) {
+                auto result = checker->zesSchedulerGetCurrentModePrologue( hScheduler, pMode );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerGetCurrentMode(result, hScheduler, pMode);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesSchedulerGetCurrentModePrologue) {
+            auto result = checker->zesSchedulerGetCurrentModePrologue( hScheduler, pMode );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerGetCurrentMode(result, hScheduler, pMode);
         }
 
@@ -9897,15 +13185,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerGetCurrentModePrologue( hScheduler, pMode );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerGetCurrentMode(result, hScheduler, pMode);
         }
 
         auto driver_result = pfnGetCurrentMode( hScheduler, pMode );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerGetCurrentModeEpilogue( hScheduler, pMode ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesSchedulerGetCurrentModeEpilogue) {
+                auto result = checker->zesSchedulerGetCurrentModeEpilogue( hScheduler, pMode ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerGetCurrentMode(result, hScheduler, pMode);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesSchedulerGetCurrentModeEpilogue) {
+            auto result = checker->zesSchedulerGetCurrentModeEpilogue( hScheduler, pMode ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerGetCurrentMode(result, hScheduler, pMode);
         }
 
@@ -9922,16 +13217,24 @@ namespace validation_layer
         zes_sched_timeout_properties_t* pConfig         ///< [in,out] Will contain the current parameters for this mode.
         )
     {
-        context.logger->log_trace("zesSchedulerGetTimeoutModeProperties(hScheduler, getDefaults, pConfig)");
+        ZEL_LOG_TRACE(context.logger, "zesSchedulerGetTimeoutModeProperties(hScheduler, getDefaults, pConfig)");
 
         auto pfnGetTimeoutModeProperties = context.zesDdiTable.Scheduler.pfnGetTimeoutModeProperties;
 
         if( nullptr == pfnGetTimeoutModeProperties )
             return logAndPropagateResult_zesSchedulerGetTimeoutModeProperties(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hScheduler, getDefaults, pConfig);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerGetTimeoutModePropertiesPrologue( hScheduler, getDefaults, pConfig );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesSchedulerGetTimeoutModePropertiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesSchedulerGetTimeoutModePropertiesPrologue) {
+                auto result = checker->zesSchedulerGetTimeoutModePropertiesPrologue( hScheduler, getDefaults, pConfig );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerGetTimeoutModeProperties(result, hScheduler, getDefaults, pConfig);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesSchedulerGetTimeoutModePropertiesPrologue) {
+            auto result = checker->zesSchedulerGetTimeoutModePropertiesPrologue( hScheduler, getDefaults, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerGetTimeoutModeProperties(result, hScheduler, getDefaults, pConfig);
         }
 
@@ -9941,15 +13244,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerGetTimeoutModePropertiesPrologue( hScheduler, getDefaults, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerGetTimeoutModeProperties(result, hScheduler, getDefaults, pConfig);
         }
 
         auto driver_result = pfnGetTimeoutModeProperties( hScheduler, getDefaults, pConfig );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerGetTimeoutModePropertiesEpilogue( hScheduler, getDefaults, pConfig ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesSchedulerGetTimeoutModePropertiesEpilogue) {
+                auto result = checker->zesSchedulerGetTimeoutModePropertiesEpilogue( hScheduler, getDefaults, pConfig ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerGetTimeoutModeProperties(result, hScheduler, getDefaults, pConfig);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesSchedulerGetTimeoutModePropertiesEpilogue) {
+            auto result = checker->zesSchedulerGetTimeoutModePropertiesEpilogue( hScheduler, getDefaults, pConfig ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerGetTimeoutModeProperties(result, hScheduler, getDefaults, pConfig);
         }
 
@@ -9966,16 +13276,24 @@ namespace validation_layer
         zes_sched_timeslice_properties_t* pConfig       ///< [in,out] Will contain the current parameters for this mode.
         )
     {
-        context.logger->log_trace("zesSchedulerGetTimesliceModeProperties(hScheduler, getDefaults, pConfig)");
+        ZEL_LOG_TRACE(context.logger, "zesSchedulerGetTimesliceModeProperties(hScheduler, getDefaults, pConfig)");
 
         auto pfnGetTimesliceModeProperties = context.zesDdiTable.Scheduler.pfnGetTimesliceModeProperties;
 
         if( nullptr == pfnGetTimesliceModeProperties )
             return logAndPropagateResult_zesSchedulerGetTimesliceModeProperties(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hScheduler, getDefaults, pConfig);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerGetTimesliceModePropertiesPrologue( hScheduler, getDefaults, pConfig );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesSchedulerGetTimesliceModePropertiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesSchedulerGetTimesliceModePropertiesPrologue) {
+                auto result = checker->zesSchedulerGetTimesliceModePropertiesPrologue( hScheduler, getDefaults, pConfig );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerGetTimesliceModeProperties(result, hScheduler, getDefaults, pConfig);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesSchedulerGetTimesliceModePropertiesPrologue) {
+            auto result = checker->zesSchedulerGetTimesliceModePropertiesPrologue( hScheduler, getDefaults, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerGetTimesliceModeProperties(result, hScheduler, getDefaults, pConfig);
         }
 
@@ -9985,15 +13303,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerGetTimesliceModePropertiesPrologue( hScheduler, getDefaults, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerGetTimesliceModeProperties(result, hScheduler, getDefaults, pConfig);
         }
 
         auto driver_result = pfnGetTimesliceModeProperties( hScheduler, getDefaults, pConfig );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerGetTimesliceModePropertiesEpilogue( hScheduler, getDefaults, pConfig ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesSchedulerGetTimesliceModePropertiesEpilogue) {
+                auto result = checker->zesSchedulerGetTimesliceModePropertiesEpilogue( hScheduler, getDefaults, pConfig ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerGetTimesliceModeProperties(result, hScheduler, getDefaults, pConfig);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesSchedulerGetTimesliceModePropertiesEpilogue) {
+            auto result = checker->zesSchedulerGetTimesliceModePropertiesEpilogue( hScheduler, getDefaults, pConfig ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerGetTimesliceModeProperties(result, hScheduler, getDefaults, pConfig);
         }
 
@@ -10010,16 +13335,24 @@ namespace validation_layer
                                                         ///< apply the new scheduler mode.
         )
     {
-        context.logger->log_trace("zesSchedulerSetTimeoutMode(hScheduler, pProperties, pNeedReload)");
+        ZEL_LOG_TRACE(context.logger, "zesSchedulerSetTimeoutMode(hScheduler, pProperties, pNeedReload)");
 
         auto pfnSetTimeoutMode = context.zesDdiTable.Scheduler.pfnSetTimeoutMode;
 
         if( nullptr == pfnSetTimeoutMode )
             return logAndPropagateResult_zesSchedulerSetTimeoutMode(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hScheduler, pProperties, pNeedReload);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerSetTimeoutModePrologue( hScheduler, pProperties, pNeedReload );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesSchedulerSetTimeoutModePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesSchedulerSetTimeoutModePrologue) {
+                auto result = checker->zesSchedulerSetTimeoutModePrologue( hScheduler, pProperties, pNeedReload );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerSetTimeoutMode(result, hScheduler, pProperties, pNeedReload);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesSchedulerSetTimeoutModePrologue) {
+            auto result = checker->zesSchedulerSetTimeoutModePrologue( hScheduler, pProperties, pNeedReload );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerSetTimeoutMode(result, hScheduler, pProperties, pNeedReload);
         }
 
@@ -10029,15 +13362,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerSetTimeoutModePrologue( hScheduler, pProperties, pNeedReload );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerSetTimeoutMode(result, hScheduler, pProperties, pNeedReload);
         }
 
         auto driver_result = pfnSetTimeoutMode( hScheduler, pProperties, pNeedReload );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerSetTimeoutModeEpilogue( hScheduler, pProperties, pNeedReload ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesSchedulerSetTimeoutModeEpilogue) {
+                auto result = checker->zesSchedulerSetTimeoutModeEpilogue( hScheduler, pProperties, pNeedReload ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerSetTimeoutMode(result, hScheduler, pProperties, pNeedReload);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesSchedulerSetTimeoutModeEpilogue) {
+            auto result = checker->zesSchedulerSetTimeoutModeEpilogue( hScheduler, pProperties, pNeedReload ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerSetTimeoutMode(result, hScheduler, pProperties, pNeedReload);
         }
 
@@ -10054,16 +13394,24 @@ namespace validation_layer
                                                         ///< apply the new scheduler mode.
         )
     {
-        context.logger->log_trace("zesSchedulerSetTimesliceMode(hScheduler, pProperties, pNeedReload)");
+        ZEL_LOG_TRACE(context.logger, "zesSchedulerSetTimesliceMode(hScheduler, pProperties, pNeedReload)");
 
         auto pfnSetTimesliceMode = context.zesDdiTable.Scheduler.pfnSetTimesliceMode;
 
         if( nullptr == pfnSetTimesliceMode )
             return logAndPropagateResult_zesSchedulerSetTimesliceMode(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hScheduler, pProperties, pNeedReload);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerSetTimesliceModePrologue( hScheduler, pProperties, pNeedReload );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesSchedulerSetTimesliceModePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesSchedulerSetTimesliceModePrologue) {
+                auto result = checker->zesSchedulerSetTimesliceModePrologue( hScheduler, pProperties, pNeedReload );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerSetTimesliceMode(result, hScheduler, pProperties, pNeedReload);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesSchedulerSetTimesliceModePrologue) {
+            auto result = checker->zesSchedulerSetTimesliceModePrologue( hScheduler, pProperties, pNeedReload );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerSetTimesliceMode(result, hScheduler, pProperties, pNeedReload);
         }
 
@@ -10073,15 +13421,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerSetTimesliceModePrologue( hScheduler, pProperties, pNeedReload );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerSetTimesliceMode(result, hScheduler, pProperties, pNeedReload);
         }
 
         auto driver_result = pfnSetTimesliceMode( hScheduler, pProperties, pNeedReload );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerSetTimesliceModeEpilogue( hScheduler, pProperties, pNeedReload ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesSchedulerSetTimesliceModeEpilogue) {
+                auto result = checker->zesSchedulerSetTimesliceModeEpilogue( hScheduler, pProperties, pNeedReload ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerSetTimesliceMode(result, hScheduler, pProperties, pNeedReload);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesSchedulerSetTimesliceModeEpilogue) {
+            auto result = checker->zesSchedulerSetTimesliceModeEpilogue( hScheduler, pProperties, pNeedReload ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerSetTimesliceMode(result, hScheduler, pProperties, pNeedReload);
         }
 
@@ -10097,16 +13452,24 @@ namespace validation_layer
                                                         ///< apply the new scheduler mode.
         )
     {
-        context.logger->log_trace("zesSchedulerSetExclusiveMode(hScheduler, pNeedReload)");
+        ZEL_LOG_TRACE(context.logger, "zesSchedulerSetExclusiveMode(hScheduler, pNeedReload)");
 
         auto pfnSetExclusiveMode = context.zesDdiTable.Scheduler.pfnSetExclusiveMode;
 
         if( nullptr == pfnSetExclusiveMode )
             return logAndPropagateResult_zesSchedulerSetExclusiveMode(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hScheduler, pNeedReload);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerSetExclusiveModePrologue( hScheduler, pNeedReload );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesSchedulerSetExclusiveModePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesSchedulerSetExclusiveModePrologue) {
+                auto result = checker->zesSchedulerSetExclusiveModePrologue( hScheduler, pNeedReload );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerSetExclusiveMode(result, hScheduler, pNeedReload);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesSchedulerSetExclusiveModePrologue) {
+            auto result = checker->zesSchedulerSetExclusiveModePrologue( hScheduler, pNeedReload );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerSetExclusiveMode(result, hScheduler, pNeedReload);
         }
 
@@ -10116,15 +13479,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerSetExclusiveModePrologue( hScheduler, pNeedReload );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerSetExclusiveMode(result, hScheduler, pNeedReload);
         }
 
         auto driver_result = pfnSetExclusiveMode( hScheduler, pNeedReload );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerSetExclusiveModeEpilogue( hScheduler, pNeedReload ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesSchedulerSetExclusiveModeEpilogue) {
+                auto result = checker->zesSchedulerSetExclusiveModeEpilogue( hScheduler, pNeedReload ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerSetExclusiveMode(result, hScheduler, pNeedReload);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesSchedulerSetExclusiveModeEpilogue) {
+            auto result = checker->zesSchedulerSetExclusiveModeEpilogue( hScheduler, pNeedReload ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerSetExclusiveMode(result, hScheduler, pNeedReload);
         }
 
@@ -10140,16 +13510,24 @@ namespace validation_layer
                                                         ///< apply the new scheduler mode.
         )
     {
-        context.logger->log_trace("zesSchedulerSetComputeUnitDebugMode(hScheduler, pNeedReload)");
+        ZEL_LOG_TRACE(context.logger, "zesSchedulerSetComputeUnitDebugMode(hScheduler, pNeedReload)");
 
         auto pfnSetComputeUnitDebugMode = context.zesDdiTable.Scheduler.pfnSetComputeUnitDebugMode;
 
         if( nullptr == pfnSetComputeUnitDebugMode )
             return logAndPropagateResult_zesSchedulerSetComputeUnitDebugMode(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hScheduler, pNeedReload);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerSetComputeUnitDebugModePrologue( hScheduler, pNeedReload );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesSchedulerSetComputeUnitDebugModePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesSchedulerSetComputeUnitDebugModePrologue) {
+                auto result = checker->zesSchedulerSetComputeUnitDebugModePrologue( hScheduler, pNeedReload );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerSetComputeUnitDebugMode(result, hScheduler, pNeedReload);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesSchedulerSetComputeUnitDebugModePrologue) {
+            auto result = checker->zesSchedulerSetComputeUnitDebugModePrologue( hScheduler, pNeedReload );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerSetComputeUnitDebugMode(result, hScheduler, pNeedReload);
         }
 
@@ -10159,15 +13537,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerSetComputeUnitDebugModePrologue( hScheduler, pNeedReload );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerSetComputeUnitDebugMode(result, hScheduler, pNeedReload);
         }
 
         auto driver_result = pfnSetComputeUnitDebugMode( hScheduler, pNeedReload );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerSetComputeUnitDebugModeEpilogue( hScheduler, pNeedReload ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesSchedulerSetComputeUnitDebugModeEpilogue) {
+                auto result = checker->zesSchedulerSetComputeUnitDebugModeEpilogue( hScheduler, pNeedReload ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerSetComputeUnitDebugMode(result, hScheduler, pNeedReload);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesSchedulerSetComputeUnitDebugModeEpilogue) {
+            auto result = checker->zesSchedulerSetComputeUnitDebugModeEpilogue( hScheduler, pNeedReload ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesSchedulerSetComputeUnitDebugMode(result, hScheduler, pNeedReload);
         }
 
@@ -10192,16 +13577,24 @@ namespace validation_layer
                                                         ///< component handles.
         )
     {
-        context.logger->log_trace("zesDeviceEnumStandbyDomains(hDevice, pCount, phStandby)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceEnumStandbyDomains(hDevice, pCount, phStandby)");
 
         auto pfnEnumStandbyDomains = context.zesDdiTable.Device.pfnEnumStandbyDomains;
 
         if( nullptr == pfnEnumStandbyDomains )
             return logAndPropagateResult_zesDeviceEnumStandbyDomains(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pCount, phStandby);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumStandbyDomainsPrologue( hDevice, pCount, phStandby );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceEnumStandbyDomainsPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumStandbyDomainsPrologue) {
+                auto result = checker->zesDeviceEnumStandbyDomainsPrologue( hDevice, pCount, phStandby );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumStandbyDomains(result, hDevice, pCount, phStandby);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumStandbyDomainsPrologue) {
+            auto result = checker->zesDeviceEnumStandbyDomainsPrologue( hDevice, pCount, phStandby );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumStandbyDomains(result, hDevice, pCount, phStandby);
         }
 
@@ -10211,15 +13604,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumStandbyDomainsPrologue( hDevice, pCount, phStandby );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumStandbyDomains(result, hDevice, pCount, phStandby);
         }
 
         auto driver_result = pfnEnumStandbyDomains( hDevice, pCount, phStandby );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumStandbyDomainsEpilogue( hDevice, pCount, phStandby ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumStandbyDomainsEpilogue) {
+                auto result = checker->zesDeviceEnumStandbyDomainsEpilogue( hDevice, pCount, phStandby ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumStandbyDomains(result, hDevice, pCount, phStandby);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumStandbyDomainsEpilogue) {
+            auto result = checker->zesDeviceEnumStandbyDomainsEpilogue( hDevice, pCount, phStandby ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumStandbyDomains(result, hDevice, pCount, phStandby);
         }
 
@@ -10234,16 +13634,24 @@ namespace validation_layer
         zes_standby_properties_t* pProperties           ///< [in,out] Will contain the standby hardware properties.
         )
     {
-        context.logger->log_trace("zesStandbyGetProperties(hStandby, pProperties)");
+        ZEL_LOG_TRACE(context.logger, "zesStandbyGetProperties(hStandby, pProperties)");
 
         auto pfnGetProperties = context.zesDdiTable.Standby.pfnGetProperties;
 
         if( nullptr == pfnGetProperties )
             return logAndPropagateResult_zesStandbyGetProperties(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hStandby, pProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesStandbyGetPropertiesPrologue( hStandby, pProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesStandbyGetPropertiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesStandbyGetPropertiesPrologue) {
+                auto result = checker->zesStandbyGetPropertiesPrologue( hStandby, pProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesStandbyGetProperties(result, hStandby, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesStandbyGetPropertiesPrologue) {
+            auto result = checker->zesStandbyGetPropertiesPrologue( hStandby, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesStandbyGetProperties(result, hStandby, pProperties);
         }
 
@@ -10253,15 +13661,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesStandbyGetPropertiesPrologue( hStandby, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesStandbyGetProperties(result, hStandby, pProperties);
         }
 
         auto driver_result = pfnGetProperties( hStandby, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesStandbyGetPropertiesEpilogue( hStandby, pProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesStandbyGetPropertiesEpilogue) {
+                auto result = checker->zesStandbyGetPropertiesEpilogue( hStandby, pProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesStandbyGetProperties(result, hStandby, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesStandbyGetPropertiesEpilogue) {
+            auto result = checker->zesStandbyGetPropertiesEpilogue( hStandby, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesStandbyGetProperties(result, hStandby, pProperties);
         }
 
@@ -10276,16 +13691,24 @@ namespace validation_layer
         zes_standby_promo_mode_t* pMode                 ///< [in,out] Will contain the current standby mode.
         )
     {
-        context.logger->log_trace("zesStandbyGetMode(hStandby, pMode)");
+        ZEL_LOG_TRACE(context.logger, "zesStandbyGetMode(hStandby, pMode)");
 
         auto pfnGetMode = context.zesDdiTable.Standby.pfnGetMode;
 
         if( nullptr == pfnGetMode )
             return logAndPropagateResult_zesStandbyGetMode(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hStandby, pMode);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesStandbyGetModePrologue( hStandby, pMode );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesStandbyGetModePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesStandbyGetModePrologue) {
+                auto result = checker->zesStandbyGetModePrologue( hStandby, pMode );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesStandbyGetMode(result, hStandby, pMode);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesStandbyGetModePrologue) {
+            auto result = checker->zesStandbyGetModePrologue( hStandby, pMode );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesStandbyGetMode(result, hStandby, pMode);
         }
 
@@ -10295,15 +13718,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesStandbyGetModePrologue( hStandby, pMode );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesStandbyGetMode(result, hStandby, pMode);
         }
 
         auto driver_result = pfnGetMode( hStandby, pMode );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesStandbyGetModeEpilogue( hStandby, pMode ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesStandbyGetModeEpilogue) {
+                auto result = checker->zesStandbyGetModeEpilogue( hStandby, pMode ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesStandbyGetMode(result, hStandby, pMode);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesStandbyGetModeEpilogue) {
+            auto result = checker->zesStandbyGetModeEpilogue( hStandby, pMode ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesStandbyGetMode(result, hStandby, pMode);
         }
 
@@ -10318,16 +13748,24 @@ namespace validation_layer
         zes_standby_promo_mode_t mode                   ///< [in] New standby mode.
         )
     {
-        context.logger->log_trace("zesStandbySetMode(hStandby, mode)");
+        ZEL_LOG_TRACE(context.logger, "zesStandbySetMode(hStandby, mode)");
 
         auto pfnSetMode = context.zesDdiTable.Standby.pfnSetMode;
 
         if( nullptr == pfnSetMode )
             return logAndPropagateResult_zesStandbySetMode(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hStandby, mode);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesStandbySetModePrologue( hStandby, mode );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesStandbySetModePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesStandbySetModePrologue) {
+                auto result = checker->zesStandbySetModePrologue( hStandby, mode );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesStandbySetMode(result, hStandby, mode);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesStandbySetModePrologue) {
+            auto result = checker->zesStandbySetModePrologue( hStandby, mode );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesStandbySetMode(result, hStandby, mode);
         }
 
@@ -10337,15 +13775,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesStandbySetModePrologue( hStandby, mode );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesStandbySetMode(result, hStandby, mode);
         }
 
         auto driver_result = pfnSetMode( hStandby, mode );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesStandbySetModeEpilogue( hStandby, mode ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesStandbySetModeEpilogue) {
+                auto result = checker->zesStandbySetModeEpilogue( hStandby, mode ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesStandbySetMode(result, hStandby, mode);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesStandbySetModeEpilogue) {
+            auto result = checker->zesStandbySetModeEpilogue( hStandby, mode ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesStandbySetMode(result, hStandby, mode);
         }
 
@@ -10370,16 +13815,24 @@ namespace validation_layer
                                                         ///< component handles.
         )
     {
-        context.logger->log_trace("zesDeviceEnumTemperatureSensors(hDevice, pCount, phTemperature)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceEnumTemperatureSensors(hDevice, pCount, phTemperature)");
 
         auto pfnEnumTemperatureSensors = context.zesDdiTable.Device.pfnEnumTemperatureSensors;
 
         if( nullptr == pfnEnumTemperatureSensors )
             return logAndPropagateResult_zesDeviceEnumTemperatureSensors(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pCount, phTemperature);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumTemperatureSensorsPrologue( hDevice, pCount, phTemperature );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceEnumTemperatureSensorsPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumTemperatureSensorsPrologue) {
+                auto result = checker->zesDeviceEnumTemperatureSensorsPrologue( hDevice, pCount, phTemperature );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumTemperatureSensors(result, hDevice, pCount, phTemperature);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumTemperatureSensorsPrologue) {
+            auto result = checker->zesDeviceEnumTemperatureSensorsPrologue( hDevice, pCount, phTemperature );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumTemperatureSensors(result, hDevice, pCount, phTemperature);
         }
 
@@ -10389,15 +13842,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumTemperatureSensorsPrologue( hDevice, pCount, phTemperature );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumTemperatureSensors(result, hDevice, pCount, phTemperature);
         }
 
         auto driver_result = pfnEnumTemperatureSensors( hDevice, pCount, phTemperature );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumTemperatureSensorsEpilogue( hDevice, pCount, phTemperature ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumTemperatureSensorsEpilogue) {
+                auto result = checker->zesDeviceEnumTemperatureSensorsEpilogue( hDevice, pCount, phTemperature ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumTemperatureSensors(result, hDevice, pCount, phTemperature);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumTemperatureSensorsEpilogue) {
+            auto result = checker->zesDeviceEnumTemperatureSensorsEpilogue( hDevice, pCount, phTemperature ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumTemperatureSensors(result, hDevice, pCount, phTemperature);
         }
 
@@ -10412,16 +13872,24 @@ namespace validation_layer
         zes_temp_properties_t* pProperties              ///< [in,out] Will contain the temperature sensor properties.
         )
     {
-        context.logger->log_trace("zesTemperatureGetProperties(hTemperature, pProperties)");
+        ZEL_LOG_TRACE(context.logger, "zesTemperatureGetProperties(hTemperature, pProperties)");
 
         auto pfnGetProperties = context.zesDdiTable.Temperature.pfnGetProperties;
 
         if( nullptr == pfnGetProperties )
             return logAndPropagateResult_zesTemperatureGetProperties(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hTemperature, pProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesTemperatureGetPropertiesPrologue( hTemperature, pProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesTemperatureGetPropertiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesTemperatureGetPropertiesPrologue) {
+                auto result = checker->zesTemperatureGetPropertiesPrologue( hTemperature, pProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesTemperatureGetProperties(result, hTemperature, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesTemperatureGetPropertiesPrologue) {
+            auto result = checker->zesTemperatureGetPropertiesPrologue( hTemperature, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesTemperatureGetProperties(result, hTemperature, pProperties);
         }
 
@@ -10431,15 +13899,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesTemperatureGetPropertiesPrologue( hTemperature, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesTemperatureGetProperties(result, hTemperature, pProperties);
         }
 
         auto driver_result = pfnGetProperties( hTemperature, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesTemperatureGetPropertiesEpilogue( hTemperature, pProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesTemperatureGetPropertiesEpilogue) {
+                auto result = checker->zesTemperatureGetPropertiesEpilogue( hTemperature, pProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesTemperatureGetProperties(result, hTemperature, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesTemperatureGetPropertiesEpilogue) {
+            auto result = checker->zesTemperatureGetPropertiesEpilogue( hTemperature, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesTemperatureGetProperties(result, hTemperature, pProperties);
         }
 
@@ -10454,16 +13929,24 @@ namespace validation_layer
         zes_temp_config_t* pConfig                      ///< [in,out] Returns current configuration.
         )
     {
-        context.logger->log_trace("zesTemperatureGetConfig(hTemperature, pConfig)");
+        ZEL_LOG_TRACE(context.logger, "zesTemperatureGetConfig(hTemperature, pConfig)");
 
         auto pfnGetConfig = context.zesDdiTable.Temperature.pfnGetConfig;
 
         if( nullptr == pfnGetConfig )
             return logAndPropagateResult_zesTemperatureGetConfig(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hTemperature, pConfig);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesTemperatureGetConfigPrologue( hTemperature, pConfig );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesTemperatureGetConfigPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesTemperatureGetConfigPrologue) {
+                auto result = checker->zesTemperatureGetConfigPrologue( hTemperature, pConfig );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesTemperatureGetConfig(result, hTemperature, pConfig);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesTemperatureGetConfigPrologue) {
+            auto result = checker->zesTemperatureGetConfigPrologue( hTemperature, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesTemperatureGetConfig(result, hTemperature, pConfig);
         }
 
@@ -10473,15 +13956,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesTemperatureGetConfigPrologue( hTemperature, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesTemperatureGetConfig(result, hTemperature, pConfig);
         }
 
         auto driver_result = pfnGetConfig( hTemperature, pConfig );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesTemperatureGetConfigEpilogue( hTemperature, pConfig ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesTemperatureGetConfigEpilogue) {
+                auto result = checker->zesTemperatureGetConfigEpilogue( hTemperature, pConfig ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesTemperatureGetConfig(result, hTemperature, pConfig);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesTemperatureGetConfigEpilogue) {
+            auto result = checker->zesTemperatureGetConfigEpilogue( hTemperature, pConfig ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesTemperatureGetConfig(result, hTemperature, pConfig);
         }
 
@@ -10496,16 +13986,24 @@ namespace validation_layer
         const zes_temp_config_t* pConfig                ///< [in] New configuration.
         )
     {
-        context.logger->log_trace("zesTemperatureSetConfig(hTemperature, pConfig)");
+        ZEL_LOG_TRACE(context.logger, "zesTemperatureSetConfig(hTemperature, pConfig)");
 
         auto pfnSetConfig = context.zesDdiTable.Temperature.pfnSetConfig;
 
         if( nullptr == pfnSetConfig )
             return logAndPropagateResult_zesTemperatureSetConfig(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hTemperature, pConfig);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesTemperatureSetConfigPrologue( hTemperature, pConfig );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesTemperatureSetConfigPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesTemperatureSetConfigPrologue) {
+                auto result = checker->zesTemperatureSetConfigPrologue( hTemperature, pConfig );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesTemperatureSetConfig(result, hTemperature, pConfig);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesTemperatureSetConfigPrologue) {
+            auto result = checker->zesTemperatureSetConfigPrologue( hTemperature, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesTemperatureSetConfig(result, hTemperature, pConfig);
         }
 
@@ -10515,15 +14013,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesTemperatureSetConfigPrologue( hTemperature, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesTemperatureSetConfig(result, hTemperature, pConfig);
         }
 
         auto driver_result = pfnSetConfig( hTemperature, pConfig );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesTemperatureSetConfigEpilogue( hTemperature, pConfig ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesTemperatureSetConfigEpilogue) {
+                auto result = checker->zesTemperatureSetConfigEpilogue( hTemperature, pConfig ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesTemperatureSetConfig(result, hTemperature, pConfig);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesTemperatureSetConfigEpilogue) {
+            auto result = checker->zesTemperatureSetConfigEpilogue( hTemperature, pConfig ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesTemperatureSetConfig(result, hTemperature, pConfig);
         }
 
@@ -10539,16 +14044,24 @@ namespace validation_layer
                                                         ///< in degrees Celsius.
         )
     {
-        context.logger->log_trace("zesTemperatureGetState(hTemperature, pTemperature)");
+        ZEL_LOG_TRACE(context.logger, "zesTemperatureGetState(hTemperature, pTemperature)");
 
         auto pfnGetState = context.zesDdiTable.Temperature.pfnGetState;
 
         if( nullptr == pfnGetState )
             return logAndPropagateResult_zesTemperatureGetState(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hTemperature, pTemperature);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesTemperatureGetStatePrologue( hTemperature, pTemperature );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesTemperatureGetStatePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesTemperatureGetStatePrologue) {
+                auto result = checker->zesTemperatureGetStatePrologue( hTemperature, pTemperature );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesTemperatureGetState(result, hTemperature, pTemperature);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesTemperatureGetStatePrologue) {
+            auto result = checker->zesTemperatureGetStatePrologue( hTemperature, pTemperature );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesTemperatureGetState(result, hTemperature, pTemperature);
         }
 
@@ -10558,15 +14071,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesTemperatureGetStatePrologue( hTemperature, pTemperature );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesTemperatureGetState(result, hTemperature, pTemperature);
         }
 
         auto driver_result = pfnGetState( hTemperature, pTemperature );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesTemperatureGetStateEpilogue( hTemperature, pTemperature ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesTemperatureGetStateEpilogue) {
+                auto result = checker->zesTemperatureGetStateEpilogue( hTemperature, pTemperature ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesTemperatureGetState(result, hTemperature, pTemperature);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesTemperatureGetStateEpilogue) {
+            auto result = checker->zesTemperatureGetStateEpilogue( hTemperature, pTemperature ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesTemperatureGetState(result, hTemperature, pTemperature);
         }
 
@@ -10589,16 +14109,24 @@ namespace validation_layer
                                                         ///< number of components.
         )
     {
-        context.logger->log_trace("zesPowerGetLimitsExt(hPower, pCount, pSustained)");
+        ZEL_LOG_TRACE(context.logger, "zesPowerGetLimitsExt(hPower, pCount, pSustained)");
 
         auto pfnGetLimitsExt = context.zesDdiTable.Power.pfnGetLimitsExt;
 
         if( nullptr == pfnGetLimitsExt )
             return logAndPropagateResult_zesPowerGetLimitsExt(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hPower, pCount, pSustained);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerGetLimitsExtPrologue( hPower, pCount, pSustained );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesPowerGetLimitsExtPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPowerGetLimitsExtPrologue) {
+                auto result = checker->zesPowerGetLimitsExtPrologue( hPower, pCount, pSustained );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetLimitsExt(result, hPower, pCount, pSustained);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPowerGetLimitsExtPrologue) {
+            auto result = checker->zesPowerGetLimitsExtPrologue( hPower, pCount, pSustained );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetLimitsExt(result, hPower, pCount, pSustained);
         }
 
@@ -10608,15 +14136,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerGetLimitsExtPrologue( hPower, pCount, pSustained );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetLimitsExt(result, hPower, pCount, pSustained);
         }
 
         auto driver_result = pfnGetLimitsExt( hPower, pCount, pSustained );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerGetLimitsExtEpilogue( hPower, pCount, pSustained ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPowerGetLimitsExtEpilogue) {
+                auto result = checker->zesPowerGetLimitsExtEpilogue( hPower, pCount, pSustained ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetLimitsExt(result, hPower, pCount, pSustained);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPowerGetLimitsExtEpilogue) {
+            auto result = checker->zesPowerGetLimitsExtEpilogue( hPower, pCount, pSustained ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetLimitsExt(result, hPower, pCount, pSustained);
         }
 
@@ -10632,16 +14167,24 @@ namespace validation_layer
         zes_power_limit_ext_desc_t* pSustained          ///< [in][optional][range(0, *pCount)] Array of power limit descriptors.
         )
     {
-        context.logger->log_trace("zesPowerSetLimitsExt(hPower, pCount, pSustained)");
+        ZEL_LOG_TRACE(context.logger, "zesPowerSetLimitsExt(hPower, pCount, pSustained)");
 
         auto pfnSetLimitsExt = context.zesDdiTable.Power.pfnSetLimitsExt;
 
         if( nullptr == pfnSetLimitsExt )
             return logAndPropagateResult_zesPowerSetLimitsExt(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hPower, pCount, pSustained);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerSetLimitsExtPrologue( hPower, pCount, pSustained );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesPowerSetLimitsExtPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPowerSetLimitsExtPrologue) {
+                auto result = checker->zesPowerSetLimitsExtPrologue( hPower, pCount, pSustained );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerSetLimitsExt(result, hPower, pCount, pSustained);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPowerSetLimitsExtPrologue) {
+            auto result = checker->zesPowerSetLimitsExtPrologue( hPower, pCount, pSustained );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerSetLimitsExt(result, hPower, pCount, pSustained);
         }
 
@@ -10651,15 +14194,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerSetLimitsExtPrologue( hPower, pCount, pSustained );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerSetLimitsExt(result, hPower, pCount, pSustained);
         }
 
         auto driver_result = pfnSetLimitsExt( hPower, pCount, pSustained );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerSetLimitsExtEpilogue( hPower, pCount, pSustained ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPowerSetLimitsExtEpilogue) {
+                auto result = checker->zesPowerSetLimitsExtEpilogue( hPower, pCount, pSustained ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerSetLimitsExt(result, hPower, pCount, pSustained);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPowerSetLimitsExtEpilogue) {
+            auto result = checker->zesPowerSetLimitsExtEpilogue( hPower, pCount, pSustained ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerSetLimitsExt(result, hPower, pCount, pSustained);
         }
 
@@ -10674,16 +14224,24 @@ namespace validation_layer
         uint32_t* pLimit                                ///< [out] Returns limit value in milliwatts for given power domain.
         )
     {
-        context.logger->log_trace("zesPowerGetLimitsExt2(hPower, pLimit)");
+        ZEL_LOG_TRACE(context.logger, "zesPowerGetLimitsExt2(hPower, pLimit)");
 
         auto pfnGetLimitsExt2 = context.zesDdiTable.Power.pfnGetLimitsExt2;
 
         if( nullptr == pfnGetLimitsExt2 )
             return logAndPropagateResult_zesPowerGetLimitsExt2(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hPower, pLimit);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerGetLimitsExt2Prologue( hPower, pLimit );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesPowerGetLimitsExt2Prologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPowerGetLimitsExt2Prologue) {
+                auto result = checker->zesPowerGetLimitsExt2Prologue( hPower, pLimit );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetLimitsExt2(result, hPower, pLimit);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPowerGetLimitsExt2Prologue) {
+            auto result = checker->zesPowerGetLimitsExt2Prologue( hPower, pLimit );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetLimitsExt2(result, hPower, pLimit);
         }
 
@@ -10693,15 +14251,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerGetLimitsExt2Prologue( hPower, pLimit );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetLimitsExt2(result, hPower, pLimit);
         }
 
         auto driver_result = pfnGetLimitsExt2( hPower, pLimit );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerGetLimitsExt2Epilogue( hPower, pLimit ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPowerGetLimitsExt2Epilogue) {
+                auto result = checker->zesPowerGetLimitsExt2Epilogue( hPower, pLimit ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetLimitsExt2(result, hPower, pLimit);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPowerGetLimitsExt2Epilogue) {
+            auto result = checker->zesPowerGetLimitsExt2Epilogue( hPower, pLimit ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerGetLimitsExt2(result, hPower, pLimit);
         }
 
@@ -10716,16 +14281,24 @@ namespace validation_layer
         const uint32_t limit                            ///< [in] Limit value in milliwatts to be set for given power domain.
         )
     {
-        context.logger->log_trace("zesPowerSetLimitsExt2(hPower, limit)");
+        ZEL_LOG_TRACE(context.logger, "zesPowerSetLimitsExt2(hPower, limit)");
 
         auto pfnSetLimitsExt2 = context.zesDdiTable.Power.pfnSetLimitsExt2;
 
         if( nullptr == pfnSetLimitsExt2 )
             return logAndPropagateResult_zesPowerSetLimitsExt2(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hPower, limit);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerSetLimitsExt2Prologue( hPower, limit );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesPowerSetLimitsExt2Prologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPowerSetLimitsExt2Prologue) {
+                auto result = checker->zesPowerSetLimitsExt2Prologue( hPower, limit );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerSetLimitsExt2(result, hPower, limit);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPowerSetLimitsExt2Prologue) {
+            auto result = checker->zesPowerSetLimitsExt2Prologue( hPower, limit );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerSetLimitsExt2(result, hPower, limit);
         }
 
@@ -10735,15 +14308,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerSetLimitsExt2Prologue( hPower, limit );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerSetLimitsExt2(result, hPower, limit);
         }
 
         auto driver_result = pfnSetLimitsExt2( hPower, limit );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerSetLimitsExt2Epilogue( hPower, limit ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesPowerSetLimitsExt2Epilogue) {
+                auto result = checker->zesPowerSetLimitsExt2Epilogue( hPower, limit ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerSetLimitsExt2(result, hPower, limit);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesPowerSetLimitsExt2Epilogue) {
+            auto result = checker->zesPowerSetLimitsExt2Epilogue( hPower, limit ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesPowerSetLimitsExt2(result, hPower, limit);
         }
 
@@ -10771,16 +14351,24 @@ namespace validation_layer
                                                         ///< of VF engine stats.
         )
     {
-        context.logger->log_trace("zesEngineGetActivityExt(hEngine, pCount, pStats)");
+        ZEL_LOG_TRACE(context.logger, "zesEngineGetActivityExt(hEngine, pCount, pStats)");
 
         auto pfnGetActivityExt = context.zesDdiTable.Engine.pfnGetActivityExt;
 
         if( nullptr == pfnGetActivityExt )
             return logAndPropagateResult_zesEngineGetActivityExt(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hEngine, pCount, pStats);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesEngineGetActivityExtPrologue( hEngine, pCount, pStats );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesEngineGetActivityExtPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesEngineGetActivityExtPrologue) {
+                auto result = checker->zesEngineGetActivityExtPrologue( hEngine, pCount, pStats );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesEngineGetActivityExt(result, hEngine, pCount, pStats);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesEngineGetActivityExtPrologue) {
+            auto result = checker->zesEngineGetActivityExtPrologue( hEngine, pCount, pStats );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesEngineGetActivityExt(result, hEngine, pCount, pStats);
         }
 
@@ -10790,15 +14378,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesEngineGetActivityExtPrologue( hEngine, pCount, pStats );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesEngineGetActivityExt(result, hEngine, pCount, pStats);
         }
 
         auto driver_result = pfnGetActivityExt( hEngine, pCount, pStats );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesEngineGetActivityExtEpilogue( hEngine, pCount, pStats ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesEngineGetActivityExtEpilogue) {
+                auto result = checker->zesEngineGetActivityExtEpilogue( hEngine, pCount, pStats ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesEngineGetActivityExt(result, hEngine, pCount, pStats);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesEngineGetActivityExtEpilogue) {
+            auto result = checker->zesEngineGetActivityExtEpilogue( hEngine, pCount, pStats ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesEngineGetActivityExt(result, hEngine, pCount, pStats);
         }
 
@@ -10821,16 +14416,24 @@ namespace validation_layer
                                                         ///< shall only retrieve that number of RAS states.
         )
     {
-        context.logger->log_trace("zesRasGetStateExp(hRas, pCount, pState)");
+        ZEL_LOG_TRACE(context.logger, "zesRasGetStateExp(hRas, pCount, pState)");
 
         auto pfnGetStateExp = context.zesDdiTable.RasExp.pfnGetStateExp;
 
         if( nullptr == pfnGetStateExp )
             return logAndPropagateResult_zesRasGetStateExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hRas, pCount, pState);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasGetStateExpPrologue( hRas, pCount, pState );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesRasGetStateExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesRasGetStateExpPrologue) {
+                auto result = checker->zesRasGetStateExpPrologue( hRas, pCount, pState );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetStateExp(result, hRas, pCount, pState);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesRasGetStateExpPrologue) {
+            auto result = checker->zesRasGetStateExpPrologue( hRas, pCount, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetStateExp(result, hRas, pCount, pState);
         }
 
@@ -10840,15 +14443,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesRasGetStateExpPrologue( hRas, pCount, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetStateExp(result, hRas, pCount, pState);
         }
 
         auto driver_result = pfnGetStateExp( hRas, pCount, pState );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasGetStateExpEpilogue( hRas, pCount, pState ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesRasGetStateExpEpilogue) {
+                auto result = checker->zesRasGetStateExpEpilogue( hRas, pCount, pState ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetStateExp(result, hRas, pCount, pState);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesRasGetStateExpEpilogue) {
+            auto result = checker->zesRasGetStateExpEpilogue( hRas, pCount, pState ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetStateExp(result, hRas, pCount, pState);
         }
 
@@ -10867,16 +14477,24 @@ namespace validation_layer
         zes_ras_error_category_exp_t category           ///< [in] category for which error counter is to be cleared.
         )
     {
-        context.logger->log_trace("zesRasClearStateExp(hRas, category)");
+        ZEL_LOG_TRACE(context.logger, "zesRasClearStateExp(hRas, category)");
 
         auto pfnClearStateExp = context.zesDdiTable.RasExp.pfnClearStateExp;
 
         if( nullptr == pfnClearStateExp )
             return logAndPropagateResult_zesRasClearStateExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hRas, category);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasClearStateExpPrologue( hRas, category );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesRasClearStateExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesRasClearStateExpPrologue) {
+                auto result = checker->zesRasClearStateExpPrologue( hRas, category );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasClearStateExp(result, hRas, category);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesRasClearStateExpPrologue) {
+            auto result = checker->zesRasClearStateExpPrologue( hRas, category );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasClearStateExp(result, hRas, category);
         }
 
@@ -10886,15 +14504,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesRasClearStateExpPrologue( hRas, category );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasClearStateExp(result, hRas, category);
         }
 
         auto driver_result = pfnClearStateExp( hRas, category );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasClearStateExpEpilogue( hRas, category ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesRasClearStateExpEpilogue) {
+                auto result = checker->zesRasClearStateExpEpilogue( hRas, category ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasClearStateExp(result, hRas, category);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesRasClearStateExpEpilogue) {
+            auto result = checker->zesRasClearStateExpEpilogue( hRas, category ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasClearStateExp(result, hRas, category);
         }
 
@@ -10915,16 +14540,24 @@ namespace validation_layer
                                                         ///< shall only retrieve that number of categories.
         )
     {
-        context.logger->log_trace("zesRasGetSupportedCategoriesExp(hRas, pCount, pCategories)");
+        ZEL_LOG_TRACE(context.logger, "zesRasGetSupportedCategoriesExp(hRas, pCount, pCategories)");
 
         auto pfnGetSupportedCategoriesExp = context.zesDdiTable.RasExp.pfnGetSupportedCategoriesExp;
 
         if( nullptr == pfnGetSupportedCategoriesExp )
             return logAndPropagateResult_zesRasGetSupportedCategoriesExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hRas, pCount, pCategories);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasGetSupportedCategoriesExpPrologue( hRas, pCount, pCategories );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesRasGetSupportedCategoriesExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesRasGetSupportedCategoriesExpPrologue) {
+                auto result = checker->zesRasGetSupportedCategoriesExpPrologue( hRas, pCount, pCategories );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetSupportedCategoriesExp(result, hRas, pCount, pCategories);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesRasGetSupportedCategoriesExpPrologue) {
+            auto result = checker->zesRasGetSupportedCategoriesExpPrologue( hRas, pCount, pCategories );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetSupportedCategoriesExp(result, hRas, pCount, pCategories);
         }
 
@@ -10934,15 +14567,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesRasGetSupportedCategoriesExpPrologue( hRas, pCount, pCategories );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetSupportedCategoriesExp(result, hRas, pCount, pCategories);
         }
 
         auto driver_result = pfnGetSupportedCategoriesExp( hRas, pCount, pCategories );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasGetSupportedCategoriesExpEpilogue( hRas, pCount, pCategories ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesRasGetSupportedCategoriesExpEpilogue) {
+                auto result = checker->zesRasGetSupportedCategoriesExpEpilogue( hRas, pCount, pCategories ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetSupportedCategoriesExp(result, hRas, pCount, pCategories);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesRasGetSupportedCategoriesExpEpilogue) {
+            auto result = checker->zesRasGetSupportedCategoriesExpEpilogue( hRas, pCount, pCategories ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetSupportedCategoriesExp(result, hRas, pCount, pCategories);
         }
 
@@ -10964,16 +14604,24 @@ namespace validation_layer
                                                         ///< initialize stype and pNext for each element.
         )
     {
-        context.logger->log_trace("zesRasGetStateExp2(hRas, count, pCategories, pState)");
+        ZEL_LOG_TRACE(context.logger, "zesRasGetStateExp2(hRas, count, pCategories, pState)");
 
         auto pfnGetStateExp2 = context.zesDdiTable.RasExp.pfnGetStateExp2;
 
         if( nullptr == pfnGetStateExp2 )
             return logAndPropagateResult_zesRasGetStateExp2(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hRas, count, pCategories, pState);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasGetStateExp2Prologue( hRas, count, pCategories, pState );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesRasGetStateExp2Prologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesRasGetStateExp2Prologue) {
+                auto result = checker->zesRasGetStateExp2Prologue( hRas, count, pCategories, pState );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetStateExp2(result, hRas, count, pCategories, pState);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesRasGetStateExp2Prologue) {
+            auto result = checker->zesRasGetStateExp2Prologue( hRas, count, pCategories, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetStateExp2(result, hRas, count, pCategories, pState);
         }
 
@@ -10983,15 +14631,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesRasGetStateExp2Prologue( hRas, count, pCategories, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetStateExp2(result, hRas, count, pCategories, pState);
         }
 
         auto driver_result = pfnGetStateExp2( hRas, count, pCategories, pState );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasGetStateExp2Epilogue( hRas, count, pCategories, pState ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesRasGetStateExp2Epilogue) {
+                auto result = checker->zesRasGetStateExp2Epilogue( hRas, count, pCategories, pState ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetStateExp2(result, hRas, count, pCategories, pState);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesRasGetStateExp2Epilogue) {
+            auto result = checker->zesRasGetStateExp2Epilogue( hRas, count, pCategories, pState ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetStateExp2(result, hRas, count, pCategories, pState);
         }
 
@@ -11009,16 +14664,24 @@ namespace validation_layer
                                                         ///< which categories to query.
         )
     {
-        context.logger->log_trace("zesRasGetConfigExp(hRas, count, pConfig)");
+        ZEL_LOG_TRACE(context.logger, "zesRasGetConfigExp(hRas, count, pConfig)");
 
         auto pfnGetConfigExp = context.zesDdiTable.RasExp.pfnGetConfigExp;
 
         if( nullptr == pfnGetConfigExp )
             return logAndPropagateResult_zesRasGetConfigExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hRas, count, pConfig);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasGetConfigExpPrologue( hRas, count, pConfig );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesRasGetConfigExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesRasGetConfigExpPrologue) {
+                auto result = checker->zesRasGetConfigExpPrologue( hRas, count, pConfig );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetConfigExp(result, hRas, count, pConfig);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesRasGetConfigExpPrologue) {
+            auto result = checker->zesRasGetConfigExpPrologue( hRas, count, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetConfigExp(result, hRas, count, pConfig);
         }
 
@@ -11028,15 +14691,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesRasGetConfigExpPrologue( hRas, count, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetConfigExp(result, hRas, count, pConfig);
         }
 
         auto driver_result = pfnGetConfigExp( hRas, count, pConfig );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasGetConfigExpEpilogue( hRas, count, pConfig ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesRasGetConfigExpEpilogue) {
+                auto result = checker->zesRasGetConfigExpEpilogue( hRas, count, pConfig ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetConfigExp(result, hRas, count, pConfig);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesRasGetConfigExpEpilogue) {
+            auto result = checker->zesRasGetConfigExpEpilogue( hRas, count, pConfig ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasGetConfigExp(result, hRas, count, pConfig);
         }
 
@@ -11057,16 +14727,24 @@ namespace validation_layer
                                                         ///< thresholds for different error categories.
         )
     {
-        context.logger->log_trace("zesRasSetConfigExp(hRas, count, pConfig)");
+        ZEL_LOG_TRACE(context.logger, "zesRasSetConfigExp(hRas, count, pConfig)");
 
         auto pfnSetConfigExp = context.zesDdiTable.RasExp.pfnSetConfigExp;
 
         if( nullptr == pfnSetConfigExp )
             return logAndPropagateResult_zesRasSetConfigExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hRas, count, pConfig);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasSetConfigExpPrologue( hRas, count, pConfig );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesRasSetConfigExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesRasSetConfigExpPrologue) {
+                auto result = checker->zesRasSetConfigExpPrologue( hRas, count, pConfig );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasSetConfigExp(result, hRas, count, pConfig);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesRasSetConfigExpPrologue) {
+            auto result = checker->zesRasSetConfigExpPrologue( hRas, count, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasSetConfigExp(result, hRas, count, pConfig);
         }
 
@@ -11076,15 +14754,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesRasSetConfigExpPrologue( hRas, count, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasSetConfigExp(result, hRas, count, pConfig);
         }
 
         auto driver_result = pfnSetConfigExp( hRas, count, pConfig );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasSetConfigExpEpilogue( hRas, count, pConfig ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesRasSetConfigExpEpilogue) {
+                auto result = checker->zesRasSetConfigExpEpilogue( hRas, count, pConfig ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasSetConfigExp(result, hRas, count, pConfig);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesRasSetConfigExpEpilogue) {
+            auto result = checker->zesRasSetConfigExpEpilogue( hRas, count, pConfig ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesRasSetConfigExp(result, hRas, count, pConfig);
         }
 
@@ -11100,16 +14785,24 @@ namespace validation_layer
                                                         ///< returned if this property cannot be determined.
         )
     {
-        context.logger->log_trace("zesFirmwareGetSecurityVersionExp(hFirmware, pVersion)");
+        ZEL_LOG_TRACE(context.logger, "zesFirmwareGetSecurityVersionExp(hFirmware, pVersion)");
 
         auto pfnGetSecurityVersionExp = context.zesDdiTable.FirmwareExp.pfnGetSecurityVersionExp;
 
         if( nullptr == pfnGetSecurityVersionExp )
             return logAndPropagateResult_zesFirmwareGetSecurityVersionExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFirmware, pVersion);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFirmwareGetSecurityVersionExpPrologue( hFirmware, pVersion );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFirmwareGetSecurityVersionExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFirmwareGetSecurityVersionExpPrologue) {
+                auto result = checker->zesFirmwareGetSecurityVersionExpPrologue( hFirmware, pVersion );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareGetSecurityVersionExp(result, hFirmware, pVersion);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFirmwareGetSecurityVersionExpPrologue) {
+            auto result = checker->zesFirmwareGetSecurityVersionExpPrologue( hFirmware, pVersion );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareGetSecurityVersionExp(result, hFirmware, pVersion);
         }
 
@@ -11119,15 +14812,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFirmwareGetSecurityVersionExpPrologue( hFirmware, pVersion );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareGetSecurityVersionExp(result, hFirmware, pVersion);
         }
 
         auto driver_result = pfnGetSecurityVersionExp( hFirmware, pVersion );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFirmwareGetSecurityVersionExpEpilogue( hFirmware, pVersion ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFirmwareGetSecurityVersionExpEpilogue) {
+                auto result = checker->zesFirmwareGetSecurityVersionExpEpilogue( hFirmware, pVersion ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareGetSecurityVersionExp(result, hFirmware, pVersion);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFirmwareGetSecurityVersionExpEpilogue) {
+            auto result = checker->zesFirmwareGetSecurityVersionExpEpilogue( hFirmware, pVersion ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareGetSecurityVersionExp(result, hFirmware, pVersion);
         }
 
@@ -11145,16 +14845,24 @@ namespace validation_layer
         zes_firmware_handle_t hFirmware                 ///< [in] Handle for the component.
         )
     {
-        context.logger->log_trace("zesFirmwareSetSecurityVersionExp(hFirmware)");
+        ZEL_LOG_TRACE(context.logger, "zesFirmwareSetSecurityVersionExp(hFirmware)");
 
         auto pfnSetSecurityVersionExp = context.zesDdiTable.FirmwareExp.pfnSetSecurityVersionExp;
 
         if( nullptr == pfnSetSecurityVersionExp )
             return logAndPropagateResult_zesFirmwareSetSecurityVersionExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hFirmware);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFirmwareSetSecurityVersionExpPrologue( hFirmware );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesFirmwareSetSecurityVersionExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFirmwareSetSecurityVersionExpPrologue) {
+                auto result = checker->zesFirmwareSetSecurityVersionExpPrologue( hFirmware );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareSetSecurityVersionExp(result, hFirmware);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFirmwareSetSecurityVersionExpPrologue) {
+            auto result = checker->zesFirmwareSetSecurityVersionExpPrologue( hFirmware );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareSetSecurityVersionExp(result, hFirmware);
         }
 
@@ -11164,15 +14872,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFirmwareSetSecurityVersionExpPrologue( hFirmware );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareSetSecurityVersionExp(result, hFirmware);
         }
 
         auto driver_result = pfnSetSecurityVersionExp( hFirmware );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFirmwareSetSecurityVersionExpEpilogue( hFirmware ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesFirmwareSetSecurityVersionExpEpilogue) {
+                auto result = checker->zesFirmwareSetSecurityVersionExpEpilogue( hFirmware ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareSetSecurityVersionExp(result, hFirmware);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesFirmwareSetSecurityVersionExpEpilogue) {
+            auto result = checker->zesFirmwareSetSecurityVersionExpEpilogue( hFirmware ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesFirmwareSetSecurityVersionExp(result, hFirmware);
         }
 
@@ -11195,16 +14910,24 @@ namespace validation_layer
                                                         ///< the driver shall only retrieve that number of sub device property structures.
         )
     {
-        context.logger->log_trace("zesDeviceGetSubDevicePropertiesExp(hDevice, pCount, pSubdeviceProps)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceGetSubDevicePropertiesExp(hDevice, pCount, pSubdeviceProps)");
 
         auto pfnGetSubDevicePropertiesExp = context.zesDdiTable.DeviceExp.pfnGetSubDevicePropertiesExp;
 
         if( nullptr == pfnGetSubDevicePropertiesExp )
             return logAndPropagateResult_zesDeviceGetSubDevicePropertiesExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pCount, pSubdeviceProps);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetSubDevicePropertiesExpPrologue( hDevice, pCount, pSubdeviceProps );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceGetSubDevicePropertiesExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceGetSubDevicePropertiesExpPrologue) {
+                auto result = checker->zesDeviceGetSubDevicePropertiesExpPrologue( hDevice, pCount, pSubdeviceProps );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetSubDevicePropertiesExp(result, hDevice, pCount, pSubdeviceProps);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceGetSubDevicePropertiesExpPrologue) {
+            auto result = checker->zesDeviceGetSubDevicePropertiesExpPrologue( hDevice, pCount, pSubdeviceProps );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetSubDevicePropertiesExp(result, hDevice, pCount, pSubdeviceProps);
         }
 
@@ -11214,15 +14937,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetSubDevicePropertiesExpPrologue( hDevice, pCount, pSubdeviceProps );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetSubDevicePropertiesExp(result, hDevice, pCount, pSubdeviceProps);
         }
 
         auto driver_result = pfnGetSubDevicePropertiesExp( hDevice, pCount, pSubdeviceProps );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetSubDevicePropertiesExpEpilogue( hDevice, pCount, pSubdeviceProps ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceGetSubDevicePropertiesExpEpilogue) {
+                auto result = checker->zesDeviceGetSubDevicePropertiesExpEpilogue( hDevice, pCount, pSubdeviceProps ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetSubDevicePropertiesExp(result, hDevice, pCount, pSubdeviceProps);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceGetSubDevicePropertiesExpEpilogue) {
+            auto result = checker->zesDeviceGetSubDevicePropertiesExpEpilogue( hDevice, pCount, pSubdeviceProps ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceGetSubDevicePropertiesExp(result, hDevice, pCount, pSubdeviceProps);
         }
 
@@ -11245,16 +14975,24 @@ namespace validation_layer
         uint32_t* subdeviceId                           ///< [out] If onSubdevice is true, this gives the ID of the sub-device
         )
     {
-        context.logger->log_trace("zesDriverGetDeviceByUuidExp(hDriver, uuid, phDevice, onSubdevice, subdeviceId)");
+        ZEL_LOG_TRACE(context.logger, "zesDriverGetDeviceByUuidExp(hDriver, uuid, phDevice, onSubdevice, subdeviceId)");
 
         auto pfnGetDeviceByUuidExp = context.zesDdiTable.DriverExp.pfnGetDeviceByUuidExp;
 
         if( nullptr == pfnGetDeviceByUuidExp )
             return logAndPropagateResult_zesDriverGetDeviceByUuidExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDriver, uuid, phDevice, onSubdevice, subdeviceId);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDriverGetDeviceByUuidExpPrologue( hDriver, uuid, phDevice, onSubdevice, subdeviceId );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDriverGetDeviceByUuidExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDriverGetDeviceByUuidExpPrologue) {
+                auto result = checker->zesDriverGetDeviceByUuidExpPrologue( hDriver, uuid, phDevice, onSubdevice, subdeviceId );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverGetDeviceByUuidExp(result, hDriver, uuid, phDevice, onSubdevice, subdeviceId);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDriverGetDeviceByUuidExpPrologue) {
+            auto result = checker->zesDriverGetDeviceByUuidExpPrologue( hDriver, uuid, phDevice, onSubdevice, subdeviceId );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverGetDeviceByUuidExp(result, hDriver, uuid, phDevice, onSubdevice, subdeviceId);
         }
 
@@ -11264,15 +15002,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDriverGetDeviceByUuidExpPrologue( hDriver, uuid, phDevice, onSubdevice, subdeviceId );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverGetDeviceByUuidExp(result, hDriver, uuid, phDevice, onSubdevice, subdeviceId);
         }
 
         auto driver_result = pfnGetDeviceByUuidExp( hDriver, uuid, phDevice, onSubdevice, subdeviceId );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDriverGetDeviceByUuidExpEpilogue( hDriver, uuid, phDevice, onSubdevice, subdeviceId ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDriverGetDeviceByUuidExpEpilogue) {
+                auto result = checker->zesDriverGetDeviceByUuidExpEpilogue( hDriver, uuid, phDevice, onSubdevice, subdeviceId ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverGetDeviceByUuidExp(result, hDriver, uuid, phDevice, onSubdevice, subdeviceId);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDriverGetDeviceByUuidExpEpilogue) {
+            auto result = checker->zesDriverGetDeviceByUuidExpEpilogue( hDriver, uuid, phDevice, onSubdevice, subdeviceId ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDriverGetDeviceByUuidExp(result, hDriver, uuid, phDevice, onSubdevice, subdeviceId);
         }
 
@@ -11306,16 +15051,24 @@ namespace validation_layer
                                                         ///< component handles.
         )
     {
-        context.logger->log_trace("zesDeviceEnumActiveVFExp(hDevice, pCount, phVFhandle)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceEnumActiveVFExp(hDevice, pCount, phVFhandle)");
 
         auto pfnEnumActiveVFExp = context.zesDdiTable.DeviceExp.pfnEnumActiveVFExp;
 
         if( nullptr == pfnEnumActiveVFExp )
             return logAndPropagateResult_zesDeviceEnumActiveVFExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pCount, phVFhandle);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumActiveVFExpPrologue( hDevice, pCount, phVFhandle );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceEnumActiveVFExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumActiveVFExpPrologue) {
+                auto result = checker->zesDeviceEnumActiveVFExpPrologue( hDevice, pCount, phVFhandle );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumActiveVFExp(result, hDevice, pCount, phVFhandle);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumActiveVFExpPrologue) {
+            auto result = checker->zesDeviceEnumActiveVFExpPrologue( hDevice, pCount, phVFhandle );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumActiveVFExp(result, hDevice, pCount, phVFhandle);
         }
 
@@ -11325,15 +15078,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumActiveVFExpPrologue( hDevice, pCount, phVFhandle );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumActiveVFExp(result, hDevice, pCount, phVFhandle);
         }
 
         auto driver_result = pfnEnumActiveVFExp( hDevice, pCount, phVFhandle );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumActiveVFExpEpilogue( hDevice, pCount, phVFhandle ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumActiveVFExpEpilogue) {
+                auto result = checker->zesDeviceEnumActiveVFExpEpilogue( hDevice, pCount, phVFhandle ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumActiveVFExp(result, hDevice, pCount, phVFhandle);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumActiveVFExpEpilogue) {
+            auto result = checker->zesDeviceEnumActiveVFExpEpilogue( hDevice, pCount, phVFhandle ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumActiveVFExp(result, hDevice, pCount, phVFhandle);
         }
 
@@ -11348,16 +15108,24 @@ namespace validation_layer
         zes_vf_exp_properties_t* pProperties            ///< [in,out] Will contain VF properties.
         )
     {
-        context.logger->log_trace("zesVFManagementGetVFPropertiesExp(hVFhandle, pProperties)");
+        ZEL_LOG_TRACE(context.logger, "zesVFManagementGetVFPropertiesExp(hVFhandle, pProperties)");
 
         auto pfnGetVFPropertiesExp = context.zesDdiTable.VFManagementExp.pfnGetVFPropertiesExp;
 
         if( nullptr == pfnGetVFPropertiesExp )
             return logAndPropagateResult_zesVFManagementGetVFPropertiesExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hVFhandle, pProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFPropertiesExpPrologue( hVFhandle, pProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesVFManagementGetVFPropertiesExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesVFManagementGetVFPropertiesExpPrologue) {
+                auto result = checker->zesVFManagementGetVFPropertiesExpPrologue( hVFhandle, pProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFPropertiesExp(result, hVFhandle, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesVFManagementGetVFPropertiesExpPrologue) {
+            auto result = checker->zesVFManagementGetVFPropertiesExpPrologue( hVFhandle, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFPropertiesExp(result, hVFhandle, pProperties);
         }
 
@@ -11367,15 +15135,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementGetVFPropertiesExpPrologue( hVFhandle, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFPropertiesExp(result, hVFhandle, pProperties);
         }
 
         auto driver_result = pfnGetVFPropertiesExp( hVFhandle, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFPropertiesExpEpilogue( hVFhandle, pProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesVFManagementGetVFPropertiesExpEpilogue) {
+                auto result = checker->zesVFManagementGetVFPropertiesExpEpilogue( hVFhandle, pProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFPropertiesExp(result, hVFhandle, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesVFManagementGetVFPropertiesExpEpilogue) {
+            auto result = checker->zesVFManagementGetVFPropertiesExpEpilogue( hVFhandle, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFPropertiesExp(result, hVFhandle, pProperties);
         }
 
@@ -11406,16 +15181,24 @@ namespace validation_layer
                                                         ///< memory stats.
         )
     {
-        context.logger->log_trace("zesVFManagementGetVFMemoryUtilizationExp(hVFhandle, pCount, pMemUtil)");
+        ZEL_LOG_TRACE(context.logger, "zesVFManagementGetVFMemoryUtilizationExp(hVFhandle, pCount, pMemUtil)");
 
         auto pfnGetVFMemoryUtilizationExp = context.zesDdiTable.VFManagementExp.pfnGetVFMemoryUtilizationExp;
 
         if( nullptr == pfnGetVFMemoryUtilizationExp )
             return logAndPropagateResult_zesVFManagementGetVFMemoryUtilizationExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hVFhandle, pCount, pMemUtil);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFMemoryUtilizationExpPrologue( hVFhandle, pCount, pMemUtil );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesVFManagementGetVFMemoryUtilizationExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesVFManagementGetVFMemoryUtilizationExpPrologue) {
+                auto result = checker->zesVFManagementGetVFMemoryUtilizationExpPrologue( hVFhandle, pCount, pMemUtil );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFMemoryUtilizationExp(result, hVFhandle, pCount, pMemUtil);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesVFManagementGetVFMemoryUtilizationExpPrologue) {
+            auto result = checker->zesVFManagementGetVFMemoryUtilizationExpPrologue( hVFhandle, pCount, pMemUtil );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFMemoryUtilizationExp(result, hVFhandle, pCount, pMemUtil);
         }
 
@@ -11425,15 +15208,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementGetVFMemoryUtilizationExpPrologue( hVFhandle, pCount, pMemUtil );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFMemoryUtilizationExp(result, hVFhandle, pCount, pMemUtil);
         }
 
         auto driver_result = pfnGetVFMemoryUtilizationExp( hVFhandle, pCount, pMemUtil );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFMemoryUtilizationExpEpilogue( hVFhandle, pCount, pMemUtil ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesVFManagementGetVFMemoryUtilizationExpEpilogue) {
+                auto result = checker->zesVFManagementGetVFMemoryUtilizationExpEpilogue( hVFhandle, pCount, pMemUtil ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFMemoryUtilizationExp(result, hVFhandle, pCount, pMemUtil);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesVFManagementGetVFMemoryUtilizationExpEpilogue) {
+            auto result = checker->zesVFManagementGetVFMemoryUtilizationExpEpilogue( hVFhandle, pCount, pMemUtil ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFMemoryUtilizationExp(result, hVFhandle, pCount, pMemUtil);
         }
 
@@ -11464,16 +15254,24 @@ namespace validation_layer
                                                         ///< engine stats.
         )
     {
-        context.logger->log_trace("zesVFManagementGetVFEngineUtilizationExp(hVFhandle, pCount, pEngineUtil)");
+        ZEL_LOG_TRACE(context.logger, "zesVFManagementGetVFEngineUtilizationExp(hVFhandle, pCount, pEngineUtil)");
 
         auto pfnGetVFEngineUtilizationExp = context.zesDdiTable.VFManagementExp.pfnGetVFEngineUtilizationExp;
 
         if( nullptr == pfnGetVFEngineUtilizationExp )
             return logAndPropagateResult_zesVFManagementGetVFEngineUtilizationExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hVFhandle, pCount, pEngineUtil);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFEngineUtilizationExpPrologue( hVFhandle, pCount, pEngineUtil );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesVFManagementGetVFEngineUtilizationExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesVFManagementGetVFEngineUtilizationExpPrologue) {
+                auto result = checker->zesVFManagementGetVFEngineUtilizationExpPrologue( hVFhandle, pCount, pEngineUtil );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFEngineUtilizationExp(result, hVFhandle, pCount, pEngineUtil);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesVFManagementGetVFEngineUtilizationExpPrologue) {
+            auto result = checker->zesVFManagementGetVFEngineUtilizationExpPrologue( hVFhandle, pCount, pEngineUtil );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFEngineUtilizationExp(result, hVFhandle, pCount, pEngineUtil);
         }
 
@@ -11483,15 +15281,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementGetVFEngineUtilizationExpPrologue( hVFhandle, pCount, pEngineUtil );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFEngineUtilizationExp(result, hVFhandle, pCount, pEngineUtil);
         }
 
         auto driver_result = pfnGetVFEngineUtilizationExp( hVFhandle, pCount, pEngineUtil );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFEngineUtilizationExpEpilogue( hVFhandle, pCount, pEngineUtil ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesVFManagementGetVFEngineUtilizationExpEpilogue) {
+                auto result = checker->zesVFManagementGetVFEngineUtilizationExpEpilogue( hVFhandle, pCount, pEngineUtil ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFEngineUtilizationExp(result, hVFhandle, pCount, pEngineUtil);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesVFManagementGetVFEngineUtilizationExpEpilogue) {
+            auto result = checker->zesVFManagementGetVFEngineUtilizationExpEpilogue( hVFhandle, pCount, pEngineUtil ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFEngineUtilizationExp(result, hVFhandle, pCount, pEngineUtil);
         }
 
@@ -11512,16 +15317,24 @@ namespace validation_layer
         ze_bool_t enable                                ///< [in] Enable utilization telemetry.
         )
     {
-        context.logger->log_trace("zesVFManagementSetVFTelemetryModeExp(hVFhandle, flags, enable)");
+        ZEL_LOG_TRACE(context.logger, "zesVFManagementSetVFTelemetryModeExp(hVFhandle, flags, enable)");
 
         auto pfnSetVFTelemetryModeExp = context.zesDdiTable.VFManagementExp.pfnSetVFTelemetryModeExp;
 
         if( nullptr == pfnSetVFTelemetryModeExp )
             return logAndPropagateResult_zesVFManagementSetVFTelemetryModeExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hVFhandle, flags, enable);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementSetVFTelemetryModeExpPrologue( hVFhandle, flags, enable );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesVFManagementSetVFTelemetryModeExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesVFManagementSetVFTelemetryModeExpPrologue) {
+                auto result = checker->zesVFManagementSetVFTelemetryModeExpPrologue( hVFhandle, flags, enable );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementSetVFTelemetryModeExp(result, hVFhandle, flags, enable);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesVFManagementSetVFTelemetryModeExpPrologue) {
+            auto result = checker->zesVFManagementSetVFTelemetryModeExpPrologue( hVFhandle, flags, enable );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementSetVFTelemetryModeExp(result, hVFhandle, flags, enable);
         }
 
@@ -11531,15 +15344,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementSetVFTelemetryModeExpPrologue( hVFhandle, flags, enable );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementSetVFTelemetryModeExp(result, hVFhandle, flags, enable);
         }
 
         auto driver_result = pfnSetVFTelemetryModeExp( hVFhandle, flags, enable );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementSetVFTelemetryModeExpEpilogue( hVFhandle, flags, enable ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesVFManagementSetVFTelemetryModeExpEpilogue) {
+                auto result = checker->zesVFManagementSetVFTelemetryModeExpEpilogue( hVFhandle, flags, enable ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementSetVFTelemetryModeExp(result, hVFhandle, flags, enable);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesVFManagementSetVFTelemetryModeExpEpilogue) {
+            auto result = checker->zesVFManagementSetVFTelemetryModeExpEpilogue( hVFhandle, flags, enable ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementSetVFTelemetryModeExp(result, hVFhandle, flags, enable);
         }
 
@@ -11556,16 +15376,24 @@ namespace validation_layer
         uint64_t samplingInterval                       ///< [in] Sampling interval value.
         )
     {
-        context.logger->log_trace("zesVFManagementSetVFTelemetrySamplingIntervalExp(hVFhandle, flag, samplingInterval)");
+        ZEL_LOG_TRACE(context.logger, "zesVFManagementSetVFTelemetrySamplingIntervalExp(hVFhandle, flag, samplingInterval)");
 
         auto pfnSetVFTelemetrySamplingIntervalExp = context.zesDdiTable.VFManagementExp.pfnSetVFTelemetrySamplingIntervalExp;
 
         if( nullptr == pfnSetVFTelemetrySamplingIntervalExp )
             return logAndPropagateResult_zesVFManagementSetVFTelemetrySamplingIntervalExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hVFhandle, flag, samplingInterval);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementSetVFTelemetrySamplingIntervalExpPrologue( hVFhandle, flag, samplingInterval );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesVFManagementSetVFTelemetrySamplingIntervalExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesVFManagementSetVFTelemetrySamplingIntervalExpPrologue) {
+                auto result = checker->zesVFManagementSetVFTelemetrySamplingIntervalExpPrologue( hVFhandle, flag, samplingInterval );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementSetVFTelemetrySamplingIntervalExp(result, hVFhandle, flag, samplingInterval);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesVFManagementSetVFTelemetrySamplingIntervalExpPrologue) {
+            auto result = checker->zesVFManagementSetVFTelemetrySamplingIntervalExpPrologue( hVFhandle, flag, samplingInterval );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementSetVFTelemetrySamplingIntervalExp(result, hVFhandle, flag, samplingInterval);
         }
 
@@ -11575,15 +15403,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementSetVFTelemetrySamplingIntervalExpPrologue( hVFhandle, flag, samplingInterval );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementSetVFTelemetrySamplingIntervalExp(result, hVFhandle, flag, samplingInterval);
         }
 
         auto driver_result = pfnSetVFTelemetrySamplingIntervalExp( hVFhandle, flag, samplingInterval );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementSetVFTelemetrySamplingIntervalExpEpilogue( hVFhandle, flag, samplingInterval ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesVFManagementSetVFTelemetrySamplingIntervalExpEpilogue) {
+                auto result = checker->zesVFManagementSetVFTelemetrySamplingIntervalExpEpilogue( hVFhandle, flag, samplingInterval ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementSetVFTelemetrySamplingIntervalExp(result, hVFhandle, flag, samplingInterval);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesVFManagementSetVFTelemetrySamplingIntervalExpEpilogue) {
+            auto result = checker->zesVFManagementSetVFTelemetrySamplingIntervalExpEpilogue( hVFhandle, flag, samplingInterval ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementSetVFTelemetrySamplingIntervalExp(result, hVFhandle, flag, samplingInterval);
         }
 
@@ -11608,16 +15443,24 @@ namespace validation_layer
                                                         ///< component handles.
         )
     {
-        context.logger->log_trace("zesDeviceEnumEnabledVFExp(hDevice, pCount, phVFhandle)");
+        ZEL_LOG_TRACE(context.logger, "zesDeviceEnumEnabledVFExp(hDevice, pCount, phVFhandle)");
 
         auto pfnEnumEnabledVFExp = context.zesDdiTable.DeviceExp.pfnEnumEnabledVFExp;
 
         if( nullptr == pfnEnumEnabledVFExp )
             return logAndPropagateResult_zesDeviceEnumEnabledVFExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pCount, phVFhandle);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumEnabledVFExpPrologue( hDevice, pCount, phVFhandle );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDeviceEnumEnabledVFExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumEnabledVFExpPrologue) {
+                auto result = checker->zesDeviceEnumEnabledVFExpPrologue( hDevice, pCount, phVFhandle );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumEnabledVFExp(result, hDevice, pCount, phVFhandle);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumEnabledVFExpPrologue) {
+            auto result = checker->zesDeviceEnumEnabledVFExpPrologue( hDevice, pCount, phVFhandle );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumEnabledVFExp(result, hDevice, pCount, phVFhandle);
         }
 
@@ -11627,15 +15470,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumEnabledVFExpPrologue( hDevice, pCount, phVFhandle );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumEnabledVFExp(result, hDevice, pCount, phVFhandle);
         }
 
         auto driver_result = pfnEnumEnabledVFExp( hDevice, pCount, phVFhandle );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumEnabledVFExpEpilogue( hDevice, pCount, phVFhandle ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDeviceEnumEnabledVFExpEpilogue) {
+                auto result = checker->zesDeviceEnumEnabledVFExpEpilogue( hDevice, pCount, phVFhandle ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumEnabledVFExp(result, hDevice, pCount, phVFhandle);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDeviceEnumEnabledVFExpEpilogue) {
+            auto result = checker->zesDeviceEnumEnabledVFExpEpilogue( hDevice, pCount, phVFhandle ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDeviceEnumEnabledVFExp(result, hDevice, pCount, phVFhandle);
         }
 
@@ -11650,16 +15500,24 @@ namespace validation_layer
         zes_vf_exp_capabilities_t* pCapability          ///< [in,out] Will contain VF capability.
         )
     {
-        context.logger->log_trace("zesVFManagementGetVFCapabilitiesExp(hVFhandle, pCapability)");
+        ZEL_LOG_TRACE(context.logger, "zesVFManagementGetVFCapabilitiesExp(hVFhandle, pCapability)");
 
         auto pfnGetVFCapabilitiesExp = context.zesDdiTable.VFManagementExp.pfnGetVFCapabilitiesExp;
 
         if( nullptr == pfnGetVFCapabilitiesExp )
             return logAndPropagateResult_zesVFManagementGetVFCapabilitiesExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hVFhandle, pCapability);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFCapabilitiesExpPrologue( hVFhandle, pCapability );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesVFManagementGetVFCapabilitiesExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesVFManagementGetVFCapabilitiesExpPrologue) {
+                auto result = checker->zesVFManagementGetVFCapabilitiesExpPrologue( hVFhandle, pCapability );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFCapabilitiesExp(result, hVFhandle, pCapability);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesVFManagementGetVFCapabilitiesExpPrologue) {
+            auto result = checker->zesVFManagementGetVFCapabilitiesExpPrologue( hVFhandle, pCapability );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFCapabilitiesExp(result, hVFhandle, pCapability);
         }
 
@@ -11669,15 +15527,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementGetVFCapabilitiesExpPrologue( hVFhandle, pCapability );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFCapabilitiesExp(result, hVFhandle, pCapability);
         }
 
         auto driver_result = pfnGetVFCapabilitiesExp( hVFhandle, pCapability );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFCapabilitiesExpEpilogue( hVFhandle, pCapability ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesVFManagementGetVFCapabilitiesExpEpilogue) {
+                auto result = checker->zesVFManagementGetVFCapabilitiesExpEpilogue( hVFhandle, pCapability ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFCapabilitiesExp(result, hVFhandle, pCapability);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesVFManagementGetVFCapabilitiesExpEpilogue) {
+            auto result = checker->zesVFManagementGetVFCapabilitiesExpEpilogue( hVFhandle, pCapability ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFCapabilitiesExp(result, hVFhandle, pCapability);
         }
 
@@ -11706,16 +15571,24 @@ namespace validation_layer
                                                         ///< memory stats.
         )
     {
-        context.logger->log_trace("zesVFManagementGetVFMemoryUtilizationExp2(hVFhandle, pCount, pMemUtil)");
+        ZEL_LOG_TRACE(context.logger, "zesVFManagementGetVFMemoryUtilizationExp2(hVFhandle, pCount, pMemUtil)");
 
         auto pfnGetVFMemoryUtilizationExp2 = context.zesDdiTable.VFManagementExp.pfnGetVFMemoryUtilizationExp2;
 
         if( nullptr == pfnGetVFMemoryUtilizationExp2 )
             return logAndPropagateResult_zesVFManagementGetVFMemoryUtilizationExp2(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hVFhandle, pCount, pMemUtil);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFMemoryUtilizationExp2Prologue( hVFhandle, pCount, pMemUtil );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesVFManagementGetVFMemoryUtilizationExp2Prologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesVFManagementGetVFMemoryUtilizationExp2Prologue) {
+                auto result = checker->zesVFManagementGetVFMemoryUtilizationExp2Prologue( hVFhandle, pCount, pMemUtil );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFMemoryUtilizationExp2(result, hVFhandle, pCount, pMemUtil);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesVFManagementGetVFMemoryUtilizationExp2Prologue) {
+            auto result = checker->zesVFManagementGetVFMemoryUtilizationExp2Prologue( hVFhandle, pCount, pMemUtil );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFMemoryUtilizationExp2(result, hVFhandle, pCount, pMemUtil);
         }
 
@@ -11725,15 +15598,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementGetVFMemoryUtilizationExp2Prologue( hVFhandle, pCount, pMemUtil );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFMemoryUtilizationExp2(result, hVFhandle, pCount, pMemUtil);
         }
 
         auto driver_result = pfnGetVFMemoryUtilizationExp2( hVFhandle, pCount, pMemUtil );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFMemoryUtilizationExp2Epilogue( hVFhandle, pCount, pMemUtil ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesVFManagementGetVFMemoryUtilizationExp2Epilogue) {
+                auto result = checker->zesVFManagementGetVFMemoryUtilizationExp2Epilogue( hVFhandle, pCount, pMemUtil ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFMemoryUtilizationExp2(result, hVFhandle, pCount, pMemUtil);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesVFManagementGetVFMemoryUtilizationExp2Epilogue) {
+            auto result = checker->zesVFManagementGetVFMemoryUtilizationExp2Epilogue( hVFhandle, pCount, pMemUtil ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFMemoryUtilizationExp2(result, hVFhandle, pCount, pMemUtil);
         }
 
@@ -11758,16 +15638,24 @@ namespace validation_layer
                                                         ///< engine stats.
         )
     {
-        context.logger->log_trace("zesVFManagementGetVFEngineUtilizationExp2(hVFhandle, pCount, pEngineUtil)");
+        ZEL_LOG_TRACE(context.logger, "zesVFManagementGetVFEngineUtilizationExp2(hVFhandle, pCount, pEngineUtil)");
 
         auto pfnGetVFEngineUtilizationExp2 = context.zesDdiTable.VFManagementExp.pfnGetVFEngineUtilizationExp2;
 
         if( nullptr == pfnGetVFEngineUtilizationExp2 )
             return logAndPropagateResult_zesVFManagementGetVFEngineUtilizationExp2(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hVFhandle, pCount, pEngineUtil);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFEngineUtilizationExp2Prologue( hVFhandle, pCount, pEngineUtil );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesVFManagementGetVFEngineUtilizationExp2Prologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesVFManagementGetVFEngineUtilizationExp2Prologue) {
+                auto result = checker->zesVFManagementGetVFEngineUtilizationExp2Prologue( hVFhandle, pCount, pEngineUtil );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFEngineUtilizationExp2(result, hVFhandle, pCount, pEngineUtil);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesVFManagementGetVFEngineUtilizationExp2Prologue) {
+            auto result = checker->zesVFManagementGetVFEngineUtilizationExp2Prologue( hVFhandle, pCount, pEngineUtil );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFEngineUtilizationExp2(result, hVFhandle, pCount, pEngineUtil);
         }
 
@@ -11777,15 +15665,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementGetVFEngineUtilizationExp2Prologue( hVFhandle, pCount, pEngineUtil );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFEngineUtilizationExp2(result, hVFhandle, pCount, pEngineUtil);
         }
 
         auto driver_result = pfnGetVFEngineUtilizationExp2( hVFhandle, pCount, pEngineUtil );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFEngineUtilizationExp2Epilogue( hVFhandle, pCount, pEngineUtil ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesVFManagementGetVFEngineUtilizationExp2Epilogue) {
+                auto result = checker->zesVFManagementGetVFEngineUtilizationExp2Epilogue( hVFhandle, pCount, pEngineUtil ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFEngineUtilizationExp2(result, hVFhandle, pCount, pEngineUtil);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesVFManagementGetVFEngineUtilizationExp2Epilogue) {
+            auto result = checker->zesVFManagementGetVFEngineUtilizationExp2Epilogue( hVFhandle, pCount, pEngineUtil ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFEngineUtilizationExp2(result, hVFhandle, pCount, pEngineUtil);
         }
 
@@ -11800,16 +15695,24 @@ namespace validation_layer
         zes_vf_exp2_capabilities_t* pCapability         ///< [in,out] Will contain VF capability.
         )
     {
-        context.logger->log_trace("zesVFManagementGetVFCapabilitiesExp2(hVFhandle, pCapability)");
+        ZEL_LOG_TRACE(context.logger, "zesVFManagementGetVFCapabilitiesExp2(hVFhandle, pCapability)");
 
         auto pfnGetVFCapabilitiesExp2 = context.zesDdiTable.VFManagementExp.pfnGetVFCapabilitiesExp2;
 
         if( nullptr == pfnGetVFCapabilitiesExp2 )
             return logAndPropagateResult_zesVFManagementGetVFCapabilitiesExp2(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hVFhandle, pCapability);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFCapabilitiesExp2Prologue( hVFhandle, pCapability );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesVFManagementGetVFCapabilitiesExp2Prologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesVFManagementGetVFCapabilitiesExp2Prologue) {
+                auto result = checker->zesVFManagementGetVFCapabilitiesExp2Prologue( hVFhandle, pCapability );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFCapabilitiesExp2(result, hVFhandle, pCapability);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesVFManagementGetVFCapabilitiesExp2Prologue) {
+            auto result = checker->zesVFManagementGetVFCapabilitiesExp2Prologue( hVFhandle, pCapability );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFCapabilitiesExp2(result, hVFhandle, pCapability);
         }
 
@@ -11819,15 +15722,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementGetVFCapabilitiesExp2Prologue( hVFhandle, pCapability );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFCapabilitiesExp2(result, hVFhandle, pCapability);
         }
 
         auto driver_result = pfnGetVFCapabilitiesExp2( hVFhandle, pCapability );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFCapabilitiesExp2Epilogue( hVFhandle, pCapability ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesVFManagementGetVFCapabilitiesExp2Epilogue) {
+                auto result = checker->zesVFManagementGetVFCapabilitiesExp2Epilogue( hVFhandle, pCapability ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFCapabilitiesExp2(result, hVFhandle, pCapability);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesVFManagementGetVFCapabilitiesExp2Epilogue) {
+            auto result = checker->zesVFManagementGetVFCapabilitiesExp2Epilogue( hVFhandle, pCapability ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesVFManagementGetVFCapabilitiesExp2(result, hVFhandle, pCapability);
         }
 
@@ -11844,16 +15754,24 @@ namespace validation_layer
         zes_device_action_t* pendingAction              ///< [out] Pending action
         )
     {
-        context.logger->log_trace("zesDevicePciLinkSpeedUpdateExt(hDevice, shouldDowngrade, pendingAction)");
+        ZEL_LOG_TRACE(context.logger, "zesDevicePciLinkSpeedUpdateExt(hDevice, shouldDowngrade, pendingAction)");
 
         auto pfnPciLinkSpeedUpdateExt = context.zesDdiTable.Device.pfnPciLinkSpeedUpdateExt;
 
         if( nullptr == pfnPciLinkSpeedUpdateExt )
             return logAndPropagateResult_zesDevicePciLinkSpeedUpdateExt(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, shouldDowngrade, pendingAction);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDevicePciLinkSpeedUpdateExtPrologue( hDevice, shouldDowngrade, pendingAction );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zes.zesDevicePciLinkSpeedUpdateExtPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDevicePciLinkSpeedUpdateExtPrologue) {
+                auto result = checker->zesDevicePciLinkSpeedUpdateExtPrologue( hDevice, shouldDowngrade, pendingAction );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDevicePciLinkSpeedUpdateExt(result, hDevice, shouldDowngrade, pendingAction);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDevicePciLinkSpeedUpdateExtPrologue) {
+            auto result = checker->zesDevicePciLinkSpeedUpdateExtPrologue( hDevice, shouldDowngrade, pendingAction );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDevicePciLinkSpeedUpdateExt(result, hDevice, shouldDowngrade, pendingAction);
         }
 
@@ -11863,15 +15781,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDevicePciLinkSpeedUpdateExtPrologue( hDevice, shouldDowngrade, pendingAction );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDevicePciLinkSpeedUpdateExt(result, hDevice, shouldDowngrade, pendingAction);
         }
 
         auto driver_result = pfnPciLinkSpeedUpdateExt( hDevice, shouldDowngrade, pendingAction );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDevicePciLinkSpeedUpdateExtEpilogue( hDevice, shouldDowngrade, pendingAction ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zes.zesDevicePciLinkSpeedUpdateExtEpilogue) {
+                auto result = checker->zesDevicePciLinkSpeedUpdateExtEpilogue( hDevice, shouldDowngrade, pendingAction ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDevicePciLinkSpeedUpdateExt(result, hDevice, shouldDowngrade, pendingAction);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zes.zesDevicePciLinkSpeedUpdateExtEpilogue) {
+            auto result = checker->zesDevicePciLinkSpeedUpdateExtEpilogue( hDevice, shouldDowngrade, pendingAction ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zesDevicePciLinkSpeedUpdateExt(result, hDevice, shouldDowngrade, pendingAction);
         }
 
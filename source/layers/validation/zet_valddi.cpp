@@ -33,10 +33,20 @@ namespace validation_layer
         size_t* pSize,                                  ///< [in,out] size of debug info in bytes
         uint8_t* pDebugInfo                             ///< [in,out][optional] byte pointer to debug info
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetModuleGetDebugInfo", "zet_module_handle_t hModule,zet_module_debug_info_format_t format,size_t* pSize,uint8_t* pDebugInfo");
+            context.binaryTrace->record(binaryTraceApiId, result, hModule, format, pSize, pDebugInfo);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetModuleGetDebugInfo(";
@@ -65,10 +75,20 @@ namespace validation_layer
         zet_device_handle_t hDevice,                    ///< [in] device handle
         zet_device_debug_properties_t* pDebugProperties ///< [in,out] query result for debug properties
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetDeviceGetDebugProperties", "zet_device_handle_t hDevice,zet_device_debug_properties_t* pDebugProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pDebugProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetDeviceGetDebugProperties(";
@@ -90,10 +110,20 @@ namespace validation_layer
         const zet_debug_config_t* config,               ///< [in] the debug configuration
         zet_debug_session_handle_t* phDebug             ///< [out] debug session handle
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetDebugAttach", "zet_device_handle_t hDevice,const zet_debug_config_t* config,zet_debug_session_handle_t* phDebug");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, config, phDebug);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetDebugAttach(";
@@ -122,10 +152,20 @@ namespace validation_layer
         ze_result_t result,
         zet_debug_session_handle_t hDebug               ///< [in][release] debug session handle
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetDebugDetach", "zet_debug_session_handle_t hDebug");
+            context.binaryTrace->record(binaryTraceApiId, result, hDebug);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetDebugDetach(";
@@ -149,10 +189,20 @@ namespace validation_layer
                                                         ///< value allowed by the accuracy of those dependencies.
         zet_debug_event_t* event                        ///< [in,out] a pointer to a ::zet_debug_event_t.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetDebugReadEvent", "zet_debug_session_handle_t hDebug,uint64_t timeout,zet_debug_event_t* event");
+            context.binaryTrace->record(binaryTraceApiId, result, hDebug, timeout, event);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetDebugReadEvent(";
@@ -177,10 +227,20 @@ namespace validation_layer
         zet_debug_session_handle_t hDebug,              ///< [in] debug session handle
         const zet_debug_event_t* event                  ///< [in] a pointer to a ::zet_debug_event_t.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetDebugAcknowledgeEvent", "zet_debug_session_handle_t hDebug,const zet_debug_event_t* event");
+            context.binaryTrace->record(binaryTraceApiId, result, hDebug, event);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetDebugAcknowledgeEvent(";
@@ -201,10 +261,20 @@ namespace validation_layer
         zet_debug_session_handle_t hDebug,              ///< [in] debug session handle
         ze_device_thread_t thread                       ///< [in] the thread to interrupt
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetDebugInterrupt", "zet_debug_session_handle_t hDebug,ze_device_thread_t thread");
+            context.binaryTrace->record(binaryTraceApiId, result, hDebug, thread);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetDebugInterrupt(";
@@ -225,10 +295,20 @@ namespace validation_layer
         zet_debug_session_handle_t hDebug,              ///< [in] debug session handle
         ze_device_thread_t thread                       ///< [in] the thread to resume
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetDebugResume", "zet_debug_session_handle_t hDebug,ze_device_thread_t thread");
+            context.binaryTrace->record(binaryTraceApiId, result, hDebug, thread);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetDebugResume(";
@@ -252,10 +332,20 @@ namespace validation_layer
         size_t size,                                    ///< [in] the number of bytes to read
         void* buffer                                    ///< [in,out] a buffer to hold a copy of the memory
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetDebugReadMemory", "zet_debug_session_handle_t hDebug,ze_device_thread_t thread,const zet_debug_memory_space_desc_t* desc,size_t size,void* buffer");
+            context.binaryTrace->record(binaryTraceApiId, result, hDebug, thread, desc, size, buffer);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetDebugReadMemory(";
@@ -291,10 +381,20 @@ namespace validation_layer
         size_t size,                                    ///< [in] the number of bytes to write
         const void* buffer                              ///< [in] a buffer holding the pattern to write
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetDebugWriteMemory", "zet_debug_session_handle_t hDebug,ze_device_thread_t thread,const zet_debug_memory_space_desc_t* desc,size_t size,const void* buffer");
+            context.binaryTrace->record(binaryTraceApiId, result, hDebug, thread, desc, size, buffer);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetDebugWriteMemory(";
@@ -336,10 +436,20 @@ namespace validation_layer
                                                         ///< if count is less than the number of register set properties available,
                                                         ///< then driver shall only retrieve that number of register set properties.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetDebugGetRegisterSetProperties", "zet_device_handle_t hDevice,uint32_t* pCount,zet_debug_regset_properties_t* pRegisterSetProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pCount, pRegisterSetProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetDebugGetRegisterSetProperties(";
@@ -374,10 +484,20 @@ namespace validation_layer
                                                         ///< if count is less than the number of register set properties available,
                                                         ///< then driver shall only retrieve that number of register set properties.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetDebugGetThreadRegisterSetProperties", "zet_debug_session_handle_t hDebug,ze_device_thread_t thread,uint32_t* pCount,zet_debug_regset_properties_t* pRegisterSetProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hDebug, thread, pCount, pRegisterSetProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetDebugGetThreadRegisterSetProperties(";
@@ -414,10 +534,20 @@ namespace validation_layer
                                                         ///< type
         void* pRegisterValues                           ///< [in,out][optional][range(0, count)] buffer of register values
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetDebugReadRegisters", "zet_debug_session_handle_t hDebug,ze_device_thread_t thread,uint32_t type,uint32_t start,uint32_t count,void* pRegisterValues");
+            context.binaryTrace->record(binaryTraceApiId, result, hDebug, thread, type, start, count, pRegisterValues);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetDebugReadRegisters(";
@@ -462,10 +592,20 @@ namespace validation_layer
                                                         ///< the type
         void* pRegisterValues                           ///< [in,out][optional][range(0, count)] buffer of register values
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetDebugWriteRegisters", "zet_debug_session_handle_t hDebug,ze_device_thread_t thread,uint32_t type,uint32_t start,uint32_t count,void* pRegisterValues");
+            context.binaryTrace->record(binaryTraceApiId, result, hDebug, thread, type, start, count, pRegisterValues);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetDebugWriteRegisters(";
@@ -510,10 +650,20 @@ namespace validation_layer
                                                         ///< if count is less than the number of metric groups available, then
                                                         ///< driver shall only retrieve that number of metric groups.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricGroupGet", "zet_device_handle_t hDevice,uint32_t* pCount,zet_metric_group_handle_t* phMetricGroups");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pCount, phMetricGroups);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricGroupGet(";
@@ -538,10 +688,20 @@ namespace validation_layer
         zet_metric_group_handle_t hMetricGroup,         ///< [in] handle of the metric group
         zet_metric_group_properties_t* pProperties      ///< [in,out] metric group properties
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricGroupGetProperties", "zet_metric_group_handle_t hMetricGroup,zet_metric_group_properties_t* pProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetricGroup, pProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricGroupGetProperties(";
@@ -573,10 +733,20 @@ namespace validation_layer
                                                         ///< if count is less than the number available in the raw data buffer,
                                                         ///< then driver shall only calculate that number of metric values.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricGroupCalculateMetricValues", "zet_metric_group_handle_t hMetricGroup,zet_metric_group_calculation_type_t type,size_t rawDataSize,const uint8_t* pRawData,uint32_t* pMetricValueCount,zet_typed_value_t* pMetricValues");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricGroupCalculateMetricValues(";
@@ -620,10 +790,20 @@ namespace validation_layer
                                                         ///< if count is less than the number of metrics available, then driver
                                                         ///< shall only retrieve that number of metrics.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricGet", "zet_metric_group_handle_t hMetricGroup,uint32_t* pCount,zet_metric_handle_t* phMetrics");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetricGroup, pCount, phMetrics);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricGet(";
@@ -648,10 +828,20 @@ namespace validation_layer
         zet_metric_handle_t hMetric,                    ///< [in] handle of the metric
         zet_metric_properties_t* pProperties            ///< [in,out] metric properties
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricGetProperties", "zet_metric_handle_t hMetric,zet_metric_properties_t* pProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetric, pProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricGetProperties(";
@@ -678,10 +868,20 @@ namespace validation_layer
                                                         ///< all metrics groups must come from a different domains.
                                                         ///< metric query and metric stream must use activated metric groups.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetContextActivateMetricGroups", "zet_context_handle_t hContext,zet_device_handle_t hDevice,uint32_t count,zet_metric_group_handle_t* phMetricGroups");
+            context.binaryTrace->record(binaryTraceApiId, result, hContext, hDevice, count, phMetricGroups);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetContextActivateMetricGroups(";
@@ -714,10 +914,20 @@ namespace validation_layer
         ze_event_handle_t hNotificationEvent,           ///< [in][optional] event used for report availability notification
         zet_metric_streamer_handle_t* phMetricStreamer  ///< [out] handle of metric streamer
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricStreamerOpen", "zet_context_handle_t hContext,zet_device_handle_t hDevice,zet_metric_group_handle_t hMetricGroup,zet_metric_streamer_desc_t* desc,ze_event_handle_t hNotificationEvent,zet_metric_streamer_handle_t* phMetricStreamer");
+            context.binaryTrace->record(binaryTraceApiId, result, hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricStreamerOpen(";
@@ -760,10 +970,20 @@ namespace validation_layer
         zet_metric_streamer_handle_t hMetricStreamer,   ///< [in] handle of the metric streamer
         uint32_t value                                  ///< [in] streamer marker value
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetCommandListAppendMetricStreamerMarker", "zet_command_list_handle_t hCommandList,zet_metric_streamer_handle_t hMetricStreamer,uint32_t value");
+            context.binaryTrace->record(binaryTraceApiId, result, hCommandList, hMetricStreamer, value);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetCommandListAppendMetricStreamerMarker(";
@@ -787,10 +1007,20 @@ namespace validation_layer
         ze_result_t result,
         zet_metric_streamer_handle_t hMetricStreamer    ///< [in][release] handle of the metric streamer
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricStreamerClose", "zet_metric_streamer_handle_t hMetricStreamer");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetricStreamer);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricStreamerClose(";
@@ -821,10 +1051,20 @@ namespace validation_layer
         uint8_t* pRawData                               ///< [in,out][optional][range(0, *pRawDataSize)] buffer containing streamer
                                                         ///< reports in raw format
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricStreamerReadData", "zet_metric_streamer_handle_t hMetricStreamer,uint32_t maxReportCount,size_t* pRawDataSize,uint8_t* pRawData");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetricStreamer, maxReportCount, pRawDataSize, pRawData);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricStreamerReadData(";
@@ -856,10 +1096,20 @@ namespace validation_layer
         const zet_metric_query_pool_desc_t* desc,       ///< [in] metric query pool descriptor
         zet_metric_query_pool_handle_t* phMetricQueryPool   ///< [out] handle of metric query pool
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricQueryPoolCreate", "zet_context_handle_t hContext,zet_device_handle_t hDevice,zet_metric_group_handle_t hMetricGroup,const zet_metric_query_pool_desc_t* desc,zet_metric_query_pool_handle_t* phMetricQueryPool");
+            context.binaryTrace->record(binaryTraceApiId, result, hContext, hDevice, hMetricGroup, desc, phMetricQueryPool);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricQueryPoolCreate(";
@@ -896,10 +1146,20 @@ namespace validation_layer
         ze_result_t result,
         zet_metric_query_pool_handle_t hMetricQueryPool ///< [in][release] handle of the metric query pool
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricQueryPoolDestroy", "zet_metric_query_pool_handle_t hMetricQueryPool");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetricQueryPool);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricQueryPoolDestroy(";
@@ -917,10 +1177,20 @@ namespace validation_layer
         uint32_t index,                                 ///< [in] index of the query within the pool
         zet_metric_query_handle_t* phMetricQuery        ///< [out] handle of metric query
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricQueryCreate", "zet_metric_query_pool_handle_t hMetricQueryPool,uint32_t index,zet_metric_query_handle_t* phMetricQuery");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetricQueryPool, index, phMetricQuery);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricQueryCreate(";
@@ -949,10 +1219,20 @@ namespace validation_layer
         ze_result_t result,
         zet_metric_query_handle_t hMetricQuery          ///< [in][release] handle of metric query
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricQueryDestroy", "zet_metric_query_handle_t hMetricQuery");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetricQuery);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricQueryDestroy(";
@@ -968,10 +1248,20 @@ namespace validation_layer
         ze_result_t result,
         zet_metric_query_handle_t hMetricQuery          ///< [in] handle of metric query
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricQueryReset", "zet_metric_query_handle_t hMetricQuery");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetricQuery);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricQueryReset(";
@@ -988,10 +1278,20 @@ namespace validation_layer
         zet_command_list_handle_t hCommandList,         ///< [in] handle of the command list
         zet_metric_query_handle_t hMetricQuery          ///< [in] handle of the metric query
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetCommandListAppendMetricQueryBegin", "zet_command_list_handle_t hCommandList,zet_metric_query_handle_t hMetricQuery");
+            context.binaryTrace->record(binaryTraceApiId, result, hCommandList, hMetricQuery);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetCommandListAppendMetricQueryBegin(";
@@ -1015,10 +1315,20 @@ namespace validation_layer
         uint32_t numWaitEvents,                         ///< [in] must be zero
         ze_event_handle_t* phWaitEvents                 ///< [in][mbz] must be nullptr
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetCommandListAppendMetricQueryEnd", "zet_command_list_handle_t hCommandList,zet_metric_query_handle_t hMetricQuery,ze_event_handle_t hSignalEvent,uint32_t numWaitEvents,ze_event_handle_t* phWaitEvents");
+            context.binaryTrace->record(binaryTraceApiId, result, hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetCommandListAppendMetricQueryEnd(";
@@ -1050,10 +1360,20 @@ namespace validation_layer
         ze_result_t result,
         zet_command_list_handle_t hCommandList          ///< [in] handle of the command list
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetCommandListAppendMetricMemoryBarrier", "zet_command_list_handle_t hCommandList");
+            context.binaryTrace->record(binaryTraceApiId, result, hCommandList);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetCommandListAppendMetricMemoryBarrier(";
@@ -1078,10 +1398,20 @@ namespace validation_layer
         uint8_t* pRawData                               ///< [in,out][optional][range(0, *pRawDataSize)] buffer containing query
                                                         ///< reports in raw format
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricQueryGetData", "zet_metric_query_handle_t hMetricQuery,size_t* pRawDataSize,uint8_t* pRawData");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetricQuery, pRawDataSize, pRawData);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricQueryGetData(";
@@ -1106,10 +1436,20 @@ namespace validation_layer
         zet_kernel_handle_t hKernel,                    ///< [in] handle to kernel
         zet_profile_properties_t* pProfileProperties    ///< [out] pointer to profile properties
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetKernelGetProfileInfo", "zet_kernel_handle_t hKernel,zet_profile_properties_t* pProfileProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hKernel, pProfileProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetKernelGetProfileInfo(";
@@ -1136,10 +1476,20 @@ namespace validation_layer
         const zet_tracer_exp_desc_t* desc,              ///< [in] pointer to tracer descriptor
         zet_tracer_exp_handle_t* phTracer               ///< [out] pointer to handle of tracer object created
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetTracerExpCreate", "zet_context_handle_t hContext,const zet_tracer_exp_desc_t* desc,zet_tracer_exp_handle_t* phTracer");
+            context.binaryTrace->record(binaryTraceApiId, result, hContext, desc, phTracer);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetTracerExpCreate(";
@@ -1168,10 +1518,20 @@ namespace validation_layer
         ze_result_t result,
         zet_tracer_exp_handle_t hTracer                 ///< [in][release] handle of tracer object to destroy
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetTracerExpDestroy", "zet_tracer_exp_handle_t hTracer");
+            context.binaryTrace->record(binaryTraceApiId, result, hTracer);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetTracerExpDestroy(";
@@ -1188,10 +1548,20 @@ namespace validation_layer
         zet_tracer_exp_handle_t hTracer,                ///< [in] handle of the tracer
         zet_core_callbacks_t* pCoreCbs                  ///< [in] pointer to table of 'core' callback function pointers
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetTracerExpSetPrologues", "zet_tracer_exp_handle_t hTracer,zet_core_callbacks_t* pCoreCbs");
+            context.binaryTrace->record(binaryTraceApiId, result, hTracer, pCoreCbs);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetTracerExpSetPrologues(";
@@ -1212,10 +1582,20 @@ namespace validation_layer
         zet_tracer_exp_handle_t hTracer,                ///< [in] handle of the tracer
         zet_core_callbacks_t* pCoreCbs                  ///< [in] pointer to table of 'core' callback function pointers
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetTracerExpSetEpilogues", "zet_tracer_exp_handle_t hTracer,zet_core_callbacks_t* pCoreCbs");
+            context.binaryTrace->record(binaryTraceApiId, result, hTracer, pCoreCbs);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetTracerExpSetEpilogues(";
@@ -1236,10 +1616,20 @@ namespace validation_layer
         zet_tracer_exp_handle_t hTracer,                ///< [in] handle of the tracer
         ze_bool_t enable                                ///< [in] enable the tracer if true; disable if false
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetTracerExpSetEnabled", "zet_tracer_exp_handle_t hTracer,ze_bool_t enable");
+            context.binaryTrace->record(binaryTraceApiId, result, hTracer, enable);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetTracerExpSetEnabled(";
@@ -1281,10 +1671,20 @@ namespace validation_layer
                                                         ///< if count is less than the number available in the raw data buffer,
                                                         ///< then driver shall only calculate that number of metric values.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricGroupCalculateMultipleMetricValuesExp", "zet_metric_group_handle_t hMetricGroup,zet_metric_group_calculation_type_t type,size_t rawDataSize,const uint8_t* pRawData,uint32_t* pSetCount,uint32_t* pTotalMetricValueCount,uint32_t* pMetricCounts,zet_typed_value_t* pMetricValues");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricGroupCalculateMultipleMetricValuesExp(";
@@ -1333,10 +1733,20 @@ namespace validation_layer
                                                         ///< [out] if synchronizedWithHost is true, the timestamp is in nanoseconds.
         uint64_t* metricTimestamp                       ///< [out] Metric timestamp in tick counts.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricGroupGetGlobalTimestampsExp", "zet_metric_group_handle_t hMetricGroup,ze_bool_t synchronizedWithHost,uint64_t* globalTimestamp,uint64_t* metricTimestamp");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricGroupGetGlobalTimestampsExp(";
@@ -1382,10 +1792,20 @@ namespace validation_layer
                                                         ///< value with the actual number of bytes necessary to store the exported data.
         uint8_t * pExportData                           ///< [in,out][optional][range(0, *pExportDataSize)] buffer of exported data.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricGroupGetExportDataExp", "zet_metric_group_handle_t hMetricGroup,const uint8_t* pRawData,size_t rawDataSize,size_t* pExportDataSize,uint8_t * pExportData");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricGroupGetExportDataExp(";
@@ -1440,10 +1860,20 @@ namespace validation_layer
                                                         ///< if count is less than the number available in the raw data buffer,
                                                         ///< then driver shall only calculate that number of metric values.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricGroupCalculateMetricExportDataExp", "ze_driver_handle_t hDriver,zet_metric_group_calculation_type_t type,size_t exportDataSize,const uint8_t* pExportData,zet_metric_calculate_exp_desc_t* pCalculateDescriptor,uint32_t* pSetCount,uint32_t* pTotalMetricValueCount,uint32_t* pMetricCounts,zet_typed_value_t* pMetricValues");
+            context.binaryTrace->record(binaryTraceApiId, result, hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricGroupCalculateMetricExportDataExp(";
@@ -1500,10 +1930,20 @@ namespace validation_layer
                                                         ///< if count is less than the number of metric programmables available,
                                                         ///< then driver shall only retrieve that number of metric programmables.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricProgrammableGetExp", "zet_device_handle_t hDevice,uint32_t* pCount,zet_metric_programmable_exp_handle_t* phMetricProgrammables");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pCount, phMetricProgrammables);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricProgrammableGetExp(";
@@ -1528,10 +1968,20 @@ namespace validation_layer
         zet_metric_programmable_exp_handle_t hMetricProgrammable,   ///< [in] handle of the metric programmable
         zet_metric_programmable_exp_properties_t* pProperties   ///< [in,out] properties of the metric programmable
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricProgrammableGetPropertiesExp", "zet_metric_programmable_exp_handle_t hMetricProgrammable,zet_metric_programmable_exp_properties_t* pProperties");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetricProgrammable, pProperties);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricProgrammableGetPropertiesExp(";
@@ -1559,10 +2009,20 @@ namespace validation_layer
                                                         ///< if parameterCount is less than the number of parameters available,
                                                         ///< then driver shall only retrieve that number of parameter info.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricProgrammableGetParamInfoExp", "zet_metric_programmable_exp_handle_t hMetricProgrammable,uint32_t* pParameterCount,zet_metric_programmable_param_info_exp_t* pParameterInfo");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetricProgrammable, pParameterCount, pParameterInfo);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricProgrammableGetParamInfoExp(";
@@ -1595,10 +2055,20 @@ namespace validation_layer
                                                         ///< if pValueInfoCount is less than the number of value info available,
                                                         ///< then driver shall only retrieve that number of value info.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricProgrammableGetParamValueInfoExp", "zet_metric_programmable_exp_handle_t hMetricProgrammable,uint32_t parameterOrdinal,uint32_t* pValueInfoCount,zet_metric_programmable_param_value_info_exp_t* pValueInfo");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricProgrammableGetParamValueInfoExp(";
@@ -1642,10 +2112,20 @@ namespace validation_layer
                                                         ///< if count is less than the number of metrics available, then driver
                                                         ///< shall only retrieve that number of metric handles.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricCreateFromProgrammableExp2", "zet_metric_programmable_exp_handle_t hMetricProgrammable,uint32_t parameterCount,zet_metric_programmable_param_value_exp_t* pParameterValues,const char* pName,const char* pDescription,uint32_t* pMetricHandleCount,zet_metric_handle_t* phMetricHandles");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricCreateFromProgrammableExp2(";
@@ -1701,10 +2181,20 @@ namespace validation_layer
                                                         ///< if count is less than the number of metrics available, then driver
                                                         ///< shall only retrieve that number of metric handles.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricCreateFromProgrammableExp", "zet_metric_programmable_exp_handle_t hMetricProgrammable,zet_metric_programmable_param_value_exp_t* pParameterValues,uint32_t parameterCount,const char* pName,const char* pDescription,uint32_t* pMetricHandleCount,zet_metric_handle_t* phMetricHandles");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricCreateFromProgrammableExp(";
@@ -1763,10 +2253,20 @@ namespace validation_layer
                                                         ///< metric group handles.
                                                         ///< Created Metric group handles.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetDeviceCreateMetricGroupsFromMetricsExp", "zet_device_handle_t hDevice,uint32_t metricCount,zet_metric_handle_t * phMetrics,const char * pMetricGroupNamePrefix,const char * pDescription,uint32_t * pMetricGroupCount,zet_metric_group_handle_t* phMetricGroup");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetDeviceCreateMetricGroupsFromMetricsExp(";
@@ -1813,10 +2313,20 @@ namespace validation_layer
         zet_metric_group_sampling_type_flags_t samplingType,///< [in] Sampling type for the metric group.
         zet_metric_group_handle_t* phMetricGroup        ///< [in,out] Created Metric group handle
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricGroupCreateExp", "zet_device_handle_t hDevice,const char* pName,const char* pDescription,zet_metric_group_sampling_type_flags_t samplingType,zet_metric_group_handle_t* phMetricGroup");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, pName, pDescription, samplingType, phMetricGroup);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricGroupCreateExp(";
@@ -1856,10 +2366,20 @@ namespace validation_layer
                                                         ///< if *pErrorStringSize is less than the length of the error string
                                                         ///< available, then driver shall only retrieve that length of error string.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricGroupAddMetricExp", "zet_metric_group_handle_t hMetricGroup,zet_metric_handle_t hMetric,size_t * pErrorStringSize,char* pErrorString");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetricGroup, hMetric, pErrorStringSize, pErrorString);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricGroupAddMetricExp(";
@@ -1888,10 +2408,20 @@ namespace validation_layer
         zet_metric_group_handle_t hMetricGroup,         ///< [in] Handle of the metric group
         zet_metric_handle_t hMetric                     ///< [in] Metric handle to be removed from the metric group.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricGroupRemoveMetricExp", "zet_metric_group_handle_t hMetricGroup,zet_metric_handle_t hMetric");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetricGroup, hMetric);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricGroupRemoveMetricExp(";
@@ -1911,10 +2441,20 @@ namespace validation_layer
         ze_result_t result,
         zet_metric_group_handle_t hMetricGroup          ///< [in] Handle of the metric group
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricGroupCloseExp", "zet_metric_group_handle_t hMetricGroup");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetricGroup);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricGroupCloseExp(";
@@ -1930,10 +2470,20 @@ namespace validation_layer
         ze_result_t result,
         zet_metric_group_handle_t hMetricGroup          ///< [in] Handle of the metric group to destroy
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricGroupDestroyExp", "zet_metric_group_handle_t hMetricGroup");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetricGroup);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricGroupDestroyExp(";
@@ -1949,10 +2499,20 @@ namespace validation_layer
         ze_result_t result,
         zet_metric_handle_t hMetric                     ///< [in] Handle of the metric to destroy
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricDestroyExp", "zet_metric_handle_t hMetric");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetric);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricDestroyExp(";
@@ -1976,10 +2536,20 @@ namespace validation_layer
                                                         ///< The value of this parameter could be used to determine the number of
                                                         ///< replays necessary.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetDeviceGetConcurrentMetricGroupsExp", "zet_device_handle_t hDevice,uint32_t metricGroupCount,zet_metric_group_handle_t * phMetricGroups,uint32_t * pMetricGroupsCountPerConcurrentGroup,uint32_t * pConcurrentGroupCount");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetDeviceGetConcurrentMetricGroupsExp(";
@@ -2025,10 +2595,20 @@ namespace validation_layer
                                                         ///< HW event buffer being overrun
         zet_metric_tracer_exp_handle_t* phMetricTracer  ///< [out] handle of the metric tracer
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricTracerCreateExp", "zet_context_handle_t hContext,zet_device_handle_t hDevice,uint32_t metricGroupCount,zet_metric_group_handle_t* phMetricGroups,zet_metric_tracer_exp_desc_t* desc,ze_event_handle_t hNotificationEvent,zet_metric_tracer_exp_handle_t* phMetricTracer");
+            context.binaryTrace->record(binaryTraceApiId, result, hContext, hDevice, metricGroupCount, phMetricGroups, desc, hNotificationEvent, phMetricTracer);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricTracerCreateExp(";
@@ -2073,10 +2653,20 @@ namespace validation_layer
         ze_result_t result,
         zet_metric_tracer_exp_handle_t hMetricTracer    ///< [in] handle of the metric tracer
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricTracerDestroyExp", "zet_metric_tracer_exp_handle_t hMetricTracer");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetricTracer);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricTracerDestroyExp(";
@@ -2097,10 +2687,20 @@ namespace validation_layer
                                                         ///< when the tracer is inactive. ::ZE_RESULT_SUCCESS will be returned 
                                                         ///< when the tracer is active.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricTracerEnableExp", "zet_metric_tracer_exp_handle_t hMetricTracer,ze_bool_t synchronous");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetricTracer, synchronous);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricTracerEnableExp(";
@@ -2126,10 +2726,20 @@ namespace validation_layer
                                                         ///< ::ZE_RESULT_NOT_READY will be returned when the tracer is inactive and
                                                         ///< has no more data to be retrieved.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricTracerDisableExp", "zet_metric_tracer_exp_handle_t hMetricTracer,ze_bool_t synchronous");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetricTracer, synchronous);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricTracerDisableExp(";
@@ -2158,10 +2768,20 @@ namespace validation_layer
         uint8_t* pRawData                               ///< [in,out][optional][range(0, *pRawDataSize)] buffer containing tracer
                                                         ///< data in raw format
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricTracerReadDataExp", "zet_metric_tracer_exp_handle_t hMetricTracer,size_t* pRawDataSize,uint8_t* pRawData");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetricTracer, pRawDataSize, pRawData);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricTracerReadDataExp(";
@@ -2186,10 +2806,20 @@ namespace validation_layer
         zet_metric_tracer_exp_handle_t hMetricTracer,   ///< [in] handle of the metric tracer
         zet_metric_decoder_exp_handle_t* phMetricDecoder///< [out] handle of the metric decoder object
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricDecoderCreateExp", "zet_metric_tracer_exp_handle_t hMetricTracer,zet_metric_decoder_exp_handle_t* phMetricDecoder");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetricTracer, phMetricDecoder);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricDecoderCreateExp(";
@@ -2214,10 +2844,20 @@ namespace validation_layer
         ze_result_t result,
         zet_metric_decoder_exp_handle_t phMetricDecoder ///< [in] handle of the metric decoder object
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricDecoderDestroyExp", "zet_metric_decoder_exp_handle_t phMetricDecoder");
+            context.binaryTrace->record(binaryTraceApiId, result, phMetricDecoder);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricDecoderDestroyExp(";
@@ -2244,10 +2884,20 @@ namespace validation_layer
         zet_metric_handle_t* phMetrics                  ///< [in,out] [range(0, *pCount)] array of handles of decodable metrics in
                                                         ///< the hMetricDecoder handle provided.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricDecoderGetDecodableMetricsExp", "zet_metric_decoder_exp_handle_t hMetricDecoder,uint32_t* pCount,zet_metric_handle_t* phMetrics");
+            context.binaryTrace->record(binaryTraceApiId, result, hMetricDecoder, pCount, phMetrics);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricDecoderGetDecodableMetricsExp(";
@@ -2310,10 +2960,20 @@ namespace validation_layer
         zet_metric_entry_exp_t* pMetricEntries          ///< [in,out][optional][range(0, *pMetricEntriesCount)] buffer containing
                                                         ///< decoded metric entries
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetMetricTracerDecodeExp", "zet_metric_decoder_exp_handle_t phMetricDecoder,size_t* pRawDataSize,uint8_t* pRawData,uint32_t metricsCount,zet_metric_handle_t* phMetrics,uint32_t* pSetCount,uint32_t* pMetricEntriesCountPerSet,uint32_t* pMetricEntriesCount,zet_metric_entry_exp_t* pMetricEntries");
+            context.binaryTrace->record(binaryTraceApiId, result, phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetrics, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetMetricTracerDecodeExp(";
@@ -2365,10 +3025,20 @@ namespace validation_layer
                                                         ///< marker is supoported by the metric group.
         uint32_t value                                  ///< [in] marker value
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetCommandListAppendMarkerExp", "zet_command_list_handle_t hCommandList,zet_metric_group_handle_t hMetricGroup,uint32_t value");
+            context.binaryTrace->record(binaryTraceApiId, result, hCommandList, hMetricGroup, value);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetCommandListAppendMarkerExp(";
@@ -2392,10 +3062,20 @@ namespace validation_layer
         ze_result_t result,
         zet_device_handle_t hDevice                     ///< [in] handle of the device where metrics collection has to be enabled.
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetDeviceEnableMetricsExp", "zet_device_handle_t hDevice");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetDeviceEnableMetricsExp(";
@@ -2411,10 +3091,20 @@ namespace validation_layer
         ze_result_t result,
         zet_device_handle_t hDevice                     ///< [in] handle of the device where metrics collection has to be disabled
 ) {
+        // Binary trace: one fixed-size record per call, independent of the text log level
+        if (context.binaryTrace) {
+            static const uint32_t binaryTraceApiId = context.binaryTrace->registerApi(
+                "zetDeviceDisableMetricsExp", "zet_device_handle_t hDevice");
+            context.binaryTrace->record(binaryTraceApiId, result, hDevice);
+        }
         // Only log success results if verbose logging is enabled
         if (result == ZE_RESULT_SUCCESS && !context.verboseLogging) {
             return result;
         }
+        // Skip formatting the parameters when trace logging is filtered out
+        if (!context.logger->shouldLog(loader::LogLevel::trace)) {
+            return result;
+        }
         std::string status = (result == ZE_RESULT_SUCCESS) ? "SUCCESS" : "ERROR";
         std::ostringstream oss;
         oss << status << " (" << loader::to_string(result) << ") in zetDeviceDisableMetricsExp(";
@@ -2437,16 +3127,24 @@ namespace validation_layer
         uint8_t* pDebugInfo                             ///< [in,out][optional] byte pointer to debug info
         )
     {
-        context.logger->log_trace("zetModuleGetDebugInfo(hModule, format, pSize, pDebugInfo)");
+        ZEL_LOG_TRACE(context.logger, "zetModuleGetDebugInfo(hModule, format, pSize, pDebugInfo)");
 
         auto pfnGetDebugInfo = context.zetDdiTable.Module.pfnGetDebugInfo;
 
         if( nullptr == pfnGetDebugInfo )
             return logAndPropagateResult_zetModuleGetDebugInfo(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hModule, format, pSize, pDebugInfo);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetModuleGetDebugInfoPrologue( hModule, format, pSize, pDebugInfo );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetModuleGetDebugInfoPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetModuleGetDebugInfoPrologue) {
+                auto result = checker->zetModuleGetDebugInfoPrologue( hModule, format, pSize, pDebugInfo );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetModuleGetDebugInfo(result, hModule, format, pSize, pDebugInfo);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetModuleGetDebugInfoPrologue) {
+            auto result = checker->zetModuleGetDebugInfoPrologue( hModule, format, pSize, pDebugInfo );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetModuleGetDebugInfo(result, hModule, format, pSize, pDebugInfo);
         }
 
@@ -2456,15 +3154,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetModuleGetDebugInfoPrologue( hModule, format, pSize, pDebugInfo );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetModuleGetDebugInfo(result, hModule, format, pSize, pDebugInfo);
         }
 
         auto driver_result = pfnGetDebugInfo( hModule, format, pSize, pDebugInfo );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetModuleGetDebugInfoEpilogue( hModule, format, pSize, pDebugInfo ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetModuleGetDebugInfoEpilogue) {
+                auto result = checker->zetModuleGetDebugInfoEpilogue( hModule, format, pSize, pDebugInfo ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetModuleGetDebugInfo(result, hModule, format, pSize, pDebugInfo);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetModuleGetDebugInfoEpilogue) {
+            auto result = checker->zetModuleGetDebugInfoEpilogue( hModule, format, pSize, pDebugInfo ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetModuleGetDebugInfo(result, hModule, format, pSize, pDebugInfo);
         }
 
@@ -2479,16 +3184,24 @@ namespace validation_layer
         zet_device_debug_properties_t* pDebugProperties ///< [in,out] query result for debug properties
         )
     {
-        context.logger->log_trace("zetDeviceGetDebugProperties(hDevice, pDebugProperties)");
+        ZEL_LOG_TRACE(context.logger, "zetDeviceGetDebugProperties(hDevice, pDebugProperties)");
 
         auto pfnGetDebugProperties = context.zetDdiTable.Device.pfnGetDebugProperties;
 
         if( nullptr == pfnGetDebugProperties )
             return logAndPropagateResult_zetDeviceGetDebugProperties(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pDebugProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDeviceGetDebugPropertiesPrologue( hDevice, pDebugProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetDeviceGetDebugPropertiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDeviceGetDebugPropertiesPrologue) {
+                auto result = checker->zetDeviceGetDebugPropertiesPrologue( hDevice, pDebugProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDeviceGetDebugProperties(result, hDevice, pDebugProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDeviceGetDebugPropertiesPrologue) {
+            auto result = checker->zetDeviceGetDebugPropertiesPrologue( hDevice, pDebugProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDeviceGetDebugProperties(result, hDevice, pDebugProperties);
         }
 
@@ -2498,15 +3211,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDeviceGetDebugPropertiesPrologue( hDevice, pDebugProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDeviceGetDebugProperties(result, hDevice, pDebugProperties);
         }
 
         auto driver_result = pfnGetDebugProperties( hDevice, pDebugProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDeviceGetDebugPropertiesEpilogue( hDevice, pDebugProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDeviceGetDebugPropertiesEpilogue) {
+                auto result = checker->zetDeviceGetDebugPropertiesEpilogue( hDevice, pDebugProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDeviceGetDebugProperties(result, hDevice, pDebugProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDeviceGetDebugPropertiesEpilogue) {
+            auto result = checker->zetDeviceGetDebugPropertiesEpilogue( hDevice, pDebugProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDeviceGetDebugProperties(result, hDevice, pDebugProperties);
         }
 
@@ -2522,16 +3242,24 @@ namespace validation_layer
         zet_debug_session_handle_t* phDebug             ///< [out] debug session handle
         )
     {
-        context.logger->log_trace("zetDebugAttach(hDevice, config, phDebug)");
+        ZEL_LOG_TRACE(context.logger, "zetDebugAttach(hDevice, config, phDebug)");
 
         auto pfnAttach = context.zetDdiTable.Debug.pfnAttach;
 
         if( nullptr == pfnAttach )
             return logAndPropagateResult_zetDebugAttach(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, config, phDebug);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugAttachPrologue( hDevice, config, phDebug );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetDebugAttachPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDebugAttachPrologue) {
+                auto result = checker->zetDebugAttachPrologue( hDevice, config, phDebug );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugAttach(result, hDevice, config, phDebug);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDebugAttachPrologue) {
+            auto result = checker->zetDebugAttachPrologue( hDevice, config, phDebug );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugAttach(result, hDevice, config, phDebug);
         }
 
@@ -2541,15 +3269,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugAttachPrologue( hDevice, config, phDebug );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugAttach(result, hDevice, config, phDebug);
         }
 
         auto driver_result = pfnAttach( hDevice, config, phDebug );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugAttachEpilogue( hDevice, config, phDebug ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDebugAttachEpilogue) {
+                auto result = checker->zetDebugAttachEpilogue( hDevice, config, phDebug ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugAttach(result, hDevice, config, phDebug);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDebugAttachEpilogue) {
+            auto result = checker->zetDebugAttachEpilogue( hDevice, config, phDebug ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugAttach(result, hDevice, config, phDebug);
         }
 
@@ -2563,16 +3298,24 @@ namespace validation_layer
         zet_debug_session_handle_t hDebug               ///< [in][release] debug session handle
         )
     {
-        context.logger->log_trace("zetDebugDetach(hDebug)");
+        ZEL_LOG_TRACE(context.logger, "zetDebugDetach(hDebug)");
 
         auto pfnDetach = context.zetDdiTable.Debug.pfnDetach;
 
         if( nullptr == pfnDetach )
             return logAndPropagateResult_zetDebugDetach(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDebug);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugDetachPrologue( hDebug );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetDebugDetachPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDebugDetachPrologue) {
+                auto result = checker->zetDebugDetachPrologue( hDebug );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugDetach(result, hDebug);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDebugDetachPrologue) {
+            auto result = checker->zetDebugDetachPrologue( hDebug );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugDetach(result, hDebug);
         }
 
@@ -2582,15 +3325,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugDetachPrologue( hDebug );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugDetach(result, hDebug);
         }
 
         auto driver_result = pfnDetach( hDebug );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugDetachEpilogue( hDebug ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDebugDetachEpilogue) {
+                auto result = checker->zetDebugDetachEpilogue( hDebug ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugDetach(result, hDebug);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDebugDetachEpilogue) {
+            auto result = checker->zetDebugDetachEpilogue( hDebug ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugDetach(result, hDebug);
         }
 
@@ -2612,16 +3362,24 @@ namespace validation_layer
         zet_debug_event_t* event                        ///< [in,out] a pointer to a ::zet_debug_event_t.
         )
     {
-        context.logger->log_trace("zetDebugReadEvent(hDebug, timeout, event)");
+        ZEL_LOG_TRACE(context.logger, "zetDebugReadEvent(hDebug, timeout, event)");
 
         auto pfnReadEvent = context.zetDdiTable.Debug.pfnReadEvent;
 
         if( nullptr == pfnReadEvent )
             return logAndPropagateResult_zetDebugReadEvent(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDebug, timeout, event);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugReadEventPrologue( hDebug, timeout, event );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetDebugReadEventPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDebugReadEventPrologue) {
+                auto result = checker->zetDebugReadEventPrologue( hDebug, timeout, event );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugReadEvent(result, hDebug, timeout, event);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDebugReadEventPrologue) {
+            auto result = checker->zetDebugReadEventPrologue( hDebug, timeout, event );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugReadEvent(result, hDebug, timeout, event);
         }
 
@@ -2631,15 +3389,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugReadEventPrologue( hDebug, timeout, event );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugReadEvent(result, hDebug, timeout, event);
         }
 
         auto driver_result = pfnReadEvent( hDebug, timeout, event );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugReadEventEpilogue( hDebug, timeout, event ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDebugReadEventEpilogue) {
+                auto result = checker->zetDebugReadEventEpilogue( hDebug, timeout, event ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugReadEvent(result, hDebug, timeout, event);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDebugReadEventEpilogue) {
+            auto result = checker->zetDebugReadEventEpilogue( hDebug, timeout, event ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugReadEvent(result, hDebug, timeout, event);
         }
 
@@ -2654,16 +3419,24 @@ namespace validation_layer
         const zet_debug_event_t* event                  ///< [in] a pointer to a ::zet_debug_event_t.
         )
     {
-        context.logger->log_trace("zetDebugAcknowledgeEvent(hDebug, event)");
+        ZEL_LOG_TRACE(context.logger, "zetDebugAcknowledgeEvent(hDebug, event)");
 
         auto pfnAcknowledgeEvent = context.zetDdiTable.Debug.pfnAcknowledgeEvent;
 
         if( nullptr == pfnAcknowledgeEvent )
             return logAndPropagateResult_zetDebugAcknowledgeEvent(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDebug, event);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugAcknowledgeEventPrologue( hDebug, event );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetDebugAcknowledgeEventPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDebugAcknowledgeEventPrologue) {
+                auto result = checker->zetDebugAcknowledgeEventPrologue( hDebug, event );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugAcknowledgeEvent(result, hDebug, event);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDebugAcknowledgeEventPrologue) {
+            auto result = checker->zetDebugAcknowledgeEventPrologue( hDebug, event );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugAcknowledgeEvent(result, hDebug, event);
         }
 
@@ -2673,15 +3446,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugAcknowledgeEventPrologue( hDebug, event );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugAcknowledgeEvent(result, hDebug, event);
         }
 
         auto driver_result = pfnAcknowledgeEvent( hDebug, event );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugAcknowledgeEventEpilogue( hDebug, event ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDebugAcknowledgeEventEpilogue) {
+                auto result = checker->zetDebugAcknowledgeEventEpilogue( hDebug, event ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugAcknowledgeEvent(result, hDebug, event);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDebugAcknowledgeEventEpilogue) {
+            auto result = checker->zetDebugAcknowledgeEventEpilogue( hDebug, event ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugAcknowledgeEvent(result, hDebug, event);
         }
 
@@ -2696,16 +3476,24 @@ namespace validation_layer
         ze_device_thread_t thread                       ///< [in] the thread to interrupt
         )
     {
-        context.logger->log_trace("zetDebugInterrupt(hDebug, thread)");
+        ZEL_LOG_TRACE(context.logger, "zetDebugInterrupt(hDebug, thread)");
 
         auto pfnInterrupt = context.zetDdiTable.Debug.pfnInterrupt;
 
         if( nullptr == pfnInterrupt )
             return logAndPropagateResult_zetDebugInterrupt(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDebug, thread);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugInterruptPrologue( hDebug, thread );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetDebugInterruptPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDebugInterruptPrologue) {
+                auto result = checker->zetDebugInterruptPrologue( hDebug, thread );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugInterrupt(result, hDebug, thread);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDebugInterruptPrologue) {
+            auto result = checker->zetDebugInterruptPrologue( hDebug, thread );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugInterrupt(result, hDebug, thread);
         }
 
@@ -2715,15 +3503,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugInterruptPrologue( hDebug, thread );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugInterrupt(result, hDebug, thread);
         }
 
         auto driver_result = pfnInterrupt( hDebug, thread );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugInterruptEpilogue( hDebug, thread ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDebugInterruptEpilogue) {
+                auto result = checker->zetDebugInterruptEpilogue( hDebug, thread ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugInterrupt(result, hDebug, thread);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDebugInterruptEpilogue) {
+            auto result = checker->zetDebugInterruptEpilogue( hDebug, thread ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugInterrupt(result, hDebug, thread);
         }
 
@@ -2738,16 +3533,24 @@ namespace validation_layer
         ze_device_thread_t thread                       ///< [in] the thread to resume
         )
     {
-        context.logger->log_trace("zetDebugResume(hDebug, thread)");
+        ZEL_LOG_TRACE(context.logger, "zetDebugResume(hDebug, thread)");
 
         auto pfnResume = context.zetDdiTable.Debug.pfnResume;
 
         if( nullptr == pfnResume )
             return logAndPropagateResult_zetDebugResume(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDebug, thread);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugResumePrologue( hDebug, thread );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetDebugResumePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDebugResumePrologue) {
+                auto result = checker->zetDebugResumePrologue( hDebug, thread );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugResume(result, hDebug, thread);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDebugResumePrologue) {
+            auto result = checker->zetDebugResumePrologue( hDebug, thread );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugResume(result, hDebug, thread);
         }
 
@@ -2757,15 +3560,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugResumePrologue( hDebug, thread );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugResume(result, hDebug, thread);
         }
 
         auto driver_result = pfnResume( hDebug, thread );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugResumeEpilogue( hDebug, thread ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDebugResumeEpilogue) {
+                auto result = checker->zetDebugResumeEpilogue( hDebug, thread ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugResume(result, hDebug, thread);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDebugResumeEpilogue) {
+            auto result = checker->zetDebugResumeEpilogue( hDebug, thread ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugResume(result, hDebug, thread);
         }
 
@@ -2783,16 +3593,24 @@ namespace validation_layer
         void* buffer                                    ///< [in,out] a buffer to hold a copy of the memory
         )
     {
-        context.logger->log_trace("zetDebugReadMemory(hDebug, thread, desc, size, buffer)");
+        ZEL_LOG_TRACE(context.logger, "zetDebugReadMemory(hDebug, thread, desc, size, buffer)");
 
         auto pfnReadMemory = context.zetDdiTable.Debug.pfnReadMemory;
 
         if( nullptr == pfnReadMemory )
             return logAndPropagateResult_zetDebugReadMemory(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDebug, thread, desc, size, buffer);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugReadMemoryPrologue( hDebug, thread, desc, size, buffer );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetDebugReadMemoryPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDebugReadMemoryPrologue) {
+                auto result = checker->zetDebugReadMemoryPrologue( hDebug, thread, desc, size, buffer );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugReadMemory(result, hDebug, thread, desc, size, buffer);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDebugReadMemoryPrologue) {
+            auto result = checker->zetDebugReadMemoryPrologue( hDebug, thread, desc, size, buffer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugReadMemory(result, hDebug, thread, desc, size, buffer);
         }
 
@@ -2802,15 +3620,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugReadMemoryPrologue( hDebug, thread, desc, size, buffer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugReadMemory(result, hDebug, thread, desc, size, buffer);
         }
 
         auto driver_result = pfnReadMemory( hDebug, thread, desc, size, buffer );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugReadMemoryEpilogue( hDebug, thread, desc, size, buffer ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDebugReadMemoryEpilogue) {
+                auto result = checker->zetDebugReadMemoryEpilogue( hDebug, thread, desc, size, buffer ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugReadMemory(result, hDebug, thread, desc, size, buffer);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDebugReadMemoryEpilogue) {
+            auto result = checker->zetDebugReadMemoryEpilogue( hDebug, thread, desc, size, buffer ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugReadMemory(result, hDebug, thread, desc, size, buffer);
         }
 
@@ -2828,16 +3653,24 @@ namespace validation_layer
         const void* buffer                              ///< [in] a buffer holding the pattern to write
         )
     {
-        context.logger->log_trace("zetDebugWriteMemory(hDebug, thread, desc, size, buffer)");
+        ZEL_LOG_TRACE(context.logger, "zetDebugWriteMemory(hDebug, thread, desc, size, buffer)");
 
         auto pfnWriteMemory = context.zetDdiTable.Debug.pfnWriteMemory;
 
         if( nullptr == pfnWriteMemory )
             return logAndPropagateResult_zetDebugWriteMemory(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDebug, thread, desc, size, buffer);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugWriteMemoryPrologue( hDebug, thread, desc, size, buffer );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetDebugWriteMemoryPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDebugWriteMemoryPrologue) {
+                auto result = checker->zetDebugWriteMemoryPrologue( hDebug, thread, desc, size, buffer );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugWriteMemory(result, hDebug, thread, desc, size, buffer);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDebugWriteMemoryPrologue) {
+            auto result = checker->zetDebugWriteMemoryPrologue( hDebug, thread, desc, size, buffer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugWriteMemory(result, hDebug, thread, desc, size, buffer);
         }
 
@@ -2847,15 +3680,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugWriteMemoryPrologue( hDebug, thread, desc, size, buffer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugWriteMemory(result, hDebug, thread, desc, size, buffer);
         }
 
         auto driver_result = pfnWriteMemory( hDebug, thread, desc, size, buffer );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugWriteMemoryEpilogue( hDebug, thread, desc, size, buffer ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDebugWriteMemoryEpilogue) {
+                auto result = checker->zetDebugWriteMemoryEpilogue( hDebug, thread, desc, size, buffer ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugWriteMemory(result, hDebug, thread, desc, size, buffer);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDebugWriteMemoryEpilogue) {
+            auto result = checker->zetDebugWriteMemoryEpilogue( hDebug, thread, desc, size, buffer ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugWriteMemory(result, hDebug, thread, desc, size, buffer);
         }
 
@@ -2879,16 +3719,24 @@ namespace validation_layer
                                                         ///< then driver shall only retrieve that number of register set properties.
         )
     {
-        context.logger->log_trace("zetDebugGetRegisterSetProperties(hDevice, pCount, pRegisterSetProperties)");
+        ZEL_LOG_TRACE(context.logger, "zetDebugGetRegisterSetProperties(hDevice, pCount, pRegisterSetProperties)");
 
         auto pfnGetRegisterSetProperties = context.zetDdiTable.Debug.pfnGetRegisterSetProperties;
 
         if( nullptr == pfnGetRegisterSetProperties )
             return logAndPropagateResult_zetDebugGetRegisterSetProperties(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pCount, pRegisterSetProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugGetRegisterSetPropertiesPrologue( hDevice, pCount, pRegisterSetProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetDebugGetRegisterSetPropertiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDebugGetRegisterSetPropertiesPrologue) {
+                auto result = checker->zetDebugGetRegisterSetPropertiesPrologue( hDevice, pCount, pRegisterSetProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugGetRegisterSetProperties(result, hDevice, pCount, pRegisterSetProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDebugGetRegisterSetPropertiesPrologue) {
+            auto result = checker->zetDebugGetRegisterSetPropertiesPrologue( hDevice, pCount, pRegisterSetProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugGetRegisterSetProperties(result, hDevice, pCount, pRegisterSetProperties);
         }
 
@@ -2898,15 +3746,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugGetRegisterSetPropertiesPrologue( hDevice, pCount, pRegisterSetProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugGetRegisterSetProperties(result, hDevice, pCount, pRegisterSetProperties);
         }
 
         auto driver_result = pfnGetRegisterSetProperties( hDevice, pCount, pRegisterSetProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugGetRegisterSetPropertiesEpilogue( hDevice, pCount, pRegisterSetProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDebugGetRegisterSetPropertiesEpilogue) {
+                auto result = checker->zetDebugGetRegisterSetPropertiesEpilogue( hDevice, pCount, pRegisterSetProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugGetRegisterSetProperties(result, hDevice, pCount, pRegisterSetProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDebugGetRegisterSetPropertiesEpilogue) {
+            auto result = checker->zetDebugGetRegisterSetPropertiesEpilogue( hDevice, pCount, pRegisterSetProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugGetRegisterSetProperties(result, hDevice, pCount, pRegisterSetProperties);
         }
 
@@ -2931,16 +3786,24 @@ namespace validation_layer
                                                         ///< then driver shall only retrieve that number of register set properties.
         )
     {
-        context.logger->log_trace("zetDebugGetThreadRegisterSetProperties(hDebug, thread, pCount, pRegisterSetProperties)");
+        ZEL_LOG_TRACE(context.logger, "zetDebugGetThreadRegisterSetProperties(hDebug, thread, pCount, pRegisterSetProperties)");
 
         auto pfnGetThreadRegisterSetProperties = context.zetDdiTable.Debug.pfnGetThreadRegisterSetProperties;
 
         if( nullptr == pfnGetThreadRegisterSetProperties )
             return logAndPropagateResult_zetDebugGetThreadRegisterSetProperties(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDebug, thread, pCount, pRegisterSetProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugGetThreadRegisterSetPropertiesPrologue( hDebug, thread, pCount, pRegisterSetProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetDebugGetThreadRegisterSetPropertiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDebugGetThreadRegisterSetPropertiesPrologue) {
+                auto result = checker->zetDebugGetThreadRegisterSetPropertiesPrologue( hDebug, thread, pCount, pRegisterSetProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugGetThreadRegisterSetProperties(result, hDebug, thread, pCount, pRegisterSetProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDebugGetThreadRegisterSetPropertiesPrologue) {
+            auto result = checker->zetDebugGetThreadRegisterSetPropertiesPrologue( hDebug, thread, pCount, pRegisterSetProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugGetThreadRegisterSetProperties(result, hDebug, thread, pCount, pRegisterSetProperties);
         }
 
@@ -2950,15 +3813,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugGetThreadRegisterSetPropertiesPrologue( hDebug, thread, pCount, pRegisterSetProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugGetThreadRegisterSetProperties(result, hDebug, thread, pCount, pRegisterSetProperties);
         }
 
         auto driver_result = pfnGetThreadRegisterSetProperties( hDebug, thread, pCount, pRegisterSetProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugGetThreadRegisterSetPropertiesEpilogue( hDebug, thread, pCount, pRegisterSetProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDebugGetThreadRegisterSetPropertiesEpilogue) {
+                auto result = checker->zetDebugGetThreadRegisterSetPropertiesEpilogue( hDebug, thread, pCount, pRegisterSetProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugGetThreadRegisterSetProperties(result, hDebug, thread, pCount, pRegisterSetProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDebugGetThreadRegisterSetPropertiesEpilogue) {
+            auto result = checker->zetDebugGetThreadRegisterSetPropertiesEpilogue( hDebug, thread, pCount, pRegisterSetProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugGetThreadRegisterSetProperties(result, hDebug, thread, pCount, pRegisterSetProperties);
         }
 
@@ -2981,16 +3851,24 @@ namespace validation_layer
         void* pRegisterValues                           ///< [in,out][optional][range(0, count)] buffer of register values
         )
     {
-        context.logger->log_trace("zetDebugReadRegisters(hDebug, thread, type, start, count, pRegisterValues)");
+        ZEL_LOG_TRACE(context.logger, "zetDebugReadRegisters(hDebug, thread, type, start, count, pRegisterValues)");
 
         auto pfnReadRegisters = context.zetDdiTable.Debug.pfnReadRegisters;
 
         if( nullptr == pfnReadRegisters )
             return logAndPropagateResult_zetDebugReadRegisters(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDebug, thread, type, start, count, pRegisterValues);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugReadRegistersPrologue( hDebug, thread, type, start, count, pRegisterValues );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetDebugReadRegistersPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDebugReadRegistersPrologue) {
+                auto result = checker->zetDebugReadRegistersPrologue( hDebug, thread, type, start, count, pRegisterValues );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugReadRegisters(result, hDebug, thread, type, start, count, pRegisterValues);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDebugReadRegistersPrologue) {
+            auto result = checker->zetDebugReadRegistersPrologue( hDebug, thread, type, start, count, pRegisterValues );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugReadRegisters(result, hDebug, thread, type, start, count, pRegisterValues);
         }
 
@@ -3000,15 +3878,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugReadRegistersPrologue( hDebug, thread, type, start, count, pRegisterValues );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugReadRegisters(result, hDebug, thread, type, start, count, pRegisterValues);
         }
 
         auto driver_result = pfnReadRegisters( hDebug, thread, type, start, count, pRegisterValues );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugReadRegistersEpilogue( hDebug, thread, type, start, count, pRegisterValues ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDebugReadRegistersEpilogue) {
+                auto result = checker->zetDebugReadRegistersEpilogue( hDebug, thread, type, start, count, pRegisterValues ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugReadRegisters(result, hDebug, thread, type, start, count, pRegisterValues);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDebugReadRegistersEpilogue) {
+            auto result = checker->zetDebugReadRegistersEpilogue( hDebug, thread, type, start, count, pRegisterValues ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugReadRegisters(result, hDebug, thread, type, start, count, pRegisterValues);
         }
 
@@ -3031,16 +3916,24 @@ namespace validation_layer
         void* pRegisterValues                           ///< [in,out][optional][range(0, count)] buffer of register values
         )
     {
-        context.logger->log_trace("zetDebugWriteRegisters(hDebug, thread, type, start, count, pRegisterValues)");
+        ZEL_LOG_TRACE(context.logger, "zetDebugWriteRegisters(hDebug, thread, type, start, count, pRegisterValues)");
 
         auto pfnWriteRegisters = context.zetDdiTable.Debug.pfnWriteRegisters;
 
         if( nullptr == pfnWriteRegisters )
             return logAndPropagateResult_zetDebugWriteRegisters(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDebug, thread, type, start, count, pRegisterValues);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugWriteRegistersPrologue( hDebug, thread, type, start, count, pRegisterValues );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetDebugWriteRegistersPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDebugWriteRegistersPrologue) {
+                auto result = checker->zetDebugWriteRegistersPrologue( hDebug, thread, type, start, count, pRegisterValues );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugWriteRegisters(result, hDebug, thread, type, start, count, pRegisterValues);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDebugWriteRegistersPrologue) {
+            auto result = checker->zetDebugWriteRegistersPrologue( hDebug, thread, type, start, count, pRegisterValues );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugWriteRegisters(result, hDebug, thread, type, start, count, pRegisterValues);
         }
 
@@ -3050,15 +3943,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugWriteRegistersPrologue( hDebug, thread, type, start, count, pRegisterValues );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugWriteRegisters(result, hDebug, thread, type, start, count, pRegisterValues);
         }
 
         auto driver_result = pfnWriteRegisters( hDebug, thread, type, start, count, pRegisterValues );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugWriteRegistersEpilogue( hDebug, thread, type, start, count, pRegisterValues ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDebugWriteRegistersEpilogue) {
+                auto result = checker->zetDebugWriteRegistersEpilogue( hDebug, thread, type, start, count, pRegisterValues ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugWriteRegisters(result, hDebug, thread, type, start, count, pRegisterValues);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDebugWriteRegistersEpilogue) {
+            auto result = checker->zetDebugWriteRegistersEpilogue( hDebug, thread, type, start, count, pRegisterValues ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDebugWriteRegisters(result, hDebug, thread, type, start, count, pRegisterValues);
         }
 
@@ -3081,16 +3981,24 @@ namespace validation_layer
                                                         ///< driver shall only retrieve that number of metric groups.
         )
     {
-        context.logger->log_trace("zetMetricGroupGet(hDevice, pCount, phMetricGroups)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricGroupGet(hDevice, pCount, phMetricGroups)");
 
         auto pfnGet = context.zetDdiTable.MetricGroup.pfnGet;
 
         if( nullptr == pfnGet )
             return logAndPropagateResult_zetMetricGroupGet(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pCount, phMetricGroups);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupGetPrologue( hDevice, pCount, phMetricGroups );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricGroupGetPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricGroupGetPrologue) {
+                auto result = checker->zetMetricGroupGetPrologue( hDevice, pCount, phMetricGroups );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupGet(result, hDevice, pCount, phMetricGroups);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricGroupGetPrologue) {
+            auto result = checker->zetMetricGroupGetPrologue( hDevice, pCount, phMetricGroups );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupGet(result, hDevice, pCount, phMetricGroups);
         }
 
@@ -3100,15 +4008,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupGetPrologue( hDevice, pCount, phMetricGroups );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupGet(result, hDevice, pCount, phMetricGroups);
         }
 
         auto driver_result = pfnGet( hDevice, pCount, phMetricGroups );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupGetEpilogue( hDevice, pCount, phMetricGroups ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricGroupGetEpilogue) {
+                auto result = checker->zetMetricGroupGetEpilogue( hDevice, pCount, phMetricGroups ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupGet(result, hDevice, pCount, phMetricGroups);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricGroupGetEpilogue) {
+            auto result = checker->zetMetricGroupGetEpilogue( hDevice, pCount, phMetricGroups ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupGet(result, hDevice, pCount, phMetricGroups);
         }
 
@@ -3133,16 +4048,24 @@ namespace validation_layer
         zet_metric_group_properties_t* pProperties      ///< [in,out] metric group properties
         )
     {
-        context.logger->log_trace("zetMetricGroupGetProperties(hMetricGroup, pProperties)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricGroupGetProperties(hMetricGroup, pProperties)");
 
         auto pfnGetProperties = context.zetDdiTable.MetricGroup.pfnGetProperties;
 
         if( nullptr == pfnGetProperties )
             return logAndPropagateResult_zetMetricGroupGetProperties(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetricGroup, pProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupGetPropertiesPrologue( hMetricGroup, pProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricGroupGetPropertiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricGroupGetPropertiesPrologue) {
+                auto result = checker->zetMetricGroupGetPropertiesPrologue( hMetricGroup, pProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupGetProperties(result, hMetricGroup, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricGroupGetPropertiesPrologue) {
+            auto result = checker->zetMetricGroupGetPropertiesPrologue( hMetricGroup, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupGetProperties(result, hMetricGroup, pProperties);
         }
 
@@ -3152,15 +4075,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupGetPropertiesPrologue( hMetricGroup, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupGetProperties(result, hMetricGroup, pProperties);
         }
 
         auto driver_result = pfnGetProperties( hMetricGroup, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupGetPropertiesEpilogue( hMetricGroup, pProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricGroupGetPropertiesEpilogue) {
+                auto result = checker->zetMetricGroupGetPropertiesEpilogue( hMetricGroup, pProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupGetProperties(result, hMetricGroup, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricGroupGetPropertiesEpilogue) {
+            auto result = checker->zetMetricGroupGetPropertiesEpilogue( hMetricGroup, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupGetProperties(result, hMetricGroup, pProperties);
         }
 
@@ -3186,16 +4116,24 @@ namespace validation_layer
                                                         ///< then driver shall only calculate that number of metric values.
         )
     {
-        context.logger->log_trace("zetMetricGroupCalculateMetricValues(hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricGroupCalculateMetricValues(hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues)");
 
         auto pfnCalculateMetricValues = context.zetDdiTable.MetricGroup.pfnCalculateMetricValues;
 
         if( nullptr == pfnCalculateMetricValues )
             return logAndPropagateResult_zetMetricGroupCalculateMetricValues(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCalculateMetricValuesPrologue( hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricGroupCalculateMetricValuesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricGroupCalculateMetricValuesPrologue) {
+                auto result = checker->zetMetricGroupCalculateMetricValuesPrologue( hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupCalculateMetricValues(result, hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricGroupCalculateMetricValuesPrologue) {
+            auto result = checker->zetMetricGroupCalculateMetricValuesPrologue( hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupCalculateMetricValues(result, hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues);
         }
 
@@ -3205,15 +4143,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupCalculateMetricValuesPrologue( hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupCalculateMetricValues(result, hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues);
         }
 
         auto driver_result = pfnCalculateMetricValues( hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCalculateMetricValuesEpilogue( hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricGroupCalculateMetricValuesEpilogue) {
+                auto result = checker->zetMetricGroupCalculateMetricValuesEpilogue( hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupCalculateMetricValues(result, hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricGroupCalculateMetricValuesEpilogue) {
+            auto result = checker->zetMetricGroupCalculateMetricValuesEpilogue( hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupCalculateMetricValues(result, hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues);
         }
 
@@ -3235,16 +4180,24 @@ namespace validation_layer
                                                         ///< shall only retrieve that number of metrics.
         )
     {
-        context.logger->log_trace("zetMetricGet(hMetricGroup, pCount, phMetrics)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricGet(hMetricGroup, pCount, phMetrics)");
 
         auto pfnGet = context.zetDdiTable.Metric.pfnGet;
 
         if( nullptr == pfnGet )
             return logAndPropagateResult_zetMetricGet(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetricGroup, pCount, phMetrics);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGetPrologue( hMetricGroup, pCount, phMetrics );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricGetPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricGetPrologue) {
+                auto result = checker->zetMetricGetPrologue( hMetricGroup, pCount, phMetrics );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGet(result, hMetricGroup, pCount, phMetrics);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricGetPrologue) {
+            auto result = checker->zetMetricGetPrologue( hMetricGroup, pCount, phMetrics );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGet(result, hMetricGroup, pCount, phMetrics);
         }
 
@@ -3254,15 +4207,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGetPrologue( hMetricGroup, pCount, phMetrics );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGet(result, hMetricGroup, pCount, phMetrics);
         }
 
         auto driver_result = pfnGet( hMetricGroup, pCount, phMetrics );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGetEpilogue( hMetricGroup, pCount, phMetrics ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricGetEpilogue) {
+                auto result = checker->zetMetricGetEpilogue( hMetricGroup, pCount, phMetrics ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGet(result, hMetricGroup, pCount, phMetrics);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricGetEpilogue) {
+            auto result = checker->zetMetricGetEpilogue( hMetricGroup, pCount, phMetrics ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGet(result, hMetricGroup, pCount, phMetrics);
         }
 
@@ -3287,16 +4247,24 @@ namespace validation_layer
         zet_metric_properties_t* pProperties            ///< [in,out] metric properties
         )
     {
-        context.logger->log_trace("zetMetricGetProperties(hMetric, pProperties)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricGetProperties(hMetric, pProperties)");
 
         auto pfnGetProperties = context.zetDdiTable.Metric.pfnGetProperties;
 
         if( nullptr == pfnGetProperties )
             return logAndPropagateResult_zetMetricGetProperties(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetric, pProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGetPropertiesPrologue( hMetric, pProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricGetPropertiesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricGetPropertiesPrologue) {
+                auto result = checker->zetMetricGetPropertiesPrologue( hMetric, pProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGetProperties(result, hMetric, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricGetPropertiesPrologue) {
+            auto result = checker->zetMetricGetPropertiesPrologue( hMetric, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGetProperties(result, hMetric, pProperties);
         }
 
@@ -3306,15 +4274,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGetPropertiesPrologue( hMetric, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGetProperties(result, hMetric, pProperties);
         }
 
         auto driver_result = pfnGetProperties( hMetric, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGetPropertiesEpilogue( hMetric, pProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricGetPropertiesEpilogue) {
+                auto result = checker->zetMetricGetPropertiesEpilogue( hMetric, pProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGetProperties(result, hMetric, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricGetPropertiesEpilogue) {
+            auto result = checker->zetMetricGetPropertiesEpilogue( hMetric, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGetProperties(result, hMetric, pProperties);
         }
 
@@ -3335,16 +4310,24 @@ namespace validation_layer
                                                         ///< metric query and metric stream must use activated metric groups.
         )
     {
-        context.logger->log_trace("zetContextActivateMetricGroups(hContext, hDevice, count, phMetricGroupsLocal)");
+        ZEL_LOG_TRACE(context.logger, "zetContextActivateMetricGroups(hContext, hDevice, count, phMetricGroupsLocal)");
 
         auto pfnActivateMetricGroups = context.zetDdiTable.Context.pfnActivateMetricGroups;
 
         if( nullptr == pfnActivateMetricGroups )
             return logAndPropagateResult_zetContextActivateMetricGroups(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hContext, hDevice, count, phMetricGroups);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetContextActivateMetricGroupsPrologue( hContext, hDevice, count, phMetricGroups );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetContextActivateMetricGroupsPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetContextActivateMetricGroupsPrologue) {
+                auto result = checker->zetContextActivateMetricGroupsPrologue( hContext, hDevice, count, phMetricGroups );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetContextActivateMetricGroups(result, hContext, hDevice, count, phMetricGroups);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetContextActivateMetricGroupsPrologue) {
+            auto result = checker->zetContextActivateMetricGroupsPrologue( hContext, hDevice, count, phMetricGroups );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetContextActivateMetricGroups(result, hContext, hDevice, count, phMetricGroups);
         }
 
@@ -3354,15 +4337,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetContextActivateMetricGroupsPrologue( hContext, hDevice, count, phMetricGroups );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetContextActivateMetricGroups(result, hContext, hDevice, count, phMetricGroups);
         }
 
         auto driver_result = pfnActivateMetricGroups( hContext, hDevice, count, phMetricGroups );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetContextActivateMetricGroupsEpilogue( hContext, hDevice, count, phMetricGroups ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetContextActivateMetricGroupsEpilogue) {
+                auto result = checker->zetContextActivateMetricGroupsEpilogue( hContext, hDevice, count, phMetricGroups ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetContextActivateMetricGroups(result, hContext, hDevice, count, phMetricGroups);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetContextActivateMetricGroupsEpilogue) {
+            auto result = checker->zetContextActivateMetricGroupsEpilogue( hContext, hDevice, count, phMetricGroups ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetContextActivateMetricGroups(result, hContext, hDevice, count, phMetricGroups);
         }
 
@@ -3381,16 +4371,24 @@ namespace validation_layer
         zet_metric_streamer_handle_t* phMetricStreamer  ///< [out] handle of metric streamer
         )
     {
-        context.logger->log_trace("zetMetricStreamerOpen(hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricStreamerOpen(hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer)");
 
         auto pfnOpen = context.zetDdiTable.MetricStreamer.pfnOpen;
 
         if( nullptr == pfnOpen )
             return logAndPropagateResult_zetMetricStreamerOpen(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricStreamerOpenPrologue( hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricStreamerOpenPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricStreamerOpenPrologue) {
+                auto result = checker->zetMetricStreamerOpenPrologue( hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricStreamerOpen(result, hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricStreamerOpenPrologue) {
+            auto result = checker->zetMetricStreamerOpenPrologue( hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricStreamerOpen(result, hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer);
         }
 
@@ -3400,15 +4398,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricStreamerOpenPrologue( hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricStreamerOpen(result, hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer);
         }
 
         auto driver_result = pfnOpen( hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricStreamerOpenEpilogue( hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricStreamerOpenEpilogue) {
+                auto result = checker->zetMetricStreamerOpenEpilogue( hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricStreamerOpen(result, hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricStreamerOpenEpilogue) {
+            auto result = checker->zetMetricStreamerOpenEpilogue( hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricStreamerOpen(result, hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer);
         }
 
@@ -3424,16 +4429,24 @@ namespace validation_layer
         uint32_t value                                  ///< [in] streamer marker value
         )
     {
-        context.logger->log_trace("zetCommandListAppendMetricStreamerMarker(hCommandList, hMetricStreamer, value)");
+        ZEL_LOG_TRACE(context.logger, "zetCommandListAppendMetricStreamerMarker(hCommandList, hMetricStreamer, value)");
 
         auto pfnAppendMetricStreamerMarker = context.zetDdiTable.CommandList.pfnAppendMetricStreamerMarker;
 
         if( nullptr == pfnAppendMetricStreamerMarker )
             return logAndPropagateResult_zetCommandListAppendMetricStreamerMarker(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hCommandList, hMetricStreamer, value);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetCommandListAppendMetricStreamerMarkerPrologue( hCommandList, hMetricStreamer, value );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetCommandListAppendMetricStreamerMarkerPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetCommandListAppendMetricStreamerMarkerPrologue) {
+                auto result = checker->zetCommandListAppendMetricStreamerMarkerPrologue( hCommandList, hMetricStreamer, value );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetCommandListAppendMetricStreamerMarker(result, hCommandList, hMetricStreamer, value);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetCommandListAppendMetricStreamerMarkerPrologue) {
+            auto result = checker->zetCommandListAppendMetricStreamerMarkerPrologue( hCommandList, hMetricStreamer, value );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetCommandListAppendMetricStreamerMarker(result, hCommandList, hMetricStreamer, value);
         }
 
@@ -3443,15 +4456,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetCommandListAppendMetricStreamerMarkerPrologue( hCommandList, hMetricStreamer, value );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetCommandListAppendMetricStreamerMarker(result, hCommandList, hMetricStreamer, value);
         }
 
         auto driver_result = pfnAppendMetricStreamerMarker( hCommandList, hMetricStreamer, value );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetCommandListAppendMetricStreamerMarkerEpilogue( hCommandList, hMetricStreamer, value ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetCommandListAppendMetricStreamerMarkerEpilogue) {
+                auto result = checker->zetCommandListAppendMetricStreamerMarkerEpilogue( hCommandList, hMetricStreamer, value ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetCommandListAppendMetricStreamerMarker(result, hCommandList, hMetricStreamer, value);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetCommandListAppendMetricStreamerMarkerEpilogue) {
+            auto result = checker->zetCommandListAppendMetricStreamerMarkerEpilogue( hCommandList, hMetricStreamer, value ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetCommandListAppendMetricStreamerMarker(result, hCommandList, hMetricStreamer, value);
         }
 
@@ -3465,16 +4485,24 @@ namespace validation_layer
         zet_metric_streamer_handle_t hMetricStreamer    ///< [in][release] handle of the metric streamer
         )
     {
-        context.logger->log_trace("zetMetricStreamerClose(hMetricStreamer)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricStreamerClose(hMetricStreamer)");
 
         auto pfnClose = context.zetDdiTable.MetricStreamer.pfnClose;
 
         if( nullptr == pfnClose )
             return logAndPropagateResult_zetMetricStreamerClose(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetricStreamer);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricStreamerClosePrologue( hMetricStreamer );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricStreamerClosePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricStreamerClosePrologue) {
+                auto result = checker->zetMetricStreamerClosePrologue( hMetricStreamer );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricStreamerClose(result, hMetricStreamer);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricStreamerClosePrologue) {
+            auto result = checker->zetMetricStreamerClosePrologue( hMetricStreamer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricStreamerClose(result, hMetricStreamer);
         }
 
@@ -3484,15 +4512,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricStreamerClosePrologue( hMetricStreamer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricStreamerClose(result, hMetricStreamer);
         }
 
         auto driver_result = pfnClose( hMetricStreamer );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricStreamerCloseEpilogue( hMetricStreamer ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricStreamerCloseEpilogue) {
+                auto result = checker->zetMetricStreamerCloseEpilogue( hMetricStreamer ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricStreamerClose(result, hMetricStreamer);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricStreamerCloseEpilogue) {
+            auto result = checker->zetMetricStreamerCloseEpilogue( hMetricStreamer ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricStreamerClose(result, hMetricStreamer);
         }
 
@@ -3521,16 +4556,24 @@ namespace validation_layer
                                                         ///< reports in raw format
         )
     {
-        context.logger->log_trace("zetMetricStreamerReadData(hMetricStreamer, maxReportCount, pRawDataSize, pRawData)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricStreamerReadData(hMetricStreamer, maxReportCount, pRawDataSize, pRawData)");
 
         auto pfnReadData = context.zetDdiTable.MetricStreamer.pfnReadData;
 
         if( nullptr == pfnReadData )
             return logAndPropagateResult_zetMetricStreamerReadData(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetricStreamer, maxReportCount, pRawDataSize, pRawData);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricStreamerReadDataPrologue( hMetricStreamer, maxReportCount, pRawDataSize, pRawData );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricStreamerReadDataPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricStreamerReadDataPrologue) {
+                auto result = checker->zetMetricStreamerReadDataPrologue( hMetricStreamer, maxReportCount, pRawDataSize, pRawData );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricStreamerReadData(result, hMetricStreamer, maxReportCount, pRawDataSize, pRawData);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricStreamerReadDataPrologue) {
+            auto result = checker->zetMetricStreamerReadDataPrologue( hMetricStreamer, maxReportCount, pRawDataSize, pRawData );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricStreamerReadData(result, hMetricStreamer, maxReportCount, pRawDataSize, pRawData);
         }
 
@@ -3540,15 +4583,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricStreamerReadDataPrologue( hMetricStreamer, maxReportCount, pRawDataSize, pRawData );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricStreamerReadData(result, hMetricStreamer, maxReportCount, pRawDataSize, pRawData);
         }
 
         auto driver_result = pfnReadData( hMetricStreamer, maxReportCount, pRawDataSize, pRawData );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricStreamerReadDataEpilogue( hMetricStreamer, maxReportCount, pRawDataSize, pRawData ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricStreamerReadDataEpilogue) {
+                auto result = checker->zetMetricStreamerReadDataEpilogue( hMetricStreamer, maxReportCount, pRawDataSize, pRawData ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricStreamerReadData(result, hMetricStreamer, maxReportCount, pRawDataSize, pRawData);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricStreamerReadDataEpilogue) {
+            auto result = checker->zetMetricStreamerReadDataEpilogue( hMetricStreamer, maxReportCount, pRawDataSize, pRawData ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricStreamerReadData(result, hMetricStreamer, maxReportCount, pRawDataSize, pRawData);
         }
 
@@ -3566,16 +4616,24 @@ namespace validation_layer
         zet_metric_query_pool_handle_t* phMetricQueryPool   ///< [out] handle of metric query pool
         )
     {
-        context.logger->log_trace("zetMetricQueryPoolCreate(hContext, hDevice, hMetricGroup, desc, phMetricQueryPool)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricQueryPoolCreate(hContext, hDevice, hMetricGroup, desc, phMetricQueryPool)");
 
         auto pfnCreate = context.zetDdiTable.MetricQueryPool.pfnCreate;
 
         if( nullptr == pfnCreate )
             return logAndPropagateResult_zetMetricQueryPoolCreate(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hContext, hDevice, hMetricGroup, desc, phMetricQueryPool);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryPoolCreatePrologue( hContext, hDevice, hMetricGroup, desc, phMetricQueryPool );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricQueryPoolCreatePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricQueryPoolCreatePrologue) {
+                auto result = checker->zetMetricQueryPoolCreatePrologue( hContext, hDevice, hMetricGroup, desc, phMetricQueryPool );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricQueryPoolCreate(result, hContext, hDevice, hMetricGroup, desc, phMetricQueryPool);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricQueryPoolCreatePrologue) {
+            auto result = checker->zetMetricQueryPoolCreatePrologue( hContext, hDevice, hMetricGroup, desc, phMetricQueryPool );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricQueryPoolCreate(result, hContext, hDevice, hMetricGroup, desc, phMetricQueryPool);
         }
 
@@ -3585,15 +4643,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricQueryPoolCreatePrologue( hContext, hDevice, hMetricGroup, desc, phMetricQueryPool );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricQueryPoolCreate(result, hContext, hDevice, hMetricGroup, desc, phMetricQueryPool);
         }
 
         auto driver_result = pfnCreate( hContext, hDevice, hMetricGroup, desc, phMetricQueryPool );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryPoolCreateEpilogue( hContext, hDevice, hMetricGroup, desc, phMetricQueryPool ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricQueryPoolCreateEpilogue) {
+                auto result = checker->zetMetricQueryPoolCreateEpilogue( hContext, hDevice, hMetricGroup, desc, phMetricQueryPool ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricQueryPoolCreate(result, hContext, hDevice, hMetricGroup, desc, phMetricQueryPool);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricQueryPoolCreateEpilogue) {
+            auto result = checker->zetMetricQueryPoolCreateEpilogue( hContext, hDevice, hMetricGroup, desc, phMetricQueryPool ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricQueryPoolCreate(result, hContext, hDevice, hMetricGroup, desc, phMetricQueryPool);
         }
 
@@ -3616,16 +4681,24 @@ namespace validation_layer
         zet_metric_query_pool_handle_t hMetricQueryPool ///< [in][release] handle of the metric query pool
         )
     {
-        context.logger->log_trace("zetMetricQueryPoolDestroy(hMetricQueryPool)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricQueryPoolDestroy(hMetricQueryPool)");
 
         auto pfnDestroy = context.zetDdiTable.MetricQueryPool.pfnDestroy;
 
         if( nullptr == pfnDestroy )
             return logAndPropagateResult_zetMetricQueryPoolDestroy(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetricQueryPool);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryPoolDestroyPrologue( hMetricQueryPool );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricQueryPoolDestroyPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricQueryPoolDestroyPrologue) {
+                auto result = checker->zetMetricQueryPoolDestroyPrologue( hMetricQueryPool );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricQueryPoolDestroy(result, hMetricQueryPool);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricQueryPoolDestroyPrologue) {
+            auto result = checker->zetMetricQueryPoolDestroyPrologue( hMetricQueryPool );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricQueryPoolDestroy(result, hMetricQueryPool);
         }
 
@@ -3642,8 +4715,15 @@ namespace validation_layer
 
         auto driver_result = pfnDestroy( hMetricQueryPool );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryPoolDestroyEpilogue( hMetricQueryPool ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricQueryPoolDestroyEpilogue) {
+                auto result = checker->zetMetricQueryPoolDestroyEpilogue( hMetricQueryPool ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricQueryPoolDestroy(result, hMetricQueryPool);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricQueryPoolDestroyEpilogue) {
+            auto result = checker->zetMetricQueryPoolDestroyEpilogue( hMetricQueryPool ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricQueryPoolDestroy(result, hMetricQueryPool);
         }
 
@@ -3659,16 +4739,24 @@ namespace validation_layer
         zet_metric_query_handle_t* phMetricQuery        ///< [out] handle of metric query
         )
     {
-        context.logger->log_trace("zetMetricQueryCreate(hMetricQueryPool, index, phMetricQuery)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricQueryCreate(hMetricQueryPool, index, phMetricQuery)");
 
         auto pfnCreate = context.zetDdiTable.MetricQuery.pfnCreate;
 
         if( nullptr == pfnCreate )
             return logAndPropagateResult_zetMetricQueryCreate(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetricQueryPool, index, phMetricQuery);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryCreatePrologue( hMetricQueryPool, index, phMetricQuery );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricQueryCreatePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricQueryCreatePrologue) {
+                auto result = checker->zetMetricQueryCreatePrologue( hMetricQueryPool, index, phMetricQuery );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricQueryCreate(result, hMetricQueryPool, index, phMetricQuery);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricQueryCreatePrologue) {
+            auto result = checker->zetMetricQueryCreatePrologue( hMetricQueryPool, index, phMetricQuery );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricQueryCreate(result, hMetricQueryPool, index, phMetricQuery);
         }
 
@@ -3678,15 +4766,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricQueryCreatePrologue( hMetricQueryPool, index, phMetricQuery );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricQueryCreate(result, hMetricQueryPool, index, phMetricQuery);
         }
 
         auto driver_result = pfnCreate( hMetricQueryPool, index, phMetricQuery );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryCreateEpilogue( hMetricQueryPool, index, phMetricQuery ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricQueryCreateEpilogue) {
+                auto result = checker->zetMetricQueryCreateEpilogue( hMetricQueryPool, index, phMetricQuery ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricQueryCreate(result, hMetricQueryPool, index, phMetricQuery);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricQueryCreateEpilogue) {
+            auto result = checker->zetMetricQueryCreateEpilogue( hMetricQueryPool, index, phMetricQuery ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricQueryCreate(result, hMetricQueryPool, index, phMetricQuery);
         }
 
@@ -3709,16 +4804,24 @@ namespace validation_layer
         zet_metric_query_handle_t hMetricQuery          ///< [in][release] handle of metric query
         )
     {
-        context.logger->log_trace("zetMetricQueryDestroy(hMetricQuery)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricQueryDestroy(hMetricQuery)");
 
         auto pfnDestroy = context.zetDdiTable.MetricQuery.pfnDestroy;
 
         if( nullptr == pfnDestroy )
             return logAndPropagateResult_zetMetricQueryDestroy(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetricQuery);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryDestroyPrologue( hMetricQuery );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricQueryDestroyPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricQueryDestroyPrologue) {
+                auto result = checker->zetMetricQueryDestroyPrologue( hMetricQuery );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricQueryDestroy(result, hMetricQuery);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricQueryDestroyPrologue) {
+            auto result = checker->zetMetricQueryDestroyPrologue( hMetricQuery );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricQueryDestroy(result, hMetricQuery);
         }
 
@@ -3735,8 +4838,15 @@ namespace validation_layer
 
         auto driver_result = pfnDestroy( hMetricQuery );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryDestroyEpilogue( hMetricQuery ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricQueryDestroyEpilogue) {
+                auto result = checker->zetMetricQueryDestroyEpilogue( hMetricQuery ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricQueryDestroy(result, hMetricQuery);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricQueryDestroyEpilogue) {
+            auto result = checker->zetMetricQueryDestroyEpilogue( hMetricQuery ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricQueryDestroy(result, hMetricQuery);
         }
 
@@ -3750,16 +4860,24 @@ namespace validation_layer
         zet_metric_query_handle_t hMetricQuery          ///< [in] handle of metric query
         )
     {
-        context.logger->log_trace("zetMetricQueryReset(hMetricQuery)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricQueryReset(hMetricQuery)");
 
         auto pfnReset = context.zetDdiTable.MetricQuery.pfnReset;
 
         if( nullptr == pfnReset )
             return logAndPropagateResult_zetMetricQueryReset(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetricQuery);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryResetPrologue( hMetricQuery );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricQueryResetPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricQueryResetPrologue) {
+                auto result = checker->zetMetricQueryResetPrologue( hMetricQuery );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricQueryReset(result, hMetricQuery);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricQueryResetPrologue) {
+            auto result = checker->zetMetricQueryResetPrologue( hMetricQuery );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricQueryReset(result, hMetricQuery);
         }
 
@@ -3769,15 +4887,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricQueryResetPrologue( hMetricQuery );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricQueryReset(result, hMetricQuery);
         }
 
         auto driver_result = pfnReset( hMetricQuery );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryResetEpilogue( hMetricQuery ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricQueryResetEpilogue) {
+                auto result = checker->zetMetricQueryResetEpilogue( hMetricQuery ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricQueryReset(result, hMetricQuery);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricQueryResetEpilogue) {
+            auto result = checker->zetMetricQueryResetEpilogue( hMetricQuery ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricQueryReset(result, hMetricQuery);
         }
 
@@ -3792,16 +4917,24 @@ namespace validation_layer
         zet_metric_query_handle_t hMetricQuery          ///< [in] handle of the metric query
         )
     {
-        context.logger->log_trace("zetCommandListAppendMetricQueryBegin(hCommandList, hMetricQuery)");
+        ZEL_LOG_TRACE(context.logger, "zetCommandListAppendMetricQueryBegin(hCommandList, hMetricQuery)");
 
         auto pfnAppendMetricQueryBegin = context.zetDdiTable.CommandList.pfnAppendMetricQueryBegin;
 
         if( nullptr == pfnAppendMetricQueryBegin )
             return logAndPropagateResult_zetCommandListAppendMetricQueryBegin(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hCommandList, hMetricQuery);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetCommandListAppendMetricQueryBeginPrologue( hCommandList, hMetricQuery );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetCommandListAppendMetricQueryBeginPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetCommandListAppendMetricQueryBeginPrologue) {
+                auto result = checker->zetCommandListAppendMetricQueryBeginPrologue( hCommandList, hMetricQuery );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetCommandListAppendMetricQueryBegin(result, hCommandList, hMetricQuery);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetCommandListAppendMetricQueryBeginPrologue) {
+            auto result = checker->zetCommandListAppendMetricQueryBeginPrologue( hCommandList, hMetricQuery );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetCommandListAppendMetricQueryBegin(result, hCommandList, hMetricQuery);
         }
 
@@ -3811,15 +4944,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetCommandListAppendMetricQueryBeginPrologue( hCommandList, hMetricQuery );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetCommandListAppendMetricQueryBegin(result, hCommandList, hMetricQuery);
         }
 
         auto driver_result = pfnAppendMetricQueryBegin( hCommandList, hMetricQuery );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetCommandListAppendMetricQueryBeginEpilogue( hCommandList, hMetricQuery ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetCommandListAppendMetricQueryBeginEpilogue) {
+                auto result = checker->zetCommandListAppendMetricQueryBeginEpilogue( hCommandList, hMetricQuery ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetCommandListAppendMetricQueryBegin(result, hCommandList, hMetricQuery);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetCommandListAppendMetricQueryBeginEpilogue) {
+            auto result = checker->zetCommandListAppendMetricQueryBeginEpilogue( hCommandList, hMetricQuery ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetCommandListAppendMetricQueryBegin(result, hCommandList, hMetricQuery);
         }
 
@@ -3837,16 +4977,24 @@ namespace validation_layer
         ze_event_handle_t* phWaitEvents                 ///< [in][mbz] must be nullptr
         )
     {
-        context.logger->log_trace("zetCommandListAppendMetricQueryEnd(hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEventsLocal)");
+        ZEL_LOG_TRACE(context.logger, "zetCommandListAppendMetricQueryEnd(hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEventsLocal)");
 
         auto pfnAppendMetricQueryEnd = context.zetDdiTable.CommandList.pfnAppendMetricQueryEnd;
 
         if( nullptr == pfnAppendMetricQueryEnd )
             return logAndPropagateResult_zetCommandListAppendMetricQueryEnd(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetCommandListAppendMetricQueryEndPrologue( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetCommandListAppendMetricQueryEndPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetCommandListAppendMetricQueryEndPrologue) {
+                auto result = checker->zetCommandListAppendMetricQueryEndPrologue( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetCommandListAppendMetricQueryEnd(result, hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetCommandListAppendMetricQueryEndPrologue) {
+            auto result = checker->zetCommandListAppendMetricQueryEndPrologue( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetCommandListAppendMetricQueryEnd(result, hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents);
         }
 
@@ -3856,15 +5004,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetCommandListAppendMetricQueryEndPrologue( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetCommandListAppendMetricQueryEnd(result, hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents);
         }
 
         auto driver_result = pfnAppendMetricQueryEnd( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetCommandListAppendMetricQueryEndEpilogue( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetCommandListAppendMetricQueryEndEpilogue) {
+                auto result = checker->zetCommandListAppendMetricQueryEndEpilogue( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetCommandListAppendMetricQueryEnd(result, hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetCommandListAppendMetricQueryEndEpilogue) {
+            auto result = checker->zetCommandListAppendMetricQueryEndEpilogue( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetCommandListAppendMetricQueryEnd(result, hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents);
         }
 
@@ -3878,16 +5033,24 @@ namespace validation_layer
         zet_command_list_handle_t hCommandList          ///< [in] handle of the command list
         )
     {
-        context.logger->log_trace("zetCommandListAppendMetricMemoryBarrier(hCommandList)");
+        ZEL_LOG_TRACE(context.logger, "zetCommandListAppendMetricMemoryBarrier(hCommandList)");
 
         auto pfnAppendMetricMemoryBarrier = context.zetDdiTable.CommandList.pfnAppendMetricMemoryBarrier;
 
         if( nullptr == pfnAppendMetricMemoryBarrier )
             return logAndPropagateResult_zetCommandListAppendMetricMemoryBarrier(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hCommandList);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetCommandListAppendMetricMemoryBarrierPrologue( hCommandList );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetCommandListAppendMetricMemoryBarrierPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetCommandListAppendMetricMemoryBarrierPrologue) {
+                auto result = checker->zetCommandListAppendMetricMemoryBarrierPrologue( hCommandList );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetCommandListAppendMetricMemoryBarrier(result, hCommandList);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetCommandListAppendMetricMemoryBarrierPrologue) {
+            auto result = checker->zetCommandListAppendMetricMemoryBarrierPrologue( hCommandList );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetCommandListAppendMetricMemoryBarrier(result, hCommandList);
         }
 
@@ -3897,15 +5060,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetCommandListAppendMetricMemoryBarrierPrologue( hCommandList );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetCommandListAppendMetricMemoryBarrier(result, hCommandList);
         }
 
         auto driver_result = pfnAppendMetricMemoryBarrier( hCommandList );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetCommandListAppendMetricMemoryBarrierEpilogue( hCommandList ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetCommandListAppendMetricMemoryBarrierEpilogue) {
+                auto result = checker->zetCommandListAppendMetricMemoryBarrierEpilogue( hCommandList ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetCommandListAppendMetricMemoryBarrier(result, hCommandList);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetCommandListAppendMetricMemoryBarrierEpilogue) {
+            auto result = checker->zetCommandListAppendMetricMemoryBarrierEpilogue( hCommandList ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetCommandListAppendMetricMemoryBarrier(result, hCommandList);
         }
 
@@ -3928,16 +5098,24 @@ namespace validation_layer
                                                         ///< reports in raw format
         )
     {
-        context.logger->log_trace("zetMetricQueryGetData(hMetricQuery, pRawDataSize, pRawData)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricQueryGetData(hMetricQuery, pRawDataSize, pRawData)");
 
         auto pfnGetData = context.zetDdiTable.MetricQuery.pfnGetData;
 
         if( nullptr == pfnGetData )
             return logAndPropagateResult_zetMetricQueryGetData(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetricQuery, pRawDataSize, pRawData);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryGetDataPrologue( hMetricQuery, pRawDataSize, pRawData );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricQueryGetDataPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricQueryGetDataPrologue) {
+                auto result = checker->zetMetricQueryGetDataPrologue( hMetricQuery, pRawDataSize, pRawData );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricQueryGetData(result, hMetricQuery, pRawDataSize, pRawData);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricQueryGetDataPrologue) {
+            auto result = checker->zetMetricQueryGetDataPrologue( hMetricQuery, pRawDataSize, pRawData );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricQueryGetData(result, hMetricQuery, pRawDataSize, pRawData);
         }
 
@@ -3947,15 +5125,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricQueryGetDataPrologue( hMetricQuery, pRawDataSize, pRawData );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricQueryGetData(result, hMetricQuery, pRawDataSize, pRawData);
         }
 
         auto driver_result = pfnGetData( hMetricQuery, pRawDataSize, pRawData );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryGetDataEpilogue( hMetricQuery, pRawDataSize, pRawData ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricQueryGetDataEpilogue) {
+                auto result = checker->zetMetricQueryGetDataEpilogue( hMetricQuery, pRawDataSize, pRawData ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricQueryGetData(result, hMetricQuery, pRawDataSize, pRawData);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricQueryGetDataEpilogue) {
+            auto result = checker->zetMetricQueryGetDataEpilogue( hMetricQuery, pRawDataSize, pRawData ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricQueryGetData(result, hMetricQuery, pRawDataSize, pRawData);
         }
 
@@ -3970,16 +5155,24 @@ namespace validation_layer
         zet_profile_properties_t* pProfileProperties    ///< [out] pointer to profile properties
         )
     {
-        context.logger->log_trace("zetKernelGetProfileInfo(hKernel, pProfileProperties)");
+        ZEL_LOG_TRACE(context.logger, "zetKernelGetProfileInfo(hKernel, pProfileProperties)");
 
         auto pfnGetProfileInfo = context.zetDdiTable.Kernel.pfnGetProfileInfo;
 
         if( nullptr == pfnGetProfileInfo )
             return logAndPropagateResult_zetKernelGetProfileInfo(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hKernel, pProfileProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetKernelGetProfileInfoPrologue( hKernel, pProfileProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetKernelGetProfileInfoPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetKernelGetProfileInfoPrologue) {
+                auto result = checker->zetKernelGetProfileInfoPrologue( hKernel, pProfileProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetKernelGetProfileInfo(result, hKernel, pProfileProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetKernelGetProfileInfoPrologue) {
+            auto result = checker->zetKernelGetProfileInfoPrologue( hKernel, pProfileProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetKernelGetProfileInfo(result, hKernel, pProfileProperties);
         }
 
@@ -3989,15 +5182,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetKernelGetProfileInfoPrologue( hKernel, pProfileProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetKernelGetProfileInfo(result, hKernel, pProfileProperties);
         }
 
         auto driver_result = pfnGetProfileInfo( hKernel, pProfileProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetKernelGetProfileInfoEpilogue( hKernel, pProfileProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetKernelGetProfileInfoEpilogue) {
+                auto result = checker->zetKernelGetProfileInfoEpilogue( hKernel, pProfileProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetKernelGetProfileInfo(result, hKernel, pProfileProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetKernelGetProfileInfoEpilogue) {
+            auto result = checker->zetKernelGetProfileInfoEpilogue( hKernel, pProfileProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetKernelGetProfileInfo(result, hKernel, pProfileProperties);
         }
 
@@ -4013,16 +5213,24 @@ namespace validation_layer
         zet_tracer_exp_handle_t* phTracer               ///< [out] pointer to handle of tracer object created
         )
     {
-        context.logger->log_trace("zetTracerExpCreate(hContext, desc, phTracer)");
+        ZEL_LOG_TRACE(context.logger, "zetTracerExpCreate(hContext, desc, phTracer)");
 
         auto pfnCreate = context.zetDdiTable.TracerExp.pfnCreate;
 
         if( nullptr == pfnCreate )
             return logAndPropagateResult_zetTracerExpCreate(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hContext, desc, phTracer);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetTracerExpCreatePrologue( hContext, desc, phTracer );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetTracerExpCreatePrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetTracerExpCreatePrologue) {
+                auto result = checker->zetTracerExpCreatePrologue( hContext, desc, phTracer );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetTracerExpCreate(result, hContext, desc, phTracer);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetTracerExpCreatePrologue) {
+            auto result = checker->zetTracerExpCreatePrologue( hContext, desc, phTracer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetTracerExpCreate(result, hContext, desc, phTracer);
         }
 
@@ -4032,15 +5240,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetTracerExpCreatePrologue( hContext, desc, phTracer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetTracerExpCreate(result, hContext, desc, phTracer);
         }
 
         auto driver_result = pfnCreate( hContext, desc, phTracer );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetTracerExpCreateEpilogue( hContext, desc, phTracer ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetTracerExpCreateEpilogue) {
+                auto result = checker->zetTracerExpCreateEpilogue( hContext, desc, phTracer ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetTracerExpCreate(result, hContext, desc, phTracer);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetTracerExpCreateEpilogue) {
+            auto result = checker->zetTracerExpCreateEpilogue( hContext, desc, phTracer ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetTracerExpCreate(result, hContext, desc, phTracer);
         }
 
@@ -4063,16 +5278,24 @@ namespace validation_layer
         zet_tracer_exp_handle_t hTracer                 ///< [in][release] handle of tracer object to destroy
         )
     {
-        context.logger->log_trace("zetTracerExpDestroy(hTracer)");
+        ZEL_LOG_TRACE(context.logger, "zetTracerExpDestroy(hTracer)");
 
         auto pfnDestroy = context.zetDdiTable.TracerExp.pfnDestroy;
 
         if( nullptr == pfnDestroy )
             return logAndPropagateResult_zetTracerExpDestroy(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hTracer);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetTracerExpDestroyPrologue( hTracer );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetTracerExpDestroyPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetTracerExpDestroyPrologue) {
+                auto result = checker->zetTracerExpDestroyPrologue( hTracer );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetTracerExpDestroy(result, hTracer);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetTracerExpDestroyPrologue) {
+            auto result = checker->zetTracerExpDestroyPrologue( hTracer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetTracerExpDestroy(result, hTracer);
         }
 
@@ -4089,8 +5312,15 @@ namespace validation_layer
 
         auto driver_result = pfnDestroy( hTracer );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetTracerExpDestroyEpilogue( hTracer ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetTracerExpDestroyEpilogue) {
+                auto result = checker->zetTracerExpDestroyEpilogue( hTracer ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetTracerExpDestroy(result, hTracer);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetTracerExpDestroyEpilogue) {
+            auto result = checker->zetTracerExpDestroyEpilogue( hTracer ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetTracerExpDestroy(result, hTracer);
         }
 
@@ -4105,16 +5335,24 @@ namespace validation_layer
         zet_core_callbacks_t* pCoreCbs                  ///< [in] pointer to table of 'core' callback function pointers
         )
     {
-        context.logger->log_trace("zetTracerExpSetPrologues(hTracer, pCoreCbs)");
+        ZEL_LOG_TRACE(context.logger, "zetTracerExpSetPrologues(hTracer, pCoreCbs)");
 
         auto pfnSetPrologues = context.zetDdiTable.TracerExp.pfnSetPrologues;
 
         if( nullptr == pfnSetPrologues )
             return logAndPropagateResult_zetTracerExpSetPrologues(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hTracer, pCoreCbs);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetTracerExpSetProloguesPrologue( hTracer, pCoreCbs );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetTracerExpSetProloguesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetTracerExpSetProloguesPrologue) {
+                auto result = checker->zetTracerExpSetProloguesPrologue( hTracer, pCoreCbs );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetTracerExpSetPrologues(result, hTracer, pCoreCbs);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetTracerExpSetProloguesPrologue) {
+            auto result = checker->zetTracerExpSetProloguesPrologue( hTracer, pCoreCbs );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetTracerExpSetPrologues(result, hTracer, pCoreCbs);
         }
 
@@ -4124,15 +5362,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetTracerExpSetProloguesPrologue( hTracer, pCoreCbs );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetTracerExpSetPrologues(result, hTracer, pCoreCbs);
         }
 
         auto driver_result = pfnSetPrologues( hTracer, pCoreCbs );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetTracerExpSetProloguesEpilogue( hTracer, pCoreCbs ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetTracerExpSetProloguesEpilogue) {
+                auto result = checker->zetTracerExpSetProloguesEpilogue( hTracer, pCoreCbs ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetTracerExpSetPrologues(result, hTracer, pCoreCbs);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetTracerExpSetProloguesEpilogue) {
+            auto result = checker->zetTracerExpSetProloguesEpilogue( hTracer, pCoreCbs ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetTracerExpSetPrologues(result, hTracer, pCoreCbs);
         }
 
@@ -4147,16 +5392,24 @@ namespace validation_layer
         zet_core_callbacks_t* pCoreCbs                  ///< [in] pointer to table of 'core' callback function pointers
         )
     {
-        context.logger->log_trace("zetTracerExpSetEpilogues(hTracer, pCoreCbs)");
+        ZEL_LOG_TRACE(context.logger, "zetTracerExpSetEpilogues(hTracer, pCoreCbs)");
 
         auto pfnSetEpilogues = context.zetDdiTable.TracerExp.pfnSetEpilogues;
 
         if( nullptr == pfnSetEpilogues )
             return logAndPropagateResult_zetTracerExpSetEpilogues(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hTracer, pCoreCbs);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetTracerExpSetEpiloguesPrologue( hTracer, pCoreCbs );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetTracerExpSetEpiloguesPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetTracerExpSetEpiloguesPrologue) {
+                auto result = checker->zetTracerExpSetEpiloguesPrologue( hTracer, pCoreCbs );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetTracerExpSetEpilogues(result, hTracer, pCoreCbs);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetTracerExpSetEpiloguesPrologue) {
+            auto result = checker->zetTracerExpSetEpiloguesPrologue( hTracer, pCoreCbs );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetTracerExpSetEpilogues(result, hTracer, pCoreCbs);
         }
 
@@ -4166,15 +5419,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetTracerExpSetEpiloguesPrologue( hTracer, pCoreCbs );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetTracerExpSetEpilogues(result, hTracer, pCoreCbs);
         }
 
         auto driver_result = pfnSetEpilogues( hTracer, pCoreCbs );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetTracerExpSetEpiloguesEpilogue( hTracer, pCoreCbs ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetTracerExpSetEpiloguesEpilogue) {
+                auto result = checker->zetTracerExpSetEpiloguesEpilogue( hTracer, pCoreCbs ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetTracerExpSetEpilogues(result, hTracer, pCoreCbs);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetTracerExpSetEpiloguesEpilogue) {
+            auto result = checker->zetTracerExpSetEpiloguesEpilogue( hTracer, pCoreCbs ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetTracerExpSetEpilogues(result, hTracer, pCoreCbs);
         }
 
@@ -4189,16 +5449,24 @@ namespace validation_layer
         ze_bool_t enable                                ///< [in] enable the tracer if true; disable if false
         )
     {
-        context.logger->log_trace("zetTracerExpSetEnabled(hTracer, enable)");
+        ZEL_LOG_TRACE(context.logger, "zetTracerExpSetEnabled(hTracer, enable)");
 
         auto pfnSetEnabled = context.zetDdiTable.TracerExp.pfnSetEnabled;
 
         if( nullptr == pfnSetEnabled )
             return logAndPropagateResult_zetTracerExpSetEnabled(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hTracer, enable);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetTracerExpSetEnabledPrologue( hTracer, enable );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetTracerExpSetEnabledPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetTracerExpSetEnabledPrologue) {
+                auto result = checker->zetTracerExpSetEnabledPrologue( hTracer, enable );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetTracerExpSetEnabled(result, hTracer, enable);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetTracerExpSetEnabledPrologue) {
+            auto result = checker->zetTracerExpSetEnabledPrologue( hTracer, enable );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetTracerExpSetEnabled(result, hTracer, enable);
         }
 
@@ -4208,15 +5476,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetTracerExpSetEnabledPrologue( hTracer, enable );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetTracerExpSetEnabled(result, hTracer, enable);
         }
 
         auto driver_result = pfnSetEnabled( hTracer, enable );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetTracerExpSetEnabledEpilogue( hTracer, enable ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetTracerExpSetEnabledEpilogue) {
+                auto result = checker->zetTracerExpSetEnabledEpilogue( hTracer, enable ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetTracerExpSetEnabled(result, hTracer, enable);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetTracerExpSetEnabledEpilogue) {
+            auto result = checker->zetTracerExpSetEnabledEpilogue( hTracer, enable ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetTracerExpSetEnabled(result, hTracer, enable);
         }
 
@@ -4252,16 +5527,24 @@ namespace validation_layer
                                                         ///< then driver shall only calculate that number of metric values.
         )
     {
-        context.logger->log_trace("zetMetricGroupCalculateMultipleMetricValuesExp(hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricGroupCalculateMultipleMetricValuesExp(hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues)");
 
         auto pfnCalculateMultipleMetricValuesExp = context.zetDdiTable.MetricGroupExp.pfnCalculateMultipleMetricValuesExp;
 
         if( nullptr == pfnCalculateMultipleMetricValuesExp )
             return logAndPropagateResult_zetMetricGroupCalculateMultipleMetricValuesExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCalculateMultipleMetricValuesExpPrologue( hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricGroupCalculateMultipleMetricValuesExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricGroupCalculateMultipleMetricValuesExpPrologue) {
+                auto result = checker->zetMetricGroupCalculateMultipleMetricValuesExpPrologue( hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupCalculateMultipleMetricValuesExp(result, hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricGroupCalculateMultipleMetricValuesExpPrologue) {
+            auto result = checker->zetMetricGroupCalculateMultipleMetricValuesExpPrologue( hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupCalculateMultipleMetricValuesExp(result, hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues);
         }
 
@@ -4271,15 +5554,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupCalculateMultipleMetricValuesExpPrologue( hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupCalculateMultipleMetricValuesExp(result, hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues);
         }
 
         auto driver_result = pfnCalculateMultipleMetricValuesExp( hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCalculateMultipleMetricValuesExpEpilogue( hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricGroupCalculateMultipleMetricValuesExpEpilogue) {
+                auto result = checker->zetMetricGroupCalculateMultipleMetricValuesExpEpilogue( hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupCalculateMultipleMetricValuesExp(result, hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricGroupCalculateMultipleMetricValuesExpEpilogue) {
+            auto result = checker->zetMetricGroupCalculateMultipleMetricValuesExpEpilogue( hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupCalculateMultipleMetricValuesExp(result, hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues);
         }
 
@@ -4298,16 +5588,24 @@ namespace validation_layer
         uint64_t* metricTimestamp                       ///< [out] Metric timestamp in tick counts.
         )
     {
-        context.logger->log_trace("zetMetricGroupGetGlobalTimestampsExp(hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricGroupGetGlobalTimestampsExp(hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp)");
 
         auto pfnGetGlobalTimestampsExp = context.zetDdiTable.MetricGroupExp.pfnGetGlobalTimestampsExp;
 
         if( nullptr == pfnGetGlobalTimestampsExp )
             return logAndPropagateResult_zetMetricGroupGetGlobalTimestampsExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupGetGlobalTimestampsExpPrologue( hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricGroupGetGlobalTimestampsExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricGroupGetGlobalTimestampsExpPrologue) {
+                auto result = checker->zetMetricGroupGetGlobalTimestampsExpPrologue( hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupGetGlobalTimestampsExp(result, hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricGroupGetGlobalTimestampsExpPrologue) {
+            auto result = checker->zetMetricGroupGetGlobalTimestampsExpPrologue( hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupGetGlobalTimestampsExp(result, hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp);
         }
 
@@ -4317,15 +5615,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupGetGlobalTimestampsExpPrologue( hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupGetGlobalTimestampsExp(result, hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp);
         }
 
         auto driver_result = pfnGetGlobalTimestampsExp( hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupGetGlobalTimestampsExpEpilogue( hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricGroupGetGlobalTimestampsExpEpilogue) {
+                auto result = checker->zetMetricGroupGetGlobalTimestampsExpEpilogue( hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupGetGlobalTimestampsExp(result, hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricGroupGetGlobalTimestampsExpEpilogue) {
+            auto result = checker->zetMetricGroupGetGlobalTimestampsExpEpilogue( hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupGetGlobalTimestampsExp(result, hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp);
         }
 
@@ -4351,16 +5656,24 @@ namespace validation_layer
         uint8_t * pExportData                           ///< [in,out][optional][range(0, *pExportDataSize)] buffer of exported data.
         )
     {
-        context.logger->log_trace("zetMetricGroupGetExportDataExp(hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricGroupGetExportDataExp(hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData)");
 
         auto pfnGetExportDataExp = context.zetDdiTable.MetricGroupExp.pfnGetExportDataExp;
 
         if( nullptr == pfnGetExportDataExp )
             return logAndPropagateResult_zetMetricGroupGetExportDataExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupGetExportDataExpPrologue( hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricGroupGetExportDataExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricGroupGetExportDataExpPrologue) {
+                auto result = checker->zetMetricGroupGetExportDataExpPrologue( hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupGetExportDataExp(result, hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricGroupGetExportDataExpPrologue) {
+            auto result = checker->zetMetricGroupGetExportDataExpPrologue( hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupGetExportDataExp(result, hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData);
         }
 
@@ -4370,15 +5683,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupGetExportDataExpPrologue( hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupGetExportDataExp(result, hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData);
         }
 
         auto driver_result = pfnGetExportDataExp( hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupGetExportDataExpEpilogue( hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricGroupGetExportDataExpEpilogue) {
+                auto result = checker->zetMetricGroupGetExportDataExpEpilogue( hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupGetExportDataExp(result, hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricGroupGetExportDataExpEpilogue) {
+            auto result = checker->zetMetricGroupGetExportDataExpEpilogue( hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupGetExportDataExp(result, hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData);
         }
 
@@ -4419,16 +5739,24 @@ namespace validation_layer
                                                         ///< then driver shall only calculate that number of metric values.
         )
     {
-        context.logger->log_trace("zetMetricGroupCalculateMetricExportDataExp(hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricGroupCalculateMetricExportDataExp(hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues)");
 
         auto pfnCalculateMetricExportDataExp = context.zetDdiTable.MetricGroupExp.pfnCalculateMetricExportDataExp;
 
         if( nullptr == pfnCalculateMetricExportDataExp )
             return logAndPropagateResult_zetMetricGroupCalculateMetricExportDataExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCalculateMetricExportDataExpPrologue( hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricGroupCalculateMetricExportDataExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricGroupCalculateMetricExportDataExpPrologue) {
+                auto result = checker->zetMetricGroupCalculateMetricExportDataExpPrologue( hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupCalculateMetricExportDataExp(result, hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricGroupCalculateMetricExportDataExpPrologue) {
+            auto result = checker->zetMetricGroupCalculateMetricExportDataExpPrologue( hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupCalculateMetricExportDataExp(result, hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues);
         }
 
@@ -4438,15 +5766,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupCalculateMetricExportDataExpPrologue( hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupCalculateMetricExportDataExp(result, hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues);
         }
 
         auto driver_result = pfnCalculateMetricExportDataExp( hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCalculateMetricExportDataExpEpilogue( hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricGroupCalculateMetricExportDataExpEpilogue) {
+                auto result = checker->zetMetricGroupCalculateMetricExportDataExpEpilogue( hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupCalculateMetricExportDataExp(result, hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricGroupCalculateMetricExportDataExpEpilogue) {
+            auto result = checker->zetMetricGroupCalculateMetricExportDataExpEpilogue( hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupCalculateMetricExportDataExp(result, hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues);
         }
 
@@ -4469,16 +5804,24 @@ namespace validation_layer
                                                         ///< then driver shall only retrieve that number of metric programmables.
         )
     {
-        context.logger->log_trace("zetMetricProgrammableGetExp(hDevice, pCount, phMetricProgrammables)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricProgrammableGetExp(hDevice, pCount, phMetricProgrammables)");
 
         auto pfnGetExp = context.zetDdiTable.MetricProgrammableExp.pfnGetExp;
 
         if( nullptr == pfnGetExp )
             return logAndPropagateResult_zetMetricProgrammableGetExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pCount, phMetricProgrammables);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricProgrammableGetExpPrologue( hDevice, pCount, phMetricProgrammables );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricProgrammableGetExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricProgrammableGetExpPrologue) {
+                auto result = checker->zetMetricProgrammableGetExpPrologue( hDevice, pCount, phMetricProgrammables );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricProgrammableGetExp(result, hDevice, pCount, phMetricProgrammables);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricProgrammableGetExpPrologue) {
+            auto result = checker->zetMetricProgrammableGetExpPrologue( hDevice, pCount, phMetricProgrammables );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricProgrammableGetExp(result, hDevice, pCount, phMetricProgrammables);
         }
 
@@ -4488,15 +5831,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricProgrammableGetExpPrologue( hDevice, pCount, phMetricProgrammables );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricProgrammableGetExp(result, hDevice, pCount, phMetricProgrammables);
         }
 
         auto driver_result = pfnGetExp( hDevice, pCount, phMetricProgrammables );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricProgrammableGetExpEpilogue( hDevice, pCount, phMetricProgrammables ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricProgrammableGetExpEpilogue) {
+                auto result = checker->zetMetricProgrammableGetExpEpilogue( hDevice, pCount, phMetricProgrammables ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricProgrammableGetExp(result, hDevice, pCount, phMetricProgrammables);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricProgrammableGetExpEpilogue) {
+            auto result = checker->zetMetricProgrammableGetExpEpilogue( hDevice, pCount, phMetricProgrammables ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricProgrammableGetExp(result, hDevice, pCount, phMetricProgrammables);
         }
 
@@ -4521,16 +5871,24 @@ namespace validation_layer
         zet_metric_programmable_exp_properties_t* pProperties   ///< [in,out] properties of the metric programmable
         )
     {
-        context.logger->log_trace("zetMetricProgrammableGetPropertiesExp(hMetricProgrammable, pProperties)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricProgrammableGetPropertiesExp(hMetricProgrammable, pProperties)");
 
         auto pfnGetPropertiesExp = context.zetDdiTable.MetricProgrammableExp.pfnGetPropertiesExp;
 
         if( nullptr == pfnGetPropertiesExp )
             return logAndPropagateResult_zetMetricProgrammableGetPropertiesExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetricProgrammable, pProperties);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricProgrammableGetPropertiesExpPrologue( hMetricProgrammable, pProperties );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricProgrammableGetPropertiesExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricProgrammableGetPropertiesExpPrologue) {
+                auto result = checker->zetMetricProgrammableGetPropertiesExpPrologue( hMetricProgrammable, pProperties );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricProgrammableGetPropertiesExp(result, hMetricProgrammable, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricProgrammableGetPropertiesExpPrologue) {
+            auto result = checker->zetMetricProgrammableGetPropertiesExpPrologue( hMetricProgrammable, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricProgrammableGetPropertiesExp(result, hMetricProgrammable, pProperties);
         }
 
@@ -4540,15 +5898,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricProgrammableGetPropertiesExpPrologue( hMetricProgrammable, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricProgrammableGetPropertiesExp(result, hMetricProgrammable, pProperties);
         }
 
         auto driver_result = pfnGetPropertiesExp( hMetricProgrammable, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricProgrammableGetPropertiesExpEpilogue( hMetricProgrammable, pProperties ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricProgrammableGetPropertiesExpEpilogue) {
+                auto result = checker->zetMetricProgrammableGetPropertiesExpEpilogue( hMetricProgrammable, pProperties ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricProgrammableGetPropertiesExp(result, hMetricProgrammable, pProperties);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricProgrammableGetPropertiesExpEpilogue) {
+            auto result = checker->zetMetricProgrammableGetPropertiesExpEpilogue( hMetricProgrammable, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricProgrammableGetPropertiesExp(result, hMetricProgrammable, pProperties);
         }
 
@@ -4574,16 +5939,24 @@ namespace validation_layer
                                                         ///< then driver shall only retrieve that number of parameter info.
         )
     {
-        context.logger->log_trace("zetMetricProgrammableGetParamInfoExp(hMetricProgrammable, pParameterCount, pParameterInfo)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricProgrammableGetParamInfoExp(hMetricProgrammable, pParameterCount, pParameterInfo)");
 
         auto pfnGetParamInfoExp = context.zetDdiTable.MetricProgrammableExp.pfnGetParamInfoExp;
 
         if( nullptr == pfnGetParamInfoExp )
             return logAndPropagateResult_zetMetricProgrammableGetParamInfoExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetricProgrammable, pParameterCount, pParameterInfo);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricProgrammableGetParamInfoExpPrologue( hMetricProgrammable, pParameterCount, pParameterInfo );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricProgrammableGetParamInfoExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricProgrammableGetParamInfoExpPrologue) {
+                auto result = checker->zetMetricProgrammableGetParamInfoExpPrologue( hMetricProgrammable, pParameterCount, pParameterInfo );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricProgrammableGetParamInfoExp(result, hMetricProgrammable, pParameterCount, pParameterInfo);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricProgrammableGetParamInfoExpPrologue) {
+            auto result = checker->zetMetricProgrammableGetParamInfoExpPrologue( hMetricProgrammable, pParameterCount, pParameterInfo );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricProgrammableGetParamInfoExp(result, hMetricProgrammable, pParameterCount, pParameterInfo);
         }
 
@@ -4593,15 +5966,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricProgrammableGetParamInfoExpPrologue( hMetricProgrammable, pParameterCount, pParameterInfo );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricProgrammableGetParamInfoExp(result, hMetricProgrammable, pParameterCount, pParameterInfo);
         }
 
         auto driver_result = pfnGetParamInfoExp( hMetricProgrammable, pParameterCount, pParameterInfo );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricProgrammableGetParamInfoExpEpilogue( hMetricProgrammable, pParameterCount, pParameterInfo ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricProgrammableGetParamInfoExpEpilogue) {
+                auto result = checker->zetMetricProgrammableGetParamInfoExpEpilogue( hMetricProgrammable, pParameterCount, pParameterInfo ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricProgrammableGetParamInfoExp(result, hMetricProgrammable, pParameterCount, pParameterInfo);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricProgrammableGetParamInfoExpEpilogue) {
+            auto result = checker->zetMetricProgrammableGetParamInfoExpEpilogue( hMetricProgrammable, pParameterCount, pParameterInfo ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricProgrammableGetParamInfoExp(result, hMetricProgrammable, pParameterCount, pParameterInfo);
         }
 
@@ -4628,16 +6008,24 @@ namespace validation_layer
                                                         ///< then driver shall only retrieve that number of value info.
         )
     {
-        context.logger->log_trace("zetMetricProgrammableGetParamValueInfoExp(hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricProgrammableGetParamValueInfoExp(hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo)");
 
         auto pfnGetParamValueInfoExp = context.zetDdiTable.MetricProgrammableExp.pfnGetParamValueInfoExp;
 
         if( nullptr == pfnGetParamValueInfoExp )
             return logAndPropagateResult_zetMetricProgrammableGetParamValueInfoExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricProgrammableGetParamValueInfoExpPrologue( hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricProgrammableGetParamValueInfoExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricProgrammableGetParamValueInfoExpPrologue) {
+                auto result = checker->zetMetricProgrammableGetParamValueInfoExpPrologue( hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricProgrammableGetParamValueInfoExp(result, hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricProgrammableGetParamValueInfoExpPrologue) {
+            auto result = checker->zetMetricProgrammableGetParamValueInfoExpPrologue( hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricProgrammableGetParamValueInfoExp(result, hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo);
         }
 
@@ -4647,15 +6035,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricProgrammableGetParamValueInfoExpPrologue( hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricProgrammableGetParamValueInfoExp(result, hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo);
         }
 
         auto driver_result = pfnGetParamValueInfoExp( hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricProgrammableGetParamValueInfoExpEpilogue( hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricProgrammableGetParamValueInfoExpEpilogue) {
+                auto result = checker->zetMetricProgrammableGetParamValueInfoExpEpilogue( hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricProgrammableGetParamValueInfoExp(result, hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricProgrammableGetParamValueInfoExpEpilogue) {
+            auto result = checker->zetMetricProgrammableGetParamValueInfoExpEpilogue( hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricProgrammableGetParamValueInfoExp(result, hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo);
         }
 
@@ -4689,16 +6084,24 @@ namespace validation_layer
                                                         ///< shall only retrieve that number of metric handles.
         )
     {
-        context.logger->log_trace("zetMetricCreateFromProgrammableExp2(hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricCreateFromProgrammableExp2(hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles)");
 
         auto pfnCreateFromProgrammableExp2 = context.zetDdiTable.MetricExp.pfnCreateFromProgrammableExp2;
 
         if( nullptr == pfnCreateFromProgrammableExp2 )
             return logAndPropagateResult_zetMetricCreateFromProgrammableExp2(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricCreateFromProgrammableExp2Prologue( hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricCreateFromProgrammableExp2Prologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricCreateFromProgrammableExp2Prologue) {
+                auto result = checker->zetMetricCreateFromProgrammableExp2Prologue( hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricCreateFromProgrammableExp2(result, hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricCreateFromProgrammableExp2Prologue) {
+            auto result = checker->zetMetricCreateFromProgrammableExp2Prologue( hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricCreateFromProgrammableExp2(result, hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles);
         }
 
@@ -4708,15 +6111,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricCreateFromProgrammableExp2Prologue( hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricCreateFromProgrammableExp2(result, hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles);
         }
 
         auto driver_result = pfnCreateFromProgrammableExp2( hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricCreateFromProgrammableExp2Epilogue( hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricCreateFromProgrammableExp2Epilogue) {
+                auto result = checker->zetMetricCreateFromProgrammableExp2Epilogue( hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricCreateFromProgrammableExp2(result, hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricCreateFromProgrammableExp2Epilogue) {
+            auto result = checker->zetMetricCreateFromProgrammableExp2Epilogue( hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricCreateFromProgrammableExp2(result, hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles);
         }
 
@@ -4756,16 +6166,24 @@ namespace validation_layer
                                                         ///< shall only retrieve that number of metric handles.
         )
     {
-        context.logger->log_trace("zetMetricCreateFromProgrammableExp(hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricCreateFromProgrammableExp(hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles)");
 
         auto pfnCreateFromProgrammableExp = context.zetDdiTable.MetricExp.pfnCreateFromProgrammableExp;
 
         if( nullptr == pfnCreateFromProgrammableExp )
             return logAndPropagateResult_zetMetricCreateFromProgrammableExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricCreateFromProgrammableExpPrologue( hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricCreateFromProgrammableExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricCreateFromProgrammableExpPrologue) {
+                auto result = checker->zetMetricCreateFromProgrammableExpPrologue( hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricCreateFromProgrammableExp(result, hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricCreateFromProgrammableExpPrologue) {
+            auto result = checker->zetMetricCreateFromProgrammableExpPrologue( hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricCreateFromProgrammableExp(result, hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles);
         }
 
@@ -4775,15 +6193,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricCreateFromProgrammableExpPrologue( hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricCreateFromProgrammableExp(result, hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles);
         }
 
         auto driver_result = pfnCreateFromProgrammableExp( hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricCreateFromProgrammableExpEpilogue( hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricCreateFromProgrammableExpEpilogue) {
+                auto result = checker->zetMetricCreateFromProgrammableExpEpilogue( hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricCreateFromProgrammableExp(result, hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricCreateFromProgrammableExpEpilogue) {
+            auto result = checker->zetMetricCreateFromProgrammableExpEpilogue( hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricCreateFromProgrammableExp(result, hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles);
         }
 
@@ -4826,16 +6251,24 @@ namespace validation_layer
                                                         ///< Created Metric group handles.
         )
     {
-        context.logger->log_trace("zetDeviceCreateMetricGroupsFromMetricsExp(hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup)");
+        ZEL_LOG_TRACE(context.logger, "zetDeviceCreateMetricGroupsFromMetricsExp(hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup)");
 
         auto pfnCreateMetricGroupsFromMetricsExp = context.zetDdiTable.DeviceExp.pfnCreateMetricGroupsFromMetricsExp;
 
         if( nullptr == pfnCreateMetricGroupsFromMetricsExp )
             return logAndPropagateResult_zetDeviceCreateMetricGroupsFromMetricsExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDeviceCreateMetricGroupsFromMetricsExpPrologue( hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetDeviceCreateMetricGroupsFromMetricsExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDeviceCreateMetricGroupsFromMetricsExpPrologue) {
+                auto result = checker->zetDeviceCreateMetricGroupsFromMetricsExpPrologue( hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDeviceCreateMetricGroupsFromMetricsExp(result, hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDeviceCreateMetricGroupsFromMetricsExpPrologue) {
+            auto result = checker->zetDeviceCreateMetricGroupsFromMetricsExpPrologue( hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDeviceCreateMetricGroupsFromMetricsExp(result, hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup);
         }
 
@@ -4845,15 +6278,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDeviceCreateMetricGroupsFromMetricsExpPrologue( hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDeviceCreateMetricGroupsFromMetricsExp(result, hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup);
         }
 
         auto driver_result = pfnCreateMetricGroupsFromMetricsExp( hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDeviceCreateMetricGroupsFromMetricsExpEpilogue( hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDeviceCreateMetricGroupsFromMetricsExpEpilogue) {
+                auto result = checker->zetDeviceCreateMetricGroupsFromMetricsExpEpilogue( hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDeviceCreateMetricGroupsFromMetricsExp(result, hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDeviceCreateMetricGroupsFromMetricsExpEpilogue) {
+            auto result = checker->zetDeviceCreateMetricGroupsFromMetricsExpEpilogue( hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDeviceCreateMetricGroupsFromMetricsExp(result, hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup);
         }
 
@@ -4884,16 +6324,24 @@ namespace validation_layer
         zet_metric_group_handle_t* phMetricGroup        ///< [in,out] Created Metric group handle
         )
     {
-        context.logger->log_trace("zetMetricGroupCreateExp(hDevice, pName, pDescription, samplingType, phMetricGroup)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricGroupCreateExp(hDevice, pName, pDescription, samplingType, phMetricGroup)");
 
         auto pfnCreateExp = context.zetDdiTable.MetricGroupExp.pfnCreateExp;
 
         if( nullptr == pfnCreateExp )
             return logAndPropagateResult_zetMetricGroupCreateExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, pName, pDescription, samplingType, phMetricGroup);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCreateExpPrologue( hDevice, pName, pDescription, samplingType, phMetricGroup );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricGroupCreateExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricGroupCreateExpPrologue) {
+                auto result = checker->zetMetricGroupCreateExpPrologue( hDevice, pName, pDescription, samplingType, phMetricGroup );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupCreateExp(result, hDevice, pName, pDescription, samplingType, phMetricGroup);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricGroupCreateExpPrologue) {
+            auto result = checker->zetMetricGroupCreateExpPrologue( hDevice, pName, pDescription, samplingType, phMetricGroup );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupCreateExp(result, hDevice, pName, pDescription, samplingType, phMetricGroup);
         }
 
@@ -4903,15 +6351,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupCreateExpPrologue( hDevice, pName, pDescription, samplingType, phMetricGroup );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupCreateExp(result, hDevice, pName, pDescription, samplingType, phMetricGroup);
         }
 
         auto driver_result = pfnCreateExp( hDevice, pName, pDescription, samplingType, phMetricGroup );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCreateExpEpilogue( hDevice, pName, pDescription, samplingType, phMetricGroup ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricGroupCreateExpEpilogue) {
+                auto result = checker->zetMetricGroupCreateExpEpilogue( hDevice, pName, pDescription, samplingType, phMetricGroup ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupCreateExp(result, hDevice, pName, pDescription, samplingType, phMetricGroup);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricGroupCreateExpEpilogue) {
+            auto result = checker->zetMetricGroupCreateExpEpilogue( hDevice, pName, pDescription, samplingType, phMetricGroup ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupCreateExp(result, hDevice, pName, pDescription, samplingType, phMetricGroup);
         }
 
@@ -4942,16 +6397,24 @@ namespace validation_layer
                                                         ///< available, then driver shall only retrieve that length of error string.
         )
     {
-        context.logger->log_trace("zetMetricGroupAddMetricExp(hMetricGroup, hMetric, pErrorStringSize, pErrorString)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricGroupAddMetricExp(hMetricGroup, hMetric, pErrorStringSize, pErrorString)");
 
         auto pfnAddMetricExp = context.zetDdiTable.MetricGroupExp.pfnAddMetricExp;
 
         if( nullptr == pfnAddMetricExp )
             return logAndPropagateResult_zetMetricGroupAddMetricExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetricGroup, hMetric, pErrorStringSize, pErrorString);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupAddMetricExpPrologue( hMetricGroup, hMetric, pErrorStringSize, pErrorString );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricGroupAddMetricExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricGroupAddMetricExpPrologue) {
+                auto result = checker->zetMetricGroupAddMetricExpPrologue( hMetricGroup, hMetric, pErrorStringSize, pErrorString );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupAddMetricExp(result, hMetricGroup, hMetric, pErrorStringSize, pErrorString);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricGroupAddMetricExpPrologue) {
+            auto result = checker->zetMetricGroupAddMetricExpPrologue( hMetricGroup, hMetric, pErrorStringSize, pErrorString );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupAddMetricExp(result, hMetricGroup, hMetric, pErrorStringSize, pErrorString);
         }
 
@@ -4961,15 +6424,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupAddMetricExpPrologue( hMetricGroup, hMetric, pErrorStringSize, pErrorString );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupAddMetricExp(result, hMetricGroup, hMetric, pErrorStringSize, pErrorString);
         }
 
         auto driver_result = pfnAddMetricExp( hMetricGroup, hMetric, pErrorStringSize, pErrorString );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupAddMetricExpEpilogue( hMetricGroup, hMetric, pErrorStringSize, pErrorString ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricGroupAddMetricExpEpilogue) {
+                auto result = checker->zetMetricGroupAddMetricExpEpilogue( hMetricGroup, hMetric, pErrorStringSize, pErrorString ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupAddMetricExp(result, hMetricGroup, hMetric, pErrorStringSize, pErrorString);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricGroupAddMetricExpEpilogue) {
+            auto result = checker->zetMetricGroupAddMetricExpEpilogue( hMetricGroup, hMetric, pErrorStringSize, pErrorString ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupAddMetricExp(result, hMetricGroup, hMetric, pErrorStringSize, pErrorString);
         }
 
@@ -4984,16 +6454,24 @@ namespace validation_layer
         zet_metric_handle_t hMetric                     ///< [in] Metric handle to be removed from the metric group.
         )
     {
-        context.logger->log_trace("zetMetricGroupRemoveMetricExp(hMetricGroup, hMetric)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricGroupRemoveMetricExp(hMetricGroup, hMetric)");
 
         auto pfnRemoveMetricExp = context.zetDdiTable.MetricGroupExp.pfnRemoveMetricExp;
 
         if( nullptr == pfnRemoveMetricExp )
             return logAndPropagateResult_zetMetricGroupRemoveMetricExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetricGroup, hMetric);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupRemoveMetricExpPrologue( hMetricGroup, hMetric );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricGroupRemoveMetricExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricGroupRemoveMetricExpPrologue) {
+                auto result = checker->zetMetricGroupRemoveMetricExpPrologue( hMetricGroup, hMetric );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupRemoveMetricExp(result, hMetricGroup, hMetric);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricGroupRemoveMetricExpPrologue) {
+            auto result = checker->zetMetricGroupRemoveMetricExpPrologue( hMetricGroup, hMetric );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupRemoveMetricExp(result, hMetricGroup, hMetric);
         }
 
@@ -5003,15 +6481,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupRemoveMetricExpPrologue( hMetricGroup, hMetric );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupRemoveMetricExp(result, hMetricGroup, hMetric);
         }
 
         auto driver_result = pfnRemoveMetricExp( hMetricGroup, hMetric );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupRemoveMetricExpEpilogue( hMetricGroup, hMetric ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricGroupRemoveMetricExpEpilogue) {
+                auto result = checker->zetMetricGroupRemoveMetricExpEpilogue( hMetricGroup, hMetric ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupRemoveMetricExp(result, hMetricGroup, hMetric);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricGroupRemoveMetricExpEpilogue) {
+            auto result = checker->zetMetricGroupRemoveMetricExpEpilogue( hMetricGroup, hMetric ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupRemoveMetricExp(result, hMetricGroup, hMetric);
         }
 
@@ -5025,16 +6510,24 @@ namespace validation_layer
         zet_metric_group_handle_t hMetricGroup          ///< [in] Handle of the metric group
         )
     {
-        context.logger->log_trace("zetMetricGroupCloseExp(hMetricGroup)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricGroupCloseExp(hMetricGroup)");
 
         auto pfnCloseExp = context.zetDdiTable.MetricGroupExp.pfnCloseExp;
 
         if( nullptr == pfnCloseExp )
             return logAndPropagateResult_zetMetricGroupCloseExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetricGroup);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCloseExpPrologue( hMetricGroup );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricGroupCloseExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricGroupCloseExpPrologue) {
+                auto result = checker->zetMetricGroupCloseExpPrologue( hMetricGroup );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupCloseExp(result, hMetricGroup);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricGroupCloseExpPrologue) {
+            auto result = checker->zetMetricGroupCloseExpPrologue( hMetricGroup );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupCloseExp(result, hMetricGroup);
         }
 
@@ -5044,15 +6537,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupCloseExpPrologue( hMetricGroup );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupCloseExp(result, hMetricGroup);
         }
 
         auto driver_result = pfnCloseExp( hMetricGroup );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCloseExpEpilogue( hMetricGroup ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricGroupCloseExpEpilogue) {
+                auto result = checker->zetMetricGroupCloseExpEpilogue( hMetricGroup ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupCloseExp(result, hMetricGroup);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricGroupCloseExpEpilogue) {
+            auto result = checker->zetMetricGroupCloseExpEpilogue( hMetricGroup ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupCloseExp(result, hMetricGroup);
         }
 
@@ -5066,16 +6566,24 @@ namespace validation_layer
         zet_metric_group_handle_t hMetricGroup          ///< [in] Handle of the metric group to destroy
         )
     {
-        context.logger->log_trace("zetMetricGroupDestroyExp(hMetricGroup)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricGroupDestroyExp(hMetricGroup)");
 
         auto pfnDestroyExp = context.zetDdiTable.MetricGroupExp.pfnDestroyExp;
 
         if( nullptr == pfnDestroyExp )
             return logAndPropagateResult_zetMetricGroupDestroyExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetricGroup);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupDestroyExpPrologue( hMetricGroup );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricGroupDestroyExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricGroupDestroyExpPrologue) {
+                auto result = checker->zetMetricGroupDestroyExpPrologue( hMetricGroup );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupDestroyExp(result, hMetricGroup);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricGroupDestroyExpPrologue) {
+            auto result = checker->zetMetricGroupDestroyExpPrologue( hMetricGroup );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupDestroyExp(result, hMetricGroup);
         }
 
@@ -5085,15 +6593,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupDestroyExpPrologue( hMetricGroup );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupDestroyExp(result, hMetricGroup);
         }
 
         auto driver_result = pfnDestroyExp( hMetricGroup );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupDestroyExpEpilogue( hMetricGroup ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricGroupDestroyExpEpilogue) {
+                auto result = checker->zetMetricGroupDestroyExpEpilogue( hMetricGroup ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupDestroyExp(result, hMetricGroup);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricGroupDestroyExpEpilogue) {
+            auto result = checker->zetMetricGroupDestroyExpEpilogue( hMetricGroup ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricGroupDestroyExp(result, hMetricGroup);
         }
 
@@ -5107,16 +6622,24 @@ namespace validation_layer
         zet_metric_handle_t hMetric                     ///< [in] Handle of the metric to destroy
         )
     {
-        context.logger->log_trace("zetMetricDestroyExp(hMetric)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricDestroyExp(hMetric)");
 
         auto pfnDestroyExp = context.zetDdiTable.MetricExp.pfnDestroyExp;
 
         if( nullptr == pfnDestroyExp )
             return logAndPropagateResult_zetMetricDestroyExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetric);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricDestroyExpPrologue( hMetric );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricDestroyExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricDestroyExpPrologue) {
+                auto result = checker->zetMetricDestroyExpPrologue( hMetric );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricDestroyExp(result, hMetric);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricDestroyExpPrologue) {
+            auto result = checker->zetMetricDestroyExpPrologue( hMetric );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricDestroyExp(result, hMetric);
         }
 
@@ -5126,15 +6649,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricDestroyExpPrologue( hMetric );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricDestroyExp(result, hMetric);
         }
 
         auto driver_result = pfnDestroyExp( hMetric );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricDestroyExpEpilogue( hMetric ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricDestroyExpEpilogue) {
+                auto result = checker->zetMetricDestroyExpEpilogue( hMetric ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricDestroyExp(result, hMetric);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricDestroyExpEpilogue) {
+            auto result = checker->zetMetricDestroyExpEpilogue( hMetric ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricDestroyExp(result, hMetric);
         }
 
@@ -5156,16 +6686,24 @@ namespace validation_layer
                                                         ///< replays necessary.
         )
     {
-        context.logger->log_trace("zetDeviceGetConcurrentMetricGroupsExp(hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount)");
+        ZEL_LOG_TRACE(context.logger, "zetDeviceGetConcurrentMetricGroupsExp(hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount)");
 
         auto pfnGetConcurrentMetricGroupsExp = context.zetDdiTable.DeviceExp.pfnGetConcurrentMetricGroupsExp;
 
         if( nullptr == pfnGetConcurrentMetricGroupsExp )
             return logAndPropagateResult_zetDeviceGetConcurrentMetricGroupsExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDeviceGetConcurrentMetricGroupsExpPrologue( hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetDeviceGetConcurrentMetricGroupsExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDeviceGetConcurrentMetricGroupsExpPrologue) {
+                auto result = checker->zetDeviceGetConcurrentMetricGroupsExpPrologue( hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDeviceGetConcurrentMetricGroupsExp(result, hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDeviceGetConcurrentMetricGroupsExpPrologue) {
+            auto result = checker->zetDeviceGetConcurrentMetricGroupsExpPrologue( hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDeviceGetConcurrentMetricGroupsExp(result, hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount);
         }
 
@@ -5175,15 +6713,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDeviceGetConcurrentMetricGroupsExpPrologue( hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDeviceGetConcurrentMetricGroupsExp(result, hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount);
         }
 
         auto driver_result = pfnGetConcurrentMetricGroupsExp( hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDeviceGetConcurrentMetricGroupsExpEpilogue( hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDeviceGetConcurrentMetricGroupsExpEpilogue) {
+                auto result = checker->zetDeviceGetConcurrentMetricGroupsExpEpilogue( hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDeviceGetConcurrentMetricGroupsExp(result, hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDeviceGetConcurrentMetricGroupsExpEpilogue) {
+            auto result = checker->zetDeviceGetConcurrentMetricGroupsExpEpilogue( hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDeviceGetConcurrentMetricGroupsExp(result, hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount);
         }
 
@@ -5210,16 +6755,24 @@ namespace validation_layer
         zet_metric_tracer_exp_handle_t* phMetricTracer  ///< [out] handle of the metric tracer
         )
     {
-        context.logger->log_trace("zetMetricTracerCreateExp(hContext, hDevice, metricGroupCount, phMetricGroupsLocal, desc, hNotificationEvent, phMetricTracer)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricTracerCreateExp(hContext, hDevice, metricGroupCount, phMetricGroupsLocal, desc, hNotificationEvent, phMetricTracer)");
 
         auto pfnCreateExp = context.zetDdiTable.MetricTracerExp.pfnCreateExp;
 
         if( nullptr == pfnCreateExp )
             return logAndPropagateResult_zetMetricTracerCreateExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hContext, hDevice, metricGroupCount, phMetricGroups, desc, hNotificationEvent, phMetricTracer);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerCreateExpPrologue( hContext, hDevice, metricGroupCount, phMetricGroups, desc, hNotificationEvent, phMetricTracer );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricTracerCreateExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricTracerCreateExpPrologue) {
+                auto result = checker->zetMetricTracerCreateExpPrologue( hContext, hDevice, metricGroupCount, phMetricGroups, desc, hNotificationEvent, phMetricTracer );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerCreateExp(result, hContext, hDevice, metricGroupCount, phMetricGroups, desc, hNotificationEvent, phMetricTracer);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricTracerCreateExpPrologue) {
+            auto result = checker->zetMetricTracerCreateExpPrologue( hContext, hDevice, metricGroupCount, phMetricGroups, desc, hNotificationEvent, phMetricTracer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerCreateExp(result, hContext, hDevice, metricGroupCount, phMetricGroups, desc, hNotificationEvent, phMetricTracer);
         }
 
@@ -5229,15 +6782,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricTracerCreateExpPrologue( hContext, hDevice, metricGroupCount, phMetricGroups, desc, hNotificationEvent, phMetricTracer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerCreateExp(result, hContext, hDevice, metricGroupCount, phMetricGroups, desc, hNotificationEvent, phMetricTracer);
         }
 
         auto driver_result = pfnCreateExp( hContext, hDevice, metricGroupCount, phMetricGroups, desc, hNotificationEvent, phMetricTracer );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerCreateExpEpilogue( hContext, hDevice, metricGroupCount, phMetricGroups, desc, hNotificationEvent, phMetricTracer ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricTracerCreateExpEpilogue) {
+                auto result = checker->zetMetricTracerCreateExpEpilogue( hContext, hDevice, metricGroupCount, phMetricGroups, desc, hNotificationEvent, phMetricTracer ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerCreateExp(result, hContext, hDevice, metricGroupCount, phMetricGroups, desc, hNotificationEvent, phMetricTracer);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricTracerCreateExpEpilogue) {
+            auto result = checker->zetMetricTracerCreateExpEpilogue( hContext, hDevice, metricGroupCount, phMetricGroups, desc, hNotificationEvent, phMetricTracer ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerCreateExp(result, hContext, hDevice, metricGroupCount, phMetricGroups, desc, hNotificationEvent, phMetricTracer);
         }
 
@@ -5260,16 +6820,24 @@ namespace validation_layer
         zet_metric_tracer_exp_handle_t hMetricTracer    ///< [in] handle of the metric tracer
         )
     {
-        context.logger->log_trace("zetMetricTracerDestroyExp(hMetricTracer)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricTracerDestroyExp(hMetricTracer)");
 
         auto pfnDestroyExp = context.zetDdiTable.MetricTracerExp.pfnDestroyExp;
 
         if( nullptr == pfnDestroyExp )
             return logAndPropagateResult_zetMetricTracerDestroyExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetricTracer);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerDestroyExpPrologue( hMetricTracer );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricTracerDestroyExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricTracerDestroyExpPrologue) {
+                auto result = checker->zetMetricTracerDestroyExpPrologue( hMetricTracer );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerDestroyExp(result, hMetricTracer);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricTracerDestroyExpPrologue) {
+            auto result = checker->zetMetricTracerDestroyExpPrologue( hMetricTracer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerDestroyExp(result, hMetricTracer);
         }
 
@@ -5279,15 +6847,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricTracerDestroyExpPrologue( hMetricTracer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerDestroyExp(result, hMetricTracer);
         }
 
         auto driver_result = pfnDestroyExp( hMetricTracer );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerDestroyExpEpilogue( hMetricTracer ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricTracerDestroyExpEpilogue) {
+                auto result = checker->zetMetricTracerDestroyExpEpilogue( hMetricTracer ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerDestroyExp(result, hMetricTracer);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricTracerDestroyExpEpilogue) {
+            auto result = checker->zetMetricTracerDestroyExpEpilogue( hMetricTracer ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerDestroyExp(result, hMetricTracer);
         }
 
@@ -5306,16 +6881,24 @@ namespace validation_layer
                                                         ///< when the tracer is active.
         )
     {
-        context.logger->log_trace("zetMetricTracerEnableExp(hMetricTracer, synchronous)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricTracerEnableExp(hMetricTracer, synchronous)");
 
         auto pfnEnableExp = context.zetDdiTable.MetricTracerExp.pfnEnableExp;
 
         if( nullptr == pfnEnableExp )
             return logAndPropagateResult_zetMetricTracerEnableExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetricTracer, synchronous);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerEnableExpPrologue( hMetricTracer, synchronous );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricTracerEnableExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricTracerEnableExpPrologue) {
+                auto result = checker->zetMetricTracerEnableExpPrologue( hMetricTracer, synchronous );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerEnableExp(result, hMetricTracer, synchronous);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricTracerEnableExpPrologue) {
+            auto result = checker->zetMetricTracerEnableExpPrologue( hMetricTracer, synchronous );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerEnableExp(result, hMetricTracer, synchronous);
         }
 
@@ -5325,15 +6908,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricTracerEnableExpPrologue( hMetricTracer, synchronous );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerEnableExp(result, hMetricTracer, synchronous);
         }
 
         auto driver_result = pfnEnableExp( hMetricTracer, synchronous );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerEnableExpEpilogue( hMetricTracer, synchronous ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricTracerEnableExpEpilogue) {
+                auto result = checker->zetMetricTracerEnableExpEpilogue( hMetricTracer, synchronous ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerEnableExp(result, hMetricTracer, synchronous);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricTracerEnableExpEpilogue) {
+            auto result = checker->zetMetricTracerEnableExpEpilogue( hMetricTracer, synchronous ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerEnableExp(result, hMetricTracer, synchronous);
         }
 
@@ -5353,16 +6943,24 @@ namespace validation_layer
                                                         ///< has no more data to be retrieved.
         )
     {
-        context.logger->log_trace("zetMetricTracerDisableExp(hMetricTracer, synchronous)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricTracerDisableExp(hMetricTracer, synchronous)");
 
         auto pfnDisableExp = context.zetDdiTable.MetricTracerExp.pfnDisableExp;
 
         if( nullptr == pfnDisableExp )
             return logAndPropagateResult_zetMetricTracerDisableExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetricTracer, synchronous);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerDisableExpPrologue( hMetricTracer, synchronous );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricTracerDisableExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricTracerDisableExpPrologue) {
+                auto result = checker->zetMetricTracerDisableExpPrologue( hMetricTracer, synchronous );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerDisableExp(result, hMetricTracer, synchronous);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricTracerDisableExpPrologue) {
+            auto result = checker->zetMetricTracerDisableExpPrologue( hMetricTracer, synchronous );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerDisableExp(result, hMetricTracer, synchronous);
         }
 
@@ -5372,15 +6970,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricTracerDisableExpPrologue( hMetricTracer, synchronous );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerDisableExp(result, hMetricTracer, synchronous);
         }
 
         auto driver_result = pfnDisableExp( hMetricTracer, synchronous );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerDisableExpEpilogue( hMetricTracer, synchronous ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricTracerDisableExpEpilogue) {
+                auto result = checker->zetMetricTracerDisableExpEpilogue( hMetricTracer, synchronous ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerDisableExp(result, hMetricTracer, synchronous);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricTracerDisableExpEpilogue) {
+            auto result = checker->zetMetricTracerDisableExpEpilogue( hMetricTracer, synchronous ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerDisableExp(result, hMetricTracer, synchronous);
         }
 
@@ -5403,16 +7008,24 @@ namespace validation_layer
                                                         ///< data in raw format
         )
     {
-        context.logger->log_trace("zetMetricTracerReadDataExp(hMetricTracer, pRawDataSize, pRawData)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricTracerReadDataExp(hMetricTracer, pRawDataSize, pRawData)");
 
         auto pfnReadDataExp = context.zetDdiTable.MetricTracerExp.pfnReadDataExp;
 
         if( nullptr == pfnReadDataExp )
             return logAndPropagateResult_zetMetricTracerReadDataExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetricTracer, pRawDataSize, pRawData);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerReadDataExpPrologue( hMetricTracer, pRawDataSize, pRawData );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricTracerReadDataExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricTracerReadDataExpPrologue) {
+                auto result = checker->zetMetricTracerReadDataExpPrologue( hMetricTracer, pRawDataSize, pRawData );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerReadDataExp(result, hMetricTracer, pRawDataSize, pRawData);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricTracerReadDataExpPrologue) {
+            auto result = checker->zetMetricTracerReadDataExpPrologue( hMetricTracer, pRawDataSize, pRawData );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerReadDataExp(result, hMetricTracer, pRawDataSize, pRawData);
         }
 
@@ -5422,15 +7035,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricTracerReadDataExpPrologue( hMetricTracer, pRawDataSize, pRawData );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerReadDataExp(result, hMetricTracer, pRawDataSize, pRawData);
         }
 
         auto driver_result = pfnReadDataExp( hMetricTracer, pRawDataSize, pRawData );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerReadDataExpEpilogue( hMetricTracer, pRawDataSize, pRawData ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricTracerReadDataExpEpilogue) {
+                auto result = checker->zetMetricTracerReadDataExpEpilogue( hMetricTracer, pRawDataSize, pRawData ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerReadDataExp(result, hMetricTracer, pRawDataSize, pRawData);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricTracerReadDataExpEpilogue) {
+            auto result = checker->zetMetricTracerReadDataExpEpilogue( hMetricTracer, pRawDataSize, pRawData ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerReadDataExp(result, hMetricTracer, pRawDataSize, pRawData);
         }
 
@@ -5445,16 +7065,24 @@ namespace validation_layer
         zet_metric_decoder_exp_handle_t* phMetricDecoder///< [out] handle of the metric decoder object
         )
     {
-        context.logger->log_trace("zetMetricDecoderCreateExp(hMetricTracer, phMetricDecoder)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricDecoderCreateExp(hMetricTracer, phMetricDecoder)");
 
         auto pfnCreateExp = context.zetDdiTable.MetricDecoderExp.pfnCreateExp;
 
         if( nullptr == pfnCreateExp )
             return logAndPropagateResult_zetMetricDecoderCreateExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetricTracer, phMetricDecoder);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricDecoderCreateExpPrologue( hMetricTracer, phMetricDecoder );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricDecoderCreateExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricDecoderCreateExpPrologue) {
+                auto result = checker->zetMetricDecoderCreateExpPrologue( hMetricTracer, phMetricDecoder );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricDecoderCreateExp(result, hMetricTracer, phMetricDecoder);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricDecoderCreateExpPrologue) {
+            auto result = checker->zetMetricDecoderCreateExpPrologue( hMetricTracer, phMetricDecoder );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricDecoderCreateExp(result, hMetricTracer, phMetricDecoder);
         }
 
@@ -5464,15 +7092,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricDecoderCreateExpPrologue( hMetricTracer, phMetricDecoder );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricDecoderCreateExp(result, hMetricTracer, phMetricDecoder);
         }
 
         auto driver_result = pfnCreateExp( hMetricTracer, phMetricDecoder );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricDecoderCreateExpEpilogue( hMetricTracer, phMetricDecoder ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricDecoderCreateExpEpilogue) {
+                auto result = checker->zetMetricDecoderCreateExpEpilogue( hMetricTracer, phMetricDecoder ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricDecoderCreateExp(result, hMetricTracer, phMetricDecoder);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricDecoderCreateExpEpilogue) {
+            auto result = checker->zetMetricDecoderCreateExpEpilogue( hMetricTracer, phMetricDecoder ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricDecoderCreateExp(result, hMetricTracer, phMetricDecoder);
         }
 
@@ -5495,16 +7130,24 @@ namespace validation_layer
         zet_metric_decoder_exp_handle_t phMetricDecoder ///< [in] handle of the metric decoder object
         )
     {
-        context.logger->log_trace("zetMetricDecoderDestroyExp(phMetricDecoder)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricDecoderDestroyExp(phMetricDecoder)");
 
         auto pfnDestroyExp = context.zetDdiTable.MetricDecoderExp.pfnDestroyExp;
 
         if( nullptr == pfnDestroyExp )
             return logAndPropagateResult_zetMetricDecoderDestroyExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, phMetricDecoder);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricDecoderDestroyExpPrologue( phMetricDecoder );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricDecoderDestroyExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricDecoderDestroyExpPrologue) {
+                auto result = checker->zetMetricDecoderDestroyExpPrologue( phMetricDecoder );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricDecoderDestroyExp(result, phMetricDecoder);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricDecoderDestroyExpPrologue) {
+            auto result = checker->zetMetricDecoderDestroyExpPrologue( phMetricDecoder );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricDecoderDestroyExp(result, phMetricDecoder);
         }
 
@@ -5514,15 +7157,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricDecoderDestroyExpPrologue( phMetricDecoder );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricDecoderDestroyExp(result, phMetricDecoder);
         }
 
         auto driver_result = pfnDestroyExp( phMetricDecoder );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricDecoderDestroyExpEpilogue( phMetricDecoder ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricDecoderDestroyExpEpilogue) {
+                auto result = checker->zetMetricDecoderDestroyExpEpilogue( phMetricDecoder ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricDecoderDestroyExp(result, phMetricDecoder);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricDecoderDestroyExpEpilogue) {
+            auto result = checker->zetMetricDecoderDestroyExpEpilogue( phMetricDecoder ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricDecoderDestroyExp(result, phMetricDecoder);
         }
 
@@ -5547,16 +7197,24 @@ namespace validation_layer
                                                         ///< the hMetricDecoder handle provided.
         )
     {
-        context.logger->log_trace("zetMetricDecoderGetDecodableMetricsExp(hMetricDecoder, pCount, phMetrics)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricDecoderGetDecodableMetricsExp(hMetricDecoder, pCount, phMetrics)");
 
         auto pfnGetDecodableMetricsExp = context.zetDdiTable.MetricDecoderExp.pfnGetDecodableMetricsExp;
 
         if( nullptr == pfnGetDecodableMetricsExp )
             return logAndPropagateResult_zetMetricDecoderGetDecodableMetricsExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hMetricDecoder, pCount, phMetrics);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricDecoderGetDecodableMetricsExpPrologue( hMetricDecoder, pCount, phMetrics );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricDecoderGetDecodableMetricsExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricDecoderGetDecodableMetricsExpPrologue) {
+                auto result = checker->zetMetricDecoderGetDecodableMetricsExpPrologue( hMetricDecoder, pCount, phMetrics );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricDecoderGetDecodableMetricsExp(result, hMetricDecoder, pCount, phMetrics);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricDecoderGetDecodableMetricsExpPrologue) {
+            auto result = checker->zetMetricDecoderGetDecodableMetricsExpPrologue( hMetricDecoder, pCount, phMetrics );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricDecoderGetDecodableMetricsExp(result, hMetricDecoder, pCount, phMetrics);
         }
 
@@ -5566,15 +7224,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricDecoderGetDecodableMetricsExpPrologue( hMetricDecoder, pCount, phMetrics );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricDecoderGetDecodableMetricsExp(result, hMetricDecoder, pCount, phMetrics);
         }
 
         auto driver_result = pfnGetDecodableMetricsExp( hMetricDecoder, pCount, phMetrics );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricDecoderGetDecodableMetricsExpEpilogue( hMetricDecoder, pCount, phMetrics ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricDecoderGetDecodableMetricsExpEpilogue) {
+                auto result = checker->zetMetricDecoderGetDecodableMetricsExpEpilogue( hMetricDecoder, pCount, phMetrics ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricDecoderGetDecodableMetricsExp(result, hMetricDecoder, pCount, phMetrics);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricDecoderGetDecodableMetricsExpEpilogue) {
+            auto result = checker->zetMetricDecoderGetDecodableMetricsExpEpilogue( hMetricDecoder, pCount, phMetrics ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricDecoderGetDecodableMetricsExp(result, hMetricDecoder, pCount, phMetrics);
         }
 
@@ -5637,16 +7302,24 @@ namespace validation_layer
                                                         ///< decoded metric entries
         )
     {
-        context.logger->log_trace("zetMetricTracerDecodeExp(phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetricsLocal, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries)");
+        ZEL_LOG_TRACE(context.logger, "zetMetricTracerDecodeExp(phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetricsLocal, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries)");
 
         auto pfnDecodeExp = context.zetDdiTable.MetricTracerExp.pfnDecodeExp;
 
         if( nullptr == pfnDecodeExp )
             return logAndPropagateResult_zetMetricTracerDecodeExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetrics, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerDecodeExpPrologue( phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetrics, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetMetricTracerDecodeExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricTracerDecodeExpPrologue) {
+                auto result = checker->zetMetricTracerDecodeExpPrologue( phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetrics, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerDecodeExp(result, phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetrics, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricTracerDecodeExpPrologue) {
+            auto result = checker->zetMetricTracerDecodeExpPrologue( phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetrics, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerDecodeExp(result, phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetrics, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries);
         }
 
@@ -5656,15 +7329,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricTracerDecodeExpPrologue( phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetrics, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerDecodeExp(result, phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetrics, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries);
         }
 
         auto driver_result = pfnDecodeExp( phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetrics, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerDecodeExpEpilogue( phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetrics, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetMetricTracerDecodeExpEpilogue) {
+                auto result = checker->zetMetricTracerDecodeExpEpilogue( phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetrics, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerDecodeExp(result, phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetrics, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetMetricTracerDecodeExpEpilogue) {
+            auto result = checker->zetMetricTracerDecodeExpEpilogue( phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetrics, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetMetricTracerDecodeExp(result, phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetrics, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries);
         }
 
@@ -5682,16 +7362,24 @@ namespace validation_layer
         uint32_t value                                  ///< [in] marker value
         )
     {
-        context.logger->log_trace("zetCommandListAppendMarkerExp(hCommandList, hMetricGroup, value)");
+        ZEL_LOG_TRACE(context.logger, "zetCommandListAppendMarkerExp(hCommandList, hMetricGroup, value)");
 
         auto pfnAppendMarkerExp = context.zetDdiTable.CommandListExp.pfnAppendMarkerExp;
 
         if( nullptr == pfnAppendMarkerExp )
             return logAndPropagateResult_zetCommandListAppendMarkerExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hCommandList, hMetricGroup, value);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetCommandListAppendMarkerExpPrologue( hCommandList, hMetricGroup, value );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetCommandListAppendMarkerExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetCommandListAppendMarkerExpPrologue) {
+                auto result = checker->zetCommandListAppendMarkerExpPrologue( hCommandList, hMetricGroup, value );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetCommandListAppendMarkerExp(result, hCommandList, hMetricGroup, value);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetCommandListAppendMarkerExpPrologue) {
+            auto result = checker->zetCommandListAppendMarkerExpPrologue( hCommandList, hMetricGroup, value );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetCommandListAppendMarkerExp(result, hCommandList, hMetricGroup, value);
         }
 
@@ -5701,15 +7389,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetCommandListAppendMarkerExpPrologue( hCommandList, hMetricGroup, value );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetCommandListAppendMarkerExp(result, hCommandList, hMetricGroup, value);
         }
 
         auto driver_result = pfnAppendMarkerExp( hCommandList, hMetricGroup, value );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetCommandListAppendMarkerExpEpilogue( hCommandList, hMetricGroup, value ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetCommandListAppendMarkerExpEpilogue) {
+                auto result = checker->zetCommandListAppendMarkerExpEpilogue( hCommandList, hMetricGroup, value ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetCommandListAppendMarkerExp(result, hCommandList, hMetricGroup, value);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetCommandListAppendMarkerExpEpilogue) {
+            auto result = checker->zetCommandListAppendMarkerExpEpilogue( hCommandList, hMetricGroup, value ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetCommandListAppendMarkerExp(result, hCommandList, hMetricGroup, value);
         }
 
@@ -5723,16 +7418,24 @@ namespace validation_layer
         zet_device_handle_t hDevice                     ///< [in] handle of the device where metrics collection has to be enabled.
         )
     {
-        context.logger->log_trace("zetDeviceEnableMetricsExp(hDevice)");
+        ZEL_LOG_TRACE(context.logger, "zetDeviceEnableMetricsExp(hDevice)");
 
         auto pfnEnableMetricsExp = context.zetDdiTable.DeviceExp.pfnEnableMetricsExp;
 
         if( nullptr == pfnEnableMetricsExp )
             return logAndPropagateResult_zetDeviceEnableMetricsExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDeviceEnableMetricsExpPrologue( hDevice );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetDeviceEnableMetricsExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDeviceEnableMetricsExpPrologue) {
+                auto result = checker->zetDeviceEnableMetricsExpPrologue( hDevice );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDeviceEnableMetricsExp(result, hDevice);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDeviceEnableMetricsExpPrologue) {
+            auto result = checker->zetDeviceEnableMetricsExpPrologue( hDevice );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDeviceEnableMetricsExp(result, hDevice);
         }
 
@@ -5742,15 +7445,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDeviceEnableMetricsExpPrologue( hDevice );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDeviceEnableMetricsExp(result, hDevice);
         }
 
         auto driver_result = pfnEnableMetricsExp( hDevice );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDeviceEnableMetricsExpEpilogue( hDevice ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDeviceEnableMetricsExpEpilogue) {
+                auto result = checker->zetDeviceEnableMetricsExpEpilogue( hDevice ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDeviceEnableMetricsExp(result, hDevice);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDeviceEnableMetricsExpEpilogue) {
+            auto result = checker->zetDeviceEnableMetricsExpEpilogue( hDevice ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDeviceEnableMetricsExp(result, hDevice);
         }
 
@@ -5764,16 +7474,24 @@ namespace validation_layer
         zet_device_handle_t hDevice                     ///< [in] handle of the device where metrics collection has to be disabled
         )
     {
-        context.logger->log_trace("zetDeviceDisableMetricsExp(hDevice)");
+        ZEL_LOG_TRACE(context.logger, "zetDeviceDisableMetricsExp(hDevice)");
 
         auto pfnDisableMetricsExp = context.zetDdiTable.DeviceExp.pfnDisableMetricsExp;
 
         if( nullptr == pfnDisableMetricsExp )
             return logAndPropagateResult_zetDeviceDisableMetricsExp(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, hDevice);
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDeviceDisableMetricsExpPrologue( hDevice );
+        static thread_local uint32_t sampleCountdown = 0;
+        const bool sampled = context.sampleAllCalls || context.sampleCall(sampleCountdown);
+        if (sampled || !context.validationDispatch.zet.zetDeviceDisableMetricsExpPrologue.empty()) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDeviceDisableMetricsExpPrologue) {
+                auto result = checker->zetDeviceDisableMetricsExpPrologue( hDevice );
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDeviceDisableMetricsExp(result, hDevice);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDeviceDisableMetricsExpPrologue) {
+            auto result = checker->zetDeviceDisableMetricsExpPrologue( hDevice );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDeviceDisableMetricsExp(result, hDevice);
         }
 
@@ -5783,15 +7501,22 @@ namespace validation_layer
         }
 
         
-        if(context.enableHandleLifetime ){
+        if(context.enableHandleLifetime && sampled ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDeviceDisableMetricsExpPrologue( hDevice );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDeviceDisableMetricsExp(result, hDevice);
         }
 
         auto driver_result = pfnDisableMetricsExp( hDevice );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDeviceDisableMetricsExpEpilogue( hDevice ,driver_result);
+        if (sampled) {
+            for (auto checker : context.sampledValidationDispatch.zet.zetDeviceDisableMetricsExpEpilogue) {
+                auto result = checker->zetDeviceDisableMetricsExpEpilogue( hDevice ,driver_result);
+                if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDeviceDisableMetricsExp(result, hDevice);
+            }
+        }
+
+        for (auto checker : context.validationDispatch.zet.zetDeviceDisableMetricsExpEpilogue) {
+            auto result = checker->zetDeviceDisableMetricsExpEpilogue( hDevice ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult_zetDeviceDisableMetricsExp(result, hDevice);
         }
 
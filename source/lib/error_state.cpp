@@ -1,35 +1,58 @@
 #include "error_state.h"
 
+#include <atomic>
+
 namespace error_state
 {
-    std::unordered_map<std::thread::id, std::string> errorDescs;
-    std::mutex errorDescsMutex;
-
-    void setErrorDesc(const std::string &desc)
+    namespace
     {
-        auto threadId = std::this_thread::get_id();
-        std::lock_guard<std::mutex> errorDescsLock(errorDescsMutex);
-        if (errorDescs.find(threadId) == errorDescs.end())
+        std::atomic<size_t> liveDescs{0};
+
+        struct ThreadErrorDesc
+        {
+            ThreadErrorDesc();
+            ~ThreadErrorDesc();
+
+            std::string desc;
+        };
+
+        // Set once the calling thread's description has been destroyed at
+        // thread exit; a trivially destructible flag stays readable after.
+        thread_local bool threadDescDestroyed = false;
+        thread_local ThreadErrorDesc threadDesc;
+
+        ThreadErrorDesc::ThreadErrorDesc()
         {
-            errorDescs[threadId] = desc;
+            liveDescs.fetch_add(1, std::memory_order_relaxed);
         }
-        else
+
+        ThreadErrorDesc::~ThreadErrorDesc()
         {
-            errorDescs[threadId].clear();
-            errorDescs[threadId] = desc;
+            threadDescDestroyed = true;
+            liveDescs.fetch_sub(1, std::memory_order_relaxed);
         }
     }
 
-    void getErrorDesc(const char **ppString)
+    void setErrorDesc(const std::string &desc)
     {
-        auto threadId = std::this_thread::get_id();
-        std::lock_guard<std::mutex> errorDescsLock(errorDescsMutex);
-        if (errorDescs.find(threadId) == errorDescs.end())
-        {
-            errorDescs[threadId] = std::string();
+        // Errors raised by thread_local or static destructors running after
+        // the description was destroyed are dropped.
+        if (threadDescDestroyed) {
+            return;
         }
-        if(ppString != nullptr) {
-            *ppString = errorDescs[threadId].c_str();
+        threadDesc.desc = desc;
+    }
+
+    void getErrorDesc(const char **ppString)
+    {
+        if (ppString == nullptr) {
+            return;
         }
+        *ppString = threadDescDestroyed ? "" : threadDesc.desc.c_str();
+    }
+
+    size_t threadDescCount()
+    {
+        return liveDescs.load(std::memory_order_relaxed);
     }
-}
\ No newline at end of file
+}
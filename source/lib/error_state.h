@@ -1,15 +1,17 @@
 #pragma once
-#include <unordered_map>
+#include <cstddef>
 #include <string>
-#include <thread>
-#include <mutex>
 
 namespace error_state
 {
-    extern std::unordered_map<std::thread::id, std::string> errorDescs;
-    extern std::mutex errorDescsMutex;
-
+    // The last error description of the calling thread, as returned by
+    // zerGetLastErrorDescription. Each thread keeps its own description in
+    // thread-local storage, freed when the thread exits; the string returned
+    // by getErrorDesc stays valid until the thread's next setErrorDesc.
     void setErrorDesc(const std::string &desc);
 
     void getErrorDesc(const char **ppString);
-}
\ No newline at end of file
+
+    // Number of threads currently holding an error description.
+    size_t threadDescCount();
+}
@@ -16,6 +16,7 @@ namespace ze_lib
     }
 void __attribute__((destructor)) deleteLibContext() {
     delete context;
+    context = nullptr;
 } 
 #endif
 
@@ -0,0 +1,112 @@
+/*
+ *
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file sample_ring.h
+ *
+ */
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace ze_lib
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    /// Fixed-size history of one sampled counter. One thread pushes, any thread
+    /// reads, neither takes a lock. Each slot carries a sequence number that is
+    /// odd while the slot is written, so a reader detects and drops a slot the
+    /// writer overwrote under it.
+    class sample_ring_t
+    {
+    public:
+        struct sample_t
+        {
+            uint64_t timeNs = 0;    // monotonic time of the read
+            uint64_t counter = 0;   // the counter, e.g. energy in microjoules
+            uint64_t timestamp = 0; // the driver's timestamp of the counter, in microseconds
+        };
+
+        // The oldest and newest samples of a window and their number.
+        struct window_t
+        {
+            uint32_t count = 0;
+            sample_t first;
+            sample_t last;
+        };
+
+        explicit sample_ring_t(size_t capacity)
+            : capacity(capacity), slots(new slot_t[capacity]) {}
+
+        sample_ring_t(const sample_ring_t &) = delete;
+        sample_ring_t &operator=(const sample_ring_t &) = delete;
+
+        // Only ever called from one thread.
+        void push(const sample_t &sample)
+        {
+            const uint64_t index = pushed.load(std::memory_order_relaxed);
+            slot_t &slot = slots[index % capacity];
+            slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            slot.timeNs.store(sample.timeNs, std::memory_order_relaxed);
+            slot.counter.store(sample.counter, std::memory_order_relaxed);
+            slot.timestamp.store(sample.timestamp, std::memory_order_relaxed);
+            slot.sequence.store(2 * index + 2, std::memory_order_release);
+            pushed.store(index + 1, std::memory_order_release);
+        }
+
+        // Collects the samples taken at or after sinceNs, walking back from
+        // the newest one.
+        window_t read(uint64_t sinceNs) const
+        {
+            window_t window;
+            const uint64_t newest = pushed.load(std::memory_order_acquire);
+            const uint64_t oldest = newest > capacity ? newest - capacity : 0;
+            for (uint64_t index = newest; index > oldest; --index) {
+                sample_t sample;
+                if (!load(index - 1, sample) || sample.timeNs < sinceNs) {
+                    break;
+                }
+                if (0 == window.count) {
+                    window.last = sample;
+                }
+                window.first = sample;
+                ++window.count;
+            }
+            return window;
+        }
+
+        uint64_t size() const { return pushed.load(std::memory_order_acquire); }
+
+    private:
+        struct slot_t
+        {
+            std::atomic<uint64_t> sequence{0};
+            std::atomic<uint64_t> timeNs{0};
+            std::atomic<uint64_t> counter{0};
+            std::atomic<uint64_t> timestamp{0};
+        };
+
+        bool load(uint64_t index, sample_t &sample) const
+        {
+            const slot_t &slot = slots[index % capacity];
+            const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+            if (sequence != 2 * index + 2) {
+                return false;
+            }
+            sample.timeNs = slot.timeNs.load(std::memory_order_relaxed);
+            sample.counter = slot.counter.load(std::memory_order_relaxed);
+            sample.timestamp = slot.timestamp.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return slot.sequence.load(std::memory_order_relaxed) == sequence;
+        }
+
+        const size_t capacity;
+        std::unique_ptr<slot_t[]> slots;
+        std::atomic<uint64_t> pushed{0};
+    };
+
+} // namespace ze_lib
@@ -0,0 +1,173 @@
+/*
+ *
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file sysman_sampler.cpp
+ *
+ */
+#include "sysman_sampler.h"
+#include "ze_lib.h"
+
+#include <algorithm>
+#include <system_error>
+
+namespace ze_lib
+{
+    constexpr uint32_t sysman_sampler_t::defaultPeriodUs;
+    constexpr uint32_t sysman_sampler_t::defaultHistoryLength;
+
+    namespace
+    {
+        uint64_t monotonicNs()
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        // Average rate of each source's counter over the last windowNs. The
+        // counters count microseconds or microjoules and their timestamps
+        // microseconds, so counter over time is a busy fraction or watts.
+        template <typename source_t>
+        ze_result_t getRates(const std::vector<std::unique_ptr<source_t>> &sources, uint64_t windowNs,
+                             double scale, uint32_t count, zel_sysman_sampler_rate_t *pRates)
+        {
+            if (count > sources.size()) {
+                return ZE_RESULT_ERROR_INVALID_SIZE;
+            }
+            if (0 != count && nullptr == pRates) {
+                return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+            }
+            const uint64_t now = monotonicNs();
+            const uint64_t sinceNs = (windowNs < now) ? now - windowNs : 0;
+            for (uint32_t i = 0; i < count; ++i) {
+                const auto window = sources[i]->ring.read(sinceNs);
+                zel_sysman_sampler_rate_t &rate = pRates[i];
+                rate = {};
+                rate.sampleCount = window.count;
+                rate.result = ZE_RESULT_NOT_READY;
+                if (window.count < 2) {
+                    const ze_result_t lastResult = sources[i]->lastResult.load(std::memory_order_relaxed);
+                    if (ZE_RESULT_SUCCESS != lastResult) {
+                        rate.result = lastResult;
+                    }
+                    continue;
+                }
+                rate.startNs = window.first.timeNs;
+                rate.endNs = window.last.timeNs;
+                // Fall back to the sampler's clock for drivers whose
+                // timestamps do not advance between reads.
+                double elapsedUs = static_cast<double>(window.last.timestamp - window.first.timestamp);
+                if (window.last.timestamp <= window.first.timestamp) {
+                    elapsedUs = static_cast<double>(window.last.timeNs - window.first.timeNs) / 1000.0;
+                }
+                if (elapsedUs <= 0.0) {
+                    continue;
+                }
+                rate.value = scale * static_cast<double>(window.last.counter - window.first.counter) / elapsedUs;
+                rate.result = ZE_RESULT_SUCCESS;
+            }
+            return ZE_RESULT_SUCCESS;
+        }
+    } // namespace
+
+    ///////////////////////////////////////////////////////////////////////////////
+    sysman_sampler_t::sysman_sampler_t(const zel_sysman_sampler_desc_t &desc)
+        : period(0 != desc.periodUs ? desc.periodUs : defaultPeriodUs)
+    {
+        const size_t historyLength = 0 != desc.historyLength ? desc.historyLength : defaultHistoryLength;
+        for (uint32_t i = 0; i < desc.powerCount; ++i) {
+            power.emplace_back(new source_t<zes_pwr_handle_t>(desc.phPower[i], historyLength));
+        }
+        for (uint32_t i = 0; i < desc.engineCount; ++i) {
+            engines.emplace_back(new source_t<zes_engine_handle_t>(desc.phEngine[i], historyLength));
+        }
+    }
+
+    sysman_sampler_t::~sysman_sampler_t()
+    {
+        stop();
+    }
+
+    ze_result_t sysman_sampler_t::start()
+    {
+        try {
+            thread = std::thread(&sysman_sampler_t::run, this);
+        } catch (const std::system_error &) {
+            return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    void sysman_sampler_t::stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(stopMutex);
+            stopRequested = true;
+        }
+        stopCondition.notify_all();
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+
+    void sysman_sampler_t::run()
+    {
+        auto next = std::chrono::steady_clock::now();
+        std::unique_lock<std::mutex> lock(stopMutex);
+        while (!stopRequested) {
+            lock.unlock();
+            sample();
+            lock.lock();
+            // A late tick is not made up for with a burst of reads.
+            next = std::max(next + period, std::chrono::steady_clock::now());
+            stopCondition.wait_until(lock, next, [this]() { return stopRequested; });
+        }
+    }
+
+    void sysman_sampler_t::sample()
+    {
+        auto dditable = ze_lib::zesDdiTable.load(std::memory_order_acquire);
+        auto pfnGetEnergyCounter = (nullptr != dditable) ? dditable->Power.pfnGetEnergyCounter : nullptr;
+        auto pfnGetActivity = (nullptr != dditable) ? dditable->Engine.pfnGetActivity : nullptr;
+
+        for (auto &source : power) {
+            zes_power_energy_counter_t energy = {};
+            const ze_result_t result = (nullptr != pfnGetEnergyCounter)
+                ? pfnGetEnergyCounter(source->handle, &energy) : ZE_RESULT_ERROR_UNINITIALIZED;
+            source->lastResult.store(result, std::memory_order_relaxed);
+            if (ZE_RESULT_SUCCESS == result) {
+                sample_ring_t::sample_t sample;
+                sample.timeNs = monotonicNs();
+                sample.counter = energy.energy;
+                sample.timestamp = energy.timestamp;
+                source->ring.push(sample);
+            }
+        }
+        for (auto &source : engines) {
+            zes_engine_stats_t stats = {};
+            const ze_result_t result = (nullptr != pfnGetActivity)
+                ? pfnGetActivity(source->handle, &stats) : ZE_RESULT_ERROR_UNINITIALIZED;
+            source->lastResult.store(result, std::memory_order_relaxed);
+            if (ZE_RESULT_SUCCESS == result) {
+                sample_ring_t::sample_t sample;
+                sample.timeNs = monotonicNs();
+                sample.counter = stats.activeTime;
+                sample.timestamp = stats.timestamp;
+                source->ring.push(sample);
+            }
+        }
+    }
+
+    ze_result_t sysman_sampler_t::getPowerRates(uint64_t windowNs, uint32_t count, zel_sysman_sampler_rate_t *pRates) const
+    {
+        return getRates(power, windowNs, 1.0, count, pRates);
+    }
+
+    ze_result_t sysman_sampler_t::getEngineRates(uint64_t windowNs, uint32_t count, zel_sysman_sampler_rate_t *pRates) const
+    {
+        return getRates(engines, windowNs, 100.0, count, pRates);
+    }
+
+} // namespace ze_lib
@@ -0,0 +1,71 @@
+/*
+ *
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file sysman_sampler.h
+ *
+ */
+#pragma once
+#include "zes_api.h"
+#include "loader/ze_loader.h"
+#include "ze_util.h"
+#include "sample_ring.h"
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ze_lib
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    /// Backs the zelSysmanSampler* APIs: reads the energy counters of a set of
+    /// power domains and the activity counters of a set of engine groups at a
+    /// fixed period on its own thread, into one sample_ring_t per component.
+    /// Rates are derived from the rings without stopping the sampling.
+    class __zedlllocal sysman_sampler_t
+    {
+    public:
+        static constexpr uint32_t defaultPeriodUs = 1000;
+        static constexpr uint32_t defaultHistoryLength = 4096;
+
+        explicit sysman_sampler_t(const zel_sysman_sampler_desc_t &desc);
+        ~sysman_sampler_t();
+
+        sysman_sampler_t(const sysman_sampler_t &) = delete;
+        sysman_sampler_t &operator=(const sysman_sampler_t &) = delete;
+
+        ze_result_t start();
+        void stop();
+
+        ze_result_t getPowerRates(uint64_t windowNs, uint32_t count, zel_sysman_sampler_rate_t *pRates) const;
+        ze_result_t getEngineRates(uint64_t windowNs, uint32_t count, zel_sysman_sampler_rate_t *pRates) const;
+
+    private:
+        template <typename handle_t>
+        struct source_t
+        {
+            source_t(handle_t handle, size_t historyLength) : handle(handle), ring(historyLength) {}
+
+            handle_t handle;
+            sample_ring_t ring;
+            std::atomic<ze_result_t> lastResult{ZE_RESULT_SUCCESS};
+        };
+
+        void run();
+        void sample();
+
+        const std::chrono::microseconds period;
+        std::vector<std::unique_ptr<source_t<zes_pwr_handle_t>>> power;
+        std::vector<std::unique_ptr<source_t<zes_engine_handle_t>>> engines;
+
+        std::mutex stopMutex;
+        std::condition_variable stopCondition;
+        bool stopRequested = false;
+        std::thread thread;
+    };
+
+} // namespace ze_lib
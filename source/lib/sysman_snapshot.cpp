@@ -0,0 +1,368 @@
+/*
+ *
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file sysman_snapshot.cpp
+ *
+ */
+#include "sysman_snapshot.h"
+#include "ze_lib.h"
+
+#include <algorithm>
+#include <system_error>
+#include <thread>
+
+namespace ze_lib
+{
+    namespace
+    {
+        template <typename handle_t, typename pfn_enum_t>
+        ze_result_t enumerate(pfn_enum_t pfnEnum, zes_device_handle_t hDevice, std::vector<handle_t> &handles)
+        {
+            if (nullptr == pfnEnum) {
+                return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+            }
+            uint32_t count = 0;
+            ze_result_t result = pfnEnum(hDevice, &count, nullptr);
+            if (ZE_RESULT_SUCCESS != result || 0 == count) {
+                handles.clear();
+                return result;
+            }
+            handles.resize(count);
+            result = pfnEnum(hDevice, &count, handles.data());
+            handles.resize(ZE_RESULT_SUCCESS == result ? std::min<size_t>(count, handles.size()) : 0);
+            return result;
+        }
+
+        // Enumerates the components of one domain on the device's first
+        // snapshot that asks for it, then reads up to count of them into
+        // pSamples and sets count to the number of components.
+        template <typename domain_t, typename sample_t, typename pfn_enum_t, typename describe_t, typename read_t>
+        void readDomain(zes_device_handle_t hDevice, bool requested, domain_t &domain, pfn_enum_t pfnEnum,
+                        describe_t describe, read_t read, uint32_t &count, sample_t *pSamples,
+                        ze_result_t &deviceResult)
+        {
+            if (!requested) {
+                count = 0;
+                return;
+            }
+            if (!domain.enumerated) {
+                domain.result = enumerate(pfnEnum, hDevice, domain.handles);
+                domain.samples.assign(domain.handles.size(), sample_t{});
+                for (size_t i = 0; i < domain.handles.size(); ++i) {
+                    domain.samples[i].result = describe(domain.handles[i], domain.samples[i]);
+                }
+                // A failed enumeration is retried on the next snapshot.
+                domain.enumerated = (ZE_RESULT_SUCCESS == domain.result);
+            }
+            if (ZE_RESULT_SUCCESS != domain.result) {
+                count = 0;
+                if (ZE_RESULT_SUCCESS == deviceResult) {
+                    deviceResult = domain.result;
+                }
+                return;
+            }
+
+            const uint32_t available = static_cast<uint32_t>(domain.handles.size());
+            const uint32_t written = (nullptr != pSamples) ? std::min(count, available) : 0;
+            for (uint32_t i = 0; i < written; ++i) {
+                pSamples[i] = domain.samples[i];
+                if (ZE_RESULT_SUCCESS == pSamples[i].result) {
+                    pSamples[i].result = read(domain.handles[i], pSamples[i]);
+                }
+            }
+            count = available;
+        }
+    } // namespace
+
+    ///////////////////////////////////////////////////////////////////////////////
+    constexpr size_t worker_pool_t::maxWorkers;
+
+    worker_pool_t::~worker_pool_t()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        pending.notify_all();
+        for (auto &worker : workers) {
+            worker.join();
+        }
+    }
+
+    uint32_t worker_pool_t::claim(batch_t &batch)
+    {
+        const uint32_t i = batch.next++;
+        if (batch.next == batch.count) {
+            for (auto it = batches.begin(); it != batches.end(); ++it) {
+                if (*it == &batch) {
+                    batches.erase(it);
+                    break;
+                }
+            }
+        }
+        return i;
+    }
+
+    void worker_pool_t::call(batch_t &batch, std::unique_lock<std::mutex> &lock)
+    {
+        const uint32_t i = claim(batch);
+        lock.unlock();
+        (*batch.fn)(i);
+        lock.lock();
+        // The caller may return as soon as done reaches count; the batch
+        // is not touched after that.
+        if (++batch.done == batch.count) {
+            finished.notify_all();
+        }
+    }
+
+    void worker_pool_t::work()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            pending.wait(lock, [this]() { return stopping || !batches.empty(); });
+            if (batches.empty()) {
+                return;
+            }
+            call(*batches.front(), lock);
+        }
+    }
+
+    void worker_pool_t::run(uint32_t count, const std::function<void(uint32_t)> &fn)
+    {
+        batch_t batch = {&fn, count, 0, 0};
+        std::unique_lock<std::mutex> lock(mutex);
+        if (count > 1) {
+            batches.push_back(&batch);
+        }
+#if defined(_WIN32) && !defined(L0_STATIC_LOADER_BUILD)
+        std::vector<std::thread> threads;
+        const auto start = [this, &batch]() {
+            return std::thread([this, &batch]() {
+                std::unique_lock<std::mutex> lock(mutex);
+                while (batch.next < batch.count) {
+                    call(batch, lock);
+                }
+            });
+        };
+#else
+        std::vector<std::thread> &threads = workers;
+        const auto start = [this]() { return std::thread(&worker_pool_t::work, this); };
+#endif
+        // A worker that cannot be started leaves its share to the others and
+        // to the calling thread.
+        const size_t wanted = std::min<size_t>(count - 1, maxWorkers);
+        try
+        {
+            while (threads.size() < wanted) {
+                threads.push_back(start());
+            }
+        }
+        catch (std::exception &)
+        {
+        }
+        pending.notify_all();
+
+        while (batch.next < batch.count) {
+            call(batch, lock);
+        }
+        finished.wait(lock, [&batch]() { return batch.done == batch.count; });
+#if defined(_WIN32) && !defined(L0_STATIC_LOADER_BUILD)
+        lock.unlock();
+        for (auto &thread : threads) {
+            thread.join();
+        }
+#endif
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    std::shared_ptr<sysman_snapshot_t::device_t> sysman_snapshot_t::getDevice(zes_device_handle_t hDevice)
+    {
+        std::lock_guard<std::mutex> lock(devicesMutex);
+        auto &device = devices[hDevice];
+        if (!device) {
+            device = std::make_shared<device_t>();
+        }
+        return device;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void sysman_snapshot_t::invalidate(zes_device_handle_t hDevice)
+    {
+        std::lock_guard<std::mutex> lock(devicesMutex);
+        devices.erase(hDevice);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void sysman_snapshot_t::clear()
+    {
+        std::lock_guard<std::mutex> lock(devicesMutex);
+        devices.clear();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void sysman_snapshot_t::readDevice(zel_sysman_device_snapshot_t &snapshot)
+    {
+        snapshot.result = ZE_RESULT_SUCCESS;
+        if (nullptr == snapshot.hDevice) {
+            snapshot.result = ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            snapshot.powerCount = snapshot.frequencyCount = snapshot.temperatureCount = 0;
+            snapshot.engineCount = snapshot.memoryCount = 0;
+            return;
+        }
+        auto dditable = ze_lib::zesDdiTable.load(std::memory_order_acquire);
+        const auto hDevice = snapshot.hDevice;
+        const auto domains = snapshot.domains;
+
+        try
+        {
+            const std::shared_ptr<device_t> device = getDevice(hDevice);
+            std::lock_guard<std::mutex> lock(device->mutex);
+
+            auto pfnPowerGetProperties = dditable->Power.pfnGetProperties;
+            auto pfnPowerGetEnergyCounter = dditable->Power.pfnGetEnergyCounter;
+            readDomain(hDevice, 0 != (domains & ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_POWER), device->power,
+                dditable->Device.pfnEnumPowerDomains,
+                [&](zes_pwr_handle_t hPower, zel_sysman_power_sample_t &sample) {
+                    if (nullptr == pfnPowerGetProperties) {
+                        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+                    }
+                    zes_power_properties_t properties = {ZES_STRUCTURE_TYPE_POWER_PROPERTIES};
+                    ze_result_t result = pfnPowerGetProperties(hPower, &properties);
+                    sample.onSubdevice = properties.onSubdevice;
+                    sample.subdeviceId = properties.subdeviceId;
+                    return result;
+                },
+                [&](zes_pwr_handle_t hPower, zel_sysman_power_sample_t &sample) {
+                    if (nullptr == pfnPowerGetEnergyCounter) {
+                        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+                    }
+                    return pfnPowerGetEnergyCounter(hPower, &sample.energy);
+                },
+                snapshot.powerCount, snapshot.pPower, snapshot.result);
+
+            auto pfnFrequencyGetProperties = dditable->Frequency.pfnGetProperties;
+            auto pfnFrequencyGetState = dditable->Frequency.pfnGetState;
+            readDomain(hDevice, 0 != (domains & ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_FREQUENCY), device->frequency,
+                dditable->Device.pfnEnumFrequencyDomains,
+                [&](zes_freq_handle_t hFrequency, zel_sysman_frequency_sample_t &sample) {
+                    if (nullptr == pfnFrequencyGetProperties) {
+                        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+                    }
+                    zes_freq_properties_t properties = {ZES_STRUCTURE_TYPE_FREQ_PROPERTIES};
+                    ze_result_t result = pfnFrequencyGetProperties(hFrequency, &properties);
+                    sample.type = properties.type;
+                    sample.onSubdevice = properties.onSubdevice;
+                    sample.subdeviceId = properties.subdeviceId;
+                    return result;
+                },
+                [&](zes_freq_handle_t hFrequency, zel_sysman_frequency_sample_t &sample) {
+                    if (nullptr == pfnFrequencyGetState) {
+                        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+                    }
+                    sample.state = {ZES_STRUCTURE_TYPE_FREQ_STATE};
+                    return pfnFrequencyGetState(hFrequency, &sample.state);
+                },
+                snapshot.frequencyCount, snapshot.pFrequency, snapshot.result);
+
+            auto pfnTemperatureGetProperties = dditable->Temperature.pfnGetProperties;
+            auto pfnTemperatureGetState = dditable->Temperature.pfnGetState;
+            readDomain(hDevice, 0 != (domains & ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_TEMPERATURE), device->temperature,
+                dditable->Device.pfnEnumTemperatureSensors,
+                [&](zes_temp_handle_t hTemperature, zel_sysman_temperature_sample_t &sample) {
+                    if (nullptr == pfnTemperatureGetProperties) {
+                        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+                    }
+                    zes_temp_properties_t properties = {ZES_STRUCTURE_TYPE_TEMP_PROPERTIES};
+                    ze_result_t result = pfnTemperatureGetProperties(hTemperature, &properties);
+                    sample.type = properties.type;
+                    sample.onSubdevice = properties.onSubdevice;
+                    sample.subdeviceId = properties.subdeviceId;
+                    return result;
+                },
+                [&](zes_temp_handle_t hTemperature, zel_sysman_temperature_sample_t &sample) {
+                    if (nullptr == pfnTemperatureGetState) {
+                        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+                    }
+                    return pfnTemperatureGetState(hTemperature, &sample.temperature);
+                },
+                snapshot.temperatureCount, snapshot.pTemperature, snapshot.result);
+
+            auto pfnEngineGetProperties = dditable->Engine.pfnGetProperties;
+            auto pfnEngineGetActivity = dditable->Engine.pfnGetActivity;
+            readDomain(hDevice, 0 != (domains & ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_ENGINE), device->engine,
+                dditable->Device.pfnEnumEngineGroups,
+                [&](zes_engine_handle_t hEngine, zel_sysman_engine_sample_t &sample) {
+                    if (nullptr == pfnEngineGetProperties) {
+                        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+                    }
+                    zes_engine_properties_t properties = {ZES_STRUCTURE_TYPE_ENGINE_PROPERTIES};
+                    ze_result_t result = pfnEngineGetProperties(hEngine, &properties);
+                    sample.type = properties.type;
+                    sample.onSubdevice = properties.onSubdevice;
+                    sample.subdeviceId = properties.subdeviceId;
+                    return result;
+                },
+                [&](zes_engine_handle_t hEngine, zel_sysman_engine_sample_t &sample) {
+                    if (nullptr == pfnEngineGetActivity) {
+                        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+                    }
+                    return pfnEngineGetActivity(hEngine, &sample.stats);
+                },
+                snapshot.engineCount, snapshot.pEngine, snapshot.result);
+
+            auto pfnMemoryGetProperties = dditable->Memory.pfnGetProperties;
+            auto pfnMemoryGetState = dditable->Memory.pfnGetState;
+            readDomain(hDevice, 0 != (domains & ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_MEMORY), device->memory,
+                dditable->Device.pfnEnumMemoryModules,
+                [&](zes_mem_handle_t hMemory, zel_sysman_memory_sample_t &sample) {
+                    if (nullptr == pfnMemoryGetProperties) {
+                        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+                    }
+                    zes_mem_properties_t properties = {ZES_STRUCTURE_TYPE_MEM_PROPERTIES};
+                    ze_result_t result = pfnMemoryGetProperties(hMemory, &properties);
+                    sample.type = properties.type;
+                    sample.location = properties.location;
+                    sample.onSubdevice = properties.onSubdevice;
+                    sample.subdeviceId = properties.subdeviceId;
+                    return result;
+                },
+                [&](zes_mem_handle_t hMemory, zel_sysman_memory_sample_t &sample) {
+                    if (nullptr == pfnMemoryGetState) {
+                        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+                    }
+                    sample.state = {ZES_STRUCTURE_TYPE_MEM_STATE};
+                    return pfnMemoryGetState(hMemory, &sample.state);
+                },
+                snapshot.memoryCount, snapshot.pMemory, snapshot.result);
+        }
+        catch (std::bad_alloc &)
+        {
+            snapshot.result = ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    ze_result_t sysman_snapshot_t::getSnapshot(uint32_t count, zel_sysman_device_snapshot_t *pSnapshots)
+    {
+        if (0 == count) {
+            return ZE_RESULT_SUCCESS;
+        }
+        if (nullptr == pSnapshots) {
+            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        workers.run(count, [this, pSnapshots](uint32_t i) { readDevice(pSnapshots[i]); });
+
+        for (uint32_t i = 0; i < count; ++i) {
+            if (ZE_RESULT_SUCCESS != pSnapshots[i].result) {
+                return pSnapshots[i].result;
+            }
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+} // namespace ze_lib
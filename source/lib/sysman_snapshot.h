@@ -0,0 +1,116 @@
+/*
+ *
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file sysman_snapshot.h
+ *
+ */
+#pragma once
+#include "zes_api.h"
+#include "loader/ze_loader.h"
+#include "ze_util.h"
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace ze_lib
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    /// Threads that run the calls of a batch in parallel with its caller. They
+    /// are started as batches need them, up to maxWorkers, and then kept, so a
+    /// poller does not create threads on every call. In the Windows DLL build
+    /// the threads end with each batch instead: the DLL is unloaded under the
+    /// OS loader lock, where a thread that is still running cannot be joined.
+    class __zedlllocal worker_pool_t
+    {
+    public:
+        static constexpr size_t maxWorkers = 15;
+
+        worker_pool_t() = default;
+        ~worker_pool_t();
+
+        worker_pool_t(const worker_pool_t &) = delete;
+        worker_pool_t &operator=(const worker_pool_t &) = delete;
+
+        // Calls fn(i) for every i below count, on the calling thread and up
+        // to count - 1 workers, and returns once every call has returned.
+        void run(uint32_t count, const std::function<void(uint32_t)> &fn);
+
+    private:
+        struct batch_t
+        {
+            const std::function<void(uint32_t)> *fn;
+            uint32_t count;
+            uint32_t next;
+            uint32_t done;
+        };
+
+        // Takes the next call of the batch; the caller holds mutex.
+        uint32_t claim(batch_t &batch);
+        // Makes the next call of the batch, unlocking around it.
+        void call(batch_t &batch, std::unique_lock<std::mutex> &lock);
+        void work();
+
+        std::mutex mutex;
+        std::condition_variable pending;
+        std::condition_variable finished;
+        std::deque<batch_t *> batches;
+        std::vector<std::thread> workers;
+        bool stopping = false;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// Backs zelSysmanGetSnapshot: keeps the component handles of every device
+    /// and their static properties, enumerated once per device and domain, and
+    /// reads the counters of several devices in parallel. Like the loader's
+    /// component handle cache, the components of a device are enumerated again
+    /// after the device is reset or reported attached, detached or needing a
+    /// reset, and those of every device after zeInitDrivers.
+    class __zedlllocal sysman_snapshot_t
+    {
+    public:
+        ze_result_t getSnapshot(uint32_t count, zel_sysman_device_snapshot_t *pSnapshots);
+
+        // Drops what is known about the components of one device, or of all.
+        void invalidate(zes_device_handle_t hDevice);
+        void clear();
+
+    private:
+        template <typename handle_t, typename sample_t>
+        struct domain_t
+        {
+            bool enumerated = false;
+            ze_result_t result = ZE_RESULT_SUCCESS;
+            std::vector<handle_t> handles;
+            // The static part of every sample, filled from the properties.
+            std::vector<sample_t> samples;
+        };
+
+        struct device_t
+        {
+            std::mutex mutex;
+            domain_t<zes_pwr_handle_t, zel_sysman_power_sample_t> power;
+            domain_t<zes_freq_handle_t, zel_sysman_frequency_sample_t> frequency;
+            domain_t<zes_temp_handle_t, zel_sysman_temperature_sample_t> temperature;
+            domain_t<zes_engine_handle_t, zel_sysman_engine_sample_t> engine;
+            domain_t<zes_mem_handle_t, zel_sysman_memory_sample_t> memory;
+        };
+
+        // Reads in progress keep using the device they started with when it is
+        // invalidated under them.
+        std::shared_ptr<device_t> getDevice(zes_device_handle_t hDevice);
+        void readDevice(zel_sysman_device_snapshot_t &snapshot);
+
+        std::mutex devicesMutex;
+        std::unordered_map<zes_device_handle_t, std::shared_ptr<device_t>> devices;
+        worker_pool_t workers;
+    };
+
+} // namespace ze_lib
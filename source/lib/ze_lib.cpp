@@ -18,6 +18,10 @@ namespace ze_lib
 {
     ///////////////////////////////////////////////////////////////////////////////
     context_t *context = nullptr;
+    std::atomic<ze_dditable_t *> zeDdiTable = {nullptr};
+    std::atomic<zet_dditable_t *> zetDdiTable = {nullptr};
+    std::atomic<zes_dditable_t *> zesDdiTable = {nullptr};
+    std::atomic<zer_dditable_t *> zerDdiTable = {nullptr};
     #ifdef L0_STATIC_LOADER_BUILD
     void context_at_exit_destructor()
     {
@@ -77,6 +81,12 @@ namespace ze_lib
     ///////////////////////////////////////////////////////////////////////////////
     __zedlllocal context_t::~context_t()
     {
+        // Stop sampling before the tables the samplers read through go away.
+        stopSysmanSamplers();
+        for (auto sampler : sysmanSamplers) {
+            delete sampler;
+        }
+        sysmanSamplers.clear();
 #ifdef L0_STATIC_LOADER_BUILD
         if (loaderTeardownRegistrationEnabled && !loaderTeardownCallbackReceived) {
             loaderTeardownCallback(loaderTeardownCallbackIndex);
@@ -92,9 +102,24 @@ namespace ze_lib
         // Clear the teardown callbacks map once the callbacks have been executed.
         teardownCallbacks.clear();
 #endif
+        // The tables point into this context.
+        zeDdiTable.store(nullptr);
+        zetDdiTable.store(nullptr);
+        zesDdiTable.store(nullptr);
+        zerDdiTable.store(nullptr);
         ze_lib::destruction = true;
     };
 
+    ///////////////////////////////////////////////////////////////////////////////
+    __zedlllocal void context_t::stopSysmanSamplers()
+    {
+        std::lock_guard<std::mutex> lock(sysmanSamplersMutex);
+        sysmanSamplersStopped = true;
+        for (auto sampler : sysmanSamplers) {
+            sampler->stop();
+        }
+    }
+
     //////////////////////////////////////////////////////////////////////////
     __zedlllocal ze_result_t context_t::Init(ze_init_flags_t flags, bool sysmanOnly, ze_init_driver_type_desc_t* desc)
     {
@@ -220,10 +245,10 @@ namespace ze_lib
 
         if ( ZE_RESULT_SUCCESS == result )
         {
-            ze_lib::context->zeDdiTable.exchange(&ze_lib::context->initialzeDdiTable);
-            ze_lib::context->zetDdiTable.exchange(&ze_lib::context->initialzetDdiTable);
-            ze_lib::context->zesDdiTable.exchange(&ze_lib::context->initialzesDdiTable);
-            ze_lib::context->zerDdiTable.exchange(&ze_lib::context->initialzerDdiTable);
+            ze_lib::zeDdiTable.exchange(&ze_lib::context->initialzeDdiTable);
+            ze_lib::zetDdiTable.exchange(&ze_lib::context->initialzetDdiTable);
+            ze_lib::zesDdiTable.exchange(&ze_lib::context->initialzesDdiTable);
+            ze_lib::zerDdiTable.exchange(&ze_lib::context->initialzerDdiTable);
         }
 
         // Given zesInit, then zesDrivers needs to be used as the sysmanInstanceDrivers;
@@ -631,9 +656,9 @@ zelEnableTracingLayer()
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
     if (ze_lib::context->tracingLayerEnableCounter.fetch_add(1) == 0) {
-        ze_lib::context->zeDdiTable.exchange(ze_lib::context->pTracingZeDdiTable);
+        ze_lib::zeDdiTable.exchange(ze_lib::context->pTracingZeDdiTable);
         if (ze_lib::context->pTracingZerDdiTable != nullptr) {
-            ze_lib::context->zerDdiTable.exchange(ze_lib::context->pTracingZerDdiTable);
+            ze_lib::zerDdiTable.exchange(ze_lib::context->pTracingZerDdiTable);
         }
     }
     #endif
@@ -670,6 +695,159 @@ zelGetTracingLayerState
     return ZE_RESULT_SUCCESS;
 }
 
+ze_result_t ZE_APICALL
+zelGetApiLatencyStats(
+    uint32_t *pCount,                      // [in,out] Number of entries in pStats, or receives the number available
+    zel_api_latency_stats_t *pStats,       // [out][optional] Array of per-API statistics
+    ze_bool_t reset                        // [in] Clear the statistics after reading them
+)
+{
+    if (pCount == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    typedef ze_result_t (ZE_APICALL *zelGetApiLatencyStatsInternal_t)(uint32_t *pCount, zel_api_latency_stats_t *pStats, ze_bool_t reset);
+    #ifdef L0_STATIC_LOADER_BUILD
+    if(nullptr == ze_lib::context->loader)
+        return ZE_RESULT_ERROR_UNINITIALIZED;
+    auto getApiLatencyStats = reinterpret_cast<zelGetApiLatencyStatsInternal_t>(
+            GET_FUNCTION_PTR(ze_lib::context->loader, "zelGetApiLatencyStats") );
+    #else
+    // The statistics are kept by the tracing layer, which the loader loads
+    // whenever it is installed.
+    if (loader::context == nullptr || loader::context->tracingLayer == nullptr) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    auto getApiLatencyStats = reinterpret_cast<zelGetApiLatencyStatsInternal_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zelTracingLayerGetApiLatencyStats") );
+    #endif
+    if (getApiLatencyStats == nullptr) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    return getApiLatencyStats(pCount, pStats, reset);
+}
+
+ze_result_t ZE_APICALL
+zelSysmanGetSnapshot(
+    uint32_t count,                               // [in] Number of entries in pSnapshots
+    zel_sysman_device_snapshot_t *pSnapshots      // [in,out] Devices to read and the arrays to fill
+)
+{
+    if (!ze_lib::context || ze_lib::destruction || ze_lib::zesDdiTable.load(std::memory_order_acquire) == nullptr) {
+        return ZE_RESULT_ERROR_UNINITIALIZED;
+    }
+    return ze_lib::context->sysmanSnapshot.getSnapshot(count, pSnapshots);
+}
+
+ze_result_t ZE_APICALL
+zelSysmanSamplerCreate(
+    const zel_sysman_sampler_desc_t *desc,        // [in] Components to sample and the sampling period
+    zel_sysman_sampler_handle_t *phSampler        // [out] Receives the sampler
+)
+{
+    if (nullptr == desc || nullptr == phSampler ||
+        (0 != desc->powerCount && nullptr == desc->phPower) ||
+        (0 != desc->engineCount && nullptr == desc->phEngine)) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    if (0 == desc->powerCount && 0 == desc->engineCount) {
+        return ZE_RESULT_ERROR_INVALID_SIZE;
+    }
+#if defined(_WIN32) && !defined(L0_STATIC_LOADER_BUILD)
+    // Samplers left running at unload are joined in ~context_t, which the
+    // DLL runs from DllMain; joining a thread there deadlocks on the loader
+    // lock, so the sampler is only offered where that cannot happen.
+    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+#else
+    if (!ze_lib::context || ze_lib::destruction || ze_lib::zesDdiTable.load(std::memory_order_acquire) == nullptr) {
+        return ZE_RESULT_ERROR_UNINITIALIZED;
+    }
+    std::unique_ptr<ze_lib::sysman_sampler_t> sampler;
+    try {
+        sampler.reset(new ze_lib::sysman_sampler_t(*desc));
+    } catch (const std::bad_alloc &) {
+        return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    // At exit, drivers free their state from static destructors, which run
+    // before any library destructor; this static is constructed after the
+    // drivers were loaded, so it is destroyed, and stops the samplers, first.
+    static struct sampler_exit_guard_t {
+        ~sampler_exit_guard_t() {
+            if (ze_lib::context) {
+                ze_lib::context->stopSysmanSamplers();
+            }
+        }
+    } samplerExitGuard;
+    (void)samplerExitGuard;
+    // Started under the lock so that a sampler cannot start once
+    // stopSysmanSamplers() has run.
+    std::lock_guard<std::mutex> lock(ze_lib::context->sysmanSamplersMutex);
+    if (ze_lib::context->sysmanSamplersStopped) {
+        return ZE_RESULT_ERROR_UNINITIALIZED;
+    }
+    ze_result_t result = sampler->start();
+    if (ZE_RESULT_SUCCESS != result) {
+        return result;
+    }
+    try {
+        ze_lib::context->sysmanSamplers.insert(sampler.get());
+    } catch (const std::bad_alloc &) {
+        return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    *phSampler = reinterpret_cast<zel_sysman_sampler_handle_t>(sampler.release());
+    return ZE_RESULT_SUCCESS;
+#endif
+}
+
+ze_result_t ZE_APICALL
+zelSysmanSamplerDestroy(
+    zel_sysman_sampler_handle_t hSampler          // [in][release] Sampler to stop
+)
+{
+    if (nullptr == hSampler) {
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    if (!ze_lib::context || ze_lib::destruction) {
+        return ZE_RESULT_ERROR_UNINITIALIZED;
+    }
+    auto sampler = reinterpret_cast<ze_lib::sysman_sampler_t *>(hSampler);
+    {
+        std::lock_guard<std::mutex> lock(ze_lib::context->sysmanSamplersMutex);
+        if (0 == ze_lib::context->sysmanSamplers.erase(sampler)) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+    }
+    delete sampler;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL
+zelSysmanSamplerGetPowerRates(
+    zel_sysman_sampler_handle_t hSampler,         // [in] Sampler
+    uint64_t windowNs,                            // [in] Length of the window ending now, in nanoseconds
+    uint32_t count,                               // [in] Number of entries in pRates
+    zel_sysman_sampler_rate_t *pRates             // [out][range(0, count)] Power in watts of each domain
+)
+{
+    if (nullptr == hSampler) {
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    return reinterpret_cast<ze_lib::sysman_sampler_t *>(hSampler)->getPowerRates(windowNs, count, pRates);
+}
+
+ze_result_t ZE_APICALL
+zelSysmanSamplerGetEngineRates(
+    zel_sysman_sampler_handle_t hSampler,         // [in] Sampler
+    uint64_t windowNs,                            // [in] Length of the window ending now, in nanoseconds
+    uint32_t count,                               // [in] Number of entries in pRates
+    zel_sysman_sampler_rate_t *pRates             // [out][range(0, count)] Utilization in percent of each engine group
+)
+{
+    if (nullptr == hSampler) {
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    return reinterpret_cast<ze_lib::sysman_sampler_t *>(hSampler)->getEngineRates(windowNs, count, pRates);
+}
+
 ze_result_t ZE_APICALL
 zelDisableTracingLayer()
 {
@@ -685,9 +863,9 @@ zelDisableTracingLayer()
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
     if (ze_lib::context->tracingLayerEnableCounter.fetch_sub(1) <= 1) {
-        ze_lib::context->zeDdiTable.exchange(&ze_lib::context->initialzeDdiTable);
+        ze_lib::zeDdiTable.exchange(&ze_lib::context->initialzeDdiTable);
         if (ze_lib::context->pTracingZerDdiTable != nullptr) {
-            ze_lib::context->zerDdiTable.exchange(&ze_lib::context->initialzerDdiTable);
+            ze_lib::zerDdiTable.exchange(&ze_lib::context->initialzerDdiTable);
         }
     }
     #endif
@@ -21,8 +21,11 @@
 #include "../utils/ze_logger.h"
 #include "loader/ze_loader.h"
 #include "ze_util.h"
+#include "sysman_snapshot.h"
+#include "sysman_sampler.h"
 #include <vector>
 #include <map>
+#include <set>
 #include <mutex>
 #include <atomic>
 #include <typeinfo>
@@ -156,16 +159,9 @@ namespace ze_lib
         ze_result_t Init(ze_init_flags_t flags, bool sysmanOnly, ze_init_driver_type_desc_t* desc);
 
         ze_result_t zeDdiTableInit(ze_api_version_t version);
-        std::atomic<ze_dditable_t *>  zeDdiTable = {nullptr};
-
         ze_result_t zetDdiTableInit(ze_api_version_t version);
-        std::atomic<zet_dditable_t *> zetDdiTable = {nullptr};
-
         ze_result_t zesDdiTableInit(ze_api_version_t version);
-        std::atomic<zes_dditable_t *> zesDdiTable = {nullptr};
-
         ze_result_t zerDdiTableInit(ze_api_version_t version);
-        std::atomic<zer_dditable_t *> zerDdiTable = {nullptr};
 
         ze_result_t zelTracingDdiTableInit(ze_api_version_t version);
         zel_tracing_dditable_t  zelTracingDdiTable = {};
@@ -176,6 +172,15 @@ namespace ze_lib
         zes_dditable_t initialzesDdiTable;
         zer_dditable_t initialzerDdiTable;
         std::atomic_uint32_t tracingLayerEnableCounter{0};
+        sysman_snapshot_t sysmanSnapshot;
+        // Samplers not destroyed by the application are stopped at exit,
+        // before the drivers' static destructors run, and at the latest
+        // before the loader context they sample through is destroyed, which
+        // happens before this context is.
+        std::set<sysman_sampler_t *> sysmanSamplers;
+        std::mutex sysmanSamplersMutex;
+        bool sysmanSamplersStopped = false; // guarded by sysmanSamplersMutex
+        void stopSysmanSamplers();
 
         HMODULE tracing_lib = nullptr;
         bool isInitialized = false;
@@ -196,6 +201,16 @@ namespace ze_lib
 
     extern bool destruction;
     extern context_t *context;
+
+    // The dispatch table of each API group the entry points call through.
+    // They live at namespace scope rather than in context_t so an entry point
+    // reaches its function pointer with one load from a fixed address;
+    // zelEnableTracingLayer and zelDisableTracingLayer toggle tracing by
+    // swapping the table pointer.
+    extern __zedlllocal std::atomic<ze_dditable_t *> zeDdiTable;
+    extern __zedlllocal std::atomic<zet_dditable_t *> zetDdiTable;
+    extern __zedlllocal std::atomic<zes_dditable_t *> zesDdiTable;
+    extern __zedlllocal std::atomic<zer_dditable_t *> zerDdiTable;
     #ifdef L0_STATIC_LOADER_BUILD
     extern bool delayContextDestruction;
     extern bool loaderTeardownCallbackReceived;
@@ -70,7 +70,7 @@ zeInit(
             return ZE_RESULT_ERROR_UNINITIALIZED;
         }
 
-        auto pfnInit = ze_lib::context->zeDdiTable.load()->Global.pfnInit;
+        auto pfnInit = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Global.pfnInit;
         if( nullptr == pfnInit ) {
             if(!ze_lib::context->isInitialized)
                 return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -79,6 +79,11 @@ zeInit(
         }
 
         result = pfnInit( flags );
+        if (result == ZE_RESULT_SUCCESS) {
+            // Like the loader's component handle caches, sysman snapshots
+            // enumerate every device's components again.
+            ze_lib::context->sysmanSnapshot.clear();
+        }
         return result;
     });
 
@@ -142,11 +147,11 @@ zeDriverGet(
     if(ze_lib::destruction) {
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
-    if (!ze_lib::context || ze_lib::context->zeDdiTable == nullptr) {
+    if (ze_lib::zeDdiTable.load(std::memory_order_acquire) == nullptr) {
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDriverGet_t pfnGet = [&result] {
-        auto pfnGet = ze_lib::context->zeDdiTable.load()->Driver.pfnGet;
+        auto pfnGet = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Driver.pfnGet;
         if( nullptr == pfnGet ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -161,11 +166,11 @@ zeDriverGet(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (ze_lib::context->zeDdiTable == nullptr) {
+    if (ze_lib::zeDdiTable.load(std::memory_order_acquire) == nullptr) {
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGet = ze_lib::context->zeDdiTable.load()->Driver.pfnGet;
+    auto pfnGet = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Driver.pfnGet;
     if( nullptr == pfnGet ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -267,11 +272,11 @@ zeInitDrivers(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (ze_lib::context->zeDdiTable.load() == nullptr) {
+    if (ze_lib::zeDdiTable.load(std::memory_order_acquire) == nullptr) {
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnInitDrivers = ze_lib::context->zeDdiTable.load()->Global.pfnInitDrivers;
+    auto pfnInitDrivers = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Global.pfnInitDrivers;
     if( nullptr == pfnInitDrivers ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -285,6 +290,9 @@ zeInitDrivers(
         if (phDrivers) {
             ze_lib::context->zeInuse = true;
         }
+        // Like the loader's component handle caches, sysman snapshots
+        // enumerate every device's components again.
+        ze_lib::context->sysmanSnapshot.clear();
     }
 
     return result;
@@ -330,7 +338,7 @@ zeDriverGetApiVersion(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDriverGetApiVersion_t pfnGetApiVersion = [&result] {
-        auto pfnGetApiVersion = ze_lib::context->zeDdiTable.load()->Driver.pfnGetApiVersion;
+        auto pfnGetApiVersion = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Driver.pfnGetApiVersion;
         if( nullptr == pfnGetApiVersion ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -345,7 +353,7 @@ zeDriverGetApiVersion(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetApiVersion = ze_lib::context->zeDdiTable.load()->Driver.pfnGetApiVersion;
+    auto pfnGetApiVersion = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Driver.pfnGetApiVersion;
     if( nullptr == pfnGetApiVersion ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -398,7 +406,7 @@ zeDriverGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDriverGetProperties_t pfnGetProperties = [&result] {
-        auto pfnGetProperties = ze_lib::context->zeDdiTable.load()->Driver.pfnGetProperties;
+        auto pfnGetProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Driver.pfnGetProperties;
         if( nullptr == pfnGetProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -413,7 +421,7 @@ zeDriverGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zeDdiTable.load()->Driver.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Driver.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -462,7 +470,7 @@ zeDriverGetIpcProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDriverGetIpcProperties_t pfnGetIpcProperties = [&result] {
-        auto pfnGetIpcProperties = ze_lib::context->zeDdiTable.load()->Driver.pfnGetIpcProperties;
+        auto pfnGetIpcProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Driver.pfnGetIpcProperties;
         if( nullptr == pfnGetIpcProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -477,7 +485,7 @@ zeDriverGetIpcProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetIpcProperties = ze_lib::context->zeDdiTable.load()->Driver.pfnGetIpcProperties;
+    auto pfnGetIpcProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Driver.pfnGetIpcProperties;
     if( nullptr == pfnGetIpcProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -539,7 +547,7 @@ zeDriverGetExtensionProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDriverGetExtensionProperties_t pfnGetExtensionProperties = [&result] {
-        auto pfnGetExtensionProperties = ze_lib::context->zeDdiTable.load()->Driver.pfnGetExtensionProperties;
+        auto pfnGetExtensionProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Driver.pfnGetExtensionProperties;
         if( nullptr == pfnGetExtensionProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -554,7 +562,7 @@ zeDriverGetExtensionProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetExtensionProperties = ze_lib::context->zeDdiTable.load()->Driver.pfnGetExtensionProperties;
+    auto pfnGetExtensionProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Driver.pfnGetExtensionProperties;
     if( nullptr == pfnGetExtensionProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -606,7 +614,7 @@ zeDriverGetExtensionFunctionAddress(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDriverGetExtensionFunctionAddress_t pfnGetExtensionFunctionAddress = [&result] {
-        auto pfnGetExtensionFunctionAddress = ze_lib::context->zeDdiTable.load()->Driver.pfnGetExtensionFunctionAddress;
+        auto pfnGetExtensionFunctionAddress = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Driver.pfnGetExtensionFunctionAddress;
         if( nullptr == pfnGetExtensionFunctionAddress ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -621,7 +629,7 @@ zeDriverGetExtensionFunctionAddress(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetExtensionFunctionAddress = ze_lib::context->zeDdiTable.load()->Driver.pfnGetExtensionFunctionAddress;
+    auto pfnGetExtensionFunctionAddress = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Driver.pfnGetExtensionFunctionAddress;
     if( nullptr == pfnGetExtensionFunctionAddress ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -677,7 +685,7 @@ zeDriverGetLastErrorDescription(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDriverGetLastErrorDescription_t pfnGetLastErrorDescription = [&result] {
-        auto pfnGetLastErrorDescription = ze_lib::context->zeDdiTable.load()->Driver.pfnGetLastErrorDescription;
+        auto pfnGetLastErrorDescription = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Driver.pfnGetLastErrorDescription;
         if( nullptr == pfnGetLastErrorDescription ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -692,7 +700,7 @@ zeDriverGetLastErrorDescription(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetLastErrorDescription = ze_lib::context->zeDdiTable.load()->Driver.pfnGetLastErrorDescription;
+    auto pfnGetLastErrorDescription = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Driver.pfnGetLastErrorDescription;
     if( nullptr == pfnGetLastErrorDescription ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -730,7 +738,7 @@ zeDriverGetDefaultContext(
         return nullptr;
     }
     static const ze_pfnDriverGetDefaultContext_t pfnGetDefaultContext = [] {
-        auto pfnGetDefaultContext = ze_lib::context->zeDdiTable.load()->Driver.pfnGetDefaultContext;
+        auto pfnGetDefaultContext = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Driver.pfnGetDefaultContext;
         return pfnGetDefaultContext;
     }();
     if (nullptr == pfnGetDefaultContext) {
@@ -742,7 +750,7 @@ zeDriverGetDefaultContext(
         return nullptr;
     }
 
-    auto pfnGetDefaultContext = ze_lib::context->zeDdiTable.load()->Driver.pfnGetDefaultContext;
+    auto pfnGetDefaultContext = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Driver.pfnGetDefaultContext;
     if( nullptr == pfnGetDefaultContext ) {
         return nullptr;
     }
@@ -800,7 +808,7 @@ zeDeviceGet(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDeviceGet_t pfnGet = [&result] {
-        auto pfnGet = ze_lib::context->zeDdiTable.load()->Device.pfnGet;
+        auto pfnGet = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGet;
         if( nullptr == pfnGet ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -815,7 +823,7 @@ zeDeviceGet(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGet = ze_lib::context->zeDdiTable.load()->Device.pfnGet;
+    auto pfnGet = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGet;
     if( nullptr == pfnGet ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -872,7 +880,7 @@ zeDeviceGetRootDevice(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDeviceGetRootDevice_t pfnGetRootDevice = [&result] {
-        auto pfnGetRootDevice = ze_lib::context->zeDdiTable.load()->Device.pfnGetRootDevice;
+        auto pfnGetRootDevice = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetRootDevice;
         if( nullptr == pfnGetRootDevice ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -887,7 +895,7 @@ zeDeviceGetRootDevice(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetRootDevice = ze_lib::context->zeDdiTable.load()->Device.pfnGetRootDevice;
+    auto pfnGetRootDevice = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetRootDevice;
     if( nullptr == pfnGetRootDevice ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -953,7 +961,7 @@ zeDeviceGetSubDevices(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDeviceGetSubDevices_t pfnGetSubDevices = [&result] {
-        auto pfnGetSubDevices = ze_lib::context->zeDdiTable.load()->Device.pfnGetSubDevices;
+        auto pfnGetSubDevices = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetSubDevices;
         if( nullptr == pfnGetSubDevices ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -968,7 +976,7 @@ zeDeviceGetSubDevices(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetSubDevices = ze_lib::context->zeDdiTable.load()->Device.pfnGetSubDevices;
+    auto pfnGetSubDevices = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetSubDevices;
     if( nullptr == pfnGetSubDevices ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1021,7 +1029,7 @@ zeDeviceGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDeviceGetProperties_t pfnGetProperties = [&result] {
-        auto pfnGetProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetProperties;
+        auto pfnGetProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetProperties;
         if( nullptr == pfnGetProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1036,7 +1044,7 @@ zeDeviceGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1089,7 +1097,7 @@ zeDeviceGetComputeProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDeviceGetComputeProperties_t pfnGetComputeProperties = [&result] {
-        auto pfnGetComputeProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetComputeProperties;
+        auto pfnGetComputeProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetComputeProperties;
         if( nullptr == pfnGetComputeProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1104,7 +1112,7 @@ zeDeviceGetComputeProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetComputeProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetComputeProperties;
+    auto pfnGetComputeProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetComputeProperties;
     if( nullptr == pfnGetComputeProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1153,7 +1161,7 @@ zeDeviceGetModuleProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDeviceGetModuleProperties_t pfnGetModuleProperties = [&result] {
-        auto pfnGetModuleProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetModuleProperties;
+        auto pfnGetModuleProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetModuleProperties;
         if( nullptr == pfnGetModuleProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1168,7 +1176,7 @@ zeDeviceGetModuleProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetModuleProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetModuleProperties;
+    auto pfnGetModuleProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetModuleProperties;
     if( nullptr == pfnGetModuleProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1241,7 +1249,7 @@ zeDeviceGetCommandQueueGroupProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDeviceGetCommandQueueGroupProperties_t pfnGetCommandQueueGroupProperties = [&result] {
-        auto pfnGetCommandQueueGroupProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetCommandQueueGroupProperties;
+        auto pfnGetCommandQueueGroupProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetCommandQueueGroupProperties;
         if( nullptr == pfnGetCommandQueueGroupProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1256,7 +1264,7 @@ zeDeviceGetCommandQueueGroupProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetCommandQueueGroupProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetCommandQueueGroupProperties;
+    auto pfnGetCommandQueueGroupProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetCommandQueueGroupProperties;
     if( nullptr == pfnGetCommandQueueGroupProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1324,7 +1332,7 @@ zeDeviceGetMemoryProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDeviceGetMemoryProperties_t pfnGetMemoryProperties = [&result] {
-        auto pfnGetMemoryProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetMemoryProperties;
+        auto pfnGetMemoryProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetMemoryProperties;
         if( nullptr == pfnGetMemoryProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1339,7 +1347,7 @@ zeDeviceGetMemoryProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetMemoryProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetMemoryProperties;
+    auto pfnGetMemoryProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetMemoryProperties;
     if( nullptr == pfnGetMemoryProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1392,7 +1400,7 @@ zeDeviceGetMemoryAccessProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDeviceGetMemoryAccessProperties_t pfnGetMemoryAccessProperties = [&result] {
-        auto pfnGetMemoryAccessProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetMemoryAccessProperties;
+        auto pfnGetMemoryAccessProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetMemoryAccessProperties;
         if( nullptr == pfnGetMemoryAccessProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1407,7 +1415,7 @@ zeDeviceGetMemoryAccessProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetMemoryAccessProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetMemoryAccessProperties;
+    auto pfnGetMemoryAccessProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetMemoryAccessProperties;
     if( nullptr == pfnGetMemoryAccessProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1468,7 +1476,7 @@ zeDeviceGetCacheProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDeviceGetCacheProperties_t pfnGetCacheProperties = [&result] {
-        auto pfnGetCacheProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetCacheProperties;
+        auto pfnGetCacheProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetCacheProperties;
         if( nullptr == pfnGetCacheProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1483,7 +1491,7 @@ zeDeviceGetCacheProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetCacheProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetCacheProperties;
+    auto pfnGetCacheProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetCacheProperties;
     if( nullptr == pfnGetCacheProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1533,7 +1541,7 @@ zeDeviceGetImageProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDeviceGetImageProperties_t pfnGetImageProperties = [&result] {
-        auto pfnGetImageProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetImageProperties;
+        auto pfnGetImageProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetImageProperties;
         if( nullptr == pfnGetImageProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1548,7 +1556,7 @@ zeDeviceGetImageProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetImageProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetImageProperties;
+    auto pfnGetImageProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetImageProperties;
     if( nullptr == pfnGetImageProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1597,7 +1605,7 @@ zeDeviceGetExternalMemoryProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDeviceGetExternalMemoryProperties_t pfnGetExternalMemoryProperties = [&result] {
-        auto pfnGetExternalMemoryProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetExternalMemoryProperties;
+        auto pfnGetExternalMemoryProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetExternalMemoryProperties;
         if( nullptr == pfnGetExternalMemoryProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1612,7 +1620,7 @@ zeDeviceGetExternalMemoryProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetExternalMemoryProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetExternalMemoryProperties;
+    auto pfnGetExternalMemoryProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetExternalMemoryProperties;
     if( nullptr == pfnGetExternalMemoryProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1664,7 +1672,7 @@ zeDeviceGetP2PProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDeviceGetP2PProperties_t pfnGetP2PProperties = [&result] {
-        auto pfnGetP2PProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetP2PProperties;
+        auto pfnGetP2PProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetP2PProperties;
         if( nullptr == pfnGetP2PProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1679,7 +1687,7 @@ zeDeviceGetP2PProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetP2PProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetP2PProperties;
+    auto pfnGetP2PProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetP2PProperties;
     if( nullptr == pfnGetP2PProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1744,7 +1752,7 @@ zeDeviceCanAccessPeer(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDeviceCanAccessPeer_t pfnCanAccessPeer = [&result] {
-        auto pfnCanAccessPeer = ze_lib::context->zeDdiTable.load()->Device.pfnCanAccessPeer;
+        auto pfnCanAccessPeer = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnCanAccessPeer;
         if( nullptr == pfnCanAccessPeer ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1759,7 +1767,7 @@ zeDeviceCanAccessPeer(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCanAccessPeer = ze_lib::context->zeDdiTable.load()->Device.pfnCanAccessPeer;
+    auto pfnCanAccessPeer = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnCanAccessPeer;
     if( nullptr == pfnCanAccessPeer ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1810,7 +1818,7 @@ zeDeviceGetStatus(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDeviceGetStatus_t pfnGetStatus = [&result] {
-        auto pfnGetStatus = ze_lib::context->zeDdiTable.load()->Device.pfnGetStatus;
+        auto pfnGetStatus = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetStatus;
         if( nullptr == pfnGetStatus ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1825,7 +1833,7 @@ zeDeviceGetStatus(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetStatus = ze_lib::context->zeDdiTable.load()->Device.pfnGetStatus;
+    auto pfnGetStatus = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetStatus;
     if( nullptr == pfnGetStatus ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1890,7 +1898,7 @@ zeDeviceGetGlobalTimestamps(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDeviceGetGlobalTimestamps_t pfnGetGlobalTimestamps = [&result] {
-        auto pfnGetGlobalTimestamps = ze_lib::context->zeDdiTable.load()->Device.pfnGetGlobalTimestamps;
+        auto pfnGetGlobalTimestamps = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetGlobalTimestamps;
         if( nullptr == pfnGetGlobalTimestamps ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1905,7 +1913,7 @@ zeDeviceGetGlobalTimestamps(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetGlobalTimestamps = ze_lib::context->zeDdiTable.load()->Device.pfnGetGlobalTimestamps;
+    auto pfnGetGlobalTimestamps = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetGlobalTimestamps;
     if( nullptr == pfnGetGlobalTimestamps ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1957,7 +1965,7 @@ zeDeviceSynchronize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDeviceSynchronize_t pfnSynchronize = [&result] {
-        auto pfnSynchronize = ze_lib::context->zeDdiTable.load()->Device.pfnSynchronize;
+        auto pfnSynchronize = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnSynchronize;
         if( nullptr == pfnSynchronize ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1972,7 +1980,7 @@ zeDeviceSynchronize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSynchronize = ze_lib::context->zeDdiTable.load()->Device.pfnSynchronize;
+    auto pfnSynchronize = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnSynchronize;
     if( nullptr == pfnSynchronize ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2025,7 +2033,7 @@ zeDeviceGetAggregatedCopyOffloadIncrementValue(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDeviceGetAggregatedCopyOffloadIncrementValue_t pfnGetAggregatedCopyOffloadIncrementValue = [&result] {
-        auto pfnGetAggregatedCopyOffloadIncrementValue = ze_lib::context->zeDdiTable.load()->Device.pfnGetAggregatedCopyOffloadIncrementValue;
+        auto pfnGetAggregatedCopyOffloadIncrementValue = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetAggregatedCopyOffloadIncrementValue;
         if( nullptr == pfnGetAggregatedCopyOffloadIncrementValue ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2040,7 +2048,7 @@ zeDeviceGetAggregatedCopyOffloadIncrementValue(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetAggregatedCopyOffloadIncrementValue = ze_lib::context->zeDdiTable.load()->Device.pfnGetAggregatedCopyOffloadIncrementValue;
+    auto pfnGetAggregatedCopyOffloadIncrementValue = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetAggregatedCopyOffloadIncrementValue;
     if( nullptr == pfnGetAggregatedCopyOffloadIncrementValue ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2107,7 +2115,7 @@ zeDeviceGetCounterBasedEventMaxValue(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDeviceGetCounterBasedEventMaxValue_t pfnGetCounterBasedEventMaxValue = [&result] {
-        auto pfnGetCounterBasedEventMaxValue = ze_lib::context->zeDdiTable.load()->Device.pfnGetCounterBasedEventMaxValue;
+        auto pfnGetCounterBasedEventMaxValue = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetCounterBasedEventMaxValue;
         if( nullptr == pfnGetCounterBasedEventMaxValue ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2122,7 +2130,7 @@ zeDeviceGetCounterBasedEventMaxValue(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetCounterBasedEventMaxValue = ze_lib::context->zeDdiTable.load()->Device.pfnGetCounterBasedEventMaxValue;
+    auto pfnGetCounterBasedEventMaxValue = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetCounterBasedEventMaxValue;
     if( nullptr == pfnGetCounterBasedEventMaxValue ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2190,7 +2198,7 @@ zeDeviceGetRuntimeRequirements(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDeviceGetRuntimeRequirements_t pfnGetRuntimeRequirements = [&result] {
-        auto pfnGetRuntimeRequirements = ze_lib::context->zeDdiTable.load()->Device.pfnGetRuntimeRequirements;
+        auto pfnGetRuntimeRequirements = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetRuntimeRequirements;
         if( nullptr == pfnGetRuntimeRequirements ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2205,7 +2213,7 @@ zeDeviceGetRuntimeRequirements(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetRuntimeRequirements = ze_lib::context->zeDdiTable.load()->Device.pfnGetRuntimeRequirements;
+    auto pfnGetRuntimeRequirements = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetRuntimeRequirements;
     if( nullptr == pfnGetRuntimeRequirements ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2257,7 +2265,7 @@ zeDeviceGetRuntimeRequirementsKey(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDeviceGetRuntimeRequirementsKey_t pfnGetRuntimeRequirementsKey = [&result] {
-        auto pfnGetRuntimeRequirementsKey = ze_lib::context->zeDdiTable.load()->Device.pfnGetRuntimeRequirementsKey;
+        auto pfnGetRuntimeRequirementsKey = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetRuntimeRequirementsKey;
         if( nullptr == pfnGetRuntimeRequirementsKey ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2272,7 +2280,7 @@ zeDeviceGetRuntimeRequirementsKey(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetRuntimeRequirementsKey = ze_lib::context->zeDdiTable.load()->Device.pfnGetRuntimeRequirementsKey;
+    auto pfnGetRuntimeRequirementsKey = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetRuntimeRequirementsKey;
     if( nullptr == pfnGetRuntimeRequirementsKey ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2329,7 +2337,7 @@ zeDeviceValidateRuntimeRequirements(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDeviceValidateRuntimeRequirements_t pfnValidateRuntimeRequirements = [&result] {
-        auto pfnValidateRuntimeRequirements = ze_lib::context->zeDdiTable.load()->Device.pfnValidateRuntimeRequirements;
+        auto pfnValidateRuntimeRequirements = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnValidateRuntimeRequirements;
         if( nullptr == pfnValidateRuntimeRequirements ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2344,7 +2352,7 @@ zeDeviceValidateRuntimeRequirements(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnValidateRuntimeRequirements = ze_lib::context->zeDdiTable.load()->Device.pfnValidateRuntimeRequirements;
+    auto pfnValidateRuntimeRequirements = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnValidateRuntimeRequirements;
     if( nullptr == pfnValidateRuntimeRequirements ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2400,7 +2408,7 @@ zeContextCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnContextCreate_t pfnCreate = [&result] {
-        auto pfnCreate = ze_lib::context->zeDdiTable.load()->Context.pfnCreate;
+        auto pfnCreate = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Context.pfnCreate;
         if( nullptr == pfnCreate ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2415,7 +2423,7 @@ zeContextCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.load()->Context.pfnCreate;
+    auto pfnCreate = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Context.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2483,7 +2491,7 @@ zeContextCreateEx(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnContextCreateEx_t pfnCreateEx = [&result] {
-        auto pfnCreateEx = ze_lib::context->zeDdiTable.load()->Context.pfnCreateEx;
+        auto pfnCreateEx = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Context.pfnCreateEx;
         if( nullptr == pfnCreateEx ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2498,7 +2506,7 @@ zeContextCreateEx(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreateEx = ze_lib::context->zeDdiTable.load()->Context.pfnCreateEx;
+    auto pfnCreateEx = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Context.pfnCreateEx;
     if( nullptr == pfnCreateEx ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2550,7 +2558,7 @@ zeContextDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnContextDestroy_t pfnDestroy = [&result] {
-        auto pfnDestroy = ze_lib::context->zeDdiTable.load()->Context.pfnDestroy;
+        auto pfnDestroy = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Context.pfnDestroy;
         if( nullptr == pfnDestroy ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2565,7 +2573,7 @@ zeContextDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.load()->Context.pfnDestroy;
+    auto pfnDestroy = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Context.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2614,7 +2622,7 @@ zeContextGetStatus(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnContextGetStatus_t pfnGetStatus = [&result] {
-        auto pfnGetStatus = ze_lib::context->zeDdiTable.load()->Context.pfnGetStatus;
+        auto pfnGetStatus = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Context.pfnGetStatus;
         if( nullptr == pfnGetStatus ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2629,7 +2637,7 @@ zeContextGetStatus(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetStatus = ze_lib::context->zeDdiTable.load()->Context.pfnGetStatus;
+    auto pfnGetStatus = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Context.pfnGetStatus;
     if( nullptr == pfnGetStatus ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2695,7 +2703,7 @@ zeCommandQueueCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandQueueCreate_t pfnCreate = [&result] {
-        auto pfnCreate = ze_lib::context->zeDdiTable.load()->CommandQueue.pfnCreate;
+        auto pfnCreate = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandQueue.pfnCreate;
         if( nullptr == pfnCreate ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2710,7 +2718,7 @@ zeCommandQueueCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.load()->CommandQueue.pfnCreate;
+    auto pfnCreate = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandQueue.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2768,7 +2776,7 @@ zeCommandQueueDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandQueueDestroy_t pfnDestroy = [&result] {
-        auto pfnDestroy = ze_lib::context->zeDdiTable.load()->CommandQueue.pfnDestroy;
+        auto pfnDestroy = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandQueue.pfnDestroy;
         if( nullptr == pfnDestroy ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2783,7 +2791,7 @@ zeCommandQueueDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.load()->CommandQueue.pfnDestroy;
+    auto pfnDestroy = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandQueue.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2858,7 +2866,7 @@ zeCommandQueueExecuteCommandLists(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandQueueExecuteCommandLists_t pfnExecuteCommandLists = [&result] {
-        auto pfnExecuteCommandLists = ze_lib::context->zeDdiTable.load()->CommandQueue.pfnExecuteCommandLists;
+        auto pfnExecuteCommandLists = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandQueue.pfnExecuteCommandLists;
         if( nullptr == pfnExecuteCommandLists ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2873,7 +2881,7 @@ zeCommandQueueExecuteCommandLists(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnExecuteCommandLists = ze_lib::context->zeDdiTable.load()->CommandQueue.pfnExecuteCommandLists;
+    auto pfnExecuteCommandLists = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandQueue.pfnExecuteCommandLists;
     if( nullptr == pfnExecuteCommandLists ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2928,7 +2936,7 @@ zeCommandQueueSynchronize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandQueueSynchronize_t pfnSynchronize = [&result] {
-        auto pfnSynchronize = ze_lib::context->zeDdiTable.load()->CommandQueue.pfnSynchronize;
+        auto pfnSynchronize = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandQueue.pfnSynchronize;
         if( nullptr == pfnSynchronize ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2943,7 +2951,7 @@ zeCommandQueueSynchronize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSynchronize = ze_lib::context->zeDdiTable.load()->CommandQueue.pfnSynchronize;
+    auto pfnSynchronize = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandQueue.pfnSynchronize;
     if( nullptr == pfnSynchronize ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2992,7 +3000,7 @@ zeCommandQueueGetOrdinal(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandQueueGetOrdinal_t pfnGetOrdinal = [&result] {
-        auto pfnGetOrdinal = ze_lib::context->zeDdiTable.load()->CommandQueue.pfnGetOrdinal;
+        auto pfnGetOrdinal = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandQueue.pfnGetOrdinal;
         if( nullptr == pfnGetOrdinal ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3007,7 +3015,7 @@ zeCommandQueueGetOrdinal(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetOrdinal = ze_lib::context->zeDdiTable.load()->CommandQueue.pfnGetOrdinal;
+    auto pfnGetOrdinal = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandQueue.pfnGetOrdinal;
     if( nullptr == pfnGetOrdinal ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3056,7 +3064,7 @@ zeCommandQueueGetIndex(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandQueueGetIndex_t pfnGetIndex = [&result] {
-        auto pfnGetIndex = ze_lib::context->zeDdiTable.load()->CommandQueue.pfnGetIndex;
+        auto pfnGetIndex = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandQueue.pfnGetIndex;
         if( nullptr == pfnGetIndex ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3071,7 +3079,7 @@ zeCommandQueueGetIndex(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetIndex = ze_lib::context->zeDdiTable.load()->CommandQueue.pfnGetIndex;
+    auto pfnGetIndex = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandQueue.pfnGetIndex;
     if( nullptr == pfnGetIndex ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3120,7 +3128,7 @@ zeCommandQueueGetFlags(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandQueueGetFlags_t pfnGetFlags = [&result] {
-        auto pfnGetFlags = ze_lib::context->zeDdiTable.load()->CommandQueue.pfnGetFlags;
+        auto pfnGetFlags = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandQueue.pfnGetFlags;
         if( nullptr == pfnGetFlags ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3135,7 +3143,7 @@ zeCommandQueueGetFlags(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetFlags = ze_lib::context->zeDdiTable.load()->CommandQueue.pfnGetFlags;
+    auto pfnGetFlags = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandQueue.pfnGetFlags;
     if( nullptr == pfnGetFlags ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3184,7 +3192,7 @@ zeCommandQueueGetMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandQueueGetMode_t pfnGetMode = [&result] {
-        auto pfnGetMode = ze_lib::context->zeDdiTable.load()->CommandQueue.pfnGetMode;
+        auto pfnGetMode = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandQueue.pfnGetMode;
         if( nullptr == pfnGetMode ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3199,7 +3207,7 @@ zeCommandQueueGetMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetMode = ze_lib::context->zeDdiTable.load()->CommandQueue.pfnGetMode;
+    auto pfnGetMode = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandQueue.pfnGetMode;
     if( nullptr == pfnGetMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3248,7 +3256,7 @@ zeCommandQueueGetPriority(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandQueueGetPriority_t pfnGetPriority = [&result] {
-        auto pfnGetPriority = ze_lib::context->zeDdiTable.load()->CommandQueue.pfnGetPriority;
+        auto pfnGetPriority = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandQueue.pfnGetPriority;
         if( nullptr == pfnGetPriority ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3263,7 +3271,7 @@ zeCommandQueueGetPriority(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetPriority = ze_lib::context->zeDdiTable.load()->CommandQueue.pfnGetPriority;
+    auto pfnGetPriority = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandQueue.pfnGetPriority;
     if( nullptr == pfnGetPriority ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3324,7 +3332,7 @@ zeCommandListCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListCreate_t pfnCreate = [&result] {
-        auto pfnCreate = ze_lib::context->zeDdiTable.load()->CommandList.pfnCreate;
+        auto pfnCreate = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnCreate;
         if( nullptr == pfnCreate ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3339,7 +3347,7 @@ zeCommandListCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.load()->CommandList.pfnCreate;
+    auto pfnCreate = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3408,7 +3416,7 @@ zeCommandListCreateImmediate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListCreateImmediate_t pfnCreateImmediate = [&result] {
-        auto pfnCreateImmediate = ze_lib::context->zeDdiTable.load()->CommandList.pfnCreateImmediate;
+        auto pfnCreateImmediate = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnCreateImmediate;
         if( nullptr == pfnCreateImmediate ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3423,7 +3431,7 @@ zeCommandListCreateImmediate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreateImmediate = ze_lib::context->zeDdiTable.load()->CommandList.pfnCreateImmediate;
+    auto pfnCreateImmediate = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnCreateImmediate;
     if( nullptr == pfnCreateImmediate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3475,7 +3483,7 @@ zeCommandListDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListDestroy_t pfnDestroy = [&result] {
-        auto pfnDestroy = ze_lib::context->zeDdiTable.load()->CommandList.pfnDestroy;
+        auto pfnDestroy = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnDestroy;
         if( nullptr == pfnDestroy ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3490,7 +3498,7 @@ zeCommandListDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.load()->CommandList.pfnDestroy;
+    auto pfnDestroy = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3537,7 +3545,7 @@ zeCommandListClose(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListClose_t pfnClose = [&result] {
-        auto pfnClose = ze_lib::context->zeDdiTable.load()->CommandList.pfnClose;
+        auto pfnClose = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnClose;
         if( nullptr == pfnClose ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3552,7 +3560,7 @@ zeCommandListClose(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnClose = ze_lib::context->zeDdiTable.load()->CommandList.pfnClose;
+    auto pfnClose = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnClose;
     if( nullptr == pfnClose ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3602,7 +3610,7 @@ zeCommandListReset(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListReset_t pfnReset = [&result] {
-        auto pfnReset = ze_lib::context->zeDdiTable.load()->CommandList.pfnReset;
+        auto pfnReset = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnReset;
         if( nullptr == pfnReset ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3617,7 +3625,7 @@ zeCommandListReset(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReset = ze_lib::context->zeDdiTable.load()->CommandList.pfnReset;
+    auto pfnReset = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnReset;
     if( nullptr == pfnReset ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3687,7 +3695,7 @@ zeCommandListAppendWriteGlobalTimestamp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendWriteGlobalTimestamp_t pfnAppendWriteGlobalTimestamp = [&result] {
-        auto pfnAppendWriteGlobalTimestamp = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendWriteGlobalTimestamp;
+        auto pfnAppendWriteGlobalTimestamp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendWriteGlobalTimestamp;
         if( nullptr == pfnAppendWriteGlobalTimestamp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3702,7 +3710,7 @@ zeCommandListAppendWriteGlobalTimestamp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendWriteGlobalTimestamp = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendWriteGlobalTimestamp;
+    auto pfnAppendWriteGlobalTimestamp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendWriteGlobalTimestamp;
     if( nullptr == pfnAppendWriteGlobalTimestamp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3765,7 +3773,7 @@ zeCommandListHostSynchronize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListHostSynchronize_t pfnHostSynchronize = [&result] {
-        auto pfnHostSynchronize = ze_lib::context->zeDdiTable.load()->CommandList.pfnHostSynchronize;
+        auto pfnHostSynchronize = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnHostSynchronize;
         if( nullptr == pfnHostSynchronize ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3780,7 +3788,7 @@ zeCommandListHostSynchronize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnHostSynchronize = ze_lib::context->zeDdiTable.load()->CommandList.pfnHostSynchronize;
+    auto pfnHostSynchronize = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnHostSynchronize;
     if( nullptr == pfnHostSynchronize ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3829,7 +3837,7 @@ zeCommandListGetDeviceHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListGetDeviceHandle_t pfnGetDeviceHandle = [&result] {
-        auto pfnGetDeviceHandle = ze_lib::context->zeDdiTable.load()->CommandList.pfnGetDeviceHandle;
+        auto pfnGetDeviceHandle = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnGetDeviceHandle;
         if( nullptr == pfnGetDeviceHandle ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3844,7 +3852,7 @@ zeCommandListGetDeviceHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetDeviceHandle = ze_lib::context->zeDdiTable.load()->CommandList.pfnGetDeviceHandle;
+    auto pfnGetDeviceHandle = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnGetDeviceHandle;
     if( nullptr == pfnGetDeviceHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3893,7 +3901,7 @@ zeCommandListGetContextHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListGetContextHandle_t pfnGetContextHandle = [&result] {
-        auto pfnGetContextHandle = ze_lib::context->zeDdiTable.load()->CommandList.pfnGetContextHandle;
+        auto pfnGetContextHandle = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnGetContextHandle;
         if( nullptr == pfnGetContextHandle ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3908,7 +3916,7 @@ zeCommandListGetContextHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetContextHandle = ze_lib::context->zeDdiTable.load()->CommandList.pfnGetContextHandle;
+    auto pfnGetContextHandle = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnGetContextHandle;
     if( nullptr == pfnGetContextHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3958,7 +3966,7 @@ zeCommandListGetOrdinal(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListGetOrdinal_t pfnGetOrdinal = [&result] {
-        auto pfnGetOrdinal = ze_lib::context->zeDdiTable.load()->CommandList.pfnGetOrdinal;
+        auto pfnGetOrdinal = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnGetOrdinal;
         if( nullptr == pfnGetOrdinal ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3973,7 +3981,7 @@ zeCommandListGetOrdinal(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetOrdinal = ze_lib::context->zeDdiTable.load()->CommandList.pfnGetOrdinal;
+    auto pfnGetOrdinal = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnGetOrdinal;
     if( nullptr == pfnGetOrdinal ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4027,7 +4035,7 @@ zeCommandListImmediateGetIndex(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListImmediateGetIndex_t pfnImmediateGetIndex = [&result] {
-        auto pfnImmediateGetIndex = ze_lib::context->zeDdiTable.load()->CommandList.pfnImmediateGetIndex;
+        auto pfnImmediateGetIndex = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnImmediateGetIndex;
         if( nullptr == pfnImmediateGetIndex ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4042,7 +4050,7 @@ zeCommandListImmediateGetIndex(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnImmediateGetIndex = ze_lib::context->zeDdiTable.load()->CommandList.pfnImmediateGetIndex;
+    auto pfnImmediateGetIndex = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnImmediateGetIndex;
     if( nullptr == pfnImmediateGetIndex ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4092,7 +4100,7 @@ zeCommandListIsImmediate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListIsImmediate_t pfnIsImmediate = [&result] {
-        auto pfnIsImmediate = ze_lib::context->zeDdiTable.load()->CommandList.pfnIsImmediate;
+        auto pfnIsImmediate = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnIsImmediate;
         if( nullptr == pfnIsImmediate ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4107,7 +4115,7 @@ zeCommandListIsImmediate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnIsImmediate = ze_lib::context->zeDdiTable.load()->CommandList.pfnIsImmediate;
+    auto pfnIsImmediate = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnIsImmediate;
     if( nullptr == pfnIsImmediate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4156,7 +4164,7 @@ zeCommandListGetFlags(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListGetFlags_t pfnGetFlags = [&result] {
-        auto pfnGetFlags = ze_lib::context->zeDdiTable.load()->CommandList.pfnGetFlags;
+        auto pfnGetFlags = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnGetFlags;
         if( nullptr == pfnGetFlags ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4171,7 +4179,7 @@ zeCommandListGetFlags(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetFlags = ze_lib::context->zeDdiTable.load()->CommandList.pfnGetFlags;
+    auto pfnGetFlags = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnGetFlags;
     if( nullptr == pfnGetFlags ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4223,7 +4231,7 @@ zeCommandListImmediateGetFlags(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListImmediateGetFlags_t pfnImmediateGetFlags = [&result] {
-        auto pfnImmediateGetFlags = ze_lib::context->zeDdiTable.load()->CommandList.pfnImmediateGetFlags;
+        auto pfnImmediateGetFlags = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnImmediateGetFlags;
         if( nullptr == pfnImmediateGetFlags ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4238,7 +4246,7 @@ zeCommandListImmediateGetFlags(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnImmediateGetFlags = ze_lib::context->zeDdiTable.load()->CommandList.pfnImmediateGetFlags;
+    auto pfnImmediateGetFlags = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnImmediateGetFlags;
     if( nullptr == pfnImmediateGetFlags ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4290,7 +4298,7 @@ zeCommandListImmediateGetMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListImmediateGetMode_t pfnImmediateGetMode = [&result] {
-        auto pfnImmediateGetMode = ze_lib::context->zeDdiTable.load()->CommandList.pfnImmediateGetMode;
+        auto pfnImmediateGetMode = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnImmediateGetMode;
         if( nullptr == pfnImmediateGetMode ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4305,7 +4313,7 @@ zeCommandListImmediateGetMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnImmediateGetMode = ze_lib::context->zeDdiTable.load()->CommandList.pfnImmediateGetMode;
+    auto pfnImmediateGetMode = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnImmediateGetMode;
     if( nullptr == pfnImmediateGetMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4357,7 +4365,7 @@ zeCommandListImmediateGetPriority(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListImmediateGetPriority_t pfnImmediateGetPriority = [&result] {
-        auto pfnImmediateGetPriority = ze_lib::context->zeDdiTable.load()->CommandList.pfnImmediateGetPriority;
+        auto pfnImmediateGetPriority = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnImmediateGetPriority;
         if( nullptr == pfnImmediateGetPriority ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4372,7 +4380,7 @@ zeCommandListImmediateGetPriority(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnImmediateGetPriority = ze_lib::context->zeDdiTable.load()->CommandList.pfnImmediateGetPriority;
+    auto pfnImmediateGetPriority = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnImmediateGetPriority;
     if( nullptr == pfnImmediateGetPriority ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4441,7 +4449,7 @@ zeCommandListAppendBarrier(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendBarrier_t pfnAppendBarrier = [&result] {
-        auto pfnAppendBarrier = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendBarrier;
+        auto pfnAppendBarrier = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendBarrier;
         if( nullptr == pfnAppendBarrier ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4456,7 +4464,7 @@ zeCommandListAppendBarrier(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendBarrier = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendBarrier;
+    auto pfnAppendBarrier = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendBarrier;
     if( nullptr == pfnAppendBarrier ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4525,7 +4533,7 @@ zeCommandListAppendMemoryRangesBarrier(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendMemoryRangesBarrier_t pfnAppendMemoryRangesBarrier = [&result] {
-        auto pfnAppendMemoryRangesBarrier = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendMemoryRangesBarrier;
+        auto pfnAppendMemoryRangesBarrier = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendMemoryRangesBarrier;
         if( nullptr == pfnAppendMemoryRangesBarrier ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4540,7 +4548,7 @@ zeCommandListAppendMemoryRangesBarrier(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMemoryRangesBarrier = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendMemoryRangesBarrier;
+    auto pfnAppendMemoryRangesBarrier = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendMemoryRangesBarrier;
     if( nullptr == pfnAppendMemoryRangesBarrier ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4594,7 +4602,7 @@ zeContextSystemBarrier(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnContextSystemBarrier_t pfnSystemBarrier = [&result] {
-        auto pfnSystemBarrier = ze_lib::context->zeDdiTable.load()->Context.pfnSystemBarrier;
+        auto pfnSystemBarrier = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Context.pfnSystemBarrier;
         if( nullptr == pfnSystemBarrier ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4609,7 +4617,7 @@ zeContextSystemBarrier(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSystemBarrier = ze_lib::context->zeDdiTable.load()->Context.pfnSystemBarrier;
+    auto pfnSystemBarrier = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Context.pfnSystemBarrier;
     if( nullptr == pfnSystemBarrier ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4686,7 +4694,7 @@ zeCommandListAppendMemoryCopy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendMemoryCopy_t pfnAppendMemoryCopy = [&result] {
-        auto pfnAppendMemoryCopy = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendMemoryCopy;
+        auto pfnAppendMemoryCopy = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendMemoryCopy;
         if( nullptr == pfnAppendMemoryCopy ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4701,7 +4709,7 @@ zeCommandListAppendMemoryCopy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMemoryCopy = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendMemoryCopy;
+    auto pfnAppendMemoryCopy = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendMemoryCopy;
     if( nullptr == pfnAppendMemoryCopy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4780,7 +4788,7 @@ zeCommandListAppendMemoryCopyWithParameters(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendMemoryCopyWithParameters_t pfnAppendMemoryCopyWithParameters = [&result] {
-        auto pfnAppendMemoryCopyWithParameters = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendMemoryCopyWithParameters;
+        auto pfnAppendMemoryCopyWithParameters = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendMemoryCopyWithParameters;
         if( nullptr == pfnAppendMemoryCopyWithParameters ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4795,7 +4803,7 @@ zeCommandListAppendMemoryCopyWithParameters(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMemoryCopyWithParameters = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendMemoryCopyWithParameters;
+    auto pfnAppendMemoryCopyWithParameters = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendMemoryCopyWithParameters;
     if( nullptr == pfnAppendMemoryCopyWithParameters ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4880,7 +4888,7 @@ zeCommandListAppendMemoryFill(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendMemoryFill_t pfnAppendMemoryFill = [&result] {
-        auto pfnAppendMemoryFill = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendMemoryFill;
+        auto pfnAppendMemoryFill = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendMemoryFill;
         if( nullptr == pfnAppendMemoryFill ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4895,7 +4903,7 @@ zeCommandListAppendMemoryFill(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMemoryFill = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendMemoryFill;
+    auto pfnAppendMemoryFill = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendMemoryFill;
     if( nullptr == pfnAppendMemoryFill ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4982,7 +4990,7 @@ zeCommandListAppendMemoryFillWithParameters(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendMemoryFillWithParameters_t pfnAppendMemoryFillWithParameters = [&result] {
-        auto pfnAppendMemoryFillWithParameters = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendMemoryFillWithParameters;
+        auto pfnAppendMemoryFillWithParameters = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendMemoryFillWithParameters;
         if( nullptr == pfnAppendMemoryFillWithParameters ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4997,7 +5005,7 @@ zeCommandListAppendMemoryFillWithParameters(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMemoryFillWithParameters = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendMemoryFillWithParameters;
+    auto pfnAppendMemoryFillWithParameters = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendMemoryFillWithParameters;
     if( nullptr == pfnAppendMemoryFillWithParameters ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5083,7 +5091,7 @@ zeCommandListAppendMemoryCopyRegion(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendMemoryCopyRegion_t pfnAppendMemoryCopyRegion = [&result] {
-        auto pfnAppendMemoryCopyRegion = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendMemoryCopyRegion;
+        auto pfnAppendMemoryCopyRegion = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendMemoryCopyRegion;
         if( nullptr == pfnAppendMemoryCopyRegion ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -5098,7 +5106,7 @@ zeCommandListAppendMemoryCopyRegion(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMemoryCopyRegion = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendMemoryCopyRegion;
+    auto pfnAppendMemoryCopyRegion = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendMemoryCopyRegion;
     if( nullptr == pfnAppendMemoryCopyRegion ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5171,7 +5179,7 @@ zeCommandListAppendMemoryCopyFromContext(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendMemoryCopyFromContext_t pfnAppendMemoryCopyFromContext = [&result] {
-        auto pfnAppendMemoryCopyFromContext = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendMemoryCopyFromContext;
+        auto pfnAppendMemoryCopyFromContext = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendMemoryCopyFromContext;
         if( nullptr == pfnAppendMemoryCopyFromContext ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -5186,7 +5194,7 @@ zeCommandListAppendMemoryCopyFromContext(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMemoryCopyFromContext = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendMemoryCopyFromContext;
+    auto pfnAppendMemoryCopyFromContext = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendMemoryCopyFromContext;
     if( nullptr == pfnAppendMemoryCopyFromContext ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5255,7 +5263,7 @@ zeCommandListAppendImageCopy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendImageCopy_t pfnAppendImageCopy = [&result] {
-        auto pfnAppendImageCopy = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendImageCopy;
+        auto pfnAppendImageCopy = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendImageCopy;
         if( nullptr == pfnAppendImageCopy ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -5270,7 +5278,7 @@ zeCommandListAppendImageCopy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendImageCopy = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendImageCopy;
+    auto pfnAppendImageCopy = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendImageCopy;
     if( nullptr == pfnAppendImageCopy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5341,7 +5349,7 @@ zeCommandListAppendImageCopyRegion(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendImageCopyRegion_t pfnAppendImageCopyRegion = [&result] {
-        auto pfnAppendImageCopyRegion = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendImageCopyRegion;
+        auto pfnAppendImageCopyRegion = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendImageCopyRegion;
         if( nullptr == pfnAppendImageCopyRegion ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -5356,7 +5364,7 @@ zeCommandListAppendImageCopyRegion(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendImageCopyRegion = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendImageCopyRegion;
+    auto pfnAppendImageCopyRegion = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendImageCopyRegion;
     if( nullptr == pfnAppendImageCopyRegion ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5432,7 +5440,7 @@ zeCommandListAppendImageCopyToMemory(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendImageCopyToMemory_t pfnAppendImageCopyToMemory = [&result] {
-        auto pfnAppendImageCopyToMemory = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendImageCopyToMemory;
+        auto pfnAppendImageCopyToMemory = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendImageCopyToMemory;
         if( nullptr == pfnAppendImageCopyToMemory ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -5447,7 +5455,7 @@ zeCommandListAppendImageCopyToMemory(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendImageCopyToMemory = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendImageCopyToMemory;
+    auto pfnAppendImageCopyToMemory = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendImageCopyToMemory;
     if( nullptr == pfnAppendImageCopyToMemory ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5523,7 +5531,7 @@ zeCommandListAppendImageCopyFromMemory(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendImageCopyFromMemory_t pfnAppendImageCopyFromMemory = [&result] {
-        auto pfnAppendImageCopyFromMemory = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendImageCopyFromMemory;
+        auto pfnAppendImageCopyFromMemory = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendImageCopyFromMemory;
         if( nullptr == pfnAppendImageCopyFromMemory ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -5538,7 +5546,7 @@ zeCommandListAppendImageCopyFromMemory(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendImageCopyFromMemory = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendImageCopyFromMemory;
+    auto pfnAppendImageCopyFromMemory = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendImageCopyFromMemory;
     if( nullptr == pfnAppendImageCopyFromMemory ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5610,7 +5618,7 @@ zeCommandListAppendMemoryPrefetch(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendMemoryPrefetch_t pfnAppendMemoryPrefetch = [&result] {
-        auto pfnAppendMemoryPrefetch = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendMemoryPrefetch;
+        auto pfnAppendMemoryPrefetch = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendMemoryPrefetch;
         if( nullptr == pfnAppendMemoryPrefetch ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -5625,7 +5633,7 @@ zeCommandListAppendMemoryPrefetch(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMemoryPrefetch = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendMemoryPrefetch;
+    auto pfnAppendMemoryPrefetch = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendMemoryPrefetch;
     if( nullptr == pfnAppendMemoryPrefetch ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5698,7 +5706,7 @@ zeCommandListAppendMemAdvise(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendMemAdvise_t pfnAppendMemAdvise = [&result] {
-        auto pfnAppendMemAdvise = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendMemAdvise;
+        auto pfnAppendMemAdvise = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendMemAdvise;
         if( nullptr == pfnAppendMemAdvise ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -5713,7 +5721,7 @@ zeCommandListAppendMemAdvise(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMemAdvise = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendMemAdvise;
+    auto pfnAppendMemAdvise = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendMemAdvise;
     if( nullptr == pfnAppendMemAdvise ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5778,7 +5786,7 @@ zeEventPoolCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnEventPoolCreate_t pfnCreate = [&result] {
-        auto pfnCreate = ze_lib::context->zeDdiTable.load()->EventPool.pfnCreate;
+        auto pfnCreate = ze_lib::zeDdiTable.load(std::memory_order_acquire)->EventPool.pfnCreate;
         if( nullptr == pfnCreate ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -5793,7 +5801,7 @@ zeEventPoolCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.load()->EventPool.pfnCreate;
+    auto pfnCreate = ze_lib::zeDdiTable.load(std::memory_order_acquire)->EventPool.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5847,7 +5855,7 @@ zeEventPoolDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnEventPoolDestroy_t pfnDestroy = [&result] {
-        auto pfnDestroy = ze_lib::context->zeDdiTable.load()->EventPool.pfnDestroy;
+        auto pfnDestroy = ze_lib::zeDdiTable.load(std::memory_order_acquire)->EventPool.pfnDestroy;
         if( nullptr == pfnDestroy ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -5862,7 +5870,7 @@ zeEventPoolDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.load()->EventPool.pfnDestroy;
+    auto pfnDestroy = ze_lib::zeDdiTable.load(std::memory_order_acquire)->EventPool.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5927,7 +5935,7 @@ zeEventCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnEventCreate_t pfnCreate = [&result] {
-        auto pfnCreate = ze_lib::context->zeDdiTable.load()->Event.pfnCreate;
+        auto pfnCreate = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnCreate;
         if( nullptr == pfnCreate ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -5942,7 +5950,7 @@ zeEventCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.load()->Event.pfnCreate;
+    auto pfnCreate = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5997,7 +6005,7 @@ zeEventCounterBasedCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnEventCounterBasedCreate_t pfnCounterBasedCreate = [&result] {
-        auto pfnCounterBasedCreate = ze_lib::context->zeDdiTable.load()->Event.pfnCounterBasedCreate;
+        auto pfnCounterBasedCreate = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnCounterBasedCreate;
         if( nullptr == pfnCounterBasedCreate ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6012,7 +6020,7 @@ zeEventCounterBasedCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCounterBasedCreate = ze_lib::context->zeDdiTable.load()->Event.pfnCounterBasedCreate;
+    auto pfnCounterBasedCreate = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnCounterBasedCreate;
     if( nullptr == pfnCounterBasedCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6069,7 +6077,7 @@ zeEventDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnEventDestroy_t pfnDestroy = [&result] {
-        auto pfnDestroy = ze_lib::context->zeDdiTable.load()->Event.pfnDestroy;
+        auto pfnDestroy = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnDestroy;
         if( nullptr == pfnDestroy ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6084,7 +6092,7 @@ zeEventDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.load()->Event.pfnDestroy;
+    auto pfnDestroy = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6135,7 +6143,7 @@ zeEventPoolGetIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnEventPoolGetIpcHandle_t pfnGetIpcHandle = [&result] {
-        auto pfnGetIpcHandle = ze_lib::context->zeDdiTable.load()->EventPool.pfnGetIpcHandle;
+        auto pfnGetIpcHandle = ze_lib::zeDdiTable.load(std::memory_order_acquire)->EventPool.pfnGetIpcHandle;
         if( nullptr == pfnGetIpcHandle ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6150,7 +6158,7 @@ zeEventPoolGetIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetIpcHandle = ze_lib::context->zeDdiTable.load()->EventPool.pfnGetIpcHandle;
+    auto pfnGetIpcHandle = ze_lib::zeDdiTable.load(std::memory_order_acquire)->EventPool.pfnGetIpcHandle;
     if( nullptr == pfnGetIpcHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6207,7 +6215,7 @@ zeEventPoolPutIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnEventPoolPutIpcHandle_t pfnPutIpcHandle = [&result] {
-        auto pfnPutIpcHandle = ze_lib::context->zeDdiTable.load()->EventPool.pfnPutIpcHandle;
+        auto pfnPutIpcHandle = ze_lib::zeDdiTable.load(std::memory_order_acquire)->EventPool.pfnPutIpcHandle;
         if( nullptr == pfnPutIpcHandle ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6222,7 +6230,7 @@ zeEventPoolPutIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnPutIpcHandle = ze_lib::context->zeDdiTable.load()->EventPool.pfnPutIpcHandle;
+    auto pfnPutIpcHandle = ze_lib::zeDdiTable.load(std::memory_order_acquire)->EventPool.pfnPutIpcHandle;
     if( nullptr == pfnPutIpcHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6289,7 +6297,7 @@ zeEventPoolOpenIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnEventPoolOpenIpcHandle_t pfnOpenIpcHandle = [&result] {
-        auto pfnOpenIpcHandle = ze_lib::context->zeDdiTable.load()->EventPool.pfnOpenIpcHandle;
+        auto pfnOpenIpcHandle = ze_lib::zeDdiTable.load(std::memory_order_acquire)->EventPool.pfnOpenIpcHandle;
         if( nullptr == pfnOpenIpcHandle ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6304,7 +6312,7 @@ zeEventPoolOpenIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOpenIpcHandle = ze_lib::context->zeDdiTable.load()->EventPool.pfnOpenIpcHandle;
+    auto pfnOpenIpcHandle = ze_lib::zeDdiTable.load(std::memory_order_acquire)->EventPool.pfnOpenIpcHandle;
     if( nullptr == pfnOpenIpcHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6352,7 +6360,7 @@ zeEventPoolCloseIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnEventPoolCloseIpcHandle_t pfnCloseIpcHandle = [&result] {
-        auto pfnCloseIpcHandle = ze_lib::context->zeDdiTable.load()->EventPool.pfnCloseIpcHandle;
+        auto pfnCloseIpcHandle = ze_lib::zeDdiTable.load(std::memory_order_acquire)->EventPool.pfnCloseIpcHandle;
         if( nullptr == pfnCloseIpcHandle ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6367,7 +6375,7 @@ zeEventPoolCloseIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCloseIpcHandle = ze_lib::context->zeDdiTable.load()->EventPool.pfnCloseIpcHandle;
+    auto pfnCloseIpcHandle = ze_lib::zeDdiTable.load(std::memory_order_acquire)->EventPool.pfnCloseIpcHandle;
     if( nullptr == pfnCloseIpcHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6414,7 +6422,7 @@ zeEventCounterBasedGetIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnEventCounterBasedGetIpcHandle_t pfnCounterBasedGetIpcHandle = [&result] {
-        auto pfnCounterBasedGetIpcHandle = ze_lib::context->zeDdiTable.load()->Event.pfnCounterBasedGetIpcHandle;
+        auto pfnCounterBasedGetIpcHandle = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnCounterBasedGetIpcHandle;
         if( nullptr == pfnCounterBasedGetIpcHandle ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6429,7 +6437,7 @@ zeEventCounterBasedGetIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCounterBasedGetIpcHandle = ze_lib::context->zeDdiTable.load()->Event.pfnCounterBasedGetIpcHandle;
+    auto pfnCounterBasedGetIpcHandle = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnCounterBasedGetIpcHandle;
     if( nullptr == pfnCounterBasedGetIpcHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6493,7 +6501,7 @@ zeEventCounterBasedOpenIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnEventCounterBasedOpenIpcHandle_t pfnCounterBasedOpenIpcHandle = [&result] {
-        auto pfnCounterBasedOpenIpcHandle = ze_lib::context->zeDdiTable.load()->Event.pfnCounterBasedOpenIpcHandle;
+        auto pfnCounterBasedOpenIpcHandle = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnCounterBasedOpenIpcHandle;
         if( nullptr == pfnCounterBasedOpenIpcHandle ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6508,7 +6516,7 @@ zeEventCounterBasedOpenIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCounterBasedOpenIpcHandle = ze_lib::context->zeDdiTable.load()->Event.pfnCounterBasedOpenIpcHandle;
+    auto pfnCounterBasedOpenIpcHandle = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnCounterBasedOpenIpcHandle;
     if( nullptr == pfnCounterBasedOpenIpcHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6551,7 +6559,7 @@ zeEventCounterBasedCloseIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnEventCounterBasedCloseIpcHandle_t pfnCounterBasedCloseIpcHandle = [&result] {
-        auto pfnCounterBasedCloseIpcHandle = ze_lib::context->zeDdiTable.load()->Event.pfnCounterBasedCloseIpcHandle;
+        auto pfnCounterBasedCloseIpcHandle = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnCounterBasedCloseIpcHandle;
         if( nullptr == pfnCounterBasedCloseIpcHandle ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6566,7 +6574,7 @@ zeEventCounterBasedCloseIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCounterBasedCloseIpcHandle = ze_lib::context->zeDdiTable.load()->Event.pfnCounterBasedCloseIpcHandle;
+    auto pfnCounterBasedCloseIpcHandle = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnCounterBasedCloseIpcHandle;
     if( nullptr == pfnCounterBasedCloseIpcHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6614,7 +6622,7 @@ zeEventCounterBasedGetDeviceAddress(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnEventCounterBasedGetDeviceAddress_t pfnCounterBasedGetDeviceAddress = [&result] {
-        auto pfnCounterBasedGetDeviceAddress = ze_lib::context->zeDdiTable.load()->Event.pfnCounterBasedGetDeviceAddress;
+        auto pfnCounterBasedGetDeviceAddress = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnCounterBasedGetDeviceAddress;
         if( nullptr == pfnCounterBasedGetDeviceAddress ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6629,7 +6637,7 @@ zeEventCounterBasedGetDeviceAddress(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCounterBasedGetDeviceAddress = ze_lib::context->zeDdiTable.load()->Event.pfnCounterBasedGetDeviceAddress;
+    auto pfnCounterBasedGetDeviceAddress = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnCounterBasedGetDeviceAddress;
     if( nullptr == pfnCounterBasedGetDeviceAddress ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6701,7 +6709,7 @@ zeCommandListAppendSignalEvent(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendSignalEvent_t pfnAppendSignalEvent = [&result] {
-        auto pfnAppendSignalEvent = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendSignalEvent;
+        auto pfnAppendSignalEvent = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendSignalEvent;
         if( nullptr == pfnAppendSignalEvent ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6716,7 +6724,7 @@ zeCommandListAppendSignalEvent(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendSignalEvent = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendSignalEvent;
+    auto pfnAppendSignalEvent = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendSignalEvent;
     if( nullptr == pfnAppendSignalEvent ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6777,7 +6785,7 @@ zeCommandListAppendWaitOnEvents(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendWaitOnEvents_t pfnAppendWaitOnEvents = [&result] {
-        auto pfnAppendWaitOnEvents = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendWaitOnEvents;
+        auto pfnAppendWaitOnEvents = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendWaitOnEvents;
         if( nullptr == pfnAppendWaitOnEvents ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6792,7 +6800,7 @@ zeCommandListAppendWaitOnEvents(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendWaitOnEvents = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendWaitOnEvents;
+    auto pfnAppendWaitOnEvents = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendWaitOnEvents;
     if( nullptr == pfnAppendWaitOnEvents ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6848,7 +6856,7 @@ zeEventHostSignal(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnEventHostSignal_t pfnHostSignal = [&result] {
-        auto pfnHostSignal = ze_lib::context->zeDdiTable.load()->Event.pfnHostSignal;
+        auto pfnHostSignal = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnHostSignal;
         if( nullptr == pfnHostSignal ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6863,7 +6871,7 @@ zeEventHostSignal(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnHostSignal = ze_lib::context->zeDdiTable.load()->Event.pfnHostSignal;
+    auto pfnHostSignal = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnHostSignal;
     if( nullptr == pfnHostSignal ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6923,7 +6931,7 @@ zeEventHostSynchronize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnEventHostSynchronize_t pfnHostSynchronize = [&result] {
-        auto pfnHostSynchronize = ze_lib::context->zeDdiTable.load()->Event.pfnHostSynchronize;
+        auto pfnHostSynchronize = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnHostSynchronize;
         if( nullptr == pfnHostSynchronize ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6938,7 +6946,7 @@ zeEventHostSynchronize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnHostSynchronize = ze_lib::context->zeDdiTable.load()->Event.pfnHostSynchronize;
+    auto pfnHostSynchronize = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnHostSynchronize;
     if( nullptr == pfnHostSynchronize ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6992,7 +7000,7 @@ zeEventQueryStatus(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnEventQueryStatus_t pfnQueryStatus = [&result] {
-        auto pfnQueryStatus = ze_lib::context->zeDdiTable.load()->Event.pfnQueryStatus;
+        auto pfnQueryStatus = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnQueryStatus;
         if( nullptr == pfnQueryStatus ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7007,7 +7015,7 @@ zeEventQueryStatus(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnQueryStatus = ze_lib::context->zeDdiTable.load()->Event.pfnQueryStatus;
+    auto pfnQueryStatus = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnQueryStatus;
     if( nullptr == pfnQueryStatus ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7066,7 +7074,7 @@ zeCommandListAppendEventReset(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendEventReset_t pfnAppendEventReset = [&result] {
-        auto pfnAppendEventReset = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendEventReset;
+        auto pfnAppendEventReset = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendEventReset;
         if( nullptr == pfnAppendEventReset ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7081,7 +7089,7 @@ zeCommandListAppendEventReset(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendEventReset = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendEventReset;
+    auto pfnAppendEventReset = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendEventReset;
     if( nullptr == pfnAppendEventReset ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7132,7 +7140,7 @@ zeEventHostReset(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnEventHostReset_t pfnHostReset = [&result] {
-        auto pfnHostReset = ze_lib::context->zeDdiTable.load()->Event.pfnHostReset;
+        auto pfnHostReset = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnHostReset;
         if( nullptr == pfnHostReset ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7147,7 +7155,7 @@ zeEventHostReset(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnHostReset = ze_lib::context->zeDdiTable.load()->Event.pfnHostReset;
+    auto pfnHostReset = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnHostReset;
     if( nullptr == pfnHostReset ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7204,7 +7212,7 @@ zeEventQueryKernelTimestamp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnEventQueryKernelTimestamp_t pfnQueryKernelTimestamp = [&result] {
-        auto pfnQueryKernelTimestamp = ze_lib::context->zeDdiTable.load()->Event.pfnQueryKernelTimestamp;
+        auto pfnQueryKernelTimestamp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnQueryKernelTimestamp;
         if( nullptr == pfnQueryKernelTimestamp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7219,7 +7227,7 @@ zeEventQueryKernelTimestamp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnQueryKernelTimestamp = ze_lib::context->zeDdiTable.load()->Event.pfnQueryKernelTimestamp;
+    auto pfnQueryKernelTimestamp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnQueryKernelTimestamp;
     if( nullptr == pfnQueryKernelTimestamp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7298,7 +7306,7 @@ zeCommandListAppendQueryKernelTimestamps(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendQueryKernelTimestamps_t pfnAppendQueryKernelTimestamps = [&result] {
-        auto pfnAppendQueryKernelTimestamps = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendQueryKernelTimestamps;
+        auto pfnAppendQueryKernelTimestamps = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendQueryKernelTimestamps;
         if( nullptr == pfnAppendQueryKernelTimestamps ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7313,7 +7321,7 @@ zeCommandListAppendQueryKernelTimestamps(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendQueryKernelTimestamps = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendQueryKernelTimestamps;
+    auto pfnAppendQueryKernelTimestamps = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendQueryKernelTimestamps;
     if( nullptr == pfnAppendQueryKernelTimestamps ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7362,7 +7370,7 @@ zeEventGetEventPool(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnEventGetEventPool_t pfnGetEventPool = [&result] {
-        auto pfnGetEventPool = ze_lib::context->zeDdiTable.load()->Event.pfnGetEventPool;
+        auto pfnGetEventPool = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnGetEventPool;
         if( nullptr == pfnGetEventPool ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7377,7 +7385,7 @@ zeEventGetEventPool(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetEventPool = ze_lib::context->zeDdiTable.load()->Event.pfnGetEventPool;
+    auto pfnGetEventPool = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnGetEventPool;
     if( nullptr == pfnGetEventPool ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7428,7 +7436,7 @@ zeEventGetSignalScope(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnEventGetSignalScope_t pfnGetSignalScope = [&result] {
-        auto pfnGetSignalScope = ze_lib::context->zeDdiTable.load()->Event.pfnGetSignalScope;
+        auto pfnGetSignalScope = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnGetSignalScope;
         if( nullptr == pfnGetSignalScope ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7443,7 +7451,7 @@ zeEventGetSignalScope(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetSignalScope = ze_lib::context->zeDdiTable.load()->Event.pfnGetSignalScope;
+    auto pfnGetSignalScope = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnGetSignalScope;
     if( nullptr == pfnGetSignalScope ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7494,7 +7502,7 @@ zeEventGetWaitScope(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnEventGetWaitScope_t pfnGetWaitScope = [&result] {
-        auto pfnGetWaitScope = ze_lib::context->zeDdiTable.load()->Event.pfnGetWaitScope;
+        auto pfnGetWaitScope = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnGetWaitScope;
         if( nullptr == pfnGetWaitScope ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7509,7 +7517,7 @@ zeEventGetWaitScope(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetWaitScope = ze_lib::context->zeDdiTable.load()->Event.pfnGetWaitScope;
+    auto pfnGetWaitScope = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnGetWaitScope;
     if( nullptr == pfnGetWaitScope ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7558,7 +7566,7 @@ zeEventPoolGetContextHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnEventPoolGetContextHandle_t pfnGetContextHandle = [&result] {
-        auto pfnGetContextHandle = ze_lib::context->zeDdiTable.load()->EventPool.pfnGetContextHandle;
+        auto pfnGetContextHandle = ze_lib::zeDdiTable.load(std::memory_order_acquire)->EventPool.pfnGetContextHandle;
         if( nullptr == pfnGetContextHandle ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7573,7 +7581,7 @@ zeEventPoolGetContextHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetContextHandle = ze_lib::context->zeDdiTable.load()->EventPool.pfnGetContextHandle;
+    auto pfnGetContextHandle = ze_lib::zeDdiTable.load(std::memory_order_acquire)->EventPool.pfnGetContextHandle;
     if( nullptr == pfnGetContextHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7623,7 +7631,7 @@ zeEventPoolGetFlags(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnEventPoolGetFlags_t pfnGetFlags = [&result] {
-        auto pfnGetFlags = ze_lib::context->zeDdiTable.load()->EventPool.pfnGetFlags;
+        auto pfnGetFlags = ze_lib::zeDdiTable.load(std::memory_order_acquire)->EventPool.pfnGetFlags;
         if( nullptr == pfnGetFlags ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7638,7 +7646,7 @@ zeEventPoolGetFlags(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetFlags = ze_lib::context->zeDdiTable.load()->EventPool.pfnGetFlags;
+    auto pfnGetFlags = ze_lib::zeDdiTable.load(std::memory_order_acquire)->EventPool.pfnGetFlags;
     if( nullptr == pfnGetFlags ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7691,7 +7699,7 @@ zeEventGetCounterBasedFlags(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnEventGetCounterBasedFlags_t pfnGetCounterBasedFlags = [&result] {
-        auto pfnGetCounterBasedFlags = ze_lib::context->zeDdiTable.load()->Event.pfnGetCounterBasedFlags;
+        auto pfnGetCounterBasedFlags = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnGetCounterBasedFlags;
         if( nullptr == pfnGetCounterBasedFlags ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7706,7 +7714,7 @@ zeEventGetCounterBasedFlags(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetCounterBasedFlags = ze_lib::context->zeDdiTable.load()->Event.pfnGetCounterBasedFlags;
+    auto pfnGetCounterBasedFlags = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnGetCounterBasedFlags;
     if( nullptr == pfnGetCounterBasedFlags ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7768,7 +7776,7 @@ zeFenceCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnFenceCreate_t pfnCreate = [&result] {
-        auto pfnCreate = ze_lib::context->zeDdiTable.load()->Fence.pfnCreate;
+        auto pfnCreate = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Fence.pfnCreate;
         if( nullptr == pfnCreate ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7783,7 +7791,7 @@ zeFenceCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.load()->Fence.pfnCreate;
+    auto pfnCreate = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Fence.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7839,7 +7847,7 @@ zeFenceDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnFenceDestroy_t pfnDestroy = [&result] {
-        auto pfnDestroy = ze_lib::context->zeDdiTable.load()->Fence.pfnDestroy;
+        auto pfnDestroy = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Fence.pfnDestroy;
         if( nullptr == pfnDestroy ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7854,7 +7862,7 @@ zeFenceDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.load()->Fence.pfnDestroy;
+    auto pfnDestroy = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Fence.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7914,7 +7922,7 @@ zeFenceHostSynchronize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnFenceHostSynchronize_t pfnHostSynchronize = [&result] {
-        auto pfnHostSynchronize = ze_lib::context->zeDdiTable.load()->Fence.pfnHostSynchronize;
+        auto pfnHostSynchronize = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Fence.pfnHostSynchronize;
         if( nullptr == pfnHostSynchronize ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7929,7 +7937,7 @@ zeFenceHostSynchronize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnHostSynchronize = ze_lib::context->zeDdiTable.load()->Fence.pfnHostSynchronize;
+    auto pfnHostSynchronize = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Fence.pfnHostSynchronize;
     if( nullptr == pfnHostSynchronize ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7982,7 +7990,7 @@ zeFenceQueryStatus(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnFenceQueryStatus_t pfnQueryStatus = [&result] {
-        auto pfnQueryStatus = ze_lib::context->zeDdiTable.load()->Fence.pfnQueryStatus;
+        auto pfnQueryStatus = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Fence.pfnQueryStatus;
         if( nullptr == pfnQueryStatus ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7997,7 +8005,7 @@ zeFenceQueryStatus(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnQueryStatus = ze_lib::context->zeDdiTable.load()->Fence.pfnQueryStatus;
+    auto pfnQueryStatus = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Fence.pfnQueryStatus;
     if( nullptr == pfnQueryStatus ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8047,7 +8055,7 @@ zeFenceReset(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnFenceReset_t pfnReset = [&result] {
-        auto pfnReset = ze_lib::context->zeDdiTable.load()->Fence.pfnReset;
+        auto pfnReset = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Fence.pfnReset;
         if( nullptr == pfnReset ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -8062,7 +8070,7 @@ zeFenceReset(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReset = ze_lib::context->zeDdiTable.load()->Fence.pfnReset;
+    auto pfnReset = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Fence.pfnReset;
     if( nullptr == pfnReset ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8117,7 +8125,7 @@ zeImageGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnImageGetProperties_t pfnGetProperties = [&result] {
-        auto pfnGetProperties = ze_lib::context->zeDdiTable.load()->Image.pfnGetProperties;
+        auto pfnGetProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Image.pfnGetProperties;
         if( nullptr == pfnGetProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -8132,7 +8140,7 @@ zeImageGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zeDdiTable.load()->Image.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Image.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8196,7 +8204,7 @@ zeImageCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnImageCreate_t pfnCreate = [&result] {
-        auto pfnCreate = ze_lib::context->zeDdiTable.load()->Image.pfnCreate;
+        auto pfnCreate = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Image.pfnCreate;
         if( nullptr == pfnCreate ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -8211,7 +8219,7 @@ zeImageCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.load()->Image.pfnCreate;
+    auto pfnCreate = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Image.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8263,7 +8271,7 @@ zeImageDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnImageDestroy_t pfnDestroy = [&result] {
-        auto pfnDestroy = ze_lib::context->zeDdiTable.load()->Image.pfnDestroy;
+        auto pfnDestroy = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Image.pfnDestroy;
         if( nullptr == pfnDestroy ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -8278,7 +8286,7 @@ zeImageDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.load()->Image.pfnDestroy;
+    auto pfnDestroy = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Image.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8360,7 +8368,7 @@ zeMemAllocShared(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnMemAllocShared_t pfnAllocShared = [&result] {
-        auto pfnAllocShared = ze_lib::context->zeDdiTable.load()->Mem.pfnAllocShared;
+        auto pfnAllocShared = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Mem.pfnAllocShared;
         if( nullptr == pfnAllocShared ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -8375,7 +8383,7 @@ zeMemAllocShared(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAllocShared = ze_lib::context->zeDdiTable.load()->Mem.pfnAllocShared;
+    auto pfnAllocShared = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Mem.pfnAllocShared;
     if( nullptr == pfnAllocShared ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8445,7 +8453,7 @@ zeMemAllocDevice(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnMemAllocDevice_t pfnAllocDevice = [&result] {
-        auto pfnAllocDevice = ze_lib::context->zeDdiTable.load()->Mem.pfnAllocDevice;
+        auto pfnAllocDevice = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Mem.pfnAllocDevice;
         if( nullptr == pfnAllocDevice ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -8460,7 +8468,7 @@ zeMemAllocDevice(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAllocDevice = ze_lib::context->zeDdiTable.load()->Mem.pfnAllocDevice;
+    auto pfnAllocDevice = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Mem.pfnAllocDevice;
     if( nullptr == pfnAllocDevice ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8530,7 +8538,7 @@ zeMemAllocHost(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnMemAllocHost_t pfnAllocHost = [&result] {
-        auto pfnAllocHost = ze_lib::context->zeDdiTable.load()->Mem.pfnAllocHost;
+        auto pfnAllocHost = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Mem.pfnAllocHost;
         if( nullptr == pfnAllocHost ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -8545,7 +8553,7 @@ zeMemAllocHost(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAllocHost = ze_lib::context->zeDdiTable.load()->Mem.pfnAllocHost;
+    auto pfnAllocHost = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Mem.pfnAllocHost;
     if( nullptr == pfnAllocHost ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8603,7 +8611,7 @@ zeMemFree(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnMemFree_t pfnFree = [&result] {
-        auto pfnFree = ze_lib::context->zeDdiTable.load()->Mem.pfnFree;
+        auto pfnFree = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Mem.pfnFree;
         if( nullptr == pfnFree ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -8618,7 +8626,7 @@ zeMemFree(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnFree = ze_lib::context->zeDdiTable.load()->Mem.pfnFree;
+    auto pfnFree = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Mem.pfnFree;
     if( nullptr == pfnFree ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8674,7 +8682,7 @@ zeMemGetAllocProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnMemGetAllocProperties_t pfnGetAllocProperties = [&result] {
-        auto pfnGetAllocProperties = ze_lib::context->zeDdiTable.load()->Mem.pfnGetAllocProperties;
+        auto pfnGetAllocProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Mem.pfnGetAllocProperties;
         if( nullptr == pfnGetAllocProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -8689,7 +8697,7 @@ zeMemGetAllocProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetAllocProperties = ze_lib::context->zeDdiTable.load()->Mem.pfnGetAllocProperties;
+    auto pfnGetAllocProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Mem.pfnGetAllocProperties;
     if( nullptr == pfnGetAllocProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8740,7 +8748,7 @@ zeMemGetAddressRange(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnMemGetAddressRange_t pfnGetAddressRange = [&result] {
-        auto pfnGetAddressRange = ze_lib::context->zeDdiTable.load()->Mem.pfnGetAddressRange;
+        auto pfnGetAddressRange = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Mem.pfnGetAddressRange;
         if( nullptr == pfnGetAddressRange ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -8755,7 +8763,7 @@ zeMemGetAddressRange(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetAddressRange = ze_lib::context->zeDdiTable.load()->Mem.pfnGetAddressRange;
+    auto pfnGetAddressRange = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Mem.pfnGetAddressRange;
     if( nullptr == pfnGetAddressRange ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8815,7 +8823,7 @@ zeMemGetIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnMemGetIpcHandle_t pfnGetIpcHandle = [&result] {
-        auto pfnGetIpcHandle = ze_lib::context->zeDdiTable.load()->Mem.pfnGetIpcHandle;
+        auto pfnGetIpcHandle = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Mem.pfnGetIpcHandle;
         if( nullptr == pfnGetIpcHandle ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -8830,7 +8838,7 @@ zeMemGetIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetIpcHandle = ze_lib::context->zeDdiTable.load()->Mem.pfnGetIpcHandle;
+    auto pfnGetIpcHandle = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Mem.pfnGetIpcHandle;
     if( nullptr == pfnGetIpcHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8885,7 +8893,7 @@ zeMemGetIpcHandleFromFileDescriptorExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnMemGetIpcHandleFromFileDescriptorExp_t pfnGetIpcHandleFromFileDescriptorExp = [&result] {
-        auto pfnGetIpcHandleFromFileDescriptorExp = ze_lib::context->zeDdiTable.load()->MemExp.pfnGetIpcHandleFromFileDescriptorExp;
+        auto pfnGetIpcHandleFromFileDescriptorExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->MemExp.pfnGetIpcHandleFromFileDescriptorExp;
         if( nullptr == pfnGetIpcHandleFromFileDescriptorExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -8900,7 +8908,7 @@ zeMemGetIpcHandleFromFileDescriptorExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetIpcHandleFromFileDescriptorExp = ze_lib::context->zeDdiTable.load()->MemExp.pfnGetIpcHandleFromFileDescriptorExp;
+    auto pfnGetIpcHandleFromFileDescriptorExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->MemExp.pfnGetIpcHandleFromFileDescriptorExp;
     if( nullptr == pfnGetIpcHandleFromFileDescriptorExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8952,7 +8960,7 @@ zeMemGetFileDescriptorFromIpcHandleExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnMemGetFileDescriptorFromIpcHandleExp_t pfnGetFileDescriptorFromIpcHandleExp = [&result] {
-        auto pfnGetFileDescriptorFromIpcHandleExp = ze_lib::context->zeDdiTable.load()->MemExp.pfnGetFileDescriptorFromIpcHandleExp;
+        auto pfnGetFileDescriptorFromIpcHandleExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->MemExp.pfnGetFileDescriptorFromIpcHandleExp;
         if( nullptr == pfnGetFileDescriptorFromIpcHandleExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -8967,7 +8975,7 @@ zeMemGetFileDescriptorFromIpcHandleExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetFileDescriptorFromIpcHandleExp = ze_lib::context->zeDdiTable.load()->MemExp.pfnGetFileDescriptorFromIpcHandleExp;
+    auto pfnGetFileDescriptorFromIpcHandleExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->MemExp.pfnGetFileDescriptorFromIpcHandleExp;
     if( nullptr == pfnGetFileDescriptorFromIpcHandleExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9024,7 +9032,7 @@ zeMemPutIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnMemPutIpcHandle_t pfnPutIpcHandle = [&result] {
-        auto pfnPutIpcHandle = ze_lib::context->zeDdiTable.load()->Mem.pfnPutIpcHandle;
+        auto pfnPutIpcHandle = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Mem.pfnPutIpcHandle;
         if( nullptr == pfnPutIpcHandle ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -9039,7 +9047,7 @@ zeMemPutIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnPutIpcHandle = ze_lib::context->zeDdiTable.load()->Mem.pfnPutIpcHandle;
+    auto pfnPutIpcHandle = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Mem.pfnPutIpcHandle;
     if( nullptr == pfnPutIpcHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9122,7 +9130,7 @@ zeMemOpenIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnMemOpenIpcHandle_t pfnOpenIpcHandle = [&result] {
-        auto pfnOpenIpcHandle = ze_lib::context->zeDdiTable.load()->Mem.pfnOpenIpcHandle;
+        auto pfnOpenIpcHandle = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Mem.pfnOpenIpcHandle;
         if( nullptr == pfnOpenIpcHandle ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -9137,7 +9145,7 @@ zeMemOpenIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOpenIpcHandle = ze_lib::context->zeDdiTable.load()->Mem.pfnOpenIpcHandle;
+    auto pfnOpenIpcHandle = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Mem.pfnOpenIpcHandle;
     if( nullptr == pfnOpenIpcHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9189,7 +9197,7 @@ zeMemCloseIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnMemCloseIpcHandle_t pfnCloseIpcHandle = [&result] {
-        auto pfnCloseIpcHandle = ze_lib::context->zeDdiTable.load()->Mem.pfnCloseIpcHandle;
+        auto pfnCloseIpcHandle = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Mem.pfnCloseIpcHandle;
         if( nullptr == pfnCloseIpcHandle ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -9204,7 +9212,7 @@ zeMemCloseIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCloseIpcHandle = ze_lib::context->zeDdiTable.load()->Mem.pfnCloseIpcHandle;
+    auto pfnCloseIpcHandle = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Mem.pfnCloseIpcHandle;
     if( nullptr == pfnCloseIpcHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9277,7 +9285,7 @@ zeMemSetAtomicAccessAttributeExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnMemSetAtomicAccessAttributeExp_t pfnSetAtomicAccessAttributeExp = [&result] {
-        auto pfnSetAtomicAccessAttributeExp = ze_lib::context->zeDdiTable.load()->MemExp.pfnSetAtomicAccessAttributeExp;
+        auto pfnSetAtomicAccessAttributeExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->MemExp.pfnSetAtomicAccessAttributeExp;
         if( nullptr == pfnSetAtomicAccessAttributeExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -9292,7 +9300,7 @@ zeMemSetAtomicAccessAttributeExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetAtomicAccessAttributeExp = ze_lib::context->zeDdiTable.load()->MemExp.pfnSetAtomicAccessAttributeExp;
+    auto pfnSetAtomicAccessAttributeExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->MemExp.pfnSetAtomicAccessAttributeExp;
     if( nullptr == pfnSetAtomicAccessAttributeExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9348,7 +9356,7 @@ zeMemGetAtomicAccessAttributeExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnMemGetAtomicAccessAttributeExp_t pfnGetAtomicAccessAttributeExp = [&result] {
-        auto pfnGetAtomicAccessAttributeExp = ze_lib::context->zeDdiTable.load()->MemExp.pfnGetAtomicAccessAttributeExp;
+        auto pfnGetAtomicAccessAttributeExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->MemExp.pfnGetAtomicAccessAttributeExp;
         if( nullptr == pfnGetAtomicAccessAttributeExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -9363,7 +9371,7 @@ zeMemGetAtomicAccessAttributeExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetAtomicAccessAttributeExp = ze_lib::context->zeDdiTable.load()->MemExp.pfnGetAtomicAccessAttributeExp;
+    auto pfnGetAtomicAccessAttributeExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->MemExp.pfnGetAtomicAccessAttributeExp;
     if( nullptr == pfnGetAtomicAccessAttributeExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9434,7 +9442,7 @@ zeModuleCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnModuleCreate_t pfnCreate = [&result] {
-        auto pfnCreate = ze_lib::context->zeDdiTable.load()->Module.pfnCreate;
+        auto pfnCreate = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Module.pfnCreate;
         if( nullptr == pfnCreate ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -9449,7 +9457,7 @@ zeModuleCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.load()->Module.pfnCreate;
+    auto pfnCreate = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Module.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9503,7 +9511,7 @@ zeModuleDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnModuleDestroy_t pfnDestroy = [&result] {
-        auto pfnDestroy = ze_lib::context->zeDdiTable.load()->Module.pfnDestroy;
+        auto pfnDestroy = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Module.pfnDestroy;
         if( nullptr == pfnDestroy ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -9518,7 +9526,7 @@ zeModuleDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.load()->Module.pfnDestroy;
+    auto pfnDestroy = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Module.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9594,7 +9602,7 @@ zeModuleDynamicLink(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnModuleDynamicLink_t pfnDynamicLink = [&result] {
-        auto pfnDynamicLink = ze_lib::context->zeDdiTable.load()->Module.pfnDynamicLink;
+        auto pfnDynamicLink = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Module.pfnDynamicLink;
         if( nullptr == pfnDynamicLink ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -9609,7 +9617,7 @@ zeModuleDynamicLink(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDynamicLink = ze_lib::context->zeDdiTable.load()->Module.pfnDynamicLink;
+    auto pfnDynamicLink = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Module.pfnDynamicLink;
     if( nullptr == pfnDynamicLink ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9661,7 +9669,7 @@ zeModuleBuildLogDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnModuleBuildLogDestroy_t pfnDestroy = [&result] {
-        auto pfnDestroy = ze_lib::context->zeDdiTable.load()->ModuleBuildLog.pfnDestroy;
+        auto pfnDestroy = ze_lib::zeDdiTable.load(std::memory_order_acquire)->ModuleBuildLog.pfnDestroy;
         if( nullptr == pfnDestroy ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -9676,7 +9684,7 @@ zeModuleBuildLogDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.load()->ModuleBuildLog.pfnDestroy;
+    auto pfnDestroy = ze_lib::zeDdiTable.load(std::memory_order_acquire)->ModuleBuildLog.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9728,7 +9736,7 @@ zeModuleBuildLogGetString(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnModuleBuildLogGetString_t pfnGetString = [&result] {
-        auto pfnGetString = ze_lib::context->zeDdiTable.load()->ModuleBuildLog.pfnGetString;
+        auto pfnGetString = ze_lib::zeDdiTable.load(std::memory_order_acquire)->ModuleBuildLog.pfnGetString;
         if( nullptr == pfnGetString ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -9743,7 +9751,7 @@ zeModuleBuildLogGetString(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetString = ze_lib::context->zeDdiTable.load()->ModuleBuildLog.pfnGetString;
+    auto pfnGetString = ze_lib::zeDdiTable.load(std::memory_order_acquire)->ModuleBuildLog.pfnGetString;
     if( nullptr == pfnGetString ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9801,7 +9809,7 @@ zeModuleGetNativeBinary(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnModuleGetNativeBinary_t pfnGetNativeBinary = [&result] {
-        auto pfnGetNativeBinary = ze_lib::context->zeDdiTable.load()->Module.pfnGetNativeBinary;
+        auto pfnGetNativeBinary = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Module.pfnGetNativeBinary;
         if( nullptr == pfnGetNativeBinary ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -9816,7 +9824,7 @@ zeModuleGetNativeBinary(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetNativeBinary = ze_lib::context->zeDdiTable.load()->Module.pfnGetNativeBinary;
+    auto pfnGetNativeBinary = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Module.pfnGetNativeBinary;
     if( nullptr == pfnGetNativeBinary ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9872,7 +9880,7 @@ zeModuleGetGlobalPointer(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnModuleGetGlobalPointer_t pfnGetGlobalPointer = [&result] {
-        auto pfnGetGlobalPointer = ze_lib::context->zeDdiTable.load()->Module.pfnGetGlobalPointer;
+        auto pfnGetGlobalPointer = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Module.pfnGetGlobalPointer;
         if( nullptr == pfnGetGlobalPointer ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -9887,7 +9895,7 @@ zeModuleGetGlobalPointer(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetGlobalPointer = ze_lib::context->zeDdiTable.load()->Module.pfnGetGlobalPointer;
+    auto pfnGetGlobalPointer = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Module.pfnGetGlobalPointer;
     if( nullptr == pfnGetGlobalPointer ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9943,7 +9951,7 @@ zeModuleGetKernelNames(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnModuleGetKernelNames_t pfnGetKernelNames = [&result] {
-        auto pfnGetKernelNames = ze_lib::context->zeDdiTable.load()->Module.pfnGetKernelNames;
+        auto pfnGetKernelNames = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Module.pfnGetKernelNames;
         if( nullptr == pfnGetKernelNames ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -9958,7 +9966,7 @@ zeModuleGetKernelNames(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetKernelNames = ze_lib::context->zeDdiTable.load()->Module.pfnGetKernelNames;
+    auto pfnGetKernelNames = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Module.pfnGetKernelNames;
     if( nullptr == pfnGetKernelNames ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10007,7 +10015,7 @@ zeModuleGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnModuleGetProperties_t pfnGetProperties = [&result] {
-        auto pfnGetProperties = ze_lib::context->zeDdiTable.load()->Module.pfnGetProperties;
+        auto pfnGetProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Module.pfnGetProperties;
         if( nullptr == pfnGetProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -10022,7 +10030,7 @@ zeModuleGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zeDdiTable.load()->Module.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Module.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10081,7 +10089,7 @@ zeKernelCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnKernelCreate_t pfnCreate = [&result] {
-        auto pfnCreate = ze_lib::context->zeDdiTable.load()->Kernel.pfnCreate;
+        auto pfnCreate = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Kernel.pfnCreate;
         if( nullptr == pfnCreate ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -10096,7 +10104,7 @@ zeKernelCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.load()->Kernel.pfnCreate;
+    auto pfnCreate = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Kernel.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10148,7 +10156,7 @@ zeKernelDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnKernelDestroy_t pfnDestroy = [&result] {
-        auto pfnDestroy = ze_lib::context->zeDdiTable.load()->Kernel.pfnDestroy;
+        auto pfnDestroy = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Kernel.pfnDestroy;
         if( nullptr == pfnDestroy ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -10163,7 +10171,7 @@ zeKernelDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.load()->Kernel.pfnDestroy;
+    auto pfnDestroy = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Kernel.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10220,7 +10228,7 @@ zeModuleGetFunctionPointer(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnModuleGetFunctionPointer_t pfnGetFunctionPointer = [&result] {
-        auto pfnGetFunctionPointer = ze_lib::context->zeDdiTable.load()->Module.pfnGetFunctionPointer;
+        auto pfnGetFunctionPointer = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Module.pfnGetFunctionPointer;
         if( nullptr == pfnGetFunctionPointer ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -10235,7 +10243,7 @@ zeModuleGetFunctionPointer(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetFunctionPointer = ze_lib::context->zeDdiTable.load()->Module.pfnGetFunctionPointer;
+    auto pfnGetFunctionPointer = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Module.pfnGetFunctionPointer;
     if( nullptr == pfnGetFunctionPointer ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10288,7 +10296,7 @@ zeKernelSetGroupSize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnKernelSetGroupSize_t pfnSetGroupSize = [&result] {
-        auto pfnSetGroupSize = ze_lib::context->zeDdiTable.load()->Kernel.pfnSetGroupSize;
+        auto pfnSetGroupSize = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Kernel.pfnSetGroupSize;
         if( nullptr == pfnSetGroupSize ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -10303,7 +10311,7 @@ zeKernelSetGroupSize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetGroupSize = ze_lib::context->zeDdiTable.load()->Kernel.pfnSetGroupSize;
+    auto pfnSetGroupSize = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Kernel.pfnSetGroupSize;
     if( nullptr == pfnSetGroupSize ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10363,7 +10371,7 @@ zeKernelSuggestGroupSize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnKernelSuggestGroupSize_t pfnSuggestGroupSize = [&result] {
-        auto pfnSuggestGroupSize = ze_lib::context->zeDdiTable.load()->Kernel.pfnSuggestGroupSize;
+        auto pfnSuggestGroupSize = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Kernel.pfnSuggestGroupSize;
         if( nullptr == pfnSuggestGroupSize ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -10378,7 +10386,7 @@ zeKernelSuggestGroupSize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSuggestGroupSize = ze_lib::context->zeDdiTable.load()->Kernel.pfnSuggestGroupSize;
+    auto pfnSuggestGroupSize = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Kernel.pfnSuggestGroupSize;
     if( nullptr == pfnSuggestGroupSize ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10431,7 +10439,7 @@ zeKernelSuggestMaxCooperativeGroupCount(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnKernelSuggestMaxCooperativeGroupCount_t pfnSuggestMaxCooperativeGroupCount = [&result] {
-        auto pfnSuggestMaxCooperativeGroupCount = ze_lib::context->zeDdiTable.load()->Kernel.pfnSuggestMaxCooperativeGroupCount;
+        auto pfnSuggestMaxCooperativeGroupCount = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Kernel.pfnSuggestMaxCooperativeGroupCount;
         if( nullptr == pfnSuggestMaxCooperativeGroupCount ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -10446,7 +10454,7 @@ zeKernelSuggestMaxCooperativeGroupCount(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSuggestMaxCooperativeGroupCount = ze_lib::context->zeDdiTable.load()->Kernel.pfnSuggestMaxCooperativeGroupCount;
+    auto pfnSuggestMaxCooperativeGroupCount = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Kernel.pfnSuggestMaxCooperativeGroupCount;
     if( nullptr == pfnSuggestMaxCooperativeGroupCount ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10504,7 +10512,7 @@ zeKernelSetArgumentValue(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnKernelSetArgumentValue_t pfnSetArgumentValue = [&result] {
-        auto pfnSetArgumentValue = ze_lib::context->zeDdiTable.load()->Kernel.pfnSetArgumentValue;
+        auto pfnSetArgumentValue = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Kernel.pfnSetArgumentValue;
         if( nullptr == pfnSetArgumentValue ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -10519,7 +10527,7 @@ zeKernelSetArgumentValue(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetArgumentValue = ze_lib::context->zeDdiTable.load()->Kernel.pfnSetArgumentValue;
+    auto pfnSetArgumentValue = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Kernel.pfnSetArgumentValue;
     if( nullptr == pfnSetArgumentValue ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10573,7 +10581,7 @@ zeKernelSetIndirectAccess(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnKernelSetIndirectAccess_t pfnSetIndirectAccess = [&result] {
-        auto pfnSetIndirectAccess = ze_lib::context->zeDdiTable.load()->Kernel.pfnSetIndirectAccess;
+        auto pfnSetIndirectAccess = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Kernel.pfnSetIndirectAccess;
         if( nullptr == pfnSetIndirectAccess ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -10588,7 +10596,7 @@ zeKernelSetIndirectAccess(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetIndirectAccess = ze_lib::context->zeDdiTable.load()->Kernel.pfnSetIndirectAccess;
+    auto pfnSetIndirectAccess = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Kernel.pfnSetIndirectAccess;
     if( nullptr == pfnSetIndirectAccess ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10638,7 +10646,7 @@ zeKernelGetIndirectAccess(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnKernelGetIndirectAccess_t pfnGetIndirectAccess = [&result] {
-        auto pfnGetIndirectAccess = ze_lib::context->zeDdiTable.load()->Kernel.pfnGetIndirectAccess;
+        auto pfnGetIndirectAccess = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Kernel.pfnGetIndirectAccess;
         if( nullptr == pfnGetIndirectAccess ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -10653,7 +10661,7 @@ zeKernelGetIndirectAccess(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetIndirectAccess = ze_lib::context->zeDdiTable.load()->Kernel.pfnGetIndirectAccess;
+    auto pfnGetIndirectAccess = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Kernel.pfnGetIndirectAccess;
     if( nullptr == pfnGetIndirectAccess ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10716,7 +10724,7 @@ zeKernelGetSourceAttributes(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnKernelGetSourceAttributes_t pfnGetSourceAttributes = [&result] {
-        auto pfnGetSourceAttributes = ze_lib::context->zeDdiTable.load()->Kernel.pfnGetSourceAttributes;
+        auto pfnGetSourceAttributes = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Kernel.pfnGetSourceAttributes;
         if( nullptr == pfnGetSourceAttributes ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -10731,7 +10739,7 @@ zeKernelGetSourceAttributes(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetSourceAttributes = ze_lib::context->zeDdiTable.load()->Kernel.pfnGetSourceAttributes;
+    auto pfnGetSourceAttributes = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Kernel.pfnGetSourceAttributes;
     if( nullptr == pfnGetSourceAttributes ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10785,7 +10793,7 @@ zeKernelSetCacheConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnKernelSetCacheConfig_t pfnSetCacheConfig = [&result] {
-        auto pfnSetCacheConfig = ze_lib::context->zeDdiTable.load()->Kernel.pfnSetCacheConfig;
+        auto pfnSetCacheConfig = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Kernel.pfnSetCacheConfig;
         if( nullptr == pfnSetCacheConfig ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -10800,7 +10808,7 @@ zeKernelSetCacheConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetCacheConfig = ze_lib::context->zeDdiTable.load()->Kernel.pfnSetCacheConfig;
+    auto pfnSetCacheConfig = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Kernel.pfnSetCacheConfig;
     if( nullptr == pfnSetCacheConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10849,7 +10857,7 @@ zeKernelGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnKernelGetProperties_t pfnGetProperties = [&result] {
-        auto pfnGetProperties = ze_lib::context->zeDdiTable.load()->Kernel.pfnGetProperties;
+        auto pfnGetProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Kernel.pfnGetProperties;
         if( nullptr == pfnGetProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -10864,7 +10872,7 @@ zeKernelGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zeDdiTable.load()->Kernel.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Kernel.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10918,7 +10926,7 @@ zeKernelGetName(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnKernelGetName_t pfnGetName = [&result] {
-        auto pfnGetName = ze_lib::context->zeDdiTable.load()->Kernel.pfnGetName;
+        auto pfnGetName = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Kernel.pfnGetName;
         if( nullptr == pfnGetName ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -10933,7 +10941,7 @@ zeKernelGetName(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetName = ze_lib::context->zeDdiTable.load()->Kernel.pfnGetName;
+    auto pfnGetName = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Kernel.pfnGetName;
     if( nullptr == pfnGetName ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10999,7 +11007,7 @@ zeCommandListAppendLaunchKernel(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendLaunchKernel_t pfnAppendLaunchKernel = [&result] {
-        auto pfnAppendLaunchKernel = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendLaunchKernel;
+        auto pfnAppendLaunchKernel = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendLaunchKernel;
         if( nullptr == pfnAppendLaunchKernel ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -11014,7 +11022,7 @@ zeCommandListAppendLaunchKernel(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendLaunchKernel = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendLaunchKernel;
+    auto pfnAppendLaunchKernel = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendLaunchKernel;
     if( nullptr == pfnAppendLaunchKernel ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -11089,7 +11097,7 @@ zeCommandListAppendLaunchKernelWithParameters(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendLaunchKernelWithParameters_t pfnAppendLaunchKernelWithParameters = [&result] {
-        auto pfnAppendLaunchKernelWithParameters = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendLaunchKernelWithParameters;
+        auto pfnAppendLaunchKernelWithParameters = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendLaunchKernelWithParameters;
         if( nullptr == pfnAppendLaunchKernelWithParameters ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -11104,7 +11112,7 @@ zeCommandListAppendLaunchKernelWithParameters(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendLaunchKernelWithParameters = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendLaunchKernelWithParameters;
+    auto pfnAppendLaunchKernelWithParameters = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendLaunchKernelWithParameters;
     if( nullptr == pfnAppendLaunchKernelWithParameters ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -11181,7 +11189,7 @@ zeCommandListAppendLaunchKernelWithArguments(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendLaunchKernelWithArguments_t pfnAppendLaunchKernelWithArguments = [&result] {
-        auto pfnAppendLaunchKernelWithArguments = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendLaunchKernelWithArguments;
+        auto pfnAppendLaunchKernelWithArguments = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendLaunchKernelWithArguments;
         if( nullptr == pfnAppendLaunchKernelWithArguments ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -11196,7 +11204,7 @@ zeCommandListAppendLaunchKernelWithArguments(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendLaunchKernelWithArguments = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendLaunchKernelWithArguments;
+    auto pfnAppendLaunchKernelWithArguments = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendLaunchKernelWithArguments;
     if( nullptr == pfnAppendLaunchKernelWithArguments ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -11266,7 +11274,7 @@ zeCommandListAppendLaunchCooperativeKernel(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendLaunchCooperativeKernel_t pfnAppendLaunchCooperativeKernel = [&result] {
-        auto pfnAppendLaunchCooperativeKernel = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendLaunchCooperativeKernel;
+        auto pfnAppendLaunchCooperativeKernel = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendLaunchCooperativeKernel;
         if( nullptr == pfnAppendLaunchCooperativeKernel ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -11281,7 +11289,7 @@ zeCommandListAppendLaunchCooperativeKernel(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendLaunchCooperativeKernel = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendLaunchCooperativeKernel;
+    auto pfnAppendLaunchCooperativeKernel = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendLaunchCooperativeKernel;
     if( nullptr == pfnAppendLaunchCooperativeKernel ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -11353,7 +11361,7 @@ zeCommandListAppendLaunchKernelIndirect(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendLaunchKernelIndirect_t pfnAppendLaunchKernelIndirect = [&result] {
-        auto pfnAppendLaunchKernelIndirect = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendLaunchKernelIndirect;
+        auto pfnAppendLaunchKernelIndirect = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendLaunchKernelIndirect;
         if( nullptr == pfnAppendLaunchKernelIndirect ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -11368,7 +11376,7 @@ zeCommandListAppendLaunchKernelIndirect(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendLaunchKernelIndirect = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendLaunchKernelIndirect;
+    auto pfnAppendLaunchKernelIndirect = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendLaunchKernelIndirect;
     if( nullptr == pfnAppendLaunchKernelIndirect ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -11447,7 +11455,7 @@ zeCommandListAppendLaunchMultipleKernelsIndirect(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendLaunchMultipleKernelsIndirect_t pfnAppendLaunchMultipleKernelsIndirect = [&result] {
-        auto pfnAppendLaunchMultipleKernelsIndirect = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendLaunchMultipleKernelsIndirect;
+        auto pfnAppendLaunchMultipleKernelsIndirect = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendLaunchMultipleKernelsIndirect;
         if( nullptr == pfnAppendLaunchMultipleKernelsIndirect ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -11462,7 +11470,7 @@ zeCommandListAppendLaunchMultipleKernelsIndirect(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendLaunchMultipleKernelsIndirect = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendLaunchMultipleKernelsIndirect;
+    auto pfnAppendLaunchMultipleKernelsIndirect = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendLaunchMultipleKernelsIndirect;
     if( nullptr == pfnAppendLaunchMultipleKernelsIndirect ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -11517,7 +11525,7 @@ zeContextMakeMemoryResident(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnContextMakeMemoryResident_t pfnMakeMemoryResident = [&result] {
-        auto pfnMakeMemoryResident = ze_lib::context->zeDdiTable.load()->Context.pfnMakeMemoryResident;
+        auto pfnMakeMemoryResident = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Context.pfnMakeMemoryResident;
         if( nullptr == pfnMakeMemoryResident ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -11532,7 +11540,7 @@ zeContextMakeMemoryResident(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnMakeMemoryResident = ze_lib::context->zeDdiTable.load()->Context.pfnMakeMemoryResident;
+    auto pfnMakeMemoryResident = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Context.pfnMakeMemoryResident;
     if( nullptr == pfnMakeMemoryResident ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -11588,7 +11596,7 @@ zeContextEvictMemory(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnContextEvictMemory_t pfnEvictMemory = [&result] {
-        auto pfnEvictMemory = ze_lib::context->zeDdiTable.load()->Context.pfnEvictMemory;
+        auto pfnEvictMemory = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Context.pfnEvictMemory;
         if( nullptr == pfnEvictMemory ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -11603,7 +11611,7 @@ zeContextEvictMemory(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEvictMemory = ze_lib::context->zeDdiTable.load()->Context.pfnEvictMemory;
+    auto pfnEvictMemory = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Context.pfnEvictMemory;
     if( nullptr == pfnEvictMemory ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -11655,7 +11663,7 @@ zeContextMakeImageResident(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnContextMakeImageResident_t pfnMakeImageResident = [&result] {
-        auto pfnMakeImageResident = ze_lib::context->zeDdiTable.load()->Context.pfnMakeImageResident;
+        auto pfnMakeImageResident = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Context.pfnMakeImageResident;
         if( nullptr == pfnMakeImageResident ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -11670,7 +11678,7 @@ zeContextMakeImageResident(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnMakeImageResident = ze_lib::context->zeDdiTable.load()->Context.pfnMakeImageResident;
+    auto pfnMakeImageResident = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Context.pfnMakeImageResident;
     if( nullptr == pfnMakeImageResident ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -11724,7 +11732,7 @@ zeContextEvictImage(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnContextEvictImage_t pfnEvictImage = [&result] {
-        auto pfnEvictImage = ze_lib::context->zeDdiTable.load()->Context.pfnEvictImage;
+        auto pfnEvictImage = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Context.pfnEvictImage;
         if( nullptr == pfnEvictImage ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -11739,7 +11747,7 @@ zeContextEvictImage(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEvictImage = ze_lib::context->zeDdiTable.load()->Context.pfnEvictImage;
+    auto pfnEvictImage = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Context.pfnEvictImage;
     if( nullptr == pfnEvictImage ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -11798,7 +11806,7 @@ zeSamplerCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnSamplerCreate_t pfnCreate = [&result] {
-        auto pfnCreate = ze_lib::context->zeDdiTable.load()->Sampler.pfnCreate;
+        auto pfnCreate = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Sampler.pfnCreate;
         if( nullptr == pfnCreate ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -11813,7 +11821,7 @@ zeSamplerCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.load()->Sampler.pfnCreate;
+    auto pfnCreate = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Sampler.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -11865,7 +11873,7 @@ zeSamplerDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnSamplerDestroy_t pfnDestroy = [&result] {
-        auto pfnDestroy = ze_lib::context->zeDdiTable.load()->Sampler.pfnDestroy;
+        auto pfnDestroy = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Sampler.pfnDestroy;
         if( nullptr == pfnDestroy ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -11880,7 +11888,7 @@ zeSamplerDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.load()->Sampler.pfnDestroy;
+    auto pfnDestroy = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Sampler.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -11943,7 +11951,7 @@ zeVirtualMemReserve(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnVirtualMemReserve_t pfnReserve = [&result] {
-        auto pfnReserve = ze_lib::context->zeDdiTable.load()->VirtualMem.pfnReserve;
+        auto pfnReserve = ze_lib::zeDdiTable.load(std::memory_order_acquire)->VirtualMem.pfnReserve;
         if( nullptr == pfnReserve ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -11958,7 +11966,7 @@ zeVirtualMemReserve(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReserve = ze_lib::context->zeDdiTable.load()->VirtualMem.pfnReserve;
+    auto pfnReserve = ze_lib::zeDdiTable.load(std::memory_order_acquire)->VirtualMem.pfnReserve;
     if( nullptr == pfnReserve ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -12014,7 +12022,7 @@ zeVirtualMemFree(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnVirtualMemFree_t pfnFree = [&result] {
-        auto pfnFree = ze_lib::context->zeDdiTable.load()->VirtualMem.pfnFree;
+        auto pfnFree = ze_lib::zeDdiTable.load(std::memory_order_acquire)->VirtualMem.pfnFree;
         if( nullptr == pfnFree ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -12029,7 +12037,7 @@ zeVirtualMemFree(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnFree = ze_lib::context->zeDdiTable.load()->VirtualMem.pfnFree;
+    auto pfnFree = ze_lib::zeDdiTable.load(std::memory_order_acquire)->VirtualMem.pfnFree;
     if( nullptr == pfnFree ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -12085,7 +12093,7 @@ zeVirtualMemQueryPageSize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnVirtualMemQueryPageSize_t pfnQueryPageSize = [&result] {
-        auto pfnQueryPageSize = ze_lib::context->zeDdiTable.load()->VirtualMem.pfnQueryPageSize;
+        auto pfnQueryPageSize = ze_lib::zeDdiTable.load(std::memory_order_acquire)->VirtualMem.pfnQueryPageSize;
         if( nullptr == pfnQueryPageSize ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -12100,7 +12108,7 @@ zeVirtualMemQueryPageSize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnQueryPageSize = ze_lib::context->zeDdiTable.load()->VirtualMem.pfnQueryPageSize;
+    auto pfnQueryPageSize = ze_lib::zeDdiTable.load(std::memory_order_acquire)->VirtualMem.pfnQueryPageSize;
     if( nullptr == pfnQueryPageSize ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -12153,7 +12161,7 @@ zePhysicalMemGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnPhysicalMemGetProperties_t pfnGetProperties = [&result] {
-        auto pfnGetProperties = ze_lib::context->zeDdiTable.load()->PhysicalMem.pfnGetProperties;
+        auto pfnGetProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->PhysicalMem.pfnGetProperties;
         if( nullptr == pfnGetProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -12168,7 +12176,7 @@ zePhysicalMemGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zeDdiTable.load()->PhysicalMem.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->PhysicalMem.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -12233,7 +12241,7 @@ zePhysicalMemCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnPhysicalMemCreate_t pfnCreate = [&result] {
-        auto pfnCreate = ze_lib::context->zeDdiTable.load()->PhysicalMem.pfnCreate;
+        auto pfnCreate = ze_lib::zeDdiTable.load(std::memory_order_acquire)->PhysicalMem.pfnCreate;
         if( nullptr == pfnCreate ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -12248,7 +12256,7 @@ zePhysicalMemCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.load()->PhysicalMem.pfnCreate;
+    auto pfnCreate = ze_lib::zeDdiTable.load(std::memory_order_acquire)->PhysicalMem.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -12300,7 +12308,7 @@ zePhysicalMemDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnPhysicalMemDestroy_t pfnDestroy = [&result] {
-        auto pfnDestroy = ze_lib::context->zeDdiTable.load()->PhysicalMem.pfnDestroy;
+        auto pfnDestroy = ze_lib::zeDdiTable.load(std::memory_order_acquire)->PhysicalMem.pfnDestroy;
         if( nullptr == pfnDestroy ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -12315,7 +12323,7 @@ zePhysicalMemDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.load()->PhysicalMem.pfnDestroy;
+    auto pfnDestroy = ze_lib::zeDdiTable.load(std::memory_order_acquire)->PhysicalMem.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -12387,7 +12395,7 @@ zeVirtualMemMap(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnVirtualMemMap_t pfnMap = [&result] {
-        auto pfnMap = ze_lib::context->zeDdiTable.load()->VirtualMem.pfnMap;
+        auto pfnMap = ze_lib::zeDdiTable.load(std::memory_order_acquire)->VirtualMem.pfnMap;
         if( nullptr == pfnMap ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -12402,7 +12410,7 @@ zeVirtualMemMap(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnMap = ze_lib::context->zeDdiTable.load()->VirtualMem.pfnMap;
+    auto pfnMap = ze_lib::zeDdiTable.load(std::memory_order_acquire)->VirtualMem.pfnMap;
     if( nullptr == pfnMap ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -12460,7 +12468,7 @@ zeVirtualMemUnmap(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnVirtualMemUnmap_t pfnUnmap = [&result] {
-        auto pfnUnmap = ze_lib::context->zeDdiTable.load()->VirtualMem.pfnUnmap;
+        auto pfnUnmap = ze_lib::zeDdiTable.load(std::memory_order_acquire)->VirtualMem.pfnUnmap;
         if( nullptr == pfnUnmap ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -12475,7 +12483,7 @@ zeVirtualMemUnmap(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnUnmap = ze_lib::context->zeDdiTable.load()->VirtualMem.pfnUnmap;
+    auto pfnUnmap = ze_lib::zeDdiTable.load(std::memory_order_acquire)->VirtualMem.pfnUnmap;
     if( nullptr == pfnUnmap ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -12536,7 +12544,7 @@ zeVirtualMemSetAccessAttribute(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnVirtualMemSetAccessAttribute_t pfnSetAccessAttribute = [&result] {
-        auto pfnSetAccessAttribute = ze_lib::context->zeDdiTable.load()->VirtualMem.pfnSetAccessAttribute;
+        auto pfnSetAccessAttribute = ze_lib::zeDdiTable.load(std::memory_order_acquire)->VirtualMem.pfnSetAccessAttribute;
         if( nullptr == pfnSetAccessAttribute ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -12551,7 +12559,7 @@ zeVirtualMemSetAccessAttribute(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetAccessAttribute = ze_lib::context->zeDdiTable.load()->VirtualMem.pfnSetAccessAttribute;
+    auto pfnSetAccessAttribute = ze_lib::zeDdiTable.load(std::memory_order_acquire)->VirtualMem.pfnSetAccessAttribute;
     if( nullptr == pfnSetAccessAttribute ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -12614,7 +12622,7 @@ zeVirtualMemGetAccessAttribute(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnVirtualMemGetAccessAttribute_t pfnGetAccessAttribute = [&result] {
-        auto pfnGetAccessAttribute = ze_lib::context->zeDdiTable.load()->VirtualMem.pfnGetAccessAttribute;
+        auto pfnGetAccessAttribute = ze_lib::zeDdiTable.load(std::memory_order_acquire)->VirtualMem.pfnGetAccessAttribute;
         if( nullptr == pfnGetAccessAttribute ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -12629,7 +12637,7 @@ zeVirtualMemGetAccessAttribute(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetAccessAttribute = ze_lib::context->zeDdiTable.load()->VirtualMem.pfnGetAccessAttribute;
+    auto pfnGetAccessAttribute = ze_lib::zeDdiTable.load(std::memory_order_acquire)->VirtualMem.pfnGetAccessAttribute;
     if( nullptr == pfnGetAccessAttribute ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -12681,7 +12689,7 @@ zeKernelSetGlobalOffsetExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnKernelSetGlobalOffsetExp_t pfnSetGlobalOffsetExp = [&result] {
-        auto pfnSetGlobalOffsetExp = ze_lib::context->zeDdiTable.load()->KernelExp.pfnSetGlobalOffsetExp;
+        auto pfnSetGlobalOffsetExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->KernelExp.pfnSetGlobalOffsetExp;
         if( nullptr == pfnSetGlobalOffsetExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -12696,7 +12704,7 @@ zeKernelSetGlobalOffsetExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetGlobalOffsetExp = ze_lib::context->zeDdiTable.load()->KernelExp.pfnSetGlobalOffsetExp;
+    auto pfnSetGlobalOffsetExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->KernelExp.pfnSetGlobalOffsetExp;
     if( nullptr == pfnSetGlobalOffsetExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -12751,7 +12759,7 @@ zeDeviceReserveCacheExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDeviceReserveCacheExt_t pfnReserveCacheExt = [&result] {
-        auto pfnReserveCacheExt = ze_lib::context->zeDdiTable.load()->Device.pfnReserveCacheExt;
+        auto pfnReserveCacheExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnReserveCacheExt;
         if( nullptr == pfnReserveCacheExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -12766,7 +12774,7 @@ zeDeviceReserveCacheExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReserveCacheExt = ze_lib::context->zeDdiTable.load()->Device.pfnReserveCacheExt;
+    auto pfnReserveCacheExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnReserveCacheExt;
     if( nullptr == pfnReserveCacheExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -12820,7 +12828,7 @@ zeDeviceSetCacheAdviceExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDeviceSetCacheAdviceExt_t pfnSetCacheAdviceExt = [&result] {
-        auto pfnSetCacheAdviceExt = ze_lib::context->zeDdiTable.load()->Device.pfnSetCacheAdviceExt;
+        auto pfnSetCacheAdviceExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnSetCacheAdviceExt;
         if( nullptr == pfnSetCacheAdviceExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -12835,7 +12843,7 @@ zeDeviceSetCacheAdviceExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetCacheAdviceExt = ze_lib::context->zeDdiTable.load()->Device.pfnSetCacheAdviceExt;
+    auto pfnSetCacheAdviceExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnSetCacheAdviceExt;
     if( nullptr == pfnSetCacheAdviceExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -12905,7 +12913,7 @@ zeEventQueryTimestampsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnEventQueryTimestampsExp_t pfnQueryTimestampsExp = [&result] {
-        auto pfnQueryTimestampsExp = ze_lib::context->zeDdiTable.load()->EventExp.pfnQueryTimestampsExp;
+        auto pfnQueryTimestampsExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->EventExp.pfnQueryTimestampsExp;
         if( nullptr == pfnQueryTimestampsExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -12920,7 +12928,7 @@ zeEventQueryTimestampsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnQueryTimestampsExp = ze_lib::context->zeDdiTable.load()->EventExp.pfnQueryTimestampsExp;
+    auto pfnQueryTimestampsExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->EventExp.pfnQueryTimestampsExp;
     if( nullptr == pfnQueryTimestampsExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -12975,7 +12983,7 @@ zeImageGetMemoryPropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnImageGetMemoryPropertiesExp_t pfnGetMemoryPropertiesExp = [&result] {
-        auto pfnGetMemoryPropertiesExp = ze_lib::context->zeDdiTable.load()->ImageExp.pfnGetMemoryPropertiesExp;
+        auto pfnGetMemoryPropertiesExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->ImageExp.pfnGetMemoryPropertiesExp;
         if( nullptr == pfnGetMemoryPropertiesExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -12990,7 +12998,7 @@ zeImageGetMemoryPropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetMemoryPropertiesExp = ze_lib::context->zeDdiTable.load()->ImageExp.pfnGetMemoryPropertiesExp;
+    auto pfnGetMemoryPropertiesExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->ImageExp.pfnGetMemoryPropertiesExp;
     if( nullptr == pfnGetMemoryPropertiesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -13063,7 +13071,7 @@ zeImageViewCreateExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnImageViewCreateExt_t pfnViewCreateExt = [&result] {
-        auto pfnViewCreateExt = ze_lib::context->zeDdiTable.load()->Image.pfnViewCreateExt;
+        auto pfnViewCreateExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Image.pfnViewCreateExt;
         if( nullptr == pfnViewCreateExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -13078,7 +13086,7 @@ zeImageViewCreateExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnViewCreateExt = ze_lib::context->zeDdiTable.load()->Image.pfnViewCreateExt;
+    auto pfnViewCreateExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Image.pfnViewCreateExt;
     if( nullptr == pfnViewCreateExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -13153,7 +13161,7 @@ zeImageViewCreateExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnImageViewCreateExp_t pfnViewCreateExp = [&result] {
-        auto pfnViewCreateExp = ze_lib::context->zeDdiTable.load()->ImageExp.pfnViewCreateExp;
+        auto pfnViewCreateExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->ImageExp.pfnViewCreateExp;
         if( nullptr == pfnViewCreateExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -13168,7 +13176,7 @@ zeImageViewCreateExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnViewCreateExp = ze_lib::context->zeDdiTable.load()->ImageExp.pfnViewCreateExp;
+    auto pfnViewCreateExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->ImageExp.pfnViewCreateExp;
     if( nullptr == pfnViewCreateExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -13227,7 +13235,7 @@ zeKernelSchedulingHintExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnKernelSchedulingHintExp_t pfnSchedulingHintExp = [&result] {
-        auto pfnSchedulingHintExp = ze_lib::context->zeDdiTable.load()->KernelExp.pfnSchedulingHintExp;
+        auto pfnSchedulingHintExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->KernelExp.pfnSchedulingHintExp;
         if( nullptr == pfnSchedulingHintExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -13242,7 +13250,7 @@ zeKernelSchedulingHintExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSchedulingHintExp = ze_lib::context->zeDdiTable.load()->KernelExp.pfnSchedulingHintExp;
+    auto pfnSchedulingHintExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->KernelExp.pfnSchedulingHintExp;
     if( nullptr == pfnSchedulingHintExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -13295,7 +13303,7 @@ zeDevicePciGetPropertiesExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDevicePciGetPropertiesExt_t pfnPciGetPropertiesExt = [&result] {
-        auto pfnPciGetPropertiesExt = ze_lib::context->zeDdiTable.load()->Device.pfnPciGetPropertiesExt;
+        auto pfnPciGetPropertiesExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnPciGetPropertiesExt;
         if( nullptr == pfnPciGetPropertiesExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -13310,7 +13318,7 @@ zeDevicePciGetPropertiesExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnPciGetPropertiesExt = ze_lib::context->zeDdiTable.load()->Device.pfnPciGetPropertiesExt;
+    auto pfnPciGetPropertiesExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnPciGetPropertiesExt;
     if( nullptr == pfnPciGetPropertiesExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -13400,7 +13408,7 @@ zeCommandListAppendImageCopyToMemoryExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendImageCopyToMemoryExt_t pfnAppendImageCopyToMemoryExt = [&result] {
-        auto pfnAppendImageCopyToMemoryExt = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendImageCopyToMemoryExt;
+        auto pfnAppendImageCopyToMemoryExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendImageCopyToMemoryExt;
         if( nullptr == pfnAppendImageCopyToMemoryExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -13415,7 +13423,7 @@ zeCommandListAppendImageCopyToMemoryExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendImageCopyToMemoryExt = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendImageCopyToMemoryExt;
+    auto pfnAppendImageCopyToMemoryExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendImageCopyToMemoryExt;
     if( nullptr == pfnAppendImageCopyToMemoryExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -13505,7 +13513,7 @@ zeCommandListAppendImageCopyFromMemoryExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendImageCopyFromMemoryExt_t pfnAppendImageCopyFromMemoryExt = [&result] {
-        auto pfnAppendImageCopyFromMemoryExt = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendImageCopyFromMemoryExt;
+        auto pfnAppendImageCopyFromMemoryExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendImageCopyFromMemoryExt;
         if( nullptr == pfnAppendImageCopyFromMemoryExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -13520,7 +13528,7 @@ zeCommandListAppendImageCopyFromMemoryExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendImageCopyFromMemoryExt = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendImageCopyFromMemoryExt;
+    auto pfnAppendImageCopyFromMemoryExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendImageCopyFromMemoryExt;
     if( nullptr == pfnAppendImageCopyFromMemoryExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -13570,7 +13578,7 @@ zeImageGetAllocPropertiesExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnImageGetAllocPropertiesExt_t pfnGetAllocPropertiesExt = [&result] {
-        auto pfnGetAllocPropertiesExt = ze_lib::context->zeDdiTable.load()->Image.pfnGetAllocPropertiesExt;
+        auto pfnGetAllocPropertiesExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Image.pfnGetAllocPropertiesExt;
         if( nullptr == pfnGetAllocPropertiesExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -13585,7 +13593,7 @@ zeImageGetAllocPropertiesExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetAllocPropertiesExt = ze_lib::context->zeDdiTable.load()->Image.pfnGetAllocPropertiesExt;
+    auto pfnGetAllocPropertiesExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Image.pfnGetAllocPropertiesExt;
     if( nullptr == pfnGetAllocPropertiesExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -13645,7 +13653,7 @@ zeModuleInspectLinkageExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnModuleInspectLinkageExt_t pfnInspectLinkageExt = [&result] {
-        auto pfnInspectLinkageExt = ze_lib::context->zeDdiTable.load()->Module.pfnInspectLinkageExt;
+        auto pfnInspectLinkageExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Module.pfnInspectLinkageExt;
         if( nullptr == pfnInspectLinkageExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -13660,7 +13668,7 @@ zeModuleInspectLinkageExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnInspectLinkageExt = ze_lib::context->zeDdiTable.load()->Module.pfnInspectLinkageExt;
+    auto pfnInspectLinkageExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Module.pfnInspectLinkageExt;
     if( nullptr == pfnInspectLinkageExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -13719,7 +13727,7 @@ zeMemFreeExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnMemFreeExt_t pfnFreeExt = [&result] {
-        auto pfnFreeExt = ze_lib::context->zeDdiTable.load()->Mem.pfnFreeExt;
+        auto pfnFreeExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Mem.pfnFreeExt;
         if( nullptr == pfnFreeExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -13734,7 +13742,7 @@ zeMemFreeExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnFreeExt = ze_lib::context->zeDdiTable.load()->Mem.pfnFreeExt;
+    auto pfnFreeExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Mem.pfnFreeExt;
     if( nullptr == pfnFreeExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -13793,7 +13801,7 @@ zeFabricVertexGetExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnFabricVertexGetExp_t pfnGetExp = [&result] {
-        auto pfnGetExp = ze_lib::context->zeDdiTable.load()->FabricVertexExp.pfnGetExp;
+        auto pfnGetExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->FabricVertexExp.pfnGetExp;
         if( nullptr == pfnGetExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -13808,7 +13816,7 @@ zeFabricVertexGetExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetExp = ze_lib::context->zeDdiTable.load()->FabricVertexExp.pfnGetExp;
+    auto pfnGetExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->FabricVertexExp.pfnGetExp;
     if( nullptr == pfnGetExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -13869,7 +13877,7 @@ zeFabricVertexGetSubVerticesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnFabricVertexGetSubVerticesExp_t pfnGetSubVerticesExp = [&result] {
-        auto pfnGetSubVerticesExp = ze_lib::context->zeDdiTable.load()->FabricVertexExp.pfnGetSubVerticesExp;
+        auto pfnGetSubVerticesExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->FabricVertexExp.pfnGetSubVerticesExp;
         if( nullptr == pfnGetSubVerticesExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -13884,7 +13892,7 @@ zeFabricVertexGetSubVerticesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetSubVerticesExp = ze_lib::context->zeDdiTable.load()->FabricVertexExp.pfnGetSubVerticesExp;
+    auto pfnGetSubVerticesExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->FabricVertexExp.pfnGetSubVerticesExp;
     if( nullptr == pfnGetSubVerticesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -13933,7 +13941,7 @@ zeFabricVertexGetPropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnFabricVertexGetPropertiesExp_t pfnGetPropertiesExp = [&result] {
-        auto pfnGetPropertiesExp = ze_lib::context->zeDdiTable.load()->FabricVertexExp.pfnGetPropertiesExp;
+        auto pfnGetPropertiesExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->FabricVertexExp.pfnGetPropertiesExp;
         if( nullptr == pfnGetPropertiesExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -13948,7 +13956,7 @@ zeFabricVertexGetPropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetPropertiesExp = ze_lib::context->zeDdiTable.load()->FabricVertexExp.pfnGetPropertiesExp;
+    auto pfnGetPropertiesExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->FabricVertexExp.pfnGetPropertiesExp;
     if( nullptr == pfnGetPropertiesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -14001,7 +14009,7 @@ zeFabricVertexGetDeviceExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnFabricVertexGetDeviceExp_t pfnGetDeviceExp = [&result] {
-        auto pfnGetDeviceExp = ze_lib::context->zeDdiTable.load()->FabricVertexExp.pfnGetDeviceExp;
+        auto pfnGetDeviceExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->FabricVertexExp.pfnGetDeviceExp;
         if( nullptr == pfnGetDeviceExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -14016,7 +14024,7 @@ zeFabricVertexGetDeviceExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetDeviceExp = ze_lib::context->zeDdiTable.load()->FabricVertexExp.pfnGetDeviceExp;
+    auto pfnGetDeviceExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->FabricVertexExp.pfnGetDeviceExp;
     if( nullptr == pfnGetDeviceExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -14067,7 +14075,7 @@ zeDeviceGetFabricVertexExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDeviceGetFabricVertexExp_t pfnGetFabricVertexExp = [&result] {
-        auto pfnGetFabricVertexExp = ze_lib::context->zeDdiTable.load()->DeviceExp.pfnGetFabricVertexExp;
+        auto pfnGetFabricVertexExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->DeviceExp.pfnGetFabricVertexExp;
         if( nullptr == pfnGetFabricVertexExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -14082,7 +14090,7 @@ zeDeviceGetFabricVertexExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetFabricVertexExp = ze_lib::context->zeDdiTable.load()->DeviceExp.pfnGetFabricVertexExp;
+    auto pfnGetFabricVertexExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->DeviceExp.pfnGetFabricVertexExp;
     if( nullptr == pfnGetFabricVertexExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -14143,7 +14151,7 @@ zeFabricEdgeGetExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnFabricEdgeGetExp_t pfnGetExp = [&result] {
-        auto pfnGetExp = ze_lib::context->zeDdiTable.load()->FabricEdgeExp.pfnGetExp;
+        auto pfnGetExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->FabricEdgeExp.pfnGetExp;
         if( nullptr == pfnGetExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -14158,7 +14166,7 @@ zeFabricEdgeGetExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetExp = ze_lib::context->zeDdiTable.load()->FabricEdgeExp.pfnGetExp;
+    auto pfnGetExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->FabricEdgeExp.pfnGetExp;
     if( nullptr == pfnGetExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -14211,7 +14219,7 @@ zeFabricEdgeGetVerticesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnFabricEdgeGetVerticesExp_t pfnGetVerticesExp = [&result] {
-        auto pfnGetVerticesExp = ze_lib::context->zeDdiTable.load()->FabricEdgeExp.pfnGetVerticesExp;
+        auto pfnGetVerticesExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->FabricEdgeExp.pfnGetVerticesExp;
         if( nullptr == pfnGetVerticesExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -14226,7 +14234,7 @@ zeFabricEdgeGetVerticesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetVerticesExp = ze_lib::context->zeDdiTable.load()->FabricEdgeExp.pfnGetVerticesExp;
+    auto pfnGetVerticesExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->FabricEdgeExp.pfnGetVerticesExp;
     if( nullptr == pfnGetVerticesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -14275,7 +14283,7 @@ zeFabricEdgeGetPropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnFabricEdgeGetPropertiesExp_t pfnGetPropertiesExp = [&result] {
-        auto pfnGetPropertiesExp = ze_lib::context->zeDdiTable.load()->FabricEdgeExp.pfnGetPropertiesExp;
+        auto pfnGetPropertiesExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->FabricEdgeExp.pfnGetPropertiesExp;
         if( nullptr == pfnGetPropertiesExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -14290,7 +14298,7 @@ zeFabricEdgeGetPropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetPropertiesExp = ze_lib::context->zeDdiTable.load()->FabricEdgeExp.pfnGetPropertiesExp;
+    auto pfnGetPropertiesExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->FabricEdgeExp.pfnGetPropertiesExp;
     if( nullptr == pfnGetPropertiesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -14373,7 +14381,7 @@ zeEventQueryKernelTimestampsExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnEventQueryKernelTimestampsExt_t pfnQueryKernelTimestampsExt = [&result] {
-        auto pfnQueryKernelTimestampsExt = ze_lib::context->zeDdiTable.load()->Event.pfnQueryKernelTimestampsExt;
+        auto pfnQueryKernelTimestampsExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnQueryKernelTimestampsExt;
         if( nullptr == pfnQueryKernelTimestampsExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -14388,7 +14396,7 @@ zeEventQueryKernelTimestampsExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnQueryKernelTimestampsExt = ze_lib::context->zeDdiTable.load()->Event.pfnQueryKernelTimestampsExt;
+    auto pfnQueryKernelTimestampsExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Event.pfnQueryKernelTimestampsExt;
     if( nullptr == pfnQueryKernelTimestampsExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -14443,7 +14451,7 @@ zeRTASBuilderCreateExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnRTASBuilderCreateExp_t pfnCreateExp = [&result] {
-        auto pfnCreateExp = ze_lib::context->zeDdiTable.load()->RTASBuilderExp.pfnCreateExp;
+        auto pfnCreateExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASBuilderExp.pfnCreateExp;
         if( nullptr == pfnCreateExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -14458,7 +14466,7 @@ zeRTASBuilderCreateExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreateExp = ze_lib::context->zeDdiTable.load()->RTASBuilderExp.pfnCreateExp;
+    auto pfnCreateExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASBuilderExp.pfnCreateExp;
     if( nullptr == pfnCreateExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -14514,7 +14522,7 @@ zeRTASBuilderGetBuildPropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnRTASBuilderGetBuildPropertiesExp_t pfnGetBuildPropertiesExp = [&result] {
-        auto pfnGetBuildPropertiesExp = ze_lib::context->zeDdiTable.load()->RTASBuilderExp.pfnGetBuildPropertiesExp;
+        auto pfnGetBuildPropertiesExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASBuilderExp.pfnGetBuildPropertiesExp;
         if( nullptr == pfnGetBuildPropertiesExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -14529,7 +14537,7 @@ zeRTASBuilderGetBuildPropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetBuildPropertiesExp = ze_lib::context->zeDdiTable.load()->RTASBuilderExp.pfnGetBuildPropertiesExp;
+    auto pfnGetBuildPropertiesExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASBuilderExp.pfnGetBuildPropertiesExp;
     if( nullptr == pfnGetBuildPropertiesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -14584,7 +14592,7 @@ zeDriverRTASFormatCompatibilityCheckExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDriverRTASFormatCompatibilityCheckExp_t pfnRTASFormatCompatibilityCheckExp = [&result] {
-        auto pfnRTASFormatCompatibilityCheckExp = ze_lib::context->zeDdiTable.load()->DriverExp.pfnRTASFormatCompatibilityCheckExp;
+        auto pfnRTASFormatCompatibilityCheckExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->DriverExp.pfnRTASFormatCompatibilityCheckExp;
         if( nullptr == pfnRTASFormatCompatibilityCheckExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -14599,7 +14607,7 @@ zeDriverRTASFormatCompatibilityCheckExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnRTASFormatCompatibilityCheckExp = ze_lib::context->zeDdiTable.load()->DriverExp.pfnRTASFormatCompatibilityCheckExp;
+    auto pfnRTASFormatCompatibilityCheckExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->DriverExp.pfnRTASFormatCompatibilityCheckExp;
     if( nullptr == pfnRTASFormatCompatibilityCheckExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -14715,7 +14723,7 @@ zeRTASBuilderBuildExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnRTASBuilderBuildExp_t pfnBuildExp = [&result] {
-        auto pfnBuildExp = ze_lib::context->zeDdiTable.load()->RTASBuilderExp.pfnBuildExp;
+        auto pfnBuildExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASBuilderExp.pfnBuildExp;
         if( nullptr == pfnBuildExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -14730,7 +14738,7 @@ zeRTASBuilderBuildExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnBuildExp = ze_lib::context->zeDdiTable.load()->RTASBuilderExp.pfnBuildExp;
+    auto pfnBuildExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASBuilderExp.pfnBuildExp;
     if( nullptr == pfnBuildExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -14780,7 +14788,7 @@ zeRTASBuilderDestroyExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnRTASBuilderDestroyExp_t pfnDestroyExp = [&result] {
-        auto pfnDestroyExp = ze_lib::context->zeDdiTable.load()->RTASBuilderExp.pfnDestroyExp;
+        auto pfnDestroyExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASBuilderExp.pfnDestroyExp;
         if( nullptr == pfnDestroyExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -14795,7 +14803,7 @@ zeRTASBuilderDestroyExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroyExp = ze_lib::context->zeDdiTable.load()->RTASBuilderExp.pfnDestroyExp;
+    auto pfnDestroyExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASBuilderExp.pfnDestroyExp;
     if( nullptr == pfnDestroyExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -14846,7 +14854,7 @@ zeRTASParallelOperationCreateExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnRTASParallelOperationCreateExp_t pfnCreateExp = [&result] {
-        auto pfnCreateExp = ze_lib::context->zeDdiTable.load()->RTASParallelOperationExp.pfnCreateExp;
+        auto pfnCreateExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASParallelOperationExp.pfnCreateExp;
         if( nullptr == pfnCreateExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -14861,7 +14869,7 @@ zeRTASParallelOperationCreateExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreateExp = ze_lib::context->zeDdiTable.load()->RTASParallelOperationExp.pfnCreateExp;
+    auto pfnCreateExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASParallelOperationExp.pfnCreateExp;
     if( nullptr == pfnCreateExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -14916,7 +14924,7 @@ zeRTASParallelOperationGetPropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnRTASParallelOperationGetPropertiesExp_t pfnGetPropertiesExp = [&result] {
-        auto pfnGetPropertiesExp = ze_lib::context->zeDdiTable.load()->RTASParallelOperationExp.pfnGetPropertiesExp;
+        auto pfnGetPropertiesExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASParallelOperationExp.pfnGetPropertiesExp;
         if( nullptr == pfnGetPropertiesExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -14931,7 +14939,7 @@ zeRTASParallelOperationGetPropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetPropertiesExp = ze_lib::context->zeDdiTable.load()->RTASParallelOperationExp.pfnGetPropertiesExp;
+    auto pfnGetPropertiesExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASParallelOperationExp.pfnGetPropertiesExp;
     if( nullptr == pfnGetPropertiesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -14977,7 +14985,7 @@ zeRTASParallelOperationJoinExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnRTASParallelOperationJoinExp_t pfnJoinExp = [&result] {
-        auto pfnJoinExp = ze_lib::context->zeDdiTable.load()->RTASParallelOperationExp.pfnJoinExp;
+        auto pfnJoinExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASParallelOperationExp.pfnJoinExp;
         if( nullptr == pfnJoinExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -14992,7 +15000,7 @@ zeRTASParallelOperationJoinExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnJoinExp = ze_lib::context->zeDdiTable.load()->RTASParallelOperationExp.pfnJoinExp;
+    auto pfnJoinExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASParallelOperationExp.pfnJoinExp;
     if( nullptr == pfnJoinExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -15043,7 +15051,7 @@ zeRTASParallelOperationDestroyExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnRTASParallelOperationDestroyExp_t pfnDestroyExp = [&result] {
-        auto pfnDestroyExp = ze_lib::context->zeDdiTable.load()->RTASParallelOperationExp.pfnDestroyExp;
+        auto pfnDestroyExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASParallelOperationExp.pfnDestroyExp;
         if( nullptr == pfnDestroyExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -15058,7 +15066,7 @@ zeRTASParallelOperationDestroyExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroyExp = ze_lib::context->zeDdiTable.load()->RTASParallelOperationExp.pfnDestroyExp;
+    auto pfnDestroyExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASParallelOperationExp.pfnDestroyExp;
     if( nullptr == pfnDestroyExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -15116,7 +15124,7 @@ zeMemGetPitchFor2dImage(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnMemGetPitchFor2dImage_t pfnGetPitchFor2dImage = [&result] {
-        auto pfnGetPitchFor2dImage = ze_lib::context->zeDdiTable.load()->Mem.pfnGetPitchFor2dImage;
+        auto pfnGetPitchFor2dImage = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Mem.pfnGetPitchFor2dImage;
         if( nullptr == pfnGetPitchFor2dImage ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -15131,7 +15139,7 @@ zeMemGetPitchFor2dImage(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetPitchFor2dImage = ze_lib::context->zeDdiTable.load()->Mem.pfnGetPitchFor2dImage;
+    auto pfnGetPitchFor2dImage = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Mem.pfnGetPitchFor2dImage;
     if( nullptr == pfnGetPitchFor2dImage ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -15183,7 +15191,7 @@ zeImageGetDeviceOffsetExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnImageGetDeviceOffsetExp_t pfnGetDeviceOffsetExp = [&result] {
-        auto pfnGetDeviceOffsetExp = ze_lib::context->zeDdiTable.load()->ImageExp.pfnGetDeviceOffsetExp;
+        auto pfnGetDeviceOffsetExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->ImageExp.pfnGetDeviceOffsetExp;
         if( nullptr == pfnGetDeviceOffsetExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -15198,7 +15206,7 @@ zeImageGetDeviceOffsetExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetDeviceOffsetExp = ze_lib::context->zeDdiTable.load()->ImageExp.pfnGetDeviceOffsetExp;
+    auto pfnGetDeviceOffsetExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->ImageExp.pfnGetDeviceOffsetExp;
     if( nullptr == pfnGetDeviceOffsetExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -15259,7 +15267,7 @@ zeCommandListCreateCloneExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListCreateCloneExp_t pfnCreateCloneExp = [&result] {
-        auto pfnCreateCloneExp = ze_lib::context->zeDdiTable.load()->CommandListExp.pfnCreateCloneExp;
+        auto pfnCreateCloneExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandListExp.pfnCreateCloneExp;
         if( nullptr == pfnCreateCloneExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -15274,7 +15282,7 @@ zeCommandListCreateCloneExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreateCloneExp = ze_lib::context->zeDdiTable.load()->CommandListExp.pfnCreateCloneExp;
+    auto pfnCreateCloneExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandListExp.pfnCreateCloneExp;
     if( nullptr == pfnCreateCloneExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -15340,7 +15348,7 @@ zeCommandListImmediateAppendCommandListsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListImmediateAppendCommandListsExp_t pfnImmediateAppendCommandListsExp = [&result] {
-        auto pfnImmediateAppendCommandListsExp = ze_lib::context->zeDdiTable.load()->CommandListExp.pfnImmediateAppendCommandListsExp;
+        auto pfnImmediateAppendCommandListsExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandListExp.pfnImmediateAppendCommandListsExp;
         if( nullptr == pfnImmediateAppendCommandListsExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -15355,7 +15363,7 @@ zeCommandListImmediateAppendCommandListsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnImmediateAppendCommandListsExp = ze_lib::context->zeDdiTable.load()->CommandListExp.pfnImmediateAppendCommandListsExp;
+    auto pfnImmediateAppendCommandListsExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandListExp.pfnImmediateAppendCommandListsExp;
     if( nullptr == pfnImmediateAppendCommandListsExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -15422,7 +15430,7 @@ zeCommandListImmediateAppendCommandListsWithParameters(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListImmediateAppendCommandListsWithParameters_t pfnImmediateAppendCommandListsWithParameters = [&result] {
-        auto pfnImmediateAppendCommandListsWithParameters = ze_lib::context->zeDdiTable.load()->CommandList.pfnImmediateAppendCommandListsWithParameters;
+        auto pfnImmediateAppendCommandListsWithParameters = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnImmediateAppendCommandListsWithParameters;
         if( nullptr == pfnImmediateAppendCommandListsWithParameters ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -15437,7 +15445,7 @@ zeCommandListImmediateAppendCommandListsWithParameters(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnImmediateAppendCommandListsWithParameters = ze_lib::context->zeDdiTable.load()->CommandList.pfnImmediateAppendCommandListsWithParameters;
+    auto pfnImmediateAppendCommandListsWithParameters = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnImmediateAppendCommandListsWithParameters;
     if( nullptr == pfnImmediateAppendCommandListsWithParameters ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -15495,7 +15503,7 @@ zeCommandListGetNextCommandIdExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListGetNextCommandIdExp_t pfnGetNextCommandIdExp = [&result] {
-        auto pfnGetNextCommandIdExp = ze_lib::context->zeDdiTable.load()->CommandListExp.pfnGetNextCommandIdExp;
+        auto pfnGetNextCommandIdExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandListExp.pfnGetNextCommandIdExp;
         if( nullptr == pfnGetNextCommandIdExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -15510,7 +15518,7 @@ zeCommandListGetNextCommandIdExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetNextCommandIdExp = ze_lib::context->zeDdiTable.load()->CommandListExp.pfnGetNextCommandIdExp;
+    auto pfnGetNextCommandIdExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandListExp.pfnGetNextCommandIdExp;
     if( nullptr == pfnGetNextCommandIdExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -15574,7 +15582,7 @@ zeCommandListGetNextCommandIdWithKernelsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListGetNextCommandIdWithKernelsExp_t pfnGetNextCommandIdWithKernelsExp = [&result] {
-        auto pfnGetNextCommandIdWithKernelsExp = ze_lib::context->zeDdiTable.load()->CommandListExp.pfnGetNextCommandIdWithKernelsExp;
+        auto pfnGetNextCommandIdWithKernelsExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandListExp.pfnGetNextCommandIdWithKernelsExp;
         if( nullptr == pfnGetNextCommandIdWithKernelsExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -15589,7 +15597,7 @@ zeCommandListGetNextCommandIdWithKernelsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetNextCommandIdWithKernelsExp = ze_lib::context->zeDdiTable.load()->CommandListExp.pfnGetNextCommandIdWithKernelsExp;
+    auto pfnGetNextCommandIdWithKernelsExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandListExp.pfnGetNextCommandIdWithKernelsExp;
     if( nullptr == pfnGetNextCommandIdWithKernelsExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -15646,7 +15654,7 @@ zeCommandListUpdateMutableCommandsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListUpdateMutableCommandsExp_t pfnUpdateMutableCommandsExp = [&result] {
-        auto pfnUpdateMutableCommandsExp = ze_lib::context->zeDdiTable.load()->CommandListExp.pfnUpdateMutableCommandsExp;
+        auto pfnUpdateMutableCommandsExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandListExp.pfnUpdateMutableCommandsExp;
         if( nullptr == pfnUpdateMutableCommandsExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -15661,7 +15669,7 @@ zeCommandListUpdateMutableCommandsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnUpdateMutableCommandsExp = ze_lib::context->zeDdiTable.load()->CommandListExp.pfnUpdateMutableCommandsExp;
+    auto pfnUpdateMutableCommandsExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandListExp.pfnUpdateMutableCommandsExp;
     if( nullptr == pfnUpdateMutableCommandsExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -15712,7 +15720,7 @@ zeCommandListIsMutableExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListIsMutableExp_t pfnIsMutableExp = [&result] {
-        auto pfnIsMutableExp = ze_lib::context->zeDdiTable.load()->CommandListExp.pfnIsMutableExp;
+        auto pfnIsMutableExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandListExp.pfnIsMutableExp;
         if( nullptr == pfnIsMutableExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -15727,7 +15735,7 @@ zeCommandListIsMutableExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnIsMutableExp = ze_lib::context->zeDdiTable.load()->CommandListExp.pfnIsMutableExp;
+    auto pfnIsMutableExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandListExp.pfnIsMutableExp;
     if( nullptr == pfnIsMutableExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -15784,7 +15792,7 @@ zeCommandListUpdateMutableCommandSignalEventExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListUpdateMutableCommandSignalEventExp_t pfnUpdateMutableCommandSignalEventExp = [&result] {
-        auto pfnUpdateMutableCommandSignalEventExp = ze_lib::context->zeDdiTable.load()->CommandListExp.pfnUpdateMutableCommandSignalEventExp;
+        auto pfnUpdateMutableCommandSignalEventExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandListExp.pfnUpdateMutableCommandSignalEventExp;
         if( nullptr == pfnUpdateMutableCommandSignalEventExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -15799,7 +15807,7 @@ zeCommandListUpdateMutableCommandSignalEventExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnUpdateMutableCommandSignalEventExp = ze_lib::context->zeDdiTable.load()->CommandListExp.pfnUpdateMutableCommandSignalEventExp;
+    auto pfnUpdateMutableCommandSignalEventExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandListExp.pfnUpdateMutableCommandSignalEventExp;
     if( nullptr == pfnUpdateMutableCommandSignalEventExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -15865,7 +15873,7 @@ zeCommandListUpdateMutableCommandWaitEventsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListUpdateMutableCommandWaitEventsExp_t pfnUpdateMutableCommandWaitEventsExp = [&result] {
-        auto pfnUpdateMutableCommandWaitEventsExp = ze_lib::context->zeDdiTable.load()->CommandListExp.pfnUpdateMutableCommandWaitEventsExp;
+        auto pfnUpdateMutableCommandWaitEventsExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandListExp.pfnUpdateMutableCommandWaitEventsExp;
         if( nullptr == pfnUpdateMutableCommandWaitEventsExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -15880,7 +15888,7 @@ zeCommandListUpdateMutableCommandWaitEventsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnUpdateMutableCommandWaitEventsExp = ze_lib::context->zeDdiTable.load()->CommandListExp.pfnUpdateMutableCommandWaitEventsExp;
+    auto pfnUpdateMutableCommandWaitEventsExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandListExp.pfnUpdateMutableCommandWaitEventsExp;
     if( nullptr == pfnUpdateMutableCommandWaitEventsExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -15944,7 +15952,7 @@ zeCommandListUpdateMutableCommandKernelsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListUpdateMutableCommandKernelsExp_t pfnUpdateMutableCommandKernelsExp = [&result] {
-        auto pfnUpdateMutableCommandKernelsExp = ze_lib::context->zeDdiTable.load()->CommandListExp.pfnUpdateMutableCommandKernelsExp;
+        auto pfnUpdateMutableCommandKernelsExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandListExp.pfnUpdateMutableCommandKernelsExp;
         if( nullptr == pfnUpdateMutableCommandKernelsExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -15959,7 +15967,7 @@ zeCommandListUpdateMutableCommandKernelsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnUpdateMutableCommandKernelsExp = ze_lib::context->zeDdiTable.load()->CommandListExp.pfnUpdateMutableCommandKernelsExp;
+    auto pfnUpdateMutableCommandKernelsExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandListExp.pfnUpdateMutableCommandKernelsExp;
     if( nullptr == pfnUpdateMutableCommandKernelsExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -16013,7 +16021,7 @@ zeKernelGetBinaryExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnKernelGetBinaryExp_t pfnGetBinaryExp = [&result] {
-        auto pfnGetBinaryExp = ze_lib::context->zeDdiTable.load()->KernelExp.pfnGetBinaryExp;
+        auto pfnGetBinaryExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->KernelExp.pfnGetBinaryExp;
         if( nullptr == pfnGetBinaryExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -16028,7 +16036,7 @@ zeKernelGetBinaryExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetBinaryExp = ze_lib::context->zeDdiTable.load()->KernelExp.pfnGetBinaryExp;
+    auto pfnGetBinaryExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->KernelExp.pfnGetBinaryExp;
     if( nullptr == pfnGetBinaryExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -16084,7 +16092,7 @@ zeDeviceImportExternalSemaphoreExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDeviceImportExternalSemaphoreExt_t pfnImportExternalSemaphoreExt = [&result] {
-        auto pfnImportExternalSemaphoreExt = ze_lib::context->zeDdiTable.load()->Device.pfnImportExternalSemaphoreExt;
+        auto pfnImportExternalSemaphoreExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnImportExternalSemaphoreExt;
         if( nullptr == pfnImportExternalSemaphoreExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -16099,7 +16107,7 @@ zeDeviceImportExternalSemaphoreExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnImportExternalSemaphoreExt = ze_lib::context->zeDdiTable.load()->Device.pfnImportExternalSemaphoreExt;
+    auto pfnImportExternalSemaphoreExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnImportExternalSemaphoreExt;
     if( nullptr == pfnImportExternalSemaphoreExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -16149,7 +16157,7 @@ zeDeviceReleaseExternalSemaphoreExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDeviceReleaseExternalSemaphoreExt_t pfnReleaseExternalSemaphoreExt = [&result] {
-        auto pfnReleaseExternalSemaphoreExt = ze_lib::context->zeDdiTable.load()->Device.pfnReleaseExternalSemaphoreExt;
+        auto pfnReleaseExternalSemaphoreExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnReleaseExternalSemaphoreExt;
         if( nullptr == pfnReleaseExternalSemaphoreExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -16164,7 +16172,7 @@ zeDeviceReleaseExternalSemaphoreExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReleaseExternalSemaphoreExt = ze_lib::context->zeDdiTable.load()->Device.pfnReleaseExternalSemaphoreExt;
+    auto pfnReleaseExternalSemaphoreExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnReleaseExternalSemaphoreExt;
     if( nullptr == pfnReleaseExternalSemaphoreExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -16232,7 +16240,7 @@ zeCommandListAppendSignalExternalSemaphoreExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendSignalExternalSemaphoreExt_t pfnAppendSignalExternalSemaphoreExt = [&result] {
-        auto pfnAppendSignalExternalSemaphoreExt = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendSignalExternalSemaphoreExt;
+        auto pfnAppendSignalExternalSemaphoreExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendSignalExternalSemaphoreExt;
         if( nullptr == pfnAppendSignalExternalSemaphoreExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -16247,7 +16255,7 @@ zeCommandListAppendSignalExternalSemaphoreExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendSignalExternalSemaphoreExt = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendSignalExternalSemaphoreExt;
+    auto pfnAppendSignalExternalSemaphoreExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendSignalExternalSemaphoreExt;
     if( nullptr == pfnAppendSignalExternalSemaphoreExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -16315,7 +16323,7 @@ zeCommandListAppendWaitExternalSemaphoreExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendWaitExternalSemaphoreExt_t pfnAppendWaitExternalSemaphoreExt = [&result] {
-        auto pfnAppendWaitExternalSemaphoreExt = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendWaitExternalSemaphoreExt;
+        auto pfnAppendWaitExternalSemaphoreExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendWaitExternalSemaphoreExt;
         if( nullptr == pfnAppendWaitExternalSemaphoreExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -16330,7 +16338,7 @@ zeCommandListAppendWaitExternalSemaphoreExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendWaitExternalSemaphoreExt = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendWaitExternalSemaphoreExt;
+    auto pfnAppendWaitExternalSemaphoreExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendWaitExternalSemaphoreExt;
     if( nullptr == pfnAppendWaitExternalSemaphoreExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -16385,7 +16393,7 @@ zeRTASBuilderCreateExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnRTASBuilderCreateExt_t pfnCreateExt = [&result] {
-        auto pfnCreateExt = ze_lib::context->zeDdiTable.load()->RTASBuilder.pfnCreateExt;
+        auto pfnCreateExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASBuilder.pfnCreateExt;
         if( nullptr == pfnCreateExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -16400,7 +16408,7 @@ zeRTASBuilderCreateExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreateExt = ze_lib::context->zeDdiTable.load()->RTASBuilder.pfnCreateExt;
+    auto pfnCreateExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASBuilder.pfnCreateExt;
     if( nullptr == pfnCreateExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -16456,7 +16464,7 @@ zeRTASBuilderGetBuildPropertiesExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnRTASBuilderGetBuildPropertiesExt_t pfnGetBuildPropertiesExt = [&result] {
-        auto pfnGetBuildPropertiesExt = ze_lib::context->zeDdiTable.load()->RTASBuilder.pfnGetBuildPropertiesExt;
+        auto pfnGetBuildPropertiesExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASBuilder.pfnGetBuildPropertiesExt;
         if( nullptr == pfnGetBuildPropertiesExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -16471,7 +16479,7 @@ zeRTASBuilderGetBuildPropertiesExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetBuildPropertiesExt = ze_lib::context->zeDdiTable.load()->RTASBuilder.pfnGetBuildPropertiesExt;
+    auto pfnGetBuildPropertiesExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASBuilder.pfnGetBuildPropertiesExt;
     if( nullptr == pfnGetBuildPropertiesExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -16526,7 +16534,7 @@ zeDriverRTASFormatCompatibilityCheckExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDriverRTASFormatCompatibilityCheckExt_t pfnRTASFormatCompatibilityCheckExt = [&result] {
-        auto pfnRTASFormatCompatibilityCheckExt = ze_lib::context->zeDdiTable.load()->Driver.pfnRTASFormatCompatibilityCheckExt;
+        auto pfnRTASFormatCompatibilityCheckExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Driver.pfnRTASFormatCompatibilityCheckExt;
         if( nullptr == pfnRTASFormatCompatibilityCheckExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -16541,7 +16549,7 @@ zeDriverRTASFormatCompatibilityCheckExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnRTASFormatCompatibilityCheckExt = ze_lib::context->zeDdiTable.load()->Driver.pfnRTASFormatCompatibilityCheckExt;
+    auto pfnRTASFormatCompatibilityCheckExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Driver.pfnRTASFormatCompatibilityCheckExt;
     if( nullptr == pfnRTASFormatCompatibilityCheckExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -16657,7 +16665,7 @@ zeRTASBuilderBuildExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnRTASBuilderBuildExt_t pfnBuildExt = [&result] {
-        auto pfnBuildExt = ze_lib::context->zeDdiTable.load()->RTASBuilder.pfnBuildExt;
+        auto pfnBuildExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASBuilder.pfnBuildExt;
         if( nullptr == pfnBuildExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -16672,7 +16680,7 @@ zeRTASBuilderBuildExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnBuildExt = ze_lib::context->zeDdiTable.load()->RTASBuilder.pfnBuildExt;
+    auto pfnBuildExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASBuilder.pfnBuildExt;
     if( nullptr == pfnBuildExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -16749,7 +16757,7 @@ zeRTASBuilderCommandListAppendCopyExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnRTASBuilderCommandListAppendCopyExt_t pfnCommandListAppendCopyExt = [&result] {
-        auto pfnCommandListAppendCopyExt = ze_lib::context->zeDdiTable.load()->RTASBuilder.pfnCommandListAppendCopyExt;
+        auto pfnCommandListAppendCopyExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASBuilder.pfnCommandListAppendCopyExt;
         if( nullptr == pfnCommandListAppendCopyExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -16764,7 +16772,7 @@ zeRTASBuilderCommandListAppendCopyExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCommandListAppendCopyExt = ze_lib::context->zeDdiTable.load()->RTASBuilder.pfnCommandListAppendCopyExt;
+    auto pfnCommandListAppendCopyExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASBuilder.pfnCommandListAppendCopyExt;
     if( nullptr == pfnCommandListAppendCopyExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -16814,7 +16822,7 @@ zeRTASBuilderDestroyExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnRTASBuilderDestroyExt_t pfnDestroyExt = [&result] {
-        auto pfnDestroyExt = ze_lib::context->zeDdiTable.load()->RTASBuilder.pfnDestroyExt;
+        auto pfnDestroyExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASBuilder.pfnDestroyExt;
         if( nullptr == pfnDestroyExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -16829,7 +16837,7 @@ zeRTASBuilderDestroyExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroyExt = ze_lib::context->zeDdiTable.load()->RTASBuilder.pfnDestroyExt;
+    auto pfnDestroyExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASBuilder.pfnDestroyExt;
     if( nullptr == pfnDestroyExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -16880,7 +16888,7 @@ zeRTASParallelOperationCreateExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnRTASParallelOperationCreateExt_t pfnCreateExt = [&result] {
-        auto pfnCreateExt = ze_lib::context->zeDdiTable.load()->RTASParallelOperation.pfnCreateExt;
+        auto pfnCreateExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASParallelOperation.pfnCreateExt;
         if( nullptr == pfnCreateExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -16895,7 +16903,7 @@ zeRTASParallelOperationCreateExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreateExt = ze_lib::context->zeDdiTable.load()->RTASParallelOperation.pfnCreateExt;
+    auto pfnCreateExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASParallelOperation.pfnCreateExt;
     if( nullptr == pfnCreateExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -16950,7 +16958,7 @@ zeRTASParallelOperationGetPropertiesExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnRTASParallelOperationGetPropertiesExt_t pfnGetPropertiesExt = [&result] {
-        auto pfnGetPropertiesExt = ze_lib::context->zeDdiTable.load()->RTASParallelOperation.pfnGetPropertiesExt;
+        auto pfnGetPropertiesExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASParallelOperation.pfnGetPropertiesExt;
         if( nullptr == pfnGetPropertiesExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -16965,7 +16973,7 @@ zeRTASParallelOperationGetPropertiesExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetPropertiesExt = ze_lib::context->zeDdiTable.load()->RTASParallelOperation.pfnGetPropertiesExt;
+    auto pfnGetPropertiesExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASParallelOperation.pfnGetPropertiesExt;
     if( nullptr == pfnGetPropertiesExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -17011,7 +17019,7 @@ zeRTASParallelOperationJoinExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnRTASParallelOperationJoinExt_t pfnJoinExt = [&result] {
-        auto pfnJoinExt = ze_lib::context->zeDdiTable.load()->RTASParallelOperation.pfnJoinExt;
+        auto pfnJoinExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASParallelOperation.pfnJoinExt;
         if( nullptr == pfnJoinExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -17026,7 +17034,7 @@ zeRTASParallelOperationJoinExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnJoinExt = ze_lib::context->zeDdiTable.load()->RTASParallelOperation.pfnJoinExt;
+    auto pfnJoinExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASParallelOperation.pfnJoinExt;
     if( nullptr == pfnJoinExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -17077,7 +17085,7 @@ zeRTASParallelOperationDestroyExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnRTASParallelOperationDestroyExt_t pfnDestroyExt = [&result] {
-        auto pfnDestroyExt = ze_lib::context->zeDdiTable.load()->RTASParallelOperation.pfnDestroyExt;
+        auto pfnDestroyExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASParallelOperation.pfnDestroyExt;
         if( nullptr == pfnDestroyExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -17092,7 +17100,7 @@ zeRTASParallelOperationDestroyExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroyExt = ze_lib::context->zeDdiTable.load()->RTASParallelOperation.pfnDestroyExt;
+    auto pfnDestroyExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->RTASParallelOperation.pfnDestroyExt;
     if( nullptr == pfnDestroyExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -17157,7 +17165,7 @@ zeDeviceGetVectorWidthPropertiesExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnDeviceGetVectorWidthPropertiesExt_t pfnGetVectorWidthPropertiesExt = [&result] {
-        auto pfnGetVectorWidthPropertiesExt = ze_lib::context->zeDdiTable.load()->Device.pfnGetVectorWidthPropertiesExt;
+        auto pfnGetVectorWidthPropertiesExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetVectorWidthPropertiesExt;
         if( nullptr == pfnGetVectorWidthPropertiesExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -17172,7 +17180,7 @@ zeDeviceGetVectorWidthPropertiesExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetVectorWidthPropertiesExt = ze_lib::context->zeDdiTable.load()->Device.pfnGetVectorWidthPropertiesExt;
+    auto pfnGetVectorWidthPropertiesExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Device.pfnGetVectorWidthPropertiesExt;
     if( nullptr == pfnGetVectorWidthPropertiesExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -17232,7 +17240,7 @@ zeKernelGetAllocationPropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnKernelGetAllocationPropertiesExp_t pfnGetAllocationPropertiesExp = [&result] {
-        auto pfnGetAllocationPropertiesExp = ze_lib::context->zeDdiTable.load()->KernelExp.pfnGetAllocationPropertiesExp;
+        auto pfnGetAllocationPropertiesExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->KernelExp.pfnGetAllocationPropertiesExp;
         if( nullptr == pfnGetAllocationPropertiesExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -17247,7 +17255,7 @@ zeKernelGetAllocationPropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetAllocationPropertiesExp = ze_lib::context->zeDdiTable.load()->KernelExp.pfnGetAllocationPropertiesExp;
+    auto pfnGetAllocationPropertiesExp = ze_lib::zeDdiTable.load(std::memory_order_acquire)->KernelExp.pfnGetAllocationPropertiesExp;
     if( nullptr == pfnGetAllocationPropertiesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -17312,7 +17320,7 @@ zeMemGetIpcHandleWithProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnMemGetIpcHandleWithProperties_t pfnGetIpcHandleWithProperties = [&result] {
-        auto pfnGetIpcHandleWithProperties = ze_lib::context->zeDdiTable.load()->Mem.pfnGetIpcHandleWithProperties;
+        auto pfnGetIpcHandleWithProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Mem.pfnGetIpcHandleWithProperties;
         if( nullptr == pfnGetIpcHandleWithProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -17327,7 +17335,7 @@ zeMemGetIpcHandleWithProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetIpcHandleWithProperties = ze_lib::context->zeDdiTable.load()->Mem.pfnGetIpcHandleWithProperties;
+    auto pfnGetIpcHandleWithProperties = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Mem.pfnGetIpcHandleWithProperties;
     if( nullptr == pfnGetIpcHandleWithProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -17381,7 +17389,7 @@ zeGraphCreateExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnGraphCreateExt_t pfnCreateExt = [&result] {
-        auto pfnCreateExt = ze_lib::context->zeDdiTable.load()->Graph.pfnCreateExt;
+        auto pfnCreateExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Graph.pfnCreateExt;
         if( nullptr == pfnCreateExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -17396,7 +17404,7 @@ zeGraphCreateExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreateExt = ze_lib::context->zeDdiTable.load()->Graph.pfnCreateExt;
+    auto pfnCreateExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Graph.pfnCreateExt;
     if( nullptr == pfnCreateExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -17509,7 +17517,7 @@ zeCommandListBeginGraphCaptureExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListBeginGraphCaptureExt_t pfnBeginGraphCaptureExt = [&result] {
-        auto pfnBeginGraphCaptureExt = ze_lib::context->zeDdiTable.load()->CommandList.pfnBeginGraphCaptureExt;
+        auto pfnBeginGraphCaptureExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnBeginGraphCaptureExt;
         if( nullptr == pfnBeginGraphCaptureExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -17524,7 +17532,7 @@ zeCommandListBeginGraphCaptureExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnBeginGraphCaptureExt = ze_lib::context->zeDdiTable.load()->CommandList.pfnBeginGraphCaptureExt;
+    auto pfnBeginGraphCaptureExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnBeginGraphCaptureExt;
     if( nullptr == pfnBeginGraphCaptureExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -17579,7 +17587,7 @@ zeCommandListBeginCaptureIntoGraphExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListBeginCaptureIntoGraphExt_t pfnBeginCaptureIntoGraphExt = [&result] {
-        auto pfnBeginCaptureIntoGraphExt = ze_lib::context->zeDdiTable.load()->CommandList.pfnBeginCaptureIntoGraphExt;
+        auto pfnBeginCaptureIntoGraphExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnBeginCaptureIntoGraphExt;
         if( nullptr == pfnBeginCaptureIntoGraphExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -17594,7 +17602,7 @@ zeCommandListBeginCaptureIntoGraphExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnBeginCaptureIntoGraphExt = ze_lib::context->zeDdiTable.load()->CommandList.pfnBeginCaptureIntoGraphExt;
+    auto pfnBeginCaptureIntoGraphExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnBeginCaptureIntoGraphExt;
     if( nullptr == pfnBeginCaptureIntoGraphExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -17642,7 +17650,7 @@ zeCommandListIsGraphCaptureEnabledExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListIsGraphCaptureEnabledExt_t pfnIsGraphCaptureEnabledExt = [&result] {
-        auto pfnIsGraphCaptureEnabledExt = ze_lib::context->zeDdiTable.load()->CommandList.pfnIsGraphCaptureEnabledExt;
+        auto pfnIsGraphCaptureEnabledExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnIsGraphCaptureEnabledExt;
         if( nullptr == pfnIsGraphCaptureEnabledExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -17657,7 +17665,7 @@ zeCommandListIsGraphCaptureEnabledExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnIsGraphCaptureEnabledExt = ze_lib::context->zeDdiTable.load()->CommandList.pfnIsGraphCaptureEnabledExt;
+    auto pfnIsGraphCaptureEnabledExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnIsGraphCaptureEnabledExt;
     if( nullptr == pfnIsGraphCaptureEnabledExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -17729,7 +17737,7 @@ zeCommandListEndGraphCaptureExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListEndGraphCaptureExt_t pfnEndGraphCaptureExt = [&result] {
-        auto pfnEndGraphCaptureExt = ze_lib::context->zeDdiTable.load()->CommandList.pfnEndGraphCaptureExt;
+        auto pfnEndGraphCaptureExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnEndGraphCaptureExt;
         if( nullptr == pfnEndGraphCaptureExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -17744,7 +17752,7 @@ zeCommandListEndGraphCaptureExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEndGraphCaptureExt = ze_lib::context->zeDdiTable.load()->CommandList.pfnEndGraphCaptureExt;
+    auto pfnEndGraphCaptureExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnEndGraphCaptureExt;
     if( nullptr == pfnEndGraphCaptureExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -17801,7 +17809,7 @@ zeCommandListGetGraphExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListGetGraphExt_t pfnGetGraphExt = [&result] {
-        auto pfnGetGraphExt = ze_lib::context->zeDdiTable.load()->CommandList.pfnGetGraphExt;
+        auto pfnGetGraphExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnGetGraphExt;
         if( nullptr == pfnGetGraphExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -17816,7 +17824,7 @@ zeCommandListGetGraphExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetGraphExt = ze_lib::context->zeDdiTable.load()->CommandList.pfnGetGraphExt;
+    auto pfnGetGraphExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnGetGraphExt;
     if( nullptr == pfnGetGraphExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -17869,7 +17877,7 @@ zeGraphGetPrimaryCommandListExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnGraphGetPrimaryCommandListExt_t pfnGetPrimaryCommandListExt = [&result] {
-        auto pfnGetPrimaryCommandListExt = ze_lib::context->zeDdiTable.load()->Graph.pfnGetPrimaryCommandListExt;
+        auto pfnGetPrimaryCommandListExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Graph.pfnGetPrimaryCommandListExt;
         if( nullptr == pfnGetPrimaryCommandListExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -17884,7 +17892,7 @@ zeGraphGetPrimaryCommandListExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetPrimaryCommandListExt = ze_lib::context->zeDdiTable.load()->Graph.pfnGetPrimaryCommandListExt;
+    auto pfnGetPrimaryCommandListExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Graph.pfnGetPrimaryCommandListExt;
     if( nullptr == pfnGetPrimaryCommandListExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -17938,7 +17946,7 @@ zeGraphSetDestructionCallbackExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnGraphSetDestructionCallbackExt_t pfnSetDestructionCallbackExt = [&result] {
-        auto pfnSetDestructionCallbackExt = ze_lib::context->zeDdiTable.load()->Graph.pfnSetDestructionCallbackExt;
+        auto pfnSetDestructionCallbackExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Graph.pfnSetDestructionCallbackExt;
         if( nullptr == pfnSetDestructionCallbackExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -17953,7 +17961,7 @@ zeGraphSetDestructionCallbackExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetDestructionCallbackExt = ze_lib::context->zeDdiTable.load()->Graph.pfnSetDestructionCallbackExt;
+    auto pfnSetDestructionCallbackExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Graph.pfnSetDestructionCallbackExt;
     if( nullptr == pfnSetDestructionCallbackExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -18022,7 +18030,7 @@ zeGraphInstantiateExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnGraphInstantiateExt_t pfnInstantiateExt = [&result] {
-        auto pfnInstantiateExt = ze_lib::context->zeDdiTable.load()->Graph.pfnInstantiateExt;
+        auto pfnInstantiateExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Graph.pfnInstantiateExt;
         if( nullptr == pfnInstantiateExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -18037,7 +18045,7 @@ zeGraphInstantiateExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnInstantiateExt = ze_lib::context->zeDdiTable.load()->Graph.pfnInstantiateExt;
+    auto pfnInstantiateExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Graph.pfnInstantiateExt;
     if( nullptr == pfnInstantiateExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -18105,7 +18113,7 @@ zeCommandListAppendGraphExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendGraphExt_t pfnAppendGraphExt = [&result] {
-        auto pfnAppendGraphExt = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendGraphExt;
+        auto pfnAppendGraphExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendGraphExt;
         if( nullptr == pfnAppendGraphExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -18120,7 +18128,7 @@ zeCommandListAppendGraphExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendGraphExt = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendGraphExt;
+    auto pfnAppendGraphExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendGraphExt;
     if( nullptr == pfnAppendGraphExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -18165,7 +18173,7 @@ zeExecutableGraphGetSourceGraphExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnExecutableGraphGetSourceGraphExt_t pfnGetSourceGraphExt = [&result] {
-        auto pfnGetSourceGraphExt = ze_lib::context->zeDdiTable.load()->ExecutableGraph.pfnGetSourceGraphExt;
+        auto pfnGetSourceGraphExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->ExecutableGraph.pfnGetSourceGraphExt;
         if( nullptr == pfnGetSourceGraphExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -18180,7 +18188,7 @@ zeExecutableGraphGetSourceGraphExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetSourceGraphExt = ze_lib::context->zeDdiTable.load()->ExecutableGraph.pfnGetSourceGraphExt;
+    auto pfnGetSourceGraphExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->ExecutableGraph.pfnGetSourceGraphExt;
     if( nullptr == pfnGetSourceGraphExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -18230,7 +18238,7 @@ zeGraphIsEmptyExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnGraphIsEmptyExt_t pfnIsEmptyExt = [&result] {
-        auto pfnIsEmptyExt = ze_lib::context->zeDdiTable.load()->Graph.pfnIsEmptyExt;
+        auto pfnIsEmptyExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Graph.pfnIsEmptyExt;
         if( nullptr == pfnIsEmptyExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -18245,7 +18253,7 @@ zeGraphIsEmptyExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnIsEmptyExt = ze_lib::context->zeDdiTable.load()->Graph.pfnIsEmptyExt;
+    auto pfnIsEmptyExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Graph.pfnIsEmptyExt;
     if( nullptr == pfnIsEmptyExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -18298,7 +18306,7 @@ zeGraphDumpContentsExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnGraphDumpContentsExt_t pfnDumpContentsExt = [&result] {
-        auto pfnDumpContentsExt = ze_lib::context->zeDdiTable.load()->Graph.pfnDumpContentsExt;
+        auto pfnDumpContentsExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Graph.pfnDumpContentsExt;
         if( nullptr == pfnDumpContentsExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -18313,7 +18321,7 @@ zeGraphDumpContentsExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDumpContentsExt = ze_lib::context->zeDdiTable.load()->Graph.pfnDumpContentsExt;
+    auto pfnDumpContentsExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Graph.pfnDumpContentsExt;
     if( nullptr == pfnDumpContentsExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -18361,7 +18369,7 @@ zeExecutableGraphDestroyExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnExecutableGraphDestroyExt_t pfnDestroyExt = [&result] {
-        auto pfnDestroyExt = ze_lib::context->zeDdiTable.load()->ExecutableGraph.pfnDestroyExt;
+        auto pfnDestroyExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->ExecutableGraph.pfnDestroyExt;
         if( nullptr == pfnDestroyExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -18376,7 +18384,7 @@ zeExecutableGraphDestroyExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroyExt = ze_lib::context->zeDdiTable.load()->ExecutableGraph.pfnDestroyExt;
+    auto pfnDestroyExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->ExecutableGraph.pfnDestroyExt;
     if( nullptr == pfnDestroyExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -18424,7 +18432,7 @@ zeGraphDestroyExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnGraphDestroyExt_t pfnDestroyExt = [&result] {
-        auto pfnDestroyExt = ze_lib::context->zeDdiTable.load()->Graph.pfnDestroyExt;
+        auto pfnDestroyExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Graph.pfnDestroyExt;
         if( nullptr == pfnDestroyExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -18439,7 +18447,7 @@ zeGraphDestroyExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroyExt = ze_lib::context->zeDdiTable.load()->Graph.pfnDestroyExt;
+    auto pfnDestroyExt = ze_lib::zeDdiTable.load(std::memory_order_acquire)->Graph.pfnDestroyExt;
     if( nullptr == pfnDestroyExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -18513,7 +18521,7 @@ zeCommandListAppendHostFunction(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const ze_pfnCommandListAppendHostFunction_t pfnAppendHostFunction = [&result] {
-        auto pfnAppendHostFunction = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendHostFunction;
+        auto pfnAppendHostFunction = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendHostFunction;
         if( nullptr == pfnAppendHostFunction ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -18528,7 +18536,7 @@ zeCommandListAppendHostFunction(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendHostFunction = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendHostFunction;
+    auto pfnAppendHostFunction = ze_lib::zeDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendHostFunction;
     if( nullptr == pfnAppendHostFunction ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
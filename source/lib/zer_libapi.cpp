@@ -60,7 +60,7 @@ zerGetLastErrorDescription(
         return ZE_RESULT_SUCCESS;
     }
     static const zer_pfnGetLastErrorDescription_t pfnGetLastErrorDescription = [&result] {
-        auto pfnGetLastErrorDescription = ze_lib::context->zerDdiTable.load()->Global.pfnGetLastErrorDescription;
+        auto pfnGetLastErrorDescription = ze_lib::zerDdiTable.load(std::memory_order_acquire)->Global.pfnGetLastErrorDescription;
         if( nullptr == pfnGetLastErrorDescription ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -80,7 +80,7 @@ zerGetLastErrorDescription(
     {
         return ZE_RESULT_SUCCESS;
     }
-    auto pfnGetLastErrorDescription = ze_lib::context->zerDdiTable.load()->Global.pfnGetLastErrorDescription;
+    auto pfnGetLastErrorDescription = ze_lib::zerDdiTable.load(std::memory_order_acquire)->Global.pfnGetLastErrorDescription;
     if( nullptr == pfnGetLastErrorDescription ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -115,7 +115,7 @@ zerTranslateDeviceHandleToIdentifier(
         return UINT32_MAX;
     }
     static const zer_pfnTranslateDeviceHandleToIdentifier_t pfnTranslateDeviceHandleToIdentifier = [] {
-        auto pfnTranslateDeviceHandleToIdentifier = ze_lib::context->zerDdiTable.load()->Global.pfnTranslateDeviceHandleToIdentifier;
+        auto pfnTranslateDeviceHandleToIdentifier = ze_lib::zerDdiTable.load(std::memory_order_acquire)->Global.pfnTranslateDeviceHandleToIdentifier;
         return pfnTranslateDeviceHandleToIdentifier;
     }();
     if (nullptr == pfnTranslateDeviceHandleToIdentifier) {
@@ -129,7 +129,7 @@ zerTranslateDeviceHandleToIdentifier(
         return UINT32_MAX;
     }
 
-    auto pfnTranslateDeviceHandleToIdentifier = ze_lib::context->zerDdiTable.load()->Global.pfnTranslateDeviceHandleToIdentifier;
+    auto pfnTranslateDeviceHandleToIdentifier = ze_lib::zerDdiTable.load(std::memory_order_acquire)->Global.pfnTranslateDeviceHandleToIdentifier;
     if( nullptr == pfnTranslateDeviceHandleToIdentifier ) {
         if(!ze_lib::context->isInitialized)
             error_state::setErrorDesc("ERROR UNINITIALIZED");
@@ -168,7 +168,7 @@ zerTranslateIdentifierToDeviceHandle(
         return nullptr;
     }
     static const zer_pfnTranslateIdentifierToDeviceHandle_t pfnTranslateIdentifierToDeviceHandle = [] {
-        auto pfnTranslateIdentifierToDeviceHandle = ze_lib::context->zerDdiTable.load()->Global.pfnTranslateIdentifierToDeviceHandle;
+        auto pfnTranslateIdentifierToDeviceHandle = ze_lib::zerDdiTable.load(std::memory_order_acquire)->Global.pfnTranslateIdentifierToDeviceHandle;
         return pfnTranslateIdentifierToDeviceHandle;
     }();
     if (nullptr == pfnTranslateIdentifierToDeviceHandle) {
@@ -182,7 +182,7 @@ zerTranslateIdentifierToDeviceHandle(
         return nullptr;
     }
 
-    auto pfnTranslateIdentifierToDeviceHandle = ze_lib::context->zerDdiTable.load()->Global.pfnTranslateIdentifierToDeviceHandle;
+    auto pfnTranslateIdentifierToDeviceHandle = ze_lib::zerDdiTable.load(std::memory_order_acquire)->Global.pfnTranslateIdentifierToDeviceHandle;
     if( nullptr == pfnTranslateIdentifierToDeviceHandle ) {
         if(!ze_lib::context->isInitialized)
             error_state::setErrorDesc("ERROR UNINITIALIZED");
@@ -223,7 +223,7 @@ zerGetDefaultContext(
         return nullptr;
     }
     static const zer_pfnGetDefaultContext_t pfnGetDefaultContext = [] {
-        auto pfnGetDefaultContext = ze_lib::context->zerDdiTable.load()->Global.pfnGetDefaultContext;
+        auto pfnGetDefaultContext = ze_lib::zerDdiTable.load(std::memory_order_acquire)->Global.pfnGetDefaultContext;
         return pfnGetDefaultContext;
     }();
     if (nullptr == pfnGetDefaultContext) {
@@ -237,7 +237,7 @@ zerGetDefaultContext(
         return nullptr;
     }
 
-    auto pfnGetDefaultContext = ze_lib::context->zerDdiTable.load()->Global.pfnGetDefaultContext;
+    auto pfnGetDefaultContext = ze_lib::zerDdiTable.load(std::memory_order_acquire)->Global.pfnGetDefaultContext;
     if( nullptr == pfnGetDefaultContext ) {
         if(!ze_lib::context->isInitialized)
             error_state::setErrorDesc("ERROR UNINITIALIZED");
@@ -75,7 +75,7 @@ zesInit(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnInit = ze_lib::context->zesDdiTable.load()->Global.pfnInit;
+    auto pfnInit = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Global.pfnInit;
     if( nullptr == pfnInit ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -83,7 +83,13 @@ zesInit(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnInit( flags );
+    ze_result_t initResult = pfnInit( flags );
+    if (initResult == ZE_RESULT_SUCCESS) {
+        // Like the loader's component handle caches, sysman snapshots
+        // enumerate every device's components again.
+        ze_lib::context->sysmanSnapshot.clear();
+    }
+    return initResult;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -132,11 +138,11 @@ zesDriverGet(
     if(ze_lib::destruction) {
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
-    if (!ze_lib::context || ze_lib::context->zesDdiTable == nullptr) {
+    if (ze_lib::zesDdiTable.load(std::memory_order_acquire) == nullptr) {
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDriverGet_t pfnGet = [&result] {
-        auto pfnGet = ze_lib::context->zesDdiTable.load()->Driver.pfnGet;
+        auto pfnGet = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Driver.pfnGet;
         if( nullptr == pfnGet ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -151,11 +157,11 @@ zesDriverGet(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (ze_lib::context->zesDdiTable == nullptr) {
+    if (ze_lib::zesDdiTable.load(std::memory_order_acquire) == nullptr) {
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGet = ze_lib::context->zesDdiTable.load()->Driver.pfnGet;
+    auto pfnGet = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Driver.pfnGet;
     if( nullptr == pfnGet ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -214,7 +220,7 @@ zesDriverGetExtensionProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDriverGetExtensionProperties_t pfnGetExtensionProperties = [&result] {
-        auto pfnGetExtensionProperties = ze_lib::context->zesDdiTable.load()->Driver.pfnGetExtensionProperties;
+        auto pfnGetExtensionProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Driver.pfnGetExtensionProperties;
         if( nullptr == pfnGetExtensionProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -229,7 +235,7 @@ zesDriverGetExtensionProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetExtensionProperties = ze_lib::context->zesDdiTable.load()->Driver.pfnGetExtensionProperties;
+    auto pfnGetExtensionProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Driver.pfnGetExtensionProperties;
     if( nullptr == pfnGetExtensionProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -281,7 +287,7 @@ zesDriverGetExtensionFunctionAddress(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDriverGetExtensionFunctionAddress_t pfnGetExtensionFunctionAddress = [&result] {
-        auto pfnGetExtensionFunctionAddress = ze_lib::context->zesDdiTable.load()->Driver.pfnGetExtensionFunctionAddress;
+        auto pfnGetExtensionFunctionAddress = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Driver.pfnGetExtensionFunctionAddress;
         if( nullptr == pfnGetExtensionFunctionAddress ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -296,7 +302,7 @@ zesDriverGetExtensionFunctionAddress(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetExtensionFunctionAddress = ze_lib::context->zesDdiTable.load()->Driver.pfnGetExtensionFunctionAddress;
+    auto pfnGetExtensionFunctionAddress = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Driver.pfnGetExtensionFunctionAddress;
     if( nullptr == pfnGetExtensionFunctionAddress ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -358,7 +364,7 @@ zesDeviceGet(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceGet_t pfnGet = [&result] {
-        auto pfnGet = ze_lib::context->zesDdiTable.load()->Device.pfnGet;
+        auto pfnGet = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnGet;
         if( nullptr == pfnGet ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -373,7 +379,7 @@ zesDeviceGet(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGet = ze_lib::context->zesDdiTable.load()->Device.pfnGet;
+    auto pfnGet = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnGet;
     if( nullptr == pfnGet ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -422,7 +428,7 @@ zesDeviceGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceGetProperties_t pfnGetProperties = [&result] {
-        auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Device.pfnGetProperties;
+        auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnGetProperties;
         if( nullptr == pfnGetProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -437,7 +443,7 @@ zesDeviceGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Device.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -487,7 +493,7 @@ zesDeviceGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceGetState_t pfnGetState = [&result] {
-        auto pfnGetState = ze_lib::context->zesDdiTable.load()->Device.pfnGetState;
+        auto pfnGetState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnGetState;
         if( nullptr == pfnGetState ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -502,7 +508,7 @@ zesDeviceGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetState = ze_lib::context->zesDdiTable.load()->Device.pfnGetState;
+    auto pfnGetState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnGetState;
     if( nullptr == pfnGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -561,7 +567,7 @@ zesDeviceReset(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceReset_t pfnReset = [&result] {
-        auto pfnReset = ze_lib::context->zesDdiTable.load()->Device.pfnReset;
+        auto pfnReset = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnReset;
         if( nullptr == pfnReset ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -570,13 +576,17 @@ zesDeviceReset(
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
-    return pfnReset( hDevice, force );
+    result = pfnReset( hDevice, force );
+    // The components of the device may change across a reset, even a failed
+    // one; its next snapshot enumerates them again.
+    ze_lib::context->sysmanSnapshot.invalidate(hDevice);
+    return result;
     #else
     if(ze_lib::destruction) {
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReset = ze_lib::context->zesDdiTable.load()->Device.pfnReset;
+    auto pfnReset = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnReset;
     if( nullptr == pfnReset ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -584,7 +594,11 @@ zesDeviceReset(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnReset( hDevice, force );
+    ze_result_t result = pfnReset( hDevice, force );
+    // The components of the device may change across a reset, even a failed
+    // one; its next snapshot enumerates them again.
+    ze_lib::context->sysmanSnapshot.invalidate(hDevice);
+    return result;
     #endif
 }
 
@@ -636,7 +650,7 @@ zesDeviceResetExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceResetExt_t pfnResetExt = [&result] {
-        auto pfnResetExt = ze_lib::context->zesDdiTable.load()->Device.pfnResetExt;
+        auto pfnResetExt = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnResetExt;
         if( nullptr == pfnResetExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -645,13 +659,17 @@ zesDeviceResetExt(
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
-    return pfnResetExt( hDevice, pProperties );
+    result = pfnResetExt( hDevice, pProperties );
+    // The components of the device may change across a reset, even a failed
+    // one; its next snapshot enumerates them again.
+    ze_lib::context->sysmanSnapshot.invalidate(hDevice);
+    return result;
     #else
     if(ze_lib::destruction) {
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnResetExt = ze_lib::context->zesDdiTable.load()->Device.pfnResetExt;
+    auto pfnResetExt = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnResetExt;
     if( nullptr == pfnResetExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -659,7 +677,11 @@ zesDeviceResetExt(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnResetExt( hDevice, pProperties );
+    ze_result_t result = pfnResetExt( hDevice, pProperties );
+    // The components of the device may change across a reset, even a failed
+    // one; its next snapshot enumerates them again.
+    ze_lib::context->sysmanSnapshot.invalidate(hDevice);
+    return result;
     #endif
 }
 
@@ -718,7 +740,7 @@ zesDeviceProcessesGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceProcessesGetState_t pfnProcessesGetState = [&result] {
-        auto pfnProcessesGetState = ze_lib::context->zesDdiTable.load()->Device.pfnProcessesGetState;
+        auto pfnProcessesGetState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnProcessesGetState;
         if( nullptr == pfnProcessesGetState ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -733,7 +755,7 @@ zesDeviceProcessesGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnProcessesGetState = ze_lib::context->zesDdiTable.load()->Device.pfnProcessesGetState;
+    auto pfnProcessesGetState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnProcessesGetState;
     if( nullptr == pfnProcessesGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -782,7 +804,7 @@ zesDevicePciGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDevicePciGetProperties_t pfnPciGetProperties = [&result] {
-        auto pfnPciGetProperties = ze_lib::context->zesDdiTable.load()->Device.pfnPciGetProperties;
+        auto pfnPciGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnPciGetProperties;
         if( nullptr == pfnPciGetProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -797,7 +819,7 @@ zesDevicePciGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnPciGetProperties = ze_lib::context->zesDdiTable.load()->Device.pfnPciGetProperties;
+    auto pfnPciGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnPciGetProperties;
     if( nullptr == pfnPciGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -846,7 +868,7 @@ zesDevicePciGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDevicePciGetState_t pfnPciGetState = [&result] {
-        auto pfnPciGetState = ze_lib::context->zesDdiTable.load()->Device.pfnPciGetState;
+        auto pfnPciGetState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnPciGetState;
         if( nullptr == pfnPciGetState ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -861,7 +883,7 @@ zesDevicePciGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnPciGetState = ze_lib::context->zesDdiTable.load()->Device.pfnPciGetState;
+    auto pfnPciGetState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnPciGetState;
     if( nullptr == pfnPciGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -918,7 +940,7 @@ zesDevicePciGetBars(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDevicePciGetBars_t pfnPciGetBars = [&result] {
-        auto pfnPciGetBars = ze_lib::context->zesDdiTable.load()->Device.pfnPciGetBars;
+        auto pfnPciGetBars = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnPciGetBars;
         if( nullptr == pfnPciGetBars ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -933,7 +955,7 @@ zesDevicePciGetBars(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnPciGetBars = ze_lib::context->zesDdiTable.load()->Device.pfnPciGetBars;
+    auto pfnPciGetBars = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnPciGetBars;
     if( nullptr == pfnPciGetBars ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -983,7 +1005,7 @@ zesDevicePciGetStats(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDevicePciGetStats_t pfnPciGetStats = [&result] {
-        auto pfnPciGetStats = ze_lib::context->zesDdiTable.load()->Device.pfnPciGetStats;
+        auto pfnPciGetStats = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnPciGetStats;
         if( nullptr == pfnPciGetStats ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -998,7 +1020,7 @@ zesDevicePciGetStats(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnPciGetStats = ze_lib::context->zesDdiTable.load()->Device.pfnPciGetStats;
+    auto pfnPciGetStats = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnPciGetStats;
     if( nullptr == pfnPciGetStats ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1046,7 +1068,7 @@ zesDeviceSetOverclockWaiver(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceSetOverclockWaiver_t pfnSetOverclockWaiver = [&result] {
-        auto pfnSetOverclockWaiver = ze_lib::context->zesDdiTable.load()->Device.pfnSetOverclockWaiver;
+        auto pfnSetOverclockWaiver = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnSetOverclockWaiver;
         if( nullptr == pfnSetOverclockWaiver ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1061,7 +1083,7 @@ zesDeviceSetOverclockWaiver(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetOverclockWaiver = ze_lib::context->zesDdiTable.load()->Device.pfnSetOverclockWaiver;
+    auto pfnSetOverclockWaiver = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnSetOverclockWaiver;
     if( nullptr == pfnSetOverclockWaiver ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1113,7 +1135,7 @@ zesDeviceGetOverclockDomains(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceGetOverclockDomains_t pfnGetOverclockDomains = [&result] {
-        auto pfnGetOverclockDomains = ze_lib::context->zesDdiTable.load()->Device.pfnGetOverclockDomains;
+        auto pfnGetOverclockDomains = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnGetOverclockDomains;
         if( nullptr == pfnGetOverclockDomains ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1128,7 +1150,7 @@ zesDeviceGetOverclockDomains(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetOverclockDomains = ze_lib::context->zesDdiTable.load()->Device.pfnGetOverclockDomains;
+    auto pfnGetOverclockDomains = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnGetOverclockDomains;
     if( nullptr == pfnGetOverclockDomains ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1185,7 +1207,7 @@ zesDeviceGetOverclockControls(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceGetOverclockControls_t pfnGetOverclockControls = [&result] {
-        auto pfnGetOverclockControls = ze_lib::context->zesDdiTable.load()->Device.pfnGetOverclockControls;
+        auto pfnGetOverclockControls = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnGetOverclockControls;
         if( nullptr == pfnGetOverclockControls ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1200,7 +1222,7 @@ zesDeviceGetOverclockControls(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetOverclockControls = ze_lib::context->zesDdiTable.load()->Device.pfnGetOverclockControls;
+    auto pfnGetOverclockControls = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnGetOverclockControls;
     if( nullptr == pfnGetOverclockControls ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1250,7 +1272,7 @@ zesDeviceResetOverclockSettings(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceResetOverclockSettings_t pfnResetOverclockSettings = [&result] {
-        auto pfnResetOverclockSettings = ze_lib::context->zesDdiTable.load()->Device.pfnResetOverclockSettings;
+        auto pfnResetOverclockSettings = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnResetOverclockSettings;
         if( nullptr == pfnResetOverclockSettings ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1265,7 +1287,7 @@ zesDeviceResetOverclockSettings(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnResetOverclockSettings = ze_lib::context->zesDdiTable.load()->Device.pfnResetOverclockSettings;
+    auto pfnResetOverclockSettings = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnResetOverclockSettings;
     if( nullptr == pfnResetOverclockSettings ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1324,7 +1346,7 @@ zesDeviceReadOverclockState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceReadOverclockState_t pfnReadOverclockState = [&result] {
-        auto pfnReadOverclockState = ze_lib::context->zesDdiTable.load()->Device.pfnReadOverclockState;
+        auto pfnReadOverclockState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnReadOverclockState;
         if( nullptr == pfnReadOverclockState ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1339,7 +1361,7 @@ zesDeviceReadOverclockState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReadOverclockState = ze_lib::context->zesDdiTable.load()->Device.pfnReadOverclockState;
+    auto pfnReadOverclockState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnReadOverclockState;
     if( nullptr == pfnReadOverclockState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1398,7 +1420,7 @@ zesDeviceEnumOverclockDomains(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceEnumOverclockDomains_t pfnEnumOverclockDomains = [&result] {
-        auto pfnEnumOverclockDomains = ze_lib::context->zesDdiTable.load()->Device.pfnEnumOverclockDomains;
+        auto pfnEnumOverclockDomains = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumOverclockDomains;
         if( nullptr == pfnEnumOverclockDomains ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1413,7 +1435,7 @@ zesDeviceEnumOverclockDomains(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumOverclockDomains = ze_lib::context->zesDdiTable.load()->Device.pfnEnumOverclockDomains;
+    auto pfnEnumOverclockDomains = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumOverclockDomains;
     if( nullptr == pfnEnumOverclockDomains ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1463,7 +1485,7 @@ zesOverclockGetDomainProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnOverclockGetDomainProperties_t pfnGetDomainProperties = [&result] {
-        auto pfnGetDomainProperties = ze_lib::context->zesDdiTable.load()->Overclock.pfnGetDomainProperties;
+        auto pfnGetDomainProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Overclock.pfnGetDomainProperties;
         if( nullptr == pfnGetDomainProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1478,7 +1500,7 @@ zesOverclockGetDomainProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetDomainProperties = ze_lib::context->zesDdiTable.load()->Overclock.pfnGetDomainProperties;
+    auto pfnGetDomainProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Overclock.pfnGetDomainProperties;
     if( nullptr == pfnGetDomainProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1528,7 +1550,7 @@ zesOverclockGetDomainVFProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnOverclockGetDomainVFProperties_t pfnGetDomainVFProperties = [&result] {
-        auto pfnGetDomainVFProperties = ze_lib::context->zesDdiTable.load()->Overclock.pfnGetDomainVFProperties;
+        auto pfnGetDomainVFProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Overclock.pfnGetDomainVFProperties;
         if( nullptr == pfnGetDomainVFProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1543,7 +1565,7 @@ zesOverclockGetDomainVFProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetDomainVFProperties = ze_lib::context->zesDdiTable.load()->Overclock.pfnGetDomainVFProperties;
+    auto pfnGetDomainVFProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Overclock.pfnGetDomainVFProperties;
     if( nullptr == pfnGetDomainVFProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1597,7 +1619,7 @@ zesOverclockGetDomainControlProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnOverclockGetDomainControlProperties_t pfnGetDomainControlProperties = [&result] {
-        auto pfnGetDomainControlProperties = ze_lib::context->zesDdiTable.load()->Overclock.pfnGetDomainControlProperties;
+        auto pfnGetDomainControlProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Overclock.pfnGetDomainControlProperties;
         if( nullptr == pfnGetDomainControlProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1612,7 +1634,7 @@ zesOverclockGetDomainControlProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetDomainControlProperties = ze_lib::context->zesDdiTable.load()->Overclock.pfnGetDomainControlProperties;
+    auto pfnGetDomainControlProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Overclock.pfnGetDomainControlProperties;
     if( nullptr == pfnGetDomainControlProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1666,7 +1688,7 @@ zesOverclockGetControlCurrentValue(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnOverclockGetControlCurrentValue_t pfnGetControlCurrentValue = [&result] {
-        auto pfnGetControlCurrentValue = ze_lib::context->zesDdiTable.load()->Overclock.pfnGetControlCurrentValue;
+        auto pfnGetControlCurrentValue = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Overclock.pfnGetControlCurrentValue;
         if( nullptr == pfnGetControlCurrentValue ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1681,7 +1703,7 @@ zesOverclockGetControlCurrentValue(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetControlCurrentValue = ze_lib::context->zesDdiTable.load()->Overclock.pfnGetControlCurrentValue;
+    auto pfnGetControlCurrentValue = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Overclock.pfnGetControlCurrentValue;
     if( nullptr == pfnGetControlCurrentValue ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1736,7 +1758,7 @@ zesOverclockGetControlPendingValue(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnOverclockGetControlPendingValue_t pfnGetControlPendingValue = [&result] {
-        auto pfnGetControlPendingValue = ze_lib::context->zesDdiTable.load()->Overclock.pfnGetControlPendingValue;
+        auto pfnGetControlPendingValue = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Overclock.pfnGetControlPendingValue;
         if( nullptr == pfnGetControlPendingValue ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1751,7 +1773,7 @@ zesOverclockGetControlPendingValue(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetControlPendingValue = ze_lib::context->zesDdiTable.load()->Overclock.pfnGetControlPendingValue;
+    auto pfnGetControlPendingValue = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Overclock.pfnGetControlPendingValue;
     if( nullptr == pfnGetControlPendingValue ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1807,7 +1829,7 @@ zesOverclockSetControlUserValue(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnOverclockSetControlUserValue_t pfnSetControlUserValue = [&result] {
-        auto pfnSetControlUserValue = ze_lib::context->zesDdiTable.load()->Overclock.pfnSetControlUserValue;
+        auto pfnSetControlUserValue = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Overclock.pfnSetControlUserValue;
         if( nullptr == pfnSetControlUserValue ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1822,7 +1844,7 @@ zesOverclockSetControlUserValue(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetControlUserValue = ze_lib::context->zesDdiTable.load()->Overclock.pfnSetControlUserValue;
+    auto pfnSetControlUserValue = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Overclock.pfnSetControlUserValue;
     if( nullptr == pfnSetControlUserValue ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1878,7 +1900,7 @@ zesOverclockGetControlState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnOverclockGetControlState_t pfnGetControlState = [&result] {
-        auto pfnGetControlState = ze_lib::context->zesDdiTable.load()->Overclock.pfnGetControlState;
+        auto pfnGetControlState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Overclock.pfnGetControlState;
         if( nullptr == pfnGetControlState ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1893,7 +1915,7 @@ zesOverclockGetControlState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetControlState = ze_lib::context->zesDdiTable.load()->Overclock.pfnGetControlState;
+    auto pfnGetControlState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Overclock.pfnGetControlState;
     if( nullptr == pfnGetControlState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1952,7 +1974,7 @@ zesOverclockGetVFPointValues(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnOverclockGetVFPointValues_t pfnGetVFPointValues = [&result] {
-        auto pfnGetVFPointValues = ze_lib::context->zesDdiTable.load()->Overclock.pfnGetVFPointValues;
+        auto pfnGetVFPointValues = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Overclock.pfnGetVFPointValues;
         if( nullptr == pfnGetVFPointValues ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1967,7 +1989,7 @@ zesOverclockGetVFPointValues(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetVFPointValues = ze_lib::context->zesDdiTable.load()->Overclock.pfnGetVFPointValues;
+    auto pfnGetVFPointValues = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Overclock.pfnGetVFPointValues;
     if( nullptr == pfnGetVFPointValues ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2021,7 +2043,7 @@ zesOverclockSetVFPointValues(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnOverclockSetVFPointValues_t pfnSetVFPointValues = [&result] {
-        auto pfnSetVFPointValues = ze_lib::context->zesDdiTable.load()->Overclock.pfnSetVFPointValues;
+        auto pfnSetVFPointValues = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Overclock.pfnSetVFPointValues;
         if( nullptr == pfnSetVFPointValues ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2036,7 +2058,7 @@ zesOverclockSetVFPointValues(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetVFPointValues = ze_lib::context->zesDdiTable.load()->Overclock.pfnSetVFPointValues;
+    auto pfnSetVFPointValues = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Overclock.pfnSetVFPointValues;
     if( nullptr == pfnSetVFPointValues ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2095,7 +2117,7 @@ zesDeviceEnumDiagnosticTestSuites(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceEnumDiagnosticTestSuites_t pfnEnumDiagnosticTestSuites = [&result] {
-        auto pfnEnumDiagnosticTestSuites = ze_lib::context->zesDdiTable.load()->Device.pfnEnumDiagnosticTestSuites;
+        auto pfnEnumDiagnosticTestSuites = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumDiagnosticTestSuites;
         if( nullptr == pfnEnumDiagnosticTestSuites ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2110,7 +2132,7 @@ zesDeviceEnumDiagnosticTestSuites(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumDiagnosticTestSuites = ze_lib::context->zesDdiTable.load()->Device.pfnEnumDiagnosticTestSuites;
+    auto pfnEnumDiagnosticTestSuites = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumDiagnosticTestSuites;
     if( nullptr == pfnEnumDiagnosticTestSuites ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2160,7 +2182,7 @@ zesDiagnosticsGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDiagnosticsGetProperties_t pfnGetProperties = [&result] {
-        auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Diagnostics.pfnGetProperties;
+        auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Diagnostics.pfnGetProperties;
         if( nullptr == pfnGetProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2175,7 +2197,7 @@ zesDiagnosticsGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Diagnostics.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Diagnostics.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2236,7 +2258,7 @@ zesDiagnosticsGetTests(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDiagnosticsGetTests_t pfnGetTests = [&result] {
-        auto pfnGetTests = ze_lib::context->zesDdiTable.load()->Diagnostics.pfnGetTests;
+        auto pfnGetTests = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Diagnostics.pfnGetTests;
         if( nullptr == pfnGetTests ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2251,7 +2273,7 @@ zesDiagnosticsGetTests(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetTests = ze_lib::context->zesDdiTable.load()->Diagnostics.pfnGetTests;
+    auto pfnGetTests = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Diagnostics.pfnGetTests;
     if( nullptr == pfnGetTests ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2314,7 +2336,7 @@ zesDiagnosticsRunTests(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDiagnosticsRunTests_t pfnRunTests = [&result] {
-        auto pfnRunTests = ze_lib::context->zesDdiTable.load()->Diagnostics.pfnRunTests;
+        auto pfnRunTests = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Diagnostics.pfnRunTests;
         if( nullptr == pfnRunTests ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2329,7 +2351,7 @@ zesDiagnosticsRunTests(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnRunTests = ze_lib::context->zesDdiTable.load()->Diagnostics.pfnRunTests;
+    auto pfnRunTests = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Diagnostics.pfnRunTests;
     if( nullptr == pfnRunTests ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2378,7 +2400,7 @@ zesDeviceEccAvailable(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceEccAvailable_t pfnEccAvailable = [&result] {
-        auto pfnEccAvailable = ze_lib::context->zesDdiTable.load()->Device.pfnEccAvailable;
+        auto pfnEccAvailable = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEccAvailable;
         if( nullptr == pfnEccAvailable ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2393,7 +2415,7 @@ zesDeviceEccAvailable(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEccAvailable = ze_lib::context->zesDdiTable.load()->Device.pfnEccAvailable;
+    auto pfnEccAvailable = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEccAvailable;
     if( nullptr == pfnEccAvailable ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2442,7 +2464,7 @@ zesDeviceEccConfigurable(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceEccConfigurable_t pfnEccConfigurable = [&result] {
-        auto pfnEccConfigurable = ze_lib::context->zesDdiTable.load()->Device.pfnEccConfigurable;
+        auto pfnEccConfigurable = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEccConfigurable;
         if( nullptr == pfnEccConfigurable ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2457,7 +2479,7 @@ zesDeviceEccConfigurable(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEccConfigurable = ze_lib::context->zesDdiTable.load()->Device.pfnEccConfigurable;
+    auto pfnEccConfigurable = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEccConfigurable;
     if( nullptr == pfnEccConfigurable ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2506,7 +2528,7 @@ zesDeviceGetEccState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceGetEccState_t pfnGetEccState = [&result] {
-        auto pfnGetEccState = ze_lib::context->zesDdiTable.load()->Device.pfnGetEccState;
+        auto pfnGetEccState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnGetEccState;
         if( nullptr == pfnGetEccState ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2521,7 +2543,7 @@ zesDeviceGetEccState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetEccState = ze_lib::context->zesDdiTable.load()->Device.pfnGetEccState;
+    auto pfnGetEccState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnGetEccState;
     if( nullptr == pfnGetEccState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2579,7 +2601,7 @@ zesDeviceSetEccState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceSetEccState_t pfnSetEccState = [&result] {
-        auto pfnSetEccState = ze_lib::context->zesDdiTable.load()->Device.pfnSetEccState;
+        auto pfnSetEccState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnSetEccState;
         if( nullptr == pfnSetEccState ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2594,7 +2616,7 @@ zesDeviceSetEccState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetEccState = ze_lib::context->zesDdiTable.load()->Device.pfnSetEccState;
+    auto pfnSetEccState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnSetEccState;
     if( nullptr == pfnSetEccState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2653,7 +2675,7 @@ zesDeviceEnumEngineGroups(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceEnumEngineGroups_t pfnEnumEngineGroups = [&result] {
-        auto pfnEnumEngineGroups = ze_lib::context->zesDdiTable.load()->Device.pfnEnumEngineGroups;
+        auto pfnEnumEngineGroups = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumEngineGroups;
         if( nullptr == pfnEnumEngineGroups ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2668,7 +2690,7 @@ zesDeviceEnumEngineGroups(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumEngineGroups = ze_lib::context->zesDdiTable.load()->Device.pfnEnumEngineGroups;
+    auto pfnEnumEngineGroups = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumEngineGroups;
     if( nullptr == pfnEnumEngineGroups ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2717,7 +2739,7 @@ zesEngineGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnEngineGetProperties_t pfnGetProperties = [&result] {
-        auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Engine.pfnGetProperties;
+        auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Engine.pfnGetProperties;
         if( nullptr == pfnGetProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2732,7 +2754,7 @@ zesEngineGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Engine.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Engine.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2784,7 +2806,7 @@ zesEngineGetActivity(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnEngineGetActivity_t pfnGetActivity = [&result] {
-        auto pfnGetActivity = ze_lib::context->zesDdiTable.load()->Engine.pfnGetActivity;
+        auto pfnGetActivity = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Engine.pfnGetActivity;
         if( nullptr == pfnGetActivity ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2799,7 +2821,7 @@ zesEngineGetActivity(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetActivity = ze_lib::context->zesDdiTable.load()->Engine.pfnGetActivity;
+    auto pfnGetActivity = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Engine.pfnGetActivity;
     if( nullptr == pfnGetActivity ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2849,7 +2871,7 @@ zesDeviceEventRegister(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceEventRegister_t pfnEventRegister = [&result] {
-        auto pfnEventRegister = ze_lib::context->zesDdiTable.load()->Device.pfnEventRegister;
+        auto pfnEventRegister = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEventRegister;
         if( nullptr == pfnEventRegister ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2864,7 +2886,7 @@ zesDeviceEventRegister(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEventRegister = ze_lib::context->zesDdiTable.load()->Device.pfnEventRegister;
+    auto pfnEventRegister = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEventRegister;
     if( nullptr == pfnEventRegister ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2933,7 +2955,7 @@ zesDriverEventListen(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDriverEventListen_t pfnEventListen = [&result] {
-        auto pfnEventListen = ze_lib::context->zesDdiTable.load()->Driver.pfnEventListen;
+        auto pfnEventListen = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Driver.pfnEventListen;
         if( nullptr == pfnEventListen ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2942,13 +2964,23 @@ zesDriverEventListen(
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
-    return pfnEventListen( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
+    result = pfnEventListen( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
+    // Devices attached, detached or needing a reset have their components
+    // enumerated again by their next snapshot.
+    if (ZE_RESULT_SUCCESS == result && nullptr != phDevices && nullptr != pEvents) {
+        for (uint32_t i = 0; i < count; ++i) {
+            if (pEvents[i] & (ZES_EVENT_TYPE_FLAG_DEVICE_DETACH | ZES_EVENT_TYPE_FLAG_DEVICE_ATTACH | ZES_EVENT_TYPE_FLAG_DEVICE_RESET_REQUIRED)) {
+                ze_lib::context->sysmanSnapshot.invalidate(phDevices[i]);
+            }
+        }
+    }
+    return result;
     #else
     if(ze_lib::destruction) {
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEventListen = ze_lib::context->zesDdiTable.load()->Driver.pfnEventListen;
+    auto pfnEventListen = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Driver.pfnEventListen;
     if( nullptr == pfnEventListen ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2956,7 +2988,17 @@ zesDriverEventListen(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnEventListen( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
+    ze_result_t result = pfnEventListen( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
+    // Devices attached, detached or needing a reset have their components
+    // enumerated again by their next snapshot.
+    if (ZE_RESULT_SUCCESS == result && nullptr != phDevices && nullptr != pEvents) {
+        for (uint32_t i = 0; i < count; ++i) {
+            if (pEvents[i] & (ZES_EVENT_TYPE_FLAG_DEVICE_DETACH | ZES_EVENT_TYPE_FLAG_DEVICE_ATTACH | ZES_EVENT_TYPE_FLAG_DEVICE_RESET_REQUIRED)) {
+                ze_lib::context->sysmanSnapshot.invalidate(phDevices[i]);
+            }
+        }
+    }
+    return result;
     #endif
 }
 
@@ -3017,7 +3059,7 @@ zesDriverEventListenEx(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDriverEventListenEx_t pfnEventListenEx = [&result] {
-        auto pfnEventListenEx = ze_lib::context->zesDdiTable.load()->Driver.pfnEventListenEx;
+        auto pfnEventListenEx = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Driver.pfnEventListenEx;
         if( nullptr == pfnEventListenEx ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3026,13 +3068,23 @@ zesDriverEventListenEx(
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
-    return pfnEventListenEx( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
+    result = pfnEventListenEx( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
+    // Devices attached, detached or needing a reset have their components
+    // enumerated again by their next snapshot.
+    if (ZE_RESULT_SUCCESS == result && nullptr != phDevices && nullptr != pEvents) {
+        for (uint32_t i = 0; i < count; ++i) {
+            if (pEvents[i] & (ZES_EVENT_TYPE_FLAG_DEVICE_DETACH | ZES_EVENT_TYPE_FLAG_DEVICE_ATTACH | ZES_EVENT_TYPE_FLAG_DEVICE_RESET_REQUIRED)) {
+                ze_lib::context->sysmanSnapshot.invalidate(phDevices[i]);
+            }
+        }
+    }
+    return result;
     #else
     if(ze_lib::destruction) {
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEventListenEx = ze_lib::context->zesDdiTable.load()->Driver.pfnEventListenEx;
+    auto pfnEventListenEx = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Driver.pfnEventListenEx;
     if( nullptr == pfnEventListenEx ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3040,7 +3092,17 @@ zesDriverEventListenEx(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnEventListenEx( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
+    ze_result_t result = pfnEventListenEx( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
+    // Devices attached, detached or needing a reset have their components
+    // enumerated again by their next snapshot.
+    if (ZE_RESULT_SUCCESS == result && nullptr != phDevices && nullptr != pEvents) {
+        for (uint32_t i = 0; i < count; ++i) {
+            if (pEvents[i] & (ZES_EVENT_TYPE_FLAG_DEVICE_DETACH | ZES_EVENT_TYPE_FLAG_DEVICE_ATTACH | ZES_EVENT_TYPE_FLAG_DEVICE_RESET_REQUIRED)) {
+                ze_lib::context->sysmanSnapshot.invalidate(phDevices[i]);
+            }
+        }
+    }
+    return result;
     #endif
 }
 
@@ -3091,7 +3153,7 @@ zesDeviceEnumFabricPorts(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceEnumFabricPorts_t pfnEnumFabricPorts = [&result] {
-        auto pfnEnumFabricPorts = ze_lib::context->zesDdiTable.load()->Device.pfnEnumFabricPorts;
+        auto pfnEnumFabricPorts = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumFabricPorts;
         if( nullptr == pfnEnumFabricPorts ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3106,7 +3168,7 @@ zesDeviceEnumFabricPorts(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumFabricPorts = ze_lib::context->zesDdiTable.load()->Device.pfnEnumFabricPorts;
+    auto pfnEnumFabricPorts = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumFabricPorts;
     if( nullptr == pfnEnumFabricPorts ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3155,7 +3217,7 @@ zesFabricPortGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFabricPortGetProperties_t pfnGetProperties = [&result] {
-        auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->FabricPort.pfnGetProperties;
+        auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->FabricPort.pfnGetProperties;
         if( nullptr == pfnGetProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3170,7 +3232,7 @@ zesFabricPortGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->FabricPort.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->FabricPort.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3220,7 +3282,7 @@ zesFabricPortGetLinkType(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFabricPortGetLinkType_t pfnGetLinkType = [&result] {
-        auto pfnGetLinkType = ze_lib::context->zesDdiTable.load()->FabricPort.pfnGetLinkType;
+        auto pfnGetLinkType = ze_lib::zesDdiTable.load(std::memory_order_acquire)->FabricPort.pfnGetLinkType;
         if( nullptr == pfnGetLinkType ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3235,7 +3297,7 @@ zesFabricPortGetLinkType(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetLinkType = ze_lib::context->zesDdiTable.load()->FabricPort.pfnGetLinkType;
+    auto pfnGetLinkType = ze_lib::zesDdiTable.load(std::memory_order_acquire)->FabricPort.pfnGetLinkType;
     if( nullptr == pfnGetLinkType ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3284,7 +3346,7 @@ zesFabricPortGetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFabricPortGetConfig_t pfnGetConfig = [&result] {
-        auto pfnGetConfig = ze_lib::context->zesDdiTable.load()->FabricPort.pfnGetConfig;
+        auto pfnGetConfig = ze_lib::zesDdiTable.load(std::memory_order_acquire)->FabricPort.pfnGetConfig;
         if( nullptr == pfnGetConfig ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3299,7 +3361,7 @@ zesFabricPortGetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetConfig = ze_lib::context->zesDdiTable.load()->FabricPort.pfnGetConfig;
+    auto pfnGetConfig = ze_lib::zesDdiTable.load(std::memory_order_acquire)->FabricPort.pfnGetConfig;
     if( nullptr == pfnGetConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3349,7 +3411,7 @@ zesFabricPortSetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFabricPortSetConfig_t pfnSetConfig = [&result] {
-        auto pfnSetConfig = ze_lib::context->zesDdiTable.load()->FabricPort.pfnSetConfig;
+        auto pfnSetConfig = ze_lib::zesDdiTable.load(std::memory_order_acquire)->FabricPort.pfnSetConfig;
         if( nullptr == pfnSetConfig ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3364,7 +3426,7 @@ zesFabricPortSetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetConfig = ze_lib::context->zesDdiTable.load()->FabricPort.pfnSetConfig;
+    auto pfnSetConfig = ze_lib::zesDdiTable.load(std::memory_order_acquire)->FabricPort.pfnSetConfig;
     if( nullptr == pfnSetConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3414,7 +3476,7 @@ zesFabricPortGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFabricPortGetState_t pfnGetState = [&result] {
-        auto pfnGetState = ze_lib::context->zesDdiTable.load()->FabricPort.pfnGetState;
+        auto pfnGetState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->FabricPort.pfnGetState;
         if( nullptr == pfnGetState ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3429,7 +3491,7 @@ zesFabricPortGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetState = ze_lib::context->zesDdiTable.load()->FabricPort.pfnGetState;
+    auto pfnGetState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->FabricPort.pfnGetState;
     if( nullptr == pfnGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3479,7 +3541,7 @@ zesFabricPortGetThroughput(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFabricPortGetThroughput_t pfnGetThroughput = [&result] {
-        auto pfnGetThroughput = ze_lib::context->zesDdiTable.load()->FabricPort.pfnGetThroughput;
+        auto pfnGetThroughput = ze_lib::zesDdiTable.load(std::memory_order_acquire)->FabricPort.pfnGetThroughput;
         if( nullptr == pfnGetThroughput ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3494,7 +3556,7 @@ zesFabricPortGetThroughput(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetThroughput = ze_lib::context->zesDdiTable.load()->FabricPort.pfnGetThroughput;
+    auto pfnGetThroughput = ze_lib::zesDdiTable.load(std::memory_order_acquire)->FabricPort.pfnGetThroughput;
     if( nullptr == pfnGetThroughput ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3547,7 +3609,7 @@ zesFabricPortGetFabricErrorCounters(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFabricPortGetFabricErrorCounters_t pfnGetFabricErrorCounters = [&result] {
-        auto pfnGetFabricErrorCounters = ze_lib::context->zesDdiTable.load()->FabricPort.pfnGetFabricErrorCounters;
+        auto pfnGetFabricErrorCounters = ze_lib::zesDdiTable.load(std::memory_order_acquire)->FabricPort.pfnGetFabricErrorCounters;
         if( nullptr == pfnGetFabricErrorCounters ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3562,7 +3624,7 @@ zesFabricPortGetFabricErrorCounters(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetFabricErrorCounters = ze_lib::context->zesDdiTable.load()->FabricPort.pfnGetFabricErrorCounters;
+    auto pfnGetFabricErrorCounters = ze_lib::zesDdiTable.load(std::memory_order_acquire)->FabricPort.pfnGetFabricErrorCounters;
     if( nullptr == pfnGetFabricErrorCounters ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3616,7 +3678,7 @@ zesFabricPortGetMultiPortThroughput(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFabricPortGetMultiPortThroughput_t pfnGetMultiPortThroughput = [&result] {
-        auto pfnGetMultiPortThroughput = ze_lib::context->zesDdiTable.load()->FabricPort.pfnGetMultiPortThroughput;
+        auto pfnGetMultiPortThroughput = ze_lib::zesDdiTable.load(std::memory_order_acquire)->FabricPort.pfnGetMultiPortThroughput;
         if( nullptr == pfnGetMultiPortThroughput ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3631,7 +3693,7 @@ zesFabricPortGetMultiPortThroughput(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetMultiPortThroughput = ze_lib::context->zesDdiTable.load()->FabricPort.pfnGetMultiPortThroughput;
+    auto pfnGetMultiPortThroughput = ze_lib::zesDdiTable.load(std::memory_order_acquire)->FabricPort.pfnGetMultiPortThroughput;
     if( nullptr == pfnGetMultiPortThroughput ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3690,7 +3752,7 @@ zesDeviceEnumFans(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceEnumFans_t pfnEnumFans = [&result] {
-        auto pfnEnumFans = ze_lib::context->zesDdiTable.load()->Device.pfnEnumFans;
+        auto pfnEnumFans = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumFans;
         if( nullptr == pfnEnumFans ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3705,7 +3767,7 @@ zesDeviceEnumFans(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumFans = ze_lib::context->zesDdiTable.load()->Device.pfnEnumFans;
+    auto pfnEnumFans = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumFans;
     if( nullptr == pfnEnumFans ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3754,7 +3816,7 @@ zesFanGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFanGetProperties_t pfnGetProperties = [&result] {
-        auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Fan.pfnGetProperties;
+        auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Fan.pfnGetProperties;
         if( nullptr == pfnGetProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3769,7 +3831,7 @@ zesFanGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Fan.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Fan.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3819,7 +3881,7 @@ zesFanGetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFanGetConfig_t pfnGetConfig = [&result] {
-        auto pfnGetConfig = ze_lib::context->zesDdiTable.load()->Fan.pfnGetConfig;
+        auto pfnGetConfig = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Fan.pfnGetConfig;
         if( nullptr == pfnGetConfig ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3834,7 +3896,7 @@ zesFanGetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetConfig = ze_lib::context->zesDdiTable.load()->Fan.pfnGetConfig;
+    auto pfnGetConfig = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Fan.pfnGetConfig;
     if( nullptr == pfnGetConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3882,7 +3944,7 @@ zesFanSetDefaultMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFanSetDefaultMode_t pfnSetDefaultMode = [&result] {
-        auto pfnSetDefaultMode = ze_lib::context->zesDdiTable.load()->Fan.pfnSetDefaultMode;
+        auto pfnSetDefaultMode = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Fan.pfnSetDefaultMode;
         if( nullptr == pfnSetDefaultMode ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3897,7 +3959,7 @@ zesFanSetDefaultMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetDefaultMode = ze_lib::context->zesDdiTable.load()->Fan.pfnSetDefaultMode;
+    auto pfnSetDefaultMode = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Fan.pfnSetDefaultMode;
     if( nullptr == pfnSetDefaultMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3949,7 +4011,7 @@ zesFanSetFixedSpeedMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFanSetFixedSpeedMode_t pfnSetFixedSpeedMode = [&result] {
-        auto pfnSetFixedSpeedMode = ze_lib::context->zesDdiTable.load()->Fan.pfnSetFixedSpeedMode;
+        auto pfnSetFixedSpeedMode = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Fan.pfnSetFixedSpeedMode;
         if( nullptr == pfnSetFixedSpeedMode ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3964,7 +4026,7 @@ zesFanSetFixedSpeedMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetFixedSpeedMode = ze_lib::context->zesDdiTable.load()->Fan.pfnSetFixedSpeedMode;
+    auto pfnSetFixedSpeedMode = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Fan.pfnSetFixedSpeedMode;
     if( nullptr == pfnSetFixedSpeedMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4017,7 +4079,7 @@ zesFanSetSpeedTableMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFanSetSpeedTableMode_t pfnSetSpeedTableMode = [&result] {
-        auto pfnSetSpeedTableMode = ze_lib::context->zesDdiTable.load()->Fan.pfnSetSpeedTableMode;
+        auto pfnSetSpeedTableMode = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Fan.pfnSetSpeedTableMode;
         if( nullptr == pfnSetSpeedTableMode ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4032,7 +4094,7 @@ zesFanSetSpeedTableMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetSpeedTableMode = ze_lib::context->zesDdiTable.load()->Fan.pfnSetSpeedTableMode;
+    auto pfnSetSpeedTableMode = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Fan.pfnSetSpeedTableMode;
     if( nullptr == pfnSetSpeedTableMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4088,7 +4150,7 @@ zesFanGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFanGetState_t pfnGetState = [&result] {
-        auto pfnGetState = ze_lib::context->zesDdiTable.load()->Fan.pfnGetState;
+        auto pfnGetState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Fan.pfnGetState;
         if( nullptr == pfnGetState ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4103,7 +4165,7 @@ zesFanGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetState = ze_lib::context->zesDdiTable.load()->Fan.pfnGetState;
+    auto pfnGetState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Fan.pfnGetState;
     if( nullptr == pfnGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4162,7 +4224,7 @@ zesDeviceEnumFirmwares(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceEnumFirmwares_t pfnEnumFirmwares = [&result] {
-        auto pfnEnumFirmwares = ze_lib::context->zesDdiTable.load()->Device.pfnEnumFirmwares;
+        auto pfnEnumFirmwares = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumFirmwares;
         if( nullptr == pfnEnumFirmwares ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4177,7 +4239,7 @@ zesDeviceEnumFirmwares(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumFirmwares = ze_lib::context->zesDdiTable.load()->Device.pfnEnumFirmwares;
+    auto pfnEnumFirmwares = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumFirmwares;
     if( nullptr == pfnEnumFirmwares ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4227,7 +4289,7 @@ zesFirmwareGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFirmwareGetProperties_t pfnGetProperties = [&result] {
-        auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Firmware.pfnGetProperties;
+        auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Firmware.pfnGetProperties;
         if( nullptr == pfnGetProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4242,7 +4304,7 @@ zesFirmwareGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Firmware.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Firmware.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4297,7 +4359,7 @@ zesFirmwareFlash(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFirmwareFlash_t pfnFlash = [&result] {
-        auto pfnFlash = ze_lib::context->zesDdiTable.load()->Firmware.pfnFlash;
+        auto pfnFlash = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Firmware.pfnFlash;
         if( nullptr == pfnFlash ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4312,7 +4374,7 @@ zesFirmwareFlash(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnFlash = ze_lib::context->zesDdiTable.load()->Firmware.pfnFlash;
+    auto pfnFlash = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Firmware.pfnFlash;
     if( nullptr == pfnFlash ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4361,7 +4423,7 @@ zesFirmwareGetFlashProgress(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFirmwareGetFlashProgress_t pfnGetFlashProgress = [&result] {
-        auto pfnGetFlashProgress = ze_lib::context->zesDdiTable.load()->Firmware.pfnGetFlashProgress;
+        auto pfnGetFlashProgress = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Firmware.pfnGetFlashProgress;
         if( nullptr == pfnGetFlashProgress ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4376,7 +4438,7 @@ zesFirmwareGetFlashProgress(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetFlashProgress = ze_lib::context->zesDdiTable.load()->Firmware.pfnGetFlashProgress;
+    auto pfnGetFlashProgress = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Firmware.pfnGetFlashProgress;
     if( nullptr == pfnGetFlashProgress ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4429,7 +4491,7 @@ zesFirmwareGetConsoleLogs(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFirmwareGetConsoleLogs_t pfnGetConsoleLogs = [&result] {
-        auto pfnGetConsoleLogs = ze_lib::context->zesDdiTable.load()->Firmware.pfnGetConsoleLogs;
+        auto pfnGetConsoleLogs = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Firmware.pfnGetConsoleLogs;
         if( nullptr == pfnGetConsoleLogs ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4444,7 +4506,7 @@ zesFirmwareGetConsoleLogs(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetConsoleLogs = ze_lib::context->zesDdiTable.load()->Firmware.pfnGetConsoleLogs;
+    auto pfnGetConsoleLogs = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Firmware.pfnGetConsoleLogs;
     if( nullptr == pfnGetConsoleLogs ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4503,7 +4565,7 @@ zesDeviceEnumFrequencyDomains(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceEnumFrequencyDomains_t pfnEnumFrequencyDomains = [&result] {
-        auto pfnEnumFrequencyDomains = ze_lib::context->zesDdiTable.load()->Device.pfnEnumFrequencyDomains;
+        auto pfnEnumFrequencyDomains = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumFrequencyDomains;
         if( nullptr == pfnEnumFrequencyDomains ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4518,7 +4580,7 @@ zesDeviceEnumFrequencyDomains(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumFrequencyDomains = ze_lib::context->zesDdiTable.load()->Device.pfnEnumFrequencyDomains;
+    auto pfnEnumFrequencyDomains = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumFrequencyDomains;
     if( nullptr == pfnEnumFrequencyDomains ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4567,7 +4629,7 @@ zesFrequencyGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFrequencyGetProperties_t pfnGetProperties = [&result] {
-        auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Frequency.pfnGetProperties;
+        auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnGetProperties;
         if( nullptr == pfnGetProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4582,7 +4644,7 @@ zesFrequencyGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Frequency.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4642,7 +4704,7 @@ zesFrequencyGetAvailableClocks(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFrequencyGetAvailableClocks_t pfnGetAvailableClocks = [&result] {
-        auto pfnGetAvailableClocks = ze_lib::context->zesDdiTable.load()->Frequency.pfnGetAvailableClocks;
+        auto pfnGetAvailableClocks = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnGetAvailableClocks;
         if( nullptr == pfnGetAvailableClocks ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4657,7 +4719,7 @@ zesFrequencyGetAvailableClocks(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetAvailableClocks = ze_lib::context->zesDdiTable.load()->Frequency.pfnGetAvailableClocks;
+    auto pfnGetAvailableClocks = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnGetAvailableClocks;
     if( nullptr == pfnGetAvailableClocks ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4707,7 +4769,7 @@ zesFrequencyGetRange(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFrequencyGetRange_t pfnGetRange = [&result] {
-        auto pfnGetRange = ze_lib::context->zesDdiTable.load()->Frequency.pfnGetRange;
+        auto pfnGetRange = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnGetRange;
         if( nullptr == pfnGetRange ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4722,7 +4784,7 @@ zesFrequencyGetRange(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetRange = ze_lib::context->zesDdiTable.load()->Frequency.pfnGetRange;
+    auto pfnGetRange = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnGetRange;
     if( nullptr == pfnGetRange ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4776,7 +4838,7 @@ zesFrequencySetRange(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFrequencySetRange_t pfnSetRange = [&result] {
-        auto pfnSetRange = ze_lib::context->zesDdiTable.load()->Frequency.pfnSetRange;
+        auto pfnSetRange = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnSetRange;
         if( nullptr == pfnSetRange ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4791,7 +4853,7 @@ zesFrequencySetRange(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetRange = ze_lib::context->zesDdiTable.load()->Frequency.pfnSetRange;
+    auto pfnSetRange = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnSetRange;
     if( nullptr == pfnSetRange ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4841,7 +4903,7 @@ zesFrequencyGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFrequencyGetState_t pfnGetState = [&result] {
-        auto pfnGetState = ze_lib::context->zesDdiTable.load()->Frequency.pfnGetState;
+        auto pfnGetState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnGetState;
         if( nullptr == pfnGetState ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4856,7 +4918,7 @@ zesFrequencyGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetState = ze_lib::context->zesDdiTable.load()->Frequency.pfnGetState;
+    auto pfnGetState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnGetState;
     if( nullptr == pfnGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4906,7 +4968,7 @@ zesFrequencyGetThrottleTime(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFrequencyGetThrottleTime_t pfnGetThrottleTime = [&result] {
-        auto pfnGetThrottleTime = ze_lib::context->zesDdiTable.load()->Frequency.pfnGetThrottleTime;
+        auto pfnGetThrottleTime = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnGetThrottleTime;
         if( nullptr == pfnGetThrottleTime ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4921,7 +4983,7 @@ zesFrequencyGetThrottleTime(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetThrottleTime = ze_lib::context->zesDdiTable.load()->Frequency.pfnGetThrottleTime;
+    auto pfnGetThrottleTime = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnGetThrottleTime;
     if( nullptr == pfnGetThrottleTime ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4971,7 +5033,7 @@ zesFrequencyOcGetCapabilities(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFrequencyOcGetCapabilities_t pfnOcGetCapabilities = [&result] {
-        auto pfnOcGetCapabilities = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcGetCapabilities;
+        auto pfnOcGetCapabilities = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnOcGetCapabilities;
         if( nullptr == pfnOcGetCapabilities ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4986,7 +5048,7 @@ zesFrequencyOcGetCapabilities(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcGetCapabilities = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcGetCapabilities;
+    auto pfnOcGetCapabilities = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnOcGetCapabilities;
     if( nullptr == pfnOcGetCapabilities ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5045,7 +5107,7 @@ zesFrequencyOcGetFrequencyTarget(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFrequencyOcGetFrequencyTarget_t pfnOcGetFrequencyTarget = [&result] {
-        auto pfnOcGetFrequencyTarget = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcGetFrequencyTarget;
+        auto pfnOcGetFrequencyTarget = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnOcGetFrequencyTarget;
         if( nullptr == pfnOcGetFrequencyTarget ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -5060,7 +5122,7 @@ zesFrequencyOcGetFrequencyTarget(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcGetFrequencyTarget = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcGetFrequencyTarget;
+    auto pfnOcGetFrequencyTarget = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnOcGetFrequencyTarget;
     if( nullptr == pfnOcGetFrequencyTarget ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5117,7 +5179,7 @@ zesFrequencyOcSetFrequencyTarget(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFrequencyOcSetFrequencyTarget_t pfnOcSetFrequencyTarget = [&result] {
-        auto pfnOcSetFrequencyTarget = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcSetFrequencyTarget;
+        auto pfnOcSetFrequencyTarget = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnOcSetFrequencyTarget;
         if( nullptr == pfnOcSetFrequencyTarget ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -5132,7 +5194,7 @@ zesFrequencyOcSetFrequencyTarget(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcSetFrequencyTarget = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcSetFrequencyTarget;
+    auto pfnOcSetFrequencyTarget = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnOcSetFrequencyTarget;
     if( nullptr == pfnOcSetFrequencyTarget ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5193,7 +5255,7 @@ zesFrequencyOcGetVoltageTarget(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFrequencyOcGetVoltageTarget_t pfnOcGetVoltageTarget = [&result] {
-        auto pfnOcGetVoltageTarget = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcGetVoltageTarget;
+        auto pfnOcGetVoltageTarget = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnOcGetVoltageTarget;
         if( nullptr == pfnOcGetVoltageTarget ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -5208,7 +5270,7 @@ zesFrequencyOcGetVoltageTarget(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcGetVoltageTarget = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcGetVoltageTarget;
+    auto pfnOcGetVoltageTarget = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnOcGetVoltageTarget;
     if( nullptr == pfnOcGetVoltageTarget ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5266,7 +5328,7 @@ zesFrequencyOcSetVoltageTarget(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFrequencyOcSetVoltageTarget_t pfnOcSetVoltageTarget = [&result] {
-        auto pfnOcSetVoltageTarget = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcSetVoltageTarget;
+        auto pfnOcSetVoltageTarget = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnOcSetVoltageTarget;
         if( nullptr == pfnOcSetVoltageTarget ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -5281,7 +5343,7 @@ zesFrequencyOcSetVoltageTarget(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcSetVoltageTarget = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcSetVoltageTarget;
+    auto pfnOcSetVoltageTarget = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnOcSetVoltageTarget;
     if( nullptr == pfnOcSetVoltageTarget ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5337,7 +5399,7 @@ zesFrequencyOcSetMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFrequencyOcSetMode_t pfnOcSetMode = [&result] {
-        auto pfnOcSetMode = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcSetMode;
+        auto pfnOcSetMode = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnOcSetMode;
         if( nullptr == pfnOcSetMode ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -5352,7 +5414,7 @@ zesFrequencyOcSetMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcSetMode = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcSetMode;
+    auto pfnOcSetMode = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnOcSetMode;
     if( nullptr == pfnOcSetMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5407,7 +5469,7 @@ zesFrequencyOcGetMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFrequencyOcGetMode_t pfnOcGetMode = [&result] {
-        auto pfnOcGetMode = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcGetMode;
+        auto pfnOcGetMode = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnOcGetMode;
         if( nullptr == pfnOcGetMode ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -5422,7 +5484,7 @@ zesFrequencyOcGetMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcGetMode = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcGetMode;
+    auto pfnOcGetMode = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnOcGetMode;
     if( nullptr == pfnOcGetMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5475,7 +5537,7 @@ zesFrequencyOcGetIccMax(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFrequencyOcGetIccMax_t pfnOcGetIccMax = [&result] {
-        auto pfnOcGetIccMax = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcGetIccMax;
+        auto pfnOcGetIccMax = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnOcGetIccMax;
         if( nullptr == pfnOcGetIccMax ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -5490,7 +5552,7 @@ zesFrequencyOcGetIccMax(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcGetIccMax = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcGetIccMax;
+    auto pfnOcGetIccMax = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnOcGetIccMax;
     if( nullptr == pfnOcGetIccMax ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5544,7 +5606,7 @@ zesFrequencyOcSetIccMax(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFrequencyOcSetIccMax_t pfnOcSetIccMax = [&result] {
-        auto pfnOcSetIccMax = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcSetIccMax;
+        auto pfnOcSetIccMax = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnOcSetIccMax;
         if( nullptr == pfnOcSetIccMax ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -5559,7 +5621,7 @@ zesFrequencyOcSetIccMax(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcSetIccMax = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcSetIccMax;
+    auto pfnOcSetIccMax = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnOcSetIccMax;
     if( nullptr == pfnOcSetIccMax ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5611,7 +5673,7 @@ zesFrequencyOcGetTjMax(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFrequencyOcGetTjMax_t pfnOcGetTjMax = [&result] {
-        auto pfnOcGetTjMax = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcGetTjMax;
+        auto pfnOcGetTjMax = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnOcGetTjMax;
         if( nullptr == pfnOcGetTjMax ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -5626,7 +5688,7 @@ zesFrequencyOcGetTjMax(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcGetTjMax = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcGetTjMax;
+    auto pfnOcGetTjMax = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnOcGetTjMax;
     if( nullptr == pfnOcGetTjMax ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5680,7 +5742,7 @@ zesFrequencyOcSetTjMax(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFrequencyOcSetTjMax_t pfnOcSetTjMax = [&result] {
-        auto pfnOcSetTjMax = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcSetTjMax;
+        auto pfnOcSetTjMax = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnOcSetTjMax;
         if( nullptr == pfnOcSetTjMax ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -5695,7 +5757,7 @@ zesFrequencyOcSetTjMax(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcSetTjMax = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcSetTjMax;
+    auto pfnOcSetTjMax = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Frequency.pfnOcSetTjMax;
     if( nullptr == pfnOcSetTjMax ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5754,7 +5816,7 @@ zesDeviceEnumLeds(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceEnumLeds_t pfnEnumLeds = [&result] {
-        auto pfnEnumLeds = ze_lib::context->zesDdiTable.load()->Device.pfnEnumLeds;
+        auto pfnEnumLeds = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumLeds;
         if( nullptr == pfnEnumLeds ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -5769,7 +5831,7 @@ zesDeviceEnumLeds(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumLeds = ze_lib::context->zesDdiTable.load()->Device.pfnEnumLeds;
+    auto pfnEnumLeds = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumLeds;
     if( nullptr == pfnEnumLeds ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5818,7 +5880,7 @@ zesLedGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnLedGetProperties_t pfnGetProperties = [&result] {
-        auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Led.pfnGetProperties;
+        auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Led.pfnGetProperties;
         if( nullptr == pfnGetProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -5833,7 +5895,7 @@ zesLedGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Led.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Led.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5882,7 +5944,7 @@ zesLedGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnLedGetState_t pfnGetState = [&result] {
-        auto pfnGetState = ze_lib::context->zesDdiTable.load()->Led.pfnGetState;
+        auto pfnGetState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Led.pfnGetState;
         if( nullptr == pfnGetState ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -5897,7 +5959,7 @@ zesLedGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetState = ze_lib::context->zesDdiTable.load()->Led.pfnGetState;
+    auto pfnGetState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Led.pfnGetState;
     if( nullptr == pfnGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5945,7 +6007,7 @@ zesLedSetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnLedSetState_t pfnSetState = [&result] {
-        auto pfnSetState = ze_lib::context->zesDdiTable.load()->Led.pfnSetState;
+        auto pfnSetState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Led.pfnSetState;
         if( nullptr == pfnSetState ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -5960,7 +6022,7 @@ zesLedSetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetState = ze_lib::context->zesDdiTable.load()->Led.pfnSetState;
+    auto pfnSetState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Led.pfnSetState;
     if( nullptr == pfnSetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6011,7 +6073,7 @@ zesLedSetColor(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnLedSetColor_t pfnSetColor = [&result] {
-        auto pfnSetColor = ze_lib::context->zesDdiTable.load()->Led.pfnSetColor;
+        auto pfnSetColor = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Led.pfnSetColor;
         if( nullptr == pfnSetColor ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6026,7 +6088,7 @@ zesLedSetColor(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetColor = ze_lib::context->zesDdiTable.load()->Led.pfnSetColor;
+    auto pfnSetColor = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Led.pfnSetColor;
     if( nullptr == pfnSetColor ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6085,7 +6147,7 @@ zesDeviceEnumMemoryModules(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceEnumMemoryModules_t pfnEnumMemoryModules = [&result] {
-        auto pfnEnumMemoryModules = ze_lib::context->zesDdiTable.load()->Device.pfnEnumMemoryModules;
+        auto pfnEnumMemoryModules = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumMemoryModules;
         if( nullptr == pfnEnumMemoryModules ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6100,7 +6162,7 @@ zesDeviceEnumMemoryModules(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumMemoryModules = ze_lib::context->zesDdiTable.load()->Device.pfnEnumMemoryModules;
+    auto pfnEnumMemoryModules = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumMemoryModules;
     if( nullptr == pfnEnumMemoryModules ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6149,7 +6211,7 @@ zesMemoryGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnMemoryGetProperties_t pfnGetProperties = [&result] {
-        auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Memory.pfnGetProperties;
+        auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Memory.pfnGetProperties;
         if( nullptr == pfnGetProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6164,7 +6226,7 @@ zesMemoryGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Memory.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Memory.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6213,7 +6275,7 @@ zesMemoryGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnMemoryGetState_t pfnGetState = [&result] {
-        auto pfnGetState = ze_lib::context->zesDdiTable.load()->Memory.pfnGetState;
+        auto pfnGetState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Memory.pfnGetState;
         if( nullptr == pfnGetState ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6228,7 +6290,7 @@ zesMemoryGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetState = ze_lib::context->zesDdiTable.load()->Memory.pfnGetState;
+    auto pfnGetState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Memory.pfnGetState;
     if( nullptr == pfnGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6279,7 +6341,7 @@ zesMemoryGetBandwidth(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnMemoryGetBandwidth_t pfnGetBandwidth = [&result] {
-        auto pfnGetBandwidth = ze_lib::context->zesDdiTable.load()->Memory.pfnGetBandwidth;
+        auto pfnGetBandwidth = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Memory.pfnGetBandwidth;
         if( nullptr == pfnGetBandwidth ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6294,7 +6356,7 @@ zesMemoryGetBandwidth(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetBandwidth = ze_lib::context->zesDdiTable.load()->Memory.pfnGetBandwidth;
+    auto pfnGetBandwidth = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Memory.pfnGetBandwidth;
     if( nullptr == pfnGetBandwidth ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6355,7 +6417,7 @@ zesDeviceEnumPerformanceFactorDomains(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceEnumPerformanceFactorDomains_t pfnEnumPerformanceFactorDomains = [&result] {
-        auto pfnEnumPerformanceFactorDomains = ze_lib::context->zesDdiTable.load()->Device.pfnEnumPerformanceFactorDomains;
+        auto pfnEnumPerformanceFactorDomains = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumPerformanceFactorDomains;
         if( nullptr == pfnEnumPerformanceFactorDomains ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6370,7 +6432,7 @@ zesDeviceEnumPerformanceFactorDomains(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumPerformanceFactorDomains = ze_lib::context->zesDdiTable.load()->Device.pfnEnumPerformanceFactorDomains;
+    auto pfnEnumPerformanceFactorDomains = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumPerformanceFactorDomains;
     if( nullptr == pfnEnumPerformanceFactorDomains ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6420,7 +6482,7 @@ zesPerformanceFactorGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnPerformanceFactorGetProperties_t pfnGetProperties = [&result] {
-        auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->PerformanceFactor.pfnGetProperties;
+        auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->PerformanceFactor.pfnGetProperties;
         if( nullptr == pfnGetProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6435,7 +6497,7 @@ zesPerformanceFactorGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->PerformanceFactor.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->PerformanceFactor.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6485,7 +6547,7 @@ zesPerformanceFactorGetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnPerformanceFactorGetConfig_t pfnGetConfig = [&result] {
-        auto pfnGetConfig = ze_lib::context->zesDdiTable.load()->PerformanceFactor.pfnGetConfig;
+        auto pfnGetConfig = ze_lib::zesDdiTable.load(std::memory_order_acquire)->PerformanceFactor.pfnGetConfig;
         if( nullptr == pfnGetConfig ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6500,7 +6562,7 @@ zesPerformanceFactorGetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetConfig = ze_lib::context->zesDdiTable.load()->PerformanceFactor.pfnGetConfig;
+    auto pfnGetConfig = ze_lib::zesDdiTable.load(std::memory_order_acquire)->PerformanceFactor.pfnGetConfig;
     if( nullptr == pfnGetConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6552,7 +6614,7 @@ zesPerformanceFactorSetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnPerformanceFactorSetConfig_t pfnSetConfig = [&result] {
-        auto pfnSetConfig = ze_lib::context->zesDdiTable.load()->PerformanceFactor.pfnSetConfig;
+        auto pfnSetConfig = ze_lib::zesDdiTable.load(std::memory_order_acquire)->PerformanceFactor.pfnSetConfig;
         if( nullptr == pfnSetConfig ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6567,7 +6629,7 @@ zesPerformanceFactorSetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetConfig = ze_lib::context->zesDdiTable.load()->PerformanceFactor.pfnSetConfig;
+    auto pfnSetConfig = ze_lib::zesDdiTable.load(std::memory_order_acquire)->PerformanceFactor.pfnSetConfig;
     if( nullptr == pfnSetConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6626,7 +6688,7 @@ zesDeviceEnumPowerDomains(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceEnumPowerDomains_t pfnEnumPowerDomains = [&result] {
-        auto pfnEnumPowerDomains = ze_lib::context->zesDdiTable.load()->Device.pfnEnumPowerDomains;
+        auto pfnEnumPowerDomains = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumPowerDomains;
         if( nullptr == pfnEnumPowerDomains ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6641,7 +6703,7 @@ zesDeviceEnumPowerDomains(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumPowerDomains = ze_lib::context->zesDdiTable.load()->Device.pfnEnumPowerDomains;
+    auto pfnEnumPowerDomains = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumPowerDomains;
     if( nullptr == pfnEnumPowerDomains ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6692,7 +6754,7 @@ zesDeviceGetCardPowerDomain(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceGetCardPowerDomain_t pfnGetCardPowerDomain = [&result] {
-        auto pfnGetCardPowerDomain = ze_lib::context->zesDdiTable.load()->Device.pfnGetCardPowerDomain;
+        auto pfnGetCardPowerDomain = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnGetCardPowerDomain;
         if( nullptr == pfnGetCardPowerDomain ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6707,7 +6769,7 @@ zesDeviceGetCardPowerDomain(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetCardPowerDomain = ze_lib::context->zesDdiTable.load()->Device.pfnGetCardPowerDomain;
+    auto pfnGetCardPowerDomain = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnGetCardPowerDomain;
     if( nullptr == pfnGetCardPowerDomain ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6756,7 +6818,7 @@ zesPowerGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnPowerGetProperties_t pfnGetProperties = [&result] {
-        auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Power.pfnGetProperties;
+        auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Power.pfnGetProperties;
         if( nullptr == pfnGetProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6771,7 +6833,7 @@ zesPowerGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Power.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Power.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6821,7 +6883,7 @@ zesPowerGetEnergyCounter(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnPowerGetEnergyCounter_t pfnGetEnergyCounter = [&result] {
-        auto pfnGetEnergyCounter = ze_lib::context->zesDdiTable.load()->Power.pfnGetEnergyCounter;
+        auto pfnGetEnergyCounter = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Power.pfnGetEnergyCounter;
         if( nullptr == pfnGetEnergyCounter ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6836,7 +6898,7 @@ zesPowerGetEnergyCounter(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetEnergyCounter = ze_lib::context->zesDdiTable.load()->Power.pfnGetEnergyCounter;
+    auto pfnGetEnergyCounter = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Power.pfnGetEnergyCounter;
     if( nullptr == pfnGetEnergyCounter ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6889,7 +6951,7 @@ zesPowerGetLimits(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnPowerGetLimits_t pfnGetLimits = [&result] {
-        auto pfnGetLimits = ze_lib::context->zesDdiTable.load()->Power.pfnGetLimits;
+        auto pfnGetLimits = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Power.pfnGetLimits;
         if( nullptr == pfnGetLimits ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6904,7 +6966,7 @@ zesPowerGetLimits(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetLimits = ze_lib::context->zesDdiTable.load()->Power.pfnGetLimits;
+    auto pfnGetLimits = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Power.pfnGetLimits;
     if( nullptr == pfnGetLimits ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6959,7 +7021,7 @@ zesPowerSetLimits(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnPowerSetLimits_t pfnSetLimits = [&result] {
-        auto pfnSetLimits = ze_lib::context->zesDdiTable.load()->Power.pfnSetLimits;
+        auto pfnSetLimits = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Power.pfnSetLimits;
         if( nullptr == pfnSetLimits ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -6974,7 +7036,7 @@ zesPowerSetLimits(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetLimits = ze_lib::context->zesDdiTable.load()->Power.pfnSetLimits;
+    auto pfnSetLimits = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Power.pfnSetLimits;
     if( nullptr == pfnSetLimits ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7026,7 +7088,7 @@ zesPowerGetEnergyThreshold(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnPowerGetEnergyThreshold_t pfnGetEnergyThreshold = [&result] {
-        auto pfnGetEnergyThreshold = ze_lib::context->zesDdiTable.load()->Power.pfnGetEnergyThreshold;
+        auto pfnGetEnergyThreshold = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Power.pfnGetEnergyThreshold;
         if( nullptr == pfnGetEnergyThreshold ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7041,7 +7103,7 @@ zesPowerGetEnergyThreshold(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetEnergyThreshold = ze_lib::context->zesDdiTable.load()->Power.pfnGetEnergyThreshold;
+    auto pfnGetEnergyThreshold = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Power.pfnGetEnergyThreshold;
     if( nullptr == pfnGetEnergyThreshold ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7105,7 +7167,7 @@ zesPowerSetEnergyThreshold(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnPowerSetEnergyThreshold_t pfnSetEnergyThreshold = [&result] {
-        auto pfnSetEnergyThreshold = ze_lib::context->zesDdiTable.load()->Power.pfnSetEnergyThreshold;
+        auto pfnSetEnergyThreshold = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Power.pfnSetEnergyThreshold;
         if( nullptr == pfnSetEnergyThreshold ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7120,7 +7182,7 @@ zesPowerSetEnergyThreshold(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetEnergyThreshold = ze_lib::context->zesDdiTable.load()->Power.pfnSetEnergyThreshold;
+    auto pfnSetEnergyThreshold = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Power.pfnSetEnergyThreshold;
     if( nullptr == pfnSetEnergyThreshold ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7173,7 +7235,7 @@ zesPowerGetUsage(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnPowerGetUsage_t pfnGetUsage = [&result] {
-        auto pfnGetUsage = ze_lib::context->zesDdiTable.load()->Power.pfnGetUsage;
+        auto pfnGetUsage = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Power.pfnGetUsage;
         if( nullptr == pfnGetUsage ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7188,7 +7250,7 @@ zesPowerGetUsage(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetUsage = ze_lib::context->zesDdiTable.load()->Power.pfnGetUsage;
+    auto pfnGetUsage = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Power.pfnGetUsage;
     if( nullptr == pfnGetUsage ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7247,7 +7309,7 @@ zesDeviceEnumPsus(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceEnumPsus_t pfnEnumPsus = [&result] {
-        auto pfnEnumPsus = ze_lib::context->zesDdiTable.load()->Device.pfnEnumPsus;
+        auto pfnEnumPsus = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumPsus;
         if( nullptr == pfnEnumPsus ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7262,7 +7324,7 @@ zesDeviceEnumPsus(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumPsus = ze_lib::context->zesDdiTable.load()->Device.pfnEnumPsus;
+    auto pfnEnumPsus = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumPsus;
     if( nullptr == pfnEnumPsus ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7311,7 +7373,7 @@ zesPsuGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnPsuGetProperties_t pfnGetProperties = [&result] {
-        auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Psu.pfnGetProperties;
+        auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Psu.pfnGetProperties;
         if( nullptr == pfnGetProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7326,7 +7388,7 @@ zesPsuGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Psu.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Psu.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7375,7 +7437,7 @@ zesPsuGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnPsuGetState_t pfnGetState = [&result] {
-        auto pfnGetState = ze_lib::context->zesDdiTable.load()->Psu.pfnGetState;
+        auto pfnGetState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Psu.pfnGetState;
         if( nullptr == pfnGetState ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7390,7 +7452,7 @@ zesPsuGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetState = ze_lib::context->zesDdiTable.load()->Psu.pfnGetState;
+    auto pfnGetState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Psu.pfnGetState;
     if( nullptr == pfnGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7459,7 +7521,7 @@ zesDeviceEnumRasErrorSets(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceEnumRasErrorSets_t pfnEnumRasErrorSets = [&result] {
-        auto pfnEnumRasErrorSets = ze_lib::context->zesDdiTable.load()->Device.pfnEnumRasErrorSets;
+        auto pfnEnumRasErrorSets = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumRasErrorSets;
         if( nullptr == pfnEnumRasErrorSets ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7474,7 +7536,7 @@ zesDeviceEnumRasErrorSets(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumRasErrorSets = ze_lib::context->zesDdiTable.load()->Device.pfnEnumRasErrorSets;
+    auto pfnEnumRasErrorSets = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumRasErrorSets;
     if( nullptr == pfnEnumRasErrorSets ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7525,7 +7587,7 @@ zesRasGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnRasGetProperties_t pfnGetProperties = [&result] {
-        auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Ras.pfnGetProperties;
+        auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Ras.pfnGetProperties;
         if( nullptr == pfnGetProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7540,7 +7602,7 @@ zesRasGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Ras.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Ras.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7601,7 +7663,7 @@ zesRasGetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnRasGetConfig_t pfnGetConfig = [&result] {
-        auto pfnGetConfig = ze_lib::context->zesDdiTable.load()->Ras.pfnGetConfig;
+        auto pfnGetConfig = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Ras.pfnGetConfig;
         if( nullptr == pfnGetConfig ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7616,7 +7678,7 @@ zesRasGetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetConfig = ze_lib::context->zesDdiTable.load()->Ras.pfnGetConfig;
+    auto pfnGetConfig = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Ras.pfnGetConfig;
     if( nullptr == pfnGetConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7680,7 +7742,7 @@ zesRasSetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnRasSetConfig_t pfnSetConfig = [&result] {
-        auto pfnSetConfig = ze_lib::context->zesDdiTable.load()->Ras.pfnSetConfig;
+        auto pfnSetConfig = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Ras.pfnSetConfig;
         if( nullptr == pfnSetConfig ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7695,7 +7757,7 @@ zesRasSetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetConfig = ze_lib::context->zesDdiTable.load()->Ras.pfnSetConfig;
+    auto pfnSetConfig = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Ras.pfnSetConfig;
     if( nullptr == pfnSetConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7749,7 +7811,7 @@ zesRasGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnRasGetState_t pfnGetState = [&result] {
-        auto pfnGetState = ze_lib::context->zesDdiTable.load()->Ras.pfnGetState;
+        auto pfnGetState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Ras.pfnGetState;
         if( nullptr == pfnGetState ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7764,7 +7826,7 @@ zesRasGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetState = ze_lib::context->zesDdiTable.load()->Ras.pfnGetState;
+    auto pfnGetState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Ras.pfnGetState;
     if( nullptr == pfnGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7829,7 +7891,7 @@ zesDeviceEnumSchedulers(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceEnumSchedulers_t pfnEnumSchedulers = [&result] {
-        auto pfnEnumSchedulers = ze_lib::context->zesDdiTable.load()->Device.pfnEnumSchedulers;
+        auto pfnEnumSchedulers = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumSchedulers;
         if( nullptr == pfnEnumSchedulers ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7844,7 +7906,7 @@ zesDeviceEnumSchedulers(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumSchedulers = ze_lib::context->zesDdiTable.load()->Device.pfnEnumSchedulers;
+    auto pfnEnumSchedulers = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumSchedulers;
     if( nullptr == pfnEnumSchedulers ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7893,7 +7955,7 @@ zesSchedulerGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnSchedulerGetProperties_t pfnGetProperties = [&result] {
-        auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Scheduler.pfnGetProperties;
+        auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Scheduler.pfnGetProperties;
         if( nullptr == pfnGetProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7908,7 +7970,7 @@ zesSchedulerGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Scheduler.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Scheduler.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7958,7 +8020,7 @@ zesSchedulerGetCurrentMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnSchedulerGetCurrentMode_t pfnGetCurrentMode = [&result] {
-        auto pfnGetCurrentMode = ze_lib::context->zesDdiTable.load()->Scheduler.pfnGetCurrentMode;
+        auto pfnGetCurrentMode = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Scheduler.pfnGetCurrentMode;
         if( nullptr == pfnGetCurrentMode ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -7973,7 +8035,7 @@ zesSchedulerGetCurrentMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetCurrentMode = ze_lib::context->zesDdiTable.load()->Scheduler.pfnGetCurrentMode;
+    auto pfnGetCurrentMode = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Scheduler.pfnGetCurrentMode;
     if( nullptr == pfnGetCurrentMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8025,7 +8087,7 @@ zesSchedulerGetTimeoutModeProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnSchedulerGetTimeoutModeProperties_t pfnGetTimeoutModeProperties = [&result] {
-        auto pfnGetTimeoutModeProperties = ze_lib::context->zesDdiTable.load()->Scheduler.pfnGetTimeoutModeProperties;
+        auto pfnGetTimeoutModeProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Scheduler.pfnGetTimeoutModeProperties;
         if( nullptr == pfnGetTimeoutModeProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -8040,7 +8102,7 @@ zesSchedulerGetTimeoutModeProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetTimeoutModeProperties = ze_lib::context->zesDdiTable.load()->Scheduler.pfnGetTimeoutModeProperties;
+    auto pfnGetTimeoutModeProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Scheduler.pfnGetTimeoutModeProperties;
     if( nullptr == pfnGetTimeoutModeProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8092,7 +8154,7 @@ zesSchedulerGetTimesliceModeProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnSchedulerGetTimesliceModeProperties_t pfnGetTimesliceModeProperties = [&result] {
-        auto pfnGetTimesliceModeProperties = ze_lib::context->zesDdiTable.load()->Scheduler.pfnGetTimesliceModeProperties;
+        auto pfnGetTimesliceModeProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Scheduler.pfnGetTimesliceModeProperties;
         if( nullptr == pfnGetTimesliceModeProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -8107,7 +8169,7 @@ zesSchedulerGetTimesliceModeProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetTimesliceModeProperties = ze_lib::context->zesDdiTable.load()->Scheduler.pfnGetTimesliceModeProperties;
+    auto pfnGetTimesliceModeProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Scheduler.pfnGetTimesliceModeProperties;
     if( nullptr == pfnGetTimesliceModeProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8166,7 +8228,7 @@ zesSchedulerSetTimeoutMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnSchedulerSetTimeoutMode_t pfnSetTimeoutMode = [&result] {
-        auto pfnSetTimeoutMode = ze_lib::context->zesDdiTable.load()->Scheduler.pfnSetTimeoutMode;
+        auto pfnSetTimeoutMode = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Scheduler.pfnSetTimeoutMode;
         if( nullptr == pfnSetTimeoutMode ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -8181,7 +8243,7 @@ zesSchedulerSetTimeoutMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetTimeoutMode = ze_lib::context->zesDdiTable.load()->Scheduler.pfnSetTimeoutMode;
+    auto pfnSetTimeoutMode = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Scheduler.pfnSetTimeoutMode;
     if( nullptr == pfnSetTimeoutMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8239,7 +8301,7 @@ zesSchedulerSetTimesliceMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnSchedulerSetTimesliceMode_t pfnSetTimesliceMode = [&result] {
-        auto pfnSetTimesliceMode = ze_lib::context->zesDdiTable.load()->Scheduler.pfnSetTimesliceMode;
+        auto pfnSetTimesliceMode = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Scheduler.pfnSetTimesliceMode;
         if( nullptr == pfnSetTimesliceMode ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -8254,7 +8316,7 @@ zesSchedulerSetTimesliceMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetTimesliceMode = ze_lib::context->zesDdiTable.load()->Scheduler.pfnSetTimesliceMode;
+    auto pfnSetTimesliceMode = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Scheduler.pfnSetTimesliceMode;
     if( nullptr == pfnSetTimesliceMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8310,7 +8372,7 @@ zesSchedulerSetExclusiveMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnSchedulerSetExclusiveMode_t pfnSetExclusiveMode = [&result] {
-        auto pfnSetExclusiveMode = ze_lib::context->zesDdiTable.load()->Scheduler.pfnSetExclusiveMode;
+        auto pfnSetExclusiveMode = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Scheduler.pfnSetExclusiveMode;
         if( nullptr == pfnSetExclusiveMode ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -8325,7 +8387,7 @@ zesSchedulerSetExclusiveMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetExclusiveMode = ze_lib::context->zesDdiTable.load()->Scheduler.pfnSetExclusiveMode;
+    auto pfnSetExclusiveMode = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Scheduler.pfnSetExclusiveMode;
     if( nullptr == pfnSetExclusiveMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8383,7 +8445,7 @@ zesSchedulerSetComputeUnitDebugMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnSchedulerSetComputeUnitDebugMode_t pfnSetComputeUnitDebugMode = [&result] {
-        auto pfnSetComputeUnitDebugMode = ze_lib::context->zesDdiTable.load()->Scheduler.pfnSetComputeUnitDebugMode;
+        auto pfnSetComputeUnitDebugMode = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Scheduler.pfnSetComputeUnitDebugMode;
         if( nullptr == pfnSetComputeUnitDebugMode ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -8398,7 +8460,7 @@ zesSchedulerSetComputeUnitDebugMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetComputeUnitDebugMode = ze_lib::context->zesDdiTable.load()->Scheduler.pfnSetComputeUnitDebugMode;
+    auto pfnSetComputeUnitDebugMode = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Scheduler.pfnSetComputeUnitDebugMode;
     if( nullptr == pfnSetComputeUnitDebugMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8457,7 +8519,7 @@ zesDeviceEnumStandbyDomains(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceEnumStandbyDomains_t pfnEnumStandbyDomains = [&result] {
-        auto pfnEnumStandbyDomains = ze_lib::context->zesDdiTable.load()->Device.pfnEnumStandbyDomains;
+        auto pfnEnumStandbyDomains = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumStandbyDomains;
         if( nullptr == pfnEnumStandbyDomains ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -8472,7 +8534,7 @@ zesDeviceEnumStandbyDomains(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumStandbyDomains = ze_lib::context->zesDdiTable.load()->Device.pfnEnumStandbyDomains;
+    auto pfnEnumStandbyDomains = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumStandbyDomains;
     if( nullptr == pfnEnumStandbyDomains ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8521,7 +8583,7 @@ zesStandbyGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnStandbyGetProperties_t pfnGetProperties = [&result] {
-        auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Standby.pfnGetProperties;
+        auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Standby.pfnGetProperties;
         if( nullptr == pfnGetProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -8536,7 +8598,7 @@ zesStandbyGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Standby.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Standby.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8585,7 +8647,7 @@ zesStandbyGetMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnStandbyGetMode_t pfnGetMode = [&result] {
-        auto pfnGetMode = ze_lib::context->zesDdiTable.load()->Standby.pfnGetMode;
+        auto pfnGetMode = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Standby.pfnGetMode;
         if( nullptr == pfnGetMode ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -8600,7 +8662,7 @@ zesStandbyGetMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetMode = ze_lib::context->zesDdiTable.load()->Standby.pfnGetMode;
+    auto pfnGetMode = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Standby.pfnGetMode;
     if( nullptr == pfnGetMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8651,7 +8713,7 @@ zesStandbySetMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnStandbySetMode_t pfnSetMode = [&result] {
-        auto pfnSetMode = ze_lib::context->zesDdiTable.load()->Standby.pfnSetMode;
+        auto pfnSetMode = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Standby.pfnSetMode;
         if( nullptr == pfnSetMode ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -8666,7 +8728,7 @@ zesStandbySetMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetMode = ze_lib::context->zesDdiTable.load()->Standby.pfnSetMode;
+    auto pfnSetMode = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Standby.pfnSetMode;
     if( nullptr == pfnSetMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8725,7 +8787,7 @@ zesDeviceEnumTemperatureSensors(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceEnumTemperatureSensors_t pfnEnumTemperatureSensors = [&result] {
-        auto pfnEnumTemperatureSensors = ze_lib::context->zesDdiTable.load()->Device.pfnEnumTemperatureSensors;
+        auto pfnEnumTemperatureSensors = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumTemperatureSensors;
         if( nullptr == pfnEnumTemperatureSensors ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -8740,7 +8802,7 @@ zesDeviceEnumTemperatureSensors(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumTemperatureSensors = ze_lib::context->zesDdiTable.load()->Device.pfnEnumTemperatureSensors;
+    auto pfnEnumTemperatureSensors = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnEnumTemperatureSensors;
     if( nullptr == pfnEnumTemperatureSensors ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8789,7 +8851,7 @@ zesTemperatureGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnTemperatureGetProperties_t pfnGetProperties = [&result] {
-        auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Temperature.pfnGetProperties;
+        auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Temperature.pfnGetProperties;
         if( nullptr == pfnGetProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -8804,7 +8866,7 @@ zesTemperatureGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Temperature.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Temperature.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8857,7 +8919,7 @@ zesTemperatureGetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnTemperatureGetConfig_t pfnGetConfig = [&result] {
-        auto pfnGetConfig = ze_lib::context->zesDdiTable.load()->Temperature.pfnGetConfig;
+        auto pfnGetConfig = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Temperature.pfnGetConfig;
         if( nullptr == pfnGetConfig ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -8872,7 +8934,7 @@ zesTemperatureGetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetConfig = ze_lib::context->zesDdiTable.load()->Temperature.pfnGetConfig;
+    auto pfnGetConfig = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Temperature.pfnGetConfig;
     if( nullptr == pfnGetConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8940,7 +9002,7 @@ zesTemperatureSetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnTemperatureSetConfig_t pfnSetConfig = [&result] {
-        auto pfnSetConfig = ze_lib::context->zesDdiTable.load()->Temperature.pfnSetConfig;
+        auto pfnSetConfig = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Temperature.pfnSetConfig;
         if( nullptr == pfnSetConfig ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -8955,7 +9017,7 @@ zesTemperatureSetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetConfig = ze_lib::context->zesDdiTable.load()->Temperature.pfnSetConfig;
+    auto pfnSetConfig = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Temperature.pfnSetConfig;
     if( nullptr == pfnSetConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9005,7 +9067,7 @@ zesTemperatureGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnTemperatureGetState_t pfnGetState = [&result] {
-        auto pfnGetState = ze_lib::context->zesDdiTable.load()->Temperature.pfnGetState;
+        auto pfnGetState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Temperature.pfnGetState;
         if( nullptr == pfnGetState ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -9020,7 +9082,7 @@ zesTemperatureGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetState = ze_lib::context->zesDdiTable.load()->Temperature.pfnGetState;
+    auto pfnGetState = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Temperature.pfnGetState;
     if( nullptr == pfnGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9079,7 +9141,7 @@ zesPowerGetLimitsExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnPowerGetLimitsExt_t pfnGetLimitsExt = [&result] {
-        auto pfnGetLimitsExt = ze_lib::context->zesDdiTable.load()->Power.pfnGetLimitsExt;
+        auto pfnGetLimitsExt = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Power.pfnGetLimitsExt;
         if( nullptr == pfnGetLimitsExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -9094,7 +9156,7 @@ zesPowerGetLimitsExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetLimitsExt = ze_lib::context->zesDdiTable.load()->Power.pfnGetLimitsExt;
+    auto pfnGetLimitsExt = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Power.pfnGetLimitsExt;
     if( nullptr == pfnGetLimitsExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9154,7 +9216,7 @@ zesPowerSetLimitsExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnPowerSetLimitsExt_t pfnSetLimitsExt = [&result] {
-        auto pfnSetLimitsExt = ze_lib::context->zesDdiTable.load()->Power.pfnSetLimitsExt;
+        auto pfnSetLimitsExt = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Power.pfnSetLimitsExt;
         if( nullptr == pfnSetLimitsExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -9169,7 +9231,7 @@ zesPowerSetLimitsExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetLimitsExt = ze_lib::context->zesDdiTable.load()->Power.pfnSetLimitsExt;
+    auto pfnSetLimitsExt = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Power.pfnSetLimitsExt;
     if( nullptr == pfnSetLimitsExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9220,7 +9282,7 @@ zesPowerGetLimitsExt2(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnPowerGetLimitsExt2_t pfnGetLimitsExt2 = [&result] {
-        auto pfnGetLimitsExt2 = ze_lib::context->zesDdiTable.load()->Power.pfnGetLimitsExt2;
+        auto pfnGetLimitsExt2 = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Power.pfnGetLimitsExt2;
         if( nullptr == pfnGetLimitsExt2 ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -9235,7 +9297,7 @@ zesPowerGetLimitsExt2(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetLimitsExt2 = ze_lib::context->zesDdiTable.load()->Power.pfnGetLimitsExt2;
+    auto pfnGetLimitsExt2 = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Power.pfnGetLimitsExt2;
     if( nullptr == pfnGetLimitsExt2 ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9285,7 +9347,7 @@ zesPowerSetLimitsExt2(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnPowerSetLimitsExt2_t pfnSetLimitsExt2 = [&result] {
-        auto pfnSetLimitsExt2 = ze_lib::context->zesDdiTable.load()->Power.pfnSetLimitsExt2;
+        auto pfnSetLimitsExt2 = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Power.pfnSetLimitsExt2;
         if( nullptr == pfnSetLimitsExt2 ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -9300,7 +9362,7 @@ zesPowerSetLimitsExt2(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetLimitsExt2 = ze_lib::context->zesDdiTable.load()->Power.pfnSetLimitsExt2;
+    auto pfnSetLimitsExt2 = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Power.pfnSetLimitsExt2;
     if( nullptr == pfnSetLimitsExt2 ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9364,7 +9426,7 @@ zesEngineGetActivityExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnEngineGetActivityExt_t pfnGetActivityExt = [&result] {
-        auto pfnGetActivityExt = ze_lib::context->zesDdiTable.load()->Engine.pfnGetActivityExt;
+        auto pfnGetActivityExt = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Engine.pfnGetActivityExt;
         if( nullptr == pfnGetActivityExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -9379,7 +9441,7 @@ zesEngineGetActivityExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetActivityExt = ze_lib::context->zesDdiTable.load()->Engine.pfnGetActivityExt;
+    auto pfnGetActivityExt = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Engine.pfnGetActivityExt;
     if( nullptr == pfnGetActivityExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9438,7 +9500,7 @@ zesRasGetStateExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnRasGetStateExp_t pfnGetStateExp = [&result] {
-        auto pfnGetStateExp = ze_lib::context->zesDdiTable.load()->RasExp.pfnGetStateExp;
+        auto pfnGetStateExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->RasExp.pfnGetStateExp;
         if( nullptr == pfnGetStateExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -9453,7 +9515,7 @@ zesRasGetStateExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetStateExp = ze_lib::context->zesDdiTable.load()->RasExp.pfnGetStateExp;
+    auto pfnGetStateExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->RasExp.pfnGetStateExp;
     if( nullptr == pfnGetStateExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9509,7 +9571,7 @@ zesRasClearStateExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnRasClearStateExp_t pfnClearStateExp = [&result] {
-        auto pfnClearStateExp = ze_lib::context->zesDdiTable.load()->RasExp.pfnClearStateExp;
+        auto pfnClearStateExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->RasExp.pfnClearStateExp;
         if( nullptr == pfnClearStateExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -9524,7 +9586,7 @@ zesRasClearStateExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnClearStateExp = ze_lib::context->zesDdiTable.load()->RasExp.pfnClearStateExp;
+    auto pfnClearStateExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->RasExp.pfnClearStateExp;
     if( nullptr == pfnClearStateExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9581,7 +9643,7 @@ zesRasGetSupportedCategoriesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnRasGetSupportedCategoriesExp_t pfnGetSupportedCategoriesExp = [&result] {
-        auto pfnGetSupportedCategoriesExp = ze_lib::context->zesDdiTable.load()->RasExp.pfnGetSupportedCategoriesExp;
+        auto pfnGetSupportedCategoriesExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->RasExp.pfnGetSupportedCategoriesExp;
         if( nullptr == pfnGetSupportedCategoriesExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -9596,7 +9658,7 @@ zesRasGetSupportedCategoriesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetSupportedCategoriesExp = ze_lib::context->zesDdiTable.load()->RasExp.pfnGetSupportedCategoriesExp;
+    auto pfnGetSupportedCategoriesExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->RasExp.pfnGetSupportedCategoriesExp;
     if( nullptr == pfnGetSupportedCategoriesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9657,7 +9719,7 @@ zesRasGetStateExp2(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnRasGetStateExp2_t pfnGetStateExp2 = [&result] {
-        auto pfnGetStateExp2 = ze_lib::context->zesDdiTable.load()->RasExp.pfnGetStateExp2;
+        auto pfnGetStateExp2 = ze_lib::zesDdiTable.load(std::memory_order_acquire)->RasExp.pfnGetStateExp2;
         if( nullptr == pfnGetStateExp2 ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -9672,7 +9734,7 @@ zesRasGetStateExp2(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetStateExp2 = ze_lib::context->zesDdiTable.load()->RasExp.pfnGetStateExp2;
+    auto pfnGetStateExp2 = ze_lib::zesDdiTable.load(std::memory_order_acquire)->RasExp.pfnGetStateExp2;
     if( nullptr == pfnGetStateExp2 ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9731,7 +9793,7 @@ zesRasGetConfigExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnRasGetConfigExp_t pfnGetConfigExp = [&result] {
-        auto pfnGetConfigExp = ze_lib::context->zesDdiTable.load()->RasExp.pfnGetConfigExp;
+        auto pfnGetConfigExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->RasExp.pfnGetConfigExp;
         if( nullptr == pfnGetConfigExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -9746,7 +9808,7 @@ zesRasGetConfigExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetConfigExp = ze_lib::context->zesDdiTable.load()->RasExp.pfnGetConfigExp;
+    auto pfnGetConfigExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->RasExp.pfnGetConfigExp;
     if( nullptr == pfnGetConfigExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9803,7 +9865,7 @@ zesRasSetConfigExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnRasSetConfigExp_t pfnSetConfigExp = [&result] {
-        auto pfnSetConfigExp = ze_lib::context->zesDdiTable.load()->RasExp.pfnSetConfigExp;
+        auto pfnSetConfigExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->RasExp.pfnSetConfigExp;
         if( nullptr == pfnSetConfigExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -9818,7 +9880,7 @@ zesRasSetConfigExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetConfigExp = ze_lib::context->zesDdiTable.load()->RasExp.pfnSetConfigExp;
+    auto pfnSetConfigExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->RasExp.pfnSetConfigExp;
     if( nullptr == pfnSetConfigExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9872,7 +9934,7 @@ zesFirmwareGetSecurityVersionExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFirmwareGetSecurityVersionExp_t pfnGetSecurityVersionExp = [&result] {
-        auto pfnGetSecurityVersionExp = ze_lib::context->zesDdiTable.load()->FirmwareExp.pfnGetSecurityVersionExp;
+        auto pfnGetSecurityVersionExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->FirmwareExp.pfnGetSecurityVersionExp;
         if( nullptr == pfnGetSecurityVersionExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -9887,7 +9949,7 @@ zesFirmwareGetSecurityVersionExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetSecurityVersionExp = ze_lib::context->zesDdiTable.load()->FirmwareExp.pfnGetSecurityVersionExp;
+    auto pfnGetSecurityVersionExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->FirmwareExp.pfnGetSecurityVersionExp;
     if( nullptr == pfnGetSecurityVersionExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9933,7 +9995,7 @@ zesFirmwareSetSecurityVersionExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnFirmwareSetSecurityVersionExp_t pfnSetSecurityVersionExp = [&result] {
-        auto pfnSetSecurityVersionExp = ze_lib::context->zesDdiTable.load()->FirmwareExp.pfnSetSecurityVersionExp;
+        auto pfnSetSecurityVersionExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->FirmwareExp.pfnSetSecurityVersionExp;
         if( nullptr == pfnSetSecurityVersionExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -9948,7 +10010,7 @@ zesFirmwareSetSecurityVersionExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetSecurityVersionExp = ze_lib::context->zesDdiTable.load()->FirmwareExp.pfnSetSecurityVersionExp;
+    auto pfnSetSecurityVersionExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->FirmwareExp.pfnSetSecurityVersionExp;
     if( nullptr == pfnSetSecurityVersionExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10005,7 +10067,7 @@ zesDeviceGetSubDevicePropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceGetSubDevicePropertiesExp_t pfnGetSubDevicePropertiesExp = [&result] {
-        auto pfnGetSubDevicePropertiesExp = ze_lib::context->zesDdiTable.load()->DeviceExp.pfnGetSubDevicePropertiesExp;
+        auto pfnGetSubDevicePropertiesExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->DeviceExp.pfnGetSubDevicePropertiesExp;
         if( nullptr == pfnGetSubDevicePropertiesExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -10020,7 +10082,7 @@ zesDeviceGetSubDevicePropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetSubDevicePropertiesExp = ze_lib::context->zesDdiTable.load()->DeviceExp.pfnGetSubDevicePropertiesExp;
+    auto pfnGetSubDevicePropertiesExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->DeviceExp.pfnGetSubDevicePropertiesExp;
     if( nullptr == pfnGetSubDevicePropertiesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10076,7 +10138,7 @@ zesDriverGetDeviceByUuidExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDriverGetDeviceByUuidExp_t pfnGetDeviceByUuidExp = [&result] {
-        auto pfnGetDeviceByUuidExp = ze_lib::context->zesDdiTable.load()->DriverExp.pfnGetDeviceByUuidExp;
+        auto pfnGetDeviceByUuidExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->DriverExp.pfnGetDeviceByUuidExp;
         if( nullptr == pfnGetDeviceByUuidExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -10091,7 +10153,7 @@ zesDriverGetDeviceByUuidExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetDeviceByUuidExp = ze_lib::context->zesDdiTable.load()->DriverExp.pfnGetDeviceByUuidExp;
+    auto pfnGetDeviceByUuidExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->DriverExp.pfnGetDeviceByUuidExp;
     if( nullptr == pfnGetDeviceByUuidExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10151,7 +10213,7 @@ zesDeviceEnumActiveVFExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceEnumActiveVFExp_t pfnEnumActiveVFExp = [&result] {
-        auto pfnEnumActiveVFExp = ze_lib::context->zesDdiTable.load()->DeviceExp.pfnEnumActiveVFExp;
+        auto pfnEnumActiveVFExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->DeviceExp.pfnEnumActiveVFExp;
         if( nullptr == pfnEnumActiveVFExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -10166,7 +10228,7 @@ zesDeviceEnumActiveVFExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumActiveVFExp = ze_lib::context->zesDdiTable.load()->DeviceExp.pfnEnumActiveVFExp;
+    auto pfnEnumActiveVFExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->DeviceExp.pfnEnumActiveVFExp;
     if( nullptr == pfnEnumActiveVFExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10217,7 +10279,7 @@ zesVFManagementGetVFPropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnVFManagementGetVFPropertiesExp_t pfnGetVFPropertiesExp = [&result] {
-        auto pfnGetVFPropertiesExp = ze_lib::context->zesDdiTable.load()->VFManagementExp.pfnGetVFPropertiesExp;
+        auto pfnGetVFPropertiesExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->VFManagementExp.pfnGetVFPropertiesExp;
         if( nullptr == pfnGetVFPropertiesExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -10232,7 +10294,7 @@ zesVFManagementGetVFPropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetVFPropertiesExp = ze_lib::context->zesDdiTable.load()->VFManagementExp.pfnGetVFPropertiesExp;
+    auto pfnGetVFPropertiesExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->VFManagementExp.pfnGetVFPropertiesExp;
     if( nullptr == pfnGetVFPropertiesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10296,7 +10358,7 @@ zesVFManagementGetVFMemoryUtilizationExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnVFManagementGetVFMemoryUtilizationExp_t pfnGetVFMemoryUtilizationExp = [&result] {
-        auto pfnGetVFMemoryUtilizationExp = ze_lib::context->zesDdiTable.load()->VFManagementExp.pfnGetVFMemoryUtilizationExp;
+        auto pfnGetVFMemoryUtilizationExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->VFManagementExp.pfnGetVFMemoryUtilizationExp;
         if( nullptr == pfnGetVFMemoryUtilizationExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -10311,7 +10373,7 @@ zesVFManagementGetVFMemoryUtilizationExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetVFMemoryUtilizationExp = ze_lib::context->zesDdiTable.load()->VFManagementExp.pfnGetVFMemoryUtilizationExp;
+    auto pfnGetVFMemoryUtilizationExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->VFManagementExp.pfnGetVFMemoryUtilizationExp;
     if( nullptr == pfnGetVFMemoryUtilizationExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10375,7 +10437,7 @@ zesVFManagementGetVFEngineUtilizationExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnVFManagementGetVFEngineUtilizationExp_t pfnGetVFEngineUtilizationExp = [&result] {
-        auto pfnGetVFEngineUtilizationExp = ze_lib::context->zesDdiTable.load()->VFManagementExp.pfnGetVFEngineUtilizationExp;
+        auto pfnGetVFEngineUtilizationExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->VFManagementExp.pfnGetVFEngineUtilizationExp;
         if( nullptr == pfnGetVFEngineUtilizationExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -10390,7 +10452,7 @@ zesVFManagementGetVFEngineUtilizationExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetVFEngineUtilizationExp = ze_lib::context->zesDdiTable.load()->VFManagementExp.pfnGetVFEngineUtilizationExp;
+    auto pfnGetVFEngineUtilizationExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->VFManagementExp.pfnGetVFEngineUtilizationExp;
     if( nullptr == pfnGetVFEngineUtilizationExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10444,7 +10506,7 @@ zesVFManagementSetVFTelemetryModeExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnVFManagementSetVFTelemetryModeExp_t pfnSetVFTelemetryModeExp = [&result] {
-        auto pfnSetVFTelemetryModeExp = ze_lib::context->zesDdiTable.load()->VFManagementExp.pfnSetVFTelemetryModeExp;
+        auto pfnSetVFTelemetryModeExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->VFManagementExp.pfnSetVFTelemetryModeExp;
         if( nullptr == pfnSetVFTelemetryModeExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -10459,7 +10521,7 @@ zesVFManagementSetVFTelemetryModeExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetVFTelemetryModeExp = ze_lib::context->zesDdiTable.load()->VFManagementExp.pfnSetVFTelemetryModeExp;
+    auto pfnSetVFTelemetryModeExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->VFManagementExp.pfnSetVFTelemetryModeExp;
     if( nullptr == pfnSetVFTelemetryModeExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10513,7 +10575,7 @@ zesVFManagementSetVFTelemetrySamplingIntervalExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnVFManagementSetVFTelemetrySamplingIntervalExp_t pfnSetVFTelemetrySamplingIntervalExp = [&result] {
-        auto pfnSetVFTelemetrySamplingIntervalExp = ze_lib::context->zesDdiTable.load()->VFManagementExp.pfnSetVFTelemetrySamplingIntervalExp;
+        auto pfnSetVFTelemetrySamplingIntervalExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->VFManagementExp.pfnSetVFTelemetrySamplingIntervalExp;
         if( nullptr == pfnSetVFTelemetrySamplingIntervalExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -10528,7 +10590,7 @@ zesVFManagementSetVFTelemetrySamplingIntervalExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetVFTelemetrySamplingIntervalExp = ze_lib::context->zesDdiTable.load()->VFManagementExp.pfnSetVFTelemetrySamplingIntervalExp;
+    auto pfnSetVFTelemetrySamplingIntervalExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->VFManagementExp.pfnSetVFTelemetrySamplingIntervalExp;
     if( nullptr == pfnSetVFTelemetrySamplingIntervalExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10587,7 +10649,7 @@ zesDeviceEnumEnabledVFExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDeviceEnumEnabledVFExp_t pfnEnumEnabledVFExp = [&result] {
-        auto pfnEnumEnabledVFExp = ze_lib::context->zesDdiTable.load()->DeviceExp.pfnEnumEnabledVFExp;
+        auto pfnEnumEnabledVFExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->DeviceExp.pfnEnumEnabledVFExp;
         if( nullptr == pfnEnumEnabledVFExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -10602,7 +10664,7 @@ zesDeviceEnumEnabledVFExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumEnabledVFExp = ze_lib::context->zesDdiTable.load()->DeviceExp.pfnEnumEnabledVFExp;
+    auto pfnEnumEnabledVFExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->DeviceExp.pfnEnumEnabledVFExp;
     if( nullptr == pfnEnumEnabledVFExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10653,7 +10715,7 @@ zesVFManagementGetVFCapabilitiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnVFManagementGetVFCapabilitiesExp_t pfnGetVFCapabilitiesExp = [&result] {
-        auto pfnGetVFCapabilitiesExp = ze_lib::context->zesDdiTable.load()->VFManagementExp.pfnGetVFCapabilitiesExp;
+        auto pfnGetVFCapabilitiesExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->VFManagementExp.pfnGetVFCapabilitiesExp;
         if( nullptr == pfnGetVFCapabilitiesExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -10668,7 +10730,7 @@ zesVFManagementGetVFCapabilitiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetVFCapabilitiesExp = ze_lib::context->zesDdiTable.load()->VFManagementExp.pfnGetVFCapabilitiesExp;
+    auto pfnGetVFCapabilitiesExp = ze_lib::zesDdiTable.load(std::memory_order_acquire)->VFManagementExp.pfnGetVFCapabilitiesExp;
     if( nullptr == pfnGetVFCapabilitiesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10729,7 +10791,7 @@ zesVFManagementGetVFMemoryUtilizationExp2(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnVFManagementGetVFMemoryUtilizationExp2_t pfnGetVFMemoryUtilizationExp2 = [&result] {
-        auto pfnGetVFMemoryUtilizationExp2 = ze_lib::context->zesDdiTable.load()->VFManagementExp.pfnGetVFMemoryUtilizationExp2;
+        auto pfnGetVFMemoryUtilizationExp2 = ze_lib::zesDdiTable.load(std::memory_order_acquire)->VFManagementExp.pfnGetVFMemoryUtilizationExp2;
         if( nullptr == pfnGetVFMemoryUtilizationExp2 ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -10744,7 +10806,7 @@ zesVFManagementGetVFMemoryUtilizationExp2(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetVFMemoryUtilizationExp2 = ze_lib::context->zesDdiTable.load()->VFManagementExp.pfnGetVFMemoryUtilizationExp2;
+    auto pfnGetVFMemoryUtilizationExp2 = ze_lib::zesDdiTable.load(std::memory_order_acquire)->VFManagementExp.pfnGetVFMemoryUtilizationExp2;
     if( nullptr == pfnGetVFMemoryUtilizationExp2 ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10805,7 +10867,7 @@ zesVFManagementGetVFEngineUtilizationExp2(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnVFManagementGetVFEngineUtilizationExp2_t pfnGetVFEngineUtilizationExp2 = [&result] {
-        auto pfnGetVFEngineUtilizationExp2 = ze_lib::context->zesDdiTable.load()->VFManagementExp.pfnGetVFEngineUtilizationExp2;
+        auto pfnGetVFEngineUtilizationExp2 = ze_lib::zesDdiTable.load(std::memory_order_acquire)->VFManagementExp.pfnGetVFEngineUtilizationExp2;
         if( nullptr == pfnGetVFEngineUtilizationExp2 ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -10820,7 +10882,7 @@ zesVFManagementGetVFEngineUtilizationExp2(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetVFEngineUtilizationExp2 = ze_lib::context->zesDdiTable.load()->VFManagementExp.pfnGetVFEngineUtilizationExp2;
+    auto pfnGetVFEngineUtilizationExp2 = ze_lib::zesDdiTable.load(std::memory_order_acquire)->VFManagementExp.pfnGetVFEngineUtilizationExp2;
     if( nullptr == pfnGetVFEngineUtilizationExp2 ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10869,7 +10931,7 @@ zesVFManagementGetVFCapabilitiesExp2(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnVFManagementGetVFCapabilitiesExp2_t pfnGetVFCapabilitiesExp2 = [&result] {
-        auto pfnGetVFCapabilitiesExp2 = ze_lib::context->zesDdiTable.load()->VFManagementExp.pfnGetVFCapabilitiesExp2;
+        auto pfnGetVFCapabilitiesExp2 = ze_lib::zesDdiTable.load(std::memory_order_acquire)->VFManagementExp.pfnGetVFCapabilitiesExp2;
         if( nullptr == pfnGetVFCapabilitiesExp2 ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -10884,7 +10946,7 @@ zesVFManagementGetVFCapabilitiesExp2(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetVFCapabilitiesExp2 = ze_lib::context->zesDdiTable.load()->VFManagementExp.pfnGetVFCapabilitiesExp2;
+    auto pfnGetVFCapabilitiesExp2 = ze_lib::zesDdiTable.load(std::memory_order_acquire)->VFManagementExp.pfnGetVFCapabilitiesExp2;
     if( nullptr == pfnGetVFCapabilitiesExp2 ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -10937,7 +10999,7 @@ zesDevicePciLinkSpeedUpdateExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zes_pfnDevicePciLinkSpeedUpdateExt_t pfnPciLinkSpeedUpdateExt = [&result] {
-        auto pfnPciLinkSpeedUpdateExt = ze_lib::context->zesDdiTable.load()->Device.pfnPciLinkSpeedUpdateExt;
+        auto pfnPciLinkSpeedUpdateExt = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnPciLinkSpeedUpdateExt;
         if( nullptr == pfnPciLinkSpeedUpdateExt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -10952,7 +11014,7 @@ zesDevicePciLinkSpeedUpdateExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnPciLinkSpeedUpdateExt = ze_lib::context->zesDdiTable.load()->Device.pfnPciLinkSpeedUpdateExt;
+    auto pfnPciLinkSpeedUpdateExt = ze_lib::zesDdiTable.load(std::memory_order_acquire)->Device.pfnPciLinkSpeedUpdateExt;
     if( nullptr == pfnPciLinkSpeedUpdateExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
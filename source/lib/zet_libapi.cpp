@@ -59,7 +59,7 @@ zetModuleGetDebugInfo(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnModuleGetDebugInfo_t pfnGetDebugInfo = [&result] {
-        auto pfnGetDebugInfo = ze_lib::context->zetDdiTable.load()->Module.pfnGetDebugInfo;
+        auto pfnGetDebugInfo = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Module.pfnGetDebugInfo;
         if( nullptr == pfnGetDebugInfo ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -74,7 +74,7 @@ zetModuleGetDebugInfo(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetDebugInfo = ze_lib::context->zetDdiTable.load()->Module.pfnGetDebugInfo;
+    auto pfnGetDebugInfo = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Module.pfnGetDebugInfo;
     if( nullptr == pfnGetDebugInfo ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -119,7 +119,7 @@ zetDeviceGetDebugProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnDeviceGetDebugProperties_t pfnGetDebugProperties = [&result] {
-        auto pfnGetDebugProperties = ze_lib::context->zetDdiTable.load()->Device.pfnGetDebugProperties;
+        auto pfnGetDebugProperties = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Device.pfnGetDebugProperties;
         if( nullptr == pfnGetDebugProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -134,7 +134,7 @@ zetDeviceGetDebugProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetDebugProperties = ze_lib::context->zetDdiTable.load()->Device.pfnGetDebugProperties;
+    auto pfnGetDebugProperties = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Device.pfnGetDebugProperties;
     if( nullptr == pfnGetDebugProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -188,7 +188,7 @@ zetDebugAttach(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnDebugAttach_t pfnAttach = [&result] {
-        auto pfnAttach = ze_lib::context->zetDdiTable.load()->Debug.pfnAttach;
+        auto pfnAttach = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Debug.pfnAttach;
         if( nullptr == pfnAttach ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -203,7 +203,7 @@ zetDebugAttach(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAttach = ze_lib::context->zetDdiTable.load()->Debug.pfnAttach;
+    auto pfnAttach = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Debug.pfnAttach;
     if( nullptr == pfnAttach ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -245,7 +245,7 @@ zetDebugDetach(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnDebugDetach_t pfnDetach = [&result] {
-        auto pfnDetach = ze_lib::context->zetDdiTable.load()->Debug.pfnDetach;
+        auto pfnDetach = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Debug.pfnDetach;
         if( nullptr == pfnDetach ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -260,7 +260,7 @@ zetDebugDetach(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDetach = ze_lib::context->zetDdiTable.load()->Debug.pfnDetach;
+    auto pfnDetach = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Debug.pfnDetach;
     if( nullptr == pfnDetach ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -314,7 +314,7 @@ zetDebugReadEvent(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnDebugReadEvent_t pfnReadEvent = [&result] {
-        auto pfnReadEvent = ze_lib::context->zetDdiTable.load()->Debug.pfnReadEvent;
+        auto pfnReadEvent = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Debug.pfnReadEvent;
         if( nullptr == pfnReadEvent ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -329,7 +329,7 @@ zetDebugReadEvent(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReadEvent = ze_lib::context->zetDdiTable.load()->Debug.pfnReadEvent;
+    auto pfnReadEvent = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Debug.pfnReadEvent;
     if( nullptr == pfnReadEvent ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -374,7 +374,7 @@ zetDebugAcknowledgeEvent(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnDebugAcknowledgeEvent_t pfnAcknowledgeEvent = [&result] {
-        auto pfnAcknowledgeEvent = ze_lib::context->zetDdiTable.load()->Debug.pfnAcknowledgeEvent;
+        auto pfnAcknowledgeEvent = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Debug.pfnAcknowledgeEvent;
         if( nullptr == pfnAcknowledgeEvent ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -389,7 +389,7 @@ zetDebugAcknowledgeEvent(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAcknowledgeEvent = ze_lib::context->zetDdiTable.load()->Debug.pfnAcknowledgeEvent;
+    auto pfnAcknowledgeEvent = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Debug.pfnAcknowledgeEvent;
     if( nullptr == pfnAcknowledgeEvent ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -433,7 +433,7 @@ zetDebugInterrupt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnDebugInterrupt_t pfnInterrupt = [&result] {
-        auto pfnInterrupt = ze_lib::context->zetDdiTable.load()->Debug.pfnInterrupt;
+        auto pfnInterrupt = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Debug.pfnInterrupt;
         if( nullptr == pfnInterrupt ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -448,7 +448,7 @@ zetDebugInterrupt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnInterrupt = ze_lib::context->zetDdiTable.load()->Debug.pfnInterrupt;
+    auto pfnInterrupt = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Debug.pfnInterrupt;
     if( nullptr == pfnInterrupt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -492,7 +492,7 @@ zetDebugResume(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnDebugResume_t pfnResume = [&result] {
-        auto pfnResume = ze_lib::context->zetDdiTable.load()->Debug.pfnResume;
+        auto pfnResume = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Debug.pfnResume;
         if( nullptr == pfnResume ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -507,7 +507,7 @@ zetDebugResume(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnResume = ze_lib::context->zetDdiTable.load()->Debug.pfnResume;
+    auto pfnResume = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Debug.pfnResume;
     if( nullptr == pfnResume ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -565,7 +565,7 @@ zetDebugReadMemory(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnDebugReadMemory_t pfnReadMemory = [&result] {
-        auto pfnReadMemory = ze_lib::context->zetDdiTable.load()->Debug.pfnReadMemory;
+        auto pfnReadMemory = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Debug.pfnReadMemory;
         if( nullptr == pfnReadMemory ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -580,7 +580,7 @@ zetDebugReadMemory(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReadMemory = ze_lib::context->zetDdiTable.load()->Debug.pfnReadMemory;
+    auto pfnReadMemory = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Debug.pfnReadMemory;
     if( nullptr == pfnReadMemory ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -638,7 +638,7 @@ zetDebugWriteMemory(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnDebugWriteMemory_t pfnWriteMemory = [&result] {
-        auto pfnWriteMemory = ze_lib::context->zetDdiTable.load()->Debug.pfnWriteMemory;
+        auto pfnWriteMemory = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Debug.pfnWriteMemory;
         if( nullptr == pfnWriteMemory ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -653,7 +653,7 @@ zetDebugWriteMemory(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnWriteMemory = ze_lib::context->zetDdiTable.load()->Debug.pfnWriteMemory;
+    auto pfnWriteMemory = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Debug.pfnWriteMemory;
     if( nullptr == pfnWriteMemory ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -707,7 +707,7 @@ zetDebugGetRegisterSetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnDebugGetRegisterSetProperties_t pfnGetRegisterSetProperties = [&result] {
-        auto pfnGetRegisterSetProperties = ze_lib::context->zetDdiTable.load()->Debug.pfnGetRegisterSetProperties;
+        auto pfnGetRegisterSetProperties = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Debug.pfnGetRegisterSetProperties;
         if( nullptr == pfnGetRegisterSetProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -722,7 +722,7 @@ zetDebugGetRegisterSetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetRegisterSetProperties = ze_lib::context->zetDdiTable.load()->Debug.pfnGetRegisterSetProperties;
+    auto pfnGetRegisterSetProperties = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Debug.pfnGetRegisterSetProperties;
     if( nullptr == pfnGetRegisterSetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -779,7 +779,7 @@ zetDebugGetThreadRegisterSetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnDebugGetThreadRegisterSetProperties_t pfnGetThreadRegisterSetProperties = [&result] {
-        auto pfnGetThreadRegisterSetProperties = ze_lib::context->zetDdiTable.load()->Debug.pfnGetThreadRegisterSetProperties;
+        auto pfnGetThreadRegisterSetProperties = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Debug.pfnGetThreadRegisterSetProperties;
         if( nullptr == pfnGetThreadRegisterSetProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -794,7 +794,7 @@ zetDebugGetThreadRegisterSetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetThreadRegisterSetProperties = ze_lib::context->zetDdiTable.load()->Debug.pfnGetThreadRegisterSetProperties;
+    auto pfnGetThreadRegisterSetProperties = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Debug.pfnGetThreadRegisterSetProperties;
     if( nullptr == pfnGetThreadRegisterSetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -846,7 +846,7 @@ zetDebugReadRegisters(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnDebugReadRegisters_t pfnReadRegisters = [&result] {
-        auto pfnReadRegisters = ze_lib::context->zetDdiTable.load()->Debug.pfnReadRegisters;
+        auto pfnReadRegisters = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Debug.pfnReadRegisters;
         if( nullptr == pfnReadRegisters ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -861,7 +861,7 @@ zetDebugReadRegisters(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReadRegisters = ze_lib::context->zetDdiTable.load()->Debug.pfnReadRegisters;
+    auto pfnReadRegisters = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Debug.pfnReadRegisters;
     if( nullptr == pfnReadRegisters ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -913,7 +913,7 @@ zetDebugWriteRegisters(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnDebugWriteRegisters_t pfnWriteRegisters = [&result] {
-        auto pfnWriteRegisters = ze_lib::context->zetDdiTable.load()->Debug.pfnWriteRegisters;
+        auto pfnWriteRegisters = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Debug.pfnWriteRegisters;
         if( nullptr == pfnWriteRegisters ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -928,7 +928,7 @@ zetDebugWriteRegisters(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnWriteRegisters = ze_lib::context->zetDdiTable.load()->Debug.pfnWriteRegisters;
+    auto pfnWriteRegisters = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Debug.pfnWriteRegisters;
     if( nullptr == pfnWriteRegisters ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -984,7 +984,7 @@ zetMetricGroupGet(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricGroupGet_t pfnGet = [&result] {
-        auto pfnGet = ze_lib::context->zetDdiTable.load()->MetricGroup.pfnGet;
+        auto pfnGet = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricGroup.pfnGet;
         if( nullptr == pfnGet ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -999,7 +999,7 @@ zetMetricGroupGet(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGet = ze_lib::context->zetDdiTable.load()->MetricGroup.pfnGet;
+    auto pfnGet = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricGroup.pfnGet;
     if( nullptr == pfnGet ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1047,7 +1047,7 @@ zetMetricGroupGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricGroupGetProperties_t pfnGetProperties = [&result] {
-        auto pfnGetProperties = ze_lib::context->zetDdiTable.load()->MetricGroup.pfnGetProperties;
+        auto pfnGetProperties = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricGroup.pfnGetProperties;
         if( nullptr == pfnGetProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1062,7 +1062,7 @@ zetMetricGroupGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zetDdiTable.load()->MetricGroup.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricGroup.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1125,7 +1125,7 @@ zetMetricGroupCalculateMetricValues(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricGroupCalculateMetricValues_t pfnCalculateMetricValues = [&result] {
-        auto pfnCalculateMetricValues = ze_lib::context->zetDdiTable.load()->MetricGroup.pfnCalculateMetricValues;
+        auto pfnCalculateMetricValues = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricGroup.pfnCalculateMetricValues;
         if( nullptr == pfnCalculateMetricValues ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1140,7 +1140,7 @@ zetMetricGroupCalculateMetricValues(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCalculateMetricValues = ze_lib::context->zetDdiTable.load()->MetricGroup.pfnCalculateMetricValues;
+    auto pfnCalculateMetricValues = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricGroup.pfnCalculateMetricValues;
     if( nullptr == pfnCalculateMetricValues ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1195,7 +1195,7 @@ zetMetricGet(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricGet_t pfnGet = [&result] {
-        auto pfnGet = ze_lib::context->zetDdiTable.load()->Metric.pfnGet;
+        auto pfnGet = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Metric.pfnGet;
         if( nullptr == pfnGet ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1210,7 +1210,7 @@ zetMetricGet(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGet = ze_lib::context->zetDdiTable.load()->Metric.pfnGet;
+    auto pfnGet = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Metric.pfnGet;
     if( nullptr == pfnGet ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1258,7 +1258,7 @@ zetMetricGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricGetProperties_t pfnGetProperties = [&result] {
-        auto pfnGetProperties = ze_lib::context->zetDdiTable.load()->Metric.pfnGetProperties;
+        auto pfnGetProperties = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Metric.pfnGetProperties;
         if( nullptr == pfnGetProperties ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1273,7 +1273,7 @@ zetMetricGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zetDdiTable.load()->Metric.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Metric.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1338,7 +1338,7 @@ zetContextActivateMetricGroups(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnContextActivateMetricGroups_t pfnActivateMetricGroups = [&result] {
-        auto pfnActivateMetricGroups = ze_lib::context->zetDdiTable.load()->Context.pfnActivateMetricGroups;
+        auto pfnActivateMetricGroups = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Context.pfnActivateMetricGroups;
         if( nullptr == pfnActivateMetricGroups ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1353,7 +1353,7 @@ zetContextActivateMetricGroups(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnActivateMetricGroups = ze_lib::context->zetDdiTable.load()->Context.pfnActivateMetricGroups;
+    auto pfnActivateMetricGroups = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Context.pfnActivateMetricGroups;
     if( nullptr == pfnActivateMetricGroups ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1416,7 +1416,7 @@ zetMetricStreamerOpen(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricStreamerOpen_t pfnOpen = [&result] {
-        auto pfnOpen = ze_lib::context->zetDdiTable.load()->MetricStreamer.pfnOpen;
+        auto pfnOpen = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricStreamer.pfnOpen;
         if( nullptr == pfnOpen ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1431,7 +1431,7 @@ zetMetricStreamerOpen(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOpen = ze_lib::context->zetDdiTable.load()->MetricStreamer.pfnOpen;
+    auto pfnOpen = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricStreamer.pfnOpen;
     if( nullptr == pfnOpen ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1486,7 +1486,7 @@ zetCommandListAppendMetricStreamerMarker(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnCommandListAppendMetricStreamerMarker_t pfnAppendMetricStreamerMarker = [&result] {
-        auto pfnAppendMetricStreamerMarker = ze_lib::context->zetDdiTable.load()->CommandList.pfnAppendMetricStreamerMarker;
+        auto pfnAppendMetricStreamerMarker = ze_lib::zetDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendMetricStreamerMarker;
         if( nullptr == pfnAppendMetricStreamerMarker ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1501,7 +1501,7 @@ zetCommandListAppendMetricStreamerMarker(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMetricStreamerMarker = ze_lib::context->zetDdiTable.load()->CommandList.pfnAppendMetricStreamerMarker;
+    auto pfnAppendMetricStreamerMarker = ze_lib::zetDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendMetricStreamerMarker;
     if( nullptr == pfnAppendMetricStreamerMarker ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1547,7 +1547,7 @@ zetMetricStreamerClose(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricStreamerClose_t pfnClose = [&result] {
-        auto pfnClose = ze_lib::context->zetDdiTable.load()->MetricStreamer.pfnClose;
+        auto pfnClose = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricStreamer.pfnClose;
         if( nullptr == pfnClose ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1562,7 +1562,7 @@ zetMetricStreamerClose(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnClose = ze_lib::context->zetDdiTable.load()->MetricStreamer.pfnClose;
+    auto pfnClose = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricStreamer.pfnClose;
     if( nullptr == pfnClose ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1626,7 +1626,7 @@ zetMetricStreamerReadData(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricStreamerReadData_t pfnReadData = [&result] {
-        auto pfnReadData = ze_lib::context->zetDdiTable.load()->MetricStreamer.pfnReadData;
+        auto pfnReadData = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricStreamer.pfnReadData;
         if( nullptr == pfnReadData ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1641,7 +1641,7 @@ zetMetricStreamerReadData(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReadData = ze_lib::context->zetDdiTable.load()->MetricStreamer.pfnReadData;
+    auto pfnReadData = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricStreamer.pfnReadData;
     if( nullptr == pfnReadData ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1699,7 +1699,7 @@ zetMetricQueryPoolCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricQueryPoolCreate_t pfnCreate = [&result] {
-        auto pfnCreate = ze_lib::context->zetDdiTable.load()->MetricQueryPool.pfnCreate;
+        auto pfnCreate = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricQueryPool.pfnCreate;
         if( nullptr == pfnCreate ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1714,7 +1714,7 @@ zetMetricQueryPoolCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zetDdiTable.load()->MetricQueryPool.pfnCreate;
+    auto pfnCreate = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricQueryPool.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1766,7 +1766,7 @@ zetMetricQueryPoolDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricQueryPoolDestroy_t pfnDestroy = [&result] {
-        auto pfnDestroy = ze_lib::context->zetDdiTable.load()->MetricQueryPool.pfnDestroy;
+        auto pfnDestroy = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricQueryPool.pfnDestroy;
         if( nullptr == pfnDestroy ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1781,7 +1781,7 @@ zetMetricQueryPoolDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zetDdiTable.load()->MetricQueryPool.pfnDestroy;
+    auto pfnDestroy = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricQueryPool.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1831,7 +1831,7 @@ zetMetricQueryCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricQueryCreate_t pfnCreate = [&result] {
-        auto pfnCreate = ze_lib::context->zetDdiTable.load()->MetricQuery.pfnCreate;
+        auto pfnCreate = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricQuery.pfnCreate;
         if( nullptr == pfnCreate ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1846,7 +1846,7 @@ zetMetricQueryCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zetDdiTable.load()->MetricQuery.pfnCreate;
+    auto pfnCreate = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricQuery.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1896,7 +1896,7 @@ zetMetricQueryDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricQueryDestroy_t pfnDestroy = [&result] {
-        auto pfnDestroy = ze_lib::context->zetDdiTable.load()->MetricQuery.pfnDestroy;
+        auto pfnDestroy = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricQuery.pfnDestroy;
         if( nullptr == pfnDestroy ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1911,7 +1911,7 @@ zetMetricQueryDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zetDdiTable.load()->MetricQuery.pfnDestroy;
+    auto pfnDestroy = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricQuery.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1959,7 +1959,7 @@ zetMetricQueryReset(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricQueryReset_t pfnReset = [&result] {
-        auto pfnReset = ze_lib::context->zetDdiTable.load()->MetricQuery.pfnReset;
+        auto pfnReset = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricQuery.pfnReset;
         if( nullptr == pfnReset ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -1974,7 +1974,7 @@ zetMetricQueryReset(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReset = ze_lib::context->zetDdiTable.load()->MetricQuery.pfnReset;
+    auto pfnReset = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricQuery.pfnReset;
     if( nullptr == pfnReset ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2028,7 +2028,7 @@ zetCommandListAppendMetricQueryBegin(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnCommandListAppendMetricQueryBegin_t pfnAppendMetricQueryBegin = [&result] {
-        auto pfnAppendMetricQueryBegin = ze_lib::context->zetDdiTable.load()->CommandList.pfnAppendMetricQueryBegin;
+        auto pfnAppendMetricQueryBegin = ze_lib::zetDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendMetricQueryBegin;
         if( nullptr == pfnAppendMetricQueryBegin ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2043,7 +2043,7 @@ zetCommandListAppendMetricQueryBegin(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMetricQueryBegin = ze_lib::context->zetDdiTable.load()->CommandList.pfnAppendMetricQueryBegin;
+    auto pfnAppendMetricQueryBegin = ze_lib::zetDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendMetricQueryBegin;
     if( nullptr == pfnAppendMetricQueryBegin ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2111,7 +2111,7 @@ zetCommandListAppendMetricQueryEnd(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnCommandListAppendMetricQueryEnd_t pfnAppendMetricQueryEnd = [&result] {
-        auto pfnAppendMetricQueryEnd = ze_lib::context->zetDdiTable.load()->CommandList.pfnAppendMetricQueryEnd;
+        auto pfnAppendMetricQueryEnd = ze_lib::zetDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendMetricQueryEnd;
         if( nullptr == pfnAppendMetricQueryEnd ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2126,7 +2126,7 @@ zetCommandListAppendMetricQueryEnd(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMetricQueryEnd = ze_lib::context->zetDdiTable.load()->CommandList.pfnAppendMetricQueryEnd;
+    auto pfnAppendMetricQueryEnd = ze_lib::zetDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendMetricQueryEnd;
     if( nullptr == pfnAppendMetricQueryEnd ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2172,7 +2172,7 @@ zetCommandListAppendMetricMemoryBarrier(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnCommandListAppendMetricMemoryBarrier_t pfnAppendMetricMemoryBarrier = [&result] {
-        auto pfnAppendMetricMemoryBarrier = ze_lib::context->zetDdiTable.load()->CommandList.pfnAppendMetricMemoryBarrier;
+        auto pfnAppendMetricMemoryBarrier = ze_lib::zetDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendMetricMemoryBarrier;
         if( nullptr == pfnAppendMetricMemoryBarrier ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2187,7 +2187,7 @@ zetCommandListAppendMetricMemoryBarrier(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMetricMemoryBarrier = ze_lib::context->zetDdiTable.load()->CommandList.pfnAppendMetricMemoryBarrier;
+    auto pfnAppendMetricMemoryBarrier = ze_lib::zetDdiTable.load(std::memory_order_acquire)->CommandList.pfnAppendMetricMemoryBarrier;
     if( nullptr == pfnAppendMetricMemoryBarrier ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2243,7 +2243,7 @@ zetMetricQueryGetData(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricQueryGetData_t pfnGetData = [&result] {
-        auto pfnGetData = ze_lib::context->zetDdiTable.load()->MetricQuery.pfnGetData;
+        auto pfnGetData = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricQuery.pfnGetData;
         if( nullptr == pfnGetData ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2258,7 +2258,7 @@ zetMetricQueryGetData(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetData = ze_lib::context->zetDdiTable.load()->MetricQuery.pfnGetData;
+    auto pfnGetData = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricQuery.pfnGetData;
     if( nullptr == pfnGetData ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2311,7 +2311,7 @@ zetKernelGetProfileInfo(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnKernelGetProfileInfo_t pfnGetProfileInfo = [&result] {
-        auto pfnGetProfileInfo = ze_lib::context->zetDdiTable.load()->Kernel.pfnGetProfileInfo;
+        auto pfnGetProfileInfo = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Kernel.pfnGetProfileInfo;
         if( nullptr == pfnGetProfileInfo ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2326,7 +2326,7 @@ zetKernelGetProfileInfo(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProfileInfo = ze_lib::context->zetDdiTable.load()->Kernel.pfnGetProfileInfo;
+    auto pfnGetProfileInfo = ze_lib::zetDdiTable.load(std::memory_order_acquire)->Kernel.pfnGetProfileInfo;
     if( nullptr == pfnGetProfileInfo ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2384,7 +2384,7 @@ zetTracerExpCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnTracerExpCreate_t pfnCreate = [&result] {
-        auto pfnCreate = ze_lib::context->zetDdiTable.load()->TracerExp.pfnCreate;
+        auto pfnCreate = ze_lib::zetDdiTable.load(std::memory_order_acquire)->TracerExp.pfnCreate;
         if( nullptr == pfnCreate ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2399,7 +2399,7 @@ zetTracerExpCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zetDdiTable.load()->TracerExp.pfnCreate;
+    auto pfnCreate = ze_lib::zetDdiTable.load(std::memory_order_acquire)->TracerExp.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2453,7 +2453,7 @@ zetTracerExpDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnTracerExpDestroy_t pfnDestroy = [&result] {
-        auto pfnDestroy = ze_lib::context->zetDdiTable.load()->TracerExp.pfnDestroy;
+        auto pfnDestroy = ze_lib::zetDdiTable.load(std::memory_order_acquire)->TracerExp.pfnDestroy;
         if( nullptr == pfnDestroy ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2468,7 +2468,7 @@ zetTracerExpDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zetDdiTable.load()->TracerExp.pfnDestroy;
+    auto pfnDestroy = ze_lib::zetDdiTable.load(std::memory_order_acquire)->TracerExp.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2525,7 +2525,7 @@ zetTracerExpSetPrologues(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnTracerExpSetPrologues_t pfnSetPrologues = [&result] {
-        auto pfnSetPrologues = ze_lib::context->zetDdiTable.load()->TracerExp.pfnSetPrologues;
+        auto pfnSetPrologues = ze_lib::zetDdiTable.load(std::memory_order_acquire)->TracerExp.pfnSetPrologues;
         if( nullptr == pfnSetPrologues ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2540,7 +2540,7 @@ zetTracerExpSetPrologues(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetPrologues = ze_lib::context->zetDdiTable.load()->TracerExp.pfnSetPrologues;
+    auto pfnSetPrologues = ze_lib::zetDdiTable.load(std::memory_order_acquire)->TracerExp.pfnSetPrologues;
     if( nullptr == pfnSetPrologues ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2597,7 +2597,7 @@ zetTracerExpSetEpilogues(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnTracerExpSetEpilogues_t pfnSetEpilogues = [&result] {
-        auto pfnSetEpilogues = ze_lib::context->zetDdiTable.load()->TracerExp.pfnSetEpilogues;
+        auto pfnSetEpilogues = ze_lib::zetDdiTable.load(std::memory_order_acquire)->TracerExp.pfnSetEpilogues;
         if( nullptr == pfnSetEpilogues ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2612,7 +2612,7 @@ zetTracerExpSetEpilogues(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetEpilogues = ze_lib::context->zetDdiTable.load()->TracerExp.pfnSetEpilogues;
+    auto pfnSetEpilogues = ze_lib::zetDdiTable.load(std::memory_order_acquire)->TracerExp.pfnSetEpilogues;
     if( nullptr == pfnSetEpilogues ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2662,7 +2662,7 @@ zetTracerExpSetEnabled(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnTracerExpSetEnabled_t pfnSetEnabled = [&result] {
-        auto pfnSetEnabled = ze_lib::context->zetDdiTable.load()->TracerExp.pfnSetEnabled;
+        auto pfnSetEnabled = ze_lib::zetDdiTable.load(std::memory_order_acquire)->TracerExp.pfnSetEnabled;
         if( nullptr == pfnSetEnabled ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2677,7 +2677,7 @@ zetTracerExpSetEnabled(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetEnabled = ze_lib::context->zetDdiTable.load()->TracerExp.pfnSetEnabled;
+    auto pfnSetEnabled = ze_lib::zetDdiTable.load(std::memory_order_acquire)->TracerExp.pfnSetEnabled;
     if( nullptr == pfnSetEnabled ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2759,7 +2759,7 @@ zetMetricGroupCalculateMultipleMetricValuesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricGroupCalculateMultipleMetricValuesExp_t pfnCalculateMultipleMetricValuesExp = [&result] {
-        auto pfnCalculateMultipleMetricValuesExp = ze_lib::context->zetDdiTable.load()->MetricGroupExp.pfnCalculateMultipleMetricValuesExp;
+        auto pfnCalculateMultipleMetricValuesExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricGroupExp.pfnCalculateMultipleMetricValuesExp;
         if( nullptr == pfnCalculateMultipleMetricValuesExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2774,7 +2774,7 @@ zetMetricGroupCalculateMultipleMetricValuesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCalculateMultipleMetricValuesExp = ze_lib::context->zetDdiTable.load()->MetricGroupExp.pfnCalculateMultipleMetricValuesExp;
+    auto pfnCalculateMultipleMetricValuesExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricGroupExp.pfnCalculateMultipleMetricValuesExp;
     if( nullptr == pfnCalculateMultipleMetricValuesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2828,7 +2828,7 @@ zetMetricGroupGetGlobalTimestampsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricGroupGetGlobalTimestampsExp_t pfnGetGlobalTimestampsExp = [&result] {
-        auto pfnGetGlobalTimestampsExp = ze_lib::context->zetDdiTable.load()->MetricGroupExp.pfnGetGlobalTimestampsExp;
+        auto pfnGetGlobalTimestampsExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricGroupExp.pfnGetGlobalTimestampsExp;
         if( nullptr == pfnGetGlobalTimestampsExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2843,7 +2843,7 @@ zetMetricGroupGetGlobalTimestampsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetGlobalTimestampsExp = ze_lib::context->zetDdiTable.load()->MetricGroupExp.pfnGetGlobalTimestampsExp;
+    auto pfnGetGlobalTimestampsExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricGroupExp.pfnGetGlobalTimestampsExp;
     if( nullptr == pfnGetGlobalTimestampsExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2905,7 +2905,7 @@ zetMetricGroupGetExportDataExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricGroupGetExportDataExp_t pfnGetExportDataExp = [&result] {
-        auto pfnGetExportDataExp = ze_lib::context->zetDdiTable.load()->MetricGroupExp.pfnGetExportDataExp;
+        auto pfnGetExportDataExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricGroupExp.pfnGetExportDataExp;
         if( nullptr == pfnGetExportDataExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -2920,7 +2920,7 @@ zetMetricGroupGetExportDataExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetExportDataExp = ze_lib::context->zetDdiTable.load()->MetricGroupExp.pfnGetExportDataExp;
+    auto pfnGetExportDataExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricGroupExp.pfnGetExportDataExp;
     if( nullptr == pfnGetExportDataExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3003,7 +3003,7 @@ zetMetricGroupCalculateMetricExportDataExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricGroupCalculateMetricExportDataExp_t pfnCalculateMetricExportDataExp = [&result] {
-        auto pfnCalculateMetricExportDataExp = ze_lib::context->zetDdiTable.load()->MetricGroupExp.pfnCalculateMetricExportDataExp;
+        auto pfnCalculateMetricExportDataExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricGroupExp.pfnCalculateMetricExportDataExp;
         if( nullptr == pfnCalculateMetricExportDataExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3018,7 +3018,7 @@ zetMetricGroupCalculateMetricExportDataExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCalculateMetricExportDataExp = ze_lib::context->zetDdiTable.load()->MetricGroupExp.pfnCalculateMetricExportDataExp;
+    auto pfnCalculateMetricExportDataExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricGroupExp.pfnCalculateMetricExportDataExp;
     if( nullptr == pfnCalculateMetricExportDataExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3076,7 +3076,7 @@ zetMetricProgrammableGetExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricProgrammableGetExp_t pfnGetExp = [&result] {
-        auto pfnGetExp = ze_lib::context->zetDdiTable.load()->MetricProgrammableExp.pfnGetExp;
+        auto pfnGetExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricProgrammableExp.pfnGetExp;
         if( nullptr == pfnGetExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3091,7 +3091,7 @@ zetMetricProgrammableGetExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetExp = ze_lib::context->zetDdiTable.load()->MetricProgrammableExp.pfnGetExp;
+    auto pfnGetExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricProgrammableExp.pfnGetExp;
     if( nullptr == pfnGetExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3139,7 +3139,7 @@ zetMetricProgrammableGetPropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricProgrammableGetPropertiesExp_t pfnGetPropertiesExp = [&result] {
-        auto pfnGetPropertiesExp = ze_lib::context->zetDdiTable.load()->MetricProgrammableExp.pfnGetPropertiesExp;
+        auto pfnGetPropertiesExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricProgrammableExp.pfnGetPropertiesExp;
         if( nullptr == pfnGetPropertiesExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3154,7 +3154,7 @@ zetMetricProgrammableGetPropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetPropertiesExp = ze_lib::context->zetDdiTable.load()->MetricProgrammableExp.pfnGetPropertiesExp;
+    auto pfnGetPropertiesExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricProgrammableExp.pfnGetPropertiesExp;
     if( nullptr == pfnGetPropertiesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3211,7 +3211,7 @@ zetMetricProgrammableGetParamInfoExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricProgrammableGetParamInfoExp_t pfnGetParamInfoExp = [&result] {
-        auto pfnGetParamInfoExp = ze_lib::context->zetDdiTable.load()->MetricProgrammableExp.pfnGetParamInfoExp;
+        auto pfnGetParamInfoExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricProgrammableExp.pfnGetParamInfoExp;
         if( nullptr == pfnGetParamInfoExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3226,7 +3226,7 @@ zetMetricProgrammableGetParamInfoExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetParamInfoExp = ze_lib::context->zetDdiTable.load()->MetricProgrammableExp.pfnGetParamInfoExp;
+    auto pfnGetParamInfoExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricProgrammableExp.pfnGetParamInfoExp;
     if( nullptr == pfnGetParamInfoExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3285,7 +3285,7 @@ zetMetricProgrammableGetParamValueInfoExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricProgrammableGetParamValueInfoExp_t pfnGetParamValueInfoExp = [&result] {
-        auto pfnGetParamValueInfoExp = ze_lib::context->zetDdiTable.load()->MetricProgrammableExp.pfnGetParamValueInfoExp;
+        auto pfnGetParamValueInfoExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricProgrammableExp.pfnGetParamValueInfoExp;
         if( nullptr == pfnGetParamValueInfoExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3300,7 +3300,7 @@ zetMetricProgrammableGetParamValueInfoExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetParamValueInfoExp = ze_lib::context->zetDdiTable.load()->MetricProgrammableExp.pfnGetParamValueInfoExp;
+    auto pfnGetParamValueInfoExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricProgrammableExp.pfnGetParamValueInfoExp;
     if( nullptr == pfnGetParamValueInfoExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3375,7 +3375,7 @@ zetMetricCreateFromProgrammableExp2(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricCreateFromProgrammableExp2_t pfnCreateFromProgrammableExp2 = [&result] {
-        auto pfnCreateFromProgrammableExp2 = ze_lib::context->zetDdiTable.load()->MetricExp.pfnCreateFromProgrammableExp2;
+        auto pfnCreateFromProgrammableExp2 = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricExp.pfnCreateFromProgrammableExp2;
         if( nullptr == pfnCreateFromProgrammableExp2 ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3390,7 +3390,7 @@ zetMetricCreateFromProgrammableExp2(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreateFromProgrammableExp2 = ze_lib::context->zetDdiTable.load()->MetricExp.pfnCreateFromProgrammableExp2;
+    auto pfnCreateFromProgrammableExp2 = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricExp.pfnCreateFromProgrammableExp2;
     if( nullptr == pfnCreateFromProgrammableExp2 ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3458,7 +3458,7 @@ zetMetricCreateFromProgrammableExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricCreateFromProgrammableExp_t pfnCreateFromProgrammableExp = [&result] {
-        auto pfnCreateFromProgrammableExp = ze_lib::context->zetDdiTable.load()->MetricExp.pfnCreateFromProgrammableExp;
+        auto pfnCreateFromProgrammableExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricExp.pfnCreateFromProgrammableExp;
         if( nullptr == pfnCreateFromProgrammableExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3473,7 +3473,7 @@ zetMetricCreateFromProgrammableExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreateFromProgrammableExp = ze_lib::context->zetDdiTable.load()->MetricExp.pfnCreateFromProgrammableExp;
+    auto pfnCreateFromProgrammableExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricExp.pfnCreateFromProgrammableExp;
     if( nullptr == pfnCreateFromProgrammableExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3544,7 +3544,7 @@ zetDeviceCreateMetricGroupsFromMetricsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnDeviceCreateMetricGroupsFromMetricsExp_t pfnCreateMetricGroupsFromMetricsExp = [&result] {
-        auto pfnCreateMetricGroupsFromMetricsExp = ze_lib::context->zetDdiTable.load()->DeviceExp.pfnCreateMetricGroupsFromMetricsExp;
+        auto pfnCreateMetricGroupsFromMetricsExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->DeviceExp.pfnCreateMetricGroupsFromMetricsExp;
         if( nullptr == pfnCreateMetricGroupsFromMetricsExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3559,7 +3559,7 @@ zetDeviceCreateMetricGroupsFromMetricsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreateMetricGroupsFromMetricsExp = ze_lib::context->zetDdiTable.load()->DeviceExp.pfnCreateMetricGroupsFromMetricsExp;
+    auto pfnCreateMetricGroupsFromMetricsExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->DeviceExp.pfnCreateMetricGroupsFromMetricsExp;
     if( nullptr == pfnCreateMetricGroupsFromMetricsExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3619,7 +3619,7 @@ zetMetricGroupCreateExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricGroupCreateExp_t pfnCreateExp = [&result] {
-        auto pfnCreateExp = ze_lib::context->zetDdiTable.load()->MetricGroupExp.pfnCreateExp;
+        auto pfnCreateExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricGroupExp.pfnCreateExp;
         if( nullptr == pfnCreateExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3634,7 +3634,7 @@ zetMetricGroupCreateExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreateExp = ze_lib::context->zetDdiTable.load()->MetricGroupExp.pfnCreateExp;
+    auto pfnCreateExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricGroupExp.pfnCreateExp;
     if( nullptr == pfnCreateExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3700,7 +3700,7 @@ zetMetricGroupAddMetricExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricGroupAddMetricExp_t pfnAddMetricExp = [&result] {
-        auto pfnAddMetricExp = ze_lib::context->zetDdiTable.load()->MetricGroupExp.pfnAddMetricExp;
+        auto pfnAddMetricExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricGroupExp.pfnAddMetricExp;
         if( nullptr == pfnAddMetricExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3715,7 +3715,7 @@ zetMetricGroupAddMetricExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAddMetricExp = ze_lib::context->zetDdiTable.load()->MetricGroupExp.pfnAddMetricExp;
+    auto pfnAddMetricExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricGroupExp.pfnAddMetricExp;
     if( nullptr == pfnAddMetricExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3767,7 +3767,7 @@ zetMetricGroupRemoveMetricExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricGroupRemoveMetricExp_t pfnRemoveMetricExp = [&result] {
-        auto pfnRemoveMetricExp = ze_lib::context->zetDdiTable.load()->MetricGroupExp.pfnRemoveMetricExp;
+        auto pfnRemoveMetricExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricGroupExp.pfnRemoveMetricExp;
         if( nullptr == pfnRemoveMetricExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3782,7 +3782,7 @@ zetMetricGroupRemoveMetricExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnRemoveMetricExp = ze_lib::context->zetDdiTable.load()->MetricGroupExp.pfnRemoveMetricExp;
+    auto pfnRemoveMetricExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricGroupExp.pfnRemoveMetricExp;
     if( nullptr == pfnRemoveMetricExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3843,7 +3843,7 @@ zetMetricGroupCloseExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricGroupCloseExp_t pfnCloseExp = [&result] {
-        auto pfnCloseExp = ze_lib::context->zetDdiTable.load()->MetricGroupExp.pfnCloseExp;
+        auto pfnCloseExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricGroupExp.pfnCloseExp;
         if( nullptr == pfnCloseExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3858,7 +3858,7 @@ zetMetricGroupCloseExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCloseExp = ze_lib::context->zetDdiTable.load()->MetricGroupExp.pfnCloseExp;
+    auto pfnCloseExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricGroupExp.pfnCloseExp;
     if( nullptr == pfnCloseExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3913,7 +3913,7 @@ zetMetricGroupDestroyExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricGroupDestroyExp_t pfnDestroyExp = [&result] {
-        auto pfnDestroyExp = ze_lib::context->zetDdiTable.load()->MetricGroupExp.pfnDestroyExp;
+        auto pfnDestroyExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricGroupExp.pfnDestroyExp;
         if( nullptr == pfnDestroyExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3928,7 +3928,7 @@ zetMetricGroupDestroyExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroyExp = ze_lib::context->zetDdiTable.load()->MetricGroupExp.pfnDestroyExp;
+    auto pfnDestroyExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricGroupExp.pfnDestroyExp;
     if( nullptr == pfnDestroyExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3977,7 +3977,7 @@ zetMetricDestroyExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricDestroyExp_t pfnDestroyExp = [&result] {
-        auto pfnDestroyExp = ze_lib::context->zetDdiTable.load()->MetricExp.pfnDestroyExp;
+        auto pfnDestroyExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricExp.pfnDestroyExp;
         if( nullptr == pfnDestroyExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -3992,7 +3992,7 @@ zetMetricDestroyExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroyExp = ze_lib::context->zetDdiTable.load()->MetricExp.pfnDestroyExp;
+    auto pfnDestroyExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricExp.pfnDestroyExp;
     if( nullptr == pfnDestroyExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4046,7 +4046,7 @@ zetDeviceGetConcurrentMetricGroupsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnDeviceGetConcurrentMetricGroupsExp_t pfnGetConcurrentMetricGroupsExp = [&result] {
-        auto pfnGetConcurrentMetricGroupsExp = ze_lib::context->zetDdiTable.load()->DeviceExp.pfnGetConcurrentMetricGroupsExp;
+        auto pfnGetConcurrentMetricGroupsExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->DeviceExp.pfnGetConcurrentMetricGroupsExp;
         if( nullptr == pfnGetConcurrentMetricGroupsExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4061,7 +4061,7 @@ zetDeviceGetConcurrentMetricGroupsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetConcurrentMetricGroupsExp = ze_lib::context->zetDdiTable.load()->DeviceExp.pfnGetConcurrentMetricGroupsExp;
+    auto pfnGetConcurrentMetricGroupsExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->DeviceExp.pfnGetConcurrentMetricGroupsExp;
     if( nullptr == pfnGetConcurrentMetricGroupsExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4132,7 +4132,7 @@ zetMetricTracerCreateExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricTracerCreateExp_t pfnCreateExp = [&result] {
-        auto pfnCreateExp = ze_lib::context->zetDdiTable.load()->MetricTracerExp.pfnCreateExp;
+        auto pfnCreateExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricTracerExp.pfnCreateExp;
         if( nullptr == pfnCreateExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4147,7 +4147,7 @@ zetMetricTracerCreateExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreateExp = ze_lib::context->zetDdiTable.load()->MetricTracerExp.pfnCreateExp;
+    auto pfnCreateExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricTracerExp.pfnCreateExp;
     if( nullptr == pfnCreateExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4193,7 +4193,7 @@ zetMetricTracerDestroyExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricTracerDestroyExp_t pfnDestroyExp = [&result] {
-        auto pfnDestroyExp = ze_lib::context->zetDdiTable.load()->MetricTracerExp.pfnDestroyExp;
+        auto pfnDestroyExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricTracerExp.pfnDestroyExp;
         if( nullptr == pfnDestroyExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4208,7 +4208,7 @@ zetMetricTracerDestroyExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroyExp = ze_lib::context->zetDdiTable.load()->MetricTracerExp.pfnDestroyExp;
+    auto pfnDestroyExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricTracerExp.pfnDestroyExp;
     if( nullptr == pfnDestroyExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4262,7 +4262,7 @@ zetMetricTracerEnableExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricTracerEnableExp_t pfnEnableExp = [&result] {
-        auto pfnEnableExp = ze_lib::context->zetDdiTable.load()->MetricTracerExp.pfnEnableExp;
+        auto pfnEnableExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricTracerExp.pfnEnableExp;
         if( nullptr == pfnEnableExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4277,7 +4277,7 @@ zetMetricTracerEnableExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnableExp = ze_lib::context->zetDdiTable.load()->MetricTracerExp.pfnEnableExp;
+    auto pfnEnableExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricTracerExp.pfnEnableExp;
     if( nullptr == pfnEnableExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4332,7 +4332,7 @@ zetMetricTracerDisableExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricTracerDisableExp_t pfnDisableExp = [&result] {
-        auto pfnDisableExp = ze_lib::context->zetDdiTable.load()->MetricTracerExp.pfnDisableExp;
+        auto pfnDisableExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricTracerExp.pfnDisableExp;
         if( nullptr == pfnDisableExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4347,7 +4347,7 @@ zetMetricTracerDisableExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDisableExp = ze_lib::context->zetDdiTable.load()->MetricTracerExp.pfnDisableExp;
+    auto pfnDisableExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricTracerExp.pfnDisableExp;
     if( nullptr == pfnDisableExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4410,7 +4410,7 @@ zetMetricTracerReadDataExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricTracerReadDataExp_t pfnReadDataExp = [&result] {
-        auto pfnReadDataExp = ze_lib::context->zetDdiTable.load()->MetricTracerExp.pfnReadDataExp;
+        auto pfnReadDataExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricTracerExp.pfnReadDataExp;
         if( nullptr == pfnReadDataExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4425,7 +4425,7 @@ zetMetricTracerReadDataExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReadDataExp = ze_lib::context->zetDdiTable.load()->MetricTracerExp.pfnReadDataExp;
+    auto pfnReadDataExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricTracerExp.pfnReadDataExp;
     if( nullptr == pfnReadDataExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4470,7 +4470,7 @@ zetMetricDecoderCreateExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricDecoderCreateExp_t pfnCreateExp = [&result] {
-        auto pfnCreateExp = ze_lib::context->zetDdiTable.load()->MetricDecoderExp.pfnCreateExp;
+        auto pfnCreateExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricDecoderExp.pfnCreateExp;
         if( nullptr == pfnCreateExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4485,7 +4485,7 @@ zetMetricDecoderCreateExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreateExp = ze_lib::context->zetDdiTable.load()->MetricDecoderExp.pfnCreateExp;
+    auto pfnCreateExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricDecoderExp.pfnCreateExp;
     if( nullptr == pfnCreateExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4527,7 +4527,7 @@ zetMetricDecoderDestroyExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricDecoderDestroyExp_t pfnDestroyExp = [&result] {
-        auto pfnDestroyExp = ze_lib::context->zetDdiTable.load()->MetricDecoderExp.pfnDestroyExp;
+        auto pfnDestroyExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricDecoderExp.pfnDestroyExp;
         if( nullptr == pfnDestroyExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4542,7 +4542,7 @@ zetMetricDecoderDestroyExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroyExp = ze_lib::context->zetDdiTable.load()->MetricDecoderExp.pfnDestroyExp;
+    auto pfnDestroyExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricDecoderExp.pfnDestroyExp;
     if( nullptr == pfnDestroyExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4606,7 +4606,7 @@ zetMetricDecoderGetDecodableMetricsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricDecoderGetDecodableMetricsExp_t pfnGetDecodableMetricsExp = [&result] {
-        auto pfnGetDecodableMetricsExp = ze_lib::context->zetDdiTable.load()->MetricDecoderExp.pfnGetDecodableMetricsExp;
+        auto pfnGetDecodableMetricsExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricDecoderExp.pfnGetDecodableMetricsExp;
         if( nullptr == pfnGetDecodableMetricsExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4621,7 +4621,7 @@ zetMetricDecoderGetDecodableMetricsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetDecodableMetricsExp = ze_lib::context->zetDdiTable.load()->MetricDecoderExp.pfnGetDecodableMetricsExp;
+    auto pfnGetDecodableMetricsExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricDecoderExp.pfnGetDecodableMetricsExp;
     if( nullptr == pfnGetDecodableMetricsExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4707,7 +4707,7 @@ zetMetricTracerDecodeExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnMetricTracerDecodeExp_t pfnDecodeExp = [&result] {
-        auto pfnDecodeExp = ze_lib::context->zetDdiTable.load()->MetricTracerExp.pfnDecodeExp;
+        auto pfnDecodeExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricTracerExp.pfnDecodeExp;
         if( nullptr == pfnDecodeExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4722,7 +4722,7 @@ zetMetricTracerDecodeExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDecodeExp = ze_lib::context->zetDdiTable.load()->MetricTracerExp.pfnDecodeExp;
+    auto pfnDecodeExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->MetricTracerExp.pfnDecodeExp;
     if( nullptr == pfnDecodeExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4774,7 +4774,7 @@ zetCommandListAppendMarkerExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnCommandListAppendMarkerExp_t pfnAppendMarkerExp = [&result] {
-        auto pfnAppendMarkerExp = ze_lib::context->zetDdiTable.load()->CommandListExp.pfnAppendMarkerExp;
+        auto pfnAppendMarkerExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->CommandListExp.pfnAppendMarkerExp;
         if( nullptr == pfnAppendMarkerExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4789,7 +4789,7 @@ zetCommandListAppendMarkerExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMarkerExp = ze_lib::context->zetDdiTable.load()->CommandListExp.pfnAppendMarkerExp;
+    auto pfnAppendMarkerExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->CommandListExp.pfnAppendMarkerExp;
     if( nullptr == pfnAppendMarkerExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4844,7 +4844,7 @@ zetDeviceEnableMetricsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnDeviceEnableMetricsExp_t pfnEnableMetricsExp = [&result] {
-        auto pfnEnableMetricsExp = ze_lib::context->zetDdiTable.load()->DeviceExp.pfnEnableMetricsExp;
+        auto pfnEnableMetricsExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->DeviceExp.pfnEnableMetricsExp;
         if( nullptr == pfnEnableMetricsExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4859,7 +4859,7 @@ zetDeviceEnableMetricsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnableMetricsExp = ze_lib::context->zetDdiTable.load()->DeviceExp.pfnEnableMetricsExp;
+    auto pfnEnableMetricsExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->DeviceExp.pfnEnableMetricsExp;
     if( nullptr == pfnEnableMetricsExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4911,7 +4911,7 @@ zetDeviceDisableMetricsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
     static const zet_pfnDeviceDisableMetricsExp_t pfnDisableMetricsExp = [&result] {
-        auto pfnDisableMetricsExp = ze_lib::context->zetDdiTable.load()->DeviceExp.pfnDisableMetricsExp;
+        auto pfnDisableMetricsExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->DeviceExp.pfnDisableMetricsExp;
         if( nullptr == pfnDisableMetricsExp ) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
@@ -4926,7 +4926,7 @@ zetDeviceDisableMetricsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDisableMetricsExp = ze_lib::context->zetDdiTable.load()->DeviceExp.pfnDisableMetricsExp;
+    auto pfnDisableMetricsExp = ze_lib::zetDdiTable.load(std::memory_order_acquire)->DeviceExp.pfnDisableMetricsExp;
     if( nullptr == pfnDisableMetricsExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -19,6 +19,8 @@
 
 #include <vector>
 #include <fstream>
+#include <set>
+#include <utility>
 #include <sys/stat.h>
 // Helper to split a colon-separated path string
 static std::vector<std::string> splitPaths(const std::string& paths) {
@@ -31,10 +33,29 @@ static std::vector<std::string> splitPaths(const std::string& paths) {
   return result;
 }
 
-// Helper to check if a file exists and is readable
+// Helper to check if a file exists and is readable; access() fails with
+// ENOENT for missing files, so no separate stat() is needed.
 static bool fileExistsReadable(const std::string& path) {
-  struct stat sb;
-  return (stat(path.c_str(), &sb) == 0) && (access(path.c_str(), R_OK) == 0);
+  return access(path.c_str(), R_OK) == 0;
+}
+
+// Drops entries that do not exist or are not directories, and entries that
+// name a directory already in the list (duplicates, symlinked aliases such as
+// /lib -> /usr/lib on merged-/usr systems).  First occurrence wins, so the
+// search order is preserved.
+static std::vector<std::string> uniqueExistingDirectories(const std::vector<std::string>& paths) {
+  std::vector<std::string> result;
+  std::set<std::pair<dev_t, ino_t>> seen;
+  for (const auto& dir : paths) {
+    struct stat sb;
+    if (stat(dir.c_str(), &sb) != 0 || !S_ISDIR(sb.st_mode)) {
+      continue;
+    }
+    if (seen.insert(std::make_pair(sb.st_dev, sb.st_ino)).second) {
+      result.push_back(dir);
+    }
+  }
+  return result;
 }
 
 // Helper to get all library search paths from LD_LIBRARY_PATH, standard locations, and /etc/ld.so.conf
@@ -105,12 +126,13 @@ static std::vector<std::string> getLibrarySearchPaths() {
       }
     }
   }
-  return paths;
+  return uniqueExistingDirectories(paths);
 }
 
-// Main function: search for a library file in all known library paths
-static bool libraryExistsInSearchPaths(const std::string& filename) {
-  auto paths = getLibrarySearchPaths();
+// Main function: search for a library file in the library paths returned by
+// getLibrarySearchPaths().  Callers build the path list once per discovery.
+static bool libraryExistsInSearchPaths(const std::string& filename,
+                                       const std::vector<std::string>& paths) {
   for (const auto& dir : paths) {
     std::string fullPath = dir + "/" + filename;
     if (fileExistsReadable(fullPath)) {
@@ -136,9 +158,12 @@ std::vector<DriverLibraryPath> discoverEnabledDrivers() {
   // ZE_ENABLE_ALT_DRIVERS is for development/debug only
   altDrivers = getenv("ZE_ENABLE_ALT_DRIVERS");
   if (altDrivers == nullptr) {
-    // Standard drivers - not custom
+    // Standard drivers - not custom.  The search paths (LD_LIBRARY_PATH,
+    // standard locations, ld.so.conf and its includes) are read once for all
+    // known driver names.
+    const auto searchPaths = getLibrarySearchPaths();
     for (auto path : knownDriverNames) {
-      if (libraryExistsInSearchPaths(path)) {
+      if (libraryExistsInSearchPaths(path, searchPaths)) {
         // Extract the base library name for robust driver type detection
         // path is like "libze_intel_gpu.so.1"
         std::string libName = path;
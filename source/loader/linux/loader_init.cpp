@@ -7,6 +7,7 @@
  */
 
 #include "../ze_loader_internal.h"
+#include "../../lib/ze_lib.h"
 
 namespace loader
 {
@@ -16,6 +17,11 @@ namespace loader
     }
 
     void __attribute__((destructor)) deleteLoaderContext() {
+        // This runs before ze_lib's destructor; sampler threads still call
+        // into the drivers through this context, so stop them first.
+        if (ze_lib::context) {
+            ze_lib::context->stopSysmanSamplers();
+        }
         delete context;
     }
 #endif
@@ -164,14 +164,16 @@ namespace loader
         ze_result_t result = ZE_RESULT_SUCCESS;
         
         bool atLeastOneDriverValid = false;
+        loader::context->init_drivers( loader::context->zeDrivers, flags, nullptr, false );
         for( auto& drv : loader::context->zeDrivers )
         {
             if(drv.initStatus != ZE_RESULT_SUCCESS)
                 continue;
-            if (!drv.handle || !drv.ddiInitialized) {
+            if (!drv.handle || !drv.ddiInitialized || drv.initResultPending) {
                 auto res = loader::context->init_driver( drv, flags, nullptr );
                 if (res != ZE_RESULT_SUCCESS || drv.zeddiInitResult != ZE_RESULT_SUCCESS) {
                     drv.ddiInitialized = false;
+                    drv.initResultPending = false;
                     continue;
                 }
             }
@@ -185,6 +187,8 @@ namespace loader
             drv.legacyInitAttempted = true;
         }
 
+        loader::context->invalidateDriverHandleSnapshots();
+
         if(!atLeastOneDriverValid)
             result=ZE_RESULT_ERROR_UNINITIALIZED;
 
@@ -207,6 +211,12 @@ namespace loader
     {
         ze_result_t result = ZE_RESULT_SUCCESS;
         
+        // Once a complete, sorted list has been returned it is served from an
+        // immutable snapshot without the sort lock or any driver calls.
+        if( loader::context->zeDriverHandles.get( pCount, phDrivers ) )
+            return ZE_RESULT_SUCCESS;
+        const uint64_t snapshotGeneration = loader::context->zeDriverHandles.generation();
+        bool snapshotComplete = ( nullptr != phDrivers );
         uint32_t total_driver_handle_count = 0;
 
         {
@@ -225,8 +235,10 @@ namespace loader
             if(drv.initStatus != ZE_RESULT_SUCCESS || !drv.ddiInitialized)
                 continue;
 
-            if( ( 0 < *pCount ) && ( *pCount == total_driver_handle_count))
+            if( ( 0 < *pCount ) && ( *pCount == total_driver_handle_count)) {
+                snapshotComplete = false;
                 break;
+            }
 
             uint32_t library_driver_handle_count = 0;
 
@@ -236,6 +248,7 @@ namespace loader
                 if (ZE_RESULT_ERROR_UNINITIALIZED == result) {
                     drv.initStatus = result;
                 }
+                snapshotComplete = false;
                 continue;
             }
 
@@ -243,6 +256,7 @@ namespace loader
             {
                 if( total_driver_handle_count + library_driver_handle_count > *pCount) {
                     library_driver_handle_count = *pCount - total_driver_handle_count;
+                    snapshotComplete = false;
                 }
                 result = drv.dditable.ze.Driver.pfnGet( &library_driver_handle_count, &phDrivers[ total_driver_handle_count ] );
                 if( ZE_RESULT_SUCCESS != result ) break;
@@ -322,12 +336,15 @@ namespace loader
                 catch( std::bad_alloc& )
                 {
                     result = ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+                    snapshotComplete = false;
                 }
             }
 
             total_driver_handle_count += library_driver_handle_count;
         }
 
+        snapshotComplete = snapshotComplete && ZE_RESULT_SUCCESS == result && total_driver_handle_count > 0;
+
         // If the last driver get failed, but at least one driver succeeded, then return success with total count.
         if( ZE_RESULT_SUCCESS == result || total_driver_handle_count > 0)
             *pCount = total_driver_handle_count;
@@ -339,6 +356,9 @@ namespace loader
         else
             loader::context->defaultZerDriverHandle = nullptr;
 
+        if( snapshotComplete )
+            loader::context->zeDriverHandles.publish( phDrivers, total_driver_handle_count, snapshotGeneration );
+
         return result;
     }
 
@@ -361,15 +381,18 @@ namespace loader
         ze_result_t result = ZE_RESULT_SUCCESS;
         
         uint32_t total_driver_handle_count = 0;
+        loader::context->init_drivers( loader::context->zeDrivers, 0, desc, false );
         for( auto& drv : loader::context->zeDrivers ) {
-            if (!drv.handle || !drv.ddiInitialized) {
+            if (!drv.handle || !drv.ddiInitialized || drv.initResultPending) {
                 auto res = loader::context->init_driver( drv, 0, desc);
                 if (res != ZE_RESULT_SUCCESS || drv.zeddiInitResult != ZE_RESULT_SUCCESS) {
                     drv.ddiInitialized = false;
+                    drv.initResultPending = false;
                     continue;
                 }
             }
         }
+        loader::context->invalidateDriverHandleSnapshots();
 
         {
             std::lock_guard<std::mutex> lock(loader::context->sortMutex);
@@ -390,8 +413,9 @@ namespace loader
                 continue;
             }
 
-            if( ( 0 < *pCount ) && ( *pCount == total_driver_handle_count))
+            if( ( 0 < *pCount ) && ( *pCount == total_driver_handle_count)) {
                 break;
+            }
 
             uint32_t library_driver_handle_count = 0;
 
@@ -1424,13 +1448,13 @@ namespace loader
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
         // convert loader handles to driver handles
-        auto phDevicesLocal = new ze_device_handle_t [numDevices];
+        loader::local_handle_array_t<ze_device_handle_t> phDevicesStorage( numDevices );
+        auto phDevicesLocal = phDevicesStorage.data();
         for( size_t i = 0; ( nullptr != phDevices ) && ( i < numDevices ); ++i )
             phDevicesLocal[ i ] = reinterpret_cast<ze_device_object_t*>( phDevices[ i ] )->handle;
 
         // forward to device-driver
         result = pfnCreateEx( hDriver, desc, numDevices, phDevicesLocal, phContext );
-        delete []phDevicesLocal;
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -1600,7 +1624,8 @@ namespace loader
         hCommandQueue = reinterpret_cast<ze_command_queue_object_t*>( hCommandQueue )->handle;
 
         // convert loader handles to driver handles
-        auto phCommandListsLocal = new ze_command_list_handle_t [numCommandLists];
+        loader::local_handle_array_t<ze_command_list_handle_t> phCommandListsStorage( numCommandLists );
+        auto phCommandListsLocal = phCommandListsStorage.data();
         for( size_t i = 0; ( nullptr != phCommandLists ) && ( i < numCommandLists ); ++i )
             phCommandListsLocal[ i ] = reinterpret_cast<ze_command_list_object_t*>( phCommandLists[ i ] )->handle;
 
@@ -1609,7 +1634,6 @@ namespace loader
 
         // forward to device-driver
         result = pfnExecuteCommandLists( hCommandQueue, numCommandLists, phCommandListsLocal, hFence );
-        delete []phCommandListsLocal;
 
         return result;
     }
@@ -1965,13 +1989,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendWriteGlobalTimestamp( hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -2289,13 +2313,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendBarrier( hCommandList, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -2330,13 +2354,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendMemoryRangesBarrier( hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -2399,13 +2423,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendMemoryCopy( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -2441,13 +2465,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendMemoryCopyWithParameters( hCommandList, dstptr, srcptr, size, pNext, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -2483,13 +2507,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendMemoryFill( hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -2526,13 +2550,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendMemoryFillWithParameters( hCommandList, ptr, pattern, pattern_size, size, pNext, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -2576,13 +2600,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendMemoryCopyRegion( hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -2621,13 +2645,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendMemoryCopyFromContext( hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -2667,13 +2691,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendImageCopy( hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -2715,13 +2739,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendImageCopyRegion( hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -2759,13 +2783,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendImageCopyToMemory( hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -2803,13 +2827,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendImageCopyFromMemory( hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -2898,13 +2922,13 @@ namespace loader
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
         // convert loader handles to driver handles
-        auto phDevicesLocal = new ze_device_handle_t [numDevices];
+        loader::local_handle_array_t<ze_device_handle_t> phDevicesStorage( numDevices );
+        auto phDevicesLocal = phDevicesStorage.data();
         for( size_t i = 0; ( nullptr != phDevices ) && ( i < numDevices ); ++i )
             phDevicesLocal[ i ] = reinterpret_cast<ze_device_object_t*>( phDevices[ i ] )->handle;
 
         // forward to device-driver
         result = pfnCreate( hContext, desc, numDevices, phDevicesLocal, phEventPool );
-        delete []phDevicesLocal;
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -3361,13 +3385,13 @@ namespace loader
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
         // convert loader handles to driver handles
-        auto phEventsLocal = new ze_event_handle_t [numEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phEventsStorage( numEvents );
+        auto phEventsLocal = phEventsStorage.data();
         for( size_t i = 0; ( nullptr != phEvents ) && ( i < numEvents ); ++i )
             phEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendWaitOnEvents( hCommandList, numEvents, phEventsLocal );
-        delete []phEventsLocal;
 
         return result;
     }
@@ -3559,7 +3583,8 @@ namespace loader
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
         // convert loader handles to driver handles
-        auto phEventsLocal = new ze_event_handle_t [numEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phEventsStorage( numEvents );
+        auto phEventsLocal = phEventsStorage.data();
         for( size_t i = 0; ( nullptr != phEvents ) && ( i < numEvents ); ++i )
             phEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phEvents[ i ] )->handle;
 
@@ -3567,14 +3592,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendQueryKernelTimestamps( hCommandList, numEvents, phEventsLocal, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phEventsLocal;
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -4545,13 +4569,13 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handles to driver handles
-        auto phModulesLocal = new ze_module_handle_t [numModules];
+        loader::local_handle_array_t<ze_module_handle_t> phModulesStorage( numModules );
+        auto phModulesLocal = phModulesStorage.data();
         for( size_t i = 0; ( nullptr != phModules ) && ( i < numModules ); ++i )
             phModulesLocal[ i ] = reinterpret_cast<ze_module_object_t*>( phModules[ i ] )->handle;
 
         // forward to device-driver
         result = pfnDynamicLink( numModules, phModulesLocal, phLinkLog );
-        delete []phModulesLocal;
 
         try
         {
@@ -5156,13 +5180,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendLaunchKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -5200,13 +5224,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendLaunchKernelWithParameters( hCommandList, hKernel, pGroupCounts, pNext, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -5246,13 +5270,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendLaunchKernelWithArguments( hCommandList, hKernel, groupCounts, groupSizes, pArguments, pNext, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -5289,13 +5313,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendLaunchCooperativeKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -5333,13 +5357,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendLaunchKernelIndirect( hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -5375,7 +5399,8 @@ namespace loader
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
         // convert loader handles to driver handles
-        auto phKernelsLocal = new ze_kernel_handle_t [numKernels];
+        loader::local_handle_array_t<ze_kernel_handle_t> phKernelsStorage( numKernels );
+        auto phKernelsLocal = phKernelsStorage.data();
         for( size_t i = 0; ( nullptr != phKernels ) && ( i < numKernels ); ++i )
             phKernelsLocal[ i ] = reinterpret_cast<ze_kernel_object_t*>( phKernels[ i ] )->handle;
 
@@ -5383,14 +5408,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendLaunchMultipleKernelsIndirect( hCommandList, numKernels, phKernelsLocal, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phKernelsLocal;
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -6248,13 +6272,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendImageCopyToMemoryExt( hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -6296,13 +6320,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendImageCopyFromMemoryExt( hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -6357,13 +6381,13 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handles to driver handles
-        auto phModulesLocal = new ze_module_handle_t [numModules];
+        loader::local_handle_array_t<ze_module_handle_t> phModulesStorage( numModules );
+        auto phModulesLocal = phModulesStorage.data();
         for( size_t i = 0; ( nullptr != phModules ) && ( i < numModules ); ++i )
             phModulesLocal[ i ] = reinterpret_cast<ze_module_object_t*>( phModules[ i ] )->handle;
 
         // forward to device-driver
         result = pfnInspectLinkageExt( pInspectDesc, numModules, phModulesLocal, phLog );
-        delete []phModulesLocal;
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -7183,7 +7207,8 @@ namespace loader
         hCommandListImmediate = reinterpret_cast<ze_command_list_object_t*>( hCommandListImmediate )->handle;
 
         // convert loader handles to driver handles
-        auto phCommandListsLocal = new ze_command_list_handle_t [numCommandLists];
+        loader::local_handle_array_t<ze_command_list_handle_t> phCommandListsStorage( numCommandLists );
+        auto phCommandListsLocal = phCommandListsStorage.data();
         for( size_t i = 0; ( nullptr != phCommandLists ) && ( i < numCommandLists ); ++i )
             phCommandListsLocal[ i ] = reinterpret_cast<ze_command_list_object_t*>( phCommandLists[ i ] )->handle;
 
@@ -7191,14 +7216,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnImmediateAppendCommandListsExp( hCommandListImmediate, numCommandLists, phCommandListsLocal, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phCommandListsLocal;
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -7234,7 +7258,8 @@ namespace loader
         hCommandListImmediate = reinterpret_cast<ze_command_list_object_t*>( hCommandListImmediate )->handle;
 
         // convert loader handles to driver handles
-        auto phCommandListsLocal = new ze_command_list_handle_t [numCommandLists];
+        loader::local_handle_array_t<ze_command_list_handle_t> phCommandListsStorage( numCommandLists );
+        auto phCommandListsLocal = phCommandListsStorage.data();
         for( size_t i = 0; ( nullptr != phCommandLists ) && ( i < numCommandLists ); ++i )
             phCommandListsLocal[ i ] = reinterpret_cast<ze_command_list_object_t*>( phCommandLists[ i ] )->handle;
 
@@ -7242,14 +7267,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnImmediateAppendCommandListsWithParameters( hCommandListImmediate, numCommandLists, phCommandListsLocal, pNext, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phCommandListsLocal;
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -7305,13 +7329,13 @@ namespace loader
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
         // convert loader handles to driver handles
-        auto phKernelsLocal = new ze_kernel_handle_t [numKernels];
+        loader::local_handle_array_t<ze_kernel_handle_t> phKernelsStorage( numKernels );
+        auto phKernelsLocal = phKernelsStorage.data();
         for( size_t i = 0; ( nullptr != phKernels ) && ( i < numKernels ); ++i )
             phKernelsLocal[ i ] = reinterpret_cast<ze_kernel_object_t*>( phKernels[ i ] )->handle;
 
         // forward to device-driver
         result = pfnGetNextCommandIdWithKernelsExp( hCommandList, desc, numKernels, phKernelsLocal, pCommandId );
-        delete []phKernelsLocal;
 
         return result;
     }
@@ -7420,13 +7444,13 @@ namespace loader
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnUpdateMutableCommandWaitEventsExp( hCommandList, commandId, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -7454,13 +7478,13 @@ namespace loader
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
         // convert loader handles to driver handles
-        auto phKernelsLocal = new ze_kernel_handle_t [numKernels];
+        loader::local_handle_array_t<ze_kernel_handle_t> phKernelsStorage( numKernels );
+        auto phKernelsLocal = phKernelsStorage.data();
         for( size_t i = 0; ( nullptr != phKernels ) && ( i < numKernels ); ++i )
             phKernelsLocal[ i ] = reinterpret_cast<ze_kernel_object_t*>( phKernels[ i ] )->handle;
 
         // forward to device-driver
         result = pfnUpdateMutableCommandKernelsExp( hCommandList, numKernels, pCommandId, phKernelsLocal );
-        delete []phKernelsLocal;
 
         return result;
     }
@@ -7584,7 +7608,8 @@ namespace loader
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
         // convert loader handles to driver handles
-        auto phSemaphoresLocal = new ze_external_semaphore_ext_handle_t [numSemaphores];
+        loader::local_handle_array_t<ze_external_semaphore_ext_handle_t> phSemaphoresStorage( numSemaphores );
+        auto phSemaphoresLocal = phSemaphoresStorage.data();
         for( size_t i = 0; ( nullptr != phSemaphores ) && ( i < numSemaphores ); ++i )
             phSemaphoresLocal[ i ] = reinterpret_cast<ze_external_semaphore_ext_object_t*>( phSemaphores[ i ] )->handle;
 
@@ -7592,14 +7617,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendSignalExternalSemaphoreExt( hCommandList, numSemaphores, phSemaphoresLocal, signalParams, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phSemaphoresLocal;
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -7633,7 +7657,8 @@ namespace loader
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
         // convert loader handles to driver handles
-        auto phSemaphoresLocal = new ze_external_semaphore_ext_handle_t [numSemaphores];
+        loader::local_handle_array_t<ze_external_semaphore_ext_handle_t> phSemaphoresStorage( numSemaphores );
+        auto phSemaphoresLocal = phSemaphoresStorage.data();
         for( size_t i = 0; ( nullptr != phSemaphores ) && ( i < numSemaphores ); ++i )
             phSemaphoresLocal[ i ] = reinterpret_cast<ze_external_semaphore_ext_object_t*>( phSemaphores[ i ] )->handle;
 
@@ -7641,14 +7666,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendWaitExternalSemaphoreExt( hCommandList, numSemaphores, phSemaphoresLocal, waitParams, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phSemaphoresLocal;
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -7816,13 +7840,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnCommandListAppendCopyExt( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -8412,13 +8436,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendGraphExt( hCommandList, hGraph, pNext, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -8605,13 +8629,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendHostFunction( hCommandList, pfnHostFunction, pUserData, pNext, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
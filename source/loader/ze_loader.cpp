@@ -8,8 +8,12 @@
 #include "ze_loader_utils.h"
 
 #include "driver_discovery.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
 #include <iostream>
 #include <set>
+#include <thread>
 
 #ifdef __linux__
 #include <unistd.h>
@@ -26,11 +30,21 @@ namespace loader
 
     void context_t::debug_trace_message(std::string message, std::string result) {
         if (debugTraceEnabled) {
-            std::cerr << "ZE_LOADER_DEBUG_TRACE:" << message << result << std::endl;
+            // Single insertion so lines from concurrent driver init do not interleave.
+            std::cerr << "ZE_LOADER_DEBUG_TRACE:" + message + result + "\n" << std::flush;
         }
         zel_logger->log_trace(message + result);
     };
 
+    // Milliseconds since start, formatted for the startup timing debug trace.
+    static std::string elapsed_ms(std::chrono::steady_clock::time_point start) {
+        const double ms = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+        char buf[32];
+        std::snprintf(buf, sizeof(buf), "%.3f ms", ms);
+        return buf;
+    }
+
     std::string to_string(const ze_init_flags_t flags) {
         if (flags & ZE_INIT_FLAG_GPU_ONLY) {
             return "ZE_INIT_FLAG_GPU_ONLY";
@@ -479,6 +493,11 @@ namespace loader
     }
 
     ze_result_t context_t::init_driver(driver_t &driver, ze_init_flags_t flags, ze_init_driver_type_desc_t* desc) {
+        if (driver.initResultPending) {
+            // Already initialized by init_drivers() with the same flags/desc.
+            driver.initResultPending = false;
+            return driver.pendingInitResult;
+        }
         bool loadDriver = false;
         if (debugTraceEnabled) {
             std::string message = "Initializing driver " + driver.name + " with type " + std::to_string(driver.driverType);\
@@ -506,10 +525,12 @@ namespace loader
         loadDriver = !driver.handle && driver.customDriver ? true : loadDriver;
 
         if (loadDriver && !driver.handle) {
+            const auto loadStart = std::chrono::steady_clock::now();
             auto handle = LOAD_DRIVER_LIBRARY( driver.name.c_str() );
             if( NULL != handle )
             {
                 if (debugTraceEnabled) {
+                    debug_trace_message("init driver " + driver.name + " library load took ", elapsed_ms(loadStart));
 #if !defined(_WIN32) && !defined(ANDROID)
                     struct link_map *dlinfo_map;
                     if (dlinfo(handle, RTLD_DI_LINKMAP, &dlinfo_map) == 0) {
@@ -535,6 +556,7 @@ namespace loader
         }
 
         if (driver.handle && !driver.ddiInitialized) {
+            const auto ddiStart = std::chrono::steady_clock::now();
             auto res = loader::zeloaderInitDriverDDITables(&driver);
             if (res != ZE_RESULT_SUCCESS) {
                 if (debugTraceEnabled) {
@@ -586,6 +608,9 @@ namespace loader
             }
 
             driver.ddiInitialized = true;
+            if (debugTraceEnabled) {
+                debug_trace_message("init driver " + driver.name + " DDI table init took ", elapsed_ms(ddiStart));
+            }
         }
 
         if (!driver.handle && !driver.ddiInitialized) {
@@ -599,6 +624,63 @@ namespace loader
         return ZE_RESULT_SUCCESS;
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// Opt-in (ZEL_ENABLE_PARALLEL_DRIVER_INIT=1) concurrent pass over the drivers
+    /// the caller is about to initialize one by one.  Each driver's library load
+    /// and DDI table init only touches that driver, so they run on a few worker
+    /// threads; the results are parked in the driver and consumed, in driver
+    /// order, by the caller's own init_driver() loop, so reporting and sorting
+    /// stay exactly as in the serial path.
+    void context_t::init_drivers(driver_vector_t &drivers, ze_init_flags_t flags, ze_init_driver_type_desc_t* desc, bool sysmanInit) {
+        if (!parallelDriverInit) {
+            return;
+        }
+        // Select the same drivers the caller's loop would pass to init_driver().
+        // A result parked by an earlier call that its loop never consumed was
+        // computed for other flags, so it is dropped first.
+        std::vector<driver_t *> pending;
+        for (auto &driver : drivers) {
+            driver.initResultPending = false;
+            if (!desc && driver.initStatus != ZE_RESULT_SUCCESS)
+                continue;
+            if (sysmanInit && driver.initSysManStatus != ZE_RESULT_SUCCESS)
+                continue;
+            if (driver.handle && driver.ddiInitialized)
+                continue;
+            pending.push_back(&driver);
+        }
+        if (pending.size() < 2) {
+            return;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        const size_t maxThreads = 4;
+        const size_t threadCount = std::min(pending.size(), maxThreads);
+        std::atomic<size_t> next = {0};
+        auto worker = [&]() {
+            for (size_t i = next.fetch_add(1); i < pending.size(); i = next.fetch_add(1)) {
+                driver_t &driver = *pending[i];
+                driver.pendingInitResult = init_driver(driver, flags, desc);
+                driver.initResultPending = true;
+            }
+        };
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount - 1);
+        for (size_t t = 1; t < threadCount; ++t) {
+            threads.emplace_back(worker);
+        }
+        worker();
+        for (auto &thread : threads) {
+            thread.join();
+        }
+
+        if (debugTraceEnabled) {
+            std::string message = "Parallel init of " + std::to_string(pending.size()) + " drivers on " +
+                                  std::to_string(threadCount) + " threads took ";
+            debug_trace_message(message, elapsed_ms(start));
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////////
     ze_result_t context_t::init()
     {
@@ -642,7 +724,10 @@ namespace loader
         } else {
             driverDDIPathDefault = true; // fallback to the default for any other value
         }
+        parallelDriverInit = getenv_tobool( "ZEL_ENABLE_PARALLEL_DRIVER_INIT" );
+        const auto initStart = std::chrono::steady_clock::now();
         auto discoveredDrivers = discoverEnabledDrivers();
+        const std::string discoveryTime = elapsed_ms(initStart);
         std::string loadLibraryErrorValue;
 
 #ifdef L0_STATIC_LOADER_BUILD
@@ -684,6 +769,7 @@ namespace loader
         zeDrivers.reserve( discoveredDrivers.size() + getenv_tobool( "ZE_ENABLE_NULL_DRIVER" ) );
         zesDrivers.reserve( discoveredDrivers.size() + getenv_tobool( "ZE_ENABLE_NULL_DRIVER" ) );
         allDrivers.reserve( discoveredDrivers.size() + getenv_tobool( "ZE_ENABLE_NULL_DRIVER" ) );
+        const auto driverLoadStart = std::chrono::steady_clock::now();
         if( getenv_tobool( "ZE_ENABLE_NULL_DRIVER" ) )
         {
             zel_logger->log_info("Enabling Null Driver");
@@ -756,6 +842,7 @@ namespace loader
                 allDrivers.rbegin()->driverType = driverInfo.driverType;
             }
         }
+        const std::string driverLoadTime = elapsed_ms(driverLoadStart);
         if(allDrivers.size()==0){
             if (debugTraceEnabled) {
                 std::string message = "0 Drivers Discovered";
@@ -768,6 +855,7 @@ namespace loader
         std::copy(allDrivers.begin(), allDrivers.end(), std::back_inserter(zesDrivers));
 
         typedef ze_result_t (ZE_APICALL *getVersion_t)(zel_component_version_t *version);
+        const auto layerLoadStart = std::chrono::steady_clock::now();
         if( getenv_tobool( "ZE_ENABLE_VALIDATION_LAYER" ) )
         {
             zel_logger->log_info("Validation Layer Enabled");
@@ -851,6 +939,17 @@ namespace loader
             loadLibraryErrorValue.clear();
         }
 
+        if (debugTraceEnabled) {
+            // Drivers discovered more than one at a time are loaded lazily by
+            // init_driver(), which reports its own load and DDI init times.
+            std::string message = "Loader init timing: driver discovery " + discoveryTime +
+                                  ", eager driver load " + driverLoadTime +
+                                  ", layer load " + elapsed_ms(layerLoadStart) +
+                                  ", total " + elapsed_ms(initStart) +
+                                  (parallelDriverInit ? " (parallel driver init enabled)" : "");
+            debug_trace_message(message, "");
+        }
+
         if( getenv_tobool( "ZET_ENABLE_API_TRACING_EXP" ) ) {
             auto depr_msg = "ZET_ENABLE_API_TRACING_EXP is deprecated. Use ZE_ENABLE_TRACING_LAYER instead";
             zel_logger->log_warning(depr_msg);
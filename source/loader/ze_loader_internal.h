@@ -8,9 +8,12 @@
  *
  */
 #pragma once
+#include <algorithm>
 #include <vector>
 #include <map>
 #include <atomic>
+#include <memory>
+#include <mutex>
 
 #include "ze_ddi_common.h"
 
@@ -67,10 +70,165 @@ namespace loader
         ze_result_t zetddiInitResult = ZE_RESULT_ERROR_UNINITIALIZED;
         ze_result_t zesddiInitResult = ZE_RESULT_ERROR_UNINITIALIZED;
         ze_result_t zerddiInitResult = ZE_RESULT_ERROR_UNINITIALIZED;
+        // Set by init_drivers() when it initialized this driver concurrently;
+        // the next init_driver() call returns pendingInitResult instead of
+        // initializing again, so callers see the same result as a serial init.
+        bool initResultPending = false;
+        ze_result_t pendingInitResult = ZE_RESULT_SUCCESS;
     };
 
     using driver_vector_t = std::vector< driver_t >;
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// Immutable copy of the handles a complete zeDriverGet/zesDriverGet call
+    /// returned once the drivers were sorted.  Later calls are answered from it
+    /// with an acquire load and a copy, without the sort lock or querying the
+    /// drivers again.  Any zeInit/zeInitDrivers/zesInit can change the set of
+    /// usable drivers, so they invalidate it.  A replaced list is retired and
+    /// freed by a later invalidate() or publish() that finds no reader inside
+    /// get(); a reader that enters get() after the replacement can only load
+    /// the new list.  Republishing the handles of the last retired list reuses
+    /// it, so repeated inits that change nothing allocate nothing.
+    template<typename handle_t>
+    class driver_handle_snapshot_t
+    {
+    public:
+        uint64_t generation() const { return currentGeneration.load( std::memory_order_acquire ); }
+
+        bool get( uint32_t *pCount, handle_t *phDrivers ) const
+        {
+            readers.fetch_add( 1 );
+            auto handles = current.load();
+            if( nullptr != handles )
+            {
+                const uint32_t available = static_cast<uint32_t>( handles->size() );
+                const uint32_t count = ( 0 == *pCount || *pCount > available ) ? available : *pCount;
+                if( nullptr != phDrivers )
+                    std::copy( handles->begin(), handles->begin() + count, phDrivers );
+                *pCount = count;
+            }
+            readers.fetch_sub( 1, std::memory_order_release );
+            return nullptr != handles;
+        }
+
+        // Publishes the list unless an init call invalidated the state it was
+        // built from (generation moved on) or another thread got there first.
+        void publish( const handle_t *phDrivers, uint32_t count, uint64_t builtAtGeneration )
+        {
+            std::lock_guard<std::mutex> lock( mut );
+            if( builtAtGeneration != currentGeneration.load( std::memory_order_relaxed ) || nullptr != current.load( std::memory_order_relaxed ) )
+                return;
+            if( !retired.empty() && retired.back()->size() == count && std::equal( phDrivers, phDrivers + count, retired.back()->begin() ) )
+            {
+                latest = std::move( retired.back() );
+                retired.pop_back();
+            }
+            else
+            {
+                latest.reset( new std::vector<handle_t>( phDrivers, phDrivers + count ) );
+            }
+            current.store( latest.get() );
+            reclaim();
+        }
+
+        void invalidate()
+        {
+            std::lock_guard<std::mutex> lock( mut );
+            currentGeneration.fetch_add( 1, std::memory_order_release );
+            current.store( nullptr );
+            if( latest )
+                retired.push_back( std::move( latest ) );
+            reclaim();
+        }
+
+    private:
+        // Called with mut held, after current was replaced.  current and
+        // readers are sequentially consistent, so a reader this misses loads
+        // the replacement rather than a retired list.
+        void reclaim()
+        {
+            if( 0 == readers.load() )
+                retired.clear();
+        }
+
+        std::atomic<const std::vector<handle_t> *> current = {nullptr};
+        std::atomic<uint64_t> currentGeneration = {0};
+        mutable std::atomic<uint32_t> readers = {0};
+        std::mutex mut;
+        std::unique_ptr<const std::vector<handle_t>> latest;
+        std::vector<std::unique_ptr<const std::vector<handle_t>>> retired;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// Wrapped handles a complete zesDeviceEnum* call returned, per loader
+    /// device and component type (identified by the type's handle factory).
+    /// Repeated enumerations are answered with a lookup and a copy instead of
+    /// a driver call and a factory lookup per handle.  A list is only kept once
+    /// a count query confirms the driver has no further components.
+    /// zesDeviceReset and device attach, detach and reset-required events
+    /// invalidate the lists of the device, any init invalidates all of them.
+    class component_handle_cache_t
+    {
+    public:
+        uint64_t generation() const { return currentGeneration.load( std::memory_order_acquire ); }
+
+        template<typename handle_t>
+        bool get( const void *device, const void *type, uint32_t *pCount, handle_t *phComponents )
+        {
+            std::lock_guard<std::mutex> lock( mut );
+            auto it = lists.find( key_t( reinterpret_cast<uintptr_t>( device ), reinterpret_cast<uintptr_t>( type ) ) );
+            if( it == lists.end() )
+                return false;
+            const uint32_t available = static_cast<uint32_t>( it->second.size() );
+            const uint32_t count = ( 0 == *pCount || *pCount > available ) ? available : *pCount;
+            if( nullptr != phComponents )
+                for( uint32_t i = 0; i < count; ++i )
+                    phComponents[ i ] = reinterpret_cast<handle_t>( it->second[ i ] );
+            *pCount = count;
+            return true;
+        }
+
+        // Keeps the list unless the device was reset or an init happened since
+        // builtAtGeneration, or the driver reports more components than the
+        // caller asked for.
+        template<typename handle_t, typename device_handle_t>
+        void publish( const void *device, const void *type, uint64_t builtAtGeneration,
+            ze_result_t ( ZE_APICALL *pfnEnum )( device_handle_t, uint32_t *, handle_t * ),
+            device_handle_t hDriverDevice, const handle_t *phComponents, uint32_t count )
+        {
+            uint32_t total = 0;
+            if( ZE_RESULT_SUCCESS != pfnEnum( hDriverDevice, &total, nullptr ) || total != count )
+                return;
+            std::vector<void *> handles( phComponents, phComponents + count );
+            std::lock_guard<std::mutex> lock( mut );
+            if( builtAtGeneration != currentGeneration.load( std::memory_order_relaxed ) )
+                return;
+            lists.emplace( key_t( reinterpret_cast<uintptr_t>( device ), reinterpret_cast<uintptr_t>( type ) ), std::move( handles ) );
+        }
+
+        void invalidate( const void *device )
+        {
+            std::lock_guard<std::mutex> lock( mut );
+            currentGeneration.fetch_add( 1, std::memory_order_release );
+            auto it = lists.lower_bound( key_t( reinterpret_cast<uintptr_t>( device ), 0 ) );
+            while( it != lists.end() && it->first.first == reinterpret_cast<uintptr_t>( device ) )
+                it = lists.erase( it );
+        }
+
+        void clear()
+        {
+            std::lock_guard<std::mutex> lock( mut );
+            currentGeneration.fetch_add( 1, std::memory_order_release );
+            lists.clear();
+        }
+
+    private:
+        using key_t = std::pair<uintptr_t, uintptr_t>;
+        std::map<key_t, std::vector<void *>> lists;
+        std::atomic<uint64_t> currentGeneration = {0};
+        std::mutex mut;
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     class context_t
     {
@@ -141,7 +299,7 @@ namespace loader
         std::unordered_map<ze_image_object_t *, ze_image_handle_t>            image_handle_map;
         std::unordered_map<ze_sampler_object_t *, ze_sampler_handle_t>        sampler_handle_map;
         ze_api_version_t version = ZE_API_VERSION_CURRENT;
-        ze_api_version_t configured_version = ZE_API_VERSION_CURRENT;
+        std::atomic<ze_api_version_t> configured_version = {ZE_API_VERSION_CURRENT};
         ze_api_version_t ddi_init_version = ZE_API_VERSION_CURRENT;
 
         driver_vector_t allDrivers;
@@ -154,13 +312,14 @@ namespace loader
         bool driverEnvironmentQueried = false;
 
         bool forceIntercept = false;
-        bool initDriversSupport = false;
+        std::atomic<bool> initDriversSupport = {false};
         std::vector<zel_component_version_t> compVersions;
         const char *LOADER_COMP_NAME = "loader";
 
         void debug_trace_message(std::string errorMessage, std::string errorValue);
         ze_result_t init();
         ze_result_t init_driver(driver_t &driver, ze_init_flags_t flags, ze_init_driver_type_desc_t* desc);
+        void init_drivers(driver_vector_t &drivers, ze_init_flags_t flags, ze_init_driver_type_desc_t* desc, bool sysmanInit);
         void add_loader_version();
         bool driverSorting(driver_vector_t *drivers, ze_init_driver_type_desc_t* desc, bool sysmanOnly);
         void driverOrdering(driver_vector_t *drivers);
@@ -170,6 +329,7 @@ namespace loader
         bool debugTraceAdvanced = false;  // true when ZE_ENABLE_LOADER_DEBUG_TRACE=2 or ZEL_ENABLE_LOADER_LOGGING=2
         bool driverDDIPathDefault = false;
         bool tracingLayerEnabled = false;
+        bool parallelDriverInit = false;  // ZEL_ENABLE_PARALLEL_DRIVER_INIT
         std::once_flag coreDriverSortOnce;
         std::once_flag sysmanDriverSortOnce;
         std::atomic<bool> sortingInProgress = {false};
@@ -179,6 +339,14 @@ namespace loader
         dditable_t tracing_dditable = {};
         std::shared_ptr<ZeLogger> zel_logger;
         ze_driver_handle_t defaultZerDriverHandle = nullptr;
+        driver_handle_snapshot_t<ze_driver_handle_t> zeDriverHandles;
+        driver_handle_snapshot_t<zes_driver_handle_t> zesDriverHandles;
+        component_handle_cache_t zesComponentHandles;
+        void invalidateDriverHandleSnapshots() {
+            zeDriverHandles.invalidate();
+            zesDriverHandles.invalidate();
+            zesComponentHandles.clear();
+        }
     };
 
     extern ze_handle_t* loaderDispatch;
@@ -8,6 +8,7 @@
  *
  */
 #pragma once
+#include <memory>
 #include "ze_singleton.h"
 #include "ze_ddi_common.h"
 
@@ -24,6 +25,34 @@ namespace loader {
 
 	extern ze_handle_t* loaderDispatch;
 
+    //////////////////////////////////////////////////////////////////////////
+    /// scratch storage for translating an array of loader handles into driver
+    /// handles; arrays of up to inline_count entries live on the stack so the
+    /// common append/wait-list paths never touch the heap
+    template<typename _handle_t, size_t inline_count = 16>
+    class local_handle_array_t
+    {
+    public:
+        explicit local_handle_array_t( size_t count )
+        {
+            if( count > inline_count )
+            {
+                heap.reset( new _handle_t[ count ] );
+                ptr = heap.get();
+            }
+        }
+
+        local_handle_array_t( const local_handle_array_t& ) = delete;
+        local_handle_array_t& operator=( const local_handle_array_t& ) = delete;
+
+        _handle_t* data() { return ptr; }
+
+    private:
+        _handle_t storage[ inline_count ];
+        std::unique_ptr<_handle_t[]> heap;
+        _handle_t* ptr = storage;
+    };
+
 }
 
 //////////////////////////////////////////////////////////////////////////
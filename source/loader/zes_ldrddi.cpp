@@ -140,14 +140,16 @@ namespace loader
         ze_result_t result = ZE_RESULT_SUCCESS;
         
         bool atLeastOneDriverValid = false;
+        loader::context->init_drivers( *loader::context->sysmanInstanceDrivers, flags, nullptr, true );
         for( auto& drv : *loader::context->sysmanInstanceDrivers )
         {
             if(drv.initStatus != ZE_RESULT_SUCCESS || drv.initSysManStatus != ZE_RESULT_SUCCESS)
                 continue;
-            if (!drv.handle || !drv.ddiInitialized) {
+            if (!drv.handle || !drv.ddiInitialized || drv.initResultPending) {
                 auto res = loader::context->init_driver( drv, flags, nullptr );
                 if (res != ZE_RESULT_SUCCESS || drv.zesddiInitResult != ZE_RESULT_SUCCESS) {
                     drv.ddiInitialized = false;
+                    drv.initResultPending = false;
                     continue;
                 }
             }
@@ -160,6 +162,8 @@ namespace loader
                 atLeastOneDriverValid = true;
         }
 
+        loader::context->invalidateDriverHandleSnapshots();
+
         if(!atLeastOneDriverValid)
             result=ZE_RESULT_ERROR_UNINITIALIZED;
 
@@ -183,6 +187,12 @@ namespace loader
     {
         ze_result_t result = ZE_RESULT_SUCCESS;
         
+        // Once a complete, sorted list has been returned it is served from an
+        // immutable snapshot without the sort lock or any driver calls.
+        if( loader::context->zesDriverHandles.get( pCount, phDrivers ) )
+            return ZE_RESULT_SUCCESS;
+        const uint64_t snapshotGeneration = loader::context->zesDriverHandles.generation();
+        bool snapshotComplete = ( nullptr != phDrivers );
         uint32_t total_driver_handle_count = 0;
 
         {
@@ -200,8 +210,10 @@ namespace loader
             if(drv.initStatus != ZE_RESULT_SUCCESS || drv.initSysManStatus != ZE_RESULT_SUCCESS || !drv.ddiInitialized)
                 continue;
 
-            if( ( 0 < *pCount ) && ( *pCount == total_driver_handle_count))
+            if( ( 0 < *pCount ) && ( *pCount == total_driver_handle_count)) {
+                snapshotComplete = false;
                 break;
+            }
 
             uint32_t library_driver_handle_count = 0;
 
@@ -211,6 +223,7 @@ namespace loader
                 if (ZE_RESULT_ERROR_UNINITIALIZED == result) {
                     drv.initStatus = result;
                 }
+                snapshotComplete = false;
                 continue;
             }
 
@@ -218,6 +231,7 @@ namespace loader
             {
                 if( total_driver_handle_count + library_driver_handle_count > *pCount) {
                     library_driver_handle_count = *pCount - total_driver_handle_count;
+                    snapshotComplete = false;
                 }
                 result = drv.dditable.zes.Driver.pfnGet( &library_driver_handle_count, &phDrivers[ total_driver_handle_count ] );
                 if( ZE_RESULT_SUCCESS != result ) break;
@@ -235,18 +249,24 @@ namespace loader
                 catch( std::bad_alloc& )
                 {
                     result = ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+                    snapshotComplete = false;
                 }
             }
 
             total_driver_handle_count += library_driver_handle_count;
         }
 
+        snapshotComplete = snapshotComplete && ZE_RESULT_SUCCESS == result && total_driver_handle_count > 0;
+
         // If the last driver get failed, but at least one driver succeeded, then return success with total count.
         if( ZE_RESULT_SUCCESS == result || total_driver_handle_count > 0)
             *pCount = total_driver_handle_count;
         if (total_driver_handle_count > 0) {
             result = ZE_RESULT_SUCCESS;
         }
+        if( snapshotComplete )
+            loader::context->zesDriverHandles.publish( phDrivers, total_driver_handle_count, snapshotGeneration );
+
         return result;
     }
 
@@ -419,6 +439,8 @@ namespace loader
     {
         ze_result_t result = ZE_RESULT_SUCCESS;
         
+        auto hDeviceLoader = hDevice;
+
         // extract driver's function pointer table
         auto dditable = reinterpret_cast<zes_device_object_t*>( hDevice )->dditable;
         auto pfnReset = dditable->zes.Device.pfnReset;
@@ -431,6 +453,10 @@ namespace loader
         // forward to device-driver
         result = pfnReset( hDevice, force );
 
+        // the components of the device may change across a reset, even a
+        // failed one
+        context->zesComponentHandles.invalidate( hDeviceLoader );
+
         return result;
     }
 
@@ -444,6 +470,8 @@ namespace loader
     {
         ze_result_t result = ZE_RESULT_SUCCESS;
         
+        auto hDeviceLoader = hDevice;
+
         // extract driver's function pointer table
         auto dditable = reinterpret_cast<zes_device_object_t*>( hDevice )->dditable;
         auto pfnResetExt = dditable->zes.Device.pfnResetExt;
@@ -456,6 +484,10 @@ namespace loader
         // forward to device-driver
         result = pfnResetExt( hDevice, pProperties );
 
+        // the components of the device may change across a reset, even a
+        // failed one
+        context->zesComponentHandles.invalidate( hDeviceLoader );
+
         return result;
     }
 
@@ -756,6 +788,12 @@ namespace loader
     {
         ze_result_t result = ZE_RESULT_SUCCESS;
         
+        // answer repeated enumerations from the component handle cache
+        auto hDeviceLoader = hDevice;
+        const auto cacheGeneration = context->zesComponentHandles.generation();
+        if( nullptr != pCount && context->zesComponentHandles.get( hDeviceLoader, &context->zes_overclock_factory, pCount, phDomainHandle ) )
+            return ZE_RESULT_SUCCESS;
+
         // extract driver's function pointer table
         auto dditable = reinterpret_cast<zes_device_object_t*>( hDevice )->dditable;
         auto pfnEnumOverclockDomains = dditable->zes.Device.pfnEnumOverclockDomains;
@@ -783,6 +821,10 @@ namespace loader
             result = ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
         }
 
+        if( ZE_RESULT_SUCCESS == result && nullptr != phDomainHandle )
+            context->zesComponentHandles.publish( hDeviceLoader, &context->zes_overclock_factory, cacheGeneration,
+                pfnEnumOverclockDomains, hDevice, phDomainHandle, *pCount );
+
         return result;
     }
 
@@ -1047,6 +1089,12 @@ namespace loader
     {
         ze_result_t result = ZE_RESULT_SUCCESS;
         
+        // answer repeated enumerations from the component handle cache
+        auto hDeviceLoader = hDevice;
+        const auto cacheGeneration = context->zesComponentHandles.generation();
+        if( nullptr != pCount && context->zesComponentHandles.get( hDeviceLoader, &context->zes_diag_factory, pCount, phDiagnostics ) )
+            return ZE_RESULT_SUCCESS;
+
         // extract driver's function pointer table
         auto dditable = reinterpret_cast<zes_device_object_t*>( hDevice )->dditable;
         auto pfnEnumDiagnosticTestSuites = dditable->zes.Device.pfnEnumDiagnosticTestSuites;
@@ -1074,6 +1122,10 @@ namespace loader
             result = ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
         }
 
+        if( ZE_RESULT_SUCCESS == result && nullptr != phDiagnostics )
+            context->zesComponentHandles.publish( hDeviceLoader, &context->zes_diag_factory, cacheGeneration,
+                pfnEnumDiagnosticTestSuites, hDevice, phDiagnostics, *pCount );
+
         return result;
     }
 
@@ -1286,6 +1338,12 @@ namespace loader
     {
         ze_result_t result = ZE_RESULT_SUCCESS;
         
+        // answer repeated enumerations from the component handle cache
+        auto hDeviceLoader = hDevice;
+        const auto cacheGeneration = context->zesComponentHandles.generation();
+        if( nullptr != pCount && context->zesComponentHandles.get( hDeviceLoader, &context->zes_engine_factory, pCount, phEngine ) )
+            return ZE_RESULT_SUCCESS;
+
         // extract driver's function pointer table
         auto dditable = reinterpret_cast<zes_device_object_t*>( hDevice )->dditable;
         auto pfnEnumEngineGroups = dditable->zes.Device.pfnEnumEngineGroups;
@@ -1313,6 +1371,10 @@ namespace loader
             result = ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
         }
 
+        if( ZE_RESULT_SUCCESS == result && nullptr != phEngine )
+            context->zesComponentHandles.publish( hDeviceLoader, &context->zes_engine_factory, cacheGeneration,
+                pfnEnumEngineGroups, hDevice, phEngine, *pCount );
+
         return result;
     }
 
@@ -1428,13 +1490,19 @@ namespace loader
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
         // convert loader handles to driver handles
-        auto phDevicesLocal = new zes_device_handle_t [count];
+        loader::local_handle_array_t<zes_device_handle_t> phDevicesStorage( count );
+        auto phDevicesLocal = phDevicesStorage.data();
         for( size_t i = 0; ( nullptr != phDevices ) && ( i < count ); ++i )
             phDevicesLocal[ i ] = reinterpret_cast<zes_device_object_t*>( phDevices[ i ] )->handle;
 
         // forward to device-driver
         result = pfnEventListen( hDriver, timeout, count, phDevicesLocal, pNumDeviceEvents, pEvents );
-        delete []phDevicesLocal;
+
+        // components of devices that were attached, detached or need a reset
+        // are enumerated from the driver again
+        for( size_t i = 0; ( ZE_RESULT_SUCCESS == result ) && ( nullptr != pEvents ) && ( nullptr != phDevices ) && ( i < count ); ++i )
+            if( pEvents[ i ] & ( ZES_EVENT_TYPE_FLAG_DEVICE_DETACH | ZES_EVENT_TYPE_FLAG_DEVICE_ATTACH | ZES_EVENT_TYPE_FLAG_DEVICE_RESET_REQUIRED ) )
+                context->zesComponentHandles.invalidate( phDevices[ i ] );
 
         return result;
     }
@@ -1475,13 +1543,19 @@ namespace loader
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
         // convert loader handles to driver handles
-        auto phDevicesLocal = new zes_device_handle_t [count];
+        loader::local_handle_array_t<zes_device_handle_t> phDevicesStorage( count );
+        auto phDevicesLocal = phDevicesStorage.data();
         for( size_t i = 0; ( nullptr != phDevices ) && ( i < count ); ++i )
             phDevicesLocal[ i ] = reinterpret_cast<zes_device_object_t*>( phDevices[ i ] )->handle;
 
         // forward to device-driver
         result = pfnEventListenEx( hDriver, timeout, count, phDevicesLocal, pNumDeviceEvents, pEvents );
-        delete []phDevicesLocal;
+
+        // components of devices that were attached, detached or need a reset
+        // are enumerated from the driver again
+        for( size_t i = 0; ( ZE_RESULT_SUCCESS == result ) && ( nullptr != pEvents ) && ( nullptr != phDevices ) && ( i < count ); ++i )
+            if( pEvents[ i ] & ( ZES_EVENT_TYPE_FLAG_DEVICE_DETACH | ZES_EVENT_TYPE_FLAG_DEVICE_ATTACH | ZES_EVENT_TYPE_FLAG_DEVICE_RESET_REQUIRED ) )
+                context->zesComponentHandles.invalidate( phDevices[ i ] );
 
         return result;
     }
@@ -1506,6 +1580,12 @@ namespace loader
     {
         ze_result_t result = ZE_RESULT_SUCCESS;
         
+        // answer repeated enumerations from the component handle cache
+        auto hDeviceLoader = hDevice;
+        const auto cacheGeneration = context->zesComponentHandles.generation();
+        if( nullptr != pCount && context->zesComponentHandles.get( hDeviceLoader, &context->zes_fabric_port_factory, pCount, phPort ) )
+            return ZE_RESULT_SUCCESS;
+
         // extract driver's function pointer table
         auto dditable = reinterpret_cast<zes_device_object_t*>( hDevice )->dditable;
         auto pfnEnumFabricPorts = dditable->zes.Device.pfnEnumFabricPorts;
@@ -1533,6 +1613,10 @@ namespace loader
             result = ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
         }
 
+        if( ZE_RESULT_SUCCESS == result && nullptr != phPort )
+            context->zesComponentHandles.publish( hDeviceLoader, &context->zes_fabric_port_factory, cacheGeneration,
+                pfnEnumFabricPorts, hDevice, phPort, *pCount );
+
         return result;
     }
 
@@ -1736,13 +1820,13 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // convert loader handles to driver handles
-        auto phPortLocal = new zes_fabric_port_handle_t [numPorts];
+        loader::local_handle_array_t<zes_fabric_port_handle_t> phPortStorage( numPorts );
+        auto phPortLocal = phPortStorage.data();
         for( size_t i = 0; ( nullptr != phPort ) && ( i < numPorts ); ++i )
             phPortLocal[ i ] = reinterpret_cast<zes_fabric_port_object_t*>( phPort[ i ] )->handle;
 
         // forward to device-driver
         result = pfnGetMultiPortThroughput( hDevice, numPorts, phPortLocal, pThroughput );
-        delete []phPortLocal;
 
         return result;
     }
@@ -1767,6 +1851,12 @@ namespace loader
     {
         ze_result_t result = ZE_RESULT_SUCCESS;
         
+        // answer repeated enumerations from the component handle cache
+        auto hDeviceLoader = hDevice;
+        const auto cacheGeneration = context->zesComponentHandles.generation();
+        if( nullptr != pCount && context->zesComponentHandles.get( hDeviceLoader, &context->zes_fan_factory, pCount, phFan ) )
+            return ZE_RESULT_SUCCESS;
+
         // extract driver's function pointer table
         auto dditable = reinterpret_cast<zes_device_object_t*>( hDevice )->dditable;
         auto pfnEnumFans = dditable->zes.Device.pfnEnumFans;
@@ -1794,6 +1884,10 @@ namespace loader
             result = ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
         }
 
+        if( ZE_RESULT_SUCCESS == result && nullptr != phFan )
+            context->zesComponentHandles.publish( hDeviceLoader, &context->zes_fan_factory, cacheGeneration,
+                pfnEnumFans, hDevice, phFan, *pCount );
+
         return result;
     }
 
@@ -1969,6 +2063,12 @@ namespace loader
     {
         ze_result_t result = ZE_RESULT_SUCCESS;
         
+        // answer repeated enumerations from the component handle cache
+        auto hDeviceLoader = hDevice;
+        const auto cacheGeneration = context->zesComponentHandles.generation();
+        if( nullptr != pCount && context->zesComponentHandles.get( hDeviceLoader, &context->zes_firmware_factory, pCount, phFirmware ) )
+            return ZE_RESULT_SUCCESS;
+
         // extract driver's function pointer table
         auto dditable = reinterpret_cast<zes_device_object_t*>( hDevice )->dditable;
         auto pfnEnumFirmwares = dditable->zes.Device.pfnEnumFirmwares;
@@ -1996,6 +2096,10 @@ namespace loader
             result = ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
         }
 
+        if( ZE_RESULT_SUCCESS == result && nullptr != phFirmware )
+            context->zesComponentHandles.publish( hDeviceLoader, &context->zes_firmware_factory, cacheGeneration,
+                pfnEnumFirmwares, hDevice, phFirmware, *pCount );
+
         return result;
     }
 
@@ -2122,6 +2226,12 @@ namespace loader
     {
         ze_result_t result = ZE_RESULT_SUCCESS;
         
+        // answer repeated enumerations from the component handle cache
+        auto hDeviceLoader = hDevice;
+        const auto cacheGeneration = context->zesComponentHandles.generation();
+        if( nullptr != pCount && context->zesComponentHandles.get( hDeviceLoader, &context->zes_freq_factory, pCount, phFrequency ) )
+            return ZE_RESULT_SUCCESS;
+
         // extract driver's function pointer table
         auto dditable = reinterpret_cast<zes_device_object_t*>( hDevice )->dditable;
         auto pfnEnumFrequencyDomains = dditable->zes.Device.pfnEnumFrequencyDomains;
@@ -2149,6 +2259,10 @@ namespace loader
             result = ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
         }
 
+        if( ZE_RESULT_SUCCESS == result && nullptr != phFrequency )
+            context->zesComponentHandles.publish( hDeviceLoader, &context->zes_freq_factory, cacheGeneration,
+                pfnEnumFrequencyDomains, hDevice, phFrequency, *pCount );
+
         return result;
     }
 
@@ -2626,6 +2740,12 @@ namespace loader
     {
         ze_result_t result = ZE_RESULT_SUCCESS;
         
+        // answer repeated enumerations from the component handle cache
+        auto hDeviceLoader = hDevice;
+        const auto cacheGeneration = context->zesComponentHandles.generation();
+        if( nullptr != pCount && context->zesComponentHandles.get( hDeviceLoader, &context->zes_led_factory, pCount, phLed ) )
+            return ZE_RESULT_SUCCESS;
+
         // extract driver's function pointer table
         auto dditable = reinterpret_cast<zes_device_object_t*>( hDevice )->dditable;
         auto pfnEnumLeds = dditable->zes.Device.pfnEnumLeds;
@@ -2653,6 +2773,10 @@ namespace loader
             result = ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
         }
 
+        if( ZE_RESULT_SUCCESS == result && nullptr != phLed )
+            context->zesComponentHandles.publish( hDeviceLoader, &context->zes_led_factory, cacheGeneration,
+                pfnEnumLeds, hDevice, phLed, *pCount );
+
         return result;
     }
 
@@ -2776,6 +2900,12 @@ namespace loader
     {
         ze_result_t result = ZE_RESULT_SUCCESS;
         
+        // answer repeated enumerations from the component handle cache
+        auto hDeviceLoader = hDevice;
+        const auto cacheGeneration = context->zesComponentHandles.generation();
+        if( nullptr != pCount && context->zesComponentHandles.get( hDeviceLoader, &context->zes_mem_factory, pCount, phMemory ) )
+            return ZE_RESULT_SUCCESS;
+
         // extract driver's function pointer table
         auto dditable = reinterpret_cast<zes_device_object_t*>( hDevice )->dditable;
         auto pfnEnumMemoryModules = dditable->zes.Device.pfnEnumMemoryModules;
@@ -2803,6 +2933,10 @@ namespace loader
             result = ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
         }
 
+        if( ZE_RESULT_SUCCESS == result && nullptr != phMemory )
+            context->zesComponentHandles.publish( hDeviceLoader, &context->zes_mem_factory, cacheGeneration,
+                pfnEnumMemoryModules, hDevice, phMemory, *pCount );
+
         return result;
     }
 
@@ -2902,6 +3036,12 @@ namespace loader
     {
         ze_result_t result = ZE_RESULT_SUCCESS;
         
+        // answer repeated enumerations from the component handle cache
+        auto hDeviceLoader = hDevice;
+        const auto cacheGeneration = context->zesComponentHandles.generation();
+        if( nullptr != pCount && context->zesComponentHandles.get( hDeviceLoader, &context->zes_perf_factory, pCount, phPerf ) )
+            return ZE_RESULT_SUCCESS;
+
         // extract driver's function pointer table
         auto dditable = reinterpret_cast<zes_device_object_t*>( hDevice )->dditable;
         auto pfnEnumPerformanceFactorDomains = dditable->zes.Device.pfnEnumPerformanceFactorDomains;
@@ -2929,6 +3069,10 @@ namespace loader
             result = ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
         }
 
+        if( ZE_RESULT_SUCCESS == result && nullptr != phPerf )
+            context->zesComponentHandles.publish( hDeviceLoader, &context->zes_perf_factory, cacheGeneration,
+                pfnEnumPerformanceFactorDomains, hDevice, phPerf, *pCount );
+
         return result;
     }
 
@@ -3029,6 +3173,12 @@ namespace loader
     {
         ze_result_t result = ZE_RESULT_SUCCESS;
         
+        // answer repeated enumerations from the component handle cache
+        auto hDeviceLoader = hDevice;
+        const auto cacheGeneration = context->zesComponentHandles.generation();
+        if( nullptr != pCount && context->zesComponentHandles.get( hDeviceLoader, &context->zes_pwr_factory, pCount, phPower ) )
+            return ZE_RESULT_SUCCESS;
+
         // extract driver's function pointer table
         auto dditable = reinterpret_cast<zes_device_object_t*>( hDevice )->dditable;
         auto pfnEnumPowerDomains = dditable->zes.Device.pfnEnumPowerDomains;
@@ -3056,6 +3206,10 @@ namespace loader
             result = ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
         }
 
+        if( ZE_RESULT_SUCCESS == result && nullptr != phPower )
+            context->zesComponentHandles.publish( hDeviceLoader, &context->zes_pwr_factory, cacheGeneration,
+                pfnEnumPowerDomains, hDevice, phPower, *pCount );
+
         return result;
     }
 
@@ -3306,6 +3460,12 @@ namespace loader
     {
         ze_result_t result = ZE_RESULT_SUCCESS;
         
+        // answer repeated enumerations from the component handle cache
+        auto hDeviceLoader = hDevice;
+        const auto cacheGeneration = context->zesComponentHandles.generation();
+        if( nullptr != pCount && context->zesComponentHandles.get( hDeviceLoader, &context->zes_psu_factory, pCount, phPsu ) )
+            return ZE_RESULT_SUCCESS;
+
         // extract driver's function pointer table
         auto dditable = reinterpret_cast<zes_device_object_t*>( hDevice )->dditable;
         auto pfnEnumPsus = dditable->zes.Device.pfnEnumPsus;
@@ -3333,6 +3493,10 @@ namespace loader
             result = ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
         }
 
+        if( ZE_RESULT_SUCCESS == result && nullptr != phPsu )
+            context->zesComponentHandles.publish( hDeviceLoader, &context->zes_psu_factory, cacheGeneration,
+                pfnEnumPsus, hDevice, phPsu, *pCount );
+
         return result;
     }
 
@@ -3406,6 +3570,12 @@ namespace loader
     {
         ze_result_t result = ZE_RESULT_SUCCESS;
         
+        // answer repeated enumerations from the component handle cache
+        auto hDeviceLoader = hDevice;
+        const auto cacheGeneration = context->zesComponentHandles.generation();
+        if( nullptr != pCount && context->zesComponentHandles.get( hDeviceLoader, &context->zes_ras_factory, pCount, phRas ) )
+            return ZE_RESULT_SUCCESS;
+
         // extract driver's function pointer table
         auto dditable = reinterpret_cast<zes_device_object_t*>( hDevice )->dditable;
         auto pfnEnumRasErrorSets = dditable->zes.Device.pfnEnumRasErrorSets;
@@ -3433,6 +3603,10 @@ namespace loader
             result = ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
         }
 
+        if( ZE_RESULT_SUCCESS == result && nullptr != phRas )
+            context->zesComponentHandles.publish( hDeviceLoader, &context->zes_ras_factory, cacheGeneration,
+                pfnEnumRasErrorSets, hDevice, phRas, *pCount );
+
         return result;
     }
 
@@ -3558,6 +3732,12 @@ namespace loader
     {
         ze_result_t result = ZE_RESULT_SUCCESS;
         
+        // answer repeated enumerations from the component handle cache
+        auto hDeviceLoader = hDevice;
+        const auto cacheGeneration = context->zesComponentHandles.generation();
+        if( nullptr != pCount && context->zesComponentHandles.get( hDeviceLoader, &context->zes_sched_factory, pCount, phScheduler ) )
+            return ZE_RESULT_SUCCESS;
+
         // extract driver's function pointer table
         auto dditable = reinterpret_cast<zes_device_object_t*>( hDevice )->dditable;
         auto pfnEnumSchedulers = dditable->zes.Device.pfnEnumSchedulers;
@@ -3585,6 +3765,10 @@ namespace loader
             result = ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
         }
 
+        if( ZE_RESULT_SUCCESS == result && nullptr != phScheduler )
+            context->zesComponentHandles.publish( hDeviceLoader, &context->zes_sched_factory, cacheGeneration,
+                pfnEnumSchedulers, hDevice, phScheduler, *pCount );
+
         return result;
     }
 
@@ -3818,6 +4002,12 @@ namespace loader
     {
         ze_result_t result = ZE_RESULT_SUCCESS;
         
+        // answer repeated enumerations from the component handle cache
+        auto hDeviceLoader = hDevice;
+        const auto cacheGeneration = context->zesComponentHandles.generation();
+        if( nullptr != pCount && context->zesComponentHandles.get( hDeviceLoader, &context->zes_standby_factory, pCount, phStandby ) )
+            return ZE_RESULT_SUCCESS;
+
         // extract driver's function pointer table
         auto dditable = reinterpret_cast<zes_device_object_t*>( hDevice )->dditable;
         auto pfnEnumStandbyDomains = dditable->zes.Device.pfnEnumStandbyDomains;
@@ -3845,6 +4035,10 @@ namespace loader
             result = ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
         }
 
+        if( ZE_RESULT_SUCCESS == result && nullptr != phStandby )
+            context->zesComponentHandles.publish( hDeviceLoader, &context->zes_standby_factory, cacheGeneration,
+                pfnEnumStandbyDomains, hDevice, phStandby, *pCount );
+
         return result;
     }
 
@@ -3943,6 +4137,12 @@ namespace loader
     {
         ze_result_t result = ZE_RESULT_SUCCESS;
         
+        // answer repeated enumerations from the component handle cache
+        auto hDeviceLoader = hDevice;
+        const auto cacheGeneration = context->zesComponentHandles.generation();
+        if( nullptr != pCount && context->zesComponentHandles.get( hDeviceLoader, &context->zes_temp_factory, pCount, phTemperature ) )
+            return ZE_RESULT_SUCCESS;
+
         // extract driver's function pointer table
         auto dditable = reinterpret_cast<zes_device_object_t*>( hDevice )->dditable;
         auto pfnEnumTemperatureSensors = dditable->zes.Device.pfnEnumTemperatureSensors;
@@ -3970,6 +4170,10 @@ namespace loader
             result = ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
         }
 
+        if( ZE_RESULT_SUCCESS == result && nullptr != phTemperature )
+            context->zesComponentHandles.publish( hDeviceLoader, &context->zes_temp_factory, cacheGeneration,
+                pfnEnumTemperatureSensors, hDevice, phTemperature, *pCount );
+
         return result;
     }
 
@@ -739,13 +739,13 @@ namespace loader
         hDevice = reinterpret_cast<zet_device_object_t*>( hDevice )->handle;
 
         // convert loader handles to driver handles
-        auto phMetricGroupsLocal = new zet_metric_group_handle_t [count];
+        loader::local_handle_array_t<zet_metric_group_handle_t> phMetricGroupsStorage( count );
+        auto phMetricGroupsLocal = phMetricGroupsStorage.data();
         for( size_t i = 0; ( nullptr != phMetricGroups ) && ( i < count ); ++i )
             phMetricGroupsLocal[ i ] = reinterpret_cast<zet_metric_group_object_t*>( phMetricGroups[ i ] )->handle;
 
         // forward to device-driver
         result = pfnActivateMetricGroups( hContext, hDevice, count, phMetricGroupsLocal );
-        delete []phMetricGroupsLocal;
 
         return result;
     }
@@ -1129,13 +1129,13 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        loader::local_handle_array_t<ze_event_handle_t> phWaitEventsStorage( numWaitEvents );
+        auto phWaitEventsLocal = phWaitEventsStorage.data();
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendMetricQueryEnd( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -2070,7 +2070,8 @@ namespace loader
         hDevice = reinterpret_cast<zet_device_object_t*>( hDevice )->handle;
 
         // convert loader handles to driver handles
-        auto phMetricGroupsLocal = new zet_metric_group_handle_t [metricGroupCount ];
+        loader::local_handle_array_t<zet_metric_group_handle_t> phMetricGroupsStorage( metricGroupCount  );
+        auto phMetricGroupsLocal = phMetricGroupsStorage.data();
         for( size_t i = 0; ( nullptr != phMetricGroups ) && ( i < metricGroupCount  ); ++i )
             phMetricGroupsLocal[ i ] = reinterpret_cast<zet_metric_group_object_t*>( phMetricGroups[ i ] )->handle;
 
@@ -2079,7 +2080,6 @@ namespace loader
 
         // forward to device-driver
         result = pfnCreateExp( hContext, hDevice, metricGroupCount, phMetricGroupsLocal, desc, hNotificationEvent, phMetricTracer );
-        delete []phMetricGroupsLocal;
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -2385,13 +2385,13 @@ namespace loader
         phMetricDecoder = reinterpret_cast<zet_metric_decoder_exp_object_t*>( phMetricDecoder )->handle;
 
         // convert loader handles to driver handles
-        auto phMetricsLocal = new zet_metric_handle_t [metricsCount];
+        loader::local_handle_array_t<zet_metric_handle_t> phMetricsStorage( metricsCount );
+        auto phMetricsLocal = phMetricsStorage.data();
         for( size_t i = 0; ( nullptr != phMetrics ) && ( i < metricsCount ); ++i )
             phMetricsLocal[ i ] = reinterpret_cast<zet_metric_object_t*>( phMetrics[ i ] )->handle;
 
         // forward to device-driver
         result = pfnDecodeExp( phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetricsLocal, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries );
-        delete []phMetricsLocal;
 
         return result;
     }
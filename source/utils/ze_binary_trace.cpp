@@ -0,0 +1,362 @@
+/*
+ *
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "ze_binary_trace.h"
+#include "ze_util.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+#define GET_PID() _getpid()
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/types.h>
+#include <unistd.h>
+#define GET_PID() getpid()
+#endif
+
+namespace loader {
+
+namespace {
+
+uint64_t steadyNowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// OS thread id, cached in a POD thread_local so that it costs nothing after
+// the first record on a thread and has no destructor to run at teardown.
+uint64_t currentThreadId() {
+    static thread_local uint64_t tid = 0;
+    if (tid == 0) {
+#ifdef _WIN32
+        tid = static_cast<uint64_t>(GetCurrentThreadId());
+#elif defined(SYS_gettid)
+        tid = static_cast<uint64_t>(syscall(SYS_gettid));
+#else
+        tid = static_cast<uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+#endif
+    }
+    return tid;
+}
+
+uint64_t roundUpPow2(uint64_t n) {
+    uint64_t p = 1;
+    while (p < n) p <<= 1;
+    return p;
+}
+
+bool isIntegerType(const std::string &type) {
+    static const char *const names[] = {
+        "int8_t", "int16_t", "int32_t", "int64_t", "uint8_t", "uint16_t", "uint32_t",
+        "uint64_t", "size_t", "int", "ze_bool_t", "char", "bool"};
+    for (const char *name : names) {
+        if (type == name) return true;
+    }
+    return false;
+}
+
+bool endsWith(const std::string &s, const char *suffix) {
+    const std::size_t n = std::strlen(suffix);
+    return s.size() >= n && s.compare(s.size() - n, n, suffix) == 0;
+}
+
+} // namespace
+
+BinaryTraceWriter::BinaryTraceWriter(const std::string &path, uint64_t records) {
+    const uint64_t capacity = roundUpPow2(records < 2 ? 2 : records);
+    const uint64_t recordsOffset = sizeof(BinaryTraceFileHeader) + BinaryTraceNameTableSize;
+    const uint64_t total = recordsOffset + capacity * sizeof(BinaryTraceRecord);
+
+    void *base = nullptr;
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+                              CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE,
+                                        static_cast<DWORD>(total >> 32),
+                                        static_cast<DWORD>(total & 0xffffffffu), nullptr);
+    if (mapping == nullptr) {
+        CloseHandle(file);
+        return;
+    }
+    base = MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, static_cast<SIZE_T>(total));
+    if (base == nullptr) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return;
+    }
+    _file = file;
+    _mapping = mapping;
+#else
+    int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return;
+    }
+    if (ftruncate(fd, static_cast<off_t>(total)) != 0) {
+        close(fd);
+        return;
+    }
+    base = mmap(nullptr, static_cast<std::size_t>(total), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+        close(fd);
+        return;
+    }
+    _fd = fd;
+#endif
+    _mappedSize = static_cast<std::size_t>(total);
+
+    // The file was just created (or truncated), so every byte reads as zero:
+    // all records start out unpublished and the name table is empty.
+    auto *header = static_cast<BinaryTraceFileHeader *>(base);
+    std::memcpy(header->magic, BinaryTraceMagic, sizeof(header->magic));
+    header->version = BinaryTraceVersion;
+    header->recordSize = sizeof(BinaryTraceRecord);
+    header->recordCapacity = capacity;
+    header->nameTableOffset = sizeof(BinaryTraceFileHeader);
+    header->nameTableSize = BinaryTraceNameTableSize;
+    header->recordsOffset = recordsOffset;
+    header->startTimestampNs = steadyNowNs();
+    header->startRealtimeNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+    header->processId = static_cast<uint64_t>(GET_PID());
+
+    _header = header;
+    _nameTable = static_cast<char *>(base) + header->nameTableOffset;
+    _records = reinterpret_cast<BinaryTraceRecord *>(static_cast<char *>(base) + recordsOffset);
+    _mask = capacity - 1;
+}
+
+BinaryTraceWriter::~BinaryTraceWriter() {
+    if (!_header) {
+        return;
+    }
+    flush();
+#ifdef _WIN32
+    UnmapViewOfFile(_header);
+    CloseHandle(static_cast<HANDLE>(_mapping));
+    CloseHandle(static_cast<HANDLE>(_file));
+#else
+    munmap(_header, _mappedSize);
+    close(_fd);
+#endif
+}
+
+void BinaryTraceWriter::flush() {
+    if (!_header) {
+        return;
+    }
+#ifdef _WIN32
+    FlushViewOfFile(_header, 0);
+    FlushFileBuffers(static_cast<HANDLE>(_file));
+#else
+    msync(_header, _mappedSize, MS_SYNC);
+#endif
+}
+
+uint32_t BinaryTraceWriter::registerApi(const char *name, const char *signature) {
+    std::lock_guard<std::mutex> lk(_registerMutex);
+    const uint32_t id = _header->apiCount.load(std::memory_order_relaxed);
+    const uint64_t used = _header->nameTableUsed.load(std::memory_order_relaxed);
+    const std::size_t nameLen = std::strlen(name) + 1;
+    const std::size_t signatureLen = std::strlen(signature) + 1;
+    if (used + nameLen + signatureLen > BinaryTraceNameTableSize) {
+        // Table full: the API is still traced, the decoder shows it by id.
+        return UINT32_MAX;
+    }
+    std::memcpy(_nameTable + used, name, nameLen);
+    std::memcpy(_nameTable + used + nameLen, signature, signatureLen);
+    _header->nameTableUsed.store(used + nameLen + signatureLen, std::memory_order_relaxed);
+    _header->apiCount.store(id + 1, std::memory_order_release);
+    return id;
+}
+
+void BinaryTraceWriter::append(uint32_t apiId, int32_t result, const uint64_t *args, uint32_t argCount) {
+    const uint64_t index = _header->nextRecord.fetch_add(1, std::memory_order_relaxed);
+    BinaryTraceRecord &rec = _records[index & _mask];
+
+    // Claim the slot, which also unpublishes it so a reader never pairs a
+    // stale sequence with new data.  If the ring has wrapped while another
+    // writer still holds the slot, or a newer record is already there, this
+    // record is dropped.
+    uint64_t current = rec.sequence.load(std::memory_order_relaxed);
+    do {
+        if (current == BinaryTraceClaimed || current > index) {
+            return;
+        }
+    } while (!rec.sequence.compare_exchange_weak(current, BinaryTraceClaimed, std::memory_order_relaxed));
+    std::atomic_thread_fence(std::memory_order_release);
+    rec.apiId = apiId;
+    rec.result = result;
+    rec.threadId = currentThreadId();
+    rec.timestampNs = steadyNowNs();
+    rec.argCount = argCount;
+    const uint32_t stored = argCount < BinaryTraceMaxArgs ? argCount : BinaryTraceMaxArgs;
+    std::memcpy(rec.args, args, stored * sizeof(uint64_t));
+    rec.sequence.store(index + 1, std::memory_order_release);
+}
+
+std::unique_ptr<BinaryTraceWriter> createBinaryTraceWriter() {
+    const std::string path = getenv_string("ZEL_LOADER_BINARY_TRACE_FILE");
+    if (path.empty()) {
+        return nullptr;
+    }
+    // Counts above 1 << 22 (a 512 MiB file) are clamped; 0 and counts that
+    // do not parse fall back to the default.
+    const unsigned long long defaultRecords = 262144;
+    const unsigned long long maxRecords = 1ull << 22;
+    unsigned long long records = defaultRecords;
+    const std::string recordsEnv = getenv_string("ZEL_LOADER_BINARY_TRACE_RECORDS");
+    if (!recordsEnv.empty()) {
+        errno = 0;
+        const unsigned long long parsed = std::strtoull(recordsEnv.c_str(), nullptr, 10);
+        if (recordsEnv.find('-') != std::string::npos || errno != 0 || parsed == 0) {
+            std::cerr << "ze_binary_trace: Ignoring invalid ZEL_LOADER_BINARY_TRACE_RECORDS="
+                      << recordsEnv << "; using " << defaultRecords << "\n";
+        } else if (parsed > maxRecords) {
+            std::cerr << "ze_binary_trace: ZEL_LOADER_BINARY_TRACE_RECORDS=" << recordsEnv
+                      << " is too large; using " << maxRecords << "\n";
+            records = maxRecords;
+        } else {
+            records = parsed;
+        }
+    }
+
+    std::unique_ptr<BinaryTraceWriter> writer(new BinaryTraceWriter(path, records));
+    if (!writer->isOpen()) {
+        std::cerr << "ze_binary_trace: Failed to map binary trace file " << path << "\n";
+        return nullptr;
+    }
+    return writer;
+}
+
+bool readBinaryTrace(const std::string &path, BinaryTraceContents &contents, std::string &error) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        error = "cannot open " + path;
+        return false;
+    }
+    const std::vector<char> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    BinaryTraceFileHeader header;
+    if (data.size() < sizeof(header)) {
+        error = "file too small for a binary trace header";
+        return false;
+    }
+    std::memcpy(static_cast<void *>(&header), data.data(), sizeof(header));
+    if (std::memcmp(header.magic, BinaryTraceMagic, sizeof(header.magic)) != 0) {
+        error = "not a binary trace (bad magic)";
+        return false;
+    }
+    if (header.version != BinaryTraceVersion || header.recordSize != sizeof(BinaryTraceRecord)) {
+        error = "unsupported binary trace version";
+        return false;
+    }
+    const uint64_t nameTableUsed = header.nameTableUsed.load();
+    if (header.nameTableOffset + header.nameTableSize > data.size() || nameTableUsed > header.nameTableSize ||
+        header.recordsOffset + header.recordCapacity * sizeof(BinaryTraceRecord) > data.size()) {
+        error = "truncated binary trace";
+        return false;
+    }
+
+    contents.processId = header.processId;
+    contents.startRealtimeNs = header.startRealtimeNs;
+    contents.recordCapacity = header.recordCapacity;
+    contents.totalRecorded = header.nextRecord.load();
+
+    // Name table: apiCount pairs of "name\0signature\0".
+    const char *table = data.data() + header.nameTableOffset;
+    const char *tableEnd = table + nameTableUsed;
+    const uint32_t apiCount = header.apiCount.load();
+    contents.apis.clear();
+    for (uint32_t i = 0; i < apiCount && table < tableEnd; ++i) {
+        BinaryTraceApi api;
+        api.name = table;
+        table += api.name.size() + 1;
+        const std::string signature = table < tableEnd ? std::string(table) : std::string();
+        table += signature.size() + 1;
+
+        std::size_t begin = 0;
+        while (begin < signature.size()) {
+            std::size_t end = signature.find(',', begin);
+            if (end == std::string::npos) end = signature.size();
+            const std::string param = signature.substr(begin, end - begin);
+            const std::size_t split = param.find_last_of(' ');
+            api.paramTypes.push_back(split == std::string::npos ? std::string() : param.substr(0, split));
+            api.paramNames.push_back(split == std::string::npos ? param : param.substr(split + 1));
+            begin = end + 1;
+        }
+        contents.apis.push_back(std::move(api));
+    }
+
+    contents.entries.clear();
+    const char *records = data.data() + header.recordsOffset;
+    for (uint64_t slot = 0; slot < header.recordCapacity; ++slot) {
+        BinaryTraceRecord rec;
+        std::memcpy(static_cast<void *>(&rec), records + slot * sizeof(BinaryTraceRecord), sizeof(rec));
+        const uint64_t sequence = rec.sequence.load();
+        if (sequence == 0 || sequence == BinaryTraceClaimed || ((sequence - 1) & (header.recordCapacity - 1)) != slot) {
+            continue;
+        }
+        BinaryTraceEntry entry;
+        entry.sequence = sequence;
+        entry.apiId = rec.apiId;
+        entry.result = rec.result;
+        entry.threadId = rec.threadId;
+        entry.timestampNs = rec.timestampNs - header.startTimestampNs;
+        entry.argCount = rec.argCount;
+        std::memcpy(entry.args, rec.args, sizeof(entry.args));
+        contents.entries.push_back(entry);
+    }
+    std::sort(contents.entries.begin(), contents.entries.end(),
+              [](const BinaryTraceEntry &a, const BinaryTraceEntry &b) { return a.sequence < b.sequence; });
+    return true;
+}
+
+std::string formatBinaryTraceArg(const std::string &type, uint64_t value) {
+    char buf[32];
+    if (endsWith(type, "*") || endsWith(type, "_handle_t") || endsWith(type, "_callback_t")) {
+        if (value == 0) {
+            return "nullptr";
+        }
+        std::snprintf(buf, sizeof(buf), "0x%" PRIx64, value);
+    } else if (type == "double" || type == "float") {
+        double d;
+        std::memcpy(&d, &value, sizeof(d));
+        std::snprintf(buf, sizeof(buf), "%g", d);
+    } else if (isIntegerType(type) || (endsWith(type, "_t") && !endsWith(type, "_flags_t") &&
+                                       type.compare(0, 6, "const ") != 0 && type.find("_desc_t") == std::string::npos)) {
+        // Integers and enums.  Signed values were sign-extended when recorded.
+        if (type.compare(0, 3, "int") == 0) {
+            std::snprintf(buf, sizeof(buf), "%" PRId64, static_cast<int64_t>(value));
+        } else {
+            std::snprintf(buf, sizeof(buf), "%" PRIu64, value);
+        }
+    } else {
+        std::snprintf(buf, sizeof(buf), "0x%" PRIx64, value);
+    }
+    return buf;
+}
+
+} // namespace loader
@@ -0,0 +1,197 @@
+/*
+ *
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef ZE_BINARY_TRACE_H
+#define ZE_BINARY_TRACE_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace loader {
+
+// ---------------------------------------------------------------------------
+// On-disk layout of a binary API trace.
+//
+//   [BinaryTraceFileHeader][API name table][BinaryTraceRecord x recordCapacity]
+//
+// The whole file is mapped once and written in place: records form a ring, so
+// a long-running process keeps the most recent recordCapacity calls.  A record
+// is complete once its sequence number (ring index + 1) has been published;
+// anything else (never written, BinaryTraceClaimed while being written, or
+// torn by a crash mid-write) is skipped by the reader.  A writer claims its
+// slot before writing, so when the ring wraps under a slow writer and two
+// writers meet at one slot, the older record is dropped instead of the two
+// being interleaved.  The name table maps API ids to "name\0signature\0" pairs, where
+// the signature is the comma separated "type name" parameter list used by the
+// decoder to render the raw argument values.
+// ---------------------------------------------------------------------------
+constexpr char     BinaryTraceMagic[8]    = {'Z', 'E', 'L', 'B', 'T', 'R', 'C', '1'};
+constexpr uint32_t BinaryTraceVersion     = 1;
+constexpr uint32_t BinaryTraceMaxArgs     = 11;
+constexpr uint64_t BinaryTraceNameTableSize = 512 * 1024;
+constexpr uint64_t BinaryTraceClaimed     = UINT64_MAX;
+
+struct BinaryTraceFileHeader {
+    char     magic[8];
+    uint32_t version;
+    uint32_t recordSize;
+    uint64_t recordCapacity;        // power of two
+    uint64_t nameTableOffset;
+    uint64_t nameTableSize;
+    uint64_t recordsOffset;
+    uint64_t startTimestampNs;      // steady clock at trace creation
+    uint64_t startRealtimeNs;       // wall clock at trace creation
+    uint64_t processId;
+    std::atomic<uint64_t> nextRecord;
+    std::atomic<uint64_t> nameTableUsed;
+    std::atomic<uint32_t> apiCount;
+    uint32_t reserved;
+};
+
+struct BinaryTraceRecord {
+    std::atomic<uint64_t> sequence; // ring index + 1, published last; BinaryTraceClaimed while written
+    uint32_t apiId;
+    int32_t  result;
+    uint64_t threadId;
+    uint64_t timestampNs;           // steady clock
+    uint32_t argCount;              // number of API parameters, may exceed BinaryTraceMaxArgs
+    uint32_t reserved;
+    uint64_t args[BinaryTraceMaxArgs];
+};
+
+static_assert(sizeof(std::atomic<uint64_t>) == sizeof(uint64_t) &&
+              sizeof(std::atomic<uint32_t>) == sizeof(uint32_t),
+              "binary trace atomics must be plain words in the mapped file");
+static_assert(sizeof(BinaryTraceRecord) == 128, "binary trace records are two cache lines");
+
+// Raw 64-bit encoding of an API argument: handles and pointers by address,
+// integers and enums by value, floating point by bit pattern and by-value
+// structures by their leading bytes.
+template <typename T>
+inline typename std::enable_if<std::is_pointer<T>::value, uint64_t>::type
+toBinaryTraceArg(T value) {
+    return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value));
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value, uint64_t>::type
+toBinaryTraceArg(T value) {
+    return static_cast<uint64_t>(value);
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_floating_point<T>::value, uint64_t>::type
+toBinaryTraceArg(T value) {
+    const double widened = static_cast<double>(value);
+    uint64_t bits;
+    std::memcpy(&bits, &widened, sizeof(bits));
+    return bits;
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_class<T>::value, uint64_t>::type
+toBinaryTraceArg(const T &value) {
+    uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(T) < sizeof(bits) ? sizeof(T) : sizeof(bits));
+    return bits;
+}
+
+// Appends fixed-size call records into a memory-mapped, file-backed ring.
+// Recording is lock-free (one fetch_add, one compare-exchange to claim the
+// slot and a 128 byte store); only registerApi(), called once per API, takes
+// a lock.
+class BinaryTraceWriter {
+public:
+    // Creates (truncating) the trace file.  Check isOpen() before use.
+    BinaryTraceWriter(const std::string &path, uint64_t records);
+    ~BinaryTraceWriter();
+
+    BinaryTraceWriter(const BinaryTraceWriter&)            = delete;
+    BinaryTraceWriter& operator=(const BinaryTraceWriter&) = delete;
+
+    bool isOpen() const { return _header != nullptr; }
+
+    // Writes the mapped records back to the file.  The mapping stays valid,
+    // so calls made afterwards are still recorded.
+    void flush();
+
+    // Adds an API to the file's name table and returns its id.
+    uint32_t registerApi(const char *name, const char *signature);
+
+    template <typename... Args>
+    void record(uint32_t apiId, int32_t result, const Args &...args) {
+        const uint64_t values[] = {toBinaryTraceArg(args)..., 0};
+        append(apiId, result, values, static_cast<uint32_t>(sizeof...(Args)));
+    }
+
+private:
+    void append(uint32_t apiId, int32_t result, const uint64_t *args, uint32_t argCount);
+
+    BinaryTraceFileHeader *_header = nullptr;
+    char                  *_nameTable = nullptr;
+    BinaryTraceRecord     *_records = nullptr;
+    uint64_t               _mask = 0;
+    std::size_t            _mappedSize = 0;
+    std::mutex             _registerMutex;
+#ifdef _WIN32
+    void *_file = nullptr;
+    void *_mapping = nullptr;
+#else
+    int _fd = -1;
+#endif
+};
+
+// Reads BinaryTraceWriter's environment configuration:
+//   ZEL_LOADER_BINARY_TRACE_FILE     path of the trace file; unset disables tracing
+//   ZEL_LOADER_BINARY_TRACE_RECORDS  ring capacity in records (default 262144,
+//                                    at most 1 << 22)
+// Returns nullptr when tracing is disabled or the file cannot be mapped.
+std::unique_ptr<BinaryTraceWriter> createBinaryTraceWriter();
+
+// Decoded contents of a trace file, records sorted oldest first.
+struct BinaryTraceApi {
+    std::string name;
+    std::vector<std::string> paramTypes;
+    std::vector<std::string> paramNames;
+};
+
+struct BinaryTraceEntry {
+    uint64_t sequence;
+    uint32_t apiId;
+    int32_t  result;
+    uint64_t threadId;
+    uint64_t timestampNs;           // relative to the start of the trace
+    uint32_t argCount;
+    uint64_t args[BinaryTraceMaxArgs];
+};
+
+struct BinaryTraceContents {
+    uint64_t processId = 0;
+    uint64_t startRealtimeNs = 0;
+    uint64_t recordCapacity = 0;
+    uint64_t totalRecorded = 0;     // including records overwritten by the ring
+    std::vector<BinaryTraceApi> apis;
+    std::vector<BinaryTraceEntry> entries;
+};
+
+// Returns false and sets error when path is not a readable binary trace.
+bool readBinaryTrace(const std::string &path, BinaryTraceContents &contents, std::string &error);
+
+// Renders one raw argument according to its declared type: handles and
+// pointers in hex, integers in decimal, flags in hex and doubles as values.
+std::string formatBinaryTraceArg(const std::string &type, uint64_t value);
+
+} // namespace loader
+
+#endif // ZE_BINARY_TRACE_H
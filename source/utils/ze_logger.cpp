@@ -9,9 +9,13 @@
 #include "ze_logger.h"
 #include "ze_util.h"
 
+#include <atomic>
 #include <cerrno>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include <ctime>
 #include <iomanip>
@@ -124,6 +128,105 @@ static std::string errnoToString(int err) {
 
 } // anonymous namespace
 
+// ---------------------------------------------------------------------------
+// AsyncLogQueue — bounded multi-producer ring of preformatted log records.
+//
+// Producers claim a record with a single CAS on the enqueue position, format
+// the line straight into it and publish it with a release store of the
+// record's sequence number (Vyukov bounded queue).  No lock is taken and
+// nothing is allocated on the logging thread; when the ring is full the
+// record is dropped and counted instead of blocking the caller.  Records are
+// consumed by whoever holds LogSink::mtx (the writer thread or flush()).
+// ---------------------------------------------------------------------------
+struct AsyncLogRecord {
+    static constexpr std::size_t size = 1024;
+    static constexpr std::size_t capacity =
+        size - sizeof(std::atomic<std::size_t>) - sizeof(std::size_t);
+
+    std::atomic<std::size_t> sequence;
+    std::size_t              len;
+    char                     data[capacity];
+};
+
+class AsyncLogQueue {
+public:
+    explicit AsyncLogQueue(std::size_t records)
+        : _mask(roundUpPow2(records) - 1),
+          _records(new AsyncLogRecord[_mask + 1]),
+          _enqueue_pos(0), _dequeue_pos(0), _dropped(0)
+    {
+        for (std::size_t i = 0; i <= _mask; ++i) {
+            _records[i].sequence.store(i, std::memory_order_relaxed);
+            _records[i].len = 0;
+        }
+    }
+
+    // Claims the next free record, or returns nullptr (and counts a drop)
+    // when the ring is full.  The caller must publish() a claimed record.
+    AsyncLogRecord *reserve(std::size_t &pos) {
+        pos = _enqueue_pos.load(std::memory_order_relaxed);
+        for (;;) {
+            AsyncLogRecord &rec = _records[pos & _mask];
+            const std::size_t seq = rec.sequence.load(std::memory_order_acquire);
+            const std::intptr_t diff =
+                static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (_enqueue_pos.compare_exchange_weak(pos, pos + 1,
+                                                       std::memory_order_relaxed)) {
+                    return &rec;
+                }
+            } else if (diff < 0) {
+                _dropped.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            } else {
+                pos = _enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void publish(AsyncLogRecord *rec, std::size_t pos) {
+        rec->sequence.store(pos + 1, std::memory_order_release);
+    }
+
+    // Consumer side; callers serialize on LogSink::mtx.
+    AsyncLogRecord *front() {
+        const std::size_t pos = _dequeue_pos.load(std::memory_order_relaxed);
+        AsyncLogRecord &rec = _records[pos & _mask];
+        if (rec.sequence.load(std::memory_order_acquire) != pos + 1) {
+            return nullptr;
+        }
+        return &rec;
+    }
+
+    void pop(AsyncLogRecord *rec) {
+        const std::size_t pos = _dequeue_pos.load(std::memory_order_relaxed);
+        rec->sequence.store(pos + _mask + 1, std::memory_order_release);
+        _dequeue_pos.store(pos + 1, std::memory_order_relaxed);
+    }
+
+    // True once more than half of the ring is waiting to be written.  Called
+    // by producers without LogSink::mtx, so this is only an estimate.
+    bool isBacklogged() const {
+        return _enqueue_pos.load(std::memory_order_relaxed) -
+               _dequeue_pos.load(std::memory_order_relaxed) > (_mask + 1) / 2;
+    }
+
+    std::uint64_t takeDropped() { return _dropped.exchange(0, std::memory_order_relaxed); }
+
+private:
+    static std::size_t roundUpPow2(std::size_t n) {
+        std::size_t p = 2;
+        while (p < n) p <<= 1;
+        return p;
+    }
+
+    const std::size_t                 _mask;
+    std::unique_ptr<AsyncLogRecord[]> _records;
+    std::atomic<std::size_t>          _enqueue_pos;
+    std::atomic<std::size_t>          _dequeue_pos;  // written under LogSink::mtx
+    std::atomic<std::uint64_t>        _dropped;
+};
+
 // ---------------------------------------------------------------------------
 // LogSink — one per ZeLogger instance, owns the output stream and its mutex.
 // ---------------------------------------------------------------------------
@@ -134,6 +237,13 @@ struct LogSink {
     bool          color_enabled;
     bool          is_good;      // cached stream health — avoids internal streambuf lock per write
 
+    // Asynchronous mode only: the ring the API threads format into and the
+    // background thread that drains it.
+    std::unique_ptr<AsyncLogQueue> async_queue;
+    std::thread                    writer;
+    std::condition_variable        writer_cv;
+    bool                           writer_stop = false;  // guarded by mtx
+
     // File sink
     explicit LogSink(const std::string &path)
         : stream(nullptr), color_enabled(false), is_good(false)
@@ -161,6 +271,10 @@ struct LogSink {
     // constructing an intermediate std::string (keeps the log hot path allocation-free).
     void write(const char *data, std::size_t len) {
         std::lock_guard<std::mutex> lk(mtx);
+        if (async_queue) {
+            // Keep ordering with records already sitting in the ring.
+            drainLocked();
+        }
         if (is_good) {
             stream->write(data, static_cast<std::streamsize>(len));
             stream->put('\n');
@@ -180,10 +294,92 @@ struct LogSink {
 
     void flush() {
         std::lock_guard<std::mutex> lk(mtx);
+        if (async_queue) {
+            drainLocked();
+            reportDroppedLocked();
+        }
+        if (stream) {
+            stream->flush();
+        }
+    }
+
+    // Starts the background writer.  Called once, right after construction.
+    void startAsync(std::size_t records) {
+#ifdef _WIN32
+        // Joining a thread from a DLL's static destructors deadlocks on the
+        // loader lock, so the asynchronous sink is only offered on Linux.
+        (void)records;
+#else
+        if (!is_good || records == 0) {
+            return;
+        }
+        async_queue.reset(new AsyncLogQueue(records));
+        writer = std::thread(&LogSink::writerLoop, this);
+#endif
+    }
+
+    // Wakes the writer early when the ring is filling up; otherwise producers
+    // never touch the condition variable and the writer polls.
+    void notifyWriter() {
+        if (async_queue->isBacklogged()) {
+            writer_cv.notify_one();
+        }
+    }
+
+    ~LogSink() {
+        if (writer.joinable()) {
+            {
+                std::lock_guard<std::mutex> lk(mtx);
+                writer_stop = true;
+            }
+            writer_cv.notify_one();
+            writer.join();
+        }
+    }
+
+private:
+    void writerLoop() {
+        std::unique_lock<std::mutex> lk(mtx);
+        while (!writer_stop) {
+            drainLocked();
+            writer_cv.wait_for(lk, std::chrono::milliseconds(5));
+        }
+        // Teardown: everything published before the logger is destroyed is
+        // written before the stream closes.
+        drainLocked();
+        reportDroppedLocked();
         if (stream) {
             stream->flush();
         }
     }
+
+    void drainLocked() {
+        bool wrote = false;
+        while (AsyncLogRecord *rec = async_queue->front()) {
+            if (is_good && rec->len != 0) {
+                stream->write(rec->data, static_cast<std::streamsize>(rec->len));
+                stream->put('\n');
+                wrote = true;
+            }
+            async_queue->pop(rec);
+        }
+        if (wrote && is_good) {
+            stream->flush();
+            if (stream->fail()) {
+                is_good = false;
+                std::cerr << "ze_logger: Log stream write failed: "
+                          << errnoToString(errno) << "\n";
+            }
+        }
+    }
+
+    void reportDroppedLocked() {
+        const std::uint64_t dropped = async_queue->takeDropped();
+        if (dropped != 0 && is_good) {
+            *stream << "ze_logger: " << dropped
+                    << " log records dropped, asynchronous log buffer was full\n";
+        }
+    }
 };
 
 // ---------------------------------------------------------------------------
@@ -207,13 +403,19 @@ ZeLogger::ZeLogger()
     : _level(LogLevel::off), _pattern(), _sink(nullptr)
 {}
 
-ZeLogger::ZeLogger(const std::string &log_path, LogLevel level, const std::string &pattern)
+ZeLogger::ZeLogger(const std::string &log_path, LogLevel level, const std::string &pattern,
+                   std::size_t async_records)
     : _level(level), _pattern(pattern), _sink(new LogSink(log_path))
-{}
+{
+    _sink->startAsync(async_records);
+}
 
-ZeLogger::ZeLogger(bool use_stderr, LogLevel level, const std::string &pattern)
+ZeLogger::ZeLogger(bool use_stderr, LogLevel level, const std::string &pattern,
+                   std::size_t async_records)
     : _level(level), _pattern(pattern), _sink(new LogSink(use_stderr))
-{}
+{
+    _sink->startAsync(async_records);
+}
 
 ZeLogger::~ZeLogger() {
     flush();
@@ -373,10 +575,28 @@ std::size_t ZeLogger::formatLine(LogLevel msg_level, const std::string &msg,
     return len;
 }
 
+bool ZeLogger::writeAsync(LogLevel msg_level, const std::string &msg) {
+    std::size_t pos;
+    AsyncLogRecord *rec = _sink->async_queue->reserve(pos);
+    if (!rec) {
+        return true;  // ring full: dropped and counted, reported on flush
+    }
+    const std::size_t n = formatLine(msg_level, msg, rec->data, AsyncLogRecord::capacity);
+    const bool fits = n <= AsyncLogRecord::capacity;
+    // An oversized line publishes an empty record and is written synchronously.
+    rec->len = fits ? n : 0;
+    _sink->async_queue->publish(rec, pos);
+    _sink->notifyWriter();
+    return fits;
+}
+
 void ZeLogger::write(LogLevel msg_level, const std::string &msg) {
     if (!_sink || msg_level < _level) {
         return;
     }
+    if (_sink->async_queue && writeAsync(msg_level, msg)) {
+        return;
+    }
     // POD thread_local buffer — trivial destructor, freed with the thread, no heap
     // leak. A log call can arrive during exit-time teardown (e.g. SYCL shutdown →
     // validation-layer DDI → log) AFTER a non-trivial thread_local (std::string)
@@ -573,6 +793,24 @@ std::shared_ptr<ZeLogger> createLogger(const std::string &caller) {
         log_pattern = custom_pattern;
     }
 
+    // ZEL_LOADER_LOG_ASYNC=1 hands formatted lines to a background writer
+    // through a bounded ring of ZEL_LOADER_LOG_ASYNC_RECORDS records.
+    // Counts of 0 or above 1 << 20 (1 GiB of records) fall back to the default.
+    std::size_t async_records = 0;
+    if (getenv_tobool("ZEL_LOADER_LOG_ASYNC")) {
+        const unsigned long long default_records = 4096;
+        const unsigned long long max_records = 1ull << 20;
+        async_records = default_records;
+        auto records = getenv_string("ZEL_LOADER_LOG_ASYNC_RECORDS");
+        if (!records.empty() && records.find('-') == std::string::npos) {
+            errno = 0;
+            const unsigned long long parsed = std::strtoull(records.c_str(), nullptr, 10);
+            if (errno == 0 && parsed != 0 && parsed <= max_records) {
+                async_records = static_cast<std::size_t>(parsed);
+            }
+        }
+    }
+
     const uint32_t log_console_mode = getenv_tomode("ZEL_LOADER_LOG_CONSOLE");
     const bool log_console = (log_console_mode != 0);
     const bool advanced_mode = (logging_mode == 2) || (getenv_tomode("ZE_ENABLE_LOADER_DEBUG_TRACE") == 2);
@@ -592,7 +830,7 @@ std::shared_ptr<ZeLogger> createLogger(const std::string &caller) {
     std::shared_ptr<ZeLogger> logger;
     std::string output_dest;
     if (log_console) {
-        logger = std::shared_ptr<ZeLogger>(new ZeLogger(/*use_stderr=*/true, level, log_pattern));
+        logger = std::shared_ptr<ZeLogger>(new ZeLogger(/*use_stderr=*/true, level, log_pattern, async_records));
         output_dest = "stderr (console)";
     } else {
         // Create the full directory path (equivalent to mkdir -p).
@@ -646,7 +884,7 @@ std::shared_ptr<ZeLogger> createLogger(const std::string &caller) {
             }
         }
 #endif
-        logger = std::shared_ptr<ZeLogger>(new ZeLogger(full_log_file_path, level, log_pattern));
+        logger = std::shared_ptr<ZeLogger>(new ZeLogger(full_log_file_path, level, log_pattern, async_records));
         output_dest = full_log_file_path;
     }
 
@@ -659,6 +897,7 @@ std::shared_ptr<ZeLogger> createLogger(const std::string &caller) {
         cfg += "\n  ZEL_LOADER_LOG_DIR               : " + log_directory;
         cfg += "\n  ZEL_LOADER_LOG_FILE              : " + loader_file;
         cfg += "\n  ZEL_LOADER_LOG_PATTERN           : " + log_pattern;
+        cfg += "\n  ZEL_LOADER_LOG_ASYNC             : " + (async_records ? std::to_string(async_records) + " records" : std::string("disabled"));
         cfg += "\n  Output                           : " + output_dest;
         logger->info(cfg);
     }
@@ -49,10 +49,14 @@ public:
     // No-op constructor: level=off, no sink, no I/O, no syscalls, no mutex.
     // Use this (or createLogger() with logging disabled) for zero-overhead paths.
     ZeLogger();
-    // File sink constructor
-    ZeLogger(const std::string &log_path, LogLevel level, const std::string &pattern);
+    // File sink constructor.  A non-zero async_records makes the sink
+    // asynchronous: lines are formatted into a lock-free ring of that many
+    // records and written by a background thread (Linux only).
+    ZeLogger(const std::string &log_path, LogLevel level, const std::string &pattern,
+             std::size_t async_records = 0);
     // Console sink constructor (stderr or stdout)
-    ZeLogger(bool use_stderr, LogLevel level, const std::string &pattern);
+    ZeLogger(bool use_stderr, LogLevel level, const std::string &pattern,
+             std::size_t async_records = 0);
     ~ZeLogger();
 
     // Non-copyable and non-movable: a logger owns a sink (stream + mutex) and
@@ -69,6 +73,10 @@ public:
     void setLevel(LogLevel level);
     LogLevel getLevel() const;
 
+    // True when a message at msg_level would be written.  Lets callers skip
+    // building the message at all when the level is filtered out.
+    bool shouldLog(LogLevel msg_level) const { return _sink && msg_level >= _level; }
+
     void trace(const std::string &msg);
     void debug(const std::string &msg);
     void info(const std::string &msg);
@@ -89,6 +97,9 @@ public:
 
 private:
     void write(LogLevel msg_level, const std::string &msg);
+    // Formats msg into the sink's async ring.  Returns false when the line is
+    // too long for a ring record and must be written synchronously instead.
+    bool writeAsync(LogLevel msg_level, const std::string &msg);
     // Formats the log line into a caller-provided fixed buffer (snprintf-style).
     // Returns the total number of bytes the full line needs; if that exceeds
     // `cap` the buffer holds a truncated prefix and the caller must retry with a
@@ -116,4 +127,15 @@ ZeLogger *noopLogger();
 
 } // namespace loader
 
+// Level-gated logging: `msg` is only evaluated (and any std::string built) when
+// the logger would actually write it, so a disabled level costs one compare.
+#define ZEL_LOG_AT_LEVEL(logger, level, method, msg)      \
+    do {                                                 \
+        if ((logger)->shouldLog(loader::LogLevel::level)) \
+            (logger)->method(msg);                       \
+    } while (0)
+
+#define ZEL_LOG_TRACE(logger, msg) ZEL_LOG_AT_LEVEL(logger, trace, log_trace, msg)
+#define ZEL_LOG_DEBUG(logger, msg) ZEL_LOG_AT_LEVEL(logger, debug, log_debug, msg)
+
 #endif // ZE_LOGGER_H
@@ -0,0 +1,71 @@
+/*
+ *
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Offline decoder for binary API traces written with
+// ZEL_LOADER_BINARY_TRACE_FILE.  Prints one line per recorded call, oldest
+// first, in the same "name(param=value, ...)" shape as the validation layer's
+// text trace.
+
+#include "ze_binary_trace.h"
+#include "ze_logger.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+int main(int argc, char *argv[]) {
+    if (argc != 2 || std::strcmp(argv[1], "-h") == 0 || std::strcmp(argv[1], "--help") == 0) {
+        std::fprintf(stderr, "usage: ze_trace_decode <trace file>\n");
+        return argc == 2 ? 0 : 1;
+    }
+
+    loader::BinaryTraceContents contents;
+    std::string error;
+    if (!loader::readBinaryTrace(argv[1], contents, error)) {
+        std::fprintf(stderr, "ze_trace_decode: %s\n", error.c_str());
+        return 1;
+    }
+
+    std::printf("# pid %" PRIu64 ", %" PRIu64 " calls recorded, %zu retained (ring of %" PRIu64 ")\n",
+                contents.processId, contents.totalRecorded, contents.entries.size(),
+                contents.recordCapacity);
+
+    for (const auto &entry : contents.entries) {
+        const loader::BinaryTraceApi *api =
+            entry.apiId < contents.apis.size() ? &contents.apis[entry.apiId] : nullptr;
+
+        std::string line;
+        if (api) {
+            line = api->name;
+        } else {
+            line = "api#" + std::to_string(entry.apiId);
+        }
+        line += "(";
+        const uint32_t stored = entry.argCount < loader::BinaryTraceMaxArgs ? entry.argCount
+                                                                            : loader::BinaryTraceMaxArgs;
+        for (uint32_t i = 0; i < stored; ++i) {
+            if (i > 0) {
+                line += ", ";
+            }
+            const bool named = api && i < api->paramNames.size();
+            line += named ? api->paramNames[i] : "arg" + std::to_string(i);
+            line += "=";
+            line += loader::formatBinaryTraceArg(named ? api->paramTypes[i] : std::string(), entry.args[i]);
+        }
+        if (entry.argCount > stored) {
+            line += ", ...";
+        }
+        line += ") = ";
+        line += loader::to_string(static_cast<ze_result_t>(entry.result));
+
+        std::printf("[%12.6f ms] [tid:%" PRIu64 "] %s\n",
+                    static_cast<double>(entry.timestampNs) / 1e6, entry.threadId, line.c_str());
+    }
+    return 0;
+}
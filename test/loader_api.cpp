@@ -14,7 +14,11 @@
 #include "zes_api.h"
 #include "zer_api.h"
 
+#include <chrono>
+#include <atomic>
 #include <fstream>
+#include <thread>
+#include <vector>
 
 #if defined(_WIN32)
     #include <io.h>
@@ -520,6 +524,27 @@ TEST(
   EXPECT_GT(pDriverGetCount, 0);
 }
 
+// Run with ZEL_ENABLE_PARALLEL_DRIVER_INIT=1 and a driver list that also
+// names a library that does not exist, so its init fails on every call.
+// The failure must not leave a parked result behind for a later init.
+TEST(
+  LoaderInit,
+  GivenParallelDriverInitWhenDriverInitFailsThenRepeatedInitsReportTheOtherDrivers) {
+
+  ze_init_driver_type_desc_t desc = {ZE_STRUCTURE_TYPE_INIT_DRIVER_TYPE_DESC};
+  desc.flags = UINT32_MAX;
+  for (int i = 0; i < 2; ++i) {
+    uint32_t initDriversCount = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInitDrivers(&initDriversCount, nullptr, &desc));
+    EXPECT_EQ(2u, initDriversCount);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInit(0));
+    uint32_t driverGetCount = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverGetCount, nullptr));
+    EXPECT_EQ(2u, driverGetCount);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesInit(0));
+  }
+}
+
 TEST(
   LoaderInit,
   GivenLevelZeroLoaderPresentWithMultipleDriversWhenCallingZeInitThenZeInitDriversThenExpectSuccessForZeInitWithDriverGetAfterInitDrivers) {
@@ -536,6 +561,65 @@ TEST(
   EXPECT_GT(pDriverGetCount, 0);
 }
 
+TEST(
+  LoaderInit,
+  GivenLevelZeroLoaderPresentWithMultipleDriversWhenCallingZeDriverGetRepeatedlyFromManyThreadsThenSameHandlesAreReturned) {
+
+  uint32_t driverCount = 0;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeInit(0));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, nullptr));
+  ASSERT_GT(driverCount, 1);
+  std::vector<ze_driver_handle_t> expected(driverCount);
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, expected.data()));
+
+  uint32_t partialCount = 1;
+  ze_driver_handle_t first = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&partialCount, &first));
+  EXPECT_EQ(1u, partialCount);
+  EXPECT_EQ(expected[0], first);
+
+  uint32_t largeCount = driverCount + 4;
+  std::vector<ze_driver_handle_t> large(largeCount);
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&largeCount, large.data()));
+  EXPECT_EQ(driverCount, largeCount);
+
+  std::atomic<uint32_t> mismatches{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; ++t) {
+    threads.emplace_back([&]() {
+      for (int i = 0; i < 1000; ++i) {
+        uint32_t count = 0;
+        std::vector<ze_driver_handle_t> handles(expected.size());
+        if (zeDriverGet(&count, nullptr) != ZE_RESULT_SUCCESS || count != expected.size() ||
+            zeDriverGet(&count, handles.data()) != ZE_RESULT_SUCCESS || handles != expected) {
+          ++mismatches;
+        }
+      }
+    });
+  }
+  // Each zeInit retires the published list while the readers above may
+  // still be copying from it.
+  threads.emplace_back([&]() {
+    for (int i = 0; i < 200; ++i) {
+      uint32_t count = 0;
+      std::vector<ze_driver_handle_t> handles(expected.size());
+      if (zeInit(0) != ZE_RESULT_SUCCESS || zeDriverGet(&count, nullptr) != ZE_RESULT_SUCCESS ||
+          zeDriverGet(&count, handles.data()) != ZE_RESULT_SUCCESS || handles != expected) {
+        ++mismatches;
+      }
+    }
+  });
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(0u, mismatches.load());
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeInit(0));
+  std::vector<ze_driver_handle_t> afterInit(driverCount);
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, afterInit.data()));
+  EXPECT_EQ(expected, afterInit);
+}
+
 TEST(
   LoaderInit,
   GivenLevelZeroLoaderPresentWithMultipleDriversWhenCallingZesInitThenExpectSuccessForZesDriverGet) {
@@ -786,6 +870,394 @@ TEST(
   EXPECT_TRUE(enabled);
 }
 
+TEST(
+  ApiLatencyStats,
+  GivenLatencyStatsEnabledWhenCallingApisThenPerApiCountsAreReturnedAndResetClearsThem) {
+
+  uint32_t pCount = 0;
+  ze_init_driver_type_desc_t desc = {ZE_STRUCTURE_TYPE_INIT_DRIVER_TYPE_DESC};
+  desc.flags = UINT32_MAX;
+  desc.pNext = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeInitDrivers(&pCount, nullptr, &desc));
+  std::vector<ze_driver_handle_t> drivers(pCount);
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeInitDrivers(&pCount, drivers.data(), &desc));
+  ASSERT_GT(pCount, 0u);
+
+  uint32_t statsCount = 0;
+  EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, zelGetApiLatencyStats(nullptr, nullptr, false));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelGetApiLatencyStats(&statsCount, nullptr, true));
+  std::vector<zel_api_latency_stats_t> stats(statsCount + 1);
+  statsCount = static_cast<uint32_t>(stats.size());
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelGetApiLatencyStats(&statsCount, stats.data(), true));
+
+  for (int i = 0; i < 10; ++i) {
+    uint32_t deviceCount = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDeviceGet(drivers[0], &deviceCount, nullptr));
+  }
+
+  statsCount = 0;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelGetApiLatencyStats(&statsCount, nullptr, false));
+  ASSERT_EQ(1u, statsCount);
+  zel_api_latency_stats_t deviceGet = {};
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelGetApiLatencyStats(&statsCount, &deviceGet, true));
+  ASSERT_EQ(1u, statsCount);
+  ASSERT_NE(nullptr, deviceGet.name);
+  EXPECT_STREQ("zeDeviceGet", deviceGet.name);
+  EXPECT_EQ(10u, deviceGet.callCount);
+  EXPECT_LE(deviceGet.minNs, deviceGet.p50Ns);
+  EXPECT_LE(deviceGet.p50Ns, deviceGet.p90Ns);
+  EXPECT_LE(deviceGet.p90Ns, deviceGet.p99Ns);
+  EXPECT_LE(deviceGet.p99Ns, deviceGet.p999Ns);
+  EXPECT_LE(deviceGet.p999Ns, deviceGet.maxNs);
+  EXPECT_GE(deviceGet.totalNs, deviceGet.maxNs);
+
+  statsCount = 0;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelGetApiLatencyStats(&statsCount, nullptr, false));
+  EXPECT_EQ(0u, statsCount);
+}
+
+TEST(
+  ApiLatencyStats,
+  GivenLatencyStatsNotEnabledWhenCallingzelGetApiLatencyStatsThenUnsupportedFeatureIsReturned) {
+
+  uint32_t pCount = 0;
+  ze_init_driver_type_desc_t desc = {ZE_STRUCTURE_TYPE_INIT_DRIVER_TYPE_DESC};
+  desc.flags = UINT32_MAX;
+  desc.pNext = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeInitDrivers(&pCount, nullptr, &desc));
+  uint32_t statsCount = 0;
+  EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, zelGetApiLatencyStats(&statsCount, nullptr, false));
+}
+
+TEST(
+  SysmanSnapshot,
+  GivenSysmanDevicesWhenTakingSnapshotsThenRequestedDomainsAreFilledAndComponentsAreEnumeratedOnce) {
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zesInit(0));
+  uint32_t driverCount = 0;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zesDriverGet(&driverCount, nullptr));
+  std::vector<zes_driver_handle_t> drivers(driverCount);
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zesDriverGet(&driverCount, drivers.data()));
+  std::vector<zes_device_handle_t> devices;
+  for (auto driver : drivers) {
+    uint32_t deviceCount = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceGet(driver, &deviceCount, nullptr));
+    std::vector<zes_device_handle_t> driverDevices(deviceCount);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceGet(driver, &deviceCount, driverDevices.data()));
+    devices.insert(devices.end(), driverDevices.begin(), driverDevices.end());
+  }
+  ASSERT_FALSE(devices.empty());
+
+  const uint32_t capacity = 4;
+  std::vector<zel_sysman_power_sample_t> power(devices.size() * capacity);
+  std::vector<zel_sysman_frequency_sample_t> frequency(devices.size() * capacity);
+  std::vector<zel_sysman_temperature_sample_t> temperature(devices.size() * capacity);
+  std::vector<zel_sysman_engine_sample_t> engine(devices.size() * capacity);
+  std::vector<zel_sysman_device_snapshot_t> snapshots(devices.size());
+  auto prepare = [&]() {
+    for (size_t i = 0; i < devices.size(); ++i) {
+      snapshots[i] = {};
+      snapshots[i].hDevice = devices[i];
+      snapshots[i].domains = ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_POWER | ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_FREQUENCY |
+                             ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_TEMPERATURE | ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_ENGINE;
+      snapshots[i].powerCount = snapshots[i].frequencyCount = capacity;
+      snapshots[i].temperatureCount = snapshots[i].engineCount = capacity;
+      snapshots[i].memoryCount = capacity;
+      snapshots[i].pPower = &power[i * capacity];
+      snapshots[i].pFrequency = &frequency[i * capacity];
+      snapshots[i].pTemperature = &temperature[i * capacity];
+      snapshots[i].pEngine = &engine[i * capacity];
+    }
+  };
+
+  prepare();
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelSysmanGetSnapshot(static_cast<uint32_t>(snapshots.size()), snapshots.data()));
+  for (size_t i = 0; i < snapshots.size(); ++i) {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, snapshots[i].result);
+    EXPECT_EQ(1u, snapshots[i].powerCount);
+    EXPECT_EQ(2u, snapshots[i].frequencyCount);
+    EXPECT_EQ(2u, snapshots[i].temperatureCount);
+    EXPECT_EQ(2u, snapshots[i].engineCount);
+    // Not requested.
+    EXPECT_EQ(0u, snapshots[i].memoryCount);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, power[i * capacity].result);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, frequency[i * capacity + 1].result);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, temperature[i * capacity + 1].result);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, engine[i * capacity + 1].result);
+  }
+  EXPECT_FALSE(compare_env("zesPowerGetEnergyCounter", ""));
+
+  // Later snapshots read the counters of the cached components.
+  putenv_safe(const_cast<char *>("zesDeviceEnumPowerDomains=0"));
+  putenv_safe(const_cast<char *>("zesPowerGetEnergyCounter=0"));
+  prepare();
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelSysmanGetSnapshot(static_cast<uint32_t>(snapshots.size()), snapshots.data()));
+  EXPECT_TRUE(compare_env("zesDeviceEnumPowerDomains", "0"));
+  EXPECT_FALSE(compare_env("zesPowerGetEnergyCounter", "0"));
+
+  // Without arrays, only the number of components is returned.
+  zel_sysman_device_snapshot_t countOnly = {};
+  countOnly.hDevice = devices[0];
+  countOnly.domains = ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_MEMORY;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelSysmanGetSnapshot(1, &countOnly));
+  EXPECT_EQ(1u, countOnly.memoryCount);
+  EXPECT_EQ(0u, countOnly.powerCount);
+
+  EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, zelSysmanGetSnapshot(1, nullptr));
+  zel_sysman_device_snapshot_t nullDevice = {};
+  EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, zelSysmanGetSnapshot(1, &nullDevice));
+}
+
+TEST(
+  SysmanSnapshot,
+  GivenCachedComponentsWhenTheDeviceIsResetOrDriversAreInitializedAgainThenTheNextSnapshotEnumeratesThemAgain) {
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zesInit(0));
+  uint32_t driverCount = 0;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zesDriverGet(&driverCount, nullptr));
+  std::vector<zes_driver_handle_t> drivers(driverCount);
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zesDriverGet(&driverCount, drivers.data()));
+  std::vector<zes_device_handle_t> devices;
+  for (auto driver : drivers) {
+    uint32_t deviceCount = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceGet(driver, &deviceCount, nullptr));
+    std::vector<zes_device_handle_t> driverDevices(deviceCount);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceGet(driver, &deviceCount, driverDevices.data()));
+    devices.insert(devices.end(), driverDevices.begin(), driverDevices.end());
+  }
+  ASSERT_FALSE(devices.empty());
+
+  std::vector<zel_sysman_device_snapshot_t> snapshots(devices.size());
+  auto takeSnapshots = [&]() {
+    for (size_t i = 0; i < devices.size(); ++i) {
+      snapshots[i] = {};
+      snapshots[i].hDevice = devices[i];
+      snapshots[i].domains = ZEL_SYSMAN_SNAPSHOT_DOMAIN_FLAG_FREQUENCY;
+    }
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zelSysmanGetSnapshot(static_cast<uint32_t>(snapshots.size()), snapshots.data()));
+    for (const auto &snapshot : snapshots) {
+      EXPECT_EQ(2u, snapshot.frequencyCount);
+    }
+  };
+
+  // Repeated snapshots reuse the same workers and cached components.
+  takeSnapshots();
+  putenv_safe(const_cast<char *>("zesDeviceEnumFrequencyDomains=0"));
+  for (int i = 0; i < 100; ++i) {
+    takeSnapshots();
+  }
+  EXPECT_TRUE(compare_env("zesDeviceEnumFrequencyDomains", "0"));
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceReset(devices[0], false));
+  takeSnapshots();
+  EXPECT_FALSE(compare_env("zesDeviceEnumFrequencyDomains", "0"));
+
+  putenv_safe(const_cast<char *>("zesDeviceEnumFrequencyDomains=0"));
+  takeSnapshots();
+  EXPECT_TRUE(compare_env("zesDeviceEnumFrequencyDomains", "0"));
+
+  uint32_t initCount = 0;
+  ze_init_driver_type_desc_t desc = {ZE_STRUCTURE_TYPE_INIT_DRIVER_TYPE_DESC};
+  desc.flags = UINT32_MAX;
+  desc.pNext = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeInitDrivers(&initCount, nullptr, &desc));
+  takeSnapshots();
+  EXPECT_FALSE(compare_env("zesDeviceEnumFrequencyDomains", "0"));
+
+  putenv_safe(const_cast<char *>("zesDeviceEnumFrequencyDomains=0"));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zesInit(0));
+  takeSnapshots();
+  EXPECT_FALSE(compare_env("zesDeviceEnumFrequencyDomains", "0"));
+}
+
+TEST(
+  SysmanComponentHandles,
+  GivenLoaderInterceptsWhenEnumeratingComponentsRepeatedlyThenHandlesAreReturnedFromCacheUntilTheDeviceIsReset) {
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zesInit(0));
+  uint32_t driverCount = 0;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zesDriverGet(&driverCount, nullptr));
+  std::vector<zes_driver_handle_t> drivers(driverCount);
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zesDriverGet(&driverCount, drivers.data()));
+  std::vector<zes_device_handle_t> devices;
+  for (auto driver : drivers) {
+    uint32_t deviceCount = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceGet(driver, &deviceCount, nullptr));
+    std::vector<zes_device_handle_t> driverDevices(deviceCount);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceGet(driver, &deviceCount, driverDevices.data()));
+    devices.insert(devices.end(), driverDevices.begin(), driverDevices.end());
+  }
+  ASSERT_FALSE(devices.empty());
+
+  for (auto device : devices) {
+    uint32_t count = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceEnumFrequencyDomains(device, &count, nullptr));
+    ASSERT_EQ(2u, count);
+    std::vector<zes_freq_handle_t> first(count);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceEnumFrequencyDomains(device, &count, first.data()));
+    EXPECT_EQ(2u, count);
+
+    // Later enumerations of the device do not reach the driver.
+    putenv_safe(const_cast<char *>("zesDeviceEnumFrequencyDomains=0"));
+    count = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceEnumFrequencyDomains(device, &count, nullptr));
+    EXPECT_EQ(2u, count);
+    count = 4;
+    std::vector<zes_freq_handle_t> second(count);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceEnumFrequencyDomains(device, &count, second.data()));
+    EXPECT_EQ(2u, count);
+    EXPECT_EQ(first[0], second[0]);
+    EXPECT_EQ(first[1], second[1]);
+    count = 1;
+    zes_freq_handle_t one = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceEnumFrequencyDomains(device, &count, &one));
+    EXPECT_EQ(1u, count);
+    EXPECT_EQ(first[0], one);
+    EXPECT_TRUE(compare_env("zesDeviceEnumFrequencyDomains", "0"));
+
+    // The cached handles are still usable.
+    zes_freq_properties_t properties = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesFrequencyGetProperties(second[1], &properties));
+
+    // A reset drops the components of the device.
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceReset(device, false));
+    count = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceEnumFrequencyDomains(device, &count, nullptr));
+    EXPECT_EQ(2u, count);
+    EXPECT_FALSE(compare_env("zesDeviceEnumFrequencyDomains", "0"));
+  }
+}
+
+TEST(
+  SysmanSampler,
+  GivenPowerDomainsAndEngineGroupsWhenSamplingThenRatesFollowTheCounters) {
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zesInit(0));
+  uint32_t driverCount = 0;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zesDriverGet(&driverCount, nullptr));
+  std::vector<zes_driver_handle_t> drivers(driverCount);
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zesDriverGet(&driverCount, drivers.data()));
+  std::vector<zes_pwr_handle_t> power;
+  std::vector<zes_engine_handle_t> engines;
+  for (auto driver : drivers) {
+    uint32_t deviceCount = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceGet(driver, &deviceCount, nullptr));
+    std::vector<zes_device_handle_t> devices(deviceCount);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceGet(driver, &deviceCount, devices.data()));
+    for (auto device : devices) {
+      uint32_t count = 0;
+      EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceEnumPowerDomains(device, &count, nullptr));
+      std::vector<zes_pwr_handle_t> devicePower(count);
+      EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceEnumPowerDomains(device, &count, devicePower.data()));
+      power.insert(power.end(), devicePower.begin(), devicePower.end());
+      count = 0;
+      EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceEnumEngineGroups(device, &count, nullptr));
+      std::vector<zes_engine_handle_t> deviceEngines(count);
+      EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceEnumEngineGroups(device, &count, deviceEngines.data()));
+      engines.insert(engines.end(), deviceEngines.begin(), deviceEngines.end());
+    }
+  }
+  ASSERT_FALSE(power.empty());
+  ASSERT_FALSE(engines.empty());
+
+  zel_sysman_sampler_desc_t desc = {};
+  desc.periodUs = 1000;
+  desc.historyLength = 256;
+  desc.powerCount = static_cast<uint32_t>(power.size());
+  desc.phPower = power.data();
+  desc.engineCount = static_cast<uint32_t>(engines.size());
+  desc.phEngine = engines.data();
+  zel_sysman_sampler_handle_t sampler = nullptr;
+  ze_result_t result = zelSysmanSamplerCreate(&desc, &sampler);
+#ifdef _WIN32
+  if (ZE_RESULT_ERROR_UNSUPPORTED_FEATURE == result) {
+    GTEST_SKIP() << "sysman sampler is not available in the Windows DLL build";
+  }
+#endif
+  ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+  ASSERT_NE(nullptr, sampler);
+
+  // The null driver draws 25 W per power domain and keeps every engine group
+  // busy 40% of the time.
+  const uint64_t windowNs = 1000000000;
+  std::vector<zel_sysman_sampler_rate_t> powerRates(power.size());
+  std::vector<zel_sysman_sampler_rate_t> engineRates(engines.size());
+  for (int retry = 0; retry < 200; ++retry) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zelSysmanSamplerGetPowerRates(sampler, windowNs, desc.powerCount, powerRates.data()));
+    if (powerRates.back().sampleCount >= 10) {
+      break;
+    }
+  }
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelSysmanSamplerGetEngineRates(sampler, windowNs, desc.engineCount, engineRates.data()));
+  for (auto &rate : powerRates) {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, rate.result);
+    EXPECT_GE(rate.sampleCount, 10u);
+    EXPECT_LT(rate.startNs, rate.endNs);
+    EXPECT_NEAR(25.0, rate.value, 0.5);
+  }
+  for (auto &rate : engineRates) {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, rate.result);
+    EXPECT_GE(rate.sampleCount, 2u);
+    EXPECT_NEAR(40.0, rate.value, 1.0);
+  }
+
+  // A window too short to hold two samples has no rate.
+  zel_sysman_sampler_rate_t rate = {};
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelSysmanSamplerGetPowerRates(sampler, 1, 1, &rate));
+  EXPECT_EQ(ZE_RESULT_NOT_READY, rate.result);
+  EXPECT_EQ(ZE_RESULT_ERROR_INVALID_SIZE,
+            zelSysmanSamplerGetEngineRates(sampler, windowNs, desc.engineCount + 1, engineRates.data()));
+  EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, zelSysmanSamplerGetPowerRates(sampler, windowNs, 1, nullptr));
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelSysmanSamplerDestroy(sampler));
+  EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, zelSysmanSamplerDestroy(nullptr));
+
+  zel_sysman_sampler_desc_t empty = {};
+  EXPECT_EQ(ZE_RESULT_ERROR_INVALID_SIZE, zelSysmanSamplerCreate(&empty, &sampler));
+  EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, zelSysmanSamplerCreate(&desc, nullptr));
+}
+
+// The sampler is left running when the process exits: the loader must stop
+// it before the loader context and the drivers it samples through go away.
+TEST(
+  SysmanSampler,
+  GivenASamplerThatIsNeverDestroyedWhenTheProcessExitsThenItIsStoppedBeforeTheLoaderIsTornDown) {
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zesInit(0));
+  uint32_t driverCount = 0;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zesDriverGet(&driverCount, nullptr));
+  std::vector<zes_driver_handle_t> drivers(driverCount);
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zesDriverGet(&driverCount, drivers.data()));
+  ASSERT_FALSE(drivers.empty());
+  uint32_t deviceCount = 0;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceGet(drivers[0], &deviceCount, nullptr));
+  std::vector<zes_device_handle_t> devices(deviceCount);
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceGet(drivers[0], &deviceCount, devices.data()));
+  ASSERT_FALSE(devices.empty());
+  uint32_t count = 0;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceEnumPowerDomains(devices[0], &count, nullptr));
+  std::vector<zes_pwr_handle_t> power(count);
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceEnumPowerDomains(devices[0], &count, power.data()));
+  ASSERT_FALSE(power.empty());
+
+  zel_sysman_sampler_desc_t desc = {};
+  desc.periodUs = 1;
+  desc.powerCount = static_cast<uint32_t>(power.size());
+  desc.phPower = power.data();
+  // Several samplers, so that one is likely to be mid-read at unload.
+  for (int i = 0; i < 8; ++i) {
+    zel_sysman_sampler_handle_t sampler = nullptr;
+    ze_result_t result = zelSysmanSamplerCreate(&desc, &sampler);
+#ifdef _WIN32
+    if (ZE_RESULT_ERROR_UNSUPPORTED_FEATURE == result) {
+      GTEST_SKIP() << "sysman sampler is not available in the Windows DLL build";
+    }
+#endif
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+  }
+}
+
 
 
 class CaptureOutput {
@@ -10,11 +10,20 @@
 #include "loader/ze_loader.h"
 #include "ze_api.h"
 #include "zer_api.h"
+#include "source/utils/ze_binary_trace.h"
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
 
 #if defined(_WIN32)
 #define putenv_safe _putenv
 #else
 #define putenv_safe putenv
+#include <unistd.h>
 #endif
 
 TEST(
@@ -583,6 +592,145 @@ TEST(
     EXPECT_EQ(ZE_RESULT_SUCCESS, status);
 }
 
+TEST(
+    LoaderValidation,
+    GivenLevelZeroLoaderPresentWhenReusingEventsAcrossManyCommandListResetsThenValidationLayerStaysQuietAndStillPrintsWarningOfDeadlock) {
+
+    uint32_t pCount = 0;
+    ze_init_driver_type_desc_t desc = {ZE_STRUCTURE_TYPE_INIT_DRIVER_TYPE_DESC};
+    desc.flags = UINT32_MAX;
+    desc.pNext = nullptr;
+    putenv_safe(const_cast<char *>("ZEL_TEST_NULL_DRIVER_TYPE=GPU"));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInit(ZE_INIT_FLAG_GPU_ONLY));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInitDrivers(&pCount, nullptr, &desc));
+    EXPECT_GT(pCount, 0);
+
+    ze_result_t status;
+
+    uint32_t driverCount = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, nullptr));
+    std::vector<ze_driver_handle_t> drivers(driverCount);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, drivers.data()));
+    ASSERT_GT(driverCount, 0u);
+    ze_driver_handle_t pDriver = drivers[0];
+
+    uint32_t deviceCount = 1;
+    ze_device_handle_t pDevice = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDeviceGet(pDriver, &deviceCount, &pDevice));
+    ASSERT_NE(pDevice, nullptr);
+
+    ze_context_handle_t context;
+    ze_context_desc_t context_desc = {};
+    context_desc.stype = ZE_STRUCTURE_TYPE_CONTEXT_DESC;
+    status = zeContextCreate(pDriver, &context_desc, &context);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+
+    ze_command_list_desc_t altdesc = {};
+    altdesc.stype = ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC;
+    ze_command_list_handle_t command_list = {};
+    status = zeCommandListCreate(context, pDevice, &altdesc, &command_list);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+
+    ze_event_pool_desc_t ep_desc = {};
+    ep_desc.stype = ZE_STRUCTURE_TYPE_EVENT_POOL_DESC;
+    ep_desc.count = 3;
+    ep_desc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    ze_event_pool_handle_t event_pool;
+    status = zeEventPoolCreate(context, &ep_desc, 1, &pDevice, &event_pool);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+
+    std::vector<ze_event_handle_t> event(3);
+    ze_event_desc_t ev_desc = {};
+    ev_desc.stype = ZE_STRUCTURE_TYPE_EVENT_DESC;
+    ev_desc.signal = ZE_EVENT_SCOPE_FLAG_DEVICE;
+    ev_desc.wait = ZE_EVENT_SCOPE_FLAG_HOST;
+    for (uint32_t i = 0; i < 3; ++i) {
+        ev_desc.index = i;
+        status = zeEventCreate(event_pool, &ev_desc, &event[i]);
+        EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+    }
+
+    ze_host_mem_alloc_desc_t host_desc = {};
+    host_desc.stype = ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC;
+    size_t buffer_size = 1024;
+    void *host_mem_ptr = nullptr;
+    status = zeMemAllocHost(context, &host_desc, buffer_size, 1, &host_mem_ptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+
+    ze_device_mem_alloc_desc_t device_desc = {};
+    device_desc.stype = ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC;
+    void *device_mem_ptr = nullptr;
+    status = zeMemAllocDevice(context, &device_desc, buffer_size, 0, pDevice, &device_mem_ptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+
+    std::stringstream capture;
+    std::streambuf *old_cerr_buf = std::cerr.rdbuf();
+    std::streambuf *old_cout_buf = std::cout.rdbuf();
+    std::cerr.rdbuf(capture.rdbuf());
+    std::cout.rdbuf(capture.rdbuf());
+
+    // Enough iterations for the events checker to retire and compact its DAG several times.
+    for (uint32_t iteration = 0; iteration < 2048; ++iteration) {
+        // A chain event[0] -> event[1] -> event[2], followed by a wait that signals nothing.
+        status = zeCommandListAppendMemoryCopy(command_list, device_mem_ptr, host_mem_ptr, buffer_size, event[0], 0, nullptr);
+        EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+        status = zeCommandListAppendMemoryCopy(command_list, device_mem_ptr, host_mem_ptr, buffer_size, event[1], 1, &event[0]);
+        EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+        status = zeCommandListAppendMemoryCopy(command_list, device_mem_ptr, host_mem_ptr, buffer_size, event[2], 1, &event[1]);
+        EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+        status = zeCommandListAppendWaitOnEvents(command_list, 1, &event[2]);
+        EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+
+        if (iteration % 2 == 0) {
+            for (auto hEvent : event) {
+                status = zeEventHostReset(hEvent);
+                EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+            }
+        }
+        status = zeCommandListReset(command_list);
+        EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+    }
+
+    std::cerr.rdbuf(old_cerr_buf);
+    std::cout.rdbuf(old_cout_buf);
+    EXPECT_EQ(capture.str(), "");
+
+    capture.str("");
+    capture.clear();
+    old_cerr_buf = std::cerr.rdbuf();
+    old_cout_buf = std::cout.rdbuf();
+    std::cerr.rdbuf(capture.rdbuf());
+    std::cout.rdbuf(capture.rdbuf());
+
+    // The retired history must not hide a real cycle among the live actions.
+    status = zeCommandListAppendMemoryCopy(command_list, device_mem_ptr, host_mem_ptr, buffer_size, event[0], 1, &event[2]);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+    status = zeCommandListAppendMemoryCopy(command_list, device_mem_ptr, host_mem_ptr, buffer_size, event[1], 1, &event[0]);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+    status = zeCommandListAppendMemoryCopy(command_list, device_mem_ptr, host_mem_ptr, buffer_size, event[2], 1, &event[1]);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+
+    std::cerr.rdbuf(old_cerr_buf);
+    std::cout.rdbuf(old_cout_buf);
+    auto found = capture.str().find("Warning: There may be a potential event deadlock");
+    EXPECT_NE(found, std::string::npos);
+
+    status = zeMemFree(context, host_mem_ptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+    status = zeMemFree(context, device_mem_ptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+    for (auto hEvent : event) {
+        status = zeEventDestroy(hEvent);
+        EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+    }
+    status = zeEventPoolDestroy(event_pool);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+    status = zeCommandListDestroy(command_list);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+    status = zeContextDestroy(context);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+}
+
   TEST(
       RuntimeApiParameterValidation,
       GivenLevelZeroLoaderPresentWhenCallingZerApiWithParameterValidationEnabledThenExpectValidationsAreTriggered)
@@ -1056,3 +1204,359 @@ TEST(
     uint32_t deviceCount = 0;
     EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, zeDeviceGet(nullptr, &deviceCount, nullptr));
 }
+
+// With ZEL_VALIDATION_SAMPLE_PERIOD=4, parameter checks run on the first of
+// every four calls to an API.  Handle tracking still sees every call, so
+// contexts created on unsampled calls can be destroyed normally.
+TEST(
+    ValidationLayerSampling,
+    GivenSamplePeriodWhenRepeatingAnInvalidCallThenOnlySampledCallsAreRejected) {
+
+    ze_init_driver_type_desc_t driverTypeDesc = {};
+    driverTypeDesc.stype = ZE_STRUCTURE_TYPE_INIT_DRIVER_TYPE_DESC;
+    driverTypeDesc.pNext = nullptr;
+    driverTypeDesc.flags = UINT32_MAX;
+
+    uint32_t count = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInitDrivers(&count, nullptr, &driverTypeDesc));
+    EXPECT_GT(count, 0);
+    std::vector<ze_driver_handle_t> drivers(count);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInitDrivers(&count, drivers.data(), &driverTypeDesc));
+
+    ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    contextDesc.flags = 0x2; // not a valid ze_context_flags_t bit
+
+    uint32_t rejected = 0;
+    std::vector<ze_context_handle_t> contexts;
+    for (int i = 0; i < 8; ++i) {
+        ze_context_handle_t context = nullptr;
+        const ze_result_t result = zeContextCreate(drivers[0], &contextDesc, &context);
+        if (result == ZE_RESULT_ERROR_INVALID_ENUMERATION) {
+            EXPECT_EQ(0, i % 4);
+            rejected++;
+        } else {
+            EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+            contexts.push_back(context);
+        }
+    }
+    EXPECT_EQ(2u, rejected);
+
+    for (auto context : contexts) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+    }
+}
+
+// The events checker reads the wait list of every append, so with it enabled
+// parameter validation must run on unsampled calls too.  Otherwise the null
+// wait list below reaches the checker on the second call.
+TEST(
+    ValidationLayerSampling,
+    GivenSamplePeriodAndEventsCheckerWhenAppendingWithNullWaitListThenEveryCallIsRejected) {
+
+    ze_init_driver_type_desc_t driverTypeDesc = {};
+    driverTypeDesc.stype = ZE_STRUCTURE_TYPE_INIT_DRIVER_TYPE_DESC;
+    driverTypeDesc.pNext = nullptr;
+    driverTypeDesc.flags = UINT32_MAX;
+
+    uint32_t count = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInitDrivers(&count, nullptr, &driverTypeDesc));
+    EXPECT_GT(count, 0);
+    std::vector<ze_driver_handle_t> drivers(count);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInitDrivers(&count, drivers.data(), &driverTypeDesc));
+
+    uint32_t deviceCount = 1;
+    ze_device_handle_t device = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDeviceGet(drivers[0], &deviceCount, &device));
+
+    ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    ze_context_handle_t context = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextCreate(drivers[0], &contextDesc, &context));
+
+    ze_command_list_desc_t commandListDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC};
+    ze_command_list_handle_t commandList = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListCreate(context, device, &commandListDesc, &commandList));
+
+    ze_event_pool_desc_t eventPoolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
+    eventPoolDesc.count = 1;
+    ze_event_pool_handle_t eventPool = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventPoolCreate(context, &eventPoolDesc, 1, &device, &eventPool));
+
+    ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+    ze_event_handle_t event = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventCreate(eventPool, &eventDesc, &event));
+
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(ZE_RESULT_ERROR_INVALID_SIZE,
+                  zeCommandListAppendBarrier(commandList, nullptr, 1, nullptr));
+    }
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventDestroy(event));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventPoolDestroy(eventPool));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListDestroy(commandList));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+}
+
+// With ZEL_LOADER_BINARY_TRACE_FILE set, the validation layer appends every
+// call to the memory-mapped binary trace in addition to (or instead of) the
+// text log.  The file is shared-mapped, so it can be inspected while the
+// layer still has it open.
+TEST(
+    ValidationLayerBinaryTrace,
+    GivenBinaryTraceFileWhenCallingApisThenCallsAreRecordedInTheTraceFile) {
+
+    const char *tracePath = getenv("ZEL_LOADER_BINARY_TRACE_FILE");
+    ASSERT_NE(nullptr, tracePath);
+
+    ze_init_driver_type_desc_t driverTypeDesc = {};
+    driverTypeDesc.stype = ZE_STRUCTURE_TYPE_INIT_DRIVER_TYPE_DESC;
+    driverTypeDesc.pNext = nullptr;
+    driverTypeDesc.flags = UINT32_MAX;
+
+    uint32_t count = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInitDrivers(&count, nullptr, &driverTypeDesc));
+    EXPECT_GT(count, 0);
+
+    uint32_t driverCount = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, nullptr));
+    std::vector<ze_driver_handle_t> drivers(driverCount);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, drivers.data()));
+
+    uint32_t deviceCount = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDeviceGet(drivers[0], &deviceCount, nullptr));
+
+    std::ifstream in(tracePath, std::ios::binary);
+    ASSERT_TRUE(in.good());
+    const std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    ASSERT_GE(data.size(), sizeof(loader::BinaryTraceFileHeader));
+
+    loader::BinaryTraceFileHeader header;
+    std::memcpy(static_cast<void *>(&header), data.data(), sizeof(header));
+    EXPECT_EQ(0, std::memcmp(header.magic, loader::BinaryTraceMagic, sizeof(header.magic)));
+    EXPECT_GE(header.nextRecord.load(), 3u);
+    EXPECT_GT(header.apiCount.load(), 0u);
+
+    const std::string names = data.substr(header.nameTableOffset, header.nameTableUsed.load());
+    EXPECT_NE(std::string::npos, names.find(std::string("zeDeviceGet") + '\0'));
+}
+
+// With ZEL_SYSTEM_RESOURCE_TRACKER_SAMPLE_INTERVAL_MS set, the system resource
+// tracker only queues CSV rows on the API call; its sampler thread writes them
+// to the per-process CSV file in batches.
+TEST(
+    SystemResourceTrackerSampling,
+    GivenSampleIntervalWhenCallingTrackedApisThenCsvRowsAreWrittenByTheSampler) {
+#if defined(_WIN32)
+    GTEST_SKIP() << "Sampled mode is only available on Linux";
+#else
+    const char *csvPath = getenv("ZEL_SYSTEM_RESOURCE_TRACKER_CSV");
+    ASSERT_NE(nullptr, csvPath);
+    std::string processCsvPath(csvPath);
+    processCsvPath.insert(processCsvPath.find_last_of('.'), "_pid" + std::to_string(getpid()));
+
+    ze_init_driver_type_desc_t driverTypeDesc = {};
+    driverTypeDesc.stype = ZE_STRUCTURE_TYPE_INIT_DRIVER_TYPE_DESC;
+    driverTypeDesc.pNext = nullptr;
+    driverTypeDesc.flags = UINT32_MAX;
+
+    uint32_t count = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInitDrivers(&count, nullptr, &driverTypeDesc));
+    EXPECT_GT(count, 0);
+    std::vector<ze_driver_handle_t> drivers(count);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInitDrivers(&count, drivers.data(), &driverTypeDesc));
+
+    ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    for (int i = 0; i < 4; ++i) {
+        ze_context_handle_t context = nullptr;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextCreate(drivers[0], &contextDesc, &context));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+    }
+
+    // Give the sampler a few intervals to write the batch.
+    std::string csv;
+    for (int attempt = 0; attempt < 100; ++attempt) {
+        std::ifstream in(processCsvPath);
+        ASSERT_TRUE(in.good()) << processCsvPath;
+        csv.assign((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        if (csv.find("\n7,") != std::string::npos && csv.back() == '\n') {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    EXPECT_EQ(0u, csv.find("CallNumber,TimeMs,APICall,"));
+    size_t rows = 0;
+    for (size_t pos = csv.find("zeContextCreate"); pos != std::string::npos; pos = csv.find("zeContextCreate", pos + 1)) {
+        rows++;
+    }
+    EXPECT_EQ(4u, rows);
+    EXPECT_NE(std::string::npos, csv.find("\n0,"));
+    EXPECT_NE(std::string::npos, csv.find("\n7,"));
+#endif
+}
+
+// Sampled-mode rows go through a bounded queue that API threads push to
+// without a lock; rows of concurrent threads must all arrive, each with its
+// own call number.
+TEST(
+    SystemResourceTrackerSampling,
+    GivenSampleIntervalWhenCallingTrackedApisFromManyThreadsThenEveryRowIsWrittenOnce) {
+#if defined(_WIN32)
+    GTEST_SKIP() << "Sampled mode is only available on Linux";
+#else
+    const char *csvPath = getenv("ZEL_SYSTEM_RESOURCE_TRACKER_CSV");
+    ASSERT_NE(nullptr, csvPath);
+    std::string processCsvPath(csvPath);
+    processCsvPath.insert(processCsvPath.find_last_of('.'), "_pid" + std::to_string(getpid()));
+
+    ze_init_driver_type_desc_t driverTypeDesc = {};
+    driverTypeDesc.stype = ZE_STRUCTURE_TYPE_INIT_DRIVER_TYPE_DESC;
+    driverTypeDesc.pNext = nullptr;
+    driverTypeDesc.flags = UINT32_MAX;
+
+    uint32_t count = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInitDrivers(&count, nullptr, &driverTypeDesc));
+    EXPECT_GT(count, 0);
+    std::vector<ze_driver_handle_t> drivers(count);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInitDrivers(&count, drivers.data(), &driverTypeDesc));
+
+    // Fewer rows than the queue holds, so none is dropped even if the
+    // sampler does not run until the end.
+    const size_t threadCount = 8;
+    const size_t callsPerThread = 100;
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&]() {
+            ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+            for (size_t i = 0; i < callsPerThread; ++i) {
+                ze_context_handle_t context = nullptr;
+                EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextCreate(drivers[0], &contextDesc, &context));
+                EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    const size_t expectedRows = 2 * threadCount * callsPerThread;
+    std::vector<std::string> lines;
+    for (int attempt = 0; attempt < 200; ++attempt) {
+        std::ifstream in(processCsvPath);
+        ASSERT_TRUE(in.good()) << processCsvPath;
+        lines.clear();
+        std::string line;
+        std::getline(in, line); // header
+        while (std::getline(in, line)) {
+            lines.push_back(line);
+        }
+        if (lines.size() >= expectedRows) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    // Rows are numbered as they are queued, so they are written in order.
+    ASSERT_EQ(expectedRows, lines.size());
+    for (size_t i = 0; i < lines.size(); ++i) {
+        EXPECT_EQ(i, std::stoul(lines[i].substr(0, lines[i].find(',')))) << lines[i];
+    }
+#endif
+}
+
+TEST(
+    MemoryProfilerChecker,
+    GivenMemoryProfilerEnabledWhenAllocatingAndFreeingRepeatedlyThenCallsSucceed) {
+    ze_init_driver_type_desc_t driverTypeDesc = {};
+    driverTypeDesc.stype = ZE_STRUCTURE_TYPE_INIT_DRIVER_TYPE_DESC;
+    driverTypeDesc.pNext = nullptr;
+    driverTypeDesc.flags = UINT32_MAX;
+
+    uint32_t count = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInitDrivers(&count, nullptr, &driverTypeDesc));
+    EXPECT_GT(count, 0);
+    std::vector<ze_driver_handle_t> drivers(count);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInitDrivers(&count, drivers.data(), &driverTypeDesc));
+
+    uint32_t deviceCount = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDeviceGet(drivers[0], &deviceCount, nullptr));
+    EXPECT_GT(deviceCount, 0);
+    std::vector<ze_device_handle_t> devices(deviceCount);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDeviceGet(drivers[0], &deviceCount, devices.data()));
+
+    ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    ze_context_handle_t context = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextCreate(drivers[0], &contextDesc, &context));
+
+    ze_host_mem_alloc_desc_t hostDesc = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC};
+    ze_device_mem_alloc_desc_t deviceDesc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+    std::vector<void *> live;
+    for (int i = 0; i < 64; ++i) {
+        void *hostMem = nullptr;
+        void *deviceMem = nullptr;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemAllocHost(context, &hostDesc, 4096, 1, &hostMem));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemAllocDevice(context, &deviceDesc, size_t(64) << (i % 8), 0, devices[0], &deviceMem));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemFree(context, hostMem));
+        live.push_back(deviceMem);
+        if (i % 16 == 15) {
+            // Let the periodic report fire from the next call.
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    }
+    for (void *ptr : live) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemFree(context, ptr));
+    }
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+}
+
+TEST(
+    PerformanceChecker,
+    GivenPerformanceCheckerEnabledWhenRepeatingAntiPatternsThenCallsSucceed) {
+    ze_init_driver_type_desc_t driverTypeDesc = {};
+    driverTypeDesc.stype = ZE_STRUCTURE_TYPE_INIT_DRIVER_TYPE_DESC;
+    driverTypeDesc.pNext = nullptr;
+    driverTypeDesc.flags = UINT32_MAX;
+
+    uint32_t count = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInitDrivers(&count, nullptr, &driverTypeDesc));
+    EXPECT_GT(count, 0);
+    std::vector<ze_driver_handle_t> drivers(count);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInitDrivers(&count, drivers.data(), &driverTypeDesc));
+
+    uint32_t deviceCount = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDeviceGet(drivers[0], &deviceCount, nullptr));
+    EXPECT_GT(deviceCount, 0);
+    std::vector<ze_device_handle_t> devices(deviceCount);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDeviceGet(drivers[0], &deviceCount, devices.data()));
+
+    ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    ze_context_handle_t context = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextCreate(drivers[0], &contextDesc, &context));
+
+    ze_command_queue_desc_t queueDesc = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC};
+    queueDesc.flags = ZE_COMMAND_QUEUE_FLAG_IN_ORDER | ZE_COMMAND_QUEUE_FLAG_COPY_OFFLOAD_HINT;
+    ze_command_list_handle_t immediate = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListCreateImmediate(context, devices[0], &queueDesc, &immediate));
+
+    ze_host_mem_alloc_desc_t hostDesc = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC};
+    ze_event_pool_desc_t poolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
+    poolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    poolDesc.count = 1;
+    for (int i = 0; i < 32; ++i) {
+        // Allocate, copy a few bytes, wait and free on every iteration.
+        void *src = nullptr;
+        void *dst = nullptr;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemAllocHost(context, &hostDesc, 64, 1, &src));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemAllocHost(context, &hostDesc, 64, 1, &dst));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendMemoryCopy(immediate, dst, src, 64, nullptr, 0, nullptr));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListHostSynchronize(immediate, UINT64_MAX));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemFree(context, src));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemFree(context, dst));
+
+        ze_event_pool_handle_t pool = nullptr;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventPoolCreate(context, &poolDesc, 1, &devices[0], &pool));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventPoolDestroy(pool));
+    }
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListDestroy(immediate));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+}
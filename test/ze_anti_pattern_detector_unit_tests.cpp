@@ -0,0 +1,196 @@
+/*
+ *
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Standalone unit tests for validation_layer::AntiPatternDetector, the
+// counters behind the validation layer's performance checker.
+
+#include "gtest/gtest.h"
+
+#include "anti_pattern_detector.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using validation_layer::AntiPattern;
+using validation_layer::AntiPatternDetector;
+using validation_layer::AntiPatternFinding;
+
+namespace {
+
+const void *fakeHandle(uintptr_t i) {
+    return reinterpret_cast<const void *>(0x10000 + i * 64);
+}
+
+std::vector<AntiPatternFinding> findingsFor(const AntiPatternDetector &detector, AntiPattern pattern) {
+    std::vector<AntiPatternFinding> result;
+    for (const auto &finding : detector.findings()) {
+        if (finding.pattern == pattern) {
+            result.push_back(finding);
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+TEST(AntiPatternDetector, GivenMostlySmallCopiesThenOneFindingIsReportedForTheCommandList) {
+    AntiPatternDetector detector;
+    const void *list = fakeHandle(1);
+    detector.commandListCreated(list, false);
+    for (int i = 0; i < 30; ++i) {
+        detector.memoryCopyAppended(list, 64);
+    }
+    detector.memoryCopyAppended(list, 1 << 20);
+
+    auto findings = findingsFor(detector, AntiPattern::SmallCopy);
+    ASSERT_EQ(1u, findings.size());
+    EXPECT_EQ(list, findings[0].site);
+    EXPECT_EQ(30u, findings[0].count);
+    EXPECT_EQ(31u, findings[0].total);
+
+    // Counters survive the command list and still produce one finding.
+    detector.commandListDestroyed(list);
+    findings = findingsFor(detector, AntiPattern::SmallCopy);
+    ASSERT_EQ(1u, findings.size());
+    EXPECT_EQ(30u, findings[0].count);
+    EXPECT_NE(std::string::npos, detector.describe(findings[0]).find("30 of 31 zeCommandListAppendMemoryCopy"));
+}
+
+TEST(AntiPatternDetector, GivenFewOrMostlyLargeCopiesThenNothingIsReported) {
+    AntiPatternDetector detector;
+    const void *list = fakeHandle(1);
+    for (int i = 0; i < 5; ++i) {
+        detector.memoryCopyAppended(list, 64);
+    }
+    const void *other = fakeHandle(2);
+    for (int i = 0; i < 20; ++i) {
+        detector.memoryCopyAppended(other, 64);
+    }
+    for (int i = 0; i < 100; ++i) {
+        detector.memoryCopyAppended(other, 1 << 20);
+    }
+    EXPECT_TRUE(detector.findings().empty());
+}
+
+TEST(AntiPatternDetector, GivenRepeatedGroupSizeCallsThenKernelFindingsAreReported) {
+    AntiPatternDetector detector;
+    const void *kernel = fakeHandle(3);
+    for (int i = 0; i < 12; ++i) {
+        detector.groupSizeSuggested(kernel, 1024, 1, 1);
+        detector.groupSizeSet(kernel, 64, 1, 1);
+    }
+    detector.kernelDestroyed(kernel);
+
+    auto sets = findingsFor(detector, AntiPattern::RepeatedSetGroupSize);
+    ASSERT_EQ(1u, sets.size());
+    EXPECT_EQ(11u, sets[0].count);
+    EXPECT_EQ(12u, sets[0].total);
+    auto suggests = findingsFor(detector, AntiPattern::RepeatedSuggestGroupSize);
+    ASSERT_EQ(1u, suggests.size());
+    EXPECT_EQ(11u, suggests[0].count);
+}
+
+TEST(AntiPatternDetector, GivenHostSyncAfterEveryAppendOnImmediateListThenFindingIsReported) {
+    AntiPatternDetector detector;
+    const void *immediate = fakeHandle(4);
+    const void *regular = fakeHandle(5);
+    detector.commandListCreated(immediate, true);
+    detector.commandListCreated(regular, false);
+    for (int i = 0; i < 10; ++i) {
+        detector.commandAppended(immediate);
+        detector.hostSynchronized(immediate);
+        detector.commandAppended(regular);
+        detector.hostSynchronized(regular);
+    }
+    // Batched work followed by one wait is fine.
+    for (int i = 0; i < 8; ++i) {
+        detector.commandAppended(immediate);
+    }
+    detector.hostSynchronized(immediate);
+
+    auto findings = findingsFor(detector, AntiPattern::SyncAfterEveryAppend);
+    ASSERT_EQ(1u, findings.size());
+    EXPECT_EQ(immediate, findings[0].site);
+    EXPECT_EQ(10u, findings[0].count);
+    EXPECT_EQ(11u, findings[0].total);
+}
+
+TEST(AntiPatternDetector, GivenSingleCommandListExecutedRepeatedlyThenFindingIsReported) {
+    AntiPatternDetector detector;
+    const void *single = fakeHandle(6);
+    const void *batched = fakeHandle(7);
+    detector.commandListCreated(single, false);
+    detector.commandListCreated(batched, false);
+    detector.commandAppended(single);
+    detector.commandListClosed(single);
+    detector.commandAppended(batched);
+    detector.commandAppended(batched);
+    detector.commandListClosed(batched);
+    const void *lists[] = {single, batched};
+    for (int i = 0; i < 10; ++i) {
+        detector.commandListsExecuted(lists, 2);
+    }
+
+    auto findings = findingsFor(detector, AntiPattern::SingleCommandList);
+    ASSERT_EQ(1u, findings.size());
+    EXPECT_EQ(single, findings[0].site);
+    EXPECT_EQ(10u, findings[0].count);
+
+    // After a reset the list holds two commands and stops counting.
+    detector.commandListReset(single);
+    detector.commandAppended(single);
+    detector.commandAppended(single);
+    detector.commandListClosed(single);
+    detector.commandListsExecuted(lists, 1);
+    EXPECT_EQ(10u, findingsFor(detector, AntiPattern::SingleCommandList)[0].count);
+}
+
+TEST(AntiPatternDetector, GivenAllocFreeAndEventPoolLoopsThenPerContextFindingsAreReported) {
+    AntiPatternDetector detector;
+    const void *context = fakeHandle(8);
+    for (uintptr_t i = 0; i < 12; ++i) {
+        const void *ptr = fakeHandle(100 + i);
+        detector.memoryAllocated(context, ptr, 4096);
+        detector.memoryFreed(ptr);
+        const void *pool = fakeHandle(200 + i);
+        detector.eventPoolCreated(context, pool, 1, 32);
+        detector.eventPoolDestroyed(pool);
+    }
+    // Long-lived allocations of another size do not count.
+    for (uintptr_t i = 0; i < 12; ++i) {
+        detector.memoryAllocated(context, fakeHandle(300 + i), 64);
+    }
+
+    auto allocs = findingsFor(detector, AntiPattern::AllocFreeLoop);
+    ASSERT_EQ(1u, allocs.size());
+    EXPECT_EQ(context, allocs[0].site);
+    EXPECT_EQ(4096u, allocs[0].detail);
+    EXPECT_EQ(11u, allocs[0].count);
+    EXPECT_EQ(12u, allocs[0].total);
+
+    auto pools = findingsFor(detector, AntiPattern::EventPoolChurn);
+    ASSERT_EQ(1u, pools.size());
+    EXPECT_EQ(11u, pools[0].count);
+    EXPECT_NE(std::string::npos, detector.describe(pools[0]).find("count 32 and flags 0x1"));
+}
+
+TEST(AntiPatternDetector, GivenLowerReportThresholdThenSmallerCountsAreReported) {
+    AntiPatternDetector::Config config;
+    config.reportThreshold = 2;
+    config.smallCopyBytes = 128;
+    AntiPatternDetector detector(config);
+    const void *list = fakeHandle(9);
+    detector.memoryCopyAppended(list, 64);
+    detector.memoryCopyAppended(list, 127);
+    detector.memoryCopyAppended(list, 128);
+
+    auto findings = findingsFor(detector, AntiPattern::SmallCopy);
+    ASSERT_EQ(1u, findings.size());
+    EXPECT_EQ(2u, findings[0].count);
+}
@@ -0,0 +1,221 @@
+/*
+ *
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Standalone unit tests for loader::BinaryTraceWriter and the reader used by
+// ze_trace_decode.  Links only level_zero_utils.
+
+#include "gtest/gtest.h"
+
+#include "ze_api.h"
+#include "ze_binary_trace.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+    #define putenv_safe _putenv
+#else
+    #define putenv_safe putenv
+#endif
+
+TEST(ZeBinaryTrace, GivenRecordedCallsWhenReadingTraceThenApisAndArgumentsRoundTrip) {
+    const std::string path = ::testing::TempDir() + "ze_binary_trace_roundtrip.bin";
+    int marker = 0;
+    {
+        loader::BinaryTraceWriter writer(path, 16);
+        ASSERT_TRUE(writer.isOpen());
+        const uint32_t id = writer.registerApi("zeFoo", "ze_device_handle_t hDevice,uint32_t count,int32_t delta");
+        writer.record(id, ZE_RESULT_ERROR_INVALID_ARGUMENT, reinterpret_cast<ze_device_handle_t>(&marker), 7u, -3);
+        writer.record(id, ZE_RESULT_SUCCESS, static_cast<ze_device_handle_t>(nullptr), 0u, 1);
+    }
+
+    loader::BinaryTraceContents contents;
+    std::string error;
+    ASSERT_TRUE(loader::readBinaryTrace(path, contents, error)) << error;
+    std::remove(path.c_str());
+
+    ASSERT_EQ(1u, contents.apis.size());
+    EXPECT_EQ("zeFoo", contents.apis[0].name);
+    ASSERT_EQ(3u, contents.apis[0].paramNames.size());
+    EXPECT_EQ("count", contents.apis[0].paramNames[1]);
+    EXPECT_EQ("uint32_t", contents.apis[0].paramTypes[1]);
+
+    ASSERT_EQ(2u, contents.entries.size());
+    const auto &first = contents.entries[0];
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, static_cast<ze_result_t>(first.result));
+    EXPECT_EQ(3u, first.argCount);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(&marker), first.args[0]);
+    EXPECT_EQ("7", loader::formatBinaryTraceArg("uint32_t", first.args[1]));
+    EXPECT_EQ("-3", loader::formatBinaryTraceArg("int32_t", first.args[2]));
+    EXPECT_EQ("nullptr", loader::formatBinaryTraceArg("ze_device_handle_t", contents.entries[1].args[0]));
+    EXPECT_LE(first.timestampNs, contents.entries[1].timestampNs);
+}
+
+TEST(ZeBinaryTrace, GivenMoreCallsThanRingCapacityWhenReadingTraceThenNewestRecordsAreKept) {
+    const std::string path = ::testing::TempDir() + "ze_binary_trace_wrap.bin";
+    {
+        loader::BinaryTraceWriter writer(path, 8);
+        ASSERT_TRUE(writer.isOpen());
+        const uint32_t id = writer.registerApi("zeBar", "uint64_t value");
+        for (uint64_t i = 0; i < 20; ++i) {
+            writer.record(id, ZE_RESULT_SUCCESS, i);
+        }
+    }
+
+    loader::BinaryTraceContents contents;
+    std::string error;
+    ASSERT_TRUE(loader::readBinaryTrace(path, contents, error)) << error;
+    std::remove(path.c_str());
+
+    EXPECT_EQ(20u, contents.totalRecorded);
+    ASSERT_EQ(8u, contents.entries.size());
+    for (uint64_t i = 0; i < 8; ++i) {
+        EXPECT_EQ(12 + i, contents.entries[i].args[0]);
+    }
+}
+
+TEST(ZeBinaryTrace, GivenConcurrentWritersWhenReadingTraceThenEveryRecordIsComplete) {
+    const std::string path = ::testing::TempDir() + "ze_binary_trace_threads.bin";
+    constexpr int threadCount = 4;
+    constexpr uint64_t perThread = 1000;
+    {
+        loader::BinaryTraceWriter writer(path, threadCount * perThread);
+        ASSERT_TRUE(writer.isOpen());
+        const uint32_t id = writer.registerApi("zeBaz", "uint64_t a,uint64_t b");
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threadCount; ++t) {
+            threads.emplace_back([&writer, id]() {
+                for (uint64_t i = 0; i < perThread; ++i) {
+                    writer.record(id, ZE_RESULT_SUCCESS, i, ~i);
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+
+    loader::BinaryTraceContents contents;
+    std::string error;
+    ASSERT_TRUE(loader::readBinaryTrace(path, contents, error)) << error;
+    std::remove(path.c_str());
+
+    ASSERT_EQ(threadCount * perThread, contents.entries.size());
+    for (const auto &entry : contents.entries) {
+        EXPECT_EQ(~entry.args[0], entry.args[1]);
+    }
+}
+
+// Each thread wraps the two-slot ring many times, so writers regularly meet
+// at one slot; a record must never mix the arguments of two calls.
+TEST(ZeBinaryTrace, GivenConcurrentWritersWrappingTheRingWhenReadingTraceThenNoRecordIsTorn) {
+    const std::string path = ::testing::TempDir() + "ze_binary_trace_wrap_threads.bin";
+    constexpr int threadCount = 8;
+    constexpr uint64_t perThread = 20000;
+    {
+        loader::BinaryTraceWriter writer(path, 2);
+        ASSERT_TRUE(writer.isOpen());
+        const uint32_t id = writer.registerApi("zeQux", "uint64_t a,uint64_t b,uint64_t c,uint64_t d");
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threadCount; ++t) {
+            threads.emplace_back([&writer, id, t]() {
+                const uint64_t tag = static_cast<uint64_t>(t) << 32;
+                for (uint64_t i = 0; i < perThread; ++i) {
+                    writer.record(id, ZE_RESULT_SUCCESS, tag | i, ~(tag | i), tag, ~tag);
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+
+    loader::BinaryTraceContents contents;
+    std::string error;
+    ASSERT_TRUE(loader::readBinaryTrace(path, contents, error)) << error;
+    std::remove(path.c_str());
+
+    EXPECT_EQ(threadCount * perThread, contents.totalRecorded);
+    EXPECT_GE(2u, contents.entries.size());
+    for (const auto &entry : contents.entries) {
+        EXPECT_EQ(~entry.args[0], entry.args[1]);
+        EXPECT_EQ(entry.args[0] & ~0xffffffffull, entry.args[2]);
+        EXPECT_EQ(~entry.args[2], entry.args[3]);
+    }
+}
+
+TEST(ZeBinaryTrace, GivenFlushedWriterWhenRecordingMoreCallsThenTheyAreStillRecorded) {
+    const std::string path = ::testing::TempDir() + "ze_binary_trace_flush.bin";
+    loader::BinaryTraceContents contents;
+    std::string error;
+    {
+        loader::BinaryTraceWriter writer(path, 8);
+        ASSERT_TRUE(writer.isOpen());
+        const uint32_t id = writer.registerApi("zeFlush", "uint64_t value");
+        writer.record(id, ZE_RESULT_SUCCESS, uint64_t(1));
+        writer.flush();
+        ASSERT_TRUE(loader::readBinaryTrace(path, contents, error)) << error;
+        EXPECT_EQ(1u, contents.entries.size());
+        writer.record(id, ZE_RESULT_SUCCESS, uint64_t(2));
+    }
+
+    ASSERT_TRUE(loader::readBinaryTrace(path, contents, error)) << error;
+    std::remove(path.c_str());
+    ASSERT_EQ(2u, contents.entries.size());
+    EXPECT_EQ(2u, contents.entries[1].args[0]);
+}
+
+TEST(ZeBinaryTrace, GivenOutOfRangeRecordCountsWhenCreatingWriterThenItIsClampedOrDefaulted) {
+    const std::string path = ::testing::TempDir() + "ze_binary_trace_env.bin";
+    static std::string fileEnv;
+    fileEnv = "ZEL_LOADER_BINARY_TRACE_FILE=" + path;
+    putenv_safe(const_cast<char *>(fileEnv.c_str()));
+
+    // -1 wraps to UINT64_MAX, which never rounds up to a power of two; the
+    // others would map far more than any trace needs.
+    const uint64_t headerSize = sizeof(loader::BinaryTraceFileHeader) + loader::BinaryTraceNameTableSize;
+    const struct {
+        const char *value;
+        uint64_t capacity;
+    } cases[] = {{"ZEL_LOADER_BINARY_TRACE_RECORDS=-1", 262144},
+                 {"ZEL_LOADER_BINARY_TRACE_RECORDS=0", 262144},
+                 {"ZEL_LOADER_BINARY_TRACE_RECORDS=99999999999999999999999", 262144},
+                 {"ZEL_LOADER_BINARY_TRACE_RECORDS=9223372036854775809", 1ull << 22}};
+    for (const auto &c : cases) {
+        putenv_safe(const_cast<char *>(c.value));
+        {
+            auto writer = loader::createBinaryTraceWriter();
+            ASSERT_NE(nullptr, writer) << c.value;
+        }
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        EXPECT_EQ(headerSize + c.capacity * sizeof(loader::BinaryTraceRecord),
+                  static_cast<uint64_t>(in.tellg())) << c.value;
+    }
+    std::remove(path.c_str());
+
+    putenv_safe(const_cast<char *>("ZEL_LOADER_BINARY_TRACE_RECORDS="));
+    putenv_safe(const_cast<char *>("ZEL_LOADER_BINARY_TRACE_FILE="));
+}
+
+TEST(ZeBinaryTrace, GivenFileThatIsNotATraceWhenReadingThenErrorIsReported) {
+    const std::string path = ::testing::TempDir() + "ze_binary_trace_bad.bin";
+    FILE *f = std::fopen(path.c_str(), "wb");
+    ASSERT_NE(nullptr, f);
+    std::fputs("not a trace", f);
+    std::fclose(f);
+
+    loader::BinaryTraceContents contents;
+    std::string error;
+    EXPECT_FALSE(loader::readBinaryTrace(path, contents, error));
+    EXPECT_FALSE(error.empty());
+    std::remove(path.c_str());
+}
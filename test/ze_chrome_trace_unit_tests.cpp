@@ -0,0 +1,186 @@
+/*
+ *
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Standalone unit tests for tracing_layer::ChromeTraceRecorder, the tracing
+// layer's built-in API timeline.
+
+#include "gtest/gtest.h"
+
+#include "tracing_chrome_trace.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+    #define putenv_safe _putenv
+#else
+    #define putenv_safe putenv
+#endif
+
+using tracing_layer::ChromeTraceRecorder;
+
+namespace {
+
+std::string readFile(const std::string &path) {
+    std::ifstream in(path);
+    return std::string((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+}
+
+size_t countOf(const std::string &text, const std::string &needle) {
+    size_t count = 0;
+    for (size_t pos = text.find(needle); pos != std::string::npos; pos = text.find(needle, pos + 1)) {
+        ++count;
+    }
+    return count;
+}
+
+} // namespace
+
+TEST(ZeChromeTrace, GivenRecordedCallsWhenWritingThenCompleteEventsAreEmitted) {
+    const std::string path = ::testing::TempDir() + "ze_chrome_trace_events.json";
+    ChromeTraceRecorder recorder(path, 16);
+    const uint64_t begin = ChromeTraceRecorder::nowNs() + 2000;
+    recorder.record("zeInit", begin, begin + 1500);
+    recorder.record("zeDriverGet", begin + 3000, begin + 3250);
+    ASSERT_TRUE(recorder.write());
+
+    const std::string json = readFile(path);
+    std::remove(path.c_str());
+    EXPECT_EQ(0u, json.find("{\"traceEvents\":["));
+    EXPECT_EQ(2u, countOf(json, "\"ph\":\"X\""));
+    EXPECT_NE(std::string::npos, json.find("\"name\":\"zeInit\""));
+    EXPECT_NE(std::string::npos, json.find("\"dur\":1.500}"));
+    EXPECT_NE(std::string::npos, json.find("\"dur\":0.250}"));
+    EXPECT_NE(std::string::npos, json.find("\"droppedEvents\":0"));
+}
+
+TEST(ZeChromeTrace, GivenFullThreadBufferWhenRecordingThenLaterCallsAreDropped) {
+    const std::string path = ::testing::TempDir() + "ze_chrome_trace_dropped.json";
+    ChromeTraceRecorder recorder(path, 4);
+    const uint64_t now = ChromeTraceRecorder::nowNs();
+    for (int i = 0; i < 10; ++i) {
+        recorder.record("zeCommandListAppendBarrier", now, now + 1);
+    }
+    EXPECT_EQ(6u, recorder.droppedEvents());
+    ASSERT_TRUE(recorder.write());
+
+    const std::string json = readFile(path);
+    std::remove(path.c_str());
+    EXPECT_EQ(4u, countOf(json, "zeCommandListAppendBarrier"));
+    EXPECT_NE(std::string::npos, json.find("\"droppedEvents\":6"));
+}
+
+TEST(ZeChromeTrace, GivenConcurrentThreadsWhenWritingThenEachThreadHasItsOwnTrack) {
+    const std::string path = ::testing::TempDir() + "ze_chrome_trace_threads.json";
+    constexpr int threadCount = 4;
+    constexpr int callsPerThread = 1000;
+    ChromeTraceRecorder recorder(path, callsPerThread);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&recorder]() {
+            for (int i = 0; i < callsPerThread; ++i) {
+                const uint64_t begin = ChromeTraceRecorder::nowNs();
+                recorder.record("zeEventHostSynchronize", begin, ChromeTraceRecorder::nowNs());
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(0u, recorder.droppedEvents());
+    ASSERT_TRUE(recorder.write());
+
+    const std::string json = readFile(path);
+    std::remove(path.c_str());
+    EXPECT_EQ(static_cast<size_t>(threadCount * callsPerThread), countOf(json, "\"ph\":\"X\""));
+}
+
+TEST(ZeChromeTrace, GivenMoreCallsThanOneChunkWhenWritingThenEveryEventIsEmittedInOrder) {
+    const std::string path = ::testing::TempDir() + "ze_chrome_trace_chunks.json";
+    // Crosses the growing chunks and ends inside a capped one.
+    constexpr size_t capacity = 10000;
+    ChromeTraceRecorder recorder(path, capacity);
+    // The duration of call i is i ns, which tells the calls apart.
+    const uint64_t begin = ChromeTraceRecorder::nowNs();
+    for (size_t i = 0; i < capacity + 5; ++i) {
+        recorder.record("zeCommandListAppendBarrier", begin, begin + i);
+    }
+    EXPECT_EQ(5u, recorder.droppedEvents());
+    ASSERT_TRUE(recorder.write());
+
+    const std::string json = readFile(path);
+    std::remove(path.c_str());
+    EXPECT_EQ(capacity, countOf(json, "\"ph\":\"X\""));
+    size_t previous = 0;
+    for (size_t i : {size_t(1), size_t(63), size_t(64), size_t(4031), size_t(4032), size_t(9999)}) {
+        char duration[32];
+        std::snprintf(duration, sizeof(duration), "\"dur\":%zu.%03zu}", i / 1000, i % 1000);
+        const size_t pos = json.find(duration);
+        ASSERT_NE(std::string::npos, pos) << i;
+        EXPECT_LT(previous, pos) << i;
+        previous = pos;
+    }
+}
+
+TEST(ZeChromeTrace, GivenManyShortLivedThreadsWhenWritingThenEventsOfExitedThreadsAreKept) {
+    const std::string path = ::testing::TempDir() + "ze_chrome_trace_short_lived.json";
+    constexpr int threadCount = 200;
+    ChromeTraceRecorder recorder(path, 131072);
+    for (int t = 0; t < threadCount; ++t) {
+        std::thread([&recorder]() {
+            const uint64_t begin = ChromeTraceRecorder::nowNs();
+            recorder.record("zeCommandQueueSynchronize", begin, begin + 1);
+            recorder.record("zeCommandQueueSynchronize", begin + 2, begin + 3);
+        }).join();
+    }
+    EXPECT_EQ(0u, recorder.droppedEvents());
+    ASSERT_TRUE(recorder.write());
+
+    const std::string json = readFile(path);
+    std::remove(path.c_str());
+    EXPECT_EQ(static_cast<size_t>(2 * threadCount), countOf(json, "\"ph\":\"X\""));
+}
+
+TEST(ZeChromeTrace, GivenUnwritablePathWhenWritingThenFalseIsReturned) {
+    ChromeTraceRecorder recorder(::testing::TempDir() + "missing_directory/trace.json", 4);
+    recorder.record("zeInit", 0, 1);
+    EXPECT_FALSE(recorder.write());
+}
+
+TEST(ZeChromeTrace, GivenOutOfRangeEventCountsWhenCreatingRecorderThenItIsClampedOrDefaulted) {
+    const std::string path = ::testing::TempDir() + "ze_chrome_trace_env.json";
+    static std::string fileEnv;
+    fileEnv = "ZEL_TRACING_CHROME_TRACE_FILE=" + path;
+    putenv_safe(const_cast<char *>(fileEnv.c_str()));
+
+    // -1 wraps to SIZE_MAX and would never finish sizing the chunk table;
+    // the others would reserve far more memory than any trace needs.
+    const char *values[] = {"ZEL_TRACING_CHROME_TRACE_EVENTS=-1",
+                            "ZEL_TRACING_CHROME_TRACE_EVENTS=0",
+                            "ZEL_TRACING_CHROME_TRACE_EVENTS=1000000000000",
+                            "ZEL_TRACING_CHROME_TRACE_EVENTS=99999999999999999999999"};
+    for (const char *value : values) {
+        putenv_safe(const_cast<char *>(value));
+        std::unique_ptr<ChromeTraceRecorder> recorder(tracing_layer::createChromeTraceRecorder());
+        ASSERT_NE(nullptr, recorder) << value;
+        const uint64_t now = ChromeTraceRecorder::nowNs();
+        recorder->record("zeInit", now, now + 1);
+        EXPECT_EQ(0u, recorder->droppedEvents()) << value;
+        ASSERT_TRUE(recorder->write()) << value;
+        EXPECT_EQ(1u, countOf(readFile(path), "\"ph\":\"X\"")) << value;
+    }
+    std::remove(path.c_str());
+
+    putenv_safe(const_cast<char *>("ZEL_TRACING_CHROME_TRACE_EVENTS="));
+    putenv_safe(const_cast<char *>("ZEL_TRACING_CHROME_TRACE_FILE="));
+}
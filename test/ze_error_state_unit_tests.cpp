@@ -0,0 +1,81 @@
+/*
+ *
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Standalone unit tests for error_state, the per-thread storage behind
+// zerGetLastErrorDescription.
+
+#include "gtest/gtest.h"
+
+#include "error_state.h"
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(ZeErrorState, GivenNoErrorOnThreadWhenGettingDescriptionThenEmptyStringIsReturned) {
+    std::thread([]() {
+        const char *desc = nullptr;
+        error_state::getErrorDesc(&desc);
+        ASSERT_NE(nullptr, desc);
+        EXPECT_STREQ("", desc);
+    }).join();
+}
+
+TEST(ZeErrorState, GivenErrorsOnTwoThreadsThenEachThreadSeesOnlyItsOwnDescription) {
+    error_state::setErrorDesc("ERROR UNINITIALIZED");
+    std::thread([]() {
+        error_state::setErrorDesc("ERROR UNSUPPORTED FEATURE");
+        const char *desc = nullptr;
+        error_state::getErrorDesc(&desc);
+        EXPECT_STREQ("ERROR UNSUPPORTED FEATURE", desc);
+    }).join();
+
+    const char *desc = nullptr;
+    error_state::getErrorDesc(&desc);
+    EXPECT_STREQ("ERROR UNINITIALIZED", desc);
+
+    error_state::setErrorDesc("ERROR UNSUPPORTED VERSION");
+    error_state::getErrorDesc(&desc);
+    EXPECT_STREQ("ERROR UNSUPPORTED VERSION", desc);
+}
+
+TEST(ZeErrorState, GivenThousandsOfShortLivedThreadsThenTheirDescriptionsAreFreedAtThreadExit) {
+    // Create the main thread's own description so the baseline counts it.
+    error_state::setErrorDesc("");
+    const size_t baseline = error_state::threadDescCount();
+
+    constexpr int rounds = 50;
+    constexpr int threadsPerRound = 100;
+    // Longer than any small-string buffer, so a leaked description would
+    // leak heap memory.
+    const std::string longDesc(256, 'e');
+    std::atomic<int> mismatches{0};
+    size_t peak = 0;
+    for (int round = 0; round < rounds; ++round) {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threadsPerRound; ++t) {
+            threads.emplace_back([&longDesc, &mismatches]() {
+                error_state::setErrorDesc(longDesc);
+                const char *desc = nullptr;
+                error_state::getErrorDesc(&desc);
+                if (longDesc != desc) {
+                    ++mismatches;
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        peak = std::max(peak, error_state::threadDescCount());
+        EXPECT_EQ(baseline, error_state::threadDescCount()) << "round " << round;
+    }
+    EXPECT_EQ(0, mismatches.load());
+    EXPECT_LE(peak, baseline + threadsPerRound);
+}
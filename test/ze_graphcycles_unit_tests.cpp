@@ -0,0 +1,82 @@
+/*
+ *
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Standalone unit tests for the node reclamation added to xla::GraphCycles,
+// the DAG behind the validation layer's events checker.
+
+#include "gtest/gtest.h"
+
+#include "xla/graphcycles.h"
+
+#include <cstdint>
+#include <vector>
+
+TEST(GraphCycles, GivenRemovedNodesWhenCompactingThenLiveNodesAreRenumberedDenselyInOrder) {
+    xla::GraphCycles dag;
+    std::vector<int32_t> nodes;
+    for (int i = 0; i < 6; ++i) {
+        nodes.push_back(dag.NewNode());
+    }
+    ASSERT_TRUE(dag.InsertEdge(nodes[1], nodes[3]));
+    ASSERT_TRUE(dag.InsertEdge(nodes[3], nodes[5]));
+    dag.RemoveNode(nodes[0]);
+    dag.RemoveNode(nodes[2]);
+    dag.RemoveNode(nodes[4]);
+    EXPECT_EQ(3, dag.NumNodes());
+
+    const std::vector<int32_t> remap = dag.Compact();
+    ASSERT_EQ(6u, remap.size());
+    EXPECT_EQ(-1, remap[nodes[0]]);
+    EXPECT_EQ(0, remap[nodes[1]]);
+    EXPECT_EQ(-1, remap[nodes[2]]);
+    EXPECT_EQ(1, remap[nodes[3]]);
+    EXPECT_EQ(-1, remap[nodes[4]]);
+    EXPECT_EQ(2, remap[nodes[5]]);
+
+    EXPECT_EQ(3, dag.NumNodes());
+    EXPECT_TRUE(dag.HasEdge(0, 1));
+    EXPECT_TRUE(dag.HasEdge(1, 2));
+    EXPECT_TRUE(dag.IsReachable(0, 2));
+    EXPECT_TRUE(dag.CheckInvariants());
+}
+
+TEST(GraphCycles, GivenCompactedGraphWhenInsertingEdgesThenCyclesAreStillRejected) {
+    xla::GraphCycles dag;
+    const int32_t a = dag.NewNode();
+    const int32_t removed = dag.NewNode();
+    const int32_t b = dag.NewNode();
+    // Give b a lower rank than a so compaction has to keep a reordered ranking.
+    ASSERT_TRUE(dag.InsertEdge(b, a));
+    dag.RemoveNode(removed);
+
+    const std::vector<int32_t> remap = dag.Compact();
+    EXPECT_FALSE(dag.InsertEdge(remap[a], remap[b]));
+
+    const int32_t c = dag.NewNode();
+    EXPECT_EQ(2, c);
+    EXPECT_TRUE(dag.InsertEdge(remap[a], c));
+    EXPECT_FALSE(dag.InsertEdge(c, remap[b]));
+    EXPECT_TRUE(dag.CheckInvariants());
+}
+
+TEST(GraphCycles, GivenRepeatedNodeChurnWhenCompactingPeriodicallyThenNodeCountFollowsLiveNodes) {
+    xla::GraphCycles dag;
+    int32_t previous = dag.NewNode();
+    for (int i = 0; i < 10000; ++i) {
+        const int32_t next = dag.NewNode();
+        ASSERT_TRUE(dag.InsertEdge(previous, next));
+        dag.RemoveNode(previous);
+        previous = next;
+        if (i % 1000 == 999) {
+            previous = dag.Compact()[previous];
+            EXPECT_EQ(0, previous);
+        }
+    }
+    EXPECT_EQ(1, dag.NumNodes());
+    EXPECT_TRUE(dag.CheckInvariants());
+}
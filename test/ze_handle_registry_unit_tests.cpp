@@ -0,0 +1,154 @@
+/*
+ *
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Standalone unit tests for validation_layer::HandleRegistry, the handle
+// table behind the validation layer's handle lifetime checks.
+
+#include "gtest/gtest.h"
+
+#include "handle_registry.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using validation_layer::HandleKind;
+using validation_layer::HandleRegistry;
+
+namespace {
+
+const void *fakeHandle(uintptr_t i) {
+    // Handles are pointers to driver objects: aligned and clustered.
+    return reinterpret_cast<const void *>(0x10000 + i * 64);
+}
+
+} // namespace
+
+TEST(HandleRegistry, GivenInsertedHandleWhenErasedThenItIsNoLongerLive) {
+    HandleRegistry registry;
+    EXPECT_TRUE(registry.insert(fakeHandle(1), HandleKind::Event));
+    EXPECT_FALSE(registry.insert(fakeHandle(1), HandleKind::Event));
+    EXPECT_TRUE(registry.contains(fakeHandle(1), HandleKind::Event));
+    EXPECT_EQ(1u, registry.size());
+
+    EXPECT_TRUE(registry.erase(fakeHandle(1), HandleKind::Event));
+    EXPECT_FALSE(registry.erase(fakeHandle(1), HandleKind::Event));
+    EXPECT_FALSE(registry.contains(fakeHandle(1), HandleKind::Event));
+    EXPECT_EQ(0u, registry.size());
+}
+
+TEST(HandleRegistry, GivenSameAddressUnderTwoKindsThenEntriesAreIndependent) {
+    HandleRegistry registry;
+    registry.insert(fakeHandle(7), HandleKind::Device);
+    EXPECT_FALSE(registry.contains(fakeHandle(7), HandleKind::Pwr));
+
+    registry.insert(fakeHandle(7), HandleKind::Pwr);
+    registry.erase(fakeHandle(7), HandleKind::Device);
+    EXPECT_FALSE(registry.contains(fakeHandle(7), HandleKind::Device));
+    EXPECT_TRUE(registry.contains(fakeHandle(7), HandleKind::Pwr));
+}
+
+TEST(HandleRegistry, GivenNullHandleThenItIsNeverTracked) {
+    HandleRegistry registry;
+    EXPECT_FALSE(registry.insert(nullptr, HandleKind::Context));
+    EXPECT_FALSE(registry.contains(nullptr, HandleKind::Context));
+    EXPECT_EQ(0u, registry.size());
+}
+
+TEST(HandleRegistry, GivenStateWordWhenUpdatedThenFindReturnsLatestValue) {
+    HandleRegistry registry;
+    uint32_t state = 0;
+    EXPECT_FALSE(registry.setState(fakeHandle(3), HandleKind::CommandList, 1));
+    EXPECT_FALSE(registry.find(fakeHandle(3), HandleKind::CommandList, state));
+
+    registry.insertOrAssign(fakeHandle(3), HandleKind::CommandList, 1);
+    ASSERT_TRUE(registry.find(fakeHandle(3), HandleKind::CommandList, state));
+    EXPECT_EQ(1u, state);
+
+    EXPECT_TRUE(registry.setState(fakeHandle(3), HandleKind::CommandList, 0));
+    registry.find(fakeHandle(3), HandleKind::CommandList, state);
+    EXPECT_EQ(0u, state);
+
+    registry.insertOrAssign(fakeHandle(3), HandleKind::CommandList, 1);
+    registry.find(fakeHandle(3), HandleKind::CommandList, state);
+    EXPECT_EQ(1u, state);
+    EXPECT_EQ(1u, registry.size());
+}
+
+TEST(HandleRegistry, GivenManyHandlesWhenErasingEveryOtherThenRemainingOnesAreStillFound) {
+    HandleRegistry registry;
+    constexpr uintptr_t count = 20000; // forces every shard to grow repeatedly
+    for (uintptr_t i = 0; i < count; ++i) {
+        ASSERT_TRUE(registry.insert(fakeHandle(i), HandleKind::Kernel, static_cast<uint32_t>(i)));
+    }
+    EXPECT_EQ(count, registry.size());
+
+    for (uintptr_t i = 0; i < count; i += 2) {
+        ASSERT_TRUE(registry.erase(fakeHandle(i), HandleKind::Kernel));
+    }
+    EXPECT_EQ(count / 2, registry.size());
+
+    for (uintptr_t i = 0; i < count; ++i) {
+        uint32_t state = 0;
+        const bool live = registry.find(fakeHandle(i), HandleKind::Kernel, state);
+        ASSERT_EQ((i & 1) != 0, live) << i;
+        if (live) {
+            EXPECT_EQ(i, state);
+        }
+    }
+}
+
+TEST(HandleRegistry, GivenConcurrentWritersAndReadersThenStableHandlesAreAlwaysFound) {
+    HandleRegistry registry;
+    constexpr uintptr_t stableCount = 256;
+    for (uintptr_t i = 0; i < stableCount; ++i) {
+        registry.insert(fakeHandle(i), HandleKind::Module);
+    }
+
+    constexpr int writerCount = 4;
+    constexpr uintptr_t perWriter = 5000;
+    std::atomic<bool> done{false};
+    std::atomic<int> misses{0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 2; ++r) {
+        readers.emplace_back([&]() {
+            while (!done.load()) {
+                for (uintptr_t i = 0; i < stableCount; ++i) {
+                    if (!registry.contains(fakeHandle(i), HandleKind::Module)) {
+                        misses++;
+                    }
+                }
+            }
+        });
+    }
+
+    std::vector<std::thread> writers;
+    for (int w = 0; w < writerCount; ++w) {
+        writers.emplace_back([&registry, w]() {
+            const uintptr_t base = stableCount + w * perWriter;
+            for (uintptr_t i = 0; i < perWriter; ++i) {
+                registry.insert(fakeHandle(base + i), HandleKind::Module);
+            }
+            for (uintptr_t i = 0; i < perWriter; ++i) {
+                registry.erase(fakeHandle(base + i), HandleKind::Module);
+            }
+        });
+    }
+    for (auto &writer : writers) {
+        writer.join();
+    }
+    done = true;
+    for (auto &reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(0, misses.load());
+    EXPECT_EQ(stableCount, registry.size());
+}
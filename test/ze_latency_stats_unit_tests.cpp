@@ -0,0 +1,139 @@
+/*
+ *
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Standalone unit tests for tracing_layer::LatencyHistogram and
+// tracing_layer::ApiLatencyStats, the tracing layer's statistics mode.
+
+#include "gtest/gtest.h"
+
+#include "tracing_latency_stats.h"
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using tracing_layer::ApiLatencyStats;
+using tracing_layer::LatencyHistogram;
+
+TEST(ZeLatencyStats, GivenValuesThenEachFallsInABucketAtMostOneSixteenthWide) {
+    const uint64_t values[] = {0, 1, 15, 16, 17, 31, 32, 33, 1000, 4095, 4096, 123456789, (uint64_t(1) << 40) - 1};
+    for (uint64_t value : values) {
+        const size_t index = LatencyHistogram::bucketIndex(value);
+        ASSERT_LT(index, LatencyHistogram::bucketCount);
+        EXPECT_LE(LatencyHistogram::bucketLowest(index), value) << value;
+        EXPECT_GE(LatencyHistogram::bucketHighest(index), value) << value;
+        EXPECT_LE(LatencyHistogram::bucketHighest(index) - LatencyHistogram::bucketLowest(index),
+                  value / LatencyHistogram::subBucketCount)
+            << value;
+    }
+    EXPECT_EQ(LatencyHistogram::bucketCount - 1, LatencyHistogram::bucketIndex(UINT64_MAX));
+
+    // Buckets tile the value range without gaps.
+    for (size_t index = 1; index < LatencyHistogram::bucketCount; ++index) {
+        EXPECT_EQ(LatencyHistogram::bucketHighest(index - 1) + 1, LatencyHistogram::bucketLowest(index)) << index;
+    }
+}
+
+TEST(ZeLatencyStats, GivenRecordedLatenciesThenPercentilesFollowTheDistribution) {
+    ApiLatencyStats stats(4);
+    for (uint64_t i = 1; i <= 1000; ++i) {
+        stats.record(2, "zeCommandListAppendLaunchKernel", i * 1000);
+    }
+    stats.record(0, "zeCommandQueueExecuteCommandLists", 50);
+
+    const auto snapshot = stats.snapshot();
+    ASSERT_EQ(2u, snapshot.size());
+    EXPECT_STREQ("zeCommandQueueExecuteCommandLists", snapshot[0].name);
+    EXPECT_EQ(1u, snapshot[0].callCount);
+    EXPECT_EQ(50u, snapshot[0].p50Ns);
+    EXPECT_EQ(50u, snapshot[0].p999Ns);
+
+    const auto &launch = snapshot[1];
+    EXPECT_STREQ("zeCommandListAppendLaunchKernel", launch.name);
+    EXPECT_EQ(1000u, launch.callCount);
+    EXPECT_EQ(500500000u, launch.totalNs);
+    EXPECT_EQ(1000u, launch.minNs);
+    EXPECT_EQ(1000000u, launch.maxNs);
+    EXPECT_GE(launch.p50Ns, 500000u);
+    EXPECT_LE(launch.p50Ns, 500000u + 500000u / 16);
+    EXPECT_GE(launch.p99Ns, 990000u);
+    EXPECT_LE(launch.p99Ns, 990000u + 990000u / 16);
+    EXPECT_EQ(1000000u, launch.p999Ns);
+}
+
+TEST(ZeLatencyStats, GivenResetThenOnlyLaterCallsAreReported) {
+    ApiLatencyStats stats(2);
+    stats.record(0, "zeInit", 100);
+    stats.record(1, "zeDriverGet", 100);
+    stats.reset();
+    EXPECT_TRUE(stats.snapshot().empty());
+
+    stats.record(1, "zeDriverGet", 200);
+    const auto snapshot = stats.snapshot();
+    ASSERT_EQ(1u, snapshot.size());
+    EXPECT_STREQ("zeDriverGet", snapshot[0].name);
+    EXPECT_EQ(1u, snapshot[0].callCount);
+    EXPECT_EQ(200u, snapshot[0].minNs);
+}
+
+TEST(ZeLatencyStats, GivenConcurrentThreadsThenCallsOfAllThreadsAreAggregated) {
+    ApiLatencyStats stats(1);
+    constexpr int threadCount = 4;
+    constexpr uint64_t callsPerThread = 10000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&stats, t]() {
+            for (uint64_t i = 0; i < callsPerThread; ++i) {
+                stats.record(0, "zeEventHostSynchronize", 100 * (t + 1));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    const auto snapshot = stats.snapshot();
+    ASSERT_EQ(1u, snapshot.size());
+    EXPECT_EQ(threadCount * callsPerThread, snapshot[0].callCount);
+    EXPECT_EQ(100u, snapshot[0].minNs);
+    EXPECT_EQ(400u, snapshot[0].maxNs);
+}
+
+TEST(ZeLatencyStats, GivenManyShortLivedThreadsThenTheirCallsAreKeptAndTheirStatisticsFreed) {
+    ApiLatencyStats stats(2);
+    constexpr int threadCount = 500;
+    for (int t = 0; t < threadCount; ++t) {
+        std::thread([&stats, t]() {
+            stats.record(0, "zeCommandQueueSynchronize", 100 + t);
+            stats.record(1, "zeEventHostSynchronize", 50);
+        }).join();
+    }
+    EXPECT_EQ(0u, stats.liveThreadCount());
+
+    auto snapshot = stats.snapshot();
+    ASSERT_EQ(2u, snapshot.size());
+    EXPECT_EQ(static_cast<uint64_t>(threadCount), snapshot[0].callCount);
+    EXPECT_EQ(100u, snapshot[0].minNs);
+    EXPECT_EQ(100u + threadCount - 1, snapshot[0].maxNs);
+    EXPECT_EQ(static_cast<uint64_t>(threadCount), snapshot[1].callCount);
+
+    // A live thread and the exited ones are reported together; a reset drops
+    // the exited threads' calls too.
+    stats.record(1, "zeEventHostSynchronize", 50);
+    EXPECT_EQ(1u, stats.liveThreadCount());
+    snapshot = stats.snapshot();
+    ASSERT_EQ(2u, snapshot.size());
+    EXPECT_EQ(threadCount + 1u, snapshot[1].callCount);
+
+    stats.reset();
+    std::thread([&stats]() { stats.record(0, "zeCommandQueueSynchronize", 7); }).join();
+    snapshot = stats.snapshot();
+    ASSERT_EQ(1u, snapshot.size());
+    EXPECT_EQ(1u, snapshot[0].callCount);
+    EXPECT_EQ(7u, snapshot[0].minNs);
+}
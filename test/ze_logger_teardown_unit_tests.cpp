@@ -97,3 +97,17 @@ TEST(ZeLoggerTeardown, LogFromThreadLocalDestructorAfterBufferTeardownIsSafe) {
     // the thread_local destruction phase did not touch freed memory.
     SUCCEED();
 }
+
+// Same teardown sequence with the asynchronous sink: the late record goes
+// through the lock-free ring rather than the thread_local line buffer, and the
+// writer thread must still be able to drain it when the logger is destroyed.
+TEST(ZeLoggerTeardown, AsyncLogFromThreadLocalDestructorAfterBufferTeardownIsSafe) {
+    loader::ZeLogger logger(/*use_stderr=*/true, loader::LogLevel::trace,
+                            "[%Y-%m-%d %H:%M:%S.%e] [tid:%t pid:%P] [%l] %v",
+                            /*async_records=*/64);
+
+    std::thread worker(workerLogsDuringTeardown, &logger);
+    worker.join();
+
+    SUCCEED();
+}
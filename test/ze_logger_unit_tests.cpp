@@ -0,0 +1,166 @@
+/*
+ *
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Standalone unit tests for loader::ZeLogger behaviour that does not depend on
+// the loader, drivers or layers.  Like ze_logger_teardown_unit_tests it links
+// only level_zero_utils.
+
+#include "gtest/gtest.h"
+
+#include "ze_logger.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+    #define putenv_safe _putenv
+#else
+    #define putenv_safe putenv
+#endif
+
+namespace {
+
+std::string countingMessage(int &evaluations) {
+    ++evaluations;
+    return "expensive message";
+}
+
+std::vector<std::string> readLines(const std::string &path) {
+    std::vector<std::string> lines;
+    std::ifstream in(path);
+    for (std::string line; std::getline(in, line);) {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+} // namespace
+
+TEST(ZeLogger, GivenNoopLoggerWhenCheckingShouldLogThenEveryLevelIsFiltered) {
+    loader::ZeLogger *logger = loader::noopLogger();
+    EXPECT_FALSE(logger->shouldLog(loader::LogLevel::trace));
+    EXPECT_FALSE(logger->shouldLog(loader::LogLevel::critical));
+}
+
+TEST(ZeLogger, GivenWarnLevelWhenCheckingShouldLogThenOnlyWarnAndAboveAreWritten) {
+    loader::ZeLogger logger(/*use_stderr=*/true, loader::LogLevel::warn, "%v");
+    EXPECT_FALSE(logger.shouldLog(loader::LogLevel::trace));
+    EXPECT_FALSE(logger.shouldLog(loader::LogLevel::info));
+    EXPECT_TRUE(logger.shouldLog(loader::LogLevel::warn));
+    EXPECT_TRUE(logger.shouldLog(loader::LogLevel::critical));
+}
+
+TEST(ZeLogger, GivenTraceFilteredOutWhenUsingZelLogTraceThenMessageIsNotBuilt) {
+    int evaluations = 0;
+    loader::ZeLogger logger(/*use_stderr=*/true, loader::LogLevel::err, "%v");
+    ZEL_LOG_TRACE(&logger, countingMessage(evaluations));
+    ZEL_LOG_TRACE(loader::noopLogger(), countingMessage(evaluations));
+    EXPECT_EQ(0, evaluations);
+}
+
+TEST(ZeLogger, GivenTraceEnabledWhenUsingZelLogTraceThenMessageIsBuiltOnce) {
+    int evaluations = 0;
+    loader::ZeLogger logger(/*use_stderr=*/true, loader::LogLevel::trace, "%v");
+    ZEL_LOG_TRACE(&logger, countingMessage(evaluations));
+    EXPECT_EQ(1, evaluations);
+}
+
+TEST(ZeLogger, GivenAsyncFileLoggerWhenDestroyedThenAllRecordsAreWrittenInOrder) {
+    const std::string path = ::testing::TempDir() + "ze_logger_async_order.log";
+    {
+        loader::ZeLogger logger(path, loader::LogLevel::trace, "%v", /*async_records=*/4096);
+        for (int i = 0; i < 1000; ++i) {
+            logger.info("record " + std::to_string(i));
+        }
+        // Longer than an async record: written synchronously after draining.
+        logger.info(std::string(4000, 'x'));
+    }
+    auto lines = readLines(path);
+    std::remove(path.c_str());
+
+    ASSERT_EQ(1001u, lines.size());
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ("record " + std::to_string(i), lines[i]);
+    }
+    EXPECT_EQ(std::string(4000, 'x'), lines[1000]);
+}
+
+TEST(ZeLogger, GivenFullAsyncRingWhenLoggingFromManyThreadsThenEveryRecordIsWrittenOrCountedAsDropped) {
+    const std::string path = ::testing::TempDir() + "ze_logger_async_drops.log";
+    constexpr int threadCount = 4;
+    constexpr int perThread = 2000;
+    {
+        loader::ZeLogger logger(path, loader::LogLevel::trace, "%v", /*async_records=*/8);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threadCount; ++t) {
+            threads.emplace_back([&logger]() {
+                for (int i = 0; i < perThread; ++i) {
+                    logger.info("payload");
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        logger.flush();
+    }
+    auto lines = readLines(path);
+    std::remove(path.c_str());
+
+    unsigned long long written = 0;
+    unsigned long long dropped = 0;
+    for (const auto &line : lines) {
+        if (line == "payload") {
+            ++written;
+        } else {
+            ASSERT_EQ(0u, line.find("ze_logger: ")) << line;
+            dropped += std::stoull(line.substr(11));
+        }
+    }
+    EXPECT_EQ(static_cast<unsigned long long>(threadCount * perThread), written + dropped);
+}
+
+TEST(ZeLogger, GivenOutOfRangeAsyncRecordCountsWhenCreatingLoggerThenTheDefaultRingIsUsed) {
+    const std::string dir = ::testing::TempDir();
+    static std::string dirEnv;
+    dirEnv = "ZEL_LOADER_LOG_DIR=" + dir;
+    putenv_safe(const_cast<char *>(dirEnv.c_str()));
+    putenv_safe(const_cast<char *>("ZEL_LOADER_LOG_FILE=ze_logger_async_env.log"));
+    putenv_safe(const_cast<char *>("ZEL_ENABLE_LOADER_LOGGING=1"));
+    putenv_safe(const_cast<char *>("ZEL_LOADER_LOGGING_LEVEL=info"));
+    putenv_safe(const_cast<char *>("ZEL_LOADER_LOG_PATTERN=%v"));
+    putenv_safe(const_cast<char *>("ZEL_LOADER_LOG_ASYNC=1"));
+
+    // -1 wraps to ULLONG_MAX and would never round up to a power of two; the
+    // others would allocate far more memory than any log needs.
+    const char *values[] = {"ZEL_LOADER_LOG_ASYNC_RECORDS=-1",
+                            "ZEL_LOADER_LOG_ASYNC_RECORDS=0",
+                            "ZEL_LOADER_LOG_ASYNC_RECORDS=1000000000",
+                            "ZEL_LOADER_LOG_ASYNC_RECORDS=99999999999999999999999"};
+    const std::string path = dir + "ze_logger_async_env.log";
+    for (const char *value : values) {
+        std::remove(path.c_str());
+        putenv_safe(const_cast<char *>(value));
+        {
+            auto logger = loader::createLogger();
+            logger->info(value);
+        }
+        auto lines = readLines(path);
+        ASSERT_EQ(1u, lines.size()) << value;
+        EXPECT_EQ(value, lines[0]);
+    }
+    std::remove(path.c_str());
+
+    putenv_safe(const_cast<char *>("ZEL_LOADER_LOG_ASYNC_RECORDS="));
+    putenv_safe(const_cast<char *>("ZEL_LOADER_LOG_ASYNC=0"));
+    putenv_safe(const_cast<char *>("ZEL_ENABLE_LOADER_LOGGING=0"));
+}
@@ -0,0 +1,170 @@
+/*
+ *
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Standalone unit tests for validation_layer::MemoryProfile and the address
+// table behind the validation layer's memory profiler checker.
+
+#include "gtest/gtest.h"
+
+#include "memory_profile.h"
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using validation_layer::AddressTable;
+using validation_layer::AllocationRecord;
+using validation_layer::MemoryAllocationType;
+using validation_layer::MemoryProfile;
+
+namespace {
+
+const void *fakePointer(uintptr_t i) {
+    // Allocations are page aligned and clustered.
+    return reinterpret_cast<const void *>(0x7f0000000000ull + i * 4096);
+}
+
+const void *const context = reinterpret_cast<const void *>(0x1000);
+const void *const device = reinterpret_cast<const void *>(0x2000);
+
+constexpr uint64_t us = 1000;
+constexpr uint64_t ms = 1000 * us;
+
+} // namespace
+
+TEST(MemoryProfileAddressTable, GivenManyKeysWhenTakingEveryOtherThenRemainingOnesAreStillFound) {
+    AddressTable<uint64_t> table(8);
+    constexpr uintptr_t count = 10000; // forces the table to grow repeatedly
+    for (uintptr_t i = 1; i <= count; ++i) {
+        bool inserted = false;
+        table.findOrInsert(reinterpret_cast<uintptr_t>(fakePointer(i)), inserted) = i;
+        ASSERT_TRUE(inserted);
+    }
+    EXPECT_EQ(count, table.size());
+
+    for (uintptr_t i = 1; i <= count; i += 2) {
+        uint64_t value = 0;
+        ASSERT_TRUE(table.take(reinterpret_cast<uintptr_t>(fakePointer(i)), value));
+        EXPECT_EQ(i, value);
+    }
+    EXPECT_EQ(count / 2, table.size());
+
+    for (uintptr_t i = 1; i <= count; ++i) {
+        const uint64_t *value = table.find(reinterpret_cast<uintptr_t>(fakePointer(i)));
+        ASSERT_EQ((i & 1) == 0, value != nullptr) << i;
+        if (value) {
+            EXPECT_EQ(i, *value);
+        }
+    }
+}
+
+TEST(MemoryProfile, GivenAllocationsAndFreesThenLiveBytesAndPeakArePerPool) {
+    MemoryProfile profile;
+    profile.recordAlloc(fakePointer(1), 4096, context, device, MemoryAllocationType::Device, 0);
+    profile.recordAlloc(fakePointer(2), 1024, context, device, MemoryAllocationType::Device, 0);
+    profile.recordAlloc(fakePointer(3), 512, context, nullptr, MemoryAllocationType::Host, 0);
+    EXPECT_EQ(5632u, profile.liveBytes());
+
+    AllocationRecord record;
+    ASSERT_TRUE(profile.takeAlloc(fakePointer(1), record));
+    profile.commitFree(record, 5 * us);
+    EXPECT_FALSE(profile.takeAlloc(fakePointer(1), record));
+    EXPECT_EQ(1536u, profile.liveBytes());
+    EXPECT_EQ(5632u, profile.peakBytes());
+
+    const auto pools = profile.pools();
+    ASSERT_EQ(2u, pools.size());
+    EXPECT_EQ(MemoryAllocationType::Device, pools[0].type);
+    EXPECT_EQ(device, pools[0].device);
+    EXPECT_EQ(1024u, pools[0].liveBytes);
+    EXPECT_EQ(5120u, pools[0].peakBytes);
+    EXPECT_EQ(2u, pools[0].allocCount);
+    EXPECT_EQ(1u, pools[0].freeCount);
+    EXPECT_EQ(MemoryAllocationType::Host, pools[1].type);
+    EXPECT_EQ(512u, pools[1].liveBytes);
+}
+
+TEST(MemoryProfile, GivenFailedFreeWhenRestoringThenAllocationIsStillLive) {
+    MemoryProfile profile;
+    profile.recordAlloc(fakePointer(1), 256, context, device, MemoryAllocationType::Shared, 0);
+
+    AllocationRecord record;
+    ASSERT_TRUE(profile.takeAlloc(fakePointer(1), record));
+    profile.restoreAlloc(fakePointer(1), record);
+    EXPECT_EQ(256u, profile.liveBytes());
+
+    ASSERT_TRUE(profile.takeAlloc(fakePointer(1), record));
+    EXPECT_EQ(256u, record.size);
+    profile.commitFree(record, 1 * ms);
+    EXPECT_EQ(0u, profile.liveBytes());
+}
+
+TEST(MemoryProfile, GivenSizesAndLifetimesThenHistogramBucketsAreCounted) {
+    EXPECT_EQ(0u, MemoryProfile::sizeBucket(1));
+    EXPECT_EQ(1u, MemoryProfile::sizeBucket(2));
+    EXPECT_EQ(12u, MemoryProfile::sizeBucket(4096));
+    EXPECT_EQ(13u, MemoryProfile::sizeBucket(4097));
+    EXPECT_EQ(64u, MemoryProfile::sizeBucket(UINT64_MAX));
+
+    EXPECT_EQ(0u, MemoryProfile::lifetimeBucket(9 * us));
+    EXPECT_EQ(1u, MemoryProfile::lifetimeBucket(10 * us));
+    EXPECT_EQ(3u, MemoryProfile::lifetimeBucket(5 * ms));
+    EXPECT_EQ(7u, MemoryProfile::lifetimeBucket(UINT64_MAX));
+
+    MemoryProfile profile;
+    AllocationRecord record;
+    for (uintptr_t i = 0; i < 3; ++i) {
+        profile.recordAlloc(fakePointer(i), 4096, context, device, MemoryAllocationType::Device, 0);
+        profile.takeAlloc(fakePointer(i), record);
+        profile.commitFree(record, 5 * ms);
+    }
+    profile.recordAlloc(fakePointer(9), 100, context, device, MemoryAllocationType::Device, 0);
+
+    const auto sizes = profile.sizeHistogram();
+    EXPECT_EQ(3u, sizes[12]);
+    EXPECT_EQ(1u, sizes[7]);
+    const auto lifetimes = profile.lifetimeHistogram();
+    EXPECT_EQ(3u, lifetimes[3]);
+
+    const auto churn = profile.churn(10);
+    ASSERT_EQ(1u, churn.size());
+    EXPECT_EQ(4096u, churn[0].first);
+    EXPECT_EQ(3u, churn[0].second);
+
+    const std::string report = profile.report(1000 * ms);
+    EXPECT_NE(std::string::npos, report.find("peak bytes = 4096"));
+    EXPECT_NE(std::string::npos, report.find("4 KB : 3 allocs, 3.0 allocs/s"));
+}
+
+TEST(MemoryProfile, GivenConcurrentAllocatorsThenAllBytesAreAccountedFor) {
+    MemoryProfile profile;
+    constexpr int threadCount = 4;
+    constexpr uintptr_t perThread = 2000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&profile, t]() {
+            const uintptr_t base = t * perThread;
+            AllocationRecord record;
+            for (uintptr_t i = 0; i < perThread; ++i) {
+                profile.recordAlloc(fakePointer(base + i), 64, context, device, MemoryAllocationType::Device, 0);
+            }
+            for (uintptr_t i = 0; i < perThread; i += 2) {
+                profile.takeAlloc(fakePointer(base + i), record);
+                profile.commitFree(record, 1);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(threadCount * perThread / 2 * 64, profile.liveBytes());
+    const auto pools = profile.pools();
+    ASSERT_EQ(1u, pools.size());
+    EXPECT_EQ(threadCount * perThread, pools[0].allocCount);
+}
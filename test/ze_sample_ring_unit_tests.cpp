@@ -0,0 +1,91 @@
+/*
+ *
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Standalone unit tests for ze_lib::sample_ring_t, the per-component history
+// behind the zelSysmanSampler* APIs.
+
+#include "gtest/gtest.h"
+
+#include "sample_ring.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+using ze_lib::sample_ring_t;
+
+namespace {
+
+sample_ring_t::sample_t makeSample(uint64_t i) {
+    sample_ring_t::sample_t sample;
+    sample.timeNs = 1000 * i;
+    sample.counter = 7 * i;
+    sample.timestamp = i;
+    return sample;
+}
+
+} // namespace
+
+TEST(ZeSampleRing, GivenSamplesWhenReadingAWindowThenOldestAndNewestSamplesInTheWindowAreReturned) {
+    sample_ring_t ring(8);
+    EXPECT_EQ(0u, ring.read(0).count);
+
+    for (uint64_t i = 1; i <= 5; ++i) {
+        ring.push(makeSample(i));
+    }
+    auto window = ring.read(0);
+    EXPECT_EQ(5u, window.count);
+    EXPECT_EQ(1000u, window.first.timeNs);
+    EXPECT_EQ(5000u, window.last.timeNs);
+    EXPECT_EQ(35u, window.last.counter);
+
+    window = ring.read(3000);
+    EXPECT_EQ(3u, window.count);
+    EXPECT_EQ(3000u, window.first.timeNs);
+    EXPECT_EQ(21u, window.first.counter);
+
+    EXPECT_EQ(0u, ring.read(6000).count);
+}
+
+TEST(ZeSampleRing, GivenMoreSamplesThanCapacityThenOnlyTheNewestSamplesAreKept) {
+    sample_ring_t ring(4);
+    for (uint64_t i = 1; i <= 10; ++i) {
+        ring.push(makeSample(i));
+    }
+    EXPECT_EQ(10u, ring.size());
+    const auto window = ring.read(0);
+    EXPECT_EQ(4u, window.count);
+    EXPECT_EQ(7000u, window.first.timeNs);
+    EXPECT_EQ(10000u, window.last.timeNs);
+}
+
+TEST(ZeSampleRing, GivenAConcurrentWriterThenReadersOnlySeeCompleteSamples) {
+    sample_ring_t ring(16);
+    std::atomic<bool> done{false};
+    std::thread writer([&]() {
+        for (uint64_t i = 1; i <= 200000; ++i) {
+            ring.push(makeSample(i));
+        }
+        done = true;
+    });
+
+    uint64_t reads = 0;
+    while (!done || reads == 0) {
+        const auto window = ring.read(0);
+        if (window.count > 0) {
+            // Every field of a sample comes from the same push.
+            ASSERT_EQ(window.first.timeNs, 1000 * window.first.timestamp);
+            ASSERT_EQ(window.first.counter, 7 * window.first.timestamp);
+            ASSERT_EQ(window.last.counter, 7 * window.last.timestamp);
+            ASSERT_EQ(window.count - 1, window.last.timestamp - window.first.timestamp);
+            ASSERT_LE(window.count, 16u);
+        }
+        ++reads;
+    }
+    writer.join();
+}
@@ -0,0 +1,146 @@
+/*
+ *
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Standalone unit tests for singleton_factory_t, the handle wrapper factory
+// shared by every loader object type.  Header only; no loader or drivers.
+
+#include "gtest/gtest.h"
+
+#include "ze_singleton.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct fake_handle_t;
+
+struct fake_object_t {
+    fake_handle_t *handle;
+    int tag;
+    fake_object_t(fake_handle_t *h, int t) : handle(h), tag(t) {}
+};
+
+using fake_factory_t = singleton_factory_t<fake_object_t, fake_handle_t *>;
+
+fake_handle_t *toHandle(uintptr_t value) {
+    return reinterpret_cast<fake_handle_t *>(value);
+}
+
+} // namespace
+
+TEST(SingletonFactory, GivenSameKeyWhenGettingInstanceTwiceThenFirstInstanceIsReturned) {
+    fake_factory_t factory;
+    auto first = factory.getInstance(toHandle(0x1000), 1);
+    auto second = factory.getInstance(toHandle(0x1000), 2);
+    ASSERT_NE(nullptr, first);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(1, second->tag);
+    EXPECT_TRUE(factory.hasInstance(toHandle(0x1000)));
+}
+
+TEST(SingletonFactory, GivenNullKeyWhenGettingInstanceThenNullIsReturned) {
+    fake_factory_t factory;
+    EXPECT_EQ(nullptr, factory.getInstance(toHandle(0), 1));
+    EXPECT_FALSE(factory.hasInstance(toHandle(0)));
+}
+
+TEST(SingletonFactory, GivenReleasedKeyWhenGettingInstanceThenNewInstanceIsCreated) {
+    fake_factory_t factory;
+    factory.getInstance(toHandle(0x2000), 1);
+    factory.release(toHandle(0x2000));
+    EXPECT_FALSE(factory.hasInstance(toHandle(0x2000)));
+    factory.release(toHandle(0x2000));
+
+    auto recreated = factory.getInstance(toHandle(0x2000), 3);
+    ASSERT_NE(nullptr, recreated);
+    EXPECT_EQ(3, recreated->tag);
+}
+
+TEST(SingletonFactory, GivenManyKeysWhenGettingInstancesThenEachKeyMapsToItsOwnInstance) {
+    fake_factory_t factory;
+    constexpr uintptr_t count = 4096;
+    for (uintptr_t i = 1; i <= count; ++i) {
+        factory.getInstance(toHandle(i * 64), static_cast<int>(i));
+    }
+    for (uintptr_t i = 1; i <= count; ++i) {
+        ASSERT_TRUE(factory.hasInstance(toHandle(i * 64)));
+        auto object = factory.getInstance(toHandle(i * 64), -1);
+        EXPECT_EQ(toHandle(i * 64), object->handle);
+        EXPECT_EQ(static_cast<int>(i), object->tag);
+    }
+}
+
+TEST(SingletonFactory, GivenConcurrentCreateLookupAndReleaseThenSharedKeyKeepsOneInstance) {
+    fake_factory_t factory;
+    auto shared = factory.getInstance(toHandle(0x10), 0);
+
+    constexpr int threadCount = 8;
+    constexpr uintptr_t perThread = 2000;
+    std::atomic<int> mismatches{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&factory, &mismatches, shared, t]() {
+            const uintptr_t base = (static_cast<uintptr_t>(t) + 1) << 20;
+            for (uintptr_t i = 0; i < perThread; ++i) {
+                auto handle = toHandle(base + i * 16);
+                auto object = factory.getInstance(handle, t);
+                if (object->handle != handle || object->tag != t) {
+                    ++mismatches;
+                }
+                if (factory.getInstance(toHandle(0x10), t) != shared) {
+                    ++mismatches;
+                }
+                if (i % 2) {
+                    factory.release(handle);
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(0, mismatches.load());
+    for (int t = 0; t < threadCount; ++t) {
+        const uintptr_t base = (static_cast<uintptr_t>(t) + 1) << 20;
+        for (uintptr_t i = 0; i < perThread; ++i) {
+            EXPECT_EQ(i % 2 == 0, factory.hasInstance(toHandle(base + i * 16)));
+        }
+    }
+}
+
+TEST(SingletonFactory, GivenReleasedInstanceWhenCreatingAnotherThenItsStorageIsReused) {
+    fake_factory_t factory;
+    auto first = factory.getInstance(toHandle(0x3000), 1);
+    factory.release(toHandle(0x3000));
+    auto second = factory.getInstance(toHandle(0x3000), 2);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(2, second->tag);
+}
+
+TEST(SlabPool, GivenMoreAllocationsThanOneSlabWhenFreeingAndReallocatingThenBlocksAreDistinctAndReused) {
+    slab_pool_t pool;
+    ASSERT_TRUE(pool.servesSize(24));
+    EXPECT_FALSE(pool.servesSize(32));
+
+    std::vector<void *> blocks;
+    for (size_t i = 0; i < 3 * slab_pool_t::firstSlabBlocks; ++i) {
+        blocks.push_back(pool.allocate());
+        EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(blocks.back()) % alignof(std::max_align_t));
+    }
+    std::vector<void *> sorted(blocks);
+    std::sort(sorted.begin(), sorted.end());
+    EXPECT_EQ(sorted.end(), std::adjacent_find(sorted.begin(), sorted.end()));
+
+    void *freed = blocks[5];
+    pool.deallocate(freed);
+    EXPECT_EQ(freed, pool.allocate());
+}
@@ -0,0 +1,65 @@
+/*
+ *
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Standalone unit tests for the per-entry-point checker lists the validation
+// layer builds at checker registration.  Header only.
+
+#include "gtest/gtest.h"
+
+#include "ze_entry_points.h"
+
+using validation_layer::ZEValidationDispatch;
+using validation_layer::ZEValidationEntryPoints;
+
+namespace {
+
+class InitChecker : public ZEValidationEntryPoints {
+public:
+    ze_result_t zeInitPrologue(ze_init_flags_t) override { return ZE_RESULT_SUCCESS; }
+};
+
+class InitAndMemFreeChecker : public InitChecker {
+public:
+    ze_result_t zeMemFreeEpilogue(ze_context_handle_t, void *, ze_result_t) override { return ZE_RESULT_SUCCESS; }
+};
+
+} // namespace
+
+TEST(ValidationDispatch, GivenCheckerOverridingOnePrologueThenOnlyThatEntryPointListsIt) {
+    ZEValidationDispatch dispatch;
+    InitChecker checker;
+    dispatch.addChecker(&checker);
+
+    ASSERT_EQ(1u, dispatch.zeInitPrologue.size());
+    EXPECT_EQ(&checker, dispatch.zeInitPrologue[0]);
+    EXPECT_TRUE(dispatch.zeInitEpilogue.empty());
+    EXPECT_TRUE(dispatch.zeMemFreePrologue.empty());
+    EXPECT_TRUE(dispatch.zeMemFreeEpilogue.empty());
+}
+
+TEST(ValidationDispatch, GivenDerivedCheckerThenInheritedAndOwnOverridesAreListed) {
+    ZEValidationDispatch dispatch;
+    InitChecker first;
+    InitAndMemFreeChecker second;
+    dispatch.addChecker(&first);
+    dispatch.addChecker(&second);
+
+    // InitAndMemFreeChecker does not redeclare zeInitPrologue, but it still
+    // inherits InitChecker's override rather than the no-op default.
+    ASSERT_EQ(2u, dispatch.zeInitPrologue.size());
+    EXPECT_EQ(&first, dispatch.zeInitPrologue[0]);
+    EXPECT_EQ(&second, dispatch.zeInitPrologue[1]);
+    ASSERT_EQ(1u, dispatch.zeMemFreeEpilogue.size());
+    EXPECT_EQ(&second, dispatch.zeMemFreeEpilogue[0]);
+}
+
+TEST(ValidationDispatch, GivenNullCheckerThenNothingIsListed) {
+    ZEValidationDispatch dispatch;
+    dispatch.addChecker(static_cast<InitChecker *>(nullptr));
+    EXPECT_TRUE(dispatch.zeInitPrologue.empty());
+}
@@ -170,6 +170,69 @@ void GraphCycles::RemoveNode(int32_t node) {
   rep_->free_nodes_.push_back(node);
 }
 
+int32_t GraphCycles::NumNodes() const {
+  return static_cast<int32_t>(rep_->nodes_.size() - rep_->free_nodes_.size());
+}
+
+std::vector<int32_t> GraphCycles::Compact() {
+  Rep* r = rep_;
+  const int32_t n = static_cast<int32_t>(r->nodes_.size());
+  std::vector<int32_t> remap(n, 0);
+  for (int32_t x : r->free_nodes_) {
+    remap[x] = -1;
+  }
+
+  std::vector<int32_t> live_nodes;
+  live_nodes.reserve(n - r->free_nodes_.size());
+  for (int32_t x = 0; x < n; x++) {
+    if (remap[x] != -1) {
+      remap[x] = static_cast<int32_t>(live_nodes.size());
+      live_nodes.push_back(x);
+    }
+  }
+
+  // Ranks must stay a permutation of [0, nodes_.size()-1]; sorting the live
+  // nodes by their old rank and handing out 0..k-1 keeps every edge ordered.
+  std::vector<int32_t> by_rank = live_nodes;
+  std::sort(by_rank.begin(), by_rank.end(), [r](int32_t a, int32_t b) {
+    return r->nodes_[a].rank < r->nodes_[b].rank;
+  });
+
+  const size_t k = live_nodes.size();
+  std::vector<Node> nodes(k);
+  std::vector<NodeIO> node_io(k);
+  std::vector<void*> node_data(k);
+  for (size_t i = 0; i < k; i++) {
+    Node* nx = &nodes[remap[by_rank[i]]];
+    nx->rank = static_cast<int32_t>(i);
+    nx->visited = false;
+  }
+  for (int32_t x : live_nodes) {
+    NodeIO* from = &r->node_io_[x];
+    NodeIO* to = &node_io[remap[x]];
+    to->out.Reserve(from->out.Size());
+    for (int32_t y : from->out.GetSequence()) {
+      to->out.Insert(remap[y]);
+    }
+    to->in.Reserve(from->in.Size());
+    for (int32_t y : from->in.GetSequence()) {
+      to->in.Insert(remap[y]);
+    }
+    node_data[remap[x]] = r->node_data_[x];
+  }
+
+  r->nodes_.swap(nodes);
+  r->node_io_.swap(node_io);
+  r->node_data_.swap(node_data);
+  std::vector<int32_t>().swap(r->free_nodes_);
+  std::vector<int32_t>().swap(r->deltaf_);
+  std::vector<int32_t>().swap(r->deltab_);
+  std::vector<int32_t>().swap(r->list_);
+  std::vector<int32_t>().swap(r->merged_);
+  std::vector<int32_t>().swap(r->stack_);
+  return remap;
+}
+
 void* GraphCycles::GetNodeData(int32_t node) const {
   return rep_->node_data_[node];
 }
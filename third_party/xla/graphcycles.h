@@ -76,6 +76,15 @@ class GraphCycles {
   // NewNode().
   void RemoveNode(int32_t node);
 
+  // Return the number of node identifiers currently allocated.
+  int32_t NumNodes() const;
+
+  // Renumber the allocated nodes densely, keeping their relative order, and
+  // release the storage held by removed nodes.  Returns a vector indexed by
+  // old node id holding the new id, or -1 for ids that were not allocated.
+  // Every node id held by the caller must be translated through it.
+  std::vector<int32_t> Compact();
+
   // Attempt to insert an edge from source_node to dest_node.  If the
   // edge would introduce a cycle, return false without making any
   // changes. Otherwise add the edge and return true.